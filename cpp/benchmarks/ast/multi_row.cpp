@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <list>
+#include <optional>
+#include <string>
+
+// Evaluates (((c0 + c1) + c2) + ...) with one or several rows per thread and operator step
+static void bench_ast_multi_row(nvbench::state& state)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const tree_levels = static_cast<cudf::size_type>(state.get_int64("tree_levels"));
+  auto const nullable    = state.get_int64("nullable") != 0;
+  auto const evaluation  = state.get_string("evaluation") == "MULTI_ROW"
+                             ? cudf::ast_evaluation::INTERPRETED_MULTI_ROW
+                             : cudf::ast_evaluation::INTERPRETED;
+
+  auto const num_columns = tree_levels + 1;
+  auto const source_table =
+    create_sequence_table(cycle_dtypes({cudf::type_id::INT32}, num_columns),
+                          row_count{num_rows},
+                          nullable ? std::optional<double>{0.5} : std::nullopt);
+  auto const table = source_table->view();
+
+  // std::list keeps references to earlier expressions valid as the tree grows
+  auto column_refs = std::list<cudf::ast::column_reference>();
+  auto expressions = std::list<cudf::ast::operation>();
+  for (cudf::size_type i = 0; i < num_columns; ++i) {
+    column_refs.emplace_back(i);
+  }
+  auto column_ref       = column_refs.cbegin();
+  auto const& first_ref = *column_ref++;
+  expressions.emplace_back(cudf::ast::ast_operator::ADD, first_ref, *column_ref++);
+  for (; column_ref != column_refs.cend(); ++column_ref) {
+    expressions.emplace_back(cudf::ast::ast_operator::ADD, expressions.back(), *column_ref);
+  }
+
+  auto const stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.add_global_memory_reads<nvbench::int32_t>(static_cast<std::size_t>(num_rows) *
+                                                  num_columns);
+  state.add_global_memory_writes<nvbench::int32_t>(num_rows);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = cudf::compute_column(table, expressions.back(), evaluation);
+  });
+}
+
+NVBENCH_BENCH(bench_ast_multi_row)
+  .set_name("ast_multi_row")
+  .add_string_axis("evaluation", {"INTERPRETED", "MULTI_ROW"})
+  .add_int64_axis("tree_levels", {1, 5, 10, 20})
+  .add_int64_axis("num_rows", {100'000, 1'000'000, 10'000'000, 100'000'000})
+  .add_int64_axis("nullable", {0, 1});
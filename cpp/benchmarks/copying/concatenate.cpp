@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+// Concatenates many small batches, e.g. the chunks returned by a chunked reader
+static void bench_concatenate_many(nvbench::state& state)
+{
+  auto const data_type =
+    state.get_string("data_type") == "STRING" ? cudf::type_id::STRING : cudf::type_id::INT64;
+  auto const num_inputs     = static_cast<cudf::size_type>(state.get_int64("num_inputs"));
+  auto const rows_per_input = static_cast<cudf::size_type>(state.get_int64("rows_per_input"));
+  auto const nullable       = state.get_int64("nullable") != 0;
+
+  auto const num_rows = num_inputs * rows_per_input;
+  auto const profile  = data_profile_builder()
+                         .null_probability(nullable ? std::optional<double>{0.1} : std::nullopt)
+                         .distribution(cudf::type_id::STRING, distribution_id::NORMAL, 0, 32);
+  auto const input = create_random_table({data_type}, row_count{num_rows}, profile);
+
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type i = 1; i < num_inputs; ++i) {
+    splits.push_back(i * rows_per_input);
+  }
+  auto const batches = cudf::split(input->view(), splits);
+
+  auto const stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.add_global_memory_reads<nvbench::int8_t>(input->alloc_size());
+  state.add_global_memory_writes<nvbench::int8_t>(input->alloc_size());
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = cudf::concatenate(batches, stream);
+  });
+}
+
+NVBENCH_BENCH(bench_concatenate_many)
+  .set_name("concatenate_many")
+  .add_string_axis("data_type", {"INT64", "STRING"})
+  .add_int64_axis("num_inputs", {64, 1024, 8192})
+  .add_int64_axis("rows_per_input", {128, 4096})
+  .add_int64_axis("nullable", {0, 1});
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+// This benchmark measures decimal128 arithmetic on values which fit in 64 bits, which use the
+// 64-bit division fast path, and on values which need the full 128 bits
+void bench_decimal128_binaryop(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const op_name   = state.get_string("op");
+  auto const wide      = state.get_int64("wide_values") != 0;
+  auto const input_id  = cudf::type_id::DECIMAL128;
+  auto const rep_bound = wide ? numeric::detail::ipow<__int128_t, numeric::Radix::BASE_10>(30)
+                              : numeric::detail::ipow<__int128_t, numeric::Radix::BASE_10>(15);
+
+  data_profile const profile = data_profile_builder()
+                                 .distribution(input_id,
+                                               distribution_id::UNIFORM,
+                                               __int128_t{1},
+                                               rep_bound,
+                                               numeric::scale_type{-4})
+                                 .no_validity();
+  auto const table = create_random_table({input_id, input_id}, row_count{num_rows}, profile);
+  auto const lhs   = table->get_column(0).view();
+  auto const rhs   = table->get_column(1).view();
+
+  auto const op = op_name == "ADD"   ? cudf::binary_operator::ADD
+                  : op_name == "MUL" ? cudf::binary_operator::MUL
+                                     : cudf::binary_operator::DIV;
+  auto const output_type = cudf::data_type{input_id, numeric::scale_type{-4}};
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch&) { cudf::binary_operation(lhs, rhs, op, output_type); });
+
+  state.add_element_count(num_rows);
+  state.add_global_memory_reads<__int128_t>(2 * num_rows);
+  state.add_global_memory_writes<__int128_t>(num_rows);
+}
+
+NVBENCH_BENCH(bench_decimal128_binaryop)
+  .set_name("decimal128_binaryop")
+  .add_int64_power_of_two_axis("num_rows", {20, 24})
+  .add_string_axis("op", {"ADD", "MUL", "DIV"})
+  .add_int64_axis("wide_values", {0, 1});
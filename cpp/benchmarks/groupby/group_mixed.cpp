@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Returns `num_rows` keys in [1, cardinality] with a Zipf-like distribution of exponent
+ * `skew`
+ *
+ * The keys are sampled from the inverse CDF of the bounded power law, so that a skew of 0 gives
+ * uniform keys and larger skews concentrate the rows in the smallest keys.
+ */
+std::vector<int64_t> make_skewed_keys(cudf::size_type num_rows, int64_t cardinality, double skew)
+{
+  std::mt19937_64 generator{42};
+  std::uniform_real_distribution<double> distribution(0., 1.);
+  auto const n = static_cast<double>(cardinality);
+
+  std::vector<int64_t> keys(num_rows);
+  for (auto& key : keys) {
+    auto const u = distribution(generator);
+    auto const x = std::abs(skew - 1.) < 1e-9
+                     ? std::pow(n, u)
+                     : std::pow((std::pow(n, 1. - skew) - 1.) * u + 1., 1. / (1. - skew));
+    key          = std::min(cardinality, std::max<int64_t>(1, static_cast<int64_t>(x)));
+  }
+  return keys;
+}
+
+/**
+ * @brief Returns the key columns with the groups of `keys`
+ *
+ * Each key column is a multiple of `keys`, so that every number of key columns has the same
+ * groups. String keys are the decimal representation of the integer keys.
+ */
+std::vector<std::unique_ptr<cudf::column>> make_key_columns(std::vector<int64_t> const& keys,
+                                                            cudf::size_type num_key_columns,
+                                                            bool string_keys)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (cudf::size_type i = 0; i < num_key_columns; ++i) {
+    std::vector<int64_t> column_keys(keys.size());
+    std::transform(keys.begin(), keys.end(), column_keys.begin(), [i](auto key) {
+      return key * (i + 1);
+    });
+    auto column =
+      cudf::test::fixed_width_column_wrapper<int64_t>(column_keys.begin(), column_keys.end())
+        .release();
+    if (string_keys) { column = cudf::strings::from_integers(column->view()); }
+    columns.push_back(std::move(column));
+  }
+  return columns;
+}
+
+/**
+ * @brief Returns the aggregations of the aggregation mix `name`
+ *
+ * The "sum" and "basic" mixes are computed by the hash groupby, the "median" and "nunique" mixes
+ * require the sort groupby.
+ */
+std::vector<std::unique_ptr<cudf::groupby_aggregation>> make_aggregations(std::string const& name)
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  if (name == "basic") {
+    aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  } else if (name == "median") {
+    aggs.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+  } else if (name == "nunique") {
+    aggs.push_back(cudf::make_nunique_aggregation<cudf::groupby_aggregation>());
+  } else {
+    CUDF_EXPECTS(name == "sum", "Unknown aggregation mix " + name);
+  }
+  return aggs;
+}
+
+}  // namespace
+
+void bench_groupby_mixed(nvbench::state& state)
+{
+  auto const num_rows        = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const cardinality     = state.get_int64("cardinality");
+  auto const skew            = state.get_float64("skew");
+  auto const num_key_columns = static_cast<cudf::size_type>(state.get_int64("num_key_columns"));
+  auto const string_keys     = state.get_string("key_type") == "string";
+  auto const aggregations    = state.get_string("aggregations");
+
+  auto const key_columns =
+    make_key_columns(make_skewed_keys(num_rows, cardinality, skew), num_key_columns, string_keys);
+  std::vector<cudf::column_view> key_views;
+  for (auto const& column : key_columns) {
+    key_views.push_back(column->view());
+  }
+
+  data_profile const profile = data_profile_builder().cardinality(0).no_validity().distribution(
+    cudf::type_to_id<int64_t>(), distribution_id::UNIFORM, 0, 1000);
+  auto const vals = create_random_column(cudf::type_to_id<int64_t>(), row_count{num_rows}, profile);
+
+  auto gb_obj = cudf::groupby::groupby(cudf::table_view{key_views});
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::groupby::aggregation_request());
+  requests[0].values       = vals->view();
+  requests[0].aggregations = make_aggregations(aggregations);
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) { auto const result = gb_obj.aggregate(requests); });
+  auto const elapsed_time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(num_rows) / elapsed_time / 1'000'000., "Mrows/s");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
+NVBENCH_BENCH(bench_groupby_mixed)
+  .set_name("groupby_mixed")
+  .add_int64_power_of_two_axis("num_rows", {20, 24})
+  .add_int64_axis("cardinality", {10, 1'000, 100'000, 10'000'000, 1'000'000'000})
+  .add_float64_axis("skew", {0, 0.5, 1, 1.5})
+  .add_int64_axis("num_key_columns", {1, 3})
+  .add_string_axis("key_type", {"int64", "string"})
+  .add_string_axis("aggregations", {"sum", "basic", "median", "nunique"});
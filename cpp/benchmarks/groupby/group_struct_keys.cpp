@@ -27,17 +27,19 @@
 
 #include <random>
 
-void bench_groupby_struct_keys(nvbench::state& state)
+namespace {
+
+/**
+ * @brief Creates a table of one struct key column of the given depth over an int column
+ */
+cudf::table make_struct_keys(cudf::size_type n_rows, cudf::size_type depth, bool nulls)
 {
   using Type           = int;
   using column_wrapper = cudf::test::fixed_width_column_wrapper<Type>;
   std::default_random_engine generator;
   std::uniform_int_distribution<int> distribution(0, 100);
 
-  cudf::size_type const n_rows{static_cast<cudf::size_type>(state.get_int64("NumRows"))};
   cudf::size_type const n_cols{1};
-  cudf::size_type const depth{static_cast<cudf::size_type>(state.get_int64("Depth"))};
-  bool const nulls{static_cast<bool>(state.get_int64("Nulls"))};
 
   // Create columns with values in the range [0,100)
   std::vector<column_wrapper> columns;
@@ -67,10 +69,21 @@ void bench_groupby_struct_keys(nvbench::state& state)
     child_cols = std::vector<std::unique_ptr<cudf::column>>{};
     child_cols.push_back(struct_col.release());
   }
+  return cudf::table(std::move(child_cols));
+}
+
+}  // namespace
+
+void bench_groupby_struct_keys(nvbench::state& state)
+{
+  cudf::size_type const n_rows{static_cast<cudf::size_type>(state.get_int64("NumRows"))};
+  cudf::size_type const depth{static_cast<cudf::size_type>(state.get_int64("Depth"))};
+  bool const nulls{static_cast<bool>(state.get_int64("Nulls"))};
+
   data_profile const profile = data_profile_builder().cardinality(0).no_validity().distribution(
     cudf::type_to_id<int64_t>(), distribution_id::UNIFORM, 0, 100);
 
-  auto const keys_table = cudf::table(std::move(child_cols));
+  auto const keys_table = make_struct_keys(n_rows, depth, nulls);
   auto const vals = create_random_column(cudf::type_to_id<int64_t>(), row_count{n_rows}, profile);
 
   cudf::groupby::groupby gb_obj(keys_table.view());
@@ -92,8 +105,46 @@ void bench_groupby_struct_keys(nvbench::state& state)
     mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
 }
 
+void bench_groupby_struct_keys_scan(nvbench::state& state)
+{
+  cudf::size_type const n_rows{static_cast<cudf::size_type>(state.get_int64("NumRows"))};
+  cudf::size_type const depth{static_cast<cudf::size_type>(state.get_int64("Depth"))};
+  bool const nulls{static_cast<bool>(state.get_int64("Nulls"))};
+
+  data_profile const profile = data_profile_builder().cardinality(0).no_validity().distribution(
+    cudf::type_to_id<int64_t>(), distribution_id::UNIFORM, 0, 100);
+
+  auto const keys_table = make_struct_keys(n_rows, depth, nulls);
+  auto const vals = create_random_column(cudf::type_to_id<int64_t>(), row_count{n_rows}, profile);
+
+  // Scans are computed by sorting the keys
+  std::vector<cudf::groupby::scan_request> requests;
+  requests.emplace_back(cudf::groupby::scan_request());
+  requests[0].values = vals->view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_scan_aggregation>());
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  auto stream                 = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    // A new groupby object per run so that the sorted keys are not reused
+    cudf::groupby::groupby gb_obj(keys_table.view());
+    auto const result = gb_obj.scan(requests);
+  });
+
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
 NVBENCH_BENCH(bench_groupby_struct_keys)
   .set_name("groupby_struct_keys")
   .add_int64_power_of_two_axis("NumRows", {10, 16, 20})
   .add_int64_axis("Depth", {0, 1, 8})
   .add_int64_axis("Nulls", {0, 1});
+
+NVBENCH_BENCH(bench_groupby_struct_keys_scan)
+  .set_name("groupby_struct_keys_scan")
+  .add_int64_power_of_two_axis("NumRows", {10, 16, 20})
+  .add_int64_axis("Depth", {0, 1, 8})
+  .add_int64_axis("Nulls", {0, 1});
@@ -97,6 +97,25 @@ static void bench_hash(nvbench::state& state)
 
     state.exec(nvbench::exec_tag::sync,
                [&](nvbench::launch& launch) { auto result = cudf::hashing::sha512(data->view()); });
+  } else if (hash_name == "xxhash_64") {
+    state.add_global_memory_writes<nvbench::uint64_t>(num_rows);
+
+    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+      auto result = cudf::hashing::xxhash_64(data->view());
+    });
+  } else if (hash_name == "xxhash3_64") {
+    state.add_global_memory_writes<nvbench::uint64_t>(num_rows);
+
+    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+      auto result = cudf::hashing::xxhash3_64(data->view());
+    });
+  } else if (hash_name == "xxhash3_128") {
+    // xxhash3_128 creates two uint64 columns
+    state.add_global_memory_writes<nvbench::uint64_t>(2 * num_rows);
+
+    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+      auto result = cudf::hashing::xxhash3_128(data->view());
+    });
   } else {
     state.skip(hash_name + ": unknown hash name");
   }
@@ -107,4 +126,13 @@ NVBENCH_BENCH(bench_hash)
   .add_int64_axis("num_rows", {65536, 16777216})
   .add_float64_axis("nulls", {0.0, 0.1})
   .add_string_axis("hash_name",
-                   {"murmurhash3_x86_32", "md5", "sha1", "sha224", "sha256", "sha384", "sha512"});
+                   {"murmurhash3_x86_32",
+                    "md5",
+                    "sha1",
+                    "sha224",
+                    "sha256",
+                    "sha384",
+                    "sha512",
+                    "xxhash_64",
+                    "xxhash3_64",
+                    "xxhash3_128"});
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+#include "io/comp/size_buckets.hpp"
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace {
+
+namespace nvcomp = cudf::io::nvcomp;
+
+// Size of the uncompressed data; large enough to saturate the GPU with the largest chunks
+constexpr size_t data_size = 256 << 20;
+
+nvcomp::compression_type retrieve_codec(std::string const& name)
+{
+  if (name == "SNAPPY") { return nvcomp::compression_type::SNAPPY; }
+  if (name == "ZSTD") { return nvcomp::compression_type::ZSTD; }
+  if (name == "LZ4") { return nvcomp::compression_type::LZ4; }
+  CUDF_FAIL("Unsupported codec: " + name);
+}
+
+/**
+ * @brief Returns the uncompressed chunk sizes of a named chunk size distribution
+ *
+ * "small" and "large" use chunks of a single size; "mixed" contains many small chunks, with most
+ * of the data in a few large chunks, in random order.
+ */
+std::vector<size_t> make_chunk_sizes(std::string const& distribution)
+{
+  std::vector<size_t> sizes;
+  auto const append_chunks = [&](size_t chunk_size, size_t total_size) {
+    sizes.insert(sizes.end(), total_size / chunk_size, chunk_size);
+  };
+  if (distribution == "small") {
+    append_chunks(16 << 10, data_size);
+  } else if (distribution == "large") {
+    append_chunks(4 << 20, data_size);
+  } else if (distribution == "mixed") {
+    append_chunks(16 << 10, data_size / 4);
+    append_chunks(256 << 10, data_size / 4);
+    append_chunks(8 << 20, data_size / 2);
+    std::shuffle(sizes.begin(), sizes.end(), std::mt19937{1});
+  } else {
+    CUDF_FAIL("Unsupported chunk size distribution: " + distribution);
+  }
+  return sizes;
+}
+
+// A range of chunks that are decompressed in a single call
+struct decompression_batch {
+  size_t start;
+  size_t num_chunks;
+  size_t max_uncomp_size;
+  size_t total_uncomp_size;
+};
+
+void BM_decompression(nvbench::state& state)
+{
+  auto const codec        = retrieve_codec(state.get_string("codec"));
+  auto const distribution = state.get_string("chunk_sizes");
+  auto const bucketed     = state.get_int64("bucketed") != 0;
+  auto const cardinality  = static_cast<cudf::size_type>(state.get_int64("cardinality"));
+
+  if (auto const reason = nvcomp::is_compression_disabled(codec)) {
+    state.skip(reason.value());
+    return;
+  }
+  if (auto const reason = nvcomp::is_decompression_disabled(codec)) {
+    state.skip(reason.value());
+    return;
+  }
+
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = rmm::mr::get_current_device_resource();
+
+  auto const chunk_sizes = make_chunk_sizes(distribution);
+  auto const total_size  = std::accumulate(chunk_sizes.begin(), chunk_sizes.end(), size_t{0});
+  auto const buckets     = cudf::io::bucket_chunks_by_size(chunk_sizes);
+
+  // Chunks are laid out in decompression order: grouped by size bucket if bucketed
+  std::vector<size_t> chunk_order(chunk_sizes.size());
+  std::iota(chunk_order.begin(), chunk_order.end(), 0);
+  if (bucketed) { chunk_order = buckets.chunks; }
+
+  auto const data = create_random_column(
+    cudf::type_id::INT32,
+    row_count{static_cast<cudf::size_type>(total_size / sizeof(int32_t))},
+    data_profile_builder().cardinality(cardinality).no_validity());
+  auto const uncomp_data = data->view().data<uint8_t>();
+
+  std::vector<cudf::device_span<uint8_t const>> h_uncomp_in;
+  std::vector<size_t> comp_offsets{0};
+  size_t uncomp_offset = 0;
+  for (auto const chunk : chunk_order) {
+    auto const size = chunk_sizes[chunk];
+    h_uncomp_in.emplace_back(uncomp_data + uncomp_offset, size);
+    uncomp_offset += size;
+    comp_offsets.push_back(comp_offsets.back() +
+                           nvcomp::compress_max_output_chunk_size(codec, size));
+  }
+  rmm::device_buffer comp_data(comp_offsets.back(), stream);
+  std::vector<cudf::device_span<uint8_t>> h_comp_out;
+  for (size_t i = 0; i < chunk_order.size(); ++i) {
+    h_comp_out.emplace_back(static_cast<uint8_t*>(comp_data.data()) + comp_offsets[i],
+                            comp_offsets[i + 1] - comp_offsets[i]);
+  }
+
+  auto const num_chunks = chunk_order.size();
+  rmm::device_uvector<cudf::io::compression_result> results(num_chunks, stream);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    results.data(), 0, results.size() * sizeof(cudf::io::compression_result), stream.value()));
+  {
+    auto const d_uncomp_in = cudf::detail::make_device_uvector_async(h_uncomp_in, stream, mr);
+    auto const d_comp_out  = cudf::detail::make_device_uvector_async(h_comp_out, stream, mr);
+    nvcomp::batched_compress(codec, d_uncomp_in, d_comp_out, results, stream);
+  }
+  auto const comp_results = cudf::detail::make_std_vector_sync(results, stream);
+  CUDF_EXPECTS(std::all_of(comp_results.begin(),
+                           comp_results.end(),
+                           [](auto const& res) {
+                             return res.status == cudf::io::compression_status::SUCCESS;
+                           }),
+               "Compression failed");
+
+  rmm::device_buffer decomp_data(total_size, stream);
+  std::vector<cudf::device_span<uint8_t const>> h_comp_in;
+  std::vector<cudf::device_span<uint8_t>> h_decomp_out;
+  size_t decomp_offset = 0;
+  size_t comp_size     = 0;
+  for (size_t i = 0; i < num_chunks; ++i) {
+    h_comp_in.emplace_back(h_comp_out[i].data(), comp_results[i].bytes_written);
+    comp_size += comp_results[i].bytes_written;
+    h_decomp_out.emplace_back(static_cast<uint8_t*>(decomp_data.data()) + decomp_offset,
+                              h_uncomp_in[i].size());
+    decomp_offset += h_uncomp_in[i].size();
+  }
+  auto const d_comp_in    = cudf::detail::make_device_uvector_async(h_comp_in, stream, mr);
+  auto const d_decomp_out = cudf::detail::make_device_uvector_async(h_decomp_out, stream, mr);
+
+  std::vector<decompression_batch> batches;
+  if (bucketed) {
+    for (size_t b = 0; b < cudf::io::num_chunk_size_buckets; ++b) {
+      auto const size = buckets.size(static_cast<cudf::io::chunk_size_bucket>(b));
+      if (size == 0) { continue; }
+      batches.push_back(
+        {buckets.offsets[b], size, buckets.max_uncomp_size[b], buckets.total_uncomp_size[b]});
+    }
+  } else {
+    batches.push_back(
+      {0, num_chunks, *std::max_element(chunk_sizes.begin(), chunk_sizes.end()), total_size});
+  }
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    for (auto const& batch : batches) {
+      nvcomp::batched_decompress(
+        codec,
+        cudf::device_span<cudf::device_span<uint8_t const> const>{d_comp_in}.subspan(
+          batch.start, batch.num_chunks),
+        cudf::device_span<cudf::device_span<uint8_t> const>{d_decomp_out}.subspan(
+          batch.start, batch.num_chunks),
+        cudf::device_span<cudf::io::compression_result>{results}.subspan(batch.start,
+                                                                         batch.num_chunks),
+        batch.max_uncomp_size,
+        batch.total_uncomp_size,
+        stream);
+    }
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(total_size) / time, "bytes_per_second");
+  state.add_element_count(static_cast<double>(total_size) / comp_size, "compression_ratio");
+  state.add_element_count(buckets.size(cudf::io::chunk_size_bucket::SMALL), "small_chunks");
+  state.add_element_count(buckets.size(cudf::io::chunk_size_bucket::MEDIUM), "medium_chunks");
+  state.add_element_count(buckets.size(cudf::io::chunk_size_bucket::LARGE), "large_chunks");
+}
+
+}  // namespace
+
+NVBENCH_BENCH(BM_decompression)
+  .set_name("decompression")
+  .add_string_axis("codec", {"SNAPPY", "ZSTD", "LZ4"})
+  .add_string_axis("chunk_sizes", {"small", "large", "mixed"})
+  .add_int64_axis("bucketed", {0, 1})
+  .add_int64_axis("cardinality", {0, 1000});
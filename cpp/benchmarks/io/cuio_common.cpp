@@ -25,6 +25,7 @@
 #include <fstream>
 #include <numeric>
 #include <string>
+#include <thread>
 
 temp_directory const cuio_source_sink_pair::tmpdir{"cudf_gbench"};
 
@@ -77,6 +78,21 @@ cudf::io::sink_info cuio_source_sink_pair::make_sink_info()
   }
 }
 
+std::unique_ptr<cudf::io::datasource> cuio_source_sink_pair::make_datasource()
+{
+  switch (type) {
+    case io_type::FILEPATH: return cudf::io::datasource::create(file_name);
+    case io_type::HOST_BUFFER:
+      return cudf::io::datasource::create(cudf::host_span<std::byte const>{
+        reinterpret_cast<std::byte const*>(h_buffer.data()), h_buffer.size()});
+    case io_type::DEVICE_BUFFER: {
+      auto const info = make_source_info();
+      return cudf::io::datasource::create(info.device_buffers().front());
+    }
+    default: CUDF_FAIL("invalid input type");
+  }
+}
+
 size_t cuio_source_sink_pair::size()
 {
   switch (type) {
@@ -90,6 +106,37 @@ size_t cuio_source_sink_pair::size()
   }
 }
 
+throttled_datasource::throttled_datasource(std::unique_ptr<cudf::io::datasource> source,
+                                           std::chrono::microseconds latency,
+                                           size_t bytes_per_second)
+  : _source{std::move(source)}, _latency{latency}, _bytes_per_second{bytes_per_second}
+{
+}
+
+void throttled_datasource::throttle(size_t size)
+{
+  ++_num_requests;
+  _bytes_requested += size;
+  auto delay = _latency;
+  if (_bytes_per_second != 0) {
+    delay += std::chrono::microseconds{static_cast<int64_t>(size * 1'000'000. / _bytes_per_second)};
+  }
+  if (delay.count() > 0) { std::this_thread::sleep_for(delay); }
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> throttled_datasource::host_read(size_t offset,
+                                                                             size_t size)
+{
+  throttle(size);
+  return _source->host_read(offset, size);
+}
+
+size_t throttled_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  throttle(size);
+  return _source->host_read(offset, size, dst);
+}
+
 std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id> const& data_types,
                                                        column_selection col_sel)
 {
@@ -24,6 +24,9 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <atomic>
+#include <chrono>
+
 using cudf::io::io_type;
 
 std::string random_file_in_dir(std::string const& dir_path);
@@ -65,6 +68,13 @@ class cuio_source_sink_pair {
    */
   cudf::io::sink_info make_sink_info();
 
+  /**
+   * @brief Creates a datasource reading from the location written by the sink of this pair
+   *
+   * @return The data source
+   */
+  std::unique_ptr<cudf::io::datasource> make_datasource();
+
   [[nodiscard]] size_t size();
 
  private:
@@ -77,6 +87,62 @@ class cuio_source_sink_pair {
   std::unique_ptr<cudf::io::data_sink> void_sink;
 };
 
+/**
+ * @brief Datasource that delays each read request to model a remote source.
+ *
+ * Each request to the wrapped source first waits for `latency`, plus the time taken to transfer
+ * the requested bytes at `bytes_per_second`. Device reads are not supported, so every read goes
+ * through the host like with most remote sources, and a reader issuing fewer, larger requests
+ * (e.g. through `host_read_ranges`) pays the latency fewer times.
+ */
+class throttled_datasource : public cudf::io::datasource {
+ public:
+  /**
+   * @brief Wraps `source` in a throttled source
+   *
+   * @param source The source to read from
+   * @param latency Delay of each read request
+   * @param bytes_per_second Transfer rate of each read request; zero for no limit
+   */
+  throttled_datasource(std::unique_ptr<cudf::io::datasource> source,
+                       std::chrono::microseconds latency,
+                       size_t bytes_per_second);
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+  /**
+   * @brief Returns the number of read requests made since the last `reset_counters` call
+   */
+  [[nodiscard]] size_t num_requests() const { return _num_requests; }
+
+  /**
+   * @brief Returns the number of bytes requested since the last `reset_counters` call
+   */
+  [[nodiscard]] size_t bytes_requested() const { return _bytes_requested; }
+
+  /**
+   * @brief Resets the request and byte counters
+   */
+  void reset_counters()
+  {
+    _num_requests    = 0;
+    _bytes_requested = 0;
+  }
+
+ private:
+  void throttle(size_t size);
+
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::chrono::microseconds _latency;
+  size_t _bytes_per_second;
+  std::atomic<size_t> _num_requests{0};
+  std::atomic<size_t> _bytes_requested{0};
+};
+
 /**
  * @brief Column selection strategy.
  */
@@ -85,6 +85,7 @@ void BM_FST_JSON(nvbench::state& state)
   auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
 
   state.add_element_count(d_input.size());
+  state.add_global_memory_reads<nvbench::int8_t>(d_input.size());
 
   // Prepare input & output buffers
   cudf::detail::hostdevice_vector<SymbolT> output_gpu(d_input.size(), stream_view);
@@ -124,6 +125,7 @@ void BM_FST_JSON_no_outidx(nvbench::state& state)
   auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
 
   state.add_element_count(d_input.size());
+  state.add_global_memory_reads<nvbench::int8_t>(d_input.size());
 
   // Prepare input & output buffers
   cudf::detail::hostdevice_vector<SymbolT> output_gpu(d_input.size(), stream_view);
@@ -163,6 +165,7 @@ void BM_FST_JSON_no_out(nvbench::state& state)
   auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
 
   state.add_element_count(d_input.size());
+  state.add_global_memory_reads<nvbench::int8_t>(d_input.size());
 
   // Prepare input & output buffers
   cudf::detail::hostdevice_vector<SymbolOffsetT> output_gpu_size(single_item, stream_view);
@@ -200,6 +203,7 @@ void BM_FST_JSON_no_str(nvbench::state& state)
   auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
 
   state.add_element_count(d_input.size());
+  state.add_global_memory_reads<nvbench::int8_t>(d_input.size());
 
   // Prepare input & output buffers
   cudf::detail::hostdevice_vector<SymbolOffsetT> output_gpu_size(single_item, stream_view);
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+#include <benchmarks/io/nvbench_helpers.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+// Benchmarks of the parquet reader on sources modeled after remote storage: every read request
+// is delayed by the `latency_us` and `bandwidth_mbps` axes through a `throttled_datasource`.
+// They measure how the number and size of the read requests affects reads of a file, of many
+// small files, and of the few row groups selected by a filter.
+
+constexpr size_t data_size         = 128 << 20;
+constexpr cudf::size_type num_cols = 16;
+
+namespace {
+
+std::vector<std::unique_ptr<throttled_datasource>> make_throttled_sources(
+  std::vector<cuio_source_sink_pair>& source_sinks, nvbench::state const& state)
+{
+  auto const latency   = std::chrono::microseconds{state.get_int64("latency_us")};
+  auto const bandwidth = static_cast<size_t>(state.get_int64("bandwidth_mbps")) << 20;
+
+  std::vector<std::unique_ptr<throttled_datasource>> sources;
+  for (auto& source_sink : source_sinks) {
+    sources.push_back(
+      std::make_unique<throttled_datasource>(source_sink.make_datasource(), latency, bandwidth));
+  }
+  return sources;
+}
+
+cudf::io::source_info make_source_info(
+  std::vector<std::unique_ptr<throttled_datasource>> const& sources)
+{
+  std::vector<cudf::io::datasource*> ptrs;
+  for (auto const& source : sources) {
+    ptrs.push_back(source.get());
+  }
+  return cudf::io::source_info{ptrs};
+}
+
+/**
+ * @brief Adds the number of read requests and requested bytes per read to the summaries
+ */
+void add_request_counts(nvbench::state& state,
+                        std::vector<std::unique_ptr<throttled_datasource>> const& sources,
+                        size_t num_reads)
+{
+  auto const requests = std::accumulate(
+    sources.begin(), sources.end(), size_t{0}, [](auto sum, auto const& source) {
+      return sum + source->num_requests();
+    });
+  auto const bytes = std::accumulate(
+    sources.begin(), sources.end(), size_t{0}, [](auto sum, auto const& source) {
+      return sum + source->bytes_requested();
+    });
+  state.add_element_count(static_cast<double>(requests) / num_reads, "read_requests");
+  state.add_buffer_size(bytes / num_reads, "requested_bytes", "requested_bytes");
+}
+
+void write_files(std::vector<cuio_source_sink_pair>& source_sinks,
+                 cudf::table_view const& view,
+                 cudf::size_type row_group_rows)
+{
+  auto const num_files     = static_cast<cudf::size_type>(source_sinks.size());
+  auto const rows_per_file = cudf::util::div_rounding_up_safe(view.num_rows(), num_files);
+  for (cudf::size_type i = 0; i < num_files; ++i) {
+    auto const begin = std::min(i * rows_per_file, view.num_rows());
+    auto const end   = std::min(begin + rows_per_file, view.num_rows());
+    auto const part  = cudf::slice(view, {begin, end}).front();
+    cudf::io::table_input_metadata metadata(part);
+    metadata.column_metadata[0].set_name("key");
+    auto const options =
+      cudf::io::parquet_writer_options::builder(source_sinks[i].make_sink_info(), part)
+        .metadata(std::move(metadata))
+        .row_group_size_rows(row_group_rows)
+        .build();
+    cudf::io::write_parquet(options);
+  }
+}
+
+/**
+ * @brief Creates a table whose first column holds increasing keys
+ *
+ * Row groups of a file written from this table hold disjoint key ranges, so a filter on the key
+ * selects row groups through their statistics.
+ */
+std::unique_ptr<cudf::table> create_keyed_table(std::vector<cudf::type_id> const& d_types)
+{
+  auto columns = create_random_table(cycle_dtypes(d_types, num_cols - 1),
+                                     table_size_bytes{data_size},
+                                     data_profile_builder().cardinality(0).avg_run_length(1))
+                   ->release();
+  auto const num_rows = columns.front()->size();
+  columns.insert(
+    columns.begin(),
+    cudf::sequence(num_rows, cudf::numeric_scalar<int64_t>(0), cudf::numeric_scalar<int64_t>(1)));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+template <data_type DataType>
+void BM_parquet_read_remote(nvbench::state& state, nvbench::type_list<nvbench::enum_type<DataType>>)
+{
+  auto const d_type   = get_type_or_group(static_cast<int32_t>(DataType));
+  bool const prefetch = state.get_int64("prefetch");
+  size_t const limit  = state.get_int64("input_limit_mb") << 20;
+  auto const tbl      = create_keyed_table(d_type);
+  std::vector<cuio_source_sink_pair> source_sinks;
+  source_sinks.emplace_back(io_type::HOST_BUFFER);
+  write_files(source_sinks, tbl->view(), 100'000);
+  auto const sources = make_throttled_sources(source_sinks, state);
+
+  auto const read_opts = cudf::io::parquet_reader_options::builder(make_source_info(sources))
+                           .prefetch_next_pass(prefetch)
+                           .build();
+
+  size_t num_reads      = 0;
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    ++num_reads;
+    auto reader = cudf::io::chunked_parquet_reader(0, limit, read_opts);
+    do {
+      auto const chunk = reader.read_chunk();
+    } while (reader.has_next());
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(source_sinks.front().size(), "encoded_file_size", "encoded_file_size");
+  add_request_counts(state, sources, num_reads);
+}
+
+template <data_type DataType>
+void BM_parquet_read_many_files(nvbench::state& state,
+                                nvbench::type_list<nvbench::enum_type<DataType>>)
+{
+  auto const d_type    = get_type_or_group(static_cast<int32_t>(DataType));
+  auto const num_files = static_cast<size_t>(state.get_int64("num_files"));
+  auto const tbl       = create_keyed_table(d_type);
+  std::vector<cuio_source_sink_pair> source_sinks;
+  for (size_t i = 0; i < num_files; ++i) {
+    source_sinks.emplace_back(io_type::HOST_BUFFER);
+  }
+  write_files(source_sinks, tbl->view(), 100'000);
+  auto const sources = make_throttled_sources(source_sinks, state);
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(make_source_info(sources)).build();
+
+  size_t num_reads      = 0;
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    ++num_reads;
+    cudf::io::read_parquet(read_opts);
+  });
+
+  auto const encoded_size = std::accumulate(
+    source_sinks.begin(), source_sinks.end(), size_t{0}, [](auto sum, auto& source_sink) {
+      return sum + source_sink.size();
+    });
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(encoded_size, "encoded_file_size", "encoded_file_size");
+  add_request_counts(state, sources, num_reads);
+}
+
+template <data_type DataType>
+void BM_parquet_read_selective_filter(nvbench::state& state,
+                                      nvbench::type_list<nvbench::enum_type<DataType>>)
+{
+  auto const d_type           = get_type_or_group(static_cast<int32_t>(DataType));
+  auto const selectivity      = state.get_int64("selectivity_percent");
+  bool const late_materialize = state.get_int64("late_materialization");
+  auto const tbl              = create_keyed_table(d_type);
+  std::vector<cuio_source_sink_pair> source_sinks;
+  source_sinks.emplace_back(io_type::HOST_BUFFER);
+  write_files(source_sinks, tbl->view(), 10'000);
+  auto const sources = make_throttled_sources(source_sinks, state);
+
+  // Selects the first `selectivity` percent of the rows
+  auto const max_key = cudf::numeric_scalar<int64_t>(tbl->num_rows() * selectivity / 100);
+  auto const key     = cudf::ast::column_name_reference("key");
+  auto const literal = cudf::ast::literal(max_key);
+  auto const filter  = cudf::ast::operation(cudf::ast::ast_operator::LESS, key, literal);
+
+  auto const read_opts = cudf::io::parquet_reader_options::builder(make_source_info(sources))
+                           .filter(filter)
+                           .late_materialization(late_materialize)
+                           .build();
+
+  size_t num_reads      = 0;
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    ++num_reads;
+    cudf::io::read_parquet(read_opts);
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(source_sinks.front().size(), "encoded_file_size", "encoded_file_size");
+  add_request_counts(state, sources, num_reads);
+}
+
+using d_type_list = nvbench::enum_type_list<data_type::INTEGRAL, data_type::STRING>;
+
+NVBENCH_BENCH_TYPES(BM_parquet_read_remote, NVBENCH_TYPE_AXES(d_type_list))
+  .set_name("parquet_read_remote")
+  .set_type_axes_names({"data_type"})
+  .set_min_samples(4)
+  .add_int64_axis("latency_us", {0, 1000, 10000})
+  .add_int64_axis("bandwidth_mbps", {0, 1000})
+  .add_int64_axis("input_limit_mb", {0, 32})
+  .add_int64_axis("prefetch", {0, 1});
+
+NVBENCH_BENCH_TYPES(BM_parquet_read_many_files, NVBENCH_TYPE_AXES(d_type_list))
+  .set_name("parquet_read_many_files")
+  .set_type_axes_names({"data_type"})
+  .set_min_samples(4)
+  .add_int64_axis("num_files", {1, 16, 256})
+  .add_int64_axis("latency_us", {0, 1000})
+  .add_int64_axis("bandwidth_mbps", {0});
+
+NVBENCH_BENCH_TYPES(BM_parquet_read_selective_filter, NVBENCH_TYPE_AXES(d_type_list))
+  .set_name("parquet_read_selective_filter")
+  .set_type_axes_names({"data_type"})
+  .set_min_samples(4)
+  .add_int64_axis("selectivity_percent", {1, 10, 100})
+  .add_int64_axis("late_materialization", {0, 1})
+  .add_int64_axis("latency_us", {0, 1000})
+  .add_int64_axis("bandwidth_mbps", {0, 1000});
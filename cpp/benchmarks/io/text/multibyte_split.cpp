@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,11 +22,14 @@
 #include <cudf_test/file_utilities.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/text/data_chunk_source_factories.hpp>
 #include <cudf/io/text/detail/bgzip_utils.hpp>
 #include <cudf/io/text/multibyte_split.hpp>
+#include <cudf/reshape.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/combine.hpp>
 #include <cudf/types.hpp>
@@ -40,6 +43,8 @@
 #include <fstream>
 #include <memory>
 #include <random>
+#include <string>
+#include <vector>
 
 temp_directory const temp_dir("cudf_nvbench");
 
@@ -63,10 +68,11 @@ NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
 static cudf::string_scalar create_random_input(int32_t num_chars,
                                                double delim_factor,
                                                double deviation,
-                                               std::string delim)
+                                               std::vector<std::string> const& delims)
 {
-  auto const num_delims      = static_cast<int32_t>((num_chars * delim_factor) / delim.size());
-  auto const num_delim_chars = num_delims * delim.size();
+  auto const delim_size      = delims.front().size();
+  auto const num_delims      = static_cast<int32_t>((num_chars * delim_factor) / delim_size);
+  auto const num_delim_chars = num_delims * delim_size;
   auto const num_value_chars = num_chars - num_delim_chars;
   auto const num_rows        = num_delims;
   auto const value_size_avg  = static_cast<int32_t>(num_value_chars / num_rows);
@@ -79,9 +85,20 @@ static cudf::string_scalar create_random_input(int32_t num_chars,
   auto const values =
     create_random_column(cudf::type_id::STRING, row_count{num_rows}, table_profile);
 
-  auto delim_scalar  = cudf::make_string_scalar(delim);
-  auto delims_column = cudf::make_column_from_scalar(*delim_scalar, num_rows);
-  auto input_table   = cudf::table_view({values->view(), delims_column->view()});
+  // rows end with each of the delimiters in turn
+  auto const num_rows_per_delim =
+    cudf::util::div_rounding_up_safe(num_rows, static_cast<int32_t>(delims.size()));
+  std::vector<std::unique_ptr<cudf::column>> delim_columns;
+  std::vector<cudf::column_view> delim_views;
+  for (auto const& delim : delims) {
+    delim_columns.push_back(
+      cudf::make_column_from_scalar(*cudf::make_string_scalar(delim), num_rows_per_delim));
+    delim_views.push_back(delim_columns.back()->view());
+  }
+  auto const interleaved_delims = cudf::interleave_columns(cudf::table_view{delim_views});
+
+  auto delims_column = cudf::slice(interleaved_delims->view(), {0, num_rows}).front();
+  auto input_table   = cudf::table_view({values->view(), delims_column});
   auto input_column  = cudf::strings::concatenate(input_table);
 
   // extract the chars from the returned strings column.
@@ -119,6 +136,7 @@ static void bench_multibyte_split(nvbench::state& state,
   auto const file_size_approx   = state.get_int64("size_approx");
   auto const byte_range_percent = state.get_int64("byte_range_percent");
   auto const strip_delimiters   = bool(state.get_int64("strip_delimiters"));
+  auto const num_delimiters     = state.get_int64("num_delimiters");
 
   auto const byte_range_factor = static_cast<double>(byte_range_percent) / 100;
   CUDF_EXPECTS(delim_percent >= 1, "delimiter percent must be at least 1");
@@ -129,10 +147,16 @@ static void bench_multibyte_split(nvbench::state& state,
   auto delim = std::string(delim_size, '0');
   // the algorithm can only support 7 equal characters, so use different chars in the delimiter
   std::iota(delim.begin(), delim.end(), '1');
+  // additional delimiters share all but the last character with the first one
+  std::vector<std::string> delims{delim};
+  for (int64_t i = 1; i < num_delimiters; i++) {
+    delims.push_back(delim);
+    delims.back().back() = static_cast<char>('a' + i);
+  }
 
   auto const delim_factor = static_cast<double>(delim_percent) / 100;
   std::unique_ptr<cudf::io::datasource> datasource;
-  auto device_input      = create_random_input(file_size_approx, delim_factor, 0.05, delim);
+  auto device_input      = create_random_input(file_size_approx, delim_factor, 0.05, delims);
   auto host_input        = std::vector<char>{};
   auto host_pinned_input = cudf::detail::pinned_host_vector<char>{};
 
@@ -190,7 +214,8 @@ static void bench_multibyte_split(nvbench::state& state,
   state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     try_drop_l3_cache();
-    output = cudf::io::text::multibyte_split(*source, delim, options);
+    output = num_delimiters == 1 ? cudf::io::text::multibyte_split(*source, delim, options)
+                                 : cudf::io::text::multibyte_split(*source, delims, options);
   });
 
   state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
@@ -211,6 +236,7 @@ NVBENCH_BENCH_TYPES(bench_multibyte_split,
   .set_min_samples(4)
   .add_int64_axis("strip_delimiters", {0, 1})
   .add_int64_axis("delim_size", {1, 4, 7})
+  .add_int64_axis("num_delimiters", {1, 3})
   .add_int64_axis("delim_percent", {1, 25})
   .add_int64_power_of_two_axis("size_approx", {15})
   .add_int64_axis("byte_range_percent", {50});
@@ -220,6 +246,7 @@ NVBENCH_BENCH_TYPES(bench_multibyte_split, NVBENCH_TYPE_AXES(source_type_list))
   .set_min_samples(4)
   .add_int64_axis("strip_delimiters", {1})
   .add_int64_axis("delim_size", {1})
+  .add_int64_axis("num_delimiters", {1})
   .add_int64_axis("delim_percent", {1})
   .add_int64_power_of_two_axis("size_approx", {15, 30})
   .add_int64_axis("byte_range_percent", {10, 100});
@@ -44,6 +44,7 @@ template <typename key_type, typename size_type>
 CUDF_KERNEL void init_build_tbl(key_type* const build_tbl,
                                 size_type const build_tbl_size,
                                 int const multiplicity,
+                                double const skew,
                                 curandState* state,
                                 int const num_states)
 {
@@ -58,6 +59,8 @@ CUDF_KERNEL void init_build_tbl(key_type* const build_tbl,
     double const x = curand_uniform_double(&localState);
 
     build_tbl[idx] = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+    // A fraction `skew` of the keys is the single heavy hitter key 0
+    if (skew > 0.0 and curand_uniform_double(&localState) < skew) { build_tbl[idx] = 0; }
   }
 
   state[start_idx] = localState;
@@ -70,6 +73,7 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
                                 key_type const rand_max,
                                 double const selectivity,
                                 int const multiplicity,
+                                double const skew,
                                 curandState* state,
                                 int const num_states)
 {
@@ -89,6 +93,8 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
       // we pick a key from [0, build_tbl_size / multiplicity]
       x   = curand_uniform_double(&localState);
       val = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+      // The keys present in the build table are skewed like the build table
+      if (skew > 0.0 and curand_uniform_double(&localState) < skew) { val = 0; }
     } else {
       // This key in the probe table should not be present in the build table, so we pick a key from
       // [build_tbl_size, rand_max].
@@ -124,6 +130,9 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
  * @param[in] selectivity           probability with which an element of the probe table is
  *                                  present in the build table.
  * @param[in] multiplicity          number of matches for each key.
+ * @param[in] skew                  fraction of the keys of the build table, and of the keys of the
+ *                                  probe table present in the build table, that are the single
+ *                                  key 0, e.g. 0.3 for a heavy hitter key with 30% of the rows.
  */
 template <typename key_type, typename size_type>
 void generate_input_tables(key_type* const build_tbl,
@@ -131,7 +140,8 @@ void generate_input_tables(key_type* const build_tbl,
                            key_type* const probe_tbl,
                            size_type const probe_tbl_size,
                            double const selectivity,
-                           int const multiplicity)
+                           int const multiplicity,
+                           double const skew = 0.0)
 {
   // With large values of rand_max the a lot of temporary storage is needed for the lottery. At the
   // expense of not being that accurate with applying the selectivity an especially more memory
@@ -165,7 +175,7 @@ void generate_input_tables(key_type* const build_tbl,
   CUDF_CHECK_CUDA(0);
 
   init_build_tbl<key_type, size_type><<<num_sms * num_blocks_init_build_tbl, block_size>>>(
-    build_tbl, build_tbl_size, multiplicity, devStates.data(), num_states);
+    build_tbl, build_tbl_size, multiplicity, skew, devStates.data(), num_states);
 
   CUDF_CHECK_CUDA(0);
 
@@ -178,6 +188,7 @@ void generate_input_tables(key_type* const build_tbl,
                                                           rand_max,
                                                           selectivity,
                                                           multiplicity,
+                                                          skew,
                                                           devStates.data(),
                                                           num_states);
 
@@ -74,6 +74,13 @@ NVBENCH_BENCH_TYPES(nvbench_inner_join, NVBENCH_TYPE_AXES(JOIN_KEY_TYPE_RANGE, J
   .add_int64_axis("left_size", JOIN_SIZE_RANGE)
   .add_int64_axis("right_size", JOIN_SIZE_RANGE);
 
+NVBENCH_BENCH_TYPES(nvbench_inner_join, NVBENCH_TYPE_AXES(JOIN_KEY_TYPE_RANGE, JOIN_NULLABLE_RANGE))
+  .set_name("inner_join_skewed")
+  .set_type_axes_names({"Key", "Nullable"})
+  .add_int64_axis("left_size", {100'000})
+  .add_int64_axis("right_size", {1000, 10'000})
+  .add_float64_axis("skew", {0.3});
+
 NVBENCH_BENCH_TYPES(nvbench_left_join, NVBENCH_TYPE_AXES(JOIN_KEY_TYPE_RANGE, JOIN_NULLABLE_RANGE))
   .set_name("left_join")
   .set_type_axes_names({"Key", "Nullable"})
@@ -93,6 +93,12 @@ void BM_join(state_type& state, Join JoinFunc)
 
   double const selectivity = 0.3;
   int const multiplicity   = 1;
+  auto const skew          = [&]() {
+    if constexpr (std::is_same_v<state_type, nvbench::state>) {
+      return state.get_float64_or_default("skew", 0.0);
+    }
+    return 0.0;
+  }();
 
   // Generate build and probe tables
   auto right_random_null_mask = [](int size) {
@@ -131,7 +137,8 @@ void BM_join(state_type& state, Join JoinFunc)
                                               left_key_column0->mutable_view().data<Key>(),
                                               left_size,
                                               selectivity,
-                                              multiplicity);
+                                              multiplicity,
+                                              skew);
 
   // Copy right_key_column0 and left_key_column0 into new columns.
   // If Nullable, the new columns will be assigned new nullmasks.
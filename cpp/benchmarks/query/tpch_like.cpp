@@ -0,0 +1,578 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/memory_tracking.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/*
+ * End-to-end benchmarks of queries modeled after TPC-H, built only from public libcudf APIs.
+ *
+ * Each query reads its tables from Parquet, then filters, joins, aggregates, sorts and writes its
+ * result, so that the synchronizations, allocations and launches between the operators are
+ * measured together. Besides the total time, the mean time, largest per-call peak memory and
+ * mean number of host synchronizations of each stage are reported.
+ *
+ * The tables are generated at the `scale_factor` of the benchmark and written to host buffers,
+ * unless the `CUDF_QUERY_BENCH_DATA_DIR` environment variable names a directory holding
+ * `lineitem.parquet`, `orders.parquet` and `customer.parquet` files with the TPC-H schema.
+ */
+
+namespace {
+
+/// Days since the epoch of the dates used by the queries
+constexpr int32_t date_1992_01_01 = 8035;
+constexpr int32_t date_1994_01_01 = 8766;
+constexpr int32_t date_1995_01_01 = 9131;
+constexpr int32_t date_1995_03_15 = 9204;
+constexpr int32_t date_1998_09_02 = 10471;
+constexpr int32_t date_1998_12_31 = 10591;
+
+/// Number of market segments of the generated customers
+constexpr int8_t num_market_segments = 5;
+
+/**
+ * @brief Parquet source of one of the tables read by the queries
+ */
+class parquet_table {
+ public:
+  /**
+   * @brief Uses `<dir>/<name>.parquet` if `dir` is set, or writes `generate()` to a host buffer
+   */
+  template <typename Generator>
+  parquet_table(std::optional<std::string> const& dir, std::string const& name, Generator generate)
+  {
+    if (dir.has_value()) {
+      _path = (std::filesystem::path{*dir} / (name + ".parquet")).string();
+      return;
+    }
+    auto const [table, names] = generate();
+    _buffer.emplace(io_type::HOST_BUFFER);
+    cudf::io::table_input_metadata metadata(table->view());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+      metadata.column_metadata[i].set_name(names[i]);
+    }
+    auto const options =
+      cudf::io::parquet_writer_options::builder(_buffer->make_sink_info(), table->view())
+        .metadata(std::move(metadata))
+        .build();
+    cudf::io::write_parquet(options);
+  }
+
+  /**
+   * @brief Reads the given columns of the table, in the given order
+   *
+   * Fixed-point columns are cast to FLOAT64 and timestamps to TIMESTAMP_DAYS so that real
+   * TPC-H files can be processed like the generated tables.
+   */
+  std::unique_ptr<cudf::table> read(std::vector<std::string> const& columns)
+  {
+    auto const source  = _path.has_value() ? cudf::io::source_info{*_path}
+                                           : _buffer->make_source_info();
+    auto const options = cudf::io::parquet_reader_options::builder(source).columns(columns).build();
+    auto result        = cudf::io::read_parquet(options).tbl->release();
+    for (auto& col : result) {
+      if (cudf::is_fixed_point(col->type())) {
+        col = cudf::cast(col->view(), cudf::data_type{cudf::type_id::FLOAT64});
+      } else if (cudf::is_timestamp(col->type()) &&
+                 col->type().id() != cudf::type_id::TIMESTAMP_DAYS) {
+        col = cudf::cast(col->view(), cudf::data_type{cudf::type_id::TIMESTAMP_DAYS});
+      }
+    }
+    return std::make_unique<cudf::table>(std::move(result));
+  }
+
+ private:
+  std::optional<std::string> _path;
+  std::optional<cuio_source_sink_pair> _buffer;
+};
+
+using generated_table = std::pair<std::unique_ptr<cudf::table>, std::vector<std::string>>;
+
+std::unique_ptr<cudf::column> make_keys(cudf::size_type num_rows)
+{
+  return cudf::sequence(
+    num_rows, cudf::numeric_scalar<int64_t>(1), cudf::numeric_scalar<int64_t>(1));
+}
+
+template <typename T>
+std::unique_ptr<cudf::column> make_uniform(cudf::size_type num_rows, T lower, T upper)
+{
+  auto const type    = cudf::type_to_id<T>();
+  auto const profile = data_profile{data_profile_builder().no_validity().distribution(
+    type, distribution_id::UNIFORM, lower, upper)};
+  return create_random_column(type, row_count{num_rows}, profile);
+}
+
+std::unique_ptr<cudf::column> make_dates(cudf::size_type num_rows, int32_t first, int32_t last)
+{
+  auto const type    = cudf::type_id::TIMESTAMP_DAYS;
+  auto const profile = data_profile{
+    data_profile_builder().no_validity().distribution(type, distribution_id::UNIFORM, first, last)};
+  return create_random_column(type, row_count{num_rows}, profile);
+}
+
+generated_table generate_lineitem(cudf::size_type num_rows, cudf::size_type num_orders)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_uniform<int64_t>(num_rows, 1, num_orders));
+  columns.push_back(make_uniform<double>(num_rows, 1., 50.));
+  columns.push_back(make_uniform<double>(num_rows, 900., 105'000.));
+  columns.push_back(make_uniform<double>(num_rows, 0., 0.1));
+  columns.push_back(make_uniform<double>(num_rows, 0., 0.08));
+  columns.push_back(make_uniform<int8_t>(num_rows, 0, 2));
+  columns.push_back(make_uniform<int8_t>(num_rows, 0, 1));
+  columns.push_back(make_dates(num_rows, date_1992_01_01, date_1998_12_31));
+  return {std::make_unique<cudf::table>(std::move(columns)),
+          {"l_orderkey",
+           "l_quantity",
+           "l_extendedprice",
+           "l_discount",
+           "l_tax",
+           "l_returnflag",
+           "l_linestatus",
+           "l_shipdate"}};
+}
+
+generated_table generate_orders(cudf::size_type num_rows, cudf::size_type num_customers)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_keys(num_rows));
+  columns.push_back(make_uniform<int64_t>(num_rows, 1, num_customers));
+  columns.push_back(make_dates(num_rows, date_1992_01_01, date_1998_12_31));
+  return {std::make_unique<cudf::table>(std::move(columns)),
+          {"o_orderkey", "o_custkey", "o_orderdate"}};
+}
+
+generated_table generate_customer(cudf::size_type num_rows)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_keys(num_rows));
+  columns.push_back(make_uniform<int8_t>(num_rows, 0, num_market_segments - 1));
+  return {std::make_unique<cudf::table>(std::move(columns)), {"c_custkey", "c_mktsegment"}};
+}
+
+/**
+ * @brief The tables read by the queries
+ */
+struct query_tables {
+  explicit query_tables(double scale_factor)
+  {
+    auto const dir         = std::getenv("CUDF_QUERY_BENCH_DATA_DIR");
+    auto const data_dir    = dir != nullptr ? std::optional<std::string>{dir} : std::nullopt;
+    auto const lineitems   = static_cast<cudf::size_type>(6'000'000 * scale_factor);
+    auto const orders_rows = static_cast<cudf::size_type>(1'500'000 * scale_factor);
+    auto const customers   = static_cast<cudf::size_type>(150'000 * scale_factor);
+
+    lineitem.emplace(
+      data_dir, "lineitem", [&] { return generate_lineitem(lineitems, orders_rows); });
+    orders.emplace(data_dir, "orders", [&] { return generate_orders(orders_rows, customers); });
+    customer.emplace(data_dir, "customer", [&] { return generate_customer(customers); });
+  }
+
+  std::optional<parquet_table> lineitem;
+  std::optional<parquet_table> orders;
+  std::optional<parquet_table> customer;
+};
+
+/**
+ * @brief Accumulates the time, peak memory and host synchronizations of each stage of a query
+ *
+ * The peak memory and synchronizations of a stage come from the memory usage records of its
+ * libcudf calls, so memory tracking must be enabled while the stages run.
+ */
+class stage_recorder {
+ public:
+  /**
+   * @brief Runs `fn` as the stage `name` and returns its result
+   */
+  template <typename Fn>
+  auto run(std::string const& name, Fn&& fn)
+  {
+    cudf::clear_memory_usage_records();
+    auto const start = std::chrono::steady_clock::now();
+    auto result      = fn();
+    cudf::get_default_stream().synchronize();
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    auto& stats = stage(name);
+    stats.seconds += std::chrono::duration<double>(elapsed).count();
+    ++stats.runs;
+    for (auto const& record : cudf::get_memory_usage_records()) {
+      stats.peak_bytes = std::max(stats.peak_bytes, record.peak_bytes);
+      stats.synchronizations += record.synchronization_count;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Adds the statistics of each stage to the summaries of `state`
+   */
+  void add_summaries(nvbench::state& state) const
+  {
+    for (auto const& stats : _stages) {
+      auto& time = state.add_summary("cudf/query/" + stats.name + "/time");
+      time.set_string("name", stats.name + " time");
+      time.set_string("hint", "duration");
+      time.set_string("description", "Mean wall time of the " + stats.name + " stage");
+      time.set_float64("value", stats.seconds / stats.runs);
+
+      auto& peak = state.add_summary("cudf/query/" + stats.name + "/peak_memory");
+      peak.set_string("name", stats.name + " peak");
+      peak.set_string("hint", "bytes");
+      peak.set_string("description",
+                      "Largest peak memory of a libcudf call of the " + stats.name + " stage");
+      peak.set_int64("value", static_cast<int64_t>(stats.peak_bytes));
+
+      auto& syncs = state.add_summary("cudf/query/" + stats.name + "/synchronizations");
+      syncs.set_string("name", stats.name + " syncs");
+      syncs.set_string("description",
+                       "Mean host synchronizations of the " + stats.name + " stage");
+      syncs.set_float64("value", static_cast<double>(stats.synchronizations) / stats.runs);
+    }
+  }
+
+ private:
+  struct stage_stats {
+    std::string name;
+    double seconds{0};
+    std::size_t runs{0};
+    std::size_t peak_bytes{0};
+    std::size_t synchronizations{0};
+  };
+
+  stage_stats& stage(std::string const& name)
+  {
+    auto const it = std::find_if(
+      _stages.begin(), _stages.end(), [&](auto const& stats) { return stats.name == name; });
+    if (it != _stages.end()) { return *it; }
+    _stages.push_back(stage_stats{name});
+    return _stages.back();
+  }
+
+  std::vector<stage_stats> _stages;  ///< in the order of their first run
+};
+
+cudf::timestamp_scalar<cudf::timestamp_D> date_scalar(int32_t days)
+{
+  return cudf::timestamp_scalar<cudf::timestamp_D>(cudf::duration_D{days}, true);
+}
+
+std::unique_ptr<cudf::column> compare(cudf::column_view const& lhs,
+                                      cudf::binary_operator op,
+                                      cudf::scalar const& rhs)
+{
+  return cudf::binary_operation(lhs, rhs, op, cudf::data_type{cudf::type_id::BOOL8});
+}
+
+std::unique_ptr<cudf::column> logical_and(cudf::column_view const& lhs,
+                                          cudf::column_view const& rhs)
+{
+  return cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::LOGICAL_AND, cudf::data_type{cudf::type_id::BOOL8});
+}
+
+/// Returns `price * (1 - discount)`
+std::unique_ptr<cudf::column> discounted_price(cudf::column_view const& price,
+                                               cudf::column_view const& discount)
+{
+  auto const f64      = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const one      = cudf::numeric_scalar<double>(1.);
+  auto const retained = cudf::binary_operation(one, discount, cudf::binary_operator::SUB, f64);
+  return cudf::binary_operation(price, retained->view(), cudf::binary_operator::MUL, f64);
+}
+
+/// Returns the scalar of the market segment selected by query 3
+std::unique_ptr<cudf::scalar> building_segment(cudf::data_type type)
+{
+  if (type.id() == cudf::type_id::STRING) {
+    return std::make_unique<cudf::string_scalar>("BUILDING");
+  }
+  return std::make_unique<cudf::numeric_scalar<int8_t>>(1);
+}
+
+std::unique_ptr<cudf::table> inner_join_tables(cudf::table_view const& left,
+                                               std::vector<cudf::size_type> const& left_on,
+                                               cudf::table_view const& right,
+                                               std::vector<cudf::size_type> const& right_on)
+{
+  auto const [left_map, right_map] = cudf::inner_join(left.select(left_on), right.select(right_on));
+  auto const left_rows =
+    cudf::gather(left, cudf::column_view{cudf::device_span<cudf::size_type const>{*left_map}});
+  auto const right_rows =
+    cudf::gather(right, cudf::column_view{cudf::device_span<cudf::size_type const>{*right_map}});
+  auto columns = left_rows->release();
+  for (auto& col : right_rows->release()) {
+    columns.push_back(std::move(col));
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+void write_result(cudf::table_view const& result)
+{
+  auto sink          = cuio_source_sink_pair(io_type::VOID);
+  auto const options = cudf::io::parquet_writer_options::builder(sink.make_sink_info(), result);
+  cudf::io::write_parquet(options.build());
+}
+
+/**
+ * @brief Pricing summary report (TPC-H query 1)
+ *
+ * Aggregates the line items shipped up to a date by return flag and line status.
+ */
+void run_q1(query_tables& tables, stage_recorder& recorder)
+{
+  auto const lineitem = recorder.run("read", [&] {
+    return tables.lineitem->read({"l_returnflag",
+                                  "l_linestatus",
+                                  "l_quantity",
+                                  "l_extendedprice",
+                                  "l_discount",
+                                  "l_tax",
+                                  "l_shipdate"});
+  });
+
+  auto const shipped = recorder.run("filter", [&] {
+    auto const cutoff = date_scalar(date_1998_09_02);
+    auto const mask =
+      compare(lineitem->get_column(6).view(), cudf::binary_operator::LESS_EQUAL, cutoff);
+    return cudf::apply_boolean_mask(lineitem->view(), mask->view());
+  });
+
+  auto const aggregated = recorder.run("groupby", [&] {
+    auto const f64        = cudf::data_type{cudf::type_id::FLOAT64};
+    auto const disc_price = discounted_price(shipped->get_column(3), shipped->get_column(4));
+    auto const taxed      = cudf::binary_operation(
+      cudf::numeric_scalar<double>(1.), shipped->get_column(5), cudf::binary_operator::ADD, f64);
+    auto const charge = cudf::binary_operation(
+      disc_price->view(), taxed->view(), cudf::binary_operator::MUL, f64);
+
+    auto const keys = cudf::table_view{{shipped->get_column(0), shipped->get_column(1)}};
+    std::vector<cudf::groupby::aggregation_request> requests(5);
+    requests[0].values = shipped->get_column(2);
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+    requests[1].values = shipped->get_column(3);
+    requests[1].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[1].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    requests[2].values = disc_price->view();
+    requests[2].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[3].values = charge->view();
+    requests[3].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[4].values = shipped->get_column(4);
+    requests[4].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+
+    auto [group_keys, results] = cudf::groupby::groupby(keys).aggregate(requests);
+    auto columns               = group_keys->release();
+    for (auto& result : results) {
+      for (auto& col : result.results) {
+        columns.push_back(std::move(col));
+      }
+    }
+    return std::make_unique<cudf::table>(std::move(columns));
+  });
+
+  auto const sorted = recorder.run("sort", [&] {
+    return cudf::sort_by_key(aggregated->view(), aggregated->view().select({0, 1}));
+  });
+
+  recorder.run("write", [&] {
+    write_result(sorted->view());
+    return 0;
+  });
+}
+
+/**
+ * @brief Shipping priority (TPC-H query 3)
+ *
+ * Finds the unshipped orders of a market segment with the largest revenue.
+ */
+void run_q3(query_tables& tables, stage_recorder& recorder)
+{
+  auto const inputs = recorder.run("read", [&] {
+    return std::tuple{
+      tables.customer->read({"c_custkey", "c_mktsegment"}),
+      tables.orders->read({"o_orderkey", "o_custkey", "o_orderdate"}),
+      tables.lineitem->read({"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"})};
+  });
+
+  auto const filtered = recorder.run("filter", [&] {
+    auto const& [customer, orders, lineitem] = inputs;
+    auto const date    = date_scalar(date_1995_03_15);
+    auto const segment = building_segment(customer->get_column(1).type());
+    auto const in_segment =
+      compare(customer->get_column(1), cudf::binary_operator::EQUAL, *segment);
+    auto const ordered_before =
+      compare(orders->get_column(2), cudf::binary_operator::LESS, date);
+    auto const shipped_after =
+      compare(lineitem->get_column(3), cudf::binary_operator::GREATER, date);
+    return std::tuple{cudf::apply_boolean_mask(customer->view(), in_segment->view()),
+                      cudf::apply_boolean_mask(orders->view(), ordered_before->view()),
+                      cudf::apply_boolean_mask(lineitem->view(), shipped_after->view())};
+  });
+
+  // joined columns: c_custkey, c_mktsegment, o_orderkey, o_custkey, o_orderdate, l_orderkey,
+  // l_extendedprice, l_discount, l_shipdate
+  auto const joined = recorder.run("join", [&] {
+    auto const& [segment_customers, open_orders, unshipped] = filtered;
+    auto const customer_orders =
+      inner_join_tables(segment_customers->view(), {0}, open_orders->view(), {1});
+    return inner_join_tables(customer_orders->view(), {2}, unshipped->view(), {0});
+  });
+
+  auto const aggregated = recorder.run("groupby", [&] {
+    auto const revenue = discounted_price(joined->get_column(6), joined->get_column(7));
+    auto const keys    = cudf::table_view{{joined->get_column(2), joined->get_column(4)}};
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = revenue->view();
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+
+    auto [group_keys, results] = cudf::groupby::groupby(keys).aggregate(requests);
+    auto columns               = group_keys->release();
+    columns.push_back(std::move(results[0].results[0]));
+    return std::make_unique<cudf::table>(std::move(columns));
+  });
+
+  auto const top = recorder.run("sort", [&] {
+    auto const sorted = cudf::sort_by_key(aggregated->view(),
+                                          aggregated->view().select({2, 1}),
+                                          {cudf::order::DESCENDING, cudf::order::ASCENDING});
+    auto const num_rows = std::min(sorted->num_rows(), cudf::size_type{10});
+    return std::make_unique<cudf::table>(cudf::slice(sorted->view(), {0, num_rows}).front());
+  });
+
+  recorder.run("write", [&] {
+    write_result(top->view());
+    return 0;
+  });
+}
+
+/**
+ * @brief Forecasting revenue change (TPC-H query 6)
+ *
+ * Sums the revenue of the discounted line items shipped in a year, filtering with a single
+ * AST expression.
+ */
+void run_q6(query_tables& tables, stage_recorder& recorder)
+{
+  auto const lineitem = recorder.run("read", [&] {
+    return tables.lineitem->read({"l_shipdate", "l_discount", "l_quantity", "l_extendedprice"});
+  });
+
+  auto const selected = recorder.run("filter", [&] {
+    auto const first_day    = date_scalar(date_1994_01_01);
+    auto const last_day     = date_scalar(date_1995_01_01);
+    auto const min_discount = cudf::numeric_scalar<double>(0.05);
+    auto const max_discount = cudf::numeric_scalar<double>(0.07);
+    auto const max_quantity = cudf::numeric_scalar<double>(24.);
+
+    using cudf::ast::ast_operator;
+    auto const shipdate = cudf::ast::column_reference(0);
+    auto const discount = cudf::ast::column_reference(1);
+    auto const quantity = cudf::ast::column_reference(2);
+    auto const lit_first = cudf::ast::literal(first_day);
+    auto const lit_last  = cudf::ast::literal(last_day);
+    auto const lit_min   = cudf::ast::literal(min_discount);
+    auto const lit_max   = cudf::ast::literal(max_discount);
+    auto const lit_qty   = cudf::ast::literal(max_quantity);
+
+    auto const after_first = cudf::ast::operation(ast_operator::GREATER_EQUAL, shipdate, lit_first);
+    auto const before_last = cudf::ast::operation(ast_operator::LESS, shipdate, lit_last);
+    auto const above_min   = cudf::ast::operation(ast_operator::GREATER_EQUAL, discount, lit_min);
+    auto const below_max   = cudf::ast::operation(ast_operator::LESS_EQUAL, discount, lit_max);
+    auto const few_items   = cudf::ast::operation(ast_operator::LESS, quantity, lit_qty);
+
+    using cudf::ast::operation;
+    auto const in_year    = operation(ast_operator::LOGICAL_AND, after_first, before_last);
+    auto const discounted = operation(ast_operator::LOGICAL_AND, above_min, below_max);
+    auto const in_range   = operation(ast_operator::LOGICAL_AND, in_year, discounted);
+    auto const predicate  = operation(ast_operator::LOGICAL_AND, in_range, few_items);
+
+    auto const mask = cudf::compute_column(lineitem->view(), predicate);
+    return cudf::apply_boolean_mask(lineitem->view(), mask->view());
+  });
+
+  recorder.run("aggregate", [&] {
+    auto const f64     = cudf::data_type{cudf::type_id::FLOAT64};
+    auto const revenue = cudf::binary_operation(
+      selected->get_column(3), selected->get_column(1), cudf::binary_operator::MUL, f64);
+    return cudf::reduce(
+      revenue->view(), *cudf::make_sum_aggregation<cudf::reduce_aggregation>(), f64);
+  });
+}
+
+using query_fn = void (*)(query_tables&, stage_recorder&);
+
+void bench_query(nvbench::state& state, query_fn query)
+{
+  auto const scale_factor = state.get_float64("scale_factor");
+  query_tables tables(scale_factor);
+
+  stage_recorder recorder;
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  cudf::enable_memory_tracking();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) { query(tables, recorder); });
+  cudf::disable_memory_tracking();
+
+  recorder.add_summaries(state);
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
+}  // namespace
+
+void tpch_q1(nvbench::state& state) { bench_query(state, run_q1); }
+void tpch_q3(nvbench::state& state) { bench_query(state, run_q3); }
+void tpch_q6(nvbench::state& state) { bench_query(state, run_q6); }
+
+NVBENCH_BENCH(tpch_q1).set_name("tpch_q1").add_float64_axis("scale_factor", {0.1, 1});
+NVBENCH_BENCH(tpch_q3).set_name("tpch_q3").add_float64_axis("scale_factor", {0.1, 1});
+NVBENCH_BENCH(tpch_q6).set_name("tpch_q6").add_float64_axis("scale_factor", {0.1, 1});
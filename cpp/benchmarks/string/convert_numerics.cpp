@@ -121,6 +121,7 @@ CONVERT_TO_NUMERICS_BD(strings_to_float32, float);
 CONVERT_TO_NUMERICS_BD(strings_to_float64, double);
 CONVERT_TO_NUMERICS_BD(strings_to_int32, int32_t);
 CONVERT_TO_NUMERICS_BD(strings_to_int64, int64_t);
+CONVERT_TO_NUMERICS_BD(strings_to_uint64, uint64_t);
 CONVERT_TO_NUMERICS_BD(strings_to_uint8, uint8_t);
 CONVERT_TO_NUMERICS_BD(strings_to_uint16, uint16_t);
 
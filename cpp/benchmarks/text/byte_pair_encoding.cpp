@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvtext/byte_pair_encoding.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+static void bench_byte_pair_encoding(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width = static_cast<cudf::size_type>(state.get_int64("row_width"));
+
+  if (static_cast<std::size_t>(num_rows) * static_cast<std::size_t>(row_width) >=
+      static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max())) {
+    state.skip("Skip benchmarks greater than size_type limit");
+  }
+
+  // partial table based on values from https://huggingface.co/gpt2/raw/main/merges.txt
+  auto mpt = cudf::test::strings_column_wrapper({"e n",
+                                                 "i t",
+                                                 "i s",
+                                                 "e s",
+                                                 "en t",
+                                                 "c e",
+                                                 "es t",
+                                                 "en ce",
+                                                 "t h",
+                                                 "h i",
+                                                 "th is",
+                                                 "t est",
+                                                 "s i",
+                                                 "s ent",
+                                                 "t he",
+                                                 "o n",
+                                                 "e r",
+                                                 "a n",
+                                                 "an d",
+                                                 "o r"});
+  auto merge_pairs = nvtext::load_merge_pairs(cudf::strings_column_view(mpt));
+
+  // natural text repeats words so the rows are built from a small set of phrases
+  auto phrases = cudf::test::strings_column_wrapper({"this is the test sentence ",
+                                                     "another sentence and the order ",
+                                                     "thisisit on the sentences ",
+                                                     "the tester is here and there "})
+                   .release();
+  auto const phrase_width = 32;
+  if (row_width / phrase_width > 1) {
+    std::vector<cudf::column_view> columns(row_width / phrase_width, phrases->view());
+    phrases = cudf::strings::concatenate(cudf::table_view(columns));
+  }
+
+  data_profile const map_profile = data_profile_builder().null_probability(0).distribution(
+    cudf::type_id::INT32, distribution_id::UNIFORM, 0, phrases->size() - 1);
+  auto map = create_random_column(cudf::type_id::INT32, row_count{num_rows}, map_profile);
+  map->set_null_mask(rmm::device_buffer{}, 0);
+  auto input_table = cudf::gather(cudf::table_view({phrases->view()}), map->view());
+  cudf::strings_column_view input(input_table->view().column(0));
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+
+  auto chars_size = input.chars_size(cudf::get_default_stream());
+  state.add_global_memory_reads<nvbench::int8_t>(chars_size);
+  state.add_global_memory_writes<nvbench::int8_t>(chars_size * 2);  // worst case
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = nvtext::byte_pair_encoding(input, *merge_pairs);
+  });
+}
+
+NVBENCH_BENCH(bench_byte_pair_encoding)
+  .set_name("byte_pair_encoding")
+  .add_int64_axis("num_rows", {4096, 32768, 262144})
+  .add_int64_axis("row_width", {32, 256, 2048});
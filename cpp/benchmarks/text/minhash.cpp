@@ -69,3 +69,41 @@ NVBENCH_BENCH(bench_minhash)
   .add_int64_axis("hash_width", {5, 10})
   .add_int64_axis("seed_count", {2, 26})
   .add_int64_axis("hash_type", {32, 64});
+
+static void bench_minhash_lsh(nvbench::state& state)
+{
+  auto const num_rows      = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width     = static_cast<cudf::size_type>(state.get_int64("row_width"));
+  auto const bands         = static_cast<cudf::size_type>(state.get_int64("bands"));
+  auto const rows_per_band = static_cast<cudf::size_type>(state.get_int64("rows_per_band"));
+
+  data_profile const strings_profile = data_profile_builder().distribution(
+    cudf::type_id::STRING, distribution_id::NORMAL, 0, row_width);
+  auto const strings_table =
+    create_random_table({cudf::type_id::STRING}, row_count{num_rows}, strings_profile);
+  cudf::strings_column_view input(strings_table->view().column(0));
+
+  data_profile const seeds_profile = data_profile_builder().null_probability(0).distribution(
+    cudf::type_id::UINT64, distribution_id::NORMAL, 0, row_width);
+  auto const seeds_table =
+    create_random_table({cudf::type_id::UINT64}, row_count{bands * rows_per_band}, seeds_profile);
+  auto seeds = seeds_table->get_column(0);
+  seeds.set_null_mask(rmm::device_buffer{}, 0);
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+
+  auto chars_size = input.chars_size(cudf::get_default_stream());
+  state.add_global_memory_reads<nvbench::int8_t>(chars_size);
+  state.add_global_memory_writes<nvbench::int64_t>(num_rows * bands);  // output are buckets
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = nvtext::minhash_lsh_buckets(input, seeds.view(), bands, rows_per_band);
+  });
+}
+
+NVBENCH_BENCH(bench_minhash_lsh)
+  .set_name("minhash_lsh")
+  .add_int64_axis("num_rows", {8192, 131072})
+  .add_int64_axis("row_width", {128, 512, 2048})
+  .add_int64_axis("bands", {20, 64})
+  .add_int64_axis("rows_per_band", {4, 8});
@@ -61,7 +61,7 @@ endif()
 
 jit_preprocess_files(
   SOURCE_DIRECTORY ${CUDF_SOURCE_DIR}/src FILES binaryop/jit/kernel.cu transform/jit/kernel.cu
-  rolling/jit/kernel.cu
+  transform/jit/compute_column_kernel.cu rolling/jit/kernel.cu
 )
 
 add_custom_target(
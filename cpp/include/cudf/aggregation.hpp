@@ -118,7 +118,9 @@ class aggregation {
     TDIGEST,         ///< create a tdigest from a set of input values
     MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
     HISTOGRAM,       ///< compute frequency of each element
-    MERGE_HISTOGRAM  ///< merge partial values of HISTOGRAM aggregation,
+    MERGE_HISTOGRAM,  ///< merge partial values of HISTOGRAM aggregation,
+    HLLPP,            ///< create a HyperLogLog++ sketch of the distinct values
+    MERGE_HLLPP       ///< merge HyperLogLog++ sketches into one sketch
   };
 
   aggregation() = delete;
@@ -730,5 +732,51 @@ std::unique_ptr<Base> make_tdigest_aggregation(int max_centroids = 1000);
 template <typename Base>
 std::unique_ptr<Base> make_merge_tdigest_aggregation(int max_centroids = 1000);
 
+/**
+ * @brief Factory to create a HLLPP aggregation
+ *
+ * Builds a HyperLogLog++ sketch of the distinct non-null values of each group (or of the whole
+ * column for a reduction), from which `cudf::estimate_distinct_count`
+ * estimates the number of distinct values. The sketch of a group is a list of `2^precision`
+ * INT8 registers:
+ *
+ * @code{.pseudo}
+ * list {
+ *   int8  // register 0: 1 + the number of leading zero bits of the hashes that select it
+ *   ...
+ *   int8  // register 2^precision - 1
+ * }
+ * @endcode
+ *
+ * Sketches are mergeable: a `MERGE_HLLPP` aggregation of the sketches of several partitions of
+ * the data produces the sketch of the whole data, so distinct counts can be computed per
+ * partition and combined without exchanging the values.
+ *
+ * The values are hashed with 64-bit xxhash. The relative standard error of the estimate is about
+ * `1.04 / sqrt(2^precision)`, i.e. 1.6% for the default precision of 12 (4KB per sketch).
+ *
+ * @throw std::invalid_argument if `precision` is not in the range [4, 18]
+ *
+ * @param precision The number of bits of the value hashes that select a register
+ * @return A HLLPP aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_hllpp_aggregation(int precision = 12);
+
+/**
+ * @brief Factory to create a MERGE_HLLPP aggregation
+ *
+ * Merges the sketches produced by `HLLPP` or `MERGE_HLLPP` aggregations, given as a lists column
+ * of INT8 registers, into the sketch of all their values: each register of the result is the
+ * maximum of that register over the merged sketches. Null sketches are ignored.
+ *
+ * @throw std::invalid_argument if `precision` is not in the range [4, 18]
+ *
+ * @param precision The precision the merged sketches were built with
+ * @return A MERGE_HLLPP aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_merge_hllpp_aggregation(int precision = 12);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -29,6 +29,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/find.h>
 #include <thrust/optional.h>
 
 namespace cudf {
@@ -220,6 +223,29 @@ struct single_dispatch_binary_operator {
   }
 };
 
+/**
+ * @brief Whether the set literal of an `ast_operator::IS_IN` operation contains a value.
+ *
+ * Sets of up to `max_unsorted_literal_set_size` elements are scanned. Larger sets have been sorted
+ * by the parser and are searched with a binary search.
+ *
+ * @tparam Element Type of the set elements.
+ * @param set The set literal.
+ * @param value The value to search for.
+ * @return `true` if the set contains the value
+ */
+template <typename Element>
+__device__ inline bool literal_set_contains(generic_scalar_device_view const& set,
+                                            Element const& value)
+{
+  auto const begin = static_cast<Element const*>(set.data());
+  auto const end   = begin + set.size();
+  if (set.size() <= max_unsorted_literal_set_size) {
+    return thrust::find(thrust::seq, begin, end, value) != end;
+  }
+  return thrust::binary_search(thrust::seq, begin, end, value);
+}
+
 /**
  * @brief The principal object for evaluating AST expressions on device.
  *
@@ -396,6 +422,17 @@ struct expression_evaluator {
     ast_operator const op,
     IntermediateDataType<has_nulls>* thread_intermediate_storage) const
   {
+    if (op == ast_operator::IS_IN) {
+      evaluate_set_membership<LHS>(output_object,
+                                   left_row_index,
+                                   right_row_index,
+                                   lhs,
+                                   rhs,
+                                   output,
+                                   output_row_index,
+                                   thread_intermediate_storage);
+      return;
+    }
     auto const typed_lhs =
       resolve_input<LHS>(lhs, thread_intermediate_storage, left_row_index, right_row_index);
     auto const typed_rhs =
@@ -492,6 +529,125 @@ struct expression_evaluator {
                         output_row_index,
                         op,
                         thread_intermediate_storage);
+      } else if (arity == 3) {
+        // Ternary operator. Both branches are evaluated before one of them is selected.
+        auto const& condition =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& lhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& rhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& output =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        type_dispatcher(lhs.data_type,
+                        ternary_dispatch{*this},
+                        output_object,
+                        left_row_index,
+                        right_row_index,
+                        condition,
+                        lhs,
+                        rhs,
+                        output,
+                        output_row_index,
+                        op,
+                        thread_intermediate_storage);
+      } else {
+        CUDF_UNREACHABLE("Invalid operator arity.");
+      }
+    }
+  }
+
+  /**
+   * @brief A set of rows of a single table evaluated together by one thread.
+   *
+   * Row `i` of the batch is `first + i * stride`. Keeping `stride` equal to the number of threads
+   * in the grid lets consecutive threads read consecutive rows at every step.
+   */
+  struct row_batch {
+    cudf::size_type first;   ///< Index of the first row of the batch
+    cudf::size_type stride;  ///< Distance between consecutive rows of the batch
+    cudf::size_type size;    ///< Number of rows in the batch
+  };
+
+  /**
+   * @brief Evaluate an expression applied to a batch of rows.
+   *
+   * Every operator is decoded and dispatched on its type and operator once per batch instead of
+   * once per row, and the operator is then applied to each row of the batch in turn. The
+   * intermediates of row `i` of the batch are stored at
+   * `thread_intermediate_storage + i * plan.num_intermediates`, so the thread must own storage for
+   * `rows.size` sets of intermediates.
+   *
+   * @param output_object The container that data will be inserted into.
+   * @param rows The rows to evaluate, used both as input and output rows.
+   * @param thread_intermediate_storage Intermediate storage for all rows of the batch.
+   */
+  template <typename ResultSubclass, typename T, bool result_has_nulls>
+  __device__ __forceinline__ void evaluate_rows(
+    expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+    row_batch const& rows,
+    IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+  {
+    cudf::size_type operator_source_index{0};
+    for (cudf::size_type operator_index = 0; operator_index < plan.operators.size();
+         ++operator_index) {
+      auto const op    = plan.operators[operator_index];
+      auto const arity = ast_operator_arity(op);
+      if (arity == 1) {
+        auto const& input =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& output =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        type_dispatcher(input.data_type,
+                        unary_row_batch_dispatch{*this},
+                        op,
+                        output_object,
+                        rows,
+                        input,
+                        output,
+                        thread_intermediate_storage);
+      } else if (arity == 2) {
+        auto const& lhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& rhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& output =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        type_dispatcher(lhs.data_type,
+                        detail::single_dispatch_binary_operator{},
+                        binary_row_batch_dispatch{*this},
+                        op,
+                        output_object,
+                        rows,
+                        lhs,
+                        rhs,
+                        output,
+                        thread_intermediate_storage);
+      } else if (arity == 3) {
+        // Ternary operators are rare enough to be dispatched once per row
+        auto const& condition =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& lhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& rhs =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        auto const& output =
+          plan.data_references[plan.operator_source_indices[operator_source_index++]];
+        for (cudf::size_type i = 0; i < rows.size; ++i) {
+          auto const row_index = rows.first + i * rows.stride;
+          type_dispatcher(lhs.data_type,
+                          ternary_dispatch{*this},
+                          output_object,
+                          row_index,
+                          row_index,
+                          condition,
+                          lhs,
+                          rhs,
+                          output,
+                          row_index,
+                          op,
+                          thread_intermediate_storage + i * plan.num_intermediates);
+        }
       } else {
         CUDF_UNREACHABLE("Invalid operator arity.");
       }
@@ -499,6 +655,51 @@ struct expression_evaluator {
   }
 
  private:
+  /**
+   * @brief Evaluate an `ast_operator::IS_IN` operation on a row.
+   *
+   * The right operand is a set literal, so it is searched instead of being resolved to a value.
+   *
+   * @tparam Element Type of the left operand and of the set elements.
+   *
+   * @param output_object The container that data will be inserted into.
+   * @param left_row_index The row to pull the data from the left table.
+   * @param right_row_index The row to pull the data from the right table.
+   * @param lhs Left input data reference.
+   * @param set Data reference of the set literal.
+   * @param output Output data reference.
+   * @param output_row_index The row in the output to insert the result.
+   */
+  template <typename Element, typename ResultSubclass, typename T, bool result_has_nulls>
+  __device__ inline void evaluate_set_membership(
+    expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+    cudf::size_type const left_row_index,
+    cudf::size_type const right_row_index,
+    detail::device_data_reference const& lhs,
+    detail::device_data_reference const& set,
+    detail::device_data_reference const& output,
+    cudf::size_type const output_row_index,
+    IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+  {
+    if constexpr (cudf::is_rep_layout_compatible<Element>()) {
+      auto const value =
+        resolve_input<Element>(lhs, thread_intermediate_storage, left_row_index, right_row_index);
+      auto const& values = plan.literals[set.data_index];
+      auto const result  = [&]() -> possibly_null_value_t<bool, has_nulls> {
+        if constexpr (has_nulls) {
+          if (!value.has_value() || !values.is_valid()) { return {}; }
+          return literal_set_contains(values, *value);
+        } else {
+          return literal_set_contains(values, value);
+        }
+      }();
+      expression_output_handler{}.template resolve_output<bool>(
+        output_object, output, output_row_index, thread_intermediate_storage, result);
+    } else {
+      CUDF_UNREACHABLE("Invalid set membership operand type.");
+    }
+  }
+
   /**
    * @brief Helper struct for type dispatch on the result of an expression.
    *
@@ -697,6 +898,289 @@ struct expression_evaluator {
     }
   };
 
+  /**
+   * @brief Subclass of the expression output handler for ternary operations.
+   *
+   * The first operand is a boolean condition and the other two operands have type `Element`.
+   */
+  template <typename Element>
+  struct ternary_expression_output_handler : public expression_output_handler {
+    __device__ inline ternary_expression_output_handler() {}
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<
+                detail::is_valid_ternary_op<detail::operator_functor<op, has_nulls>,
+                                            possibly_null_value_t<bool, has_nulls>,
+                                            possibly_null_value_t<Element, has_nulls>,
+                                            possibly_null_value_t<Element, has_nulls>>>* = nullptr>
+    __device__ inline void operator()(
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      cudf::size_type const output_row_index,
+      possibly_null_value_t<bool, has_nulls> const& condition,
+      possibly_null_value_t<Element, has_nulls> const& lhs,
+      possibly_null_value_t<Element, has_nulls> const& rhs,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      using Out =
+        cuda::std::invoke_result_t<detail::operator_functor<op, false>, bool, Element, Element>;
+      this->template resolve_output<Out>(
+        output_object,
+        output,
+        output_row_index,
+        thread_intermediate_storage,
+        detail::operator_functor<op, has_nulls>{}(condition, lhs, rhs));
+    }
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<
+                !detail::is_valid_ternary_op<detail::operator_functor<op, has_nulls>,
+                                             possibly_null_value_t<bool, has_nulls>,
+                                             possibly_null_value_t<Element, has_nulls>,
+                                             possibly_null_value_t<Element, has_nulls>>>* = nullptr>
+    __device__ inline void operator()(
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      cudf::size_type const output_row_index,
+      possibly_null_value_t<bool, has_nulls> const& condition,
+      possibly_null_value_t<Element, has_nulls> const& lhs,
+      possibly_null_value_t<Element, has_nulls> const& rhs,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      CUDF_UNREACHABLE("Invalid ternary dispatch operator for the provided input.");
+    }
+  };
+
+  /**
+   * @brief Type-dispatched entry point of a ternary operation on a row.
+   */
+  struct ternary_dispatch {
+    expression_evaluator const& evaluator;
+
+    template <typename Element, typename ResultSubclass, typename T, bool result_has_nulls>
+    __device__ inline void operator()(
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      cudf::size_type const left_row_index,
+      cudf::size_type const right_row_index,
+      detail::device_data_reference const& condition,
+      detail::device_data_reference const& lhs,
+      detail::device_data_reference const& rhs,
+      detail::device_data_reference const& output,
+      cudf::size_type const output_row_index,
+      ast_operator const op,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      auto const typed_condition = evaluator.template resolve_input<bool>(
+        condition, thread_intermediate_storage, left_row_index, right_row_index);
+      auto const typed_lhs = evaluator.template resolve_input<Element>(
+        lhs, thread_intermediate_storage, left_row_index, right_row_index);
+      auto const typed_rhs = evaluator.template resolve_input<Element>(
+        rhs, thread_intermediate_storage, left_row_index, right_row_index);
+      ast_operator_dispatcher(op,
+                              ternary_expression_output_handler<Element>{},
+                              output_object,
+                              output_row_index,
+                              typed_condition,
+                              typed_lhs,
+                              typed_rhs,
+                              output,
+                              thread_intermediate_storage);
+    }
+  };
+
+  /**
+   * @brief Subclass of the expression output handler applying a unary operation to a row batch.
+   */
+  template <typename Input>
+  struct unary_row_batch_handler : public expression_output_handler {
+    __device__ inline unary_row_batch_handler() {}
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<
+                detail::is_valid_unary_op<detail::operator_functor<op, has_nulls>,
+                                          possibly_null_value_t<Input, has_nulls>>>* = nullptr>
+    __device__ inline void operator()(
+      expression_evaluator const& evaluator,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& input,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      using Out = cuda::std::invoke_result_t<detail::operator_functor<op, false>, Input>;
+      for (cudf::size_type i = 0; i < rows.size; ++i) {
+        auto const row_index = rows.first + i * rows.stride;
+        auto const storage   = thread_intermediate_storage + i * evaluator.plan.num_intermediates;
+        auto const typed_input = evaluator.template resolve_input<Input>(input, storage, row_index);
+        this->template resolve_output<Out>(output_object,
+                                           output,
+                                           row_index,
+                                           storage,
+                                           detail::operator_functor<op, has_nulls>{}(typed_input));
+      }
+    }
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<
+                !detail::is_valid_unary_op<detail::operator_functor<op, has_nulls>,
+                                           possibly_null_value_t<Input, has_nulls>>>* = nullptr>
+    __device__ inline void operator()(
+      expression_evaluator const& evaluator,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& input,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      CUDF_UNREACHABLE("Invalid unary dispatch operator for the provided input.");
+    }
+  };
+
+  /**
+   * @brief Subclass of the expression output handler applying a binary operation to a row batch.
+   */
+  template <typename LHS, typename RHS>
+  struct binary_row_batch_handler : public expression_output_handler {
+    __device__ inline binary_row_batch_handler() {}
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<detail::is_valid_binary_op<detail::operator_functor<op, has_nulls>,
+                                                          possibly_null_value_t<LHS, has_nulls>,
+                                                          possibly_null_value_t<RHS, has_nulls>>>* =
+                nullptr>
+    __device__ inline void operator()(
+      expression_evaluator const& evaluator,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& lhs,
+      detail::device_data_reference const& rhs,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      using Out = cuda::std::invoke_result_t<detail::operator_functor<op, false>, LHS, RHS>;
+      for (cudf::size_type i = 0; i < rows.size; ++i) {
+        auto const row_index = rows.first + i * rows.stride;
+        auto const storage   = thread_intermediate_storage + i * evaluator.plan.num_intermediates;
+        auto const typed_lhs = evaluator.template resolve_input<LHS>(lhs, storage, row_index);
+        auto const typed_rhs = evaluator.template resolve_input<RHS>(rhs, storage, row_index);
+        this->template resolve_output<Out>(output_object,
+                                           output,
+                                           row_index,
+                                           storage,
+                                           detail::operator_functor<op, has_nulls>{}(typed_lhs,
+                                                                                     typed_rhs));
+      }
+    }
+
+    template <ast_operator op,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls,
+              std::enable_if_t<
+                !detail::is_valid_binary_op<detail::operator_functor<op, has_nulls>,
+                                            possibly_null_value_t<LHS, has_nulls>,
+                                            possibly_null_value_t<RHS, has_nulls>>>* = nullptr>
+    __device__ inline void operator()(
+      expression_evaluator const& evaluator,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& lhs,
+      detail::device_data_reference const& rhs,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      CUDF_UNREACHABLE("Invalid binary dispatch operator for the provided input.");
+    }
+  };
+
+  /**
+   * @brief Type-dispatched entry point resolving the operator of a unary row batch step.
+   */
+  struct unary_row_batch_dispatch {
+    expression_evaluator const& evaluator;
+
+    template <typename Input, typename ResultSubclass, typename T, bool result_has_nulls>
+    __device__ inline void operator()(
+      ast_operator const op,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& input,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      ast_operator_dispatcher(op,
+                              unary_row_batch_handler<Input>{},
+                              evaluator,
+                              output_object,
+                              rows,
+                              input,
+                              output,
+                              thread_intermediate_storage);
+    }
+  };
+
+  /**
+   * @brief Type-dispatched entry point resolving the operator of a binary row batch step.
+   */
+  struct binary_row_batch_dispatch {
+    expression_evaluator const& evaluator;
+
+    template <typename LHS,
+              typename RHS,
+              typename ResultSubclass,
+              typename T,
+              bool result_has_nulls>
+    __device__ inline void operator()(
+      ast_operator const op,
+      expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+      row_batch const& rows,
+      detail::device_data_reference const& lhs,
+      detail::device_data_reference const& rhs,
+      detail::device_data_reference const& output,
+      IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+    {
+      if (op == ast_operator::IS_IN) {
+        for (cudf::size_type i = 0; i < rows.size; ++i) {
+          auto const row_index = rows.first + i * rows.stride;
+          evaluator.template evaluate_set_membership<LHS>(
+            output_object,
+            row_index,
+            row_index,
+            lhs,
+            rhs,
+            output,
+            row_index,
+            thread_intermediate_storage + i * evaluator.plan.num_intermediates);
+        }
+        return;
+      }
+      ast_operator_dispatcher(op,
+                              binary_row_batch_handler<LHS, RHS>{},
+                              evaluator,
+                              output_object,
+                              rows,
+                              lhs,
+                              rhs,
+                              output,
+                              thread_intermediate_storage);
+    }
+  };
+
   table_device_view const& left;   ///< The left table to operate on.
   table_device_view const& right;  ///< The right table to operate on.
   expression_device_view const&
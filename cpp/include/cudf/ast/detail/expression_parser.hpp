@@ -17,17 +17,23 @@
 
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/scan.h>
 
 #include <functional>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace cudf {
 namespace ast {
@@ -78,6 +84,10 @@ struct alignas(8) device_data_reference {
 template <bool has_nulls>
 using IntermediateDataType = possibly_null_value_t<std::int64_t, has_nulls>;
 
+// Largest set literal searched linearly by IS_IN. Larger sets are sorted by the parser and
+// searched with a binary search.
+constexpr cudf::size_type max_unsorted_literal_set_size{16};
+
 /**
  * @brief A container of all device data required to evaluate an expression on tables.
  *
@@ -105,6 +115,10 @@ struct expression_device_view {
  * the expressions and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * Structurally identical subexpressions are linearized once and their intermediate is kept alive
+ * until every consumer has read it. Subexpressions that only depend on literals are evaluated once
+ * while parsing and replaced by a literal holding the result.
  */
 class expression_parser {
  public:
@@ -125,8 +139,11 @@ class expression_parser {
       _right{right},
       _expression_count{0},
       _intermediate_counter{},
-      _has_nulls(has_nulls)
+      _has_nulls(has_nulls),
+      _stream{stream},
+      _mr{mr}
   {
+    collect_subexpressions(expr);
     expr.accept(*this);
     move_to_device(stream, mr);
   }
@@ -219,6 +236,45 @@ class expression_parser {
     cudf::size_type max_used{0};
   };
 
+  /**
+   * @brief Host copy of the data references of the linearized expression.
+   *
+   * @return The data references, in the order they are indexed by the plan
+   */
+  [[nodiscard]] std::vector<detail::device_data_reference> const& data_references() const
+  {
+    return _data_references;
+  }
+
+  /**
+   * @brief Host copy of the operators of the linearized expression, in evaluation order.
+   *
+   * @return The operators
+   */
+  [[nodiscard]] std::vector<ast_operator> const& operators() const { return _operators; }
+
+  /**
+   * @brief Host copy of the data reference indices used by each operator.
+   *
+   * Each operator contributes its operand indices followed by its destination index.
+   *
+   * @return The operator source indices
+   */
+  [[nodiscard]] std::vector<cudf::size_type> const& operator_source_indices() const
+  {
+    return _operator_source_indices;
+  }
+
+  /**
+   * @brief Host copy of the literals of the linearized expression.
+   *
+   * @return The literals, in the order they are indexed by literal data references
+   */
+  [[nodiscard]] std::vector<generic_scalar_device_view> const& literals() const
+  {
+    return _literals;
+  }
+
   expression_device_view device_expression_data;  ///< The collection of data required to evaluate
                                                   ///< the expression on the device.
   int shmem_per_thread;
@@ -262,9 +318,9 @@ class expression_parser {
       std::memcpy(h_data_buffer.data() + buffer_offsets[i], data_pointers[i], sizes[i]);
     }
 
-    _device_data_buffer = rmm::device_buffer(h_data_buffer.data(), buffer_size, stream, mr);
-
-    stream.synchronize();
+    _device_data_buffer = rmm::device_buffer(buffer_size, stream, mr);
+    cudf::detail::copy_staging_buffer_to_device(
+      _device_data_buffer.data(), h_data_buffer.data(), buffer_size, stream);
 
     // Create device pointers to components of plan
     auto device_data_buffer_ptr            = static_cast<char const*>(_device_data_buffer.data());
@@ -313,6 +369,44 @@ class expression_parser {
    */
   cudf::size_type add_data_reference(detail::device_data_reference data_ref);
 
+  /**
+   * @brief Identify the structurally identical and literal-only operations of an expression.
+   *
+   * Fills `_subexpressions` and counts how many distinct operations consume each subexpression.
+   *
+   * @param  expr  The root of the expression.
+   */
+  void collect_subexpressions(expression const& expr);
+
+  /**
+   * @brief Evaluate a literal-only operation and add its result as a literal.
+   *
+   * @param  expr  The operation to evaluate.
+   *
+   * @return The index of the literal data reference, or no value if the result type cannot be
+   * held by a literal.
+   */
+  std::optional<cudf::size_type> fold_constant(operation const& expr);
+
+  /**
+   * @brief Create the device view of a set literal used by `ast_operator::IS_IN`.
+   *
+   * Sets larger than `max_unsorted_literal_set_size` are replaced by a sorted copy.
+   *
+   * @param  expr  The literal holding a list scalar.
+   *
+   * @return The view of the set elements to search.
+   */
+  generic_scalar_device_view set_literal_view(literal const& expr);
+
+  /**
+   * @brief Structural information about an operation gathered before linearization.
+   */
+  struct subexpression_info {
+    cudf::size_type id;  ///< Identifier shared by all structurally identical operations
+    bool is_constant;    ///< Whether the operation only depends on literals
+  };
+
   rmm::device_buffer
     _device_data_buffer;  ///< The device-side data buffer containing the plan information, which is
                           ///< owned by this class and persists until it is destroyed.
@@ -326,6 +420,17 @@ class expression_parser {
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
   std::vector<generic_scalar_device_view> _literals;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+  bool _fold_constants{false};
+  std::unordered_map<operation const*, subexpression_info> _subexpressions;
+  std::vector<cudf::size_type> _consumer_counts;  ///< Consumers of each subexpression id
+  std::unordered_map<cudf::size_type, cudf::size_type>
+    _linearized;  ///< Data reference index of each subexpression id already linearized
+  std::unordered_map<cudf::size_type, cudf::size_type>
+    _pending_reads;  ///< Consumers yet to read each live intermediate data reference
+  std::vector<std::unique_ptr<cudf::scalar>>
+    _owned_literals;  ///< Scalars created while parsing, e.g. folded constants and sorted sets
 };
 
 }  // namespace detail
@@ -16,9 +16,11 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cuda/std/type_traits>
@@ -60,6 +62,9 @@ constexpr bool is_valid_binary_op = cuda::std::is_invocable_v<Op, LHS, RHS>;
 template <typename Op, typename T>
 constexpr bool is_valid_unary_op = cuda::std::is_invocable_v<Op, T>;
 
+template <typename Op, typename Cond, typename LHS, typename RHS>
+constexpr bool is_valid_ternary_op = cuda::std::is_invocable_v<Op, Cond, LHS, RHS>;
+
 /**
  * @brief Operator dispatcher
  *
@@ -222,6 +227,24 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::CAST_TO_FLOAT64:
       f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::ENDS_WITH:
+      f.template operator()<ast_operator::ENDS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CONTAINS:
+      f.template operator()<ast_operator::CONTAINS>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CHAR_LENGTH:
+      f.template operator()<ast_operator::CHAR_LENGTH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::IF_ELSE:
+      f.template operator()<ast_operator::IF_ELSE>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::IS_IN:
+      f.template operator()<ast_operator::IS_IN>(std::forward<Ts>(args)...);
+      break;
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -844,6 +867,95 @@ struct operator_functor<ast_operator::CAST_TO_UINT64, false> : cast<uint64_t> {}
 template <>
 struct operator_functor<ast_operator::CAST_TO_FLOAT64, false> : cast<double> {};
 
+// The string operators compare bytes directly, which is exact for UTF-8 operands.
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            CUDF_ENABLE_IF(std::is_same_v<LHS, string_view> && std::is_same_v<RHS, string_view>)>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs.size_bytes() >= rhs.size_bytes() &&
+           string_view(lhs.data(), rhs.size_bytes()) == rhs;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::ENDS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            CUDF_ENABLE_IF(std::is_same_v<LHS, string_view> && std::is_same_v<RHS, string_view>)>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    auto const offset = lhs.size_bytes() - rhs.size_bytes();
+    return offset >= 0 && string_view(lhs.data() + offset, rhs.size_bytes()) == rhs;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::CONTAINS, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            CUDF_ENABLE_IF(std::is_same_v<LHS, string_view> && std::is_same_v<RHS, string_view>)>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    // A byte-wise scan avoids the character-position bookkeeping of `string_view::find`
+    auto const last = lhs.size_bytes() - rhs.size_bytes();
+    for (size_type offset = 0; offset <= last; ++offset) {
+      if (string_view(lhs.data() + offset, rhs.size_bytes()) == rhs) { return true; }
+    }
+    return false;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::CHAR_LENGTH, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT, CUDF_ENABLE_IF(std::is_same_v<InputT, string_view>)>
+  __device__ inline auto operator()(InputT input) -> size_type
+  {
+    return input.length();
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::IF_ELSE, false> {
+  static constexpr auto arity{3};
+
+  template <typename Cond,
+            typename LHS,
+            typename RHS,
+            CUDF_ENABLE_IF(std::is_same_v<Cond, bool> && std::is_same_v<LHS, RHS>)>
+  __device__ inline auto operator()(Cond condition, LHS lhs, RHS rhs) -> LHS
+  {
+    return condition ? lhs : rhs;
+  }
+};
+
+/*
+ * IS_IN is evaluated by searching the set literal on its right, so this functor only serves to
+ * determine the supported element types and the result type.
+ */
+template <>
+struct operator_functor<ast_operator::IS_IN, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            CUDF_ENABLE_IF(cudf::is_rep_layout_compatible<LHS>() && std::is_same_v<LHS, RHS>)>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs == rhs;
+  }
+};
+
 /*
  * The default specialization of nullable operators is to fall back to the non-nullable
  * implementation
@@ -875,6 +987,20 @@ struct operator_functor<op, true> {
   }
 };
 
+// IF_ELSE(null, a, b) is b, IF_ELSE(true, a, b) is a, and the selected operand may itself be null
+template <>
+struct operator_functor<ast_operator::IF_ELSE, true> {
+  using NonNullOperator       = operator_functor<ast_operator::IF_ELSE, false>;
+  static constexpr auto arity = NonNullOperator::arity;
+
+  template <typename Cond, typename LHS, typename RHS>
+  __device__ inline auto operator()(Cond const condition, LHS const lhs, RHS const rhs)
+    -> possibly_null_value_t<decltype(NonNullOperator{}(*condition, *lhs, *rhs)), true>
+  {
+    return (condition.has_value() && *condition) ? lhs : rhs;
+  }
+};
+
 // IS_NULL(null) is true, IS_NULL(valid) is false
 template <>
 struct operator_functor<ast_operator::IS_NULL, true> {
@@ -1116,6 +1242,89 @@ CUDF_HOST_DEVICE inline constexpr void unary_operator_dispatcher(ast_operator op
                           std::forward<Ts>(args)...);
 }
 
+/**
+ * @brief Functor used to type-dispatch ternary operators.
+ *
+ * This functor's `operator()` is templated to validate calls to its operators based on the input
+ * type, as determined by the `is_valid_ternary_op` trait. The first operand is a `bool` condition
+ * and the other two operands are assumed to have the same type, which is the dispatched type.
+ *
+ * @tparam OperatorFunctor Ternary operator functor.
+ */
+template <typename OperatorFunctor>
+struct single_dispatch_ternary_operator_types {
+  template <typename T,
+            typename F,
+            typename... Ts,
+            std::enable_if_t<is_valid_ternary_op<OperatorFunctor, bool, T, T>>* = nullptr>
+  CUDF_HOST_DEVICE inline void operator()(F&& f, Ts&&... args)
+  {
+    f.template operator()<OperatorFunctor, bool, T, T>(std::forward<Ts>(args)...);
+  }
+
+  template <typename T,
+            typename F,
+            typename... Ts,
+            std::enable_if_t<!is_valid_ternary_op<OperatorFunctor, bool, T, T>>* = nullptr>
+  CUDF_HOST_DEVICE inline void operator()(F&& f, Ts&&... args)
+  {
+#ifndef __CUDA_ARCH__
+    CUDF_FAIL("Invalid ternary operation.");
+#else
+    CUDF_UNREACHABLE("Invalid ternary operation.");
+#endif
+  }
+};
+
+/**
+ * @brief Functor performing a type dispatch for a ternary operator.
+ */
+struct type_dispatch_ternary_op {
+  template <ast_operator op, typename F, typename... Ts>
+  CUDF_HOST_DEVICE inline void operator()(cudf::data_type cond_type,
+                                          cudf::data_type lhs_type,
+                                          cudf::data_type rhs_type,
+                                          F&& f,
+                                          Ts&&... args)
+  {
+    // Single dispatch (assume lhs_type == rhs_type and a boolean condition)
+    type_dispatcher(
+      lhs_type,
+      // Always dispatch to the non-null operator for the purpose of type determination.
+      detail::single_dispatch_ternary_operator_types<operator_functor<op, false>>{},
+      std::forward<F>(f),
+      std::forward<Ts>(args)...);
+  }
+};
+
+/**
+ * @brief Dispatches a runtime ternary operator to a templated type dispatcher.
+ *
+ * @tparam F Type of forwarded functor.
+ * @tparam Ts Parameter pack of forwarded arguments.
+ * @param cond_type Type of the first input data.
+ * @param lhs_type Type of the second input data.
+ * @param rhs_type Type of the third input data.
+ * @param f Forwarded functor to be called.
+ * @param args Forwarded arguments to `operator()` of `f`.
+ */
+template <typename F, typename... Ts>
+CUDF_HOST_DEVICE inline constexpr void ternary_operator_dispatcher(ast_operator op,
+                                                                   cudf::data_type cond_type,
+                                                                   cudf::data_type lhs_type,
+                                                                   cudf::data_type rhs_type,
+                                                                   F&& f,
+                                                                   Ts&&... args)
+{
+  ast_operator_dispatcher(op,
+                          detail::type_dispatch_ternary_op{},
+                          cond_type,
+                          lhs_type,
+                          rhs_type,
+                          std::forward<F>(f),
+                          std::forward<Ts>(args)...);
+}
+
 /**
  * @brief Functor to determine the return type of an operator from its input types.
  */
@@ -1176,6 +1385,40 @@ struct return_type_functor {
     CUDF_FAIL("Invalid unary operation. Return type cannot be determined.");
 #else
     CUDF_UNREACHABLE("Invalid unary operation. Return type cannot be determined.");
+#endif
+  }
+
+  /**
+   * @brief Callable for ternary operators to determine return type.
+   *
+   * @tparam OperatorFunctor Operator functor to perform.
+   * @tparam Cond First input type.
+   * @tparam LHS Second input type.
+   * @tparam RHS Third input type.
+   * @param result Reference whose value is assigned to the result data type.
+   */
+  template <typename OperatorFunctor,
+            typename Cond,
+            typename LHS,
+            typename RHS,
+            std::enable_if_t<is_valid_ternary_op<OperatorFunctor, Cond, LHS, RHS>>* = nullptr>
+  CUDF_HOST_DEVICE inline void operator()(cudf::data_type& result)
+  {
+    using Out = cuda::std::invoke_result_t<OperatorFunctor, Cond, LHS, RHS>;
+    result    = cudf::data_type(cudf::type_to_id<Out>());
+  }
+
+  template <typename OperatorFunctor,
+            typename Cond,
+            typename LHS,
+            typename RHS,
+            std::enable_if_t<!is_valid_ternary_op<OperatorFunctor, Cond, LHS, RHS>>* = nullptr>
+  CUDF_HOST_DEVICE inline void operator()(cudf::data_type& result)
+  {
+#ifndef __CUDA_ARCH__
+    CUDF_FAIL("Invalid ternary operation. Return type cannot be determined.");
+#else
+    CUDF_UNREACHABLE("Invalid ternary operation. Return type cannot be determined.");
 #endif
   }
 };
@@ -1199,6 +1442,14 @@ inline cudf::data_type ast_operator_return_type(ast_operator op,
       binary_operator_dispatcher(
         op, operand_types[0], operand_types[1], detail::return_type_functor{}, result);
       break;
+    case 3:
+      ternary_operator_dispatcher(op,
+                                  operand_types[0],
+                                  operand_types[1],
+                                  operand_types[2],
+                                  detail::return_type_functor{},
+                                  result);
+      break;
     default: CUDF_FAIL("Unsupported operator return type."); break;
   }
   return result;
@@ -152,7 +152,18 @@ enum class ast_operator : int32_t {
   NOT,             ///< Logical Not (!)
   CAST_TO_INT64,   ///< Cast value to int64_t
   CAST_TO_UINT64,  ///< Cast value to uint64_t
-  CAST_TO_FLOAT64  ///< Cast value to double
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  // String operators
+  STARTS_WITH,  ///< String begins with the right operand
+  ENDS_WITH,    ///< String ends with the right operand
+  CONTAINS,     ///< String contains the right operand
+  CHAR_LENGTH,  ///< Number of characters in a string
+  // Ternary operators
+  IF_ELSE,  ///< Second operand if the first is true, otherwise the third (a null condition selects
+            ///< the third)
+  // Set operators
+  IS_IN  ///< Whether the left operand is one of the values of the right operand, which must be a
+         ///< literal constructed from a list scalar
 };
 
 /**
@@ -186,6 +197,20 @@ class generic_scalar_device_view : public cudf::detail::scalar_device_view_base
     return *static_cast<T const*>(_data);
   }
 
+  /**
+   * @brief Returns a pointer to the device memory holding the value
+   *
+   * @returns Pointer to the value
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE void const* data() const noexcept { return _data; }
+
+  /**
+   * @brief Returns the size in bytes of a string value or the number of elements of a list value
+   *
+   * @returns The size of the value
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE size_type size() const noexcept { return _size; }
+
   /** @brief Construct a new generic scalar device view object from a numeric scalar
    *
    * @param s The numeric scalar to construct from
@@ -225,9 +250,21 @@ class generic_scalar_device_view : public cudf::detail::scalar_device_view_base
   {
   }
 
+  /** @brief Construct a new generic scalar device view object from a list scalar
+   *
+   * The view has the type of the list elements and points to the first element.
+   *
+   * @param s The list scalar to construct from
+   */
+  generic_scalar_device_view(list_scalar& s)
+    : generic_scalar_device_view(
+        s.view().type(), s.view().head(), s.validity_data(), s.view().size())
+  {
+  }
+
  protected:
   void const* _data{};      ///< Pointer to device memory containing the value
-  size_type const _size{};  ///< Size of the string in bytes for string scalar
+  size_type const _size{};  ///< Size of the string in bytes or number of list elements
 
   /**
    * @brief Construct a new fixed width scalar device view object
@@ -301,6 +338,16 @@ class literal : public expression {
    */
   literal(cudf::string_scalar& value) : scalar(value), value(value) {}
 
+  /**
+   * @brief Construct a new literal object holding a set of values.
+   *
+   * Set literals may only be used as the right operand of `ast_operator::IS_IN`. The elements
+   * must be of a fixed-width type and must not contain nulls.
+   *
+   * @param value A list scalar whose elements form the set
+   */
+  literal(cudf::list_scalar& value) : scalar(value), value(value) {}
+
   /**
    * @brief Get the data type.
    *
@@ -315,6 +362,13 @@ class literal : public expression {
    */
   [[nodiscard]] generic_scalar_device_view get_value() const { return value; }
 
+  /**
+   * @brief Get the scalar object.
+   *
+   * @return The scalar object this literal was constructed from
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @copydoc expression::accept
    */
@@ -459,6 +513,19 @@ class operation : public expression {
    */
   operation(ast_operator op, expression const& left, expression const& right);
 
+  /**
+   * @brief Construct a new ternary operation object.
+   *
+   * @param op Operator
+   * @param first First input expression (first operand)
+   * @param second Second input expression (second operand)
+   * @param third Third input expression (third operand)
+   */
+  operation(ast_operator op,
+            expression const& first,
+            expression const& second,
+            expression const& third);
+
   // operation only stores references to expressions, so it does not accept r-value
   // references: the calling code must own the expressions.
   operation(ast_operator op, expression&& input)                         = delete;
@@ -466,6 +533,20 @@ class operation : public expression {
   operation(ast_operator op, expression&& left, expression const& right) = delete;
   operation(ast_operator op, expression const& left, expression&& right) = delete;
 
+  operation(ast_operator op, expression&& first, expression&& second, expression&& third) = delete;
+  operation(ast_operator op,
+            expression&& first,
+            expression const& second,
+            expression const& third) = delete;
+  operation(ast_operator op,
+            expression const& first,
+            expression&& second,
+            expression const& third) = delete;
+  operation(ast_operator op,
+            expression const& first,
+            expression const& second,
+            expression&& third) = delete;
+
   /**
    * @brief Get the operator.
    *
@@ -18,11 +18,13 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -183,6 +185,39 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Describes one column-column binary operation of a `batched_binary_operation` call
+ */
+struct binary_operation_spec {
+  column_view lhs;        ///< The left operand column
+  column_view rhs;        ///< The right operand column
+  binary_operator op;     ///< The binary operator
+  data_type output_type;  ///< The desired data type of the output column
+};
+
+/**
+ * @brief Performs several binary operations between columns of the same size.
+ *
+ * Each result is identical to calling `binary_operation(lhs, rhs, op, output_type)` for the
+ * corresponding entry of @p operations. Operations sharing an operator are computed by a single
+ * kernel that produces all of their outputs in one pass over the rows, so operand columns shared
+ * between several operations are read from device memory once per row rather than once per
+ * operation. Operations the fused kernels do not handle (e.g. equality operators and string
+ * outputs) are computed individually.
+ *
+ * @param operations The binary operations to perform
+ * @param stream     CUDA stream used for device memory operations and kernel launches
+ * @param mr         Device memory resource used to allocate the returned columns' device memory
+ * @return           Output columns, one per entry of @p operations in the same order
+ * @throw std::invalid_argument if the operand columns do not all have the same size
+ * @throw cudf::logic_error if any operation is invalid as described for `binary_operation`
+ * @throw cudf::data_type_error if any operation is not supported for the types of its operands
+ */
+std::vector<std::unique_ptr<column>> batched_binary_operation(
+  host_span<binary_operation_spec const> operations,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
@@ -214,6 +249,24 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compiles the kernel `binary_operation` uses for a PTX binary function without running it.
+ *
+ * Warming the kernels of known functions at startup moves their compilation out of the first
+ * call to `binary_operation`. Compiled kernels are also stored in the JIT kernel cache directory,
+ * see `cudf::get_kernel_cache_statistics`.
+ *
+ * @param lhs_type    The type of the left operand columns
+ * @param rhs_type    The type of the right operand columns
+ * @param ptx         String containing the PTX of a binary function
+ * @param output_type The data type of the output columns
+ * @throw cudf::logic_error if @p lhs_type, @p rhs_type or @p output_type aren't numeric
+ */
+void warm_binary_operation(data_type lhs_type,
+                           data_type rhs_type,
+                           std::string const& ptx,
+                           data_type output_type);
+
 /**
  * @brief Computes the `scale` for a `fixed_point` number based on given binary operator `op`
  *
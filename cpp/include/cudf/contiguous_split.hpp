@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <cudf/io/types.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -235,6 +237,22 @@ class chunked_pack {
    */
   [[nodiscard]] std::size_t next(cudf::device_span<uint8_t> const& user_buffer);
 
+  /**
+   * @brief Packs all remaining chunks into `host_buffer`.
+   *
+   * Two bounce buffers of `user_buffer_size` bytes are allocated from `temp_mr`, and the
+   * batched copy of each chunk is overlapped with the device-to-host transfer of the previous
+   * one. `host_buffer` should be pinned for the transfers to be asynchronous; pageable memory
+   * works but serializes the copies. Returns once all the data has reached `host_buffer`, after
+   * which `has_next` returns false.
+   *
+   * @throws std::invalid_argument If `host_buffer` is smaller than `get_total_contiguous_size()`
+   *
+   * @param host_buffer host span target for the packed table
+   * @return The number of bytes that were written to `host_buffer`
+   */
+  [[nodiscard]] std::size_t pack_to_host(cudf::host_span<uint8_t> host_buffer);
+
   /**
    * @brief Build the opaque metadata for all added columns.
    *
@@ -285,6 +303,39 @@ class chunked_pack {
 packed_columns pack(cudf::table_view const& input,
                     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compresses the device data of a packed table for spilling or network transfer.
+ *
+ * `gpu_data` is split into fixed-size blocks that are compressed independently on the GPU; blocks
+ * that do not shrink are stored as-is. The codec and block sizes are recorded in the returned
+ * metadata. The result cannot be passed to `unpack` directly; use `decompress_packed` first.
+ *
+ * @throws std::invalid_argument If `compression` is not one of LZ4, SNAPPY or ZSTD
+ * @throws std::invalid_argument If `input` is already compressed
+ *
+ * @param input The packed columns to compress
+ * @param compression Compression type to use
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return packed_columns holding the compressed data and its metadata
+ */
+packed_columns compress_packed(
+  packed_columns const& input,
+  io::compression_type compression,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decompresses the result of `compress_packed`.
+ *
+ * @throws std::invalid_argument If `input` is not compressed
+ *
+ * @param input The compressed packed columns
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return packed_columns that can be passed to `unpack`
+ */
+packed_columns decompress_packed(
+  packed_columns const& input,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Produce the metadata used for packing a table stored in a contiguous buffer.
  *
@@ -313,6 +364,8 @@ std::vector<uint8_t> pack_metadata(table_view const& table,
  *
  * No new device memory is allocated in this function.
  *
+ * @throws std::invalid_argument If `input` was compressed with `compress_packed`
+ *
  * @param input The packed columns to unpack
  * @return The unpacked `table_view`
  */
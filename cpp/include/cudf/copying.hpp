@@ -23,11 +23,13 @@
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -51,6 +53,14 @@ enum class out_of_bounds_policy : bool {
   DONT_CHECK  ///< No bounds checking is performed, better performance
 };
 
+/**
+ * @brief Describes what the caller guarantees about the indices of a gather map
+ */
+enum class gather_map_policy : bool {
+  UNCHECKED,  ///< Negative indices wrap around; no guarantee is made about the index range
+  IN_BOUNDS   ///< Every index is in `[0, num_rows)`, e.g. the output of a join
+};
+
 /**
  * @brief Gathers the specified rows (including null values) of a set of columns.
  *
@@ -89,6 +99,63 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream       = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gathers the specified rows of a set of columns, with a guarantee about the gather map.
+ *
+ * @ingroup copy_gather
+ *
+ * Same as `gather(source_table, gather_map, out_of_bounds_policy::DONT_CHECK)` when
+ * `map_policy` is `UNCHECKED`. With `IN_BOUNDS` the negative-index conversion is skipped as
+ * well, and an INT32 gather map is read directly rather than through a type-normalizing
+ * iterator. The behavior is undefined if an index is outside `[0, source_table.num_rows())`.
+ *
+ * @throws std::invalid_argument if gather_map contains null values.
+ *
+ * @param source_table The input columns whose rows will be gathered
+ * @param gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns.
+ * @param map_policy What the caller guarantees about the indices in `gather_map`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Result of the gather
+ */
+std::unique_ptr<table> gather(
+  table_view const& source_table,
+  column_view const& gather_map,
+  gather_map_policy map_policy,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Gathers the same rows from each of several tables.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to calling `cudf::gather(source_tables[i], gather_map, bounds_policy)` for each
+ * table, but the fixed-width columns of all tables are gathered by a single kernel launch, the
+ * string columns of all tables share one sizes/offsets pass and one chars pass, and the null
+ * masks of those columns are computed together. Other column types are gathered individually.
+ *
+ * This is useful after a join, where one gather map is applied to several payload tables.
+ *
+ * @throws std::invalid_argument if gather_map contains null values.
+ * @throws std::invalid_argument if the source tables do not all have the same number of rows.
+ *
+ * @param source_tables The tables whose rows will be gathered
+ * @param gather_map View into a non-nullable column of integral indices that maps the
+ * rows in each source table to rows in the corresponding result table.
+ * @param bounds_policy Policy to apply to account for possible out-of-bounds indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return One gathered table per source table, in the same order
+ */
+std::vector<std::unique_ptr<table>> batched_gather(
+  host_span<table_view const> source_tables,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream       = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr  = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Reverses the rows within a table.
  *
@@ -854,6 +921,51 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr   = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gather up to `n` random samples from each segment of `input`
+ *
+ * Rows `[segment_offsets[i], segment_offsets[i+1])` of `input` form segment `i`, e.g. the rows
+ * of one group after a sort or a groupby. Only the sampled indices are generated, so the memory
+ * used is proportional to the number of samples rather than to the size of `input`.
+ *
+ * With `replacement == TRUE`, `n` rows are drawn uniformly from every non-empty segment.
+ * With `replacement == FALSE`, a segment of `s` rows yields `min(n, s)` rows: the segment is
+ * divided into that many contiguous strata, whose sizes differ by at most one, and one row is
+ * drawn uniformly from each stratum. The samples are in row order within the segment and cover
+ * it evenly, which makes them well suited for choosing split points.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input:           {col1: {1, 2, 3, 4, 5, 6, 7}}
+ * segment_offsets: {0, 4, 7}
+ * n: 2
+ * replacement: false
+ *
+ * output:          {col1: {1, 4, 5, 7}}, offsets: {0, 2, 4}
+ * @endcode
+ *
+ * @throws std::invalid_argument if `n` < 0
+ * @throws std::invalid_argument if `segment_offsets` is not a non-nullable INT32 column
+ *
+ * @param input View of a table to sample
+ * @param segment_offsets Offsets of the segments of `input`
+ * @param n Number of samples to take from each segment
+ * @param replacement Allow or disallow sampling of the same row more than once
+ * @param seed Seed value to initiate random number generator
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return Table containing the samples and the offsets of each segment's samples in it
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> segmented_sample(
+  table_view const& input,
+  column_view const& segment_offsets,
+  size_type const n,
+  sample_with_replacement replacement = sample_with_replacement::FALSE,
+  int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr   = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Checks if a column or its descendants have non-empty null rows
  *
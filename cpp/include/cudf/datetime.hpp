@@ -17,11 +17,15 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -36,6 +40,22 @@ namespace datetime {
  * @file
  */
 
+/**
+ * @brief Types of datetime components that may be extracted.
+ */
+enum class datetime_component : uint8_t {
+  YEAR,         ///< year, as by `extract_year`
+  MONTH,        ///< month, as by `extract_month`
+  DAY,          ///< day of the month, as by `extract_day`
+  WEEKDAY,      ///< ISO day of the week, as by `extract_weekday`
+  HOUR,         ///< hour of the day, as by `extract_hour`
+  MINUTE,       ///< minute of the hour, as by `extract_minute`
+  SECOND,       ///< second of the minute, as by `extract_second`
+  MILLISECOND,  ///< millisecond fraction, as by `extract_millisecond_fraction`
+  MICROSECOND,  ///< microsecond fraction, as by `extract_microsecond_fraction`
+  NANOSECOND    ///< nanosecond fraction, as by `extract_nanosecond_fraction`
+};
+
 /**
  * @brief  Extracts year from any datetime type and returns an int16_t
  * cudf::column.
@@ -185,6 +205,34 @@ std::unique_ptr<cudf::column> extract_nanosecond_fraction(
   cudf::column_view const& column,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Extracts several datetime components from any datetime type and returns them as
+ * int16_t cudf::columns of a table.
+ *
+ * Each output column is identical to the one returned by the `extract_*` function of its
+ * component, but the calendar date and the time of day of each timestamp are computed once for
+ * all the components rather than once per component.
+ *
+ * @code{.pseudo}
+ * column     = [2024-03-10 14:05:30]
+ * components = [YEAR, MONTH, HOUR, MINUTE]
+ * result     = {[2024], [3], [14], [5]}
+ * @endcode
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components The components to extract, in the order of the output columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ *
+ * @returns cudf::table with one int16_t column per component, each with the null mask of `column`
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -92,6 +92,10 @@ struct corresponding_operator<aggregation::VARIANCE> {
   using type = DeviceSum;
 };
 template <>
+struct corresponding_operator<aggregation::M2> {
+  using type = DeviceSum;
+};
+template <>
 struct corresponding_operator<aggregation::MEAN> {
   using type = DeviceSum;
 };
@@ -601,7 +605,7 @@ struct identity_initializer {
             k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL or
             k == aggregation::ARGMAX or k == aggregation::ARGMIN or
             k == aggregation::SUM_OF_SQUARES or k == aggregation::STD or
-            k == aggregation::VARIANCE or
+            k == aggregation::VARIANCE or k == aggregation::M2 or
             (k == aggregation::PRODUCT and is_product_supported<T>()));
   }
 
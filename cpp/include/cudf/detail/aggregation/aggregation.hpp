@@ -101,6 +101,10 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class tdigest_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class merge_tdigest_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class hllpp_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class merge_hllpp_aggregation const& agg);
 };
 
 class aggregation_finalizer {  // Declares the interface for the finalizer
@@ -140,6 +144,8 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class correlation_aggregation const& agg);
   virtual void visit(class tdigest_aggregation const& agg);
   virtual void visit(class merge_tdigest_aggregation const& agg);
+  virtual void visit(class hllpp_aggregation const& agg);
+  virtual void visit(class merge_hllpp_aggregation const& agg);
 };
 
 /**
@@ -1142,6 +1148,77 @@ class merge_tdigest_aggregation final : public groupby_aggregation, public reduc
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived aggregation class for specifying HLLPP aggregation
+ */
+class hllpp_aggregation final : public groupby_aggregation, public reduce_aggregation {
+ public:
+  explicit hllpp_aggregation(int precision_) : aggregation{HLLPP}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< The number of bits of the value hashes that select a register
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<hllpp_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<hllpp_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying MERGE_HLLPP aggregation
+ */
+class merge_hllpp_aggregation final : public groupby_aggregation, public reduce_aggregation {
+ public:
+  explicit merge_hllpp_aggregation(int precision_)
+    : aggregation{MERGE_HLLPP}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< The number of bits of the value hashes that select a register
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<merge_hllpp_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<merge_hllpp_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
 /**
  * @brief Sentinel value used for `ARGMAX` aggregation.
  *
@@ -1413,6 +1490,22 @@ struct target_type_impl<Source,
   using type = struct_view;
 };
 
+// HLLPP sketches are lists of registers. Nested values are not hashed.
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::HLLPP,
+                        std::enable_if_t<not cudf::is_nested<Source>()>> {
+  using type = list_view;
+};
+
+// MERGE_HLLPP merges lists of registers
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_HLLPP,
+                        std::enable_if_t<std::is_same_v<Source, cudf::list_view>>> {
+  using type = list_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -1529,6 +1622,10 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
     case aggregation::MERGE_TDIGEST:
       return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::HLLPP:
+      return f.template operator()<aggregation::HLLPP>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_HLLPP:
+      return f.template operator()<aggregation::MERGE_HLLPP>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
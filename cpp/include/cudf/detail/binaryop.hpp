@@ -76,5 +76,13 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          data_type output_type,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::batched_binary_operation
+ */
+std::vector<std::unique_ptr<column>> batched_binary_operation(
+  host_span<binary_operation_spec const> operations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
 }  // namespace detail
 }  // namespace cudf
@@ -124,5 +124,49 @@ std::vector<uint8_t> pack_metadata(table_view const& table,
                                    size_t buffer_size,
                                    metadata_builder& builder);
 
+/**
+ * @copydoc cudf::compress_packed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+packed_columns compress_packed(packed_columns const& input,
+                               io::compression_type compression,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::decompress_packed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+packed_columns decompress_packed(packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Compression parameters recorded in packed column metadata.
+ */
+struct packed_compression_info {
+  io::compression_type compression;  ///< Codec, or NONE if the data is not compressed
+  std::size_t uncompressed_size;     ///< Size of `gpu_data` before compression
+  std::size_t block_size;            ///< Uncompressed size of each compressed block
+};
+
+/**
+ * @brief Reads the compression parameters from packed column metadata.
+ *
+ * @param metadata Packed column metadata; must not be empty
+ * @return The compression parameters, with `compression` NONE for uncompressed data
+ */
+packed_compression_info get_packed_compression(uint8_t const* metadata);
+
+/**
+ * @brief Records compression parameters in packed column metadata.
+ *
+ * @param metadata Packed column metadata; must not be empty
+ * @param info The compression parameters to record
+ */
+void set_packed_compression(uint8_t* metadata, packed_compression_info const& info);
+
 }  // namespace detail
 }  // namespace cudf
@@ -246,6 +246,18 @@ std::unique_ptr<table> sample(table_view const& input,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::segmented_sample
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> segmented_sample(
+  table_view const& input,
+  column_view const& segment_offsets,
+  size_type const n,
+  sample_with_replacement replacement,
+  int64_t const seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::get_element
  *
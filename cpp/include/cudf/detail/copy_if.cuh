@@ -275,7 +275,10 @@ struct scatter_gather_functor {
                                                                 per_thread,
                                                                 filter);
 
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
+    if (has_valid) {
+      output_column->set_null_count(null_count.value(stream));
+      record_synchronization();
+    }
     return output_column;
   }
 
@@ -381,6 +384,7 @@ std::unique_ptr<table> copy_if(table_view const& input,
     stream.value()));
 
   stream.synchronize();
+  record_synchronization();
 
   if (output_size == input.num_rows()) {
     return std::make_unique<table>(input, stream, mr);
@@ -18,6 +18,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
@@ -27,10 +28,12 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cub/cub.cuh>
 #include <cuda_runtime.h>
+#include <thrust/copy.h>
 
 #include <memory>
 
@@ -182,6 +185,57 @@ void copy_range(SourceValueIterator source_value_begin,
   CUDF_CHECK_CUDA(stream.value());
 }
 
+/**
+ * @brief Internal API to copy a range of values of the same validity from a source iterator to
+ * a target column.
+ *
+ * The elements indicated by the indices [@p target_begin, @p target_end) are replaced with
+ * *(@p source_value_begin + idx) and all set valid if @p valid is true, or all set null
+ * otherwise. Unlike `copy_range`, the validity of the range is written whole bitmask words at a
+ * time rather than one element at a time. @p target is modified in place.
+ *
+ * @throws cudf::logic_error if @p valid is false and @p target is not nullable
+ *
+ * @tparam SourceValueIterator Iterator for retrieving source values
+ * @param source_value_begin Start of source value iterator
+ * @param valid Whether the elements of the range are valid
+ * @param target the column to copy into
+ * @param target_begin The starting index of the target range (inclusive)
+ * @param target_end The index of the last element in the target range (exclusive)
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename SourceValueIterator>
+void copy_range(SourceValueIterator source_value_begin,
+                bool valid,
+                mutable_column_view& target,
+                size_type target_begin,
+                size_type target_end,
+                rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS((target_begin <= target_end) && (target_begin >= 0) &&
+                 (target_begin < target.size()) && (target_end <= target.size()),
+               "Range is out of bounds.");
+  CUDF_EXPECTS(valid || target.nullable(), "target should be nullable or the range valid.");
+  using T = typename std::iterator_traits<SourceValueIterator>::value_type;
+
+  // this code assumes that source and target have the same type.
+  CUDF_EXPECTS(type_id_matches_device_storage_type<T>(target.type().id()), "data type mismatch");
+
+  thrust::copy_n(rmm::exec_policy_nosync(stream),
+                 source_value_begin,
+                 target_end - target_begin,
+                 target.data<T>() + target_begin);
+
+  if (target.nullable()) {
+    auto const begin_bit = target.offset() + target_begin;
+    auto const end_bit   = target.offset() + target_end;
+    auto const old_nulls = null_count(target.null_mask(), begin_bit, end_bit, stream);
+    set_null_mask(target.null_mask(), begin_bit, end_bit, valid, stream);
+    target.set_null_count(target.null_count() - old_nulls +
+                          (valid ? 0 : target_end - target_begin));
+  }
+}
+
 /**
  * @copydoc cudf::copy_range_in_place
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/detail/join.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
@@ -150,5 +151,28 @@ struct distinct_hash_join {
    */
   std::unique_ptr<rmm::device_uvector<size_type>> left_join(
     rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::distinct_hash_join::left_semi_join
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::distinct_hash_join::left_anti_join
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const;
+
+ private:
+  /**
+   * @brief Returns the probe row indices of a left semi or left anti join
+   *
+   * @param kind Either `LEFT_SEMI_JOIN` or `LEFT_ANTI_JOIN`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> semi_anti_join(
+    join_kind kind, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const;
 };
 }  // namespace cudf::detail
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -619,6 +620,34 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief Makes `stream` the stream used to free the memory of a column and its children
+ *
+ * Device buffers are freed on the stream they were allocated on. Columns built on a forked
+ * stream must be rebound to the stream their consumers use before they are returned.
+ *
+ * @param col Column to rebind; replaced by a column owning the same memory
+ * @param stream Stream on which the memory will be freed
+ */
+inline void set_deallocation_stream(std::unique_ptr<column>& col, rmm::cuda_stream_view stream)
+{
+  auto const type       = col->type();
+  auto const size       = col->size();
+  auto const null_count = col->null_count();
+  auto contents         = col->release();
+  contents.data->set_stream(stream);
+  contents.null_mask->set_stream(stream);
+  for (auto& child : contents.children) {
+    set_deallocation_stream(child, stream);
+  }
+  col = std::make_unique<column>(type,
+                                 size,
+                                 std::move(*contents.data),
+                                 std::move(*contents.null_mask),
+                                 null_count,
+                                 std::move(contents.children));
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -657,10 +686,15 @@ std::unique_ptr<table> gather(table_view const& source_table,
 {
   std::vector<std::unique_ptr<column>> destination_columns;
 
-  // TODO: Could be beneficial to use streams internally here
+  // the columns may be gathered on several streams to overlap their small kernels
+  auto const num_streams =
+    std::min<std::size_t>(operator_stream_count(), source_table.num_columns());
+  auto const streams =
+    num_streams > 1 ? fork_streams(stream, num_streams) : std::vector<rmm::cuda_stream_view>{};
 
   for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
+    auto const column_stream =
+      streams.empty() ? stream : streams[destination_columns.size() % streams.size()];
     destination_columns.push_back(
       cudf::type_dispatcher<dispatch_storage_type>(source_column.type(),
                                                    column_gatherer{},
@@ -668,10 +702,18 @@ std::unique_ptr<table> gather(table_view const& source_table,
                                                    gather_map_begin,
                                                    gather_map_end,
                                                    bounds_policy == out_of_bounds_policy::NULLIFY,
-                                                   stream,
+                                                   column_stream,
                                                    mr));
   }
 
+  if (!streams.empty()) {
+    join_streams(streams, stream);
+    // the output is used on `stream` so it must also be freed on `stream`
+    for (auto& col : destination_columns) {
+      set_deallocation_stream(col, stream);
+    }
+  }
+
   auto needs_new_bitmask = bounds_policy == out_of_bounds_policy::NULLIFY ||
                            cudf::has_nested_nullable_columns(source_table);
   if (needs_new_bitmask) {
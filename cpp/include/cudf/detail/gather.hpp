@@ -26,6 +26,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -83,5 +84,18 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::batched_gather
+ *
+ * @param neg_indices Interpret each negative index `i` in the gather map as the positive index
+ * `i+num_source_rows`.
+ */
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   column_view const& gather_map,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   negative_index_policy neg_indices,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace cudf
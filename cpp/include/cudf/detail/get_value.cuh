@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -52,6 +53,7 @@ T get_value(column_view const& col_view, size_type element_index, rmm::cuda_stre
   CUDF_CUDA_TRY(cudaMemcpyAsync(
     &result, col_view.data<T>() + element_index, sizeof(T), cudaMemcpyDefault, stream.value()));
   stream.synchronize();
+  record_synchronization();
   return result;
 }
 
@@ -20,10 +20,12 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -40,6 +42,17 @@ namespace hash {
  */
 bool can_use_hash_groupby(host_span<aggregation_request const> requests);
 
+/**
+ * @brief Indicates if the aggregation `agg` of `values` can be computed with a
+ * hash-based groupby implementation.
+ *
+ * @param values The column to aggregate
+ * @param agg The aggregation to perform
+ * @return true A hash-based groupby can be used
+ * @return false A hash-based groupby cannot be used
+ */
+bool can_use_hash_groupby(column_view const& values, aggregation const& agg);
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
@@ -47,8 +60,64 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Hash-based groupby that returns the index of a row of `keys` in each group in place of
+ * the unique keys
+ *
+ * The groups of the results are in the order of the returned indices, whose device memory is
+ * allocated with the current device resource.
+ */
+std::pair<rmm::device_uvector<size_type>, std::vector<aggregation_result>> groupby_key_indices(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
 }  // namespace hash
 
+namespace run_length {
+/**
+ * @brief Indicates if a set of aggregation requests can be satisfied by aggregating the runs of
+ * equal adjacent keys.
+ *
+ * Only the SUM, PRODUCT, MIN, MAX and COUNT aggregations of non-dictionary numeric values, MIN
+ * and MAX of chrono values, and non-nested keys are supported.
+ *
+ * @param keys The keys to group by
+ * @param requests The set of columns to aggregate and the aggregations to
+ * perform
+ * @return true A run-length groupby can be used
+ * @return false A run-length groupby cannot be used
+ */
+bool can_use_run_length_groupby(table_view const& keys,
+                                host_span<aggregation_request const> requests);
+
+/**
+ * @brief Indicates if the equal rows of `keys` are clustered into runs of adjacent rows long
+ * enough for a run-length groupby to be faster than a hash-based groupby.
+ *
+ * @param keys The keys to group by
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return true The keys are clustered
+ * @return false The keys are not clustered
+ */
+bool is_clustered(table_view const& keys, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Run-length groupby of clustered keys
+ *
+ * The rows of each run of equal adjacent keys are aggregated by segmented reductions, and the
+ * results of the runs of the same keys are then merged by a hash-based groupby of the runs.
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+}  // namespace run_length
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
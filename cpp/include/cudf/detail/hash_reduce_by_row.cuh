@@ -15,6 +15,7 @@
  */
 
 #include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/hashing/detail/cached_row_hasher.cuh>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
@@ -109,6 +110,8 @@ struct reduce_by_row_fn_base {
  * @param nans_equal Flag to specify whether NaN values in floating point column should be
  *        considered equal.
  * @param init The initial value for reduction of each row group
+ * @param row_hashes Precomputed hash value of each input row used to build `map`, or
+ *        nullptr to hash the rows
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned vector
  * @return A device_uvector containing the reduction results
@@ -124,13 +127,15 @@ rmm::device_uvector<OutputType> hash_reduce_by_row(
   nan_equality nans_equal,
   ReduceFuncBuilder func_builder,
   OutputType init,
+  hash_value_type const* row_hashes,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
 {
   auto const map_dview  = map.get_device_view();
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
-  auto const key_hasher = row_hasher.device_hasher(has_nulls);
-  auto const row_comp   = cudf::experimental::row::equality::self_comparator(preprocessed_input);
+  auto const key_hasher =
+    cudf::hashing::detail::make_cached_row_hasher(row_hasher.device_hasher(has_nulls), row_hashes);
+  auto const row_comp = cudf::experimental::row::equality::self_comparator(preprocessed_input);
 
   auto reduction_results = rmm::device_uvector<OutputType>(num_rows, stream, mr);
   thrust::uninitialized_fill(
@@ -60,6 +60,18 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::cuda_stream_view stream,
                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::from_dlpack_view
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @copydoc cudf::to_dlpack(std::unique_ptr<column>, rmm::cuda_stream_view, rmm::cuda_stream_view)
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           rmm::cuda_stream_view consumer_stream,
+                           rmm::cuda_stream_view stream);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -128,10 +140,11 @@ std::shared_ptr<arrow::Scalar> to_arrow(cudf::scalar const& input,
                                         rmm::cuda_stream_view stream,
                                         arrow::MemoryPool* ar_mr);
 /**
- * @copydoc cudf::from_arrow(arrow::Table const& input_table, rmm::cuda_stream_view stream,
- * rmm::device_async_resource_ref mr)
+ * @copydoc cudf::from_arrow(arrow::Table const& input, arrow_host_buffer_policy policy,
+ * rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
  */
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
+                                  arrow_host_buffer_policy policy,
                                   rmm::cuda_stream_view stream,
                                   rmm::device_async_resource_ref mr);
 
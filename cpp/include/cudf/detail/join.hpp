@@ -31,12 +31,18 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <tuple>
 
 // Forward declaration
 namespace cudf::experimental::row::equality {
 class preprocessed_table;
 }
 
+// Forward declaration
+namespace cudf {
+class join_bloom_filter;
+}
+
 namespace cudf {
 namespace detail {
 
@@ -80,6 +86,11 @@ struct hash_join {
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
     _preprocessed_build;  ///< input table preprocssed for row operators
   map_type _hash_table;   ///< hash table built on `_build`
+  rmm::device_uvector<hash_value_type>
+    _heavy_hitter_hashes;  ///< row hashes of the build keys with many rows (heavy hitters)
+  rmm::device_uvector<size_type> _heavy_hitter_keys;     ///< a build row of each heavy hitter
+  rmm::device_uvector<size_type> _heavy_hitter_offsets;  ///< offsets of the heavy hitter rows
+  rmm::device_uvector<size_type> _heavy_hitter_rows;     ///< build rows of each heavy hitter
 
  public:
   /**
@@ -108,6 +119,18 @@ struct hash_join {
              rmm::cuda_stream_view stream,
              rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @copydoc cudf::hash_join::inner_join_chunk
+   */
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  inner_join_chunk(cudf::table_view const& probe,
+                   size_type probe_row_begin,
+                   std::size_t max_output_size,
+                   rmm::cuda_stream_view stream,
+                   rmm::device_async_resource_ref mr) const;
+
   /**
    * @copydoc cudf::hash_join::left_join
    */
@@ -128,6 +151,28 @@ struct hash_join {
             rmm::cuda_stream_view stream,
             rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @copydoc cudf::hash_join::inner_join_and_gather
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> inner_join_and_gather(
+    cudf::table_view const& probe,
+    cudf::table_view const& probe_columns,
+    cudf::table_view const& build_columns,
+    std::optional<std::size_t> output_size,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::hash_join::left_join_and_gather
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> left_join_and_gather(
+    cudf::table_view const& probe,
+    cudf::table_view const& probe_columns,
+    cudf::table_view const& build_columns,
+    std::optional<std::size_t> output_size,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
   /**
    * @copydoc cudf::hash_join::inner_join_size
    */
@@ -147,6 +192,30 @@ struct hash_join {
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @copydoc cudf::hash_join::bloom_filter
+   */
+  [[nodiscard]] std::unique_ptr<join_bloom_filter> bloom_filter(
+    double false_positive_rate,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::hash_join::left_semi_join
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::hash_join::left_anti_join
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
  private:
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
@@ -172,6 +241,19 @@ struct hash_join {
                      rmm::cuda_stream_view stream,
                      rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @brief Returns the exact size of the inner or left join of `probe_table` with `_build`
+   *
+   * @param probe_table Table of probe side columns to join.
+   * @param join The type of join to be performed; one of `INNER_JOIN` and `LEFT_JOIN`.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The exact size of the output of the join operation.
+   */
+  [[nodiscard]] std::size_t compute_join_size(cudf::table_view const& probe_table,
+                                              join_kind join,
+                                              rmm::cuda_stream_view stream) const;
+
   /**
    * @copydoc cudf::detail::hash_join::probe_join_indices
    *
@@ -186,6 +268,46 @@ struct hash_join {
                     std::optional<std::size_t> output_size,
                     rmm::cuda_stream_view stream,
                     rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @brief Returns the rows of `probe_columns` and `build_columns` gathered by the output rows of
+   * the inner or left join of `probe` with `_build`
+   *
+   * @param probe The probe table.
+   * @param join The type of join to be performed; one of `INNER_JOIN` and `LEFT_JOIN`.
+   * @param probe_columns Columns of the probe rows to gather.
+   * @param build_columns Columns of the build rows to gather.
+   * @param output_size Optional value which allows users to specify the exact output size.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned table.
+   *
+   * @return The gathered `probe_columns` followed by the gathered `build_columns`.
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> join_and_gather(
+    cudf::table_view const& probe,
+    join_kind join,
+    cudf::table_view const& probe_columns,
+    cudf::table_view const& build_columns,
+    std::optional<std::size_t> output_size,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @brief Returns the indices of the rows of `probe` that have (`LEFT_SEMI_JOIN`) or do not have
+   * (`LEFT_ANTI_JOIN`) a match in the build table
+   *
+   * @param probe The probe table
+   * @param join The type of join to be performed; one of `LEFT_SEMI_JOIN` and `LEFT_ANTI_JOIN`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector
+   *
+   * @return The probe row indices, in ascending order
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> semi_anti_join(
+    cudf::table_view const& probe,
+    join_kind join,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const;
 };
 }  // namespace detail
 }  // namespace cudf
@@ -53,6 +53,30 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::bin_counts(column_view const& input, column_view const& left_edges, inclusive
+ * left_inclusive, column_view const& right_edges, inclusive right_inclusive, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref mr)
+ */
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   inclusive left_inclusive,
+                                   column_view const& right_edges,
+                                   inclusive right_inclusive,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::bin_counts(column_view const& input, double lower, double upper, size_type
+ * num_bins, rmm::cuda_stream_view, rmm::device_async_resource_ref mr)
+ */
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   double lower,
+                                   double upper,
+                                   size_type num_bins,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr);
+
 /** @} */  // end of group
 }  // namespace detail
 }  // namespace cudf
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/utilities/memory_tracking.hpp>
+
 #include <nvtx3/nvtx3.hpp>
 
 namespace cudf {
@@ -41,6 +43,60 @@ struct libcudf_domain {
  */
 using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
 
+namespace detail {
+
+/**
+ * @brief Starts recording the memory used by the call to the named API on this thread
+ *
+ * @param name Name of the API function; must outlive the call
+ */
+void push_memory_tracking_scope(char const* name);
+
+/**
+ * @brief Ends the most recent scope started by `push_memory_tracking_scope` on this thread
+ */
+void pop_memory_tracking_scope();
+
+/**
+ * @brief Counts a host synchronization in the tracking scope of this thread
+ *
+ * Called by the helpers which wait for a stream to return device results to the host.
+ * Does nothing outside of a tracking scope.
+ */
+void record_synchronization();
+
+/**
+ * @brief Records the memory used by a libcudf API call for its lifetime
+ *
+ * Does nothing unless memory tracking is enabled when it is created.
+ * See cudf::enable_memory_tracking.
+ */
+class memory_tracking_scope {
+ public:
+  /**
+   * @brief Starts recording the memory used by the named API if tracking is enabled
+   *
+   * @param name Name of the API function
+   */
+  explicit memory_tracking_scope(char const* name) : _active{is_memory_tracking_enabled()}
+  {
+    if (_active) { push_memory_tracking_scope(name); }
+  }
+
+  ~memory_tracking_scope()
+  {
+    if (_active) { pop_memory_tracking_scope(); }
+  }
+
+  memory_tracking_scope(memory_tracking_scope const&)            = delete;
+  memory_tracking_scope& operator=(memory_tracking_scope const&) = delete;
+
+ private:
+  bool const _active;
+};
+
+}  // namespace detail
+
 }  // namespace cudf
 
 /**
@@ -50,6 +106,9 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * Uses the name of the immediately enclosing function returned by `__func__` to
  * name the range.
  *
+ * The memory used during the range is also recorded when memory tracking is enabled.
+ * See cudf::enable_memory_tracking.
+ *
  * Example:
  * ```
  * void some_function(){
@@ -58,4 +117,6 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                                                            \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain);                                         \
+  ::cudf::detail::memory_tracking_scope const cudf_memory_tracking_scope__{__func__}
@@ -38,6 +38,18 @@ std::unique_ptr<column> quantile(column_view const& input,
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::quantile_by_selection()
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> quantile_by_selection(column_view const& input,
+                                              std::vector<double> const& q,
+                                              interpolation interp,
+                                              bool exact,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::quantiles()
  *
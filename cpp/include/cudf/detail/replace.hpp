@@ -48,6 +48,15 @@ std::unique_ptr<column> replace_nulls(column_view const& input,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::replace_nulls(std::unique_ptr<column>&&, scalar const&,
+ * rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> replace_nulls(std::unique_ptr<column>&& input,
+                                      scalar const& replacement,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::replace_nulls(column_view const&, replace_policy const&,
  * rmm::device_async_resource_ref)
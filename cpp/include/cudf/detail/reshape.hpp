@@ -18,10 +18,12 @@
 
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <memory>
 
 namespace cudf {
@@ -45,5 +47,14 @@ std::unique_ptr<column> interleave_columns(table_view const& input,
                                            rmm::cuda_stream_view,
                                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::table_to_row_major
+ */
+void table_to_row_major(table_view const& input,
+                        data_type output_type,
+                        scalar const& null_fill,
+                        device_span<std::byte> output,
+                        rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace cudf
@@ -162,5 +162,30 @@ std::unique_ptr<table> stable_sort(table_view const& values,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::segmented_top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace cudf
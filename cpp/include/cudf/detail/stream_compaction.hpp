@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -61,6 +62,78 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::filter
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::make_selection(column_view const&, rmm::device_async_resource_ref)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+selection_vector make_selection(column_view const& boolean_mask,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::make_selection(table_view const&, ast::expression const&,
+ *                               rmm::device_async_resource_ref)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+selection_vector make_selection(table_view const& input,
+                                ast::expression const& predicate,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::refine_selection(selection_vector const&, column_view const&,
+ *                                 rmm::device_async_resource_ref)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+selection_vector refine_selection(selection_vector const& selection,
+                                  column_view const& boolean_mask,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::refine_selection(selection_vector const&, table_view const&,
+ *                                 ast::expression const&, rmm::device_async_resource_ref)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+selection_vector refine_selection(selection_vector const& selection,
+                                  table_view const& input,
+                                  ast::expression const& predicate,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::apply_selection
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection_vector const& selection,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::selection_to_indices
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> selection_to_indices(selection_vector const& selection,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::unique
  *
@@ -86,6 +159,22 @@ std::unique_ptr<table> distinct(table_view const& input,
                                 rmm::cuda_stream_view stream,
                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::distinct(table_view const&, std::vector<size_type> const&, column_view const&,
+ * duplicate_keep_option, null_equality, nan_equality, rmm::device_async_resource_ref)
+ *
+ * @param key_hashes Precomputed hash value of the keys of each row, or nullptr to hash the keys
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                hash_value_type const* key_hashes,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::stable_distinct
  *
@@ -111,6 +200,21 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::distinct_indices(table_view const&, column_view const&, duplicate_keep_option,
+ * null_equality, nan_equality, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ * @param row_hashes Precomputed hash value of each row, or nullptr to hash the rows
+ * @return A device_uvector containing the result indices
+ */
+rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                hash_value_type const* row_hashes,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                nan_equality nans_equal,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::unique_count(column_view const&, null_policy, nan_policy)
  *
@@ -149,5 +253,24 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal,
                                rmm::cuda_stream_view stream);
 
+/**
+ * @copydoc cudf::approx_distinct_count(table_view const&, int32_t, null_policy)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision,
+                                      null_policy null_handling,
+                                      rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::estimate_distinct_count
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> estimate_distinct_count(lists_column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace cudf
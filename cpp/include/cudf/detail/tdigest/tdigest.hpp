@@ -171,6 +171,8 @@ std::unique_ptr<scalar> make_empty_tdigest_scalar(rmm::cuda_stream_view stream,
 /**
  * @brief Generate a tdigest scalar from a set of numeric input values.
  *
+ * Very large inputs are reduced with `reduce_tdigest_buffered` to avoid sorting all the values.
+ *
  * The tdigest scalar produced is of the following structure:
  ** struct {
  *   // centroids for the digest
@@ -202,6 +204,31 @@ std::unique_ptr<scalar> reduce_tdigest(column_view const& values,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Create a tdigest scalar from a set of input values without sorting all of them.
+ *
+ * The valid values are split into buffers of `buffer_size` rows. Each buffer is sorted on its
+ * own and compressed into a tdigest, and the tdigests of all buffers are merged into the result.
+ * The result approximates the tdigest produced by `reduce_tdigest` from a full sort of the
+ * values; the min and max are exact.
+ *
+ * @param values Values used to construct the tdigest
+ * @param max_centroids Parameter controlling the level of compression of the tdigest. Higher
+ * values result in a larger, more precise tdigest.
+ * @param buffer_size Number of values in each sorted buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ *
+ * @throws std::invalid_argument if `buffer_size` is not positive
+ *
+ * @returns tdigest scalar
+ */
+std::unique_ptr<scalar> reduce_tdigest_buffered(column_view const& values,
+                                                int max_centroids,
+                                                size_type buffer_size,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
 /**
  * @brief Merges multiple tdigest columns to generate a new tdigest scalar.
  *
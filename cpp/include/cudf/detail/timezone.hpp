@@ -34,4 +34,31 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the transition table of a timezone from the process-wide cache
+ *
+ * The table is created with `make_timezone_transition_table` on the first request for the
+ * timezone on the current device, and shared by all later requests until
+ * `cudf::clear_timezone_transition_table_cache()` is called. Its device memory comes from the
+ * current device resource at the time of that first request.
+ *
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_name standard timezone name (for example, "America/Los_Angeles")
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The transition table for the given timezone
+ */
+std::shared_ptr<table const> get_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                           std::string_view timezone_name,
+                                                           rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::convert_timezone
+ */
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
 }  // namespace cudf::detail
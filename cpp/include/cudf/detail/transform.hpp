@@ -37,6 +37,18 @@ std::unique_ptr<column> transform(column_view const& input,
                                   rmm::cuda_stream_view stream,
                                   rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::null_aware_transform
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> null_aware_transform(
+  column_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::compute_column
  *
@@ -47,6 +59,18 @@ std::unique_ptr<column> compute_column(table_view const& table,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::compute_column(table_view const&,ast::expression const&,ast_evaluation,
+ * rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       ast_evaluation evaluation,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -111,5 +135,14 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::split_by_size
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<size_type> split_by_size(table_view const& t,
+                                     std::size_t target_bytes,
+                                     rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace cudf
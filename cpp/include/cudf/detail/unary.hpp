@@ -71,6 +71,15 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
                                               rmm::cuda_stream_view stream,
                                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::unary_operation(std::unique_ptr<cudf::column>&&, cudf::unary_operator,
+ * rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::unique_ptr<cudf::column> unary_operation(std::unique_ptr<cudf::column>&& input,
+                                              cudf::unary_operator op,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::is_valid
  */
@@ -86,6 +95,15 @@ std::unique_ptr<column> cast(column_view const& input,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::cast(std::unique_ptr<column>&&, data_type, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> cast(std::unique_ptr<column>&& input,
+                             data_type type,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::is_nan
  */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+
+namespace cudf::detail {
+
+/**
+ * @brief Returns true if work submitted to `stream` is being captured into a CUDA graph
+ *
+ * @param stream CUDA stream to query
+ * @return true if `stream` is capturing
+ */
+bool is_stream_capturing(rmm::cuda_stream_view stream);
+
+/**
+ * @brief Copies a host staging buffer to device memory so that the buffer may be freed on return
+ *
+ * Small buffers, and any buffer while `stream` is capturing, are copied by kernels holding the
+ * bytes of `src` as parameters, which neither synchronize `stream` nor read `src` after they
+ * are launched. Larger buffers outside of a stream capture are copied asynchronously, followed
+ * by a synchronization of `stream`.
+ *
+ * @param dst Device memory to copy to
+ * @param src Host memory to copy from
+ * @param size Number of bytes to copy
+ * @param stream CUDA stream used for the copy
+ */
+void copy_staging_buffer_to_device(void* dst,
+                                   void const* src,
+                                   std::size_t size,
+                                   rmm::cuda_stream_view stream);
+
+}  // namespace cudf::detail
@@ -122,4 +122,16 @@ cuda_stream_pool& global_cuda_stream_pool();
  */
 void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns the number of streams an operator may fork its per-column work onto
+ *
+ * Operators processing many columns, such as gathering the rows of a wide table, launch
+ * small kernels for each column. Running the columns on several streams lets these kernels
+ * overlap. This is disabled by default and is enabled by setting the environment variable
+ * `LIBCUDF_OPERATOR_STREAMS` to the number of streams to use.
+ *
+ * @return The number of streams to use, or 1 if per-column work should not be forked
+ */
+[[nodiscard]] std::size_t operator_stream_count();
+
 }  // namespace cudf::detail
@@ -21,6 +21,7 @@
  * @file vector_factories.hpp
  */
 
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -77,6 +78,7 @@ rmm::device_uvector<T> make_zeroed_device_uvector_sync(std::size_t size,
   rmm::device_uvector<T> ret(size, stream, mr);
   CUDF_CUDA_TRY(cudaMemsetAsync(ret.data(), 0, size * sizeof(T), stream.value()));
   stream.synchronize();
+  record_synchronization();
   return ret;
 }
 
@@ -198,6 +200,7 @@ rmm::device_uvector<T> make_device_uvector_sync(host_span<T const> source_data,
 {
   auto ret = make_device_uvector_async(source_data, stream, mr);
   stream.synchronize();
+  record_synchronization();
   return ret;
 }
 
@@ -243,6 +246,7 @@ rmm::device_uvector<T> make_device_uvector_sync(device_span<T const> source_data
 {
   auto ret = make_device_uvector_async(source_data, stream, mr);
   stream.synchronize();
+  record_synchronization();
   return ret;
 }
 
@@ -334,6 +338,7 @@ std::vector<T> make_std_vector_sync(device_span<T const> v, rmm::cuda_stream_vie
 {
   auto result = make_std_vector_async(v, stream);
   stream.synchronize();
+  record_synchronization();
   return result;
 }
 
@@ -414,6 +419,7 @@ thrust::host_vector<T> make_host_vector_sync(device_span<T const> v, rmm::cuda_s
 {
   auto result = make_host_vector_async(v, stream);
   stream.synchronize();
+  record_synchronization();
   return result;
 }
 
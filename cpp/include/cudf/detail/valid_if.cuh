@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
@@ -110,6 +111,7 @@ std::pair<rmm::device_buffer, size_type> valid_if(InputIterator begin,
       static_cast<bitmask_type*>(null_mask.data()), begin, size, p, valid_count.data());
 
     null_count = size - valid_count.value(stream);
+    record_synchronization();
   }
   return std::pair(std::move(null_mask), null_count);
 }
@@ -23,6 +23,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <functional>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -76,6 +78,16 @@ std::unique_ptr<column> decode(dictionary_column_view const& dictionary_column,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::dictionary::transform_distinct
+ */
+std::unique_ptr<column> transform_distinct(
+  column_view const& input,
+  std::function<std::unique_ptr<column>(column_view const&)> const& op,
+  bool keep_encoded,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @brief Return minimal integer type for the given number of elements.
  *
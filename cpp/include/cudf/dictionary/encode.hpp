@@ -22,6 +22,9 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <functional>
+#include <memory>
+
 namespace cudf {
 namespace dictionary {
 /**
@@ -84,6 +87,43 @@ std::unique_ptr<column> decode(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply an operation to the distinct values of a column only
+ *
+ * The input is dictionary encoded and `op` is called once with the keys column.
+ * This is useful for expensive operations on columns with many duplicate values.
+ * The result of `op` must have one row for each key in the same order.
+ *
+ * If `keep_encoded` is false, the results are gathered back into a column with
+ * one row per input row. Otherwise, the output is a DICTIONARY column built from
+ * the results and the input indices so the duplicates are never materialized.
+ *
+ * Null input rows are null in the output. Null rows returned by `op` are also
+ * null in the output. A DICTIONARY input is used as is without encoding it again.
+ *
+ * @code{.pseudo}
+ * c = ["AA", "bb", "AA", null, "bb"]
+ * r = transform_distinct(c, to_lower)
+ * to_lower is called with ["AA", "bb"]
+ * r is now ["aa", "bb", "aa", null, "bb"]
+ * @endcode
+ *
+ * @throw std::invalid_argument if `op` does not return one row per key
+ *
+ * @param input Column to transform
+ * @param op Operation to apply to the distinct values
+ * @param keep_encoded True to return a DICTIONARY column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with the results of `op` for each input row
+ */
+std::unique_ptr<column> transform_distinct(
+  column_view const& input,
+  std::function<std::unique_ptr<column>(column_view const&)> const& op,
+  bool keep_encoded                 = false,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace dictionary
 }  // namespace cudf
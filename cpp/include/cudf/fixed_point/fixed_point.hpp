@@ -106,6 +106,65 @@ CUDF_HOST_DEVICE inline Rep ipow(T exponent)
   return square * extra;
 }
 
+/**
+ * @brief Returns true if `value` is a 128-bit integer which can be narrowed to a 64-bit integer
+ * without changing the result of a division
+ *
+ * The minimum 64-bit value is excluded since dividing it by -1 overflows in 64 bits.
+ *
+ * @tparam T Type of the integer
+ * @param value The integer to check
+ * @return true if `T` is `__int128_t` and `value` is within the range of `int64_t`
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline constexpr bool is_narrowable_to_int64(T const& value)
+{
+  if constexpr (cuda::std::is_same_v<T, __int128_t>) {
+    return value > cuda::std::numeric_limits<int64_t>::min() &&
+           value <= cuda::std::numeric_limits<int64_t>::max();
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Divides two integers, using 64-bit division for 128-bit integers that fit in 64 bits
+ *
+ * 128-bit division is a long software routine on the GPU, while most `decimal128` values fit
+ * in 64 bits. The result is the same as `lhs / rhs`.
+ *
+ * @tparam T Type of the integers
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @return `lhs / rhs`
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline constexpr T divide(T const& lhs, T const& rhs)
+{
+  if (is_narrowable_to_int64(lhs) && is_narrowable_to_int64(rhs)) {
+    return static_cast<T>(static_cast<int64_t>(lhs) / static_cast<int64_t>(rhs));
+  }
+  return lhs / rhs;
+}
+
+/**
+ * @brief Computes the remainder of two integers, using 64-bit arithmetic for 128-bit integers
+ * that fit in 64 bits
+ *
+ * @tparam T Type of the integers
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @return `lhs % rhs`
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline constexpr T remainder(T const& lhs, T const& rhs)
+{
+  if (is_narrowable_to_int64(lhs) && is_narrowable_to_int64(rhs)) {
+    return static_cast<T>(static_cast<int64_t>(lhs) % static_cast<int64_t>(rhs));
+  }
+  return lhs % rhs;
+}
+
 /** @brief Function that performs a `right shift` scale "times" on the `val`
  *
  * Note: perform this operation when constructing with positive scale
@@ -120,7 +179,7 @@ CUDF_HOST_DEVICE inline Rep ipow(T exponent)
 template <typename Rep, Radix Rad, typename T>
 CUDF_HOST_DEVICE inline constexpr T right_shift(T const& val, scale_type const& scale)
 {
-  return val / ipow<Rep, Rad>(static_cast<int32_t>(scale));
+  return divide(val, static_cast<T>(ipow<Rep, Rad>(static_cast<int32_t>(scale))));
 }
 
 /** @brief Function that performs a `left shift` scale "times" on the `val`
@@ -727,7 +786,8 @@ CUDF_HOST_DEVICE inline fixed_point<Rep1, Rad1> operator/(fixed_point<Rep1, Rad1
 #endif
 
   return fixed_point<Rep1, Rad1>{
-    scaled_integer<Rep1>(lhs._value / rhs._value, scale_type{lhs._scale - rhs._scale})};
+    scaled_integer<Rep1>(detail::divide(lhs._value, rhs._value),
+                         scale_type{lhs._scale - rhs._scale})};
 }
 
 // EQUALITY COMPARISON Operation
@@ -790,7 +850,8 @@ CUDF_HOST_DEVICE inline fixed_point<Rep1, Rad1> operator%(fixed_point<Rep1, Rad1
                                                           fixed_point<Rep1, Rad1> const& rhs)
 {
   auto const scale     = std::min(lhs._scale, rhs._scale);
-  auto const remainder = lhs.rescaled(scale)._value % rhs.rescaled(scale)._value;
+  auto const remainder =
+    detail::remainder(lhs.rescaled(scale)._value, rhs.rescaled(scale)._value);
   return fixed_point<Rep1, Rad1>{scaled_integer<Rep1>{remainder, scale}};
 }
 
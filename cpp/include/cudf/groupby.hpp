@@ -21,12 +21,14 @@
 #include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -196,6 +198,38 @@ class groupby {
     host_span<aggregation_request const> requests,
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Performs grouped aggregations on the specified values within a device memory budget.
+   *
+   * The results are those of `aggregate`, but when the rows of the keys and values with the
+   * working memory of their groupby exceed `device_memory_budget` bytes, the rows are
+   * hash-partitioned on the keys into buckets that fit the budget. The rows of each bucket are
+   * spilled to pinned host memory, and the buckets are then copied back and aggregated one at a
+   * time, so that the groups of only one bucket are in device memory at once. The results of the
+   * buckets are concatenated, so that they must fit in device memory.
+   *
+   * The order of the rows in the group labels is arbitrary.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   * @throws std::invalid_argument If `device_memory_budget` is zero.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param device_memory_budget The device memory in bytes the aggregation of a bucket may use
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_out_of_core(
+    host_span<aggregation_request const> requests,
+    std::size_t device_memory_budget,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Performs grouped scans on the specified values.
    *
@@ -413,11 +447,105 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr);
 
+  // Hash-based groupby of the aggregations that support it and sort-based groupby of the others
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> split_aggregate(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr);
+
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> sort_scan(
     host_span<scan_request const> requests,
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr);
 };
+
+/**
+ * @brief Groups the rows of batches of keys and aggregates the values of each group across all
+ * the batches
+ *
+ * The unique keys of the batches and the partial results of the aggregations of their groups
+ * are kept on the device. Each batch passed to `update` is aggregated on its own and its partial
+ * results are then merged with those of the groups of the previous batches, so that the rows of
+ * previous batches are never aggregated again. `results` finalizes the partial results.
+ *
+ * The supported aggregations are SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, MEAN, M2,
+ * COLLECT_LIST, COLLECT_SET and TDIGEST.
+ *
+ * @code{.pseudo}
+ * aggregations = [SUM, MAX]
+ * sgb = streaming_groupby(aggregations)
+ *
+ * sgb.update(keys: [1, 2, 1], values: {[1, 2, 3], [1, 2, 3]})
+ * sgb.update(keys: [2, 3], values: {[4, 5], [4, 5]})
+ * sgb.results() = (keys: [1, 2, 3], results: {[4, 6, 5], [3, 4, 5]})
+ * @endcode
+ *
+ * The groups of the results are in an unspecified order.
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby() = delete;
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&)            = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+
+  /**
+   * @brief Construct a streaming groupby object to aggregate the values of batches
+   *
+   * @throws std::invalid_argument if an aggregation is not supported
+   *
+   * @param aggregations The aggregation of each column of the values of the batches
+   * @param include_null_keys Indicates whether rows in keys that contain NULL values should be
+   * included
+   */
+  explicit streaming_groupby(std::vector<std::unique_ptr<groupby_aggregation>>&& aggregations,
+                             null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch of keys and values into the partial results of the groups
+   *
+   * @throws cudf::logic_error if `keys` and `values` have different numbers of rows, or if the
+   * number of columns of `values` is not the number of aggregations
+   * @throws cudf::data_type_error if the types of the batch differ from those of previous batches
+   *
+   * @param keys The keys of the rows of the batch
+   * @param values The values of the rows of the batch, each aggregated by the aggregation of the
+   * same index
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void update(table_view const& keys,
+              table_view const& values,
+              rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the unique keys of all the batches and the aggregation results of their groups
+   *
+   * @throws cudf::logic_error if no batch has been aggregated
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory
+   * @return Pair containing a table of the unique keys and the result of each aggregation
+   */
+  std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> results(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of groups of the batches aggregated so far
+   *
+   * @return The number of groups
+   */
+  [[nodiscard]] size_type num_groups() const;
+
+ private:
+  std::vector<std::unique_ptr<groupby_aggregation>> _aggregations;  ///< Aggregation of each column
+  null_policy _include_null_keys;                                   ///< Include keys with NULLs
+  std::vector<data_type> _value_types;                              ///< Types of the values
+  std::unique_ptr<table> _keys;                                     ///< Unique keys of the batches
+  std::vector<std::unique_ptr<table>> _partial_results;             ///< Partial results
+};
+
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
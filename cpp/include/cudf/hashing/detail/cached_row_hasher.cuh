@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <stdexcept>
+
+namespace cudf::hashing::detail {
+
+/**
+ * @brief Row hasher that returns precomputed hash values when they are provided
+ *
+ * Operations on the same keys can share one set of row hash values, for example
+ * from `cudf::hashing::murmurhash3_x86_32`, instead of hashing every row again.
+ * When no values are provided, the wrapped row hasher is called.
+ *
+ * Keeping both cases in one type avoids instantiating the hash table code twice.
+ *
+ * @tparam Hasher Device row hasher accepting a row index
+ */
+template <typename Hasher>
+struct cached_row_hasher {
+  Hasher hasher;                    ///< hasher called when there are no precomputed values
+  hash_value_type const* d_hashes;  ///< precomputed hash of each row or nullptr
+
+  __device__ hash_value_type operator()(size_type idx) const noexcept
+  {
+    return d_hashes != nullptr ? d_hashes[idx] : static_cast<hash_value_type>(hasher(idx));
+  }
+};
+
+/**
+ * @brief Creates a cached_row_hasher
+ *
+ * @param hasher Device row hasher called when `d_hashes` is nullptr
+ * @param d_hashes Precomputed hash value of each row or nullptr
+ * @return The row hasher
+ */
+template <typename Hasher>
+cached_row_hasher<Hasher> make_cached_row_hasher(Hasher const& hasher,
+                                                 hash_value_type const* d_hashes)
+{
+  return cached_row_hasher<Hasher>{hasher, d_hashes};
+}
+
+/**
+ * @brief Checks that a column holds precomputed row hash values for a table
+ *
+ * @throw std::invalid_argument if `row_hashes` is not a UINT32 column without nulls
+ *        with one value per row
+ *
+ * @param row_hashes Precomputed hash value of each row
+ * @param num_rows Number of rows in the hashed table
+ */
+inline void expects_row_hashes(column_view const& row_hashes, size_type num_rows)
+{
+  CUDF_EXPECTS(row_hashes.type().id() == type_to_id<hash_value_type>(),
+               "Row hashes must be a UINT32 column",
+               std::invalid_argument);
+  CUDF_EXPECTS(row_hashes.size() == num_rows,
+               "Row hashes must have one value per row",
+               std::invalid_argument);
+  CUDF_EXPECTS(
+    !row_hashes.has_nulls(), "Row hashes must not contain nulls", std::invalid_argument);
+}
+
+}  // namespace cudf::hashing::detail
@@ -36,8 +36,10 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 struct DLManagedTensor;
@@ -96,6 +98,53 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief View a DLPack DLTensor as a cudf table without copying its data
+ *
+ * The tensor must be readable by the current device: its `device_type` must be `kDLCUDA`,
+ * `kDLCUDAHost` or `kDLCUDAManaged` and its `device_id` must match the current device. Like
+ * `from_dlpack`, it must be 1D or 2D column-major with a unit stride along its first dimension,
+ * and its `dtype` must have 1 lane and a bitsize matching a supported `cudf::data_type`.
+ *
+ * Each column of the returned view points into the tensor data and has no null mask. A validity
+ * mask held elsewhere can be attached by constructing a `column_view` with it over the same data.
+ *
+ * @note The view does not own the tensor data. The managed tensor must not be deleted while the
+ * view or any view derived from it is in use. Any work writing the tensor must be ordered before
+ * the streams reading the view.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported
+ * @throw std::overflow_error if a dimension of the tensor exceeds the column size limit
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ * @return View of the tensor data as a table
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor without copying its data
+ *
+ * The returned tensor takes ownership of the data buffer of `input`, which must be numeric and
+ * have a null count of zero; its null mask, if any, is released with the rest of the column.
+ *
+ * The tensor follows the DLPack stream semantics: the work on `stream` is ordered before any work
+ * later submitted to `consumer_stream`, without blocking the host.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory of the tensor.
+ *
+ * @throw std::invalid_argument if `input` is null
+ * @throw cudf::logic_error if the column is not numeric or has nulls
+ *
+ * @param input Column to convert to DLPack
+ * @param consumer_stream Stream on which the tensor will be used
+ * @param stream CUDA stream on which the column was produced
+ * @return 1D DLPack tensor owning the column data
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           rmm::cuda_stream_view consumer_stream = cudf::get_default_stream(),
+                           rmm::cuda_stream_view stream          = cudf::get_default_stream());
+
 /** @} */  // end of group
 
 /**
@@ -182,6 +231,30 @@ using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
  */
 using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
 
+/**
+ * @brief Whether a conversion between cudf and Arrow device data may copy data
+ *
+ * Most types share their layout between cudf and Arrow and are always exchanged zero-copy.
+ * The remaining ones (BOOL8, and DECIMAL32 and DECIMAL64 going to Arrow) are converted into
+ * newly allocated buffers unless `ZERO_COPY_ONLY` is requested, in which case the conversion
+ * throws instead.
+ */
+enum class arrow_copy_policy : bool {
+  ALLOW_COPY,     ///< Copy the columns whose layout differs between cudf and Arrow
+  ZERO_COPY_ONLY  ///< Throw `cudf::data_type_error` if any column would have to be copied
+};
+
+/**
+ * @brief How `from_arrow` moves host-resident Arrow buffers to the device
+ *
+ * Either way all buffers of the table are uploaded together up front rather than column by
+ * column from pageable memory.
+ */
+enum class arrow_host_buffer_policy : bool {
+  STAGE_PINNED,  ///< Gather the buffers into one pinned staging buffer and upload it in one copy
+  REGISTER       ///< Page-lock the Arrow buffers in place and copy each directly to the device
+};
+
 /**
  * @brief Create ArrowSchema from cudf table and metadata
  *
@@ -280,6 +353,8 @@ unique_device_array_t to_arrow_device(
  * - DECIMAL32 and DECIMAL64: Converted to Arrow decimal128
  * - STRING: Arrow expects a single value int32 offset child array for empty strings columns
  *
+ * Strings columns with 64-bit offsets are exported as Arrow large strings without copying.
+ *
  * @param table Input table
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used for any allocations during conversion
@@ -312,6 +387,8 @@ unique_device_array_t to_arrow_device(
  * - DECIMAL32 and DECIMAL64: Converted to Arrow decimal128
  * - STRING: Arrow expects a single value int32 offset child array for empty strings columns
  *
+ * Strings columns with 64-bit offsets are exported as Arrow large strings without copying.
+ *
  * @param col Input column
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used for any allocations during conversion
@@ -322,16 +399,79 @@ unique_device_array_t to_arrow_device(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create `ArrowDeviceArray` from a table view with an explicit copy policy
+ *
+ * Identical to `to_arrow_device(cudf::table_view const&, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)` except that `policy` controls whether columns whose layout
+ * differs from Arrow may be copied.
+ *
+ * @throws cudf::data_type_error if `policy` is `ZERO_COPY_ONLY` and a column requires a copy
+ *
+ * @param table Input table
+ * @param policy Whether columns may be copied
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used for any allocations during conversion
+ * @return ArrowDeviceArray which will have ownership of any copied data
+ */
+unique_device_array_t to_arrow_device(
+  cudf::table_view const& table,
+  arrow_copy_policy policy,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create `ArrowDeviceArray` from a column view with an explicit copy policy
+ *
+ * Identical to `to_arrow_device(cudf::column_view const&, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)` except that `policy` controls whether columns whose layout
+ * differs from Arrow may be copied.
+ *
+ * @throws cudf::data_type_error if `policy` is `ZERO_COPY_ONLY` and the column requires a copy
+ *
+ * @param col Input column
+ * @param policy Whether columns may be copied
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used for any allocations during conversion
+ * @return ArrowDeviceArray which will have ownership of any copied data
+ */
+unique_device_array_t to_arrow_device(
+  cudf::column_view const& col,
+  arrow_copy_policy policy,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create `cudf::table` from given arrow Table input
  *
+ * Host buffers are uploaded through pinned staging memory, see
+ * `arrow_host_buffer_policy::STAGE_PINNED`.
+ *
+ * @param input arrow:Table that needs to be converted to `cudf::table`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr    Device memory resource used to allocate `cudf::table`
+ * @return cudf table generated from given arrow Table
+ */
+std::unique_ptr<table> from_arrow(
+  arrow::Table const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create `cudf::table` from given arrow Table input with an explicit host buffer policy
+ *
+ * `REGISTER` avoids the extra host copy into staging memory at the cost of page-locking every
+ * Arrow buffer for the duration of the call, which pays off for tables with large buffers.
+ *
  * @param input arrow:Table that needs to be converted to `cudf::table`
+ * @param policy How host-resident Arrow buffers are moved to the device
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr    Device memory resource used to allocate `cudf::table`
  * @return cudf table generated from given arrow Table
  */
 std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
+  arrow_host_buffer_policy policy,
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
@@ -429,6 +569,30 @@ unique_table_view_t from_arrow_device(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create `cudf::table_view` from given `ArrowDeviceArray` and `ArrowSchema` with an
+ * explicit copy policy
+ *
+ * Identical to `from_arrow_device(ArrowSchema const*, ArrowDeviceArray const*,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)` except that `policy` controls
+ * whether columns whose layout differs from cudf may be copied.
+ *
+ * @throws cudf::data_type_error if `policy` is `ZERO_COPY_ONLY` and a column requires a copy
+ *
+ * @param schema `ArrowSchema` pointer to object describing the type of the device array
+ * @param input `ArrowDeviceArray` pointer to object owning the Arrow data
+ * @param policy Whether columns may be copied
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to perform any allocations
+ * @return `cudf::table_view` generated from given Arrow data
+ */
+unique_table_view_t from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  arrow_copy_policy policy,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief typedef for a unique_ptr to a `cudf::column_view` with custom deleter
  *
@@ -472,5 +636,29 @@ unique_column_view_t from_arrow_device_column(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create `cudf::column_view` from given `ArrowDeviceArray` and `ArrowSchema` with an
+ * explicit copy policy
+ *
+ * Identical to `from_arrow_device_column(ArrowSchema const*, ArrowDeviceArray const*,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)` except that `policy` controls
+ * whether columns whose layout differs from cudf may be copied.
+ *
+ * @throws cudf::data_type_error if `policy` is `ZERO_COPY_ONLY` and the column requires a copy
+ *
+ * @param schema `ArrowSchema` pointer to object describing the type of the device array
+ * @param input `ArrowDeviceArray` pointer to object owning the Arrow data
+ * @param policy Whether columns may be copied
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to perform any allocations
+ * @return `cudf::column_view` generated from given Arrow data
+ */
+unique_column_view_t from_arrow_device_column(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  arrow_copy_policy policy,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/interop.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+
+struct ArrowDeviceArrayStream;
+
+namespace cudf {
+/**
+ * @addtogroup interop_arrow
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Export a chunked Parquet reader as an Arrow C device stream
+ *
+ * Populates `out` with an `ArrowDeviceArrayStream` that yields one `ArrowDeviceArray` per chunk
+ * returned by `reader`. The first chunk is read eagerly so that the schema, including the column
+ * names from the file, is available before any array is requested. Subsequent chunks are only
+ * read when the consumer calls `get_next`, so at most one chunk is resident at a time beyond
+ * those still held by the consumer.
+ *
+ * Each array is produced by `to_arrow_device(cudf::table&&)` and owns its device memory; the
+ * consumer must call its release callback when done with it. The stream itself takes ownership
+ * of `reader` and must be released by the consumer.
+ *
+ * @throws std::invalid_argument if `reader` or `out` is null
+ *
+ * @param reader Chunked Parquet reader to pull batches from
+ * @param out Stream to populate
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used for any allocations during conversion
+ */
+void to_arrow_device_stream(
+  std::unique_ptr<io::chunked_parquet_reader> reader,
+  ArrowDeviceArrayStream* out,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Write every batch of an Arrow C device stream through a chunked Parquet writer
+ *
+ * Pulls arrays from `input` until the end of the stream, converting each with
+ * `from_arrow_device` and passing it to `writer.write()`. Each array is released as soon as it
+ * has been written, so the full table is never materialized. The writer is not closed.
+ *
+ * `input` is always released before this function returns, including when an exception is
+ * thrown.
+ *
+ * @throws std::invalid_argument if `input` is null or already released
+ * @throws cudf::logic_error if the producer reports an error
+ *
+ * @param input Stream to consume
+ * @param writer Chunked Parquet writer to write each batch to
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used for any allocations during conversion
+ * @return Total number of rows written
+ */
+std::size_t write_arrow_device_stream(
+  ArrowDeviceArrayStream* input,
+  io::parquet_chunked_writer& writer,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
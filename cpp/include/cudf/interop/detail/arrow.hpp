@@ -46,3 +46,23 @@ struct ArrowDeviceArray {
 };
 
 #endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
+// from Arrow C Device Stream Interface
+// https://arrow.apache.org/docs/format/CDeviceDataInterface.html#device-stream-interface
+#ifndef ARROW_C_DEVICE_STREAM_INTERFACE
+#define ARROW_C_DEVICE_STREAM_INTERFACE
+
+struct ArrowDeviceArrayStream {
+  // device type that all arrays in the stream will be allocated on
+  ArrowDeviceType device_type;
+
+  int (*get_schema)(struct ArrowDeviceArrayStream* self, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowDeviceArrayStream* self, struct ArrowDeviceArray* out);
+  const char* (*get_last_error)(struct ArrowDeviceArrayStream* self);
+  void (*release)(struct ArrowDeviceArrayStream* self);
+
+  // opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DEVICE_STREAM_INTERFACE
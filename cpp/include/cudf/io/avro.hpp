@@ -51,6 +51,8 @@ class avro_reader_options {
   size_type _skip_rows = 0;
   // Rows to read; -1 is all
   size_type _num_rows = -1;
+  // Maximum number of bytes of the source to read into device memory at a time; 0 is no limit
+  size_t _pass_read_limit = 0;
 
   /**
    * @brief Constructor from source info.
@@ -97,6 +99,13 @@ class avro_reader_options {
    */
   [[nodiscard]] size_type get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns the maximum number of bytes of the source to read into device memory at a time.
+   *
+   * @return Maximum number of bytes to read at a time; 0 is no limit
+   */
+  [[nodiscard]] size_t get_pass_read_limit() const { return _pass_read_limit; }
+
   /**
    * @brief Set names of the column to be read.
    *
@@ -118,6 +127,17 @@ class avro_reader_options {
    */
   void set_num_rows(size_type val) { _num_rows = val; }
 
+  /**
+   * @brief Sets the maximum number of bytes of the source to read into device memory at a time.
+   *
+   * The data blocks of the source are read, decompressed and decoded in passes over ranges of at
+   * most this size, which bounds the device memory used for the raw and decompressed data. A data
+   * block larger than the limit is still read in a single pass.
+   *
+   * @param val Maximum number of bytes to read at a time; 0 is no limit
+   */
+  void set_pass_read_limit(size_t val) { _pass_read_limit = val; }
+
   /**
    * @brief create avro_reader_options_builder which will build avro_reader_options.
    *
@@ -184,6 +204,18 @@ class avro_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum number of bytes of the source to read into device memory at a time.
+   *
+   * @param val Maximum number of bytes to read at a time; 0 is no limit
+   * @return this for chaining
+   */
+  avro_reader_options_builder& pass_read_limit(size_t val)
+  {
+    options._pass_read_limit = val;
+    return *this;
+  }
+
   /**
    * @brief move avro_reader_options member once it's built.
    */
@@ -44,6 +44,21 @@ namespace io {
  */
 class csv_reader_options_builder;
 
+namespace detail::csv {
+/**
+ * @brief Internal forward declaration of the chunked CSV reader.
+ */
+class chunked_reader;
+}  // namespace detail::csv
+
+/**
+ * @brief Selection of the rows from which `read_csv()` infers the column types
+ */
+enum class csv_type_inference_sampling_t {
+  HEAD,    ///< Infers the types from the first rows of the input
+  UNIFORM  ///< Infers the types from rows evenly spaced over the input
+};
+
 /**
  * @brief Settings to use for `read_csv()`.
  */
@@ -136,6 +151,10 @@ class csv_reader_options {
   bool _dayfirst = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
+  // Maximum number of rows to infer the column types from; -1 to use all rows
+  size_type _type_inference_rows = -1;
+  // Which rows to infer the column types from when not all rows are used
+  csv_type_inference_sampling_t _type_inference_sampling = csv_type_inference_sampling_t::UNIFORM;
 
   /**
    * @brief Constructor from source info.
@@ -485,6 +504,23 @@ class csv_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the maximum number of rows the column types are inferred from.
+   *
+   * @return Maximum number of rows to infer the types from, -1 if all rows are used
+   */
+  [[nodiscard]] size_type get_type_inference_rows() const { return _type_inference_rows; }
+
+  /**
+   * @brief Returns which rows the column types are inferred from when not all rows are used.
+   *
+   * @return Sampling strategy of type inference
+   */
+  [[nodiscard]] csv_type_inference_sampling_t get_type_inference_sampling() const
+  {
+    return _type_inference_sampling;
+  }
+
   /**
    * @brief Sets compression format of the source.
    *
@@ -836,6 +872,34 @@ class csv_reader_options {
    * @param type Dtype to which all timestamp column will be cast
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the maximum number of rows the column types are inferred from.
+   *
+   * Types of the columns without a user specified type are inferred from at most `rows` rows,
+   * selected as set with `set_type_inference_sampling()`. If a value of a row outside of the sample
+   * cannot be parsed as the inferred type, the types are inferred again from all rows and the data
+   * is decoded with these types, so the result is the same as when inferring from all rows.
+   *
+   * @throw cudf::logic_error if `rows` is neither positive nor -1
+   *
+   * @param rows Maximum number of rows to infer the types from, -1 to use all rows
+   */
+  void set_type_inference_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows > 0 or rows == -1, "Type inference rows must be positive or -1");
+    _type_inference_rows = rows;
+  }
+
+  /**
+   * @brief Sets which rows the column types are inferred from when not all rows are used.
+   *
+   * @param sampling Sampling strategy of type inference
+   */
+  void set_type_inference_sampling(csv_type_inference_sampling_t sampling)
+  {
+    _type_inference_sampling = sampling;
+  }
 };
 
 /**
@@ -1317,6 +1381,30 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum number of rows the column types are inferred from.
+   *
+   * @param rows Maximum number of rows to infer the types from, -1 to use all rows
+   * @return this for chaining
+   */
+  csv_reader_options_builder& type_inference_rows(size_type rows)
+  {
+    options.set_type_inference_rows(rows);
+    return *this;
+  }
+
+  /**
+   * @brief Sets which rows the column types are inferred from when not all rows are used.
+   *
+   * @param sampling Sampling strategy of type inference
+   * @return this for chaining
+   */
+  csv_reader_options_builder& type_inference_sampling(csv_type_inference_sampling_t sampling)
+  {
+    options._type_inference_sampling = sampling;
+    return *this;
+  }
+
   /**
    * @brief move csv_reader_options member once it's built.
    */
@@ -1354,6 +1442,79 @@ table_with_metadata read_csv(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class to read a CSV dataset iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * The input is parsed one byte range of `input_chunk_size` bytes at a time, so that the device
+ * memory used for reading stays bounded by the chunk size rather than by the size of the input.
+ * Rows are assigned to chunks the same way as when reading with consecutive byte ranges, so the
+ * returned tables, if concatenated in order, contain every row exactly once. The next byte range
+ * is read from the source into pinned host memory while the current one is parsed.
+ *
+ * The header, the column names, the selected columns and the data types are determined by the
+ * first chunk, which is extended until it contains at least one row; all returned tables have
+ * that schema. As with byte ranges, quoted fields must not contain row terminators.
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `csv_reader_options` parameter as in
+   * `cudf::io::read_csv()`, and an additional parameter to specify the number of input bytes to
+   * parse per chunk. Only uncompressed inputs are supported, and the options must not specify a
+   * byte range, a number of rows, or a number of rows to skip from the end.
+   *
+   * @param input_chunk_size Number of input bytes to parse per chunk, or `0` to parse the whole
+   * input at once
+   * @param options The options used to read the CSV input
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_csv_reader(
+    std::size_t input_chunk_size,
+    csv_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the rows of the next chunk of the input.
+   *
+   * An empty table will be returned if the given input is empty, or all the data in the input
+   * has been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -1392,6 +1553,8 @@ class csv_writer_options {
   std::vector<std::string> _names;
   // Quote style. Currently only MINIMAL and NONE are supported.
   quote_style _quoting = quote_style::MINIMAL;
+  // Compression of the output; GZIP, SNAPPY and ZSTD are compressed on the GPU
+  compression_type _compression = compression_type::NONE;
 
   /**
    * @brief Constructor from sink and table.
@@ -1506,6 +1669,13 @@ class csv_writer_options {
    */
   [[nodiscard]] quote_style get_quoting() const { return _quoting; }
 
+  /**
+   * @brief Returns the compression type of the output.
+   *
+   * @return The compression type of the output
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
   // Setter
   /**
    * @brief Sets optional associated column names.
@@ -1586,6 +1756,23 @@ class csv_writer_options {
                  "Only MINIMAL and NONE are supported for quoting.");
     _quoting = quoting;
   }
+
+  /**
+   * @brief Sets the compression type of the output.
+   *
+   * The output is compressed on the GPU in independently compressed blocks: a GZIP member, a
+   * Snappy framing format chunk or a Zstandard frame per block. Only NONE, GZIP, SNAPPY and ZSTD
+   * are supported.
+   *
+   * @param comp The compression type of the output
+   */
+  void set_compression(compression_type comp)
+  {
+    CUDF_EXPECTS(comp == compression_type::NONE || comp == compression_type::GZIP ||
+                   comp == compression_type::SNAPPY || comp == compression_type::ZSTD,
+                 "Only NONE, GZIP, SNAPPY and ZSTD are supported for CSV output compression.");
+    _compression = comp;
+  }
 };
 
 /**
@@ -1723,6 +1910,20 @@ class csv_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression type of the output.
+   *
+   * Only NONE, GZIP, SNAPPY and ZSTD are supported.
+   *
+   * @param comp The compression type of the output
+   * @return this for chaining
+   */
+  csv_writer_options_builder& compression(compression_type comp)
+  {
+    options.set_compression(comp);
+    return *this;
+  }
+
   /**
    * @brief move `csv_writer_options` member once it's built.
    */
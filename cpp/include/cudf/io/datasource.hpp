@@ -24,6 +24,7 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -171,6 +172,35 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief A range of bytes to read from the source.
+   */
+  struct read_range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
+  /// Default maximum gap between ranges that are merged into a single read
+  static constexpr size_t default_read_coalesce_gap = 64 * 1024;
+
+  /**
+   * @brief Reads a set of ranges into preallocated host buffers.
+   *
+   * The default implementation sorts the ranges by offset and merges ranges that are separated
+   * by at most `max_gap` bytes into a single `host_read()` call, discarding the bytes in between.
+   * Sources backed by storage with high per-request latency benefit most from this; they can
+   * override it to issue the reads in a single vectored request instead.
+   *
+   * @param ranges Ranges to read
+   * @param dsts Address of the existing host memory for each range
+   * @param max_gap Maximum number of bytes between two ranges that are read with a single request
+   *
+   * @return The number of bytes read for each range (can be smaller than the range size)
+   */
+  virtual std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                               host_span<uint8_t* const> dsts,
+                                               size_t max_gap = default_read_coalesce_gap);
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -16,11 +16,21 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/csv.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <array>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -41,6 +51,71 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Class to read a CSV dataset chunk by chunk.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+   *
+   * @param source Input `datasource` object to read the dataset from
+   */
+  explicit chunked_reader(std::size_t input_chunk_size,
+                          std::unique_ptr<cudf::io::datasource>&& source,
+                          csv_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @brief Destructor, waiting for the pending read of the next chunk.
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  /**
+   * @brief Returns the options used to read the given byte range of the input.
+   */
+  [[nodiscard]] csv_reader_options chunk_options(std::size_t offset, std::size_t size) const;
+
+  /**
+   * @brief Starts reading the byte range of the chunk at `_offset` into the spare host buffer.
+   */
+  void prefetch_next_chunk();
+
+  std::unique_ptr<cudf::io::datasource> _source;
+  csv_reader_options _options;
+  std::size_t _input_chunk_size;
+  std::size_t _offset          = 0;
+  std::size_t _num_chunks_read = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+
+  // Double buffer of the input; the next chunk is read into one while the other one is parsed
+  std::array<cudf::detail::pinned_host_vector<uint8_t>, 2> _host_buffers;
+  std::size_t _prefetch_buffer = 0;
+  std::size_t _prefetch_offset = 0;
+  std::future<std::size_t> _prefetch;
+
+  // Schema of the first chunk: file indexes, names and types of the columns that are read
+  std::vector<int> _column_indexes;
+  std::vector<std::string> _column_names;
+  std::map<std::string, data_type> _column_types;
+  // Empty columns with the schema of the first chunk, and their names
+  std::unique_ptr<table> _schema_columns;
+  table_metadata _schema_metadata;
+};
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
@@ -18,10 +18,14 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace cudf::io::json::detail {
 
 /**
@@ -39,6 +43,53 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @brief The reader class that reads JSON Lines data sources iteratively, one byte range at a time.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @copydoc cudf::io::chunked_json_reader::chunked_json_reader
+   *
+   * @param sources Input `datasource` objects to read the dataset from
+   */
+  explicit chunked_reader(std::size_t input_chunk_size,
+                          std::vector<std::unique_ptr<datasource>>&& sources,
+                          json_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  /**
+   * @brief Reorders the columns of a chunk to match the schema of the first chunk, filling the
+   * missing columns with nulls.
+   */
+  table_with_metadata conform_to_schema(table_with_metadata&& chunk);
+
+  std::vector<std::unique_ptr<datasource>> _sources;
+  json_reader_options _options;
+  std::size_t _input_chunk_size;
+  std::size_t _total_size;
+  std::size_t _offset          = 0;
+  std::size_t _num_chunks_read = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+
+  // Empty columns with the schema of the first non-empty chunk, and their names
+  std::unique_ptr<table> _schema_columns;
+  table_metadata _schema_metadata;
+};
+
 /**
  * @brief Write an entire dataset to JSON format.
  *
@@ -41,6 +41,10 @@ class chunked_parquet_writer_options;
 
 namespace parquet::detail {
 
+// Forward declaration
+class aggregate_reader_metadata;
+class metadata_cache;
+
 /**
  * @brief Class to read Parquet dataset data into columns.
  */
@@ -20,11 +20,13 @@
 
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -39,6 +41,10 @@ namespace io {
 
 class json_reader_options_builder;
 
+namespace json::detail {
+class chunked_reader;
+}  // namespace json::detail
+
 /**
  * @brief Allows specifying the target types for nested JSON data via json_reader_options'
  * `set_dtypes` method.
@@ -105,6 +111,8 @@ class json_reader_options {
   char _delimiter = '\n';
   // Prune columns on read, selected based on the _dtypes option
   bool _prune_columns = false;
+  // Paths of the columns to read; empty to read all columns
+  std::vector<std::string> _columns;
 
   // Bytes to skip from the start
   size_t _byte_range_offset = 0;
@@ -263,6 +271,13 @@ class json_reader_options {
    */
   bool is_enabled_prune_columns() const { return _prune_columns; }
 
+  /**
+   * @brief Returns the paths of the columns to read.
+   *
+   * @return Paths of the columns to read; empty if all columns are read
+   */
+  [[nodiscard]] std::vector<std::string> const& get_columns() const { return _columns; }
+
   /**
    * @brief Whether to parse dates as DD/MM versus MM/DD.
    *
@@ -399,6 +414,22 @@ class json_reader_options {
    */
   void enable_prune_columns(bool val) { _prune_columns = val; }
 
+  /**
+   * @brief Sets the paths of the columns to read.
+   *
+   * A path is the dot-separated list of field names that leads to a column, e.g. "a.b" selects
+   * the child "b" of the struct column "a". List levels are transparent, so "l.b" selects the
+   * child "b" of the structs in the list column "l". Selecting a column selects all of its
+   * children, and the parents of the selected columns are returned with only the selected children.
+   *
+   * Columns that are not selected are dropped while building the column tree, so no memory is
+   * allocated for them and their values are not parsed. If column pruning is also enabled, a
+   * column is returned only if it is both selected and present in @ref set_dtypes.
+   *
+   * @param columns Paths of the columns to read; empty to read all columns
+   */
+  void set_columns(std::vector<std::string> columns) { _columns = std::move(columns); }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -593,6 +624,20 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the paths of the columns to read.
+   *
+   * @see json_reader_options::set_columns
+   *
+   * @param columns Paths of the columns to read; empty to read all columns
+   * @return this for chaining
+   */
+  json_reader_options_builder& columns(std::vector<std::string> columns)
+  {
+    options._columns = std::move(columns);
+    return *this;
+  }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -707,6 +752,78 @@ table_with_metadata read_json(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked JSON reader class to read a JSON Lines dataset iteratively into a series of
+ * tables, chunk by chunk.
+ *
+ * The input is parsed one byte range of `input_chunk_size` bytes at a time, so that the device
+ * memory used for reading stays bounded by the chunk size rather than by the size of the input.
+ * Records are assigned to chunks the same way as when reading with consecutive byte ranges, so the
+ * returned tables, if concatenated in order, contain every record exactly once.
+ *
+ * All returned tables have the same schema. Unless data types are specified with
+ * `json_reader_options::set_dtypes`, the schema is the one inferred from the first non-empty
+ * chunk: columns that only appear in later chunks are not returned, and columns missing from a
+ * later chunk are returned as all nulls.
+ */
+class chunked_json_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_json_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `json_reader_options` parameter as in
+   * `cudf::io::read_json()`, and an additional parameter to specify the number of input bytes to
+   * parse per chunk. Only uncompressed JSON Lines inputs without a byte range are supported.
+   *
+   * @param input_chunk_size Number of input bytes to parse per chunk, or `0` to parse the whole
+   * input at once
+   * @param options The options used to read the JSON Lines input
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_json_reader(
+    std::size_t input_chunk_size,
+    json_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_json_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the records of the next chunk of the input.
+   *
+   * An empty table will be returned if the given input is empty, or all the data in the input
+   * has been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::json::detail::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 
 /**
@@ -742,6 +859,8 @@ class json_writer_options {
   std::string _false_value = std::string{"false"};
   // Names of all columns; if empty, writer will generate column names
   std::optional<table_metadata> _metadata;  // Optional column names
+  // Compression of the output; GZIP, SNAPPY and ZSTD are compressed on the GPU
+  compression_type _compression = compression_type::NONE;
 
   /**
    * @brief Constructor from sink and table.
@@ -837,6 +956,13 @@ class json_writer_options {
    */
   [[nodiscard]] std::string const& get_false_value() const { return _false_value; }
 
+  /**
+   * @brief Returns the compression type of the output.
+   *
+   * @return The compression type of the output
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
   // Setter
 
   /**
@@ -894,6 +1020,23 @@ class json_writer_options {
    * @param val String to represent values == 0 in INT8 types
    */
   void set_false_value(std::string val) { _false_value = std::move(val); }
+
+  /**
+   * @brief Sets the compression type of the output.
+   *
+   * The output is compressed on the GPU in independently compressed blocks: a GZIP member, a
+   * Snappy framing format chunk or a Zstandard frame per block. Only NONE, GZIP, SNAPPY and ZSTD
+   * are supported.
+   *
+   * @param comp The compression type of the output
+   */
+  void set_compression(compression_type comp)
+  {
+    CUDF_EXPECTS(comp == compression_type::NONE || comp == compression_type::GZIP ||
+                   comp == compression_type::SNAPPY || comp == compression_type::ZSTD,
+                 "Only NONE, GZIP, SNAPPY and ZSTD are supported for JSON output compression.");
+    _compression = comp;
+  }
 };
 
 /**
@@ -1017,6 +1160,20 @@ class json_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression type of the output.
+   *
+   * Only NONE, GZIP, SNAPPY and ZSTD are supported.
+   *
+   * @param comp The compression type of the output
+   * @return this for chaining
+   */
+  json_writer_options_builder& compression(compression_type comp)
+  {
+    options.set_compression(comp);
+    return *this;
+  }
+
   /**
    * @brief move `json_writer_options` member once it's built.
    */
@@ -62,4 +62,27 @@ struct host_mr_options {
  */
 bool config_default_host_memory_resource(host_mr_options const& opts);
 
+/**
+ * @brief Set the threshold size for using the host memory resource for the host allocations of
+ * the readers and writers
+ *
+ * Host-side buffers of cudf::detail::hostdevice_vector and the buffers returned by
+ * `datasource::host_read` that are at most `threshold` bytes are allocated with the host memory
+ * resource (see `set_host_memory_resource`); larger buffers are allocated in pageable memory, as
+ * pinning large allocations costs more than it saves on copies to the device. The initial value
+ * is read from the `LIBCUDF_PINNED_ALLOCATION_THRESHOLD` environment variable and defaults to
+ * 16MB.
+ *
+ * @param threshold The threshold size in bytes
+ */
+void set_allocate_host_as_pinned_threshold(size_t threshold);
+
+/**
+ * @brief Get the threshold size for using the host memory resource for the host allocations of
+ * the readers and writers
+ *
+ * @return The threshold size in bytes
+ */
+size_t get_allocate_host_as_pinned_threshold();
+
 }  // namespace cudf::io
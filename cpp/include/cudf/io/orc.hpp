@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -63,6 +64,9 @@ class orc_reader_options {
   // Rows to read; `nullopt` is all
   std::optional<int64_t> _num_rows;
 
+  // Predicate filter as AST to filter output rows.
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   // Whether to use row index to speed-up reading
   bool _use_index = true;
 
@@ -74,6 +78,9 @@ class orc_reader_options {
   // Columns that should be read as Decimal128
   std::vector<std::string> _decimal128_columns;
 
+  // Optional statistics of the last chunk returned by the chunked reader
+  std::shared_ptr<reader_chunk_statistics> _chunk_stats;
+
   friend orc_reader_options_builder;
 
   /**
@@ -135,6 +142,13 @@ class orc_reader_options {
    */
   std::optional<int64_t> const& get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Whether to use row index to speed-up reading.
    *
@@ -163,6 +177,16 @@ class orc_reader_options {
    */
   std::vector<std::string> const& get_decimal128_columns() const { return _decimal128_columns; }
 
+  /**
+   * @brief Returns a shared pointer to the user-provided chunk statistics.
+   *
+   * @return Chunk statistics, or nullptr if they are not reported
+   */
+  [[nodiscard]] std::shared_ptr<reader_chunk_statistics> get_chunk_statistics() const
+  {
+    return _chunk_stats;
+  }
+
   // Setters
 
   /**
@@ -220,6 +244,20 @@ class orc_reader_options {
     _num_rows = nrows;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The filter can only reference output columns, using cudf::ast::column_reference with the index
+   * of the column in the output table. Stripes whose statistics (and row index statistics, when
+   * `use_index` is enabled) show that no row can satisfy the filter are not read, and the rows of
+   * the remaining stripes that do not satisfy the filter are removed from the output.
+   *
+   * Stripes are only pruned when neither `skip_rows` nor `num_rows` is set.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -250,6 +288,20 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Sets the pointer to the output chunk statistics.
+   *
+   * Each call to `chunked_orc_reader::read_chunk()` overwrites the statistics with those of the
+   * returned chunk. This can be used to choose the `chunk_read_limit` and `pass_read_limit` of
+   * the reader. Ignored by `read_orc()`.
+   *
+   * @param chunk_stats Pointer to chunk statistics to be updated after reading each chunk
+   */
+  void set_chunk_statistics(std::shared_ptr<reader_chunk_statistics> chunk_stats)
+  {
+    _chunk_stats = std::move(chunk_stats);
+  }
 };
 
 /**
@@ -321,6 +373,16 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc orc_reader_options::set_filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -369,6 +431,16 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc orc_reader_options::set_chunk_statistics
+   * @return this for chaining
+   */
+  orc_reader_options_builder& chunk_statistics(std::shared_ptr<reader_chunk_statistics> chunk_stats)
+  {
+    options._chunk_stats = std::move(chunk_stats);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -48,6 +48,61 @@ constexpr size_type default_max_page_fragment_size     = 5000;  ///< 5000 rows p
 
 class parquet_reader_options_builder;
 
+/**
+ * @brief Size-bounded cache of parsed Parquet file footers.
+ *
+ * A cache can be shared by any number of `parquet_reader_options`, including ones used
+ * concurrently from several threads. Readers using it look up each source by its key and skip
+ * fetching and parsing the footer (and page indexes, when available) of sources found in the
+ * cache. The least recently used entries are evicted once the total size of the cached footers
+ * exceeds the given bound.
+ */
+class parquet_metadata_cache {
+ public:
+  /**
+   * @brief Constructs an empty cache.
+   *
+   * @param max_size_bytes Upper bound on the total serialized size of the cached footers
+   */
+  explicit parquet_metadata_cache(std::size_t max_size_bytes);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~parquet_metadata_cache();
+
+  /**
+   * @brief Removes all entries from the cache.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of files whose metadata is cached.
+   *
+   * @return Number of cache entries
+   */
+  [[nodiscard]] std::size_t num_entries() const;
+
+  /**
+   * @brief Returns the total serialized size of the cached footers.
+   *
+   * @return Size of the cached footers in bytes
+   */
+  [[nodiscard]] std::size_t size_bytes() const;
+
+  /**
+   * @brief Returns the upper bound on the size of the cached footers.
+   *
+   * @return Maximum size of the cached footers in bytes
+   */
+  [[nodiscard]] std::size_t max_size_bytes() const;
+
+ private:
+  friend class parquet::detail::aggregate_reader_metadata;
+
+  std::unique_ptr<parquet::detail::metadata_cache> _impl;
+};
+
 /**
  * @brief Settings for `read_parquet()`.
  */
@@ -69,10 +124,24 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return dictionary-encoded string columns as dictionary columns
+  bool _dictionary_string_columns = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Whether to read and use ARROW schema
   bool _use_arrow_schema = true;
+  // Whether to decode the non-filter columns only for row groups with rows passing the filter
+  bool _late_materialization = false;
+  // Whether the chunked reader reads the data of the next pass while decoding the current one
+  bool _prefetch_next_pass = false;
+  // Cache of parsed footers to look up the sources in
+  std::shared_ptr<parquet_metadata_cache> _metadata_cache;
+  // Keys identifying each source in `_metadata_cache`
+  std::vector<std::string> _metadata_cache_keys;
+  // Memory resource for each output column; the read's resource is used for all if empty
+  std::vector<rmm::device_async_resource_ref> _output_memory_resources;
+  // Optional statistics of the last chunk returned by the chunked reader
+  std::shared_ptr<reader_chunk_statistics> _chunk_stats;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
@@ -121,6 +190,17 @@ class parquet_reader_options {
     return _convert_strings_to_categories;
   }
 
+  /**
+   * @brief Returns true/false depending whether dictionary-encoded string columns are returned
+   * as dictionary columns.
+   *
+   * @return `true` if dictionary-encoded string columns are returned as `DICTIONARY32` columns
+   */
+  [[nodiscard]] bool is_enabled_dictionary_string_columns() const
+  {
+    return _dictionary_string_columns;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    *
@@ -135,6 +215,62 @@ class parquet_reader_options {
    */
   [[nodiscard]] bool is_enabled_use_arrow_schema() const { return _use_arrow_schema; }
 
+  /**
+   * @brief Returns true/false depending whether late materialization is used with a filter.
+   *
+   * @return `true` if payload columns are only decoded after the filter has been evaluated
+   */
+  [[nodiscard]] bool is_enabled_late_materialization() const { return _late_materialization; }
+
+  /**
+   * @brief Returns true/false depending whether the chunked reader prefetches the next pass.
+   *
+   * @return `true` if the data of the next pass is read while the current pass is decoded
+   */
+  [[nodiscard]] bool is_enabled_prefetch_next_pass() const { return _prefetch_next_pass; }
+
+  /**
+   * @brief Returns the cache of parsed footers used by the reader.
+   *
+   * @return Metadata cache, or nullptr if footers are always parsed
+   */
+  [[nodiscard]] std::shared_ptr<parquet_metadata_cache> get_metadata_cache() const
+  {
+    return _metadata_cache;
+  }
+
+  /**
+   * @brief Returns the keys identifying each source in the metadata cache.
+   *
+   * @return Metadata cache keys; empty if they are derived from the file paths
+   */
+  [[nodiscard]] std::vector<std::string> const& get_metadata_cache_keys() const
+  {
+    return _metadata_cache_keys;
+  }
+
+  /**
+   * @brief Returns the memory resources used to allocate the output columns.
+   *
+   * @return One memory resource per output column; empty if all the output columns are
+   * allocated with the memory resource passed to the read
+   */
+  [[nodiscard]] std::vector<rmm::device_async_resource_ref> const& get_output_memory_resources()
+    const
+  {
+    return _output_memory_resources;
+  }
+
+  /**
+   * @brief Returns a shared pointer to the user-provided chunk statistics.
+   *
+   * @return Chunk statistics, or nullptr if they are not reported
+   */
+  [[nodiscard]] std::shared_ptr<reader_chunk_statistics> get_chunk_statistics() const
+  {
+    return _chunk_stats;
+  }
+
   /**
    * @brief Returns optional tree of metadata.
    *
@@ -241,6 +377,21 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning dictionary-encoded string columns as dictionary
+   * columns.
+   *
+   * When enabled, a top-level string column whose column chunks all have a dictionary page is
+   * returned as a `DICTIONARY32` column of the strings instead of a `STRING` column. This keeps
+   * low-cardinality columns compact in memory and lets downstream operations use the dictionary
+   * paths. Other string columns, and strings nested in lists or structs, are returned unchanged.
+   * The output filter, if any, is applied before the columns are encoded, and each table read
+   * by the chunked reader has its own dictionary keys.
+   *
+   * @param val Boolean value whether to return dictionary-encoded string columns as dictionaries
+   */
+  void enable_dictionary_string_columns(bool val) { _dictionary_string_columns = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -255,6 +406,101 @@ class parquet_reader_options {
    */
   void enable_use_arrow_schema(bool val) { _use_arrow_schema = val; }
 
+  /**
+   * @brief Sets to enable/disable late materialization of the columns not used by the filter.
+   *
+   * When enabled and a filter is set, the columns referenced by the filter are decoded first and
+   * the filter is evaluated on them. The remaining selected columns are then only decoded for
+   * the row groups that contain at least one row passing the filter. This can considerably
+   * reduce decode time and peak memory usage of selective filters on wide tables, at the cost
+   * of decoding the filter columns of the surviving row groups twice.
+   *
+   * Late materialization is only used by `read_parquet()` when column names are selected, the
+   * filter only references columns by name, and neither `skip_rows`, `num_rows` nor a column
+   * schema is set. The regular read path is used otherwise.
+   *
+   * @param val Boolean value whether to use late materialization
+   */
+  void enable_late_materialization(bool val) { _late_materialization = val; }
+
+  /**
+   * @brief Sets to enable/disable prefetching of the next pass in the chunked reader.
+   *
+   * When enabled and the input is read in multiple passes (see `chunked_parquet_reader` with a
+   * non-zero `pass_read_limit`), the compressed column chunks of the next pass are read on a
+   * background thread and copied to the device on a separate stream while the current pass is
+   * being decoded. This hides the I/O latency of all but the first pass, at the cost of holding
+   * the compressed data of up to two passes in device memory at the same time.
+   *
+   * This option has no effect on `read_parquet()` or when only a single pass is needed.
+   *
+   * @param val Boolean value whether to prefetch the next pass
+   */
+  void enable_prefetch_next_pass(bool val) { _prefetch_next_pass = val; }
+
+  /**
+   * @brief Sets the cache of parsed footers to use.
+   *
+   * Footers of sources found in the cache are not fetched nor parsed, and the footers of the
+   * remaining sources are added to it. Sources are identified by the keys set with
+   * `set_metadata_cache_keys()`. Without keys, file path sources are identified by their path,
+   * size and modification time, and other sources are not cached.
+   *
+   * @param cache Metadata cache, or nullptr to disable caching
+   */
+  void set_metadata_cache(std::shared_ptr<parquet_metadata_cache> cache)
+  {
+    _metadata_cache = std::move(cache);
+  }
+
+  /**
+   * @brief Sets the keys identifying each source in the metadata cache.
+   *
+   * Keys must uniquely identify the content of the source; a source modified after its footer
+   * was cached under the same key is read with stale metadata. An empty key disables caching for
+   * that source.
+   *
+   * @param keys One key per source, or an empty vector to derive keys from the file paths
+   */
+  void set_metadata_cache_keys(std::vector<std::string> keys)
+  {
+    _metadata_cache_keys = std::move(keys);
+  }
+
+  /**
+   * @brief Sets the memory resources used to allocate the output columns.
+   *
+   * The data, offsets and null masks of output column `i`, including those of its children, are
+   * decoded directly into memory allocated from `resources[i]` rather than from the memory
+   * resource passed to the read. For instance, a pipeline staging each batch into a fixed arena
+   * can pass an arena-backed resource to avoid copying the decoded columns into the arena.
+   *
+   * When a filter is set, the rows passing the filter are copied into memory allocated from the
+   * same resources. Temporary memory used during the read is still allocated from the current
+   * device resource.
+   *
+   * @param resources One memory resource per output column, in output order, or an empty vector
+   * to allocate all output columns with the memory resource passed to the read
+   */
+  void set_output_memory_resources(std::vector<rmm::device_async_resource_ref> resources)
+  {
+    _output_memory_resources = std::move(resources);
+  }
+
+  /**
+   * @brief Sets the pointer to the output chunk statistics.
+   *
+   * Each call to `chunked_parquet_reader::read_chunk()` overwrites the statistics with those of
+   * the returned chunk. This can be used to choose the `chunk_read_limit` and `pass_read_limit`
+   * of the reader. Ignored by `read_parquet()`.
+   *
+   * @param chunk_stats Pointer to chunk statistics to be updated after reading each chunk
+   */
+  void set_chunk_statistics(std::shared_ptr<reader_chunk_statistics> chunk_stats)
+  {
+    _chunk_stats = std::move(chunk_stats);
+  }
+
   /**
    * @brief Sets reader column schema.
    *
@@ -355,6 +601,16 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc parquet_reader_options::enable_dictionary_string_columns
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& dictionary_string_columns(bool val)
+  {
+    options._dictionary_string_columns = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -379,6 +635,68 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc parquet_reader_options::enable_late_materialization
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& late_materialization(bool val)
+  {
+    options._late_materialization = val;
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::enable_prefetch_next_pass
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& prefetch_next_pass(bool val)
+  {
+    options._prefetch_next_pass = val;
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::set_metadata_cache
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& metadata_cache(std::shared_ptr<parquet_metadata_cache> cache)
+  {
+    options._metadata_cache = std::move(cache);
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::set_metadata_cache_keys
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& metadata_cache_keys(std::vector<std::string> keys)
+  {
+    options._metadata_cache_keys = std::move(keys);
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::set_output_memory_resources
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& output_memory_resources(
+    std::vector<rmm::device_async_resource_ref> resources)
+  {
+    options._output_memory_resources = std::move(resources);
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::set_chunk_statistics
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& chunk_statistics(
+    std::shared_ptr<reader_chunk_statistics> chunk_stats)
+  {
+    options._chunk_stats = std::move(chunk_stats);
+    return *this;
+  }
+
   /**
    * @brief Sets reader metadata.
    *
@@ -618,6 +936,10 @@ class parquet_writer_options {
   dictionary_policy _dictionary_policy = dictionary_policy::ADAPTIVE;
   // Maximum size of column chunk dictionary (in bytes)
   size_t _max_dictionary_size = default_max_dictionary_size;
+  // Whether to estimate the cardinality of chunks before building their dictionaries
+  bool _dictionary_cardinality_estimate = false;
+  // Whether the row group size limit applies to the estimated encoded size
+  bool _encoded_row_group_size = false;
   // Maximum number of rows in a page fragment
   std::optional<size_type> _max_page_fragment_size;
   // Optional compression statistics
@@ -824,6 +1146,23 @@ class parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns `true` if chunk cardinality is estimated before building dictionaries.
+   *
+   * @return `true` if chunk cardinality is estimated before building dictionaries.
+   */
+  [[nodiscard]] auto is_enabled_dictionary_cardinality_estimate() const
+  {
+    return _dictionary_cardinality_estimate;
+  }
+
+  /**
+   * @brief Returns `true` if the row group size limit applies to the estimated encoded size.
+   *
+   * @return `true` if the row group size limit applies to the estimated encoded size.
+   */
+  [[nodiscard]] auto is_enabled_encoded_row_group_size() const { return _encoded_row_group_size; }
+
   /**
    * @brief Returns the sorting_columns.
    *
@@ -963,6 +1302,32 @@ class parquet_writer_options {
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
 
+  /**
+   * @brief Sets whether to estimate chunk cardinality before building dictionaries.
+   *
+   * When enabled, the number of distinct values of each column chunk is first estimated with a
+   * HyperLogLog sketch. Chunks for which the estimate shows that dictionary encoding would not
+   * pay off, or would exceed the dictionary limits, fall back to their non-dictionary encoding
+   * without building the dictionary hash map. This saves most of the dictionary cost for nearly
+   * unique columns, at the risk of missing a dictionary that would have been slightly smaller
+   * than the plain encoding.
+   *
+   * @param val Boolean value to enable/disable the cardinality estimate
+   */
+  void enable_dictionary_cardinality_estimate(bool val) { _dictionary_cardinality_estimate = val; }
+
+  /**
+   * @brief Sets whether the row group size limit applies to the estimated encoded size.
+   *
+   * By default, `row_group_size_bytes` is compared against the size of the input data. When
+   * enabled, row group boundaries are instead planned against an estimate of the encoded size of
+   * each column chunk, before compression. The estimate accounts for dictionary encoding based on
+   * a sketch of the number of distinct values in each column.
+   *
+   * @param val Boolean value to enable/disable encoded row group sizing
+   */
+  void enable_encoded_row_group_size(bool val) { _encoded_row_group_size = val; }
+
   /**
    * @brief Sets sorting columns.
    *
@@ -1223,6 +1588,22 @@ class parquet_writer_options_builder {
    */
   parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Set to true if chunk cardinality is to be estimated before building dictionaries.
+   *
+   * @param enabled Boolean value to enable/disable the cardinality estimate
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& dictionary_cardinality_estimate(bool enabled);
+
+  /**
+   * @brief Set to true if the row group size limit applies to the estimated encoded size.
+   *
+   * @param enabled Boolean value to enable/disable encoded row group sizing
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& encoded_row_group_size(bool enabled);
+
   /**
    * @brief Sets column sorting metadata to chunked_parquet_writer_options.
    *
@@ -1312,6 +1693,10 @@ class chunked_parquet_writer_options {
   dictionary_policy _dictionary_policy = dictionary_policy::ADAPTIVE;
   // Maximum size of column chunk dictionary (in bytes)
   size_t _max_dictionary_size = default_max_dictionary_size;
+  // Whether to estimate the cardinality of chunks before building their dictionaries
+  bool _dictionary_cardinality_estimate = false;
+  // Whether the row group size limit applies to the estimated encoded size
+  bool _encoded_row_group_size = false;
   // Maximum number of rows in a page fragment
   std::optional<size_type> _max_page_fragment_size;
   // Optional compression statistics
@@ -1474,6 +1859,23 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns `true` if chunk cardinality is estimated before building dictionaries.
+   *
+   * @return `true` if chunk cardinality is estimated before building dictionaries.
+   */
+  [[nodiscard]] auto is_enabled_dictionary_cardinality_estimate() const
+  {
+    return _dictionary_cardinality_estimate;
+  }
+
+  /**
+   * @brief Returns `true` if the row group size limit applies to the estimated encoded size.
+   *
+   * @return `true` if the row group size limit applies to the estimated encoded size.
+   */
+  [[nodiscard]] auto is_enabled_encoded_row_group_size() const { return _encoded_row_group_size; }
+
   /**
    * @brief Returns the sorting_columns.
    *
@@ -1598,6 +2000,32 @@ class chunked_parquet_writer_options {
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
 
+  /**
+   * @brief Sets whether to estimate chunk cardinality before building dictionaries.
+   *
+   * When enabled, the number of distinct values of each column chunk is first estimated with a
+   * HyperLogLog sketch. Chunks for which the estimate shows that dictionary encoding would not
+   * pay off, or would exceed the dictionary limits, fall back to their non-dictionary encoding
+   * without building the dictionary hash map. This saves most of the dictionary cost for nearly
+   * unique columns, at the risk of missing a dictionary that would have been slightly smaller
+   * than the plain encoding.
+   *
+   * @param val Boolean value to enable/disable the cardinality estimate
+   */
+  void enable_dictionary_cardinality_estimate(bool val) { _dictionary_cardinality_estimate = val; }
+
+  /**
+   * @brief Sets whether the row group size limit applies to the estimated encoded size.
+   *
+   * By default, `row_group_size_bytes` is compared against the size of the input data. When
+   * enabled, row group boundaries are instead planned against an estimate of the encoded size of
+   * each column chunk, before compression. The estimate accounts for dictionary encoding based on
+   * a sketch of the number of distinct values in each column.
+   *
+   * @param val Boolean value to enable/disable encoded row group sizing
+   */
+  void enable_encoded_row_group_size(bool val) { _encoded_row_group_size = val; }
+
   /**
    * @brief Sets sorting columns.
    *
@@ -1719,6 +2147,22 @@ class chunked_parquet_writer_options_builder {
    */
   chunked_parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Set to true if chunk cardinality is to be estimated before building dictionaries.
+   *
+   * @param enabled Boolean value to enable/disable the cardinality estimate
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& dictionary_cardinality_estimate(bool enabled);
+
+  /**
+   * @brief Set to true if the row group size limit applies to the estimated encoded size.
+   *
+   * @param enabled Boolean value to enable/disable encoded row group sizing
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& encoded_row_group_size(bool enabled);
+
   /**
    * @brief Sets the maximum row group size, in bytes.
    *
@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -89,6 +91,38 @@ std::unique_ptr<cudf::column> multibyte_split(
   parse_options options             = {},
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits the source text into a strings column using a set of delimiters.
+ *
+ * A row ends wherever any of the delimiters ends, so if several delimiters end at the same
+ * position, e.g. "\r\n" and "\n", only a single row ends there. If delimiters are stripped, the
+ * longest delimiter that ends a row is removed from it. The trie of all delimiters, i.e. the
+ * number of distinct delimiter prefixes, must contain at most 14 tokens.
+ *
+ * @code{.pseudo}
+ * Examples:
+ *  source:     "abc\r\ndef\nghi\x1ejkl"
+ *  delimiters: ["\r\n", "\n", "\x1e"]
+ *
+ *  byte_range: nullopt
+ *  return:     ["abc\r\n", "def\n", "ghi\x1e", "jkl"]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `delimiters` is empty or contains an empty delimiter
+ *
+ * @param source The source string
+ * @param delimiters UTF-8 encoded strings for which to find offsets in the source
+ * @param options the parsing options to use (including byte range)
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiters within the relevant byte
+ * range.
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  parse_options options             = {},
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 std::unique_ptr<cudf::column> multibyte_split(
   data_chunk_source const& source,
   std::string const& delimiter,
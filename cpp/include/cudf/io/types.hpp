@@ -25,6 +25,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <optional>
@@ -218,6 +219,24 @@ class writer_compression_statistics {
   std::size_t _num_compressed_output_bytes = 0;  ///< The number of bytes in the compressed output
 };
 
+/**
+ * @brief Statistics about the work done by a chunked reader to return one chunk.
+ *
+ * The work done to prepare a chunk is counted in that chunk, including the work done by the
+ * `has_next()` call preceding it. Stage times are measured on the host between points where the
+ * reader already waits for its stream, so they include the device work of the stage.
+ */
+struct reader_chunk_statistics {
+  std::size_t num_bytes_read         = 0;  ///< Bytes of column data read from the sources
+  std::size_t num_compressed_bytes   = 0;  ///< Bytes of compressed data that were decompressed
+  std::size_t num_decompressed_bytes = 0;  ///< Bytes produced by decompression
+  std::size_t num_pages_decoded      = 0;  ///< Number of Parquet pages or ORC stripes decoded
+  std::size_t peak_temp_memory_bytes = 0;  ///< Largest temporary memory estimated by the reader
+  std::chrono::nanoseconds read_time{0};        ///< Time spent waiting for data from the sources
+  std::chrono::nanoseconds decompress_time{0};  ///< Time spent decompressing
+  std::chrono::nanoseconds decode_time{0};      ///< Time spent decoding
+};
+
 /**
  * @brief Control use of dictionary encoding for parquet writer
  */
@@ -612,6 +631,7 @@ class column_in_metadata {
   std::optional<uint8_t> _decimal_precision;
   std::optional<int32_t> _parquet_field_id;
   std::optional<int32_t> _type_length;
+  std::optional<double> _bloom_filter_fpp;
   std::vector<column_in_metadata> children;
   column_encoding _encoding = column_encoding::USE_DEFAULT;
 
@@ -756,6 +776,28 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Enables writing a bloom filter for this column.
+   *
+   * The Parquet writer writes a split block bloom filter per column chunk, sized for the given
+   * false positive probability based on the number of distinct values in the chunk. Bloom filters
+   * are only written for integral, floating point, decimal32, decimal64 and string leaf columns.
+   *
+   * The ORC writer writes a `BLOOM_FILTER_UTF8` stream per stripe, with one filter per row group
+   * sized for the row index stride. ORC bloom filters are only written for top-level signed
+   * integral, floating point, string and `TIMESTAMP_DAYS` columns.
+   *
+   * The option is ignored for all other types.
+   *
+   * @param fpp Target false positive probability, must be in the range (0, 1)
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter_fpp(double fpp) noexcept
+  {
+    _bloom_filter_fpp = fpp;
+    return *this;
+  }
+
   /**
    * @brief Sets the encoding to use for this column.
    *
@@ -901,6 +943,25 @@ class column_in_metadata {
    */
   [[nodiscard]] bool is_enabled_skip_compression() const noexcept { return _skip_compression; }
 
+  /**
+   * @brief Get whether a bloom filter has been requested for this column.
+   *
+   * @return Boolean indicating whether to write a bloom filter for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const noexcept
+  {
+    return _bloom_filter_fpp.has_value();
+  }
+
+  /**
+   * @brief Get the target false positive probability of the bloom filter for this column.
+   *
+   * @throws std::bad_optional_access If a bloom filter was not requested for this column.
+   *         Check using `is_enabled_bloom_filter()` first.
+   * @return The target false positive probability
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp.value(); }
+
   /**
    * @brief Get the encoding that was set for this column.
    *
@@ -29,6 +29,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <optional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -52,6 +53,8 @@ class hash_join;
 
 template <cudf::has_nested HasNested>
 class distinct_hash_join;
+
+class mixed_join_impl;
 }  // namespace detail
 
 /**
@@ -178,6 +181,39 @@ full_join(cudf::table_view const& left_keys,
           null_equality compare_nulls       = null_equality::EQUAL,
           rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an
+ * inner join between the specified tables, computed one hash partition at a time.
+ *
+ * Both tables are hash partitioned on their keys, and the partitions with equal
+ * hash values are joined with each other. The hash table of each partition is
+ * a fraction of the size of a hash table built on a whole table, so it occupies
+ * less memory and more of it stays in cache while probed. The result is the same
+ * as that of `cudf::inner_join()`, in a different (unspecified) order.
+ *
+ * @throw std::invalid_argument if `num_partitions` is not positive.
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of hash partitions of each table
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(cudf::table_view const& left_keys,
+                       cudf::table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls       = null_equality::EQUAL,
+                       rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a vector of row indices corresponding to a left semi-join
  * between the specified tables.
@@ -237,6 +273,101 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
   null_equality compare_nulls       = null_equality::EQUAL,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, which are both sorted on their keys.
+ *
+ * The matches of each left row are found by binary searches of the right table with the
+ * lexicographic row comparator, so no hash table is built. The order of the rows of the tables is
+ * described by `column_order` and `null_precedence` as in `cudf::sort()`. Behavior is undefined if
+ * either table is not sorted in that order, unless `check_sorted` is true.
+ *
+ * The result is the same as that of `cudf::inner_join()`, ordered by left row index and then by
+ * right row index.
+ *
+ * @throw std::invalid_argument if `check_sorted` is true and either table is not sorted.
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::data_type_error if the column types of `left_keys` and `right_keys` mismatch.
+ *
+ * @param left_keys The left table, sorted on its keys
+ * @param right_keys The right table, sorted on its keys
+ * @param column_order The sort order of each key column. If empty, all columns are in ascending
+ * order.
+ * @param null_precedence The order of nulls of each key column. If empty, nulls are before all
+ * other elements.
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param check_sorted Whether to verify that both tables are sorted before joining them
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      std::vector<order> const& column_order        = {},
+                      std::vector<null_order> const& null_precedence = {},
+                      null_equality compare_nulls                    = null_equality::EQUAL,
+                      bool check_sorted                              = false,
+                      rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, which are both sorted on their keys.
+ *
+ * @copydetails sort_merge_inner_join
+ *
+ * Left rows without a match are paired with an out-of-bounds right index, as in
+ * `cudf::left_join()`.
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(cudf::table_view const& left_keys,
+                     cudf::table_view const& right_keys,
+                     std::vector<order> const& column_order        = {},
+                     std::vector<null_order> const& null_precedence = {},
+                     null_equality compare_nulls                    = null_equality::EQUAL,
+                     bool check_sorted                              = false,
+                     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a vector of row indices corresponding to a left semi-join between the specified
+ * tables, which are both sorted on their keys.
+ *
+ * The result is the same as that of `cudf::left_semi_join()`, in ascending order.
+ *
+ * @throw std::invalid_argument if `check_sorted` is true and either table is not sorted.
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::data_type_error if the column types of `left_keys` and `right_keys` mismatch.
+ *
+ * @param left_keys The left table, sorted on its keys
+ * @param right_keys The right table, sorted on its keys
+ * @param column_order The sort order of each key column. If empty, all columns are in ascending
+ * order.
+ * @param null_precedence The order of nulls of each key column. If empty, nulls are before all
+ * other elements.
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param check_sorted Whether to verify that both tables are sorted before joining them
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector `left_indices` that can be used to construct the result of performing a left
+ * semi join between two tables with `left_keys` and `right_keys` as the join keys .
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> sort_merge_left_semi_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order        = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  bool check_sorted                              = false,
+  rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Performs a cross join on two tables (`left`, `right`)
  *
@@ -274,6 +405,73 @@ std::unique_ptr<cudf::table> cross_join(
  */
 enum class nullable_join : bool { YES, NO };
 
+/**
+ * @brief Bloom filter over the rows of a join build table
+ *
+ * Probing the filter with the rows of a probe table tells which of them may have a match in the
+ * build table. When a join is selective, discarding the other rows before the join saves most of
+ * the work of the join, and of whatever processes the probe table before it.
+ *
+ * A probe row may be reported as a possible match although it has none, at a rate set when
+ * building the filter; a probe row that has a match is always reported. Null keys are treated as
+ * matching each other, irrespective of the null equality of the join.
+ */
+class join_bloom_filter {
+ public:
+  using word_type = uint32_t;  ///< Type of the words of the filter
+
+  join_bloom_filter()                                    = delete;
+  join_bloom_filter(join_bloom_filter const&)            = delete;
+  join_bloom_filter(join_bloom_filter&&)                 = default;
+  join_bloom_filter& operator=(join_bloom_filter const&) = delete;
+  join_bloom_filter& operator=(join_bloom_filter&&)      = default;
+
+  /**
+   * @brief Builds a bloom filter over the rows of `build`
+   *
+   * @throw std::invalid_argument If `false_positive_rate` is not in the range (0, 1)
+   *
+   * @param build The build table, whose rows are the join keys
+   * @param false_positive_rate Rate at which probe rows without a match are reported as possible
+   * matches
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the filter's device memory
+   */
+  join_bloom_filter(cudf::table_view const& build,
+                    double false_positive_rate        = 0.01,
+                    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns a BOOL8 column telling, for each row of `probe`, whether it may have a match in
+   * the build table of the filter
+   *
+   * The column can be used with `cudf::apply_boolean_mask()` to drop the probe rows that do not
+   * have a match.
+   *
+   * @throw cudf::logic_error If the number of columns of `probe` differs from that of the build
+   * table
+   *
+   * @param probe The probe table; its column types must be those of the build table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column without nulls, `true` for the rows that may have a match
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the size of the filter in bytes
+   */
+  [[nodiscard]] std::size_t size_bytes() const { return _words.size() * sizeof(word_type); }
+
+ private:
+  size_type _num_columns;                 ///< Number of columns of the build table
+  rmm::device_uvector<word_type> _words;  ///< Blocks of the filter
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -343,6 +541,53 @@ class hash_join {
              rmm::cuda_stream_view stream           = cudf::get_default_stream(),
              rmm::device_async_resource_ref mr      = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns the row indices of the inner join of a window of probe rows, such that the join of a
+   * large probe table can be processed in chunks of bounded size. @see cudf::inner_join().
+   *
+   * The window starts at `probe_row_begin` and is chosen so that its output has at most
+   * `max_output_size` rows, unless the matches of its first probe row alone exceed it; the window
+   * always contains at least one probe row. The returned cursor is the first probe row after the
+   * window, and is passed as `probe_row_begin` of the next call. The inner join of `probe` is the
+   * concatenation of the outputs of all calls, starting from a cursor of 0 until the returned
+   * cursor is `probe.num_rows()`.
+   *
+   * @code{.pseudo}
+   * cudf::size_type cursor = 0;
+   * while (cursor < probe.num_rows()) {
+   *   auto [probe_indices, build_indices, next] = join.inner_join_chunk(probe, cursor, 1 << 20);
+   *   // gather and process the chunk
+   *   cursor = next;
+   * }
+   * @endcode
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param probe_row_begin First probe row of the window
+   * @param max_output_size Maximum number of output rows of the window
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw std::out_of_range If `probe_row_begin` is negative or greater than the number of probe
+   * rows
+   * @throw std::invalid_argument If `max_output_size` is 0
+   *
+   * @return A tuple of [`left_indices`, `right_indices`, `next_probe_row`]: the row indices of the
+   * inner join of the window with `build` and `probe` as the join keys, and the cursor of the next
+   * window
+   */
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  inner_join_chunk(
+    cudf::table_view const& probe,
+    size_type probe_row_begin,
+    std::size_t max_output_size,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the row indices that can be used to construct the result of performing
    * a left join between two tables. @see cudf::left_join(). Behavior is undefined if the
@@ -393,6 +638,75 @@ class hash_join {
             rmm::cuda_stream_view stream           = cudf::get_default_stream(),
             rmm::device_async_resource_ref mr      = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Returns the rows of the specified columns of the probe and build tables gathered by the
+   * output rows of an inner join of the probe table with the build table.
+   *
+   * The result is that of `cudf::gather()` of `probe_columns` and `build_columns` by the indices
+   * returned by `inner_join()`. If all gathered columns are fixed-width, the gathered rows are
+   * written directly by the probe of the hash table, without materializing the indices. Columns of
+   * other types are gathered from the indices.
+   *
+   * @code{.pseudo}
+   * build: {{0, 1, 2}}, probe: {{1, 2, 3}}
+   * inner_join_and_gather(probe, {{10, 20, 30}}, {{'a', 'b', 'c'}}) = {{20, 30}, {'b', 'c'}}
+   * @endcode
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw cudf::logic_error If `probe_columns` and `probe`, or `build_columns` and the build
+   * table, have different numbers of rows.
+   * @throw std::overflow_error If the output has more rows than a column can hold.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param probe_columns Columns of the probe rows to gather, e.g. the payload of the probe keys
+   * @param build_columns Columns of the build rows to gather, e.g. the payload of the build keys
+   * @param output_size Optional value which allows users to specify the exact output size
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @return The gathered `probe_columns` followed by the gathered `build_columns`
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> inner_join_and_gather(
+    cudf::table_view const& probe,
+    cudf::table_view const& probe_columns,
+    cudf::table_view const& build_columns,
+    std::optional<std::size_t> output_size = {},
+    rmm::cuda_stream_view stream           = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr      = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the rows of the specified columns of the probe and build tables gathered by the
+   * output rows of a left join of the probe table with the build table.
+   *
+   * Same as `inner_join_and_gather()` for the output of `left_join()`: the gathered build columns
+   * are null in the output rows of probe rows without a match.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw cudf::logic_error If `probe_columns` and `probe`, or `build_columns` and the build
+   * table, have different numbers of rows.
+   * @throw std::overflow_error If the output has more rows than a column can hold.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param probe_columns Columns of the probe rows to gather
+   * @param build_columns Columns of the build rows to gather
+   * @param output_size Optional value which allows users to specify the exact output size
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @return The gathered `probe_columns` followed by the gathered `build_columns`
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> left_join_and_gather(
+    cudf::table_view const& probe,
+    cudf::table_view const& probe_columns,
+    cudf::table_view const& build_columns,
+    std::optional<std::size_t> output_size = {},
+    rmm::cuda_stream_view stream           = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr      = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the exact number of matches (rows) when performing an inner join with the specified
    * probe table.
@@ -445,6 +759,66 @@ class hash_join {
     rmm::cuda_stream_view stream      = cudf::get_default_stream(),
     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns a bloom filter over the rows of the build table, to discard the rows of a probe table
+   * that do not have a match before probing it. @see cudf::join_bloom_filter
+   *
+   * @param false_positive_rate Rate at which probe rows without a match are reported as possible
+   * matches
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the filter's device memory
+   *
+   * @return A bloom filter over the rows of `build`
+   */
+  [[nodiscard]] std::unique_ptr<join_bloom_filter> bloom_filter(
+    double false_positive_rate        = 0.01,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the indices of the rows of the specified probe table that have a match in the
+   * build table, i.e. the result of a left semi join of the probe table with the build table.
+   * @see cudf::left_semi_join().
+   *
+   * Unlike `cudf::left_semi_join()`, which builds a hash table of the right table on every call,
+   * this reuses the hash table of the build table over any number of probe tables.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return The indices of the probe rows that have a match, in ascending order
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the indices of the rows of the specified probe table that do not have a match
+   * in the build table, i.e. the result of a left anti join of the probe table with the build
+   * table. @see cudf::left_anti_join().
+   *
+   * Unlike `cudf::left_anti_join()`, which builds a hash table of the right table on every call,
+   * this reuses the hash table of the build table over any number of probe tables.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return The indices of the probe rows that do not have a match, in ascending order
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
  private:
   const std::unique_ptr<impl_type const> _impl;
 };
@@ -519,6 +893,36 @@ class distinct_hash_join {
     rmm::cuda_stream_view stream      = cudf::get_default_stream(),
     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Returns the probe table indices of the rows that have a match in the build table,
+   * i.e. the result of a left semi join of the probe table with the build table.
+   * @see cudf::left_semi_join().
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   * @return A `probe_indices` column, in ascending order, that can be used to construct the
+   * result of performing a left semi join between two tables with `probe` and `build` as the
+   * join keys.
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the probe table indices of the rows that do not have a match in the build
+   * table, i.e. the result of a left anti join of the probe table with the build table.
+   * @see cudf::left_anti_join().
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   * @return A `probe_indices` column, in ascending order, that can be used to construct the
+   * result of performing a left anti join between two tables with `probe` and `build` as the
+   * join keys.
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
  private:
   using impl_type = typename cudf::detail::distinct_hash_join<HasNested>;  ///< Implementation type
 
@@ -1086,6 +1490,142 @@ std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>> mixed_le
   null_equality compare_nulls       = null_equality::EQUAL,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Mixed join that builds the hash table of the right equality table and parses the
+ * predicate in creation, and probes them with left tables in subsequent `*_join` member functions.
+ *
+ * The results are those of the corresponding `cudf::mixed_*_join()` functions, without building
+ * the hash table and parsing the predicate again for each left table.
+ *
+ * @note The `mixed_join` object must not outlive the tables viewed by `right_equality` and
+ * `right_conditional`, else behavior is undefined.
+ */
+class mixed_join {
+ public:
+  using impl_type = cudf::detail::mixed_join_impl;  ///< Implementation type
+
+  mixed_join() = delete;
+  ~mixed_join();
+  mixed_join(mixed_join const&)            = delete;
+  mixed_join(mixed_join&&)                 = delete;
+  mixed_join& operator=(mixed_join const&) = delete;
+  mixed_join& operator=(mixed_join&&)      = delete;
+
+  /**
+   * @brief Construct a mixed join object for subsequent probe calls.
+   *
+   * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+   * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+   * match.
+   *
+   * @param right_equality The right table used for the equality join
+   * @param right_conditional The right table used for the conditional join
+   * @param left_conditional A table with the column types of the left tables used for the
+   * conditional join; only its types are used, so it may be empty
+   * @param binary_predicate The condition on which to join
+   * @param compare_nulls Whether or not null values join to each other or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  mixed_join(table_view const& right_equality,
+             table_view const& right_conditional,
+             table_view const& left_conditional,
+             ast::expression const& binary_predicate,
+             null_equality compare_nulls  = null_equality::EQUAL,
+             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the row indices of a mixed inner join of the specified left tables with the
+   * right tables. @see cudf::mixed_inner_join().
+   *
+   * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+   * match.
+   * @throw cudf::data_type_error If the column types of the left tables do not match those the
+   * object was constructed with.
+   *
+   * @param left_equality The left table used for the equality join
+   * @param left_conditional The left table used for the conditional join
+   * @param output_size_data An optional pair of values indicating the exact output size and the
+   * number of matches for each row in the left table (may be precomputed using
+   * `inner_join_size`).
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+   * the result of performing a mixed inner join between the four input tables.
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of a mixed left join of the specified left tables with the
+   * right tables. @see cudf::mixed_left_join().
+   *
+   * @copydetails inner_join
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of a mixed full join of the specified left tables with the
+   * right tables. @see cudf::mixed_full_join().
+   *
+   * @copydetails inner_join
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  full_join(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the exact number of matches (rows) when performing a mixed inner join of the
+   * specified left tables with the right tables. @see cudf::mixed_inner_join_size().
+   *
+   * @param left_equality The left table used for the equality join
+   * @param left_conditional The left table used for the conditional join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return A pair containing the size that would result from performing the requested join and
+   * the number of matches for each row in the left table
+   */
+  [[nodiscard]] std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join_size(table_view const& left_equality,
+                  table_view const& left_conditional,
+                  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the exact number of matches (rows) when performing a mixed left join of the
+   * specified left tables with the right tables. @see cudf::mixed_left_join_size().
+   *
+   * @copydetails inner_join_size
+   */
+  [[nodiscard]] std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_size(table_view const& left_equality,
+                 table_view const& left_conditional,
+                 rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                 rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<impl_type const> _impl;
+};
+
 /**
  * @brief Returns the exact number of matches (rows) when performing a
  * conditional inner join between the specified tables where the predicate
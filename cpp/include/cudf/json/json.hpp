@@ -23,6 +23,9 @@
 
 #include <thrust/optional.h>
 
+#include <string>
+#include <vector>
+
 namespace cudf {
 
 /**
@@ -172,5 +175,27 @@ std::unique_ptr<cudf::column> get_json_object(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply a set of JSONPath strings to all rows in an input strings column.
+ *
+ * This is equivalent to calling `get_json_object()` once for each path but each
+ * row is read once for all the paths instead of once per path.
+ *
+ * @throw std::invalid_argument if any path has an invalid operator or an empty name
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param options Options for controlling the behavior of the function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Resource for allocating device memory
+ * @return New strings columns containing the retrieved json object strings, one per path
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  get_json_object_options options   = get_json_object_options{},
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace cudf
@@ -30,7 +30,7 @@ namespace cudf {
  * @addtogroup label_bins
  * @{
  * @file
- * @brief APIs for labeling values by bin.
+ * @brief APIs for labeling and counting values by bin.
  */
 
 /**
@@ -78,5 +78,71 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Counts the elements of `input` in each of the specified bins.
+ *
+ * The bins are defined as in `label_bins`, and the count of bin `i` is the number of elements
+ * of `input` which `label_bins` labels `i`, computed without materializing the labels.
+ *
+ * Notes:
+ *   - NULL and NaN elements in `input` belong to no bin and are not counted.
+ *   - Bins must be provided in monotonically increasing order, otherwise behavior is undefined.
+ *   - If two or more bins overlap, behavior is undefined.
+ *
+ * @throws cudf::data_type_error if `input.type() == left_edges.type() == right_edges.type()` is
+ * violated, or if the type cannot be ordered.
+ * @throws cudf::logic_error if `left_edges.size() != right_edges.size()`
+ * @throws cudf::logic_error if `left_edges.has_nulls()` or `right_edges.has_nulls()`
+ *
+ * @param input The input elements to count according to the specified bins.
+ * @param left_edges Values of the left edge of each bin.
+ * @param left_inclusive Whether or not the left edge is inclusive.
+ * @param right_edges Value of the right edge of each bin.
+ * @param right_inclusive Whether or not the right edge is inclusive.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return INT64 column holding the number of elements of `input` in each bin.
+ */
+std::unique_ptr<column> bin_counts(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of `input` in each of `num_bins` bins of equal width spanning
+ * `[lower, upper]`.
+ *
+ * Bin `i` holds the values in `[lower + i * w, lower + (i + 1) * w)` where
+ * `w = (upper - lower) / num_bins`, except that the last bin also holds `upper`. The bin of each
+ * element is computed directly from its value rather than searched among the bin edges.
+ *
+ * Notes:
+ *   - NULL and NaN elements in `input` belong to no bin and are not counted.
+ *   - Elements outside of `[lower, upper]` belong to no bin and are not counted.
+ *
+ * @throws cudf::data_type_error if `input` is not a numeric column
+ * @throws std::invalid_argument if `num_bins` is not positive
+ * @throws std::invalid_argument if `lower` or `upper` is not finite or `lower >= upper`
+ *
+ * @param input The input elements to count according to the bins.
+ * @param lower Value of the left edge of the first bin.
+ * @param upper Value of the right edge of the last bin.
+ * @param num_bins Number of bins.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return INT64 column holding the number of elements of `input` in each bin.
+ */
+std::unique_ptr<column> bin_counts(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
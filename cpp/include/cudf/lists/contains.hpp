@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 
+#include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -180,6 +181,94 @@ std::unique_ptr<column> index_of(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A hash table of the elements of each row of a lists column, answering repeated
+ * `contains` and `index_of` queries without scanning the lists
+ *
+ * Building the table reads each element once. Each lookup of a search key then takes constant
+ * expected time however long its list is, rather than the linear scan of
+ * `cudf::lists::index_of`. This pays off when the same lists column is searched with several
+ * columns of search keys.
+ *
+ * Lookups return the same results as `cudf::lists::contains` and `cudf::lists::index_of`: null
+ * elements are never found, NaNs are equal to each other, and a null list or search key yields
+ * a null output row.
+ *
+ * @note The `hashed_lists` object must not outlive the lists column it was built from, else
+ * behavior is undefined.
+ */
+class hashed_lists {
+ public:
+  hashed_lists() = delete;
+  ~hashed_lists();
+  hashed_lists(hashed_lists const&)            = delete;
+  hashed_lists(hashed_lists&&)                 = delete;
+  hashed_lists& operator=(hashed_lists const&) = delete;
+  hashed_lists& operator=(hashed_lists&&)      = delete;
+
+  /**
+   * @brief Build the hash table of the elements of each row of `lists`
+   *
+   * @throw cudf::data_type_error If the elements of `lists` are not fixed-width or strings
+   *
+   * @param lists Lists column whose rows are to be searched
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the hash table's device memory
+   */
+  hashed_lists(cudf::lists_column_view const& lists,
+               rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+               rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Create a column of bool values indicating whether each row of the lists column
+   * contains the corresponding row of `search_keys`
+   *
+   * @throw cudf::logic_error If `search_keys` does not match the lists in its number of rows
+   * @throw cudf::data_type_error If `search_keys` type does not match the element type of the
+   * lists
+   *
+   * @param search_keys A column of search keys to be looked up in each corresponding row of
+   * the lists
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return BOOL8 column of `n` rows with the result of the lookup
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    cudf::column_view const& search_keys,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Create a column of values indicating the position of each row of `search_keys`
+   * within the corresponding row of the lists column
+   *
+   * @throw cudf::logic_error If `search_keys` does not match the lists in its number of rows
+   * @throw cudf::data_type_error If `search_keys` type does not match the element type of the
+   * lists
+   *
+   * @param search_keys A column of search keys to be looked up in each corresponding row of
+   * the lists
+   * @param find_option Whether to return the position of the first match (`FIND_FIRST`) or
+   * last (`FIND_LAST`)
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return column of `n` rows with the location of each search key
+   */
+  [[nodiscard]] std::unique_ptr<column> index_of(
+    cudf::column_view const& search_keys,
+    duplicate_find_option find_option = duplicate_find_option::FIND_FIRST,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  column_view _lists;                        ///< The searched lists column
+  column_view _child;                        ///< The elements of the searched lists
+  rmm::device_uvector<size_type> _elements;  ///< Element of `_child` in each slot, or -1 if empty
+  rmm::device_uvector<size_type> _rows;      ///< List holding the element of each slot
+  rmm::device_uvector<size_type> _first;     ///< First position of the element in its list
+  rmm::device_uvector<size_type> _last;      ///< Last position of the element in its list
+};
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
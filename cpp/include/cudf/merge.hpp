@@ -40,6 +40,10 @@ namespace cudf {
  * parameters (cudf::column_order and cudf::null_order)
  * specified for that column.
  *
+ * When more than two tables have rows, the row order of all tables is merged before any
+ * column is copied, so each column is copied to the output once rather than once per
+ * pairwise merge. Rows with equal keys then keep the order of their tables.
+ *
  * ```
  * Example 1:
  * input:
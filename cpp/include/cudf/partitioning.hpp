@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/contiguous_split.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -110,6 +111,80 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash partitions `input` and packs each partition into its own contiguous buffer.
+ *
+ * This is equivalent to calling `hash_partition` followed by `contiguous_split` on the
+ * partition offsets, but the intermediate partitioned table is released as soon as the packed
+ * buffers have been filled, and it is allocated from the current device resource rather than
+ * `mr`. Each returned `packed_table` holds exactly one partition, in partition order, and its
+ * `data` can be passed to `unpack` or shipped to another process as-is. Empty partitions are
+ * returned as empty tables.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned packed buffers
+ *
+ * @returns One `packed_table` per partition
+ */
+std::vector<packed_table> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function             = hash_id::HASH_MURMUR3,
+  uint32_t seed                     = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows of `input` into the key ranges delimited by `split_points`.
+ *
+ * `split_points` holds `num_partitions - 1` rows of key values, sorted according to
+ * `column_order` and `null_precedence`, e.g. quantiles of a sample of the keys. Row `r` goes to
+ * partition `i`, the number of split points that compare less than the keys of `r`, so that
+ * partition `i` holds the rows whose keys `k` satisfy `split_points[i-1] < k <= split_points[i]`.
+ * Rows in the same partition are contiguous in the output, in ascending partition order. The
+ * order within each partition is undefined.
+ *
+ * This is equivalent to passing `lower_bound(split_points, input.select(key_columns))` to
+ * `partition`, with the search result used directly as the partition map.
+ *
+ * @code{.pseudo}
+ * input:        {col1: {5, 1, 9, 3, 7}}
+ * key_columns:  {0}
+ * split_points: {col1: {3, 7}}
+ *
+ * output:       {col1: {1, 3, 5, 7, 9}}, offsets: {0, 2, 4, 5}
+ * @endcode
+ *
+ * @throw std::invalid_argument if the number of key columns and split point columns differ
+ * @throw std::out_of_range if an index in `key_columns` is invalid
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the columns of `input` compared against `split_points`
+ * @param split_points Sorted table of partition boundaries
+ * @param column_order The sort order of each key column; empty means all ascending
+ * @param null_precedence The null ordering of each key column; empty means nulls before
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Pair containing the reordered table and `split_points.num_rows() + 2` offsets to each
+ * partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& split_points,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
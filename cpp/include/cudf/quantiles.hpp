@@ -62,6 +62,35 @@ std::unique_ptr<column> quantile(
   bool exact                         = true,
   rmm::device_async_resource_ref mr  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes quantiles with interpolation without sorting the input.
+ *
+ * Computes the same values as `quantile` on the sorted valid values of `input`, but
+ * selects the values adjacent to each quantile with a radix select instead of sorting.
+ * Each pass over `input` selects the next 8 bits of the requested values so no sorted
+ * copy of `input` is produced. This is most efficient for a handful of quantiles.
+ *
+ * Null values of `input` are ignored. If `input` has no valid values, all the quantiles
+ * are null. NaNs are greater than any other value.
+ *
+ * @param input   Column from which to compute quantile values
+ * @param q       Specified quantiles in range [0, 1]
+ * @param interp  Strategy used to select between values adjacent to a specified quantile
+ * @param exact   If true, returns doubles. If false, returns same type as input.
+ * @param mr      Device memory resource used to allocate the returned column's device memory
+ *
+ * @throws cudf::data_type_error if `input` is a dictionary column
+ * @throws cudf::logic_error if `input` is not numeric
+ *
+ * @returns Column of specified quantiles, with nulls for indeterminable values
+ */
+std::unique_ptr<column> quantile_by_selection(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp              = interpolation::LINEAR,
+  bool exact                        = true,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
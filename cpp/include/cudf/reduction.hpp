@@ -18,11 +18,15 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf {
 /**
@@ -110,6 +114,60 @@ std::unique_ptr<scalar> reduce(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes several reductions of the values in all rows of a column
+ *
+ * Each result is the same as the one of `reduce(col, *aggs[i], output_dtypes[i])`. The SUM,
+ * SUM_OF_SQUARES, MIN, MAX, MEAN, VARIANCE and STD reductions of numeric columns are all
+ * computed with a single pass over the column instead of one pass per reduction. The only
+ * exceptions are floating-point sums with an output type of `FLOAT32` and MEAN, VARIANCE
+ * and STD with an output type other than `FLOAT64`; these are computed by `reduce`. Other
+ * reductions and other column types are also computed by `reduce`, one at a time.
+ *
+ * Floating-point results may differ from those of `reduce` by rounding since the values
+ * are summed in a different order.
+ *
+ * @throw std::invalid_argument if `aggs` and `output_dtypes` differ in size or if any
+ * aggregation is null
+ * @throw cudf::logic_error for any reduction for which `reduce` throws
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reductions
+ * @param output_dtypes The output scalar type of each aggregation
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Output scalars with the result of each aggregation
+ */
+std::vector<std::unique_ptr<scalar>> reduce_many(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the same reductions of the values in all rows of each column of a table
+ *
+ * Each column is reduced as by `reduce_many(column_view const&, ...)`. The output type of
+ * each reduction is the type the same aggregation produces in a groupby: SUM and
+ * SUM_OF_SQUARES of integers produce `INT64`, MEAN, VARIANCE and STD produce `FLOAT64`,
+ * and MIN and MAX produce the type of the column.
+ *
+ * @throw std::invalid_argument if any aggregation is null
+ * @throw cudf::logic_error for any reduction for which `reduce` throws
+ *
+ * @param input Input table view
+ * @param aggs Aggregation operators applied to each column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For each column, the output scalars with the result of each aggregation
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_many(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Compute reduction of each segment in the input column
  *
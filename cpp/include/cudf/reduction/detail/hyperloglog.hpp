@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+
+namespace cudf::reduction::detail {
+
+/**
+ * @brief Build the HyperLogLog++ sketch of the non-null values of each group.
+ *
+ * The output is a lists column of `num_groups` rows, each a list of `2^precision` INT8 registers.
+ * Groups without any non-null value have all their registers zero.
+ *
+ * @param values The values to sketch
+ * @param group_labels The group of each value, or an empty span if all values are in group 0
+ * @param num_groups The number of groups
+ * @param precision The number of bits of the value hashes that select a register
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The sketch of each group
+ */
+[[nodiscard]] std::unique_ptr<column> group_hllpp(column_view const& values,
+                                                  device_span<size_type const> group_labels,
+                                                  size_type num_groups,
+                                                  int precision,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Merge the HyperLogLog++ sketches of each group into one sketch.
+ *
+ * @throw std::invalid_argument if a non-null row of `sketches` is not a list of `2^precision`
+ * INT8 registers
+ *
+ * @param sketches The sketches to merge, as a lists column of INT8 registers
+ * @param group_labels The group of each sketch, or an empty span if all sketches are in group 0
+ * @param num_groups The number of groups
+ * @param precision The precision the sketches were built with
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The merged sketch of each group
+ */
+[[nodiscard]] std::unique_ptr<column> group_merge_hllpp(column_view const& sketches,
+                                                        device_span<size_type const> group_labels,
+                                                        size_type num_groups,
+                                                        int precision,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::device_async_resource_ref mr);
+
+}  // namespace cudf::reduction::detail
@@ -18,11 +18,15 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf::reduction::detail {
 
@@ -39,4 +43,27 @@ std::unique_ptr<scalar> reduce(column_view const& col,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::reduce_many(column_view const&,
+ * host_span<std::unique_ptr<reduce_aggregation> const>, host_span<data_type const>,
+ * rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::vector<std::unique_ptr<scalar>> reduce_many(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::reduce_many(table_view const&,
+ * host_span<std::unique_ptr<reduce_aggregation> const>, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_many(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 }  // namespace cudf::reduction::detail
@@ -159,6 +159,34 @@ std::unique_ptr<scalar> merge_histogram(column_view const& input,
                                         rmm::cuda_stream_view stream,
                                         rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Build the HyperLogLog++ sketch of the non-null elements of the input column.
+ *
+ * @param input The column to sketch
+ * @param precision The number of bits of the element hashes that select a register
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return A list_scalar storing the `2^precision` INT8 registers of the sketch
+ */
+std::unique_ptr<scalar> hllpp(column_view const& input,
+                              int precision,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Merge multiple HyperLogLog++ sketches together.
+ *
+ * @param input The input given as a lists column of sketches
+ * @param precision The precision the sketches were built with
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return A list_scalar storing the registers of the merged sketch
+ */
+std::unique_ptr<scalar> merge_hllpp(column_view const& input,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
 /**
  * @brief Computes product of elements in input column
  *
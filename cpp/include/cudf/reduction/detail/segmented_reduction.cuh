@@ -18,20 +18,332 @@
 
 #include "reduction_operators.cuh"
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/cast_functor.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/block/block_reduce.cuh>
 #include <cub/device/device_segmented_reduce.cuh>
+#include <cub/warp/warp_reduce.cuh>
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <limits>
+
 namespace cudf {
 namespace reduction {
 namespace detail {
 
+/// Segments of up to this many rows are reduced by a single thread
+constexpr size_type thread_segment_max_size = 8;
+/// Segments of up to this many rows are reduced by a single warp
+constexpr size_type warp_segment_max_size = 512;
+/// Segments of up to this many rows are reduced by a single block; longer segments are split
+/// into chunks of this many rows each reduced by its own block
+constexpr size_type block_segment_max_size = 64 * 1024;
+/// Number of threads per block of the segmented reduction kernels
+constexpr int segmented_reduce_block_size = 256;
+
+/**
+ * @brief Returns true if the number of rows of a segment is within `[min_size, max_size]`
+ */
+template <typename OffsetIterator>
+struct is_segment_size_in_range_fn {
+  OffsetIterator d_offsets;
+  size_type min_size;
+  size_type max_size;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    auto const size = d_offsets[idx + 1] - d_offsets[idx];
+    return size >= min_size && size <= max_size;
+  }
+};
+
+/**
+ * @brief Reduces the rows `begin + rank`, `begin + rank + stride`, ... up to `end`
+ *
+ * Used by the threads of a warp or a block to each reduce part of the same rows before
+ * combining their results. The row `begin + rank` must be less than `end`.
+ */
+template <typename OutputType, typename InputIterator, typename BinaryOp>
+__device__ OutputType strided_reduce(InputIterator d_in,
+                                     thread_index_type begin,
+                                     thread_index_type end,
+                                     thread_index_type rank,
+                                     thread_index_type stride,
+                                     BinaryOp op)
+{
+  OutputType result = static_cast<OutputType>(d_in[begin + rank]);
+  for (auto idx = begin + rank + stride; idx < end; idx += stride) {
+    result = op(result, d_in[idx]);
+  }
+  return result;
+}
+
+/**
+ * @brief Reduces each segment of `segments` with one warp per segment
+ *
+ * The segments must not be empty.
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+CUDF_KERNEL void warp_segmented_reduce_kernel(InputIterator d_in,
+                                              OffsetIterator d_offsets,
+                                              size_type const* segments,
+                                              size_type num_segments,
+                                              OutputIterator d_out,
+                                              BinaryOp op,
+                                              OutputType initial_value)
+{
+  using warp_reduce = cub::WarpReduce<OutputType>;
+  auto constexpr warp_size = cudf::detail::warp_size;
+  __shared__
+    typename warp_reduce::TempStorage temp_storage[segmented_reduce_block_size / warp_size];
+
+  auto const warp_idx = cudf::detail::grid_1d::global_thread_id() / warp_size;
+  if (warp_idx >= num_segments) { return; }
+  auto const lane_idx = static_cast<thread_index_type>(threadIdx.x % warp_size);
+
+  auto const segment = segments[warp_idx];
+  auto const begin   = static_cast<thread_index_type>(d_offsets[segment]);
+  auto const end     = static_cast<thread_index_type>(d_offsets[segment + 1]);
+  auto const size    = end - begin;
+
+  // lanes without rows only pass a placeholder which the reduction ignores
+  auto const value =
+    lane_idx < size ? strided_reduce<OutputType>(d_in, begin, end, lane_idx, warp_size, op)
+                    : initial_value;
+  auto const num_valid = static_cast<int>(min(size, thread_index_type{warp_size}));
+  auto const result =
+    warp_reduce(temp_storage[threadIdx.x / warp_size]).Reduce(value, op, num_valid);
+  if (lane_idx == 0) { d_out[segment] = op(initial_value, result); }
+}
+
+/**
+ * @brief Reduces each chunk of up to `block_segment_max_size` rows of the segments in
+ * `segments` with one block per chunk
+ *
+ * @param chunk_offsets Index of the first chunk of each segment followed by the number of
+ *        chunks
+ * @param d_partials The reduction of each chunk
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename BinaryOp,
+          typename OutputType>
+CUDF_KERNEL void chunked_segmented_reduce_kernel(InputIterator d_in,
+                                                 OffsetIterator d_offsets,
+                                                 size_type const* segments,
+                                                 size_type const* chunk_offsets,
+                                                 size_type num_segments,
+                                                 OutputType* d_partials,
+                                                 BinaryOp op,
+                                                 OutputType initial_value)
+{
+  using block_reduce = cub::BlockReduce<OutputType, segmented_reduce_block_size>;
+  __shared__ typename block_reduce::TempStorage temp_storage;
+
+  auto const chunk = static_cast<size_type>(blockIdx.x);
+  auto const segment_idx =
+    thrust::distance(chunk_offsets,
+                     thrust::upper_bound(
+                       thrust::seq, chunk_offsets, chunk_offsets + num_segments + 1, chunk)) -
+    1;
+  auto const segment = segments[segment_idx];
+  auto const begin   = static_cast<thread_index_type>(d_offsets[segment]) +
+                     static_cast<thread_index_type>(chunk - chunk_offsets[segment_idx]) *
+                       block_segment_max_size;
+  auto const end =
+    min(begin + block_segment_max_size, static_cast<thread_index_type>(d_offsets[segment + 1]));
+  auto const size = end - begin;
+
+  auto const rank  = static_cast<thread_index_type>(threadIdx.x);
+  auto const value = rank < size ? strided_reduce<OutputType>(
+                                     d_in, begin, end, rank, segmented_reduce_block_size, op)
+                                 : initial_value;
+  auto const num_valid =
+    static_cast<int>(min(size, thread_index_type{segmented_reduce_block_size}));
+  auto const result = block_reduce(temp_storage).Reduce(value, op, num_valid);
+  if (threadIdx.x == 0) { d_partials[chunk] = result; }
+}
+
+/**
+ * @brief Computes the reduction of each segment with a strategy suited to its length
+ *
+ * Short segments, such as those of list columns, are reduced by a single thread or a
+ * single warp so the many segments do not each occupy a whole block. Segments of moderate
+ * length are reduced by `cub::DeviceSegmentedReduce` with one block per segment. Very long
+ * segments are split into chunks reduced by separate blocks so a few of them still occupy
+ * the whole device.
+ *
+ * The result of each segment is `op` applied to `initial_value` and all its rows; empty
+ * segments produce `initial_value`.
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+void segmented_reduce_by_length(InputIterator d_in,
+                                OffsetIterator d_offsets,
+                                size_type num_segments,
+                                OutputIterator d_out,
+                                BinaryOp op,
+                                OutputType initial_value,
+                                rmm::cuda_stream_view stream)
+{
+  if (num_segments <= 0) { return; }
+
+  // order the segments by the strategy reducing them
+  auto segments    = rmm::device_uvector<size_type>(num_segments, stream);
+  auto bin_segment = [&, bin_begin = segments.begin()](size_type min_size,
+                                                       size_type max_size) mutable {
+    auto const bin_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(num_segments),
+      bin_begin,
+      is_segment_size_in_range_fn<OffsetIterator>{d_offsets, min_size, max_size});
+    auto const bin = device_span<size_type const>(
+      bin_begin, static_cast<std::size_t>(thrust::distance(bin_begin, bin_end)));
+    bin_begin = bin_end;
+    return bin;
+  };
+  auto const thread_segments = bin_segment(0, thread_segment_max_size);
+  auto const warp_segments   = bin_segment(thread_segment_max_size + 1, warp_segment_max_size);
+  auto const block_segments  = bin_segment(warp_segment_max_size + 1, block_segment_max_size);
+  auto const chunked_segments =
+    bin_segment(block_segment_max_size + 1, std::numeric_limits<size_type>::max());
+
+  if (!thread_segments.empty()) {
+    thrust::for_each(rmm::exec_policy_nosync(stream),
+                     thread_segments.begin(),
+                     thread_segments.end(),
+                     [d_in, d_offsets, d_out, op, initial_value] __device__(size_type segment) {
+                       auto result = initial_value;
+                       for (auto idx = d_offsets[segment]; idx < d_offsets[segment + 1]; ++idx) {
+                         result = op(result, d_in[idx]);
+                       }
+                       d_out[segment] = result;
+                     });
+  }
+
+  if (!warp_segments.empty()) {
+    auto constexpr warps_per_block = segmented_reduce_block_size / cudf::detail::warp_size;
+    auto const num_blocks          = util::div_rounding_up_safe(
+      static_cast<int64_t>(warp_segments.size()), int64_t{warps_per_block});
+    warp_segmented_reduce_kernel<<<num_blocks, segmented_reduce_block_size, 0, stream.value()>>>(
+      d_in,
+      d_offsets,
+      warp_segments.data(),
+      static_cast<size_type>(warp_segments.size()),
+      d_out,
+      op,
+      initial_value);
+  }
+
+  if (!block_segments.empty()) {
+    auto const indices       = block_segments.begin();
+    auto const count         = static_cast<size_type>(block_segments.size());
+    auto const begin_offsets = thrust::make_permutation_iterator(d_offsets, indices);
+    auto const end_offsets   = thrust::make_permutation_iterator(d_offsets + 1, indices);
+    auto const out           = thrust::make_permutation_iterator(d_out, indices);
+
+    size_t temp_storage_bytes = 0;
+    cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                       temp_storage_bytes,
+                                       d_in,
+                                       out,
+                                       count,
+                                       begin_offsets,
+                                       end_offsets,
+                                       op,
+                                       initial_value,
+                                       stream.value());
+    auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+    cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                       temp_storage_bytes,
+                                       d_in,
+                                       out,
+                                       count,
+                                       begin_offsets,
+                                       end_offsets,
+                                       op,
+                                       initial_value,
+                                       stream.value());
+  }
+
+  if (!chunked_segments.empty()) {
+    auto const count = static_cast<size_type>(chunked_segments.size());
+    // the first chunk of each segment followed by the total number of chunks
+    auto chunk_offsets = rmm::device_uvector<size_type>(count + 1, stream);
+
+    auto const chunk_counts = cudf::detail::make_counting_transform_iterator(
+      0,
+      cuda::proclaim_return_type<size_type>(
+        [d_offsets, segments = chunked_segments.data(), count] __device__(size_type idx) {
+          if (idx == count) { return size_type{0}; }
+          auto const size = static_cast<int64_t>(d_offsets[segments[idx] + 1]) -
+                            static_cast<int64_t>(d_offsets[segments[idx]]);
+          return static_cast<size_type>(
+            util::div_rounding_up_unsafe(size, int64_t{block_segment_max_size}));
+        }));
+    thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                           chunk_counts,
+                           chunk_counts + count + 1,
+                           chunk_offsets.begin());
+    auto const num_chunks = chunk_offsets.element(count, stream);
+
+    auto partials = rmm::device_uvector<OutputType>(num_chunks, stream);
+    chunked_segmented_reduce_kernel<<<num_chunks, segmented_reduce_block_size, 0, stream.value()>>>(
+      d_in,
+      d_offsets,
+      chunked_segments.data(),
+      chunk_offsets.data(),
+      count,
+      partials.data(),
+      op,
+      initial_value);
+
+    // combine the chunks of each segment
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::counting_iterator<size_type>(0),
+      count,
+      [segments      = chunked_segments.data(),
+       chunk_offsets = chunk_offsets.data(),
+       partials      = partials.data(),
+       d_out,
+       op,
+       initial_value] __device__(size_type idx) {
+        auto result = initial_value;
+        for (auto chunk = chunk_offsets[idx]; chunk < chunk_offsets[idx + 1]; ++chunk) {
+          result = op(result, partials[chunk]);
+        }
+        d_out[segments[idx]] = result;
+      });
+  }
+}
+
 /**
  * @brief Compute the specified simple reduction over each of the segments in the
  * input range of elements
@@ -68,31 +380,8 @@ void segmented_reduce(InputIterator d_in,
 {
   auto const num_segments = static_cast<size_type>(std::distance(d_offset_begin, d_offset_end)) - 1;
   auto const binary_op    = cudf::detail::cast_functor<OutputType>(op);
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  segmented_reduce_by_length(
+    d_in, d_offset_begin, num_segments, d_out, binary_op, initial_value, stream);
 }
 
 template <typename InputIterator,
@@ -155,31 +444,13 @@ void segmented_reduce(InputIterator d_in,
   rmm::device_uvector<IntermediateType> intermediate_result{static_cast<std::size_t>(num_segments),
                                                             stream};
 
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  segmented_reduce_by_length(d_in,
+                             d_offset_begin,
+                             num_segments,
+                             intermediate_result.data(),
+                             binary_op,
+                             initial_value,
+                             stream);
 
   // compute the result value from intermediate value in device
   thrust::transform(
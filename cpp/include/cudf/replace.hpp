@@ -78,6 +78,30 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in a column with a scalar, reusing the memory of the input.
+ *
+ * For fixed-width columns, the null elements of `input` are replaced in place and `input` is
+ * returned without a null mask. No device memory is allocated in this case. `input` is also
+ * returned unchanged if it has no nulls or if `replacement` is invalid. Otherwise, this is
+ * equivalent to calling `replace_nulls(input->view(), replacement, stream, mr)`.
+ *
+ * @throw cudf::data_type_error if `input` and `replacement` have different types
+ *
+ * @param input Column consumed by the replacement
+ * @param replacement Scalar used to replace null values in `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the returned column
+ *           if it cannot be computed in place
+ *
+ * @returns `input` with null values replaced by `replacement`
+ */
+std::unique_ptr<column> replace_nulls(
+  std::unique_ptr<column>&& input,
+  scalar const& replacement,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all null values in a column with the first non-null value that precedes/follows.
  *
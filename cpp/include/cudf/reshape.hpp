@@ -17,12 +17,17 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <memory>
 
 namespace cudf {
@@ -30,7 +35,7 @@ namespace cudf {
  * @addtogroup column_reshape
  * @{
  * @file
- * @brief Column APIs for interleave and tile
+ * @brief Column APIs for interleave, tile and row-major conversion
  */
 
 /**
@@ -103,6 +108,38 @@ std::unique_ptr<column> byte_cast(
   flip_endianness endian_configuration,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Writes the numeric columns of a table into a row-major dense matrix
+ *
+ * Element `j` of row `i` of `input` is cast to `output_type` and written at position
+ * `i * input.num_columns() + j` of `output`. Null elements are written as `null_fill`.
+ *
+ * ```
+ * input<int32, float>  = [[1, 2, NULL], [0.5, 1.5, 2.5]]
+ * output_type          = FLOAT64
+ * null_fill            = -1.0
+ * output               = [1.0, 0.5, 2.0, 1.5, -1.0, 2.5]
+ * ```
+ *
+ * @throws cudf::data_type_error if `output_type` or the type of a column of `input` is not
+ *         numeric
+ * @throws cudf::data_type_error if the type of `null_fill` is not `output_type`
+ * @throws std::invalid_argument if `input` has nulls and `null_fill` is not valid
+ * @throws std::invalid_argument if `output` holds fewer than
+ *         `input.num_rows() * input.num_columns()` elements of `output_type`
+ *
+ * @param input Table of numeric columns to convert
+ * @param output_type Numeric type of the elements of the matrix
+ * @param null_fill Value written for the null elements of `input`
+ * @param output Device memory receiving the matrix
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void table_to_row_major(table_view const& input,
+                        data_type output_type,
+                        scalar const& null_fill,
+                        device_span<std::byte> output,
+                        rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /** @} */  // end of group
 
 }  // namespace cudf
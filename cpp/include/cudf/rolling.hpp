@@ -16,13 +16,19 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cudf {
 /**
@@ -551,6 +557,73 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rolling_aggregation const& aggr,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A column to aggregate over the windows of a batched rolling window call.
+ */
+struct rolling_request {
+  column_view values;                                ///< The column to aggregate
+  size_type min_periods;                             ///< Minimum observations in a window
+  std::unique_ptr<rolling_aggregation> aggregation;  ///< The aggregation to apply
+};
+
+/**
+ * @brief  Applies several aggregations over the same range-based rolling windows.
+ *
+ * Equivalent to calling `grouped_range_rolling_window()` once for each request with the same
+ * `group_keys`, `orderby_column`, `order`, `preceding` and `following` arguments, except that
+ * the group boundaries and the window extents of each row are computed only once and shared by
+ * all the requests.
+ *
+ * @throw cudf::logic_error if the size of `values` in any request does not match the size of
+ *        `orderby_column`, or if any request has no aggregation or a non-positive `min_periods`
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, for range comparisons
+ * @param[in] order  The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+ * @param[in] preceding The interval value in the backward direction
+ * @param[in] following The interval value in the forward direction
+ * @param[in] requests The columns to aggregate and the aggregation to apply to each
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns   A table with the result of each request, in the order of the requests
+ */
+std::unique_ptr<table> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  host_span<rolling_request const> requests,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes the window of each row for range-based rolling windows.
+ *
+ * The windows are those used by `grouped_range_rolling_window()` for the same arguments. They
+ * are returned as the preceding and following window size of each row so they can be passed to
+ * the variable-size `rolling_window()` any number of times, avoiding recomputing the group
+ * boundaries and searching the order-by column for every window function over the same frame.
+ *
+ * @throw cudf::logic_error if `group_keys` is not empty and its number of rows does not match
+ *        the size of `orderby_column`
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, for range comparisons
+ * @param[in] order  The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+ * @param[in] preceding The interval value in the backward direction
+ * @param[in] following The interval value in the forward direction
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns   The `INT32` preceding and following window columns, in that order
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_range_windows(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -594,5 +667,94 @@ std::unique_ptr<column> rolling_window(
   rolling_aggregation const& agg,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Applies a fixed-size rolling window function to a column that arrives in batches
+ *
+ * The results are the same as those of the fixed-size `rolling_window()` applied to the
+ * concatenation of all the batches. Only the rows needed by the windows of the rows not yet
+ * returned are kept between batches: the last `preceding_window - 1` returned rows and the
+ * `following_window` rows whose windows extend into the next batch. Earlier rows are never
+ * aggregated again.
+ *
+ * `update` returns the results of the rows whose windows are complete, so each batch's results
+ * lag `following_window` rows behind it. `finish` returns the results of the remaining rows.
+ *
+ * @code{.pseudo}
+ * srw = streaming_rolling_window(preceding_window: 2, following_window: 1, min_periods: 1, SUM)
+ *
+ * srw.update([1, 2, 3]) = [3, 6]
+ * srw.update([4, 5])    = [9, 12]
+ * srw.finish()          = [9]
+ * @endcode
+ */
+class streaming_rolling_window {
+ public:
+  streaming_rolling_window() = delete;
+  ~streaming_rolling_window();
+  streaming_rolling_window(streaming_rolling_window const&)            = delete;
+  streaming_rolling_window& operator=(streaming_rolling_window const&) = delete;
+
+  /**
+   * @brief Construct a streaming rolling window object
+   *
+   * @throws std::invalid_argument if `preceding_window` is not positive, if `following_window`
+   * is negative, or if `agg` is null or a LEAD or LAG aggregation
+   *
+   * @param preceding_window The static rolling window size in the backward direction, including
+   * the current row
+   * @param following_window The static rolling window size in the forward direction
+   * @param min_periods Minimum number of observations in window required to have a value
+   * @param agg The rolling window aggregation
+   */
+  streaming_rolling_window(size_type preceding_window,
+                           size_type following_window,
+                           size_type min_periods,
+                           std::unique_ptr<rolling_aggregation>&& agg);
+
+  /**
+   * @brief Appends a batch to the column and returns the results of the rows whose windows
+   * are complete
+   *
+   * @throws cudf::data_type_error if the type of the batch differs from that of previous batches
+   *
+   * @param batch The next rows of the column
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return The results of the rows following those returned by previous calls
+   */
+  std::unique_ptr<column> update(
+    column_view const& batch,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the results of the rows not yet returned, ending the column
+   *
+   * No batches may be appended afterwards.
+   *
+   * @throws cudf::logic_error if no batch has been appended
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return The results of the last rows of the column
+   */
+  std::unique_ptr<column> finish(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+ private:
+  std::unique_ptr<column> compute(bool is_last,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr);
+
+  size_type _preceding_window;                ///< Window size in the backward direction
+  size_type _following_window;                ///< Window size in the forward direction
+  size_type _min_periods;                     ///< Minimum observations in a window
+  std::unique_ptr<rolling_aggregation> _agg;  ///< The aggregation
+  std::unique_ptr<column> _rows;              ///< Rows kept for the windows of later rows
+  size_type _returned_rows{0};                ///< Number of leading `_rows` already returned
+  bool _finished{false};                      ///< Whether `finish` was called
+};
+
 /** @} */  // end of group
 }  // namespace cudf
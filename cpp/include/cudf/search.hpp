@@ -20,13 +20,20 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace cudf {
+namespace detail {
+class sorted_index;
+class haystack_set;
+}  // namespace detail
+
 /**
  * @addtogroup column_search
  * @{
@@ -118,6 +125,64 @@ std::unique_ptr<column> upper_bound(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Finds the smallest insertion points of several sets of needles, each in its own
+ * sorted haystack
+ *
+ * Each result is identical to calling `lower_bound(haystacks[i], needles[i], column_order,
+ * null_precedence)`. All pairs are searched by a single kernel with one comparator built over
+ * the concatenated haystacks and the concatenated needles, rather than with one comparator and
+ * one launch per pair. This pays off when searching small sets of needles in many partitions of
+ * a table, at the cost of copying the haystacks once into a single table.
+ *
+ * @throws std::invalid_argument if `haystacks` and `needles` have different sizes
+ * @throws cudf::data_type_error if the haystacks, or the needles, do not all have the same types
+ *
+ * @param haystacks The sorted tables containing the search spaces
+ * @param needles The values to find the insert locations for in the corresponding haystack
+ * @param column_order Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums needles
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Non-nullable columns of the insertion points, one per pair in the same order
+ */
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Finds the largest insertion points of several sets of needles, each in its own
+ * sorted haystack
+ *
+ * Each result is identical to calling `upper_bound(haystacks[i], needles[i], column_order,
+ * null_precedence)`. All pairs are searched by a single kernel with one comparator built over
+ * the concatenated haystacks and the concatenated needles, rather than with one comparator and
+ * one launch per pair. This pays off when searching small sets of needles in many partitions of
+ * a table, at the cost of copying the haystacks once into a single table.
+ *
+ * @throws std::invalid_argument if `haystacks` and `needles` have different sizes
+ * @throws cudf::data_type_error if the haystacks, or the needles, do not all have the same types
+ *
+ * @param haystacks The sorted tables containing the search spaces
+ * @param needles The values to find the insert locations for in the corresponding haystack
+ * @param column_order Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums needles
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Non-nullable columns of the insertion points, one per pair in the same order
+ */
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Check if the given `needle` value exists in the `haystack` column.
  *
@@ -167,5 +232,166 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Sorted keys preprocessed once for repeated searches
+ *
+ * Each call to `lower_bound` or `upper_bound` preprocesses the haystack for the row comparator
+ * before searching it. A `sorted_index` preprocesses its keys once on construction so that
+ * repeated lookups into a large static table, such as a dimension table, only preprocess their
+ * needles.
+ *
+ * Keys holding lists or dictionary columns must be preprocessed together with the needles, so
+ * they are still preprocessed by every search.
+ *
+ * @note The `sorted_index` object must not outlive the table viewed by `keys`, else behavior is
+ * undefined.
+ */
+class sorted_index {
+ public:
+  sorted_index() = delete;
+  ~sorted_index();
+  sorted_index(sorted_index const&)            = delete;
+  sorted_index(sorted_index&&)                 = delete;
+  sorted_index& operator=(sorted_index const&) = delete;
+  sorted_index& operator=(sorted_index&&)      = delete;
+
+  /**
+   * @brief Constructs an index over sorted keys
+   *
+   * @throws std::invalid_argument if `column_order` or `null_precedence` is not empty and its
+   * size differs from the number of columns of `keys`
+   *
+   * @param keys The table sorted according to `column_order` and `null_precedence`
+   * @param column_order Vector of column sort order
+   * @param null_precedence Vector of null_precedence enums of the keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  sorted_index(table_view const& keys,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Finds the smallest indices in the keys where the needles should be inserted to
+   * maintain order. The result is identical to `cudf::lower_bound(keys, needles, ...)`.
+   *
+   * @throws std::invalid_argument if `needles` and the keys have different numbers of columns
+   * @throws cudf::data_type_error if `needles` and the keys have different column types
+   *
+   * @param needles Values for which to find the insert locations in the keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of the insertion points
+   */
+  [[nodiscard]] std::unique_ptr<column> lower_bound(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Finds the largest indices in the keys where the needles should be inserted to
+   * maintain order. The result is identical to `cudf::upper_bound(keys, needles, ...)`.
+   *
+   * @throws std::invalid_argument if `needles` and the keys have different numbers of columns
+   * @throws cudf::data_type_error if `needles` and the keys have different column types
+   *
+   * @param needles Values for which to find the insert locations in the keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of the insertion points
+   */
+  [[nodiscard]] std::unique_ptr<column> upper_bound(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Checks if each needle is equal to a row of the keys
+   *
+   * Rows are compared as they are ordered, so a null needle matches a null key. The row of a
+   * needle found in the keys is the one returned for it by `lower_bound`.
+   *
+   * @code{.pseudo}
+   *   keys    = { 10, 20, 30, 40, 50 }
+   *   needles = { 20, 40, 60, 80 }
+   *   result  = { true, true, false, false }
+   * @endcode
+   *
+   * @throws std::invalid_argument if `needles` and the keys have different numbers of columns
+   * @throws cudf::data_type_error if `needles` and the keys have different column types
+   *
+   * @param needles Values to look for in the keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable BOOL8 column indicating if each needle is in the keys
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<detail::sorted_index const> _impl;
+};
+
+/**
+ * @brief Rows of a haystack table hashed once for repeated membership tests
+ *
+ * Checking whether the rows of a table are in another table builds a hash set over the haystack
+ * on every call. A `haystack_set` builds it once on construction, so that filters such as
+ * `IN (subquery)` applied to many batches of needles against the same haystack only probe it.
+ *
+ * @note The `haystack_set` object must not outlive the table viewed by `haystack`, else behavior
+ * is undefined.
+ */
+class haystack_set {
+ public:
+  haystack_set() = delete;
+  ~haystack_set();
+  haystack_set(haystack_set const&)            = delete;
+  haystack_set(haystack_set&&)                 = delete;
+  haystack_set& operator=(haystack_set const&) = delete;
+  haystack_set& operator=(haystack_set&&)      = delete;
+
+  /**
+   * @brief Builds the hash set of the rows of `haystack`
+   *
+   * @param haystack The table containing the search space
+   * @param compare_nulls Control whether nulls should be compared as equal or not
+   * @param compare_nans Control whether floating-point NaNs values should be compared as equal
+   *        or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  haystack_set(table_view const& haystack,
+               null_equality compare_nulls  = null_equality::EQUAL,
+               nan_equality compare_nans    = nan_equality::ALL_EQUAL,
+               rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Checks if each row of `needles` has a matching row in the haystack
+   *
+   * @code{.pseudo}
+   *   haystack = { { 5, 4, 1, 2, 3 } }
+   *   needles  = { { 0, 1, 2 } }
+   *   result   = { false, true, true }
+   * @endcode
+   *
+   * @throws std::invalid_argument if `needles` and the haystack have different numbers of columns
+   * @throws cudf::data_type_error if `needles` and the haystack have different column types
+   *
+   * @param needles A table of rows whose existence to check in the haystack
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable BOOL8 column indicating if each row of `needles` is in the haystack
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<detail::haystack_set const> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -23,6 +23,7 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -345,5 +346,157 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices of the first `k` rows of `keys` in a lexicographical sorted order
+ *
+ * The result is the first `k` indices of `stable_sorted_order(keys, column_order,
+ * null_precedence)`, without sorting all the rows when the keys are a single fixed-width column.
+ * If `k` is larger than the number of rows, all the rows are returned.
+ *
+ * @code{.pseudo}
+ * Example:
+ * keys = { {5, 8, 1, 9, 1, 3} }
+ * result = cudf::top_k(keys, 3, {cudf::order::DESCENDING});
+ * result is { 3, 1, 0 }
+ * @endcode
+ *
+ * @throws std::invalid_argument if `k` is negative.
+ *
+ * @param keys The table that determines the ordering
+ * @param k Number of rows to return
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the first `k` rows in sorted order
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the indices of the first `k` rows of each segment of `keys` in a lexicographical
+ * sorted order
+ *
+ * Segment `i` is the rows in `[segment_offsets[i], segment_offsets[i + 1])`. The result has a
+ * list of the indices of the first `min(k, size)` rows in stable sorted order for each segment.
+ *
+ * @code{.pseudo}
+ * Example:
+ * keys = { {9, 8, 7, 6, 5, 4, 3, 2, 1, 0} }
+ * offsets = {0, 3, 7, 10}
+ * result = cudf::segmented_top_k(keys, offsets, 2);
+ * result is { {2, 1}, {6, 5}, {9, 8} }
+ * @endcode
+ *
+ * @throws std::invalid_argument if `k` is negative.
+ * @throws cudf::logic_error if `segment_offsets` is not `size_type` column.
+ *
+ * @param keys The table that determines the ordering of elements in each segment
+ * @param segment_offsets The column of `size_type` type containing the offsets of the segments
+ * @param k Number of rows to return for each segment
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of the indices of the first `k` rows of each segment in sorted order
+ */
+std::unique_ptr<column> segmented_top_k(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Sorts tables larger than device memory by spilling sorted runs to host memory
+ *
+ * Each table passed to `add` is sorted on the device and spilled to pinned host memory as a
+ * sorted run. `next` then merges the runs with `cudf::merge`, loading only a bounded piece of
+ * each run at a time, and returns the sorted rows of all the added tables chunk by chunk.
+ * When there are too many runs to merge at once within the budget, groups of runs are first
+ * merged into longer runs spilled to host memory.
+ *
+ * @code{.pseudo}
+ * sorter = external_sorter({0}, {ASCENDING}, {}, budget)
+ * sorter.add([[5, 1, 4]])
+ * sorter.add([[3, 2]])
+ * sorter.next() = [[1, 2, 3, 4, 5]]   // in one or more chunks
+ * sorter.next() = nullptr
+ * @endcode
+ *
+ * The order of rows with equal keys is unspecified.
+ */
+class external_sorter {
+ public:
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&)            = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+
+  /**
+   * @brief Construct an external sorter of the rows of tables by some of their columns
+   *
+   * @throws std::invalid_argument if the device memory budget is zero
+   *
+   * @param key_columns Indices of the key columns of the tables
+   * @param column_order The desired order for each key column. Size must be equal to
+   * `key_columns.size()` or empty. If empty, all columns are sorted in ascending order.
+   * @param null_precedence The desired order of a null element compared to other elements for
+   * each key column. Size must be equal to `key_columns.size()` or empty. If empty, all columns
+   * will be sorted with `null_order::BEFORE`.
+   * @param device_memory_budget Approximate number of bytes of device memory used to merge the
+   * runs
+   */
+  external_sorter(std::vector<size_type> key_columns,
+                  std::vector<order> column_order,
+                  std::vector<null_order> null_precedence,
+                  std::size_t device_memory_budget);
+
+  /**
+   * @brief Sorts a table and spills its sorted rows to host memory
+   *
+   * The table is sorted on the device, so the table and its sorted copy must fit in device
+   * memory.
+   *
+   * @throws cudf::logic_error if `next` has already been called
+   *
+   * @param input Table of the rows to sort
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add(table_view const& input, rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the next chunk of the sorted rows of all the added tables
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The next sorted rows, or nullptr once all the rows have been returned
+   */
+  std::unique_ptr<table> next(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @addtogroup copy_split
+ * @{
+ * @file
+ * @brief Tables whose device data can be spilled to host memory
+ */
+
+namespace detail {
+struct spilled_data;
+}
+
+class spillable_table;
+
+/**
+ * @brief Spills the device data of the `spillable_table`s registered with it to host memory
+ *
+ * Tables are spilled least recently used first, where a table is used when it is created and
+ * each time it is pinned. `on_allocation_failure` has the signature of a
+ * `rmm::mr::failure_callback_t`, so that device memory is spilled whenever an allocation fails:
+ *
+ * @code{.pseudo}
+ * cudf::spill_manager manager;
+ * rmm::mr::failure_callback_resource_adaptor<> mr{
+ *   upstream, cudf::spill_manager::on_allocation_failure, &manager};
+ * rmm::mr::set_current_device_resource(&mr);
+ * @endcode
+ *
+ * The manager must outlive the tables registered with it. Its member functions may be called
+ * from any thread.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Construct a manager spilling tables on `stream`
+   *
+   * @param stream CUDA stream used for the copies of spilled tables to host memory
+   */
+  explicit spill_manager(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  spill_manager(spill_manager const&)            = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+
+  /**
+   * @brief Spills the tables which are not pinned, least recently used first, until at least
+   * `bytes` bytes of device memory are freed or no table is left to spill
+   *
+   * Tables which are being accessed by another thread are skipped.
+   *
+   * @param bytes The number of bytes of device memory to free
+   * @return The number of bytes of device memory freed
+   */
+  std::size_t spill(std::size_t bytes);
+
+  /**
+   * @brief Spills tables after a failed device memory allocation
+   *
+   * @param bytes The size of the failed allocation
+   * @param manager The `spill_manager` to spill the tables of
+   * @return true if some device memory was freed and the allocation should be retried
+   */
+  static bool on_allocation_failure(std::size_t bytes, void* manager);
+
+ private:
+  friend class spillable_table;
+
+  void add(spillable_table* table);
+  void remove(spillable_table* table);
+  void touch(spillable_table* table);
+
+  rmm::cuda_stream_view _stream;
+  std::mutex _mutex;
+  std::list<spillable_table*> _tables;  ///< registered tables, least recently used first
+};
+
+/**
+ * @brief A table packed in a single contiguous buffer which can be spilled to host memory
+ *
+ * Spilling copies the whole buffer to host memory in one transfer and frees its device memory;
+ * unspilling copies it back in one transfer. The table may only be viewed while it is pinned,
+ * so that neither `spill` nor a `spill_manager` frees the viewed device memory:
+ *
+ * @code{.pseudo}
+ * auto table = std::make_unique<cudf::spillable_table>(input, &manager);
+ * ...
+ * {
+ *   auto const pinned = table->pin();  // unspills the table if needed
+ *   process(pinned.view());
+ * }  // the table may be spilled again
+ * @endcode
+ *
+ * Member functions may be called from any thread.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Keeps a `spillable_table` on the device while it lives
+   */
+  class pinned_view {
+   public:
+    pinned_view(pinned_view const&)            = delete;
+    pinned_view& operator=(pinned_view const&) = delete;
+
+    /**
+     * @brief Move constructor
+     *
+     * @param other The pinned view to move from
+     */
+    pinned_view(pinned_view&& other) noexcept;
+
+    ~pinned_view();
+
+    /**
+     * @brief Returns the view of the pinned table
+     *
+     * @return The view of the pinned table, valid until this object is destroyed
+     */
+    [[nodiscard]] table_view view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+    pinned_view(spillable_table* table, table_view view);
+
+    spillable_table* _table;
+    table_view _view;
+  };
+
+  /**
+   * @brief Packs a copy of `input` into a single contiguous device buffer
+   *
+   * @param input The table to copy
+   * @param manager The manager which may spill this table, or nullptr if the table is only
+   *        spilled by calls to `spill`. It must outlive this table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the packed buffer
+   */
+  spillable_table(table_view const& input,
+                  spill_manager* manager            = nullptr,
+                  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Takes ownership of the result of `cudf::pack`
+   *
+   * @throws std::invalid_argument If `packed` was compressed with `compress_packed`
+   *
+   * @param packed The packed table
+   * @param manager The manager which may spill this table, or nullptr if the table is only
+   *        spilled by calls to `spill`. It must outlive this table.
+   */
+  explicit spillable_table(packed_columns&& packed, spill_manager* manager = nullptr);
+
+  spillable_table(spillable_table const&)            = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+
+  ~spillable_table();
+
+  /**
+   * @brief Returns true if the data of the table is in host memory
+   *
+   * @return true if the data of the table is in host memory
+   */
+  [[nodiscard]] bool is_spilled() const;
+
+  /**
+   * @brief Returns the size of the packed data of the table
+   *
+   * @return The size in bytes of the packed data of the table
+   */
+  [[nodiscard]] std::size_t size_bytes() const;
+
+  /**
+   * @brief Copies the data of the table to host memory and frees its device memory
+   *
+   * Does nothing if the table is spilled or pinned.
+   *
+   * @param stream CUDA stream used for the copy
+   * @return The number of bytes of device memory freed
+   */
+  std::size_t spill(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Copies the data of the table back to device memory if it is spilled, and keeps it
+   * there while the returned object lives
+   *
+   * @param stream CUDA stream used for the copy
+   * @param mr Device memory resource used to allocate the unspilled buffer
+   * @return The pinned table
+   */
+  [[nodiscard]] pinned_view pin(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Releases the packed data of the table, unspilling it if needed
+   *
+   * The table is left empty.
+   *
+   * @throws cudf::logic_error If the table is pinned
+   *
+   * @param stream CUDA stream used for the copy
+   * @param mr Device memory resource used to allocate the unspilled buffer
+   * @return The packed table, which can be passed to `cudf::unpack`
+   */
+  [[nodiscard]] packed_columns release(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+ private:
+  friend class spill_manager;
+
+  std::size_t spill_unlocked(rmm::cuda_stream_view stream);
+  void unspill_unlocked(rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr);
+  void unpin();
+
+  spill_manager* _manager;
+  // recursive so that a manager spilling tables after a failed allocation made while unspilling
+  // this table on the same thread does not deadlock
+  mutable std::recursive_mutex _mutex;
+  std::unique_ptr<std::vector<uint8_t>> _metadata;
+  std::unique_ptr<rmm::device_buffer> _device_data;  ///< nullptr while the table is spilled
+  std::unique_ptr<detail::spilled_data> _host_data;  ///< nullptr unless the table is spilled
+  std::size_t _size_bytes;
+  int _pin_count{0};
+};
+
+/** @} */
+}  // namespace cudf
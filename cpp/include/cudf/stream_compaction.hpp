@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -208,6 +211,140 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Filters `input` by a predicate expression evaluated on its rows.
+ *
+ * Row `i` of `input` is copied to the output if `predicate` evaluates to a non-null `true` for
+ * row `i`. Column references in `predicate` refer to the columns of `input`. This operation is
+ * stable: the input order is preserved.
+ *
+ * This is equivalent to `apply_boolean_mask(input, compute_column(input, predicate))`, but the
+ * predicate is evaluated once per row into a bitmask of the passing rows instead of being
+ * materialized as a nullable BOOL8 column.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to `type_id::BOOL8`.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicate The boolean expression selecting the rows to keep
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing @p predicate
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The rows of a table selected by one or more filters, stored as one bit per row.
+ *
+ * A selection vector lets a chain of filters narrow down the rows of a table without copying
+ * the table at each step. The selected rows are only gathered, by `apply_selection`, once a
+ * consumer needs materialized columns.
+ */
+struct selection_vector {
+  rmm::device_buffer mask;  ///< Bitmask with bit `i` set if row `i` is selected
+  size_type size;           ///< Number of rows of the table the selection applies to
+  size_type num_selected;   ///< Number of selected rows
+};
+
+/**
+ * @brief Selects the rows for which `boolean_mask` is non-null and `true`.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows passing @p boolean_mask
+ */
+selection_vector make_selection(
+  column_view const& boolean_mask,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Selects the rows of `input` for which `predicate` evaluates to a non-null `true`.
+ *
+ * Column references in `predicate` refer to the columns of `input`.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to `type_id::BOOL8`.
+ *
+ * @param[in] input The table the predicate is evaluated on
+ * @param[in] predicate The boolean expression selecting the rows
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows passing @p predicate
+ */
+selection_vector make_selection(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Narrows `selection` down to the selected rows for which `boolean_mask` is non-null and
+ * `true`.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if `boolean_mask.size() != selection.size`.
+ *
+ * @param[in] selection The current selection
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows passing both @p selection and @p boolean_mask
+ */
+selection_vector refine_selection(
+  selection_vector const& selection,
+  column_view const& boolean_mask,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Narrows `selection` down to the selected rows of `input` for which `predicate`
+ * evaluates to a non-null `true`.
+ *
+ * `predicate` is only evaluated on the selected rows.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to `type_id::BOOL8`.
+ * @throws cudf::logic_error if `input.num_rows() != selection.size`.
+ *
+ * @param[in] selection The current selection
+ * @param[in] input The table the predicate is evaluated on
+ * @param[in] predicate The boolean expression selecting the rows
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows passing both @p selection and @p predicate
+ */
+selection_vector refine_selection(
+  selection_vector const& selection,
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Copies the selected rows of `input` into a new table.
+ *
+ * This operation is stable: the input order is preserved.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != selection.size`.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] selection The rows to copy
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of the selected rows of @p input
+ */
+std::unique_ptr<table> apply_selection(
+  table_view const& input,
+  selection_vector const& selection,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the indices of the selected rows, in increasing order.
+ *
+ * The result can be used as a gather map by consumers that gather the rows themselves.
+ *
+ * @param[in] selection The selection
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of the `selection.num_selected` selected row indices
+ */
+std::unique_ptr<column> selection_to_indices(
+  selection_vector const& selection,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -301,6 +438,65 @@ std::unique_ptr<column> distinct_indices(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows using precomputed hash values of the keys.
+ *
+ * This is the same as `cudf::distinct` except the keys are not hashed again. Pipelines that
+ * use the same keys in several operations can hash them once, for example with
+ * `cudf::hashing::murmurhash3_x86_32(input.select(keys))`, and pass the result here.
+ *
+ * Rows with equal keys must have equal hash values. Any hash function applied to the key
+ * columns satisfies this.
+ *
+ * @throw std::invalid_argument if `key_hashes` is not a UINT32 column without nulls having
+ *        the same number of rows as `input`
+ *
+ * @param input The input table
+ * @param keys Vector of indices indicating key columns in the `input` table
+ * @param key_hashes Hash value of the keys of each row of `input`
+ * @param keep Copy any, first, last, or none of the found duplicates
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param mr Device memory resource used to allocate the returned table
+ * @return Table with distinct rows in an unspecified order
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  column_view const& key_hashes,
+  duplicate_keep_option keep        = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal         = null_equality::EQUAL,
+  nan_equality nans_equal           = nan_equality::ALL_EQUAL,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of indices of all distinct rows using precomputed hash values
+ * of the rows.
+ *
+ * This is the same as `cudf::distinct_indices` except the rows are not hashed again.
+ * Rows that are equal must have equal hash values.
+ *
+ * @throw std::invalid_argument if `row_hashes` is not a UINT32 column without nulls having
+ *        the same number of rows as `input`
+ *
+ * @param input The input table
+ * @param row_hashes Hash value of each row of `input`
+ * @param keep Get index of any, first, last, or none of the found duplicates
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ * @return Column containing the result indices
+ */
+std::unique_ptr<column> distinct_indices(
+  table_view const& input,
+  column_view const& row_hashes,
+  duplicate_keep_option keep        = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal         = null_equality::EQUAL,
+  nan_equality nans_equal           = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create a new table without duplicate rows, preserving input order.
  *
@@ -398,5 +594,45 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Estimate the number of distinct rows in a table.
+ *
+ * The estimate is computed by a HyperLogLog sketch of the hashes of the rows, with `2^precision`
+ * registers. Its relative standard error is about `1.04 / sqrt(2^precision)`, i.e. 1.6% for the
+ * default precision, and it uses far less memory than the hash table of `distinct_count`.
+ *
+ * `null`s are handled as equal. If `null_handling` is null_policy::EXCLUDE, the rows with a
+ * `null` element are not counted.
+ *
+ * @throw std::invalid_argument if `precision` is not in the range [4, 18]
+ *
+ * @param[in] input Table whose distinct rows will be counted
+ * @param[in] precision The number of bits of the row hashes that select a register
+ * @param[in] null_handling flag to include or ignore rows with `null`s while counting
+ *
+ * @return estimated number of distinct rows in the table
+ */
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision         = 12,
+                                      null_policy null_handling = null_policy::INCLUDE);
+
+/**
+ * @brief Estimate the number of distinct values summarized by each HyperLogLog++ sketch.
+ *
+ * The sketches are the output of `HLLPP` or `MERGE_HLLPP` aggregations: lists of `2^precision`
+ * INT8 registers. The estimate uses the register histogram based estimator of Ertl, which is
+ * unbiased over the whole range of cardinalities without empirical bias-correction tables.
+ *
+ * @throw std::invalid_argument if `sketches` is not a lists column of INT8 registers, or if a
+ * non-null sketch does not have `2^precision` registers for a precision in [4, 18]
+ *
+ * @param sketches The sketches to estimate
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of the estimated distinct count of each sketch, null for null sketches
+ */
+std::unique_ptr<column> estimate_distinct_count(
+  lists_column_view const& sketches,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
@@ -75,6 +75,36 @@ std::unique_ptr<column> from_floats(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new strings column converting the float values from the
+ * provided column into the shortest strings that convert back to the same values.
+ *
+ * Any null entries will result in corresponding null entries in the output column.
+ *
+ * Each string has the fewest significant digits needed for `to_floats` with the
+ * same float type to return exactly the original value. When several strings have
+ * that many digits, the one closest to the value is used.
+ * Negative numbers will include a '-' prefix.
+ * Values below 1e-4 or at least 1e9 use scientific notation (e.g. "-1.78e+15").
+ *
+ * @code{.pseudo}
+ * f = [0.1, 1.1, -12761.125, 1e22]
+ * s = from_floats_shortest(f)
+ * s is ['0.1', '1.1', '-12761.125', '1.0e+22']
+ * @endcode
+ *
+ * @throw cudf::logic_error if floats column is not float type.
+ *
+ * @param floats Numeric column to convert
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column with floats as strings
+ */
+std::unique_ptr<column> from_floats_shortest(
+  column_view const& floats,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a boolean column identifying strings in which all
  * characters are valid for conversion to floats.
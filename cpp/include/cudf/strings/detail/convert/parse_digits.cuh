@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Number of digits decoded by `parse_eight_digits`
+ */
+constexpr int swar_digits = 8;
+
+/**
+ * @brief Loads 8 bytes into an integer with the first byte in the lowest bits
+ *
+ * The bytes need not be aligned.
+ *
+ * @param ptr First of the 8 bytes to load
+ * @return The loaded bytes
+ */
+CUDF_HOST_DEVICE inline uint64_t load_eight_bytes(char const* ptr)
+{
+  uint64_t chunk = 0;
+  for (int idx = 0; idx < swar_digits; ++idx) {
+    chunk |= static_cast<uint64_t>(static_cast<uint8_t>(ptr[idx])) << (8 * idx);
+  }
+  return chunk;
+}
+
+/**
+ * @brief Returns true if all 8 bytes loaded by `load_eight_bytes` are the characters [0-9]
+ */
+CUDF_HOST_DEVICE inline bool is_eight_digits(uint64_t chunk)
+{
+  // the high nibble of a digit is 3 and adding 6 to its low nibble must not carry into it
+  return ((chunk & 0xF0F0'F0F0'F0F0'F0F0UL) == 0x3030'3030'3030'3030UL) &&
+         (((chunk + 0x0606'0606'0606'0606UL) & 0xF0F0'F0F0'F0F0'F0F0UL) == 0x3030'3030'3030'3030UL);
+}
+
+/**
+ * @brief Converts 8 digit characters loaded by `load_eight_bytes` into their integer value
+ *
+ * All the digits are combined with 3 multiplications instead of 8 dependent ones.
+ *
+ * Precondition: `is_eight_digits(chunk)` is true.
+ *
+ * @param chunk The 8 digit characters
+ * @return Value of the digits in the range [0, 99999999]
+ */
+CUDF_HOST_DEVICE inline uint32_t parse_eight_digits(uint64_t chunk)
+{
+  constexpr uint64_t mask = 0x0000'00FF'0000'00FFUL;
+  constexpr uint64_t mul1 = 100 + (1'000'000UL << 32);
+  constexpr uint64_t mul2 = 1 + (10'000UL << 32);
+  chunk -= 0x3030'3030'3030'3030UL;
+  // combine adjacent digits into 2-digit values
+  chunk = (chunk * 10) + (chunk >> 8);
+  // combine the 2-digit values into the final value in the upper 32 bits
+  chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+  return static_cast<uint32_t>(chunk);
+}
+
+/**
+ * @brief Accumulates runs of 8 digit characters into `value`
+ *
+ * Parsing stops before the first group of 8 bytes that are not all digits so the
+ * caller can finish the remaining characters one at a time.
+ *
+ * @tparam T Integer or floating-point type of the value
+ * @param ptr Pointer to the next character; advanced past the parsed digits
+ * @param end Pointer to the end of the characters
+ * @param value Value to accumulate the digits into
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline void parse_digits_by_eight(char const*& ptr, char const* end, T& value)
+{
+  while ((end - ptr) >= swar_digits) {
+    auto const chunk = load_eight_bytes(ptr);
+    if (!is_eight_digits(chunk)) { break; }
+    value = (value * static_cast<T>(100'000'000)) + static_cast<T>(parse_eight_digits(chunk));
+    ptr += swar_digits;
+  }
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
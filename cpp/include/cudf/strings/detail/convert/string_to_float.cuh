@@ -15,6 +15,7 @@
  */
 
 #include <cudf/strings/detail/convert/is_float.cuh>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/string_view.cuh>
 
 #include <cmath>
@@ -65,6 +66,16 @@ __device__ inline double stod(string_view const& d_str)
   int exp_off     = 0;
   bool decimal    = false;
   while (in_ptr < end) {
+    // consume 8 digits at once while they cannot exceed the limit
+    if ((end - in_ptr) >= swar_digits && digits < 10'000'000'000UL) {
+      auto const chunk = load_eight_bytes(in_ptr);
+      if (is_eight_digits(chunk)) {
+        digits = (digits * 100'000'000UL) + parse_eight_digits(chunk);
+        exp_off -= decimal ? swar_digits : 0;
+        in_ptr += swar_digits;
+        continue;
+      }
+    }
     char ch = *in_ptr;
     if (ch == '.') {
       decimal = true;
@@ -110,6 +121,17 @@ __device__ inline double stod(string_view const& d_str)
     }
   }
 
+  // an exact mantissa and an exact power of ten need a single correctly rounded operation
+  auto const exponent = (exp_ten * exp_sign) + exp_off;
+  if ((digits <= (uint64_t{1} << 53)) && (exponent >= -22) && (exponent <= 22)) {
+    double power = 1.0;
+    for (int idx = 0; idx < std::abs(exponent); ++idx) {
+      power *= 10.0;
+    }
+    double const base = sign * static_cast<double>(digits);
+    return exponent < 0 ? base / power : base * power;
+  }
+
   int const num_digits = static_cast<int>(log10(static_cast<double>(digits))) + 1;
   exp_ten *= exp_sign;
   exp_ten += exp_off;
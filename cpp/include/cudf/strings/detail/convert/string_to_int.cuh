@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/string_view.cuh>
 
 namespace cudf {
@@ -41,7 +42,9 @@ __device__ inline int64_t string_to_integer(string_view const& d_str)
     ++ptr;
     --bytes;
   }
-  for (size_type idx = 0; idx < bytes; ++idx) {
+  auto const end = ptr + bytes;
+  parse_digits_by_eight(ptr, end, value);
+  while (ptr < end) {
     char chr = *ptr++;
     if (chr < '0' || chr > '9') break;
     value = (value * 10) + static_cast<int64_t>(chr - '0');
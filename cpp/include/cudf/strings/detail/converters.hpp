@@ -64,6 +64,14 @@ std::unique_ptr<column> from_floats(column_view const& floats,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc from_floats_shortest(column_view const&,rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> from_floats_shortest(column_view const& floats,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc to_booleans(strings_column_view const&,string_scalar
  * const&,rmm::device_async_resource_ref)
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/literal_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -48,6 +49,16 @@ std::unique_ptr<column> replace(strings_column_view const& strings,
                                 rmm::cuda_stream_view stream,
                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::strings::replace(strings_column_view const&, literal_program const&,
+ * strings_column_view const&, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> replace(strings_column_view const& input,
+                                literal_program const& prog,
+                                strings_column_view const& repls,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr);
+
 /**
  * @brief Replaces any null string entries with the given string.
  *
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Fixed-size summary of a string holding its size and its first 12 bytes
+ *
+ * This is the inline part of the Arrow `StringView` layout. Two strings whose
+ * prefixes differ are not equal, and two strings of at most `inline_size` bytes
+ * are equal if their prefixes are equal, so most equality checks never read the
+ * offsets or chars of the column.
+ *
+ * Null rows have a size that no valid string can have.
+ */
+struct alignas(16) string_prefix {
+  static constexpr size_type inline_size = 12;            ///< bytes held by the prefix
+  static constexpr uint32_t null_size    = ~uint32_t{0};  ///< size of null rows
+
+  uint64_t head;  ///< size in the upper 32 bits and the first 4 bytes in the lower 32 bits
+  uint64_t tail;  ///< the next 8 bytes
+
+  /**
+   * @brief Returns true if the prefix holds the entire valid string
+   */
+  __device__ inline bool is_inline() const
+  {
+    return static_cast<uint32_t>(head >> 32) <= static_cast<uint32_t>(inline_size);
+  }
+
+  __device__ inline bool operator==(string_prefix const& rhs) const
+  {
+    return head == rhs.head and tail == rhs.tail;
+  }
+};
+
+/**
+ * @brief Returns the prefix of the string at each row of a strings column
+ */
+struct string_prefix_fn {
+  column_device_view d_strings;
+
+  __device__ string_prefix operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) {
+      return string_prefix{static_cast<uint64_t>(string_prefix::null_size) << 32, 0};
+    }
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const bytes  = reinterpret_cast<uint8_t const*>(d_str.data());
+    auto const size   = d_str.size_bytes();
+    uint64_t words[2] = {0, 0};
+    for (size_type b = 0; b < string_prefix::inline_size && b < size; ++b) {
+      auto const pos = b + 4;  // the first word starts after the size
+      words[pos / 8] |= static_cast<uint64_t>(bytes[b]) << (8 * (pos % 8));
+    }
+    return string_prefix{words[0] | (static_cast<uint64_t>(size) << 32), words[1]};
+  }
+};
+
+/**
+ * @brief Builds the prefix of each row of a strings column
+ *
+ * @param input Strings column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ * @return One prefix per row of `input`
+ */
+inline rmm::device_uvector<string_prefix> make_string_prefixes(column_view const& input,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::device_async_resource_ref mr)
+{
+  auto prefixes        = rmm::device_uvector<string_prefix>(input.size(), stream, mr);
+  auto const d_strings = column_device_view::create(input, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(input.size()),
+                    prefixes.begin(),
+                    string_prefix_fn{*d_strings});
+  return prefixes;
+}
+
+/**
+ * @brief Row equality comparator for a single strings column that checks the string
+ * prefixes before calling the full comparator
+ *
+ * Rows with different prefixes are unequal. Rows with equal inline prefixes are equal.
+ * All other rows, including pairs of null rows, are decided by `equal` so the null
+ * equality of the wrapped comparator is preserved.
+ *
+ * @tparam Equal Row equality comparator for the same rows
+ */
+template <typename Equal>
+struct string_prefix_equal_fn {
+  string_prefix const* prefixes;
+  Equal equal;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    auto const lhs_prefix = prefixes[lhs];
+    if (!(lhs_prefix == prefixes[rhs])) { return false; }
+    return lhs_prefix.is_inline() || equal(lhs, rhs);
+  }
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -24,12 +24,16 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/device/device_memcpy.cuh>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <limits>
 #include <stdexcept>
 
 namespace cudf {
@@ -193,6 +197,111 @@ auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
   return std::pair(std::move(offsets_column), std::move(chars));
 }
 
+/**
+ * @brief Creates child offsets and chars data by calling the given function only once
+ * for each string
+ *
+ * This is an alternative to make_strings_children for functions that are expensive
+ * to run twice and whose output size has a cheap upper bound per row.
+ * Each row is written into its own over-allocated slot of a temporary buffer sized
+ * by the bounds and the rows are then compacted into the returned chars vector.
+ *
+ * The `size_and_exec_fn` has the same members as for make_strings_children but it is
+ * only called with `d_chars != nullptr` and must set `d_sizes[idx]` in that call
+ * as well as write the output to `d_chars + d_offsets[idx]`. Functions that always
+ * set `d_sizes` can be used with either builder.
+ *
+ * If the bounds total more than a `size_type` can hold, the temporary buffer would be
+ * too large and make_strings_children is called instead.
+ *
+ * @tparam SizeAndExecuteFunction Functor type with an operator() function accepting
+ *         an index parameter and three member variables: `size_type* d_sizes`
+ *         `char* d_chars`, and `input_offsetalator d_offsets`.
+ * @tparam BoundIterator Iterator returning the maximum output size in bytes of each row
+ *
+ * @param size_and_exec_fn This is called once to fill in `d_sizes` and `d_chars`
+ * @param bounds Maximum output size in bytes of each row
+ * @param strings_count Number of strings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Offsets child column and chars vector for creating a strings column
+ */
+template <typename SizeAndExecuteFunction, typename BoundIterator>
+auto make_strings_children_bounded(SizeAndExecuteFunction size_and_exec_fn,
+                                   BoundIterator bounds,
+                                   size_type strings_count,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  // Compute the offsets of each row's slot in the temporary buffer
+  auto bound_offsets = rmm::device_uvector<int64_t>(strings_count + 1, stream);
+  auto map_fn        = cuda::proclaim_return_type<int64_t>(
+    [bounds, strings_count] __device__(size_type idx) -> int64_t {
+      return idx < strings_count ? static_cast<int64_t>(bounds[idx]) : int64_t{0};
+    });
+  auto bounds_itr        = cudf::detail::make_counting_transform_iterator(0, map_fn);
+  auto const bound_bytes = cudf::detail::sizes_to_offsets(
+    bounds_itr, bounds_itr + strings_count + 1, bound_offsets.begin(), stream);
+  if (bound_bytes > static_cast<int64_t>(std::numeric_limits<size_type>::max())) {
+    return make_strings_children(size_and_exec_fn, strings_count, strings_count, stream, mr);
+  }
+
+  // Write each row into its slot while recording the output sizes
+  auto output_sizes = rmm::device_uvector<size_type>(strings_count, stream);
+  auto buffer       = rmm::device_uvector<char>(bound_bytes, stream);
+  auto const bound_offsets_view =
+    column_view(data_type{type_id::INT64}, strings_count + 1, bound_offsets.data(), nullptr, 0);
+  size_and_exec_fn.d_sizes = output_sizes.data();
+  size_and_exec_fn.d_chars = buffer.data();
+  size_and_exec_fn.d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(bound_offsets_view);
+  if (strings_count > 0) {
+    auto constexpr block_size = 256;
+    auto grid                 = cudf::detail::grid_1d{strings_count, block_size};
+    strings_children_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(size_and_exec_fn,
+                                                                                strings_count);
+  }
+
+  // Compact the rows into the output chars
+  auto [offsets_column, bytes] = cudf::strings::detail::make_offsets_child_column(
+    output_sizes.begin(), output_sizes.end(), stream, mr);
+  auto chars = rmm::device_uvector<char>(bytes, stream, mr);
+  if (bytes > 0) {
+    auto const d_offsets =
+      cudf::detail::offsetalator_factory::make_input_iterator(offsets_column->view());
+    auto const d_slots = bound_offsets.data();
+    auto const d_src   = buffer.data();
+    auto const d_dst   = chars.data();
+    auto const d_sizes = output_sizes.data();
+    auto src_it        = cudf::detail::make_counting_transform_iterator(
+      0, cuda::proclaim_return_type<char*>([d_src, d_slots] __device__(size_type idx) {
+        return d_src + d_slots[idx];
+      }));
+    auto dst_it = cudf::detail::make_counting_transform_iterator(
+      0, cuda::proclaim_return_type<char*>([d_dst, d_offsets] __device__(size_type idx) {
+        return d_dst + d_offsets[idx];
+      }));
+    auto size_it = cudf::detail::make_counting_transform_iterator(
+      0, cuda::proclaim_return_type<size_type>([d_sizes] __device__(size_type idx) {
+        return d_sizes[idx];
+      }));
+
+    std::size_t temp_storage_bytes = 0;
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(
+      nullptr, temp_storage_bytes, src_it, dst_it, size_it, strings_count, stream.value()));
+    rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp_storage.data(),
+                                             temp_storage_bytes,
+                                             src_it,
+                                             dst_it,
+                                             size_it,
+                                             strings_count,
+                                             stream.value()));
+  }
+
+  return std::pair(std::move(offsets_column), std::move(chars));
+}
+
 /**
  * @brief Creates child offsets and chars columns by applying the template function that
  * can be used for computing the output size of each string as well as create the output
@@ -23,6 +23,9 @@
 
 namespace cudf {
 namespace strings {
+
+struct literal_program;
+
 /**
  * @addtogroup strings_find
  * @{
@@ -61,6 +64,34 @@ std::unique_ptr<column> find_multiple(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a boolean column identifying rows which contain any of the
+ * targets of the given literal_program
+ *
+ * Each string is scanned only once regardless of the number of targets.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "def", "xyz"]
+ * p = literal_program::create(["b", "yz", "q"])
+ * r = contains_any(s, p)
+ * r is now [true, false, true]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param input Strings instance for this operation
+ * @param prog Program created from the strings to search for in each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column of boolean results for each string
+ */
+std::unique_ptr<column> contains_any(
+  strings_column_view const& input,
+  literal_program const& prog,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
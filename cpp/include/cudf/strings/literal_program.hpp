@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @addtogroup strings_find
+ * @{
+ */
+
+/**
+ * @brief Multiple literal search program class
+ *
+ * Create an instance from a set of target strings and use it to call the appropriate
+ * strings APIs. An instance can be reused.
+ *
+ * The targets are compiled into an Aho-Corasick automaton so that each string is
+ * searched for all targets in a single pass over its bytes.
+ */
+struct literal_program {
+  struct literal_program_impl;
+
+  /**
+   * @brief Create a program from a set of target strings
+   *
+   * @throw std::invalid_argument if `targets` is empty or contains nulls or empty strings
+   *
+   * @param targets Strings to search for
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the program's device memory
+   * @return Instance of this object
+   */
+  static std::unique_ptr<literal_program> create(
+    strings_column_view const& targets,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Move constructor
+   *
+   * @param other Object to move from
+   */
+  literal_program(literal_program&& other);
+
+  /**
+   * @brief Move operator assignment
+   *
+   * @param other Object to move from
+   * @return this object
+   */
+  literal_program& operator=(literal_program&& other);
+
+  /**
+   * @brief Return the number of target strings in this instance
+   *
+   * @return Number of targets
+   */
+  size_type targets_count() const;
+
+  /**
+   * @brief Return the number of automaton states in this instance
+   *
+   * @return Number of states
+   */
+  size_type states_count() const;
+
+  ~literal_program();
+
+ private:
+  literal_program() = delete;
+
+  std::unique_ptr<literal_program_impl> _impl;
+
+  /**
+   * @brief Constructor
+   *
+   * Called by create()
+   */
+  literal_program(std::unique_ptr<literal_program_impl>&& impl);
+
+  friend struct literal_device_builder;
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
@@ -17,6 +17,9 @@
 
 #include <cudf/strings/regex/flags.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
 #include <string>
@@ -112,6 +115,39 @@ struct regex_program {
    */
   std::size_t compute_working_memory_size(int32_t num_strings) const;
 
+  /**
+   * @brief Keep a device copy of this program and working memory for reuse by later calls
+   *
+   * Without this, every API call using this program copies the program to device memory
+   * and allocates new working memory. After this call, API calls reuse the device copy.
+   * API calls on `stream` also reuse the working memory if they need no more than is
+   * required for `num_strings` strings. Calling this again with a different stream adds
+   * working memory for that stream. Calling this again with the same stream replaces its
+   * working memory.
+   *
+   * The device memory is kept until release_device_program() is called or this
+   * instance is destroyed.
+   *
+   * @param num_strings Number of strings the working memory should support
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void cache_device_program(size_type num_strings,
+                            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Free the device memory kept by cache_device_program()
+   *
+   * All work using this program must be complete before calling this.
+   */
+  void release_device_program();
+
+  /**
+   * @brief Return true if a device copy of this program is cached
+   *
+   * @return true if cache_device_program() was called since the last release
+   */
+  bool is_device_program_cached() const;
+
   ~regex_program();
 
  private:
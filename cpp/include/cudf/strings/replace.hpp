@@ -24,6 +24,9 @@
 
 namespace cudf {
 namespace strings {
+
+struct literal_program;
+
 /**
  * @addtogroup strings_replace
  * @{
@@ -160,6 +163,45 @@ std::unique_ptr<column> replace(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces substrings matching the targets of a literal_program with the
+ * corresponding replacement strings.
+ *
+ * This produces the same result as the replace() API above with the targets used
+ * to create `prog`. Each string is scanned only once regardless of the number of targets
+ * which makes this faster for large target lists. The program can be reused across calls.
+ *
+ * Null string entries will return null output string entries.
+ *
+ * The repls argument can optionally contain a single string. In this case, all
+ * matching target substrings will be replaced by that single string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "goodbye"]
+ * p = literal_program::create(["e","oo"])
+ * repls = ["33",""]
+ * r = replace(s,p,repls)
+ * r is now ["h33llo", "gdby33"]
+ * @endcode
+ *
+ * @throw std::invalid_argument if repls contains null entries or its size is neither 1 nor
+ * the number of targets in `prog`
+ *
+ * @param input Strings column for this operation
+ * @param prog Program created from the strings to search for in each string
+ * @param repls Corresponding replacement strings for the targets
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+std::unique_ptr<column> replace(
+  strings_column_view const& input,
+  literal_program const& prog,
+  strings_column_view const& repls,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
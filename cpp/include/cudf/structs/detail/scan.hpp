@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -32,12 +33,14 @@ namespace detail {
  * @tparam Op Either DeviceMin or DeviceMax operations
  *
  * @param input Input column
+ * @param mask Null mask of the output; the children of its null rows are made null
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return New struct column
  */
 template <typename Op>
 std::unique_ptr<column> scan_inclusive(column_view const& input,
+                                       bitmask_type const* mask,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
@@ -18,6 +18,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/algorithm.cuh>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/hashing/detail/default_hash.cuh>
@@ -947,6 +948,9 @@ struct preprocessed_table {
   // integers columns using `cudf::rank()`, need to be kept alive.
   std::vector<std::unique_ptr<column>> _transformed_columns;
 
+  // Struct columns flattened into their validity and their children, need to be kept alive.
+  std::unique_ptr<structs::detail::flattened_table> _flattened_input;
+
   // Flag to record if the input table was preprocessed to transform any nested children column(s)
   // into integer column(s) using `cudf::rank`.
   bool const _has_ranked_children;
@@ -15,6 +15,11 @@
  */
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -52,4 +57,51 @@ std::unique_ptr<table> make_timezone_transition_table(
   std::string_view timezone_name,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts wall-clock timestamps from one timezone to another.
+ *
+ * Each timestamp is read as the local time in `from_timezone`, converted to UTC, and returned as
+ * the local time of that instant in `to_timezone`. A local time that occurs twice when clocks go
+ * back is read as the earlier of its two instants. A local time that is skipped when clocks go
+ * forward is read with the offset in effect before the change. "UTC" or an empty name denotes
+ * UTC.
+ *
+ * The transition tables of both timezones are taken from a cache of device-resident tables shared
+ * by the process, so the TZif file of a timezone is read once per device rather than once per
+ * call. See `clear_timezone_transition_table_cache()`.
+ *
+ * @code{.pseudo}
+ * timestamps = [2024-01-15 12:00:00, 2024-07-15 12:00:00]
+ * result     = convert_timezone(timestamps, "America/New_York", "UTC")
+ * result is [2024-01-15 17:00:00, 2024-07-15 16:00:00]
+ * @endcode
+ *
+ * @throws cudf::data_type_error if `timestamps` is not a timestamp column of seconds or a finer
+ *         resolution
+ * @throws cudf::logic_error if the TZif file of either timezone cannot be read
+ *
+ * @param timestamps Wall-clock times in `from_timezone`
+ * @param from_timezone Standard timezone name of the input (for example, "America/Los_Angeles")
+ * @param to_timezone Standard timezone name of the output
+ * @param tzif_dir The directory where the TZif files are located; the system's by default
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Wall-clock times in `to_timezone`, with the type and null mask of `timestamps`
+ */
+std::unique_ptr<column> convert_timezone(
+  column_view const& timestamps,
+  std::string_view from_timezone,
+  std::string_view to_timezone,
+  std::optional<std::string_view> tzif_dir = std::nullopt,
+  rmm::cuda_stream_view stream             = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr        = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Releases the device memory of the cached timezone transition tables.
+ *
+ * The cache is filled by `convert_timezone()` and by the ORC reader. Tables still in use by a
+ * running call are released when that call completes.
+ */
+void clear_timezone_transition_table_cache();
+
 }  // namespace cudf
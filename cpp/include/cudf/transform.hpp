@@ -23,6 +23,8 @@
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 /**
@@ -57,6 +59,53 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates several new columns by applying a validity-aware unary function against every
+ * element of an input column in a single kernel launch.
+ *
+ * The CUDA function receives a pointer to the row of each output, an array of output validities
+ * and the input value with its validity:
+ * ```
+ * __device__ void f(TypeOut0* out0, ..., TypeOutN* outN, bool* out_valid, TypeIn in, bool in_valid)
+ * ```
+ * `out_valid[k]` is initialized to `in_valid`, so nulls propagate from the input unless the
+ * function sets a different validity for output `k`. The value of `in` is undefined when
+ * `in_valid` is false.
+ *
+ * @throws cudf::logic_error if `input` or any of `output_types` is not a fixed-width type
+ * @throws std::invalid_argument if `output_types` is empty
+ *
+ * @param input         An immutable view of the input column to transform
+ * @param udf           The CUDA string of the validity-aware unary function to apply
+ * @param output_types  The output types, compatible with the output pointers of the UDF in order
+ * @param mr            Device memory resource used to allocate the returned columns' device memory
+ * @return              One column per entry of `output_types`
+ */
+std::vector<std::unique_ptr<column>> null_aware_transform(
+  column_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compiles the kernel `cudf::transform` uses for a unary function without running it.
+ *
+ * Warming the kernels of known functions at startup moves their compilation out of the first
+ * call to `cudf::transform`. Compiled kernels are also stored in the JIT kernel cache directory,
+ * see `cudf::get_kernel_cache_statistics`.
+ *
+ * @throws cudf::logic_error if `input_type` is not a fixed-width type
+ *
+ * @param input_type    The type of the columns the function will be applied to
+ * @param unary_udf     The PTX/CUDA string of the unary function
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ */
+void warm_transform(data_type input_type,
+                    std::string const& unary_udf,
+                    data_type output_type,
+                    bool is_ptx);
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -90,6 +139,48 @@ std::unique_ptr<column> compute_column(
   ast::expression const& expr,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Selects how `compute_column` evaluates an expression
+ */
+enum class ast_evaluation : int32_t {
+  INTERPRETED,           ///< Evaluate the linearized expression with the generic device interpreter
+  JIT,                   ///< Generate and JIT-compile a kernel specialized for the expression
+  INTERPRETED_MULTI_ROW  ///< Interpret the expression for several rows per operator step
+};
+
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table.
+ *
+ * With `ast_evaluation::JIT`, CUDA source for the whole expression is generated from the parsed
+ * plan and compiled into one fused kernel, so no operator is dispatched per row and no
+ * intermediate is staged in shared memory. The source depends only on the shape of the
+ * expression and on the column and literal types, not on the literal values, so compiled kernels
+ * are reused through the JIT program cache for every expression of the same shape. The first
+ * evaluation of a new shape pays the compilation cost.
+ *
+ * With `ast_evaluation::INTERPRETED_MULTI_ROW`, each thread of the interpreter evaluates a batch
+ * of rows and decodes and dispatches every operator once per batch rather than once per row. The
+ * rows of a batch are a grid stride apart so column loads stay coalesced. This pays off for deep
+ * expressions on large tables, at the cost of a batch worth of intermediate storage per thread.
+ *
+ * Expressions that may evaluate to null, or that use non-numeric types or operators other than
+ * the arithmetic, comparison, bitwise, logical and cast operators, are evaluated with the
+ * interpreter regardless of `evaluation`.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param evaluation How the expression is evaluated
+ * @param mr Device memory resource
+ * @return Output column
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  ast::expression const& expr,
+  ast_evaluation evaluation,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a bitmask from a column of boolean elements.
  *
@@ -247,5 +338,24 @@ std::unique_ptr<column> segmented_row_bit_count(
   size_type segment_length,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices at which to split a table into pieces of about `target_bytes`.
+ *
+ * The sizes of the rows are the approximations computed by `cudf::row_bit_count`. Piece `k`
+ * starts at the first row whose cumulative size exceeds `k * target_bytes`, so a piece exceeds
+ * `target_bytes` by less than the size of its first row and a row larger than `target_bytes` forms
+ * a piece of its own. The boundaries are computed on the device and only the split points are
+ * copied to the host.
+ *
+ * The result can be passed directly to `cudf::split` or `cudf::contiguous_split`.
+ *
+ * @throw std::invalid_argument if `target_bytes` is zero
+ *
+ * @param t The table view to compute the split points of
+ * @param target_bytes The target size of each piece in bytes
+ * @return Strictly increasing split points in `(0, t.num_rows())`
+ */
+std::vector<size_type> split_by_size(table_view const& t, std::size_t target_bytes);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -36,6 +36,7 @@ namespace cudf {
  *
  * @throw cudf::logic_error if column types are non-homogeneous
  * @throw cudf::logic_error if column types are non-fixed-width
+ * @throw std::overflow_error if the number of elements of the table exceeds the column size limit
  *
  * @param[in] input A table (M cols x N rows) to be transposed
  * @param[in] mr Device memory resource used to allocate the device memory of returned value
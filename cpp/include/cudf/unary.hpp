@@ -151,6 +151,29 @@ std::unique_ptr<cudf::column> unary_operation(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs unary op on all values in column, reusing the memory of the input
+ *
+ * When the result has the same type as `input`, the operation is applied to the elements of
+ * `input` in place and `input` is returned with its null mask unchanged. This is the case for
+ * the numeric operations on non-`fixed_point` numeric columns, for `BIT_INVERT` on integral
+ * columns and for `NOT` on `BOOL8` columns. No device memory is allocated in this case.
+ * Otherwise, this is equivalent to calling `unary_operation(input->view(), op, stream, mr)`.
+ *
+ * @param input Column consumed by the operation
+ * @param op operation to perform
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *           if it cannot be computed in place
+ *
+ * @returns Column of same size as `input` containing result of the operation
+ */
+std::unique_ptr<cudf::column> unary_operation(
+  std::unique_ptr<cudf::column>&& input,
+  cudf::unary_operator op,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
@@ -202,6 +225,30 @@ std::unique_ptr<column> cast(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Casts data from dtype specified in input to dtype specified in output, reusing the
+ * memory of the input
+ *
+ * When both types are non-`fixed_point` fixed-width types of the same size, the elements of
+ * `input` are cast in place and `input` is returned with the new type and its null mask
+ * unchanged. No device memory is allocated in this case. Otherwise, this is equivalent to
+ * calling `cast(input->view(), out_type, stream, mr)`.
+ *
+ * @param input Column consumed by the cast
+ * @param out_type Desired datatype of output column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *           if it cannot be computed in place
+ *
+ * @returns Column of same size as `input` containing result of the cast operation
+ * @throw cudf::logic_error if `out_type` is not a fixed-width type
+ */
+std::unique_ptr<column> cast(
+  std::unique_ptr<column>&& input,
+  data_type out_type,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @addtogroup utility_kernel_cache
+ * @{
+ * @file
+ * @brief Statistics of the cache of JIT-compiled kernels
+ *
+ * Kernels compiled at runtime, e.g. by `cudf::transform`, `cudf::binary_operation` with a PTX
+ * function or rolling window UDFs, are kept in a per-process cache backed by a cache directory on
+ * disk. The directory defaults to `$HOME/.cudf/<version>/<compute capability>` and is set with the
+ * `LIBCUDF_KERNEL_CACHE_PATH` environment variable.
+ *
+ * The `LIBCUDF_KERNEL_CACHE_SHARED_PATH` environment variable names a read-only cache directory
+ * with the same layout, e.g. one populated while building a container image. Kernels found there
+ * are copied into the writable cache directory when the cache is first used, so they are not
+ * compiled again.
+ */
+
+/**
+ * @brief Counters of the requests made to the JIT kernel cache by this process
+ */
+struct kernel_cache_statistics {
+  std::size_t hits{};    ///< Requests for a kernel already requested by this process
+  std::size_t misses{};  ///< Requests that loaded a kernel from the disk cache or compiled it
+  std::chrono::nanoseconds miss_time{};  ///< Total time spent serving the misses
+};
+
+/**
+ * @brief Get the statistics of the JIT kernel cache since the process started or the last call
+ * to `reset_kernel_cache_statistics`.
+ *
+ * @return The kernel cache statistics
+ */
+kernel_cache_statistics get_kernel_cache_statistics();
+
+/**
+ * @brief Reset the statistics of the JIT kernel cache to zero.
+ *
+ * Kernels requested before the reset still count as hits when requested again.
+ */
+void reset_kernel_cache_statistics();
+
+/** @} */  // end of group
+}  // namespace cudf
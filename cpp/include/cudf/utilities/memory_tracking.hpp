@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_memory_tracking
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Device memory used by one call to a libcudf API
+ */
+struct memory_usage_record {
+  std::string name;                   ///< Name of the libcudf API function
+  std::size_t peak_bytes;             ///< Largest number of bytes held by the call at once
+  std::size_t allocated_bytes;        ///< Total number of bytes allocated by the call
+  std::size_t allocation_count;       ///< Number of allocations made by the call
+  std::size_t retained_bytes;         ///< Bytes allocated by the call and not freed by its return
+  std::size_t synchronization_count;  ///< Number of times the call waited for its stream
+};
+
+/**
+ * @brief Starts recording the device memory used by each libcudf API call
+ *
+ * The current device resource is wrapped in a tracking resource and replaced by it. Every
+ * public libcudf API then records the allocations and deallocations made through it while
+ * the call runs on the calling thread. Calls made from within another libcudf API are
+ * included in the record of the outermost call. Allocations made by other threads, such as
+ * the worker threads of a reader, are not attributed to the call.
+ *
+ * When a call returns, its record is appended to those returned by `get_memory_usage_records`
+ * and an NVTX mark named after the function with the peak bytes as its payload is emitted in
+ * the libcudf domain.
+ *
+ * Each call also counts the host synchronizations it makes to read back results such as null
+ * counts or output sizes. Each of these stalls the host and breaks a CUDA graph capture.
+ *
+ * `peak_bytes` includes the output of the call so `peak_bytes - retained_bytes` bounds the
+ * temporary memory used by it. This can be used to size the chunks or batches passed to an API,
+ * such as the `pass_read_limit` of the chunked Parquet reader.
+ *
+ * Tracking applies to the current device only.
+ *
+ * @throw cudf::logic_error if tracking is already enabled
+ */
+void enable_memory_tracking();
+
+/**
+ * @brief Stops recording the device memory used by libcudf API calls
+ *
+ * The resource that was current when `enable_memory_tracking` was called is restored.
+ * The tracking resource is kept alive since memory allocated through it may still be in use.
+ * The records already collected are kept.
+ *
+ * @throw cudf::logic_error if the current device resource was changed after tracking was enabled
+ */
+void disable_memory_tracking();
+
+/**
+ * @brief Returns true if the device memory used by libcudf API calls is being recorded
+ *
+ * @return true if `enable_memory_tracking` was called without a subsequent
+ *         `disable_memory_tracking`
+ */
+bool is_memory_tracking_enabled();
+
+/**
+ * @brief Returns the records of the libcudf API calls made while tracking was enabled
+ *
+ * @return The records in the order in which the calls returned
+ */
+std::vector<memory_usage_record> get_memory_usage_records();
+
+/**
+ * @brief Discards all the collected memory usage records
+ */
+void clear_memory_usage_records();
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -353,6 +353,39 @@ using scalar_type_t = typename type_to_scalar_type_impl<T>::ScalarType;
 template <typename T>
 using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceType;
 
+/**
+ * @brief Indicates whether `type_dispatcher` instantiates its functor for the given type
+ *
+ * Groups of types can be left out of a build with the CMake options `CUDF_DISABLE_UNSIGNED_TYPES`,
+ * `CUDF_DISABLE_DURATION_TYPES` and `CUDF_DISABLE_DECIMAL32_TYPE`. No operator is compiled for a
+ * disabled type and dispatching it fails like dispatching an invalid type.
+ *
+ * @param id The type identifier to check
+ * @return true if `id` is dispatched in this build
+ */
+CUDF_HOST_DEVICE constexpr bool is_dispatched_type(type_id id)
+{
+  switch (id) {
+#ifdef CUDF_DISABLE_UNSIGNED_TYPES
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: return false;
+#endif
+#ifdef CUDF_DISABLE_DURATION_TYPES
+    case type_id::DURATION_DAYS:
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return false;
+#endif
+#ifdef CUDF_DISABLE_DECIMAL32_TYPE
+    case type_id::DECIMAL32: return false;
+#endif
+    default: return true;
+  }
+}
+
 /**
  * @brief Invokes an `operator()` template with the type instantiation based on
  * the specified `cudf::data_type`'s `id()`.
@@ -471,17 +504,33 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::INT64>::type>(
         std::forward<Ts>(args)...);
     case type_id::UINT8:
-      return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::UINT8)) {
+        return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::UINT16:
-      return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::UINT16)) {
+        return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::UINT32:
-      return f.template operator()<typename IdTypeMap<type_id::UINT32>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::UINT32)) {
+        return f.template operator()<typename IdTypeMap<type_id::UINT32>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::UINT64:
-      return f.template operator()<typename IdTypeMap<type_id::UINT64>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::UINT64)) {
+        return f.template operator()<typename IdTypeMap<type_id::UINT64>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::FLOAT32:
       return f.template operator()<typename IdTypeMap<type_id::FLOAT32>::type>(
         std::forward<Ts>(args)...);
@@ -507,20 +556,40 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
     case type_id::DURATION_DAYS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_DAYS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DURATION_SECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_SECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DURATION_MILLISECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_MILLISECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DURATION_MICROSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_MICROSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DURATION_NANOSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DURATION_NANOSECONDS)) {
+        return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DICTIONARY32:
       return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
@@ -531,8 +600,12 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
       return f.template operator()<typename IdTypeMap<type_id::LIST>::type>(
         std::forward<Ts>(args)...);
     case type_id::DECIMAL32:
-      return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
-        std::forward<Ts>(args)...);
+      if constexpr (is_dispatched_type(type_id::DECIMAL32)) {
+        return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
+          std::forward<Ts>(args)...);
+      } else {
+        break;
+      }
     case type_id::DECIMAL64:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
         std::forward<Ts>(args)...);
@@ -542,14 +615,14 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
-    default: {
+    default: break;
+  }
+  // Invalid types and types not dispatched in this build
 #ifndef __CUDA_ARCH__
-      CUDF_FAIL("Invalid type_id.");
+  CUDF_FAIL("Invalid type_id.");
 #else
-      CUDF_UNREACHABLE("Invalid type_id.");
+  CUDF_UNREACHABLE("Invalid type_id.");
 #endif
-    }
-  }
 }
 
 // @cond
@@ -182,6 +182,8 @@
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
  *   @defgroup utility_span Exception
+ *   @defgroup utility_kernel_cache JIT Kernel Cache
+ *   @defgroup utility_memory_tracking Memory Tracking
  * @}
  * @defgroup labeling_apis Labeling
  * @{
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/resource_ref.hpp>
@@ -77,5 +78,64 @@ std::unique_ptr<cudf::column> jaccard_index(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the sorted hashes of the substrings of each string used by `jaccard_index`
+ *
+ * A sliding window of `width` characters is applied to each string and each substring is
+ * hashed with MurmurHash32. The hashes of each row are sorted in ascending order. Duplicate
+ * hashes are kept.
+ *
+ * Computing these once for a column allows it to be compared with many other columns using
+ * the `jaccard_index` overload for lists columns without hashing its substrings again.
+ *
+ * @code{.pseudo}
+ * input = ["the fuzzy dog", "little piggy"]
+ * s1 = hash_shingles(input, 5)
+ * s2 = hash_shingles(other, 5)
+ * jaccard_index(s1, s2) == jaccard_index(input, other, 5)
+ * @endcode
+ *
+ * Any null row in `input` produces a null row in the output.
+ *
+ * @throw std::invalid_argument if the `width < 2`
+ *
+ * @param input Strings column to hash
+ * @param width The character width used for apply substrings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of UINT32 hashes
+ */
+std::unique_ptr<cudf::column> hash_shingles(
+  cudf::strings_column_view const& input,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the Jaccard similarity between rows of precomputed substring hashes
+ *
+ * Each row of the inputs must hold hashes sorted in ascending order, such as those returned
+ * by `hash_shingles`. Duplicate hashes within a row are counted once.
+ *
+ * If `input2` has a single row, every row of `input1` is compared with that row.
+ * Otherwise, `output[row] = J(input1[row],input2[row])`.
+ *
+ * If either input's row is null, the output for that row will also be null.
+ *
+ * @throw std::invalid_argument if `input2.size()` is neither 1 nor `input1.size()`
+ * @throw std::invalid_argument if either input's child type is not UINT32
+ *
+ * @param input1 Lists column of sorted hashes to compare with `input2`
+ * @param input2 Lists column of sorted hashes to compare with `input1`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Index calculation values
+ */
+std::unique_ptr<cudf::column> jaccard_index(
+  cudf::lists_column_view const& input1,
+  cudf::lists_column_view const& input2,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -150,5 +150,42 @@ std::unique_ptr<cudf::column> minhash64(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the locality sensitive hashing (LSH) bucket of each band of
+ * minhash values for each string
+ *
+ * The seeds are split into `bands` bands of `rows_per_band` consecutive seeds.
+ * The minhash values of each band are computed as in `minhash64` and combined
+ * into a single bucket value so strings sharing a bucket for any band are
+ * likely to be similar. The bucket of band `b` is `b` combined in order with
+ * each of the band's minhash values using `cudf::hashing::detail::hash_combine`.
+ * The minhash values themselves are not returned.
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::invalid_argument if bands or rows_per_band is not positive
+ * @throw std::invalid_argument if `seeds.size() != bands * rows_per_band`
+ * @throw std::overflow_error if `bands * input.size()` exceeds the column size limit
+ *
+ * @param input Strings column to compute buckets
+ * @param seeds Seed values used for the hash algorithm
+ * @param bands Number of bands and of buckets returned for each string
+ * @param rows_per_band Number of minhash values combined into each bucket
+ * @param width The character width used for apply substrings;
+ *              Default is 4 characters.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of `bands` bucket values for each string
+ */
+std::unique_ptr<cudf::column> minhash_lsh_buckets(
+  cudf::strings_column_view const& input,
+  cudf::device_span<uint64_t const> seeds,
+  cudf::size_type bands,
+  cudf::size_type rows_per_band,
+  cudf::size_type width             = 4,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -286,6 +286,10 @@ std::unique_ptr<tokenize_vocabulary> load_vocabulary(
  * r is now [[0,2], [0,1], [1,1,2], [-1,-1,2]]
  * @endcode
  *
+ * The input strings are tokenized using `delimiter` and each token is looked up as it is
+ * found so no intermediate column of token strings is created. There is no need to call
+ * nvtext::tokenize on the input first.
+ *
  * Any null row entry results in a corresponding null entry in the output
  *
  * @throw cudf::logic_error if `delimiter` is invalid
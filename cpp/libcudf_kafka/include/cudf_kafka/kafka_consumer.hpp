@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,15 +17,22 @@
 
 #include "kafka_callback.hpp"
 
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/datasource.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -92,6 +99,37 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that reads from several partitions of a topic.
+   *
+   * All partitions are assigned to the consumer at once, so that their messages are fetched from
+   * the brokers concurrently. The consumed messages are concatenated in pinned host memory, from
+   * which the data is read with `host_read` or copied to the device with `device_read`.
+   * Documentation for librdkafka configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`. This wrapper serves the purpose
+   *                 of preventing us from having to link against the Python development library
+   *                 in libcudf_kafka.
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partition_offsets map of the partitions to consume from to the start (seek position)
+   * and end offsets to read for each partition
+   * @param batch_timeout maximum (millisecond) read time allowed. If the end offsets are not
+   * reached before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   */
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 python_callable_type python_callable,
+                 kafka_oauth_callback_wrapper_type callable_wrapper,
+                 std::string const& topic_name,
+                 std::map<int32_t, std::pair<int64_t, int64_t>> partition_offsets,
+                 int batch_timeout,
+                 std::string const& delimiter);
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -120,6 +158,60 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
 
+  /**
+   * @brief Whether or not this source supports reading directly into device memory.
+   *
+   * The consumed data is held in pinned host memory, so device reads are asynchronous copies.
+   *
+   * @return true
+   */
+  [[nodiscard]] bool supports_device_read() const override { return true; }
+
+  /**
+   * @brief Returns a device buffer with a subset of data from Kafka Topic
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The data buffer in the device memory
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> device_read(size_t offset,
+                                                            size_t size,
+                                                            rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Reads a selected range into a preallocated device buffer.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Asynchronously reads a selected range into a preallocated device buffer.
+   *
+   * The copy is enqueued on `stream`; the returned future does not synchronize the stream.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read as a future value (can be smaller than size)
+   */
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -203,19 +295,18 @@ class kafka_consumer : public cudf::io::datasource {
   kafka_oauth_callback_wrapper_type callable_wrapper_;
 
   std::string topic_name;
-  int partition;
-  int64_t start_offset;
-  int64_t end_offset;
+  std::map<int32_t, std::pair<int64_t, int64_t>> partition_offsets;  // partition -> [start, end)
   int batch_timeout;
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  cudf::detail::pinned_host_vector<uint8_t> buffer;
 
  private:
-  RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
-                                                                int partition,
-                                                                int64_t offset);
+  /**
+   * Assign all partitions in `partition_offsets` to this consumer, each at its start offset
+   */
+  RdKafka::ErrorCode assign_partitions();
 
   /**
    * Convenience method for getting "now()" in Kafka's standard format
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,8 +15,15 @@
  */
 #include <cudf_kafka/kafka_consumer.hpp>
 
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
 #include <chrono>
 #include <memory>
 
@@ -67,13 +74,28 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                int64_t end_offset,
                                int batch_timeout,
                                std::string const& delimiter)
+  : kafka_consumer(std::move(configs),
+                   python_callable,
+                   callback_wrapper,
+                   topic_name,
+                   {{partition, {start_offset, end_offset}}},
+                   batch_timeout,
+                   delimiter)
+{
+}
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               python_callable_type python_callable,
+                               kafka_oauth_callback_wrapper_type callback_wrapper,
+                               std::string const& topic_name,
+                               std::map<int32_t, std::pair<int64_t, int64_t>> partition_offsets,
+                               int batch_timeout,
+                               std::string const& delimiter)
   : configs(configs),
     python_callable_(python_callable),
     callable_wrapper_(callback_wrapper),
     topic_name(topic_name),
-    partition(partition),
-    start_offset(start_offset),
-    end_offset(end_offset),
+    partition_offsets(std::move(partition_offsets)),
     batch_timeout(batch_timeout),
     delimiter(delimiter),
     kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
@@ -111,50 +133,101 @@ std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t o
 {
   if (offset > buffer.size()) { return 0; }
   size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  return std::make_unique<non_owning_buffer>(buffer.data() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
   if (offset > buffer.size()) { return 0; }
   auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  memcpy(dst, buffer.data() + offset, read_size);
   return read_size;
 }
 
+std::future<size_t> kafka_consumer::device_read_async(size_t offset,
+                                                      size_t size,
+                                                      uint8_t* dst,
+                                                      rmm::cuda_stream_view stream)
+{
+  auto const read_size = (offset > buffer.size()) ? 0 : std::min(size, buffer.size() - offset);
+  if (read_size > 0) {
+    // The buffer is pinned, so the copy is asynchronous with respect to the host
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      dst, buffer.data() + offset, read_size, cudaMemcpyHostToDevice, stream.value()));
+  }
+  return std::async(std::launch::deferred, [read_size] { return read_size; });
+}
+
+size_t kafka_consumer::device_read(size_t offset,
+                                   size_t size,
+                                   uint8_t* dst,
+                                   rmm::cuda_stream_view stream)
+{
+  return device_read_async(offset, size, dst, stream).get();
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer out(size, stream);
+  out.resize(device_read(offset, size, static_cast<uint8_t*>(out.data()), stream), stream);
+  return datasource::buffer::create(std::move(out));
+}
+
 size_t kafka_consumer::size() const { return buffer.size(); }
 
 /**
  * Change the TOPPAR assignment for this consumer instance
  */
-RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
-  std::string const& topic, int partition, int64_t offset)
+RdKafka::ErrorCode kafka_consumer::assign_partitions()
 {
   std::vector<RdKafka::TopicPartition*> topic_partitions;
-  topic_partitions.push_back(RdKafka::TopicPartition::create(topic, partition, offset));
-  return consumer.get()->assign(topic_partitions);
+  for (auto const& [part, offsets] : partition_offsets) {
+    topic_partitions.push_back(RdKafka::TopicPartition::create(topic_name, part, offsets.first));
+  }
+  auto const err = consumer->assign(topic_partitions);
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  return err;
 }
 
 void kafka_consumer::consume_to_buffer()
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+  assign_partitions();
+
+  // Number of messages left to read from each partition
+  std::map<int32_t, int64_t> messages_left;
+  for (auto const& [part, offsets] : partition_offsets) {
+    if (offsets.second > offsets.first) { messages_left[part] = offsets.second - offsets.first; }
+  }
 
-  int64_t messages_read = 0;
+  // Messages are kept until the batch is complete, to copy them into a buffer of the final size
+  std::vector<std::unique_ptr<RdKafka::Message>> messages;
+  size_t total_size = 0;
   auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
 
-  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
-    std::unique_ptr<RdKafka::Message> msg{
-      consumer->consume((end - std::chrono::steady_clock::now()).count())};
+  while (!messages_left.empty() && end > std::chrono::steady_clock::now()) {
+    auto const timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+      end - std::chrono::steady_clock::now());
+    std::unique_ptr<RdKafka::Message> msg{consumer->consume(timeout.count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
-      buffer.append(delimiter);
-      messages_read++;
+      auto const part = messages_left.find(msg->partition());
+      if (part == messages_left.end()) { continue; }
+      if (--part->second == 0) { messages_left.erase(part); }
+      total_size += msg->len() + delimiter.size();
+      messages.push_back(std::move(msg));
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
-      // If there are no more messages return
-      break;
+      // If there are no more messages in the partition, stop reading from it
+      messages_left.erase(msg->partition());
     }
   }
+
+  buffer.resize(total_size);
+  auto dst = buffer.data();
+  for (auto const& msg : messages) {
+    dst = std::copy_n(static_cast<uint8_t const*>(msg->payload()), msg->len(), dst);
+    dst = std::copy(delimiter.cbegin(), delimiter.cend(), dst);
+  }
 }
 
 std::map<std::string, std::string> kafka_consumer::current_configs()
@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace kafka = cudf::io::external::kafka;
 
@@ -44,6 +45,22 @@ TEST_F(KafkaDatasourceTest, MissingGroupID)
     cudf::logic_error);
 }
 
+TEST_F(KafkaDatasourceTest, MultiplePartitionsMissingGroupID)
+{
+  // group.id is a required configuration.
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  std::map<int32_t, std::pair<int64_t, int64_t>> partition_offsets{{0, {0, 3}}, {1, {5, 8}}};
+  EXPECT_THROW(
+    kafka::kafka_consumer kc(
+      kafka_configs, python_callable, callback_wrapper, "csv-topic", partition_offsets, 5000, "\n"),
+    cudf::logic_error);
+}
+
 TEST_F(KafkaDatasourceTest, InvalidConfigValues)
 {
   // Give a made up configuration value
@@ -16,9 +16,11 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
+#include <stdexcept>
 
 namespace cudf {
 
@@ -230,6 +232,18 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, hllpp_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_hllpp_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 // aggregation_finalizer ----------------------------------------
 
 void aggregation_finalizer::visit(aggregation const& agg) {}
@@ -398,6 +412,16 @@ void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(hllpp_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_hllpp_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 }  // namespace detail
 
 std::vector<std::unique_ptr<aggregation>> aggregation::get_simple_aggregations(
@@ -853,6 +877,36 @@ template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<gro
 template std::unique_ptr<reduce_aggregation> make_merge_tdigest_aggregation<reduce_aggregation>(
   int max_centroids);
 
+/// Factory to create a HLLPP aggregation
+template <typename Base>
+std::unique_ptr<Base> make_hllpp_aggregation(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HyperLogLog precision must be in the range [4, 18]",
+               std::invalid_argument);
+  return std::make_unique<detail::hllpp_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_hllpp_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_hllpp_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_hllpp_aggregation<reduce_aggregation>(
+  int precision);
+
+/// Factory to create a MERGE_HLLPP aggregation
+template <typename Base>
+std::unique_ptr<Base> make_merge_hllpp_aggregation(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HyperLogLog precision must be in the range [4, 18]",
+               std::invalid_argument);
+  return std::make_unique<detail::merge_hllpp_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_merge_hllpp_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_merge_hllpp_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_merge_hllpp_aggregation<reduce_aggregation>(
+  int precision);
+
 namespace detail {
 namespace {
 struct target_type_functor {
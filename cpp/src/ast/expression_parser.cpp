@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,24 +16,77 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <map>
+#include <memory>
 
 namespace cudf {
 
 namespace ast {
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Creates the literal view of a scalar holding a folded constant.
+ */
+struct folded_literal_view {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  generic_scalar_device_view operator()(cudf::scalar& value)
+  {
+    return generic_scalar_device_view{static_cast<cudf::numeric_scalar<T>&>(value)};
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_timestamp<T>())>
+  generic_scalar_device_view operator()(cudf::scalar& value)
+  {
+    return generic_scalar_device_view{static_cast<cudf::timestamp_scalar<T>&>(value)};
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_duration<T>())>
+  generic_scalar_device_view operator()(cudf::scalar& value)
+  {
+    return generic_scalar_device_view{static_cast<cudf::duration_scalar<T>&>(value)};
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_numeric<T>() and not cudf::is_timestamp<T>() and
+                           not cudf::is_duration<T>())>
+  generic_scalar_device_view operator()(cudf::scalar&)
+  {
+    CUDF_FAIL("Unsupported type for a folded literal.");
+  }
+};
+
+/**
+ * @brief Whether an expression is a literal holding a set of values.
+ */
+bool is_set_literal(expression const& expr)
+{
+  auto const* lit = dynamic_cast<literal const*>(&expr);
+  return lit != nullptr && lit->get_scalar().type().id() == type_id::LIST;
+}
+
+}  // namespace
 
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
@@ -91,7 +144,8 @@ cudf::size_type expression_parser::visit(literal const& expr)
   } else {
     _expression_count++;                                           // Increment the expression index
     auto const data_type     = expr.get_data_type();               // Resolve expression type
-    auto device_view         = expr.get_value();                   // Construct a scalar device view
+    // Construct a scalar device view
+    auto device_view = is_set_literal(expr) ? set_literal_view(expr) : expr.get_value();
     auto const literal_index = cudf::size_type(_literals.size());  // Push literal
     _literals.push_back(device_view);
     auto const source = detail::device_data_reference(detail::device_data_reference_type::LITERAL,
@@ -133,35 +187,63 @@ cudf::size_type expression_parser::visit(column_reference const& expr)
 
 cudf::size_type expression_parser::visit(operation const& expr)
 {
+  // Operations wrapping a root literal or column are created while parsing and have no entry.
+  auto const subexpression = _subexpressions.find(&expr);
+  if (subexpression != _subexpressions.end()) {
+    auto const& info = subexpression->second;
+    // Reuse the result of a structurally identical operation that is already linearized
+    auto const linearized = _linearized.find(info.id);
+    if (linearized != _linearized.end()) { return linearized->second; }
+    if (_fold_constants && info.is_constant && _expression_count > 0) {
+      if (auto const index = fold_constant(expr); index.has_value()) {
+        _linearized.emplace(info.id, *index);
+        return *index;
+      }
+    }
+  }
+  auto const op       = expr.get_operator();
+  auto const operands = expr.get_operands();
+  CUDF_EXPECTS(op != ast_operator::IS_IN || is_set_literal(operands[1].get()),
+               "The right operand of IS_IN must be a literal constructed from a list scalar.");
+  for (std::size_t i = 0; i < operands.size(); ++i) {
+    CUDF_EXPECTS(!is_set_literal(operands[i].get()) || (op == ast_operator::IS_IN && i == 1),
+                 "A set literal may only be used as the right operand of IS_IN.");
+  }
   // Increment the expression index
   auto const expression_index = _expression_count++;
   // Visit children (operands) of this expression
-  auto const operand_data_ref_indices = visit_operands(expr.get_operands());
+  auto const operand_data_ref_indices = visit_operands(operands);
   // Resolve operand types
   auto data_ref = [this](auto const& index) { return _data_references[index].data_type; };
   auto begin    = thrust::make_transform_iterator(operand_data_ref_indices.cbegin(), data_ref);
   auto end      = begin + operand_data_ref_indices.size();
   auto const operand_types = std::vector<cudf::data_type>(begin, end);
 
-  // Validate types of operand data references match
-  if (std::adjacent_find(operand_types.cbegin(), operand_types.cend(), std::not_equal_to<>()) !=
-      operand_types.cend()) {
+  // Validate types of operand data references match. The condition of a ternary operator is
+  // boolean and only the other two operands must match.
+  auto const first_matching = operand_types.size() == 3 ? 1 : 0;
+  if (first_matching == 1 && operand_types[0].id() != type_id::BOOL8) {
+    CUDF_FAIL("The first operand of a ternary AST operation must be a boolean.");
+  }
+  if (std::adjacent_find(operand_types.cbegin() + first_matching,
+                         operand_types.cend(),
+                         std::not_equal_to<>()) != operand_types.cend()) {
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
+  // Give back intermediate storage locations once their last consumer is this operation
   std::for_each(
     operand_data_ref_indices.cbegin(),
     operand_data_ref_indices.cend(),
     [this](auto const& data_reference_index) {
       auto const operand_source = _data_references[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE &&
+          --_pending_reads[data_reference_index] == 0) {
         auto const intermediate_index = operand_source.data_index;
         _intermediate_counter.give(intermediate_index);
       }
     });
   // Resolve expression type
-  auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
   _operators.push_back(op);
   // Push data reference
@@ -190,9 +272,117 @@ cudf::size_type expression_parser::visit(operation const& expr)
                                   operand_data_ref_indices.cbegin(),
                                   operand_data_ref_indices.cend());
   _operator_source_indices.push_back(index);
+  if (subexpression != _subexpressions.end()) {
+    auto const id = subexpression->second.id;
+    _linearized.emplace(id, index);
+    if (output.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      _pending_reads[index] = _consumer_counts[id];
+    }
+  }
   return index;
 }
 
+void expression_parser::collect_subexpressions(expression const& expr)
+{
+  // Assign the same id to structurally identical expressions. Literals are identified by the
+  // scalar they view, so two literals created from one scalar are identical.
+  std::map<std::vector<std::int64_t>, cudf::size_type> ids;
+  std::vector<bool> is_constant;
+  auto const assign_id = [&](auto const& self, expression const& node) -> cudf::size_type {
+    auto signature     = std::vector<std::int64_t>{};
+    auto node_constant = false;
+    if (auto const* lit = dynamic_cast<literal const*>(&node)) {
+      auto const value = lit->get_value();
+      signature        = {0,
+                          static_cast<std::int64_t>(value.type().id()),
+                          value.type().scale(),
+                          reinterpret_cast<std::intptr_t>(value.data())};
+      node_constant    = true;
+    } else if (auto const* col = dynamic_cast<column_reference const*>(&node)) {
+      signature = {1, static_cast<std::int64_t>(col->get_table_source()), col->get_column_index()};
+    } else if (auto const* op = dynamic_cast<operation const*>(&node)) {
+      signature     = {2, static_cast<std::int64_t>(op->get_operator())};
+      node_constant = true;
+      for (auto const& operand : op->get_operands()) {
+        auto const operand_id = self(self, operand.get());
+        signature.push_back(operand_id);
+        node_constant = node_constant && is_constant[operand_id];
+      }
+    } else {
+      // Column name references are rejected when linearized, so they never need to match
+      signature = {3, static_cast<std::int64_t>(ids.size())};
+    }
+    auto const next_id        = static_cast<cudf::size_type>(ids.size());
+    auto const [it, inserted] = ids.try_emplace(signature, next_id);
+    if (inserted) { is_constant.push_back(node_constant); }
+    if (auto const* op = dynamic_cast<operation const*>(&node)) {
+      _subexpressions.emplace(op, subexpression_info{it->second, node_constant});
+    }
+    return it->second;
+  };
+  auto const root_id = assign_id(assign_id, expr);
+
+  // Count the distinct operations reading each subexpression, visiting every id once
+  _consumer_counts.assign(ids.size(), 0);
+  std::vector<bool> visited(ids.size(), false);
+  auto const count_consumers = [&](auto const& self, operation const& op) -> void {
+    auto const id = _subexpressions.at(&op).id;
+    if (visited[id]) { return; }
+    visited[id] = true;
+    for (auto const& operand : op.get_operands()) {
+      if (auto const* child = dynamic_cast<operation const*>(&operand.get())) {
+        ++_consumer_counts[_subexpressions.at(child).id];
+        self(self, *child);
+      }
+    }
+  };
+  if (auto const* op = dynamic_cast<operation const*>(&expr)) {
+    count_consumers(count_consumers, *op);
+  }
+
+  // An expression made only of literals is evaluated as is, which also keeps the evaluation of a
+  // folded subexpression from folding again.
+  _fold_constants = !is_constant[root_id];
+}
+
+std::optional<cudf::size_type> expression_parser::fold_constant(operation const& expr)
+{
+  // IDENTITY may produce a string, and folding it saves nothing
+  if (expr.get_operator() == ast_operator::IDENTITY) { return std::nullopt; }
+
+  // Evaluate the expression on a single row; its operands do not read the table
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const row     = cudf::make_numeric_column(
+    data_type{type_id::INT8}, 1, mask_state::UNALLOCATED, _stream, temp_mr);
+  auto const result =
+    cudf::detail::compute_column(cudf::table_view{{row->view()}}, expr, _stream, temp_mr);
+  auto const type = result->type();
+  if (!cudf::is_numeric(type) && !cudf::is_timestamp(type) && !cudf::is_duration(type)) {
+    return std::nullopt;
+  }
+  _expression_count++;
+  _owned_literals.push_back(cudf::detail::get_element(result->view(), 0, _stream, _mr));
+
+  auto const literal_index = cudf::size_type(_literals.size());
+  _literals.push_back(cudf::type_dispatcher(type, folded_literal_view{}, *_owned_literals.back()));
+  auto const source = detail::device_data_reference(
+    detail::device_data_reference_type::LITERAL, type, literal_index);
+  return add_data_reference(source);
+}
+
+generic_scalar_device_view expression_parser::set_literal_view(literal const& expr)
+{
+  auto const& set = static_cast<cudf::list_scalar const&>(expr.get_scalar());
+  CUDF_EXPECTS(!set.view().has_nulls(), "The elements of a set literal must not be null.");
+  if (set.view().size() <= max_unsorted_literal_set_size) { return expr.get_value(); }
+
+  // Sort a copy of a large set so that it can be searched with a binary search
+  auto sorted = cudf::detail::sort(cudf::table_view{{set.view()}}, {}, {}, _stream, _mr);
+  _owned_literals.push_back(std::make_unique<cudf::list_scalar>(
+    std::move(*sorted->release().front()), set.is_valid(_stream), _stream, _mr));
+  return generic_scalar_device_view{static_cast<cudf::list_scalar&>(*_owned_literals.back())};
+}
+
 // TODO: Eliminate column name references from expression_parser because
 // 2 code paths diverge in supporting column name references:
 // 1. column name references are specific to cuIO
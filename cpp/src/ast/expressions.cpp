@@ -41,6 +41,17 @@ operation::operation(ast_operator op, expression const& left, expression const&
   }
 }
 
+operation::operation(ast_operator op,
+                     expression const& first,
+                     expression const& second,
+                     expression const& third)
+  : op(op), operands({first, second, third})
+{
+  if (cudf::ast::detail::ast_operator_arity(op) != 3) {
+    CUDF_FAIL("The provided operator is not a ternary operator.");
+  }
+}
+
 cudf::size_type literal::accept(detail::expression_parser& visitor) const
 {
   return visitor.visit(*this);
@@ -27,6 +27,7 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -39,13 +40,18 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/optional.h>
 
 #include <jit_preprocessed_files/binaryop/jit/kernel.cu.jit.hpp>
 
+#include <algorithm>
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace binops {
@@ -134,25 +140,42 @@ bool is_same_scale_necessary(binary_operator op)
 }
 
 namespace jit {
-void binary_operation(mutable_column_view& out,
-                      column_view const& lhs,
-                      column_view const& rhs,
-                      std::string const& ptx,
-                      rmm::cuda_stream_view stream)
+/**
+ * @brief Helper predicate function that identifies if a type can be used with a PTX function
+ */
+bool is_type_supported_ptx(data_type type)
+{
+  return is_fixed_width(type) and not is_fixed_point(type) and
+         type.id() != type_id::INT8;  // Numba PTX doesn't support int8
+}
+
+jitify2::Kernel get_binary_kernel(data_type lhs_type,
+                                  data_type rhs_type,
+                                  std::string const& ptx,
+                                  data_type output_type)
 {
-  std::string const output_type_name = cudf::type_to_name(out.type());
+  std::string const output_type_name = cudf::type_to_name(output_type);
 
   std::string cuda_source =
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
 
   std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
                               .instantiate(output_type_name,  // list of template arguments
-                                           cudf::type_to_name(lhs.type()),
-                                           cudf::type_to_name(rhs.type()),
+                                           cudf::type_to_name(lhs_type),
+                                           cudf::type_to_name(rhs_type),
                                            std::string("cudf::binops::jit::UserDefinedOp"));
 
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  return cudf::jit::get_kernel(
+    *binaryop_jit_kernel_cu_jit, kernel_name, "binaryop/jit/operation-udf.hpp", cuda_source);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      std::string const& ptx,
+                      rmm::cuda_stream_view stream)
+{
+  get_binary_kernel(lhs.type(), rhs.type(), ptx, out.type())
     ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
@@ -179,6 +202,22 @@ void fixed_point_binary_operation_validation(binary_operator op,
                  "Comparison operations require boolean output type.");
 }
 
+/**
+ * @brief Checks that the compiled binary operation supports the operand and output types.
+ */
+void validate_binary_operation(data_type lhs,
+                               data_type rhs,
+                               binary_operator op,
+                               data_type output_type)
+{
+  if (not is_supported_operation(output_type, lhs, rhs, op))
+    CUDF_FAIL("Unsupported operator for these types", cudf::data_type_error);
+
+  if (cudf::is_fixed_point(lhs) or cudf::is_fixed_point(rhs)) {
+    fixed_point_binary_operation_validation(op, lhs, rhs, output_type);
+  }
+}
+
 /**
  * @copydoc cudf::binary_operation(column_view const&, column_view const&,
  * binary_operator, data_type, rmm::device_async_resource_ref)
@@ -201,13 +240,7 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
       (op == binary_operator::NULL_MAX or op == binary_operator::NULL_MIN))
     return cudf::binops::compiled::string_null_min_max(lhs, rhs, op, output_type, stream, mr);
 
-  if (not cudf::binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op))
-    CUDF_FAIL("Unsupported operator for these types", cudf::data_type_error);
-
-  if (cudf::is_fixed_point(lhs.type()) or cudf::is_fixed_point(rhs.type())) {
-    cudf::binops::compiled::fixed_point_binary_operation_validation(
-      op, lhs.type(), rhs.type(), output_type);
-  }
+  validate_binary_operation(lhs.type(), rhs.type(), op, output_type);
 
   auto out = make_fixed_width_column_for_output(lhs, rhs, op, output_type, stream, mr);
 
@@ -317,6 +350,41 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
   }
 };
 
+/**
+ * @brief Returns true if a binary operation between `col` and a scalar can be computed
+ * on the keys of `col`
+ *
+ * This is the case for a dictionary column and an operator whose result is null for null rows.
+ */
+bool is_dictionary_keys_binop(column_view const& col, binary_operator op)
+{
+  return col.type().id() == type_id::DICTIONARY32 and not binops::is_null_dependent(op);
+}
+
+/**
+ * @brief Computes a binary operation between a dictionary column and a scalar
+ *
+ * The operation is computed once for each key and its results are gathered by the indices of
+ * `dictionary`, so the dictionary is never decoded.
+ *
+ * @param dictionary Dictionary column operand
+ * @param op_on_keys Computes the operation between the keys and the scalar
+ * @param output_type `data_type` of the output column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column of `output_type`, with nulls in the null rows of `dictionary`
+ */
+template <typename KeysOp>
+std::unique_ptr<column> dictionary_keys_binary_operation(column_view const& dictionary,
+                                                         KeysOp op_on_keys,
+                                                         data_type output_type,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr)
+{
+  if (dictionary.is_empty()) { return make_empty_column(output_type); }
+  return cudf::dictionary::detail::transform_distinct(dictionary, op_on_keys, false, stream, mr);
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -324,6 +392,17 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
 {
+  if (is_dictionary_keys_binop(rhs, op)) {
+    return dictionary_keys_binary_operation(
+      rhs,
+      [&](column_view const& keys) {
+        return binops::compiled::binary_operation<scalar, column_view>(
+          lhs, keys, op, output_type, stream, rmm::mr::get_current_device_resource());
+      },
+      output_type,
+      stream,
+      mr);
+  }
   return binops::compiled::binary_operation<scalar, column_view>(
     lhs, rhs, op, output_type, stream, mr);
 }
@@ -334,6 +413,17 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
 {
+  if (is_dictionary_keys_binop(lhs, op)) {
+    return dictionary_keys_binary_operation(
+      lhs,
+      [&](column_view const& keys) {
+        return binops::compiled::binary_operation<column_view, scalar>(
+          keys, rhs, op, output_type, stream, rmm::mr::get_current_device_resource());
+      },
+      output_type,
+      stream,
+      mr);
+  }
   return binops::compiled::binary_operation<column_view, scalar>(
     lhs, rhs, op, output_type, stream, mr);
 }
@@ -348,6 +438,58 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
     lhs, rhs, op, output_type, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_binary_operation(
+  host_span<binary_operation_spec const> operations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  std::vector<std::unique_ptr<column>> results;
+  if (operations.empty()) return results;
+
+  auto const num_rows = operations.front().lhs.size();
+  CUDF_EXPECTS(std::all_of(operations.begin(),
+                           operations.end(),
+                           [num_rows](auto const& operation) {
+                             return operation.lhs.size() == num_rows and
+                                    operation.rhs.size() == num_rows;
+                           }),
+               "All operand columns of a batched binary operation must have the same size",
+               std::invalid_argument);
+
+  // Operations sharing an operator are fused into a single kernel; the rest run individually
+  std::map<binary_operator, std::vector<std::size_t>> fused_groups;
+  results.reserve(operations.size());
+  for (std::size_t i = 0; i < operations.size(); ++i) {
+    auto const& [lhs, rhs, op, output_type] = operations[i];
+    if (binops::compiled::is_fusable_operation(output_type, lhs.type(), rhs.type(), op)) {
+      binops::compiled::validate_binary_operation(lhs.type(), rhs.type(), op, output_type);
+      results.push_back(make_fixed_width_column_for_output(lhs, rhs, op, output_type, stream, mr));
+      fused_groups[op].push_back(i);
+    } else {
+      results.push_back(binary_operation(lhs, rhs, op, output_type, stream, mr));
+    }
+  }
+  if (num_rows == 0) return results;
+
+  for (auto const& [op, indices] : fused_groups) {
+    std::vector<mutable_column_view> out_views;
+    std::vector<column_view> lhs_views;
+    std::vector<column_view> rhs_views;
+    for (auto const i : indices) {
+      out_views.push_back(results[i]->mutable_view());
+      lhs_views.push_back(operations[i].lhs);
+      rhs_views.push_back(operations[i].rhs);
+    }
+    binops::compiled::batched_binary_operation(out_views, lhs_views, rhs_views, op, stream);
+    for (auto const i : indices) {
+      auto& out = results[i];
+      out->set_null_count(
+        cudf::detail::null_count(out->view().null_mask(), 0, out->size(), stream));
+    }
+  }
+  return results;
+}
+
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
@@ -356,14 +498,10 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::device_async_resource_ref mr)
 {
   // Check for datatype
-  auto is_type_supported_ptx = [](data_type type) -> bool {
-    return is_fixed_width(type) and not is_fixed_point(type) and
-           type.id() != type_id::INT8;  // Numba PTX doesn't support int8
-  };
-
-  CUDF_EXPECTS(is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(output_type),
+               "Invalid/Unsupported output datatype");
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
@@ -433,6 +571,15 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_binary_operation(
+  host_span<binary_operation_spec const> operations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_binary_operation(operations, stream, mr);
+}
+
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
@@ -444,4 +591,17 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, stream, mr);
 }
 
+void warm_binary_operation(data_type lhs_type,
+                           data_type rhs_type,
+                           std::string const& ptx,
+                           data_type output_type)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(rhs_type), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(binops::jit::is_type_supported_ptx(output_type),
+               "Invalid/Unsupported output datatype");
+  binops::jit::get_binary_kernel(lhs_type, rhs_type, ptx, output_type);
+}
+
 }  // namespace cudf
@@ -23,4 +23,8 @@ template void apply_binary_op<ops::ShiftRight>(mutable_column_view&,
                                                bool is_lhs_scalar,
                                                bool is_rhs_scalar,
                                                rmm::cuda_stream_view);
+template void apply_batched_binary_op<ops::ShiftRight>(host_span<mutable_column_view const>,
+                                                       host_span<column_view const>,
+                                                       host_span<column_view const>,
+                                                       rmm::cuda_stream_view);
 }
@@ -396,6 +396,67 @@ void binary_operation(mutable_column_view& out,
   operator_dispatcher(out, lhs, rhsv, false, true, op, stream);
 }
 
+bool is_fusable_operation(data_type out, data_type lhs, data_type rhs, binary_operator op)
+{
+  // Equality operators have their own kernels and operations without a common type need the
+  // double type dispatcher
+  auto const is_fusable_type = [](data_type type) {
+    return type.id() != type_id::STRUCT and type.id() != type_id::DICTIONARY32 and
+           type.id() != type_id::LIST;
+  };
+  return op != binary_operator::EQUAL and op != binary_operator::NOT_EQUAL and
+         op != binary_operator::GENERIC_BINARY and is_fixed_width(out) and is_fusable_type(lhs) and
+         is_fusable_type(rhs) and is_supported_operation(out, lhs, rhs, op) and
+         get_common_type(out, lhs, rhs).has_value();
+}
+
+void batched_binary_operation(host_span<mutable_column_view const> out,
+                              host_span<column_view const> lhs,
+                              host_span<column_view const> rhs,
+                              binary_operator op,
+                              rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(out.size() == lhs.size() and out.size() == rhs.size(),
+               "Each batched binary operation requires an output and two operands");
+  if (out.empty()) return;
+  // clang-format off
+switch (op) {
+case binary_operator::ADD:                  apply_batched_binary_op<ops::Add>(out, lhs, rhs, stream); break;
+case binary_operator::SUB:                  apply_batched_binary_op<ops::Sub>(out, lhs, rhs, stream); break;
+case binary_operator::MUL:                  apply_batched_binary_op<ops::Mul>(out, lhs, rhs, stream); break;
+case binary_operator::DIV:                  apply_batched_binary_op<ops::Div>(out, lhs, rhs, stream); break;
+case binary_operator::TRUE_DIV:             apply_batched_binary_op<ops::TrueDiv>(out, lhs, rhs, stream); break;
+case binary_operator::FLOOR_DIV:            apply_batched_binary_op<ops::FloorDiv>(out, lhs, rhs, stream); break;
+case binary_operator::MOD:                  apply_batched_binary_op<ops::Mod>(out, lhs, rhs, stream); break;
+case binary_operator::PYMOD:                apply_batched_binary_op<ops::PyMod>(out, lhs, rhs, stream); break;
+case binary_operator::POW:                  apply_batched_binary_op<ops::Pow>(out, lhs, rhs, stream); break;
+case binary_operator::INT_POW:              apply_batched_binary_op<ops::IntPow>(out, lhs, rhs, stream); break;
+case binary_operator::LESS:                 apply_batched_binary_op<ops::Less>(out, lhs, rhs, stream); break;
+case binary_operator::GREATER:              apply_batched_binary_op<ops::Greater>(out, lhs, rhs, stream); break;
+case binary_operator::LESS_EQUAL:           apply_batched_binary_op<ops::LessEqual>(out, lhs, rhs, stream); break;
+case binary_operator::GREATER_EQUAL:        apply_batched_binary_op<ops::GreaterEqual>(out, lhs, rhs, stream); break;
+case binary_operator::BITWISE_AND:          apply_batched_binary_op<ops::BitwiseAnd>(out, lhs, rhs, stream); break;
+case binary_operator::BITWISE_OR:           apply_batched_binary_op<ops::BitwiseOr>(out, lhs, rhs, stream); break;
+case binary_operator::BITWISE_XOR:          apply_batched_binary_op<ops::BitwiseXor>(out, lhs, rhs, stream); break;
+case binary_operator::LOGICAL_AND:          apply_batched_binary_op<ops::LogicalAnd>(out, lhs, rhs, stream); break;
+case binary_operator::LOGICAL_OR:           apply_batched_binary_op<ops::LogicalOr>(out, lhs, rhs, stream); break;
+case binary_operator::SHIFT_LEFT:           apply_batched_binary_op<ops::ShiftLeft>(out, lhs, rhs, stream); break;
+case binary_operator::SHIFT_RIGHT:          apply_batched_binary_op<ops::ShiftRight>(out, lhs, rhs, stream); break;
+case binary_operator::SHIFT_RIGHT_UNSIGNED: apply_batched_binary_op<ops::ShiftRightUnsigned>(out, lhs, rhs, stream); break;
+case binary_operator::LOG_BASE:             apply_batched_binary_op<ops::LogBase>(out, lhs, rhs, stream); break;
+case binary_operator::ATAN2:                apply_batched_binary_op<ops::ATan2>(out, lhs, rhs, stream); break;
+case binary_operator::PMOD:                 apply_batched_binary_op<ops::PMod>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_EQUALS:          apply_batched_binary_op<ops::NullEquals>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_NOT_EQUALS:      apply_batched_binary_op<ops::NullNotEquals>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_MAX:             apply_batched_binary_op<ops::NullMax>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_MIN:             apply_batched_binary_op<ops::NullMin>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_LOGICAL_AND:     apply_batched_binary_op<ops::NullLogicalAnd>(out, lhs, rhs, stream); break;
+case binary_operator::NULL_LOGICAL_OR:      apply_batched_binary_op<ops::NullLogicalOr>(out, lhs, rhs, stream); break;
+default: CUDF_FAIL("Unsupported batched binary operator");
+}
+  // clang-format on
+}
+
 namespace detail {
 void apply_sorting_struct_binary_op(mutable_column_view& out,
                                     column_view const& lhs,
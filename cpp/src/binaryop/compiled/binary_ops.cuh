@@ -22,6 +22,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/unary.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -38,6 +39,21 @@ constexpr bool is_bool_result()
   return std::is_same_v<bool, ReturnType>;
 }
 
+/**
+ * @brief Returns true if the operator computes the output validity from the operand validities
+ * itself instead of using the AND of the operand null masks.
+ */
+template <typename BinaryOperator>
+constexpr bool is_null_aware_operator()
+{
+  return std::is_same_v<BinaryOperator, ops::NullEquals> or
+         std::is_same_v<BinaryOperator, ops::NullNotEquals> or
+         std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
+         std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
+         std::is_same_v<BinaryOperator, ops::NullMax> or
+         std::is_same_v<BinaryOperator, ops::NullMin>;
+}
+
 /**
  * @brief Type casts each element of the column to `CastType`
  *
@@ -108,12 +124,7 @@ struct ops_wrapper {
       TypeCommon y =
         type_dispatcher(rhs.type(), type_casted_accessor<TypeCommon>{}, i, rhs, is_rhs_scalar);
       auto result = [&]() {
-        if constexpr (std::is_same_v<BinaryOperator, ops::NullEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullNotEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
-                      std::is_same_v<BinaryOperator, ops::NullMax> or
-                      std::is_same_v<BinaryOperator, ops::NullMin>) {
+        if constexpr (is_null_aware_operator<BinaryOperator>()) {
           bool output_valid = false;
           auto result       = BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(
             x,
@@ -211,6 +222,32 @@ struct binary_op_device_dispatcher {
   }
 };
 
+/**
+ * @brief Functor which runs the operation on operands of type `T` without type dispatching in
+ * device code
+ *
+ * Used for the most common operand types, where the output type is the result type of the
+ * operator, so neither the operands nor the result need to be cast.
+ *
+ * @tparam BinaryOperator binary operator functor
+ * @tparam T type of both operands
+ */
+template <class BinaryOperator, typename T>
+struct binary_op_same_type_device_dispatcher {
+  mutable_column_device_view out;
+  column_device_view lhs;
+  column_device_view rhs;
+  bool is_lhs_scalar;
+  bool is_rhs_scalar;
+
+  __forceinline__ __device__ void operator()(size_type i)
+  {
+    using Result = std::invoke_result_t<BinaryOperator, T, T>;
+    out.element<Result>(i) = BinaryOperator{}.template operator()<T, T>(
+      lhs.element<T>(is_lhs_scalar ? 0 : i), rhs.element<T>(is_rhs_scalar ? 0 : i));
+  }
+};
+
 /**
  * @brief Functor which does double type dispatcher in device code
  *
@@ -236,6 +273,25 @@ struct binary_op_double_device_dispatcher {
   }
 };
 
+/**
+ * @brief Functor which runs several single type dispatched operations on the same row
+ *
+ * All operations share @p BinaryOperator, so one kernel computes every output of a batch.
+ *
+ * @tparam BinaryOperator binary operator functor
+ */
+template <class BinaryOperator>
+struct binary_op_batch_device_dispatcher {
+  device_span<binary_op_device_dispatcher<BinaryOperator>> operations;
+
+  __forceinline__ __device__ void operator()(size_type i)
+  {
+    for (auto& operation : operations) {
+      operation(i);
+    }
+  }
+};
+
 /**
  * @brief Simplified for_each kernel
  *
@@ -279,6 +335,36 @@ void for_each(rmm::cuda_stream_view stream, cudf::size_type size, Functor f)
   for_each_kernel<<<grid_size, block_size, 0, stream.value()>>>(size, std::forward<Functor&&>(f));
 }
 
+/**
+ * @brief Launches the kernel specialized for operands of type `T` if the operation matches it.
+ *
+ * @return true if the kernel was launched
+ */
+template <class BinaryOperator, typename T>
+bool try_apply_same_type_binary_op(mutable_column_device_view const& out,
+                                   column_device_view const& lhs,
+                                   column_device_view const& rhs,
+                                   bool is_lhs_scalar,
+                                   bool is_rhs_scalar,
+                                   rmm::cuda_stream_view stream)
+{
+  if constexpr (not is_null_aware_operator<BinaryOperator>() and
+                std::is_invocable_v<BinaryOperator, T, T>) {
+    using Result = std::invoke_result_t<BinaryOperator, T, T>;
+    if constexpr (mutable_column_device_view::has_element_accessor<Result>()) {
+      if (lhs.type().id() == type_to_id<T>() and rhs.type().id() == type_to_id<T>() and
+          out.type().id() == type_to_id<Result>()) {
+        for_each(stream,
+                 out.size(),
+                 binary_op_same_type_device_dispatcher<BinaryOperator, T>{
+                   out, lhs, rhs, is_lhs_scalar, is_rhs_scalar});
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 template <class BinaryOperator>
 void apply_binary_op(mutable_column_view& out,
                      column_view const& lhs,
@@ -292,6 +378,18 @@ void apply_binary_op(mutable_column_view& out,
   auto lhsd = column_device_view::create(lhs, stream);
   auto rhsd = column_device_view::create(rhs, stream);
   auto outd = mutable_column_device_view::create(out, stream);
+
+  // The most common operand types get kernels of their own without device-side type dispatch.
+  // Every other type combination shares the generic kernels below, which dispatch per element.
+  auto const apply_same_type = [&](auto type) {
+    return try_apply_same_type_binary_op<BinaryOperator, decltype(type)>(
+      *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar, stream);
+  };
+  if (apply_same_type(int32_t{}) or apply_same_type(int64_t{}) or apply_same_type(float{}) or
+      apply_same_type(double{})) {
+    return;
+  }
+
   // Create binop functor instance
   if (common_dtype) {
     // Execute it on every element
@@ -308,6 +406,36 @@ void apply_binary_op(mutable_column_view& out,
   }
 }
 
+template <class BinaryOperator>
+void apply_batched_binary_op(host_span<mutable_column_view const> out,
+                             host_span<column_view const> lhs,
+                             host_span<column_view const> rhs,
+                             rmm::cuda_stream_view stream)
+{
+  // Device views of every operation stay alive until the kernel has been launched
+  std::vector<decltype(column_device_view::create(lhs.front(), stream))> operand_views;
+  std::vector<decltype(mutable_column_device_view::create(out.front(), stream))> out_views;
+  std::vector<binary_op_device_dispatcher<BinaryOperator>> h_operations;
+  operand_views.reserve(2 * out.size());
+  out_views.reserve(out.size());
+  h_operations.reserve(out.size());
+  for (std::size_t k = 0; k < out.size(); ++k) {
+    auto const common_dtype = get_common_type(out[k].type(), lhs[k].type(), rhs[k].type());
+    CUDF_EXPECTS(common_dtype.has_value(), "Batched binary operations require a common type");
+    auto const& lhsd = operand_views.emplace_back(column_device_view::create(lhs[k], stream));
+    auto const& rhsd = operand_views.emplace_back(column_device_view::create(rhs[k], stream));
+    auto const& outd = out_views.emplace_back(mutable_column_device_view::create(out[k], stream));
+    h_operations.push_back(binary_op_device_dispatcher<BinaryOperator>{
+      *common_dtype, *outd, *lhsd, *rhsd, false, false});
+  }
+  auto d_operations = cudf::detail::make_device_uvector_async(
+    h_operations, stream, rmm::mr::get_current_device_resource());
+  for_each(stream,
+           out.front().size(),
+           binary_op_batch_device_dispatcher<BinaryOperator>{
+             device_span<binary_op_device_dispatcher<BinaryOperator>>{d_operations}});
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
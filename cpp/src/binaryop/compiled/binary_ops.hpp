@@ -19,6 +19,7 @@
 #include <cudf/binaryop.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
@@ -147,6 +148,36 @@ void binary_operation(mutable_column_view& out,
                       binary_operator op,
                       rmm::cuda_stream_view stream);
 
+/**
+ * @brief Performs several binary operations sharing the operator @p op in a single kernel.
+ *
+ * Every row of every output is computed in one pass over the rows. All columns must have the
+ * same size and every operation must satisfy `is_fusable_operation`.
+ *
+ * @param out mutable views of the output columns
+ * @param lhs views of the left operand columns, one per output
+ * @param rhs views of the right operand columns, one per output
+ * @param op binary operator enum shared by all operations
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void batched_binary_operation(host_span<mutable_column_view const> out,
+                              host_span<column_view const> lhs,
+                              host_span<column_view const> rhs,
+                              binary_operator op,
+                              rmm::cuda_stream_view stream);
+
+/**
+ * @brief Check if a column-column binary operation can be computed by
+ * `batched_binary_operation`.
+ *
+ * @param out output type of the binary operation
+ * @param lhs first operand type of the binary operation
+ * @param rhs second operand type of the binary operation
+ * @param op binary operator enum.
+ * @return true if the operation is supported and runs on the single type dispatcher path
+ */
+bool is_fusable_operation(data_type out, data_type lhs, data_type rhs, binary_operator op);
+
 // Defined in util.cpp
 /**
  * @brief Get the common type among all input types.
@@ -190,6 +221,24 @@ void apply_binary_op(mutable_column_view& out,
                      bool is_lhs_scalar,
                      bool is_rhs_scalar,
                      rmm::cuda_stream_view stream);
+/**
+ * @brief Runs binary operations sharing @p BinaryOperator on each row of their columns with a
+ * single kernel launch.
+ *
+ * This template is instantiated for each binary operator. Each operation must have a common type
+ * for its output and operand types.
+ *
+ * @tparam BinaryOperator Binary operator functor
+ * @param out mutable views of the output columns
+ * @param lhs views of the left operand columns, one per output
+ * @param rhs views of the right operand columns, one per output
+ * @param stream CUDA stream used for device memory operations
+ */
+template <class BinaryOperator>
+void apply_batched_binary_op(host_span<mutable_column_view const> out,
+                             host_span<column_view const> lhs,
+                             host_span<column_view const> rhs,
+                             rmm::cuda_stream_view stream);
 /**
  * @brief Deploys single type or double type dispatcher that runs equality operation on each element
  * of @p lhs and @p rhs columns.
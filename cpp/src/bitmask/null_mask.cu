@@ -44,6 +44,7 @@
 #include <algorithm>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 namespace cudf {
 size_type state_null_count(mask_state state, size_type size)
@@ -412,6 +413,89 @@ std::vector<size_type> segmented_null_count(bitmask_type const* bitmask,
   return detail::segmented_null_count(bitmask, indices.begin(), indices.end(), stream);
 }
 
+namespace {
+
+/**
+ * @brief The masks of an idempotent bitmask operation, without the repeated masks
+ *
+ * ANDing or ORing the same bits twice does not change the result, so a mask repeated with the
+ * same begin bit is read only once.
+ */
+struct unique_masks {
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> begin_bits;
+
+  unique_masks(host_span<bitmask_type const* const> all_masks,
+               host_span<size_type const> all_begin_bits)
+  {
+    for (std::size_t i = 0; i < all_masks.size(); ++i) {
+      add(all_masks[i], all_begin_bits[i]);
+    }
+  }
+
+  unique_masks() = default;
+
+  /**
+   * @brief Adds a mask unless it was already added with the same begin bit
+   *
+   * @return true if the mask was added
+   */
+  bool add(bitmask_type const* mask, size_type begin_bit)
+  {
+    for (std::size_t i = 0; i < masks.size(); ++i) {
+      if (masks[i] == mask and begin_bits[i] == begin_bit) { return false; }
+    }
+    masks.push_back(mask);
+    begin_bits.push_back(begin_bit);
+    return true;
+  }
+};
+
+/**
+ * @brief Combines the null masks of the columns of a table with an idempotent bitmask operation
+ *
+ * Only the masks of the columns with nulls are read, each once. The result of a single such
+ * mask is a copy of it, whose null count is that of its column. The null masks of the other
+ * nullable columns are all valid: such a column does not change the AND of the masks and makes
+ * their OR all valid.
+ *
+ * @param op The bitwise AND or OR of two words of the masks
+ * @param is_or Whether `op` is the bitwise OR
+ */
+template <typename Binop>
+std::pair<rmm::device_buffer, size_type> combine_table_masks(Binop op,
+                                                             bool is_or,
+                                                             table_view const& view,
+                                                             rmm::cuda_stream_view stream,
+                                                             rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = view.num_rows();
+
+  unique_masks masks;
+  size_type null_count = 0;
+  bool has_valid_mask  = false;
+  for (auto&& col : view) {
+    if (not col.nullable()) { continue; }
+    if (col.null_count() == 0) {
+      has_valid_mask = true;
+    } else if (masks.add(col.null_mask(), col.offset())) {
+      null_count = col.null_count();
+    }
+  }
+
+  if (masks.masks.empty() or (is_or and has_valid_mask)) {
+    return std::pair(create_null_mask(num_rows, mask_state::ALL_VALID, stream, mr), 0);
+  }
+  if (masks.masks.size() == 1) {
+    auto const begin_bit = masks.begin_bits.front();
+    return std::pair(
+      copy_bitmask(masks.masks.front(), begin_bit, begin_bit + num_rows, stream, mr), null_count);
+  }
+  return bitmask_binop(op, masks.masks, masks.begin_bits, num_rows, stream, mr);
+}
+
+}  // namespace
+
 // Inplace Bitwise AND of the masks
 cudf::size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
                                     host_span<bitmask_type const* const> masks,
@@ -419,11 +503,12 @@ cudf::size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
                                     size_type mask_size,
                                     rmm::cuda_stream_view stream)
 {
+  unique_masks const unique{masks, begin_bits};
   return inplace_bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
     dest_mask,
-    masks,
-    begin_bits,
+    unique.masks,
+    unique.begin_bits,
     mask_size,
     stream);
 }
@@ -435,10 +520,11 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type cons
                                                      rmm::cuda_stream_view stream,
                                                      rmm::device_async_resource_ref mr)
 {
+  unique_masks const unique{masks, begin_bits};
   return bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
-    masks,
-    begin_bits,
+    unique.masks,
+    unique.begin_bits,
     mask_size,
     stream,
     mr);
@@ -451,30 +537,17 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) {
+  if (view.num_rows() == 0 or view.num_columns() == 0 or
+      std::none_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
     return std::pair(std::move(null_mask), 0);
   }
 
-  std::vector<bitmask_type const*> masks;
-  std::vector<size_type> offsets;
-  for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
-  }
-
-  if (masks.size() > 0) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
-  }
-
-  return std::pair(std::move(null_mask), 0);
+  return combine_table_masks(
+    [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
+    false,
+    view,
+    stream,
+    mr);
 }
 
 // Returns the bitwise OR of the null masks of all columns in the table view
@@ -484,30 +557,17 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) {
+  if (view.num_rows() == 0 or view.num_columns() == 0 or
+      not std::all_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
     return std::pair(std::move(null_mask), 0);
   }
 
-  std::vector<bitmask_type const*> masks;
-  std::vector<size_type> offsets;
-  for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
-  }
-
-  if (static_cast<size_type>(masks.size()) == view.num_columns()) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
-  }
-
-  return std::pair(std::move(null_mask), 0);
+  return combine_table_masks(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    true,
+    view,
+    stream,
+    mr);
 }
 
 void set_all_valid_null_masks(column_view const& input,
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Source and target of one fixed-width column in a batched gather
+ */
+struct fixed_width_gather_info {
+  void const* source;  ///< Source data, including the column offset
+  void* target;        ///< Target data
+  int element_size;    ///< Size of each element in bytes
+};
+
+template <typename T, typename MapIterator>
+__device__ void gather_elements(fixed_width_gather_info const& info,
+                                MapIterator gather_map,
+                                size_type map_size,
+                                size_type source_rows,
+                                bool check_bounds)
+{
+  auto const source = static_cast<T const*>(info.source);
+  auto const target = static_cast<T*>(info.target);
+  auto const stride = grid_1d::grid_stride();
+  for (auto i = grid_1d::global_thread_id(); i < map_size; i += stride) {
+    auto const index = static_cast<size_type>(gather_map[i]);
+    // out-of-bounds rows are nullified by the bitmask pass, so their value is left unset
+    if (check_bounds && (index < 0 || index >= source_rows)) { continue; }
+    target[i] = source[index];
+  }
+}
+
+/**
+ * @brief Gather the rows of many fixed-width columns
+ *
+ * `blockIdx.y` selects the column and the x dimension strides over the gather map, so every
+ * column is gathered by the same launch.
+ */
+template <typename MapIterator>
+CUDF_KERNEL void gather_fixed_width_kernel(fixed_width_gather_info const* infos,
+                                           size_type num_columns,
+                                           MapIterator gather_map,
+                                           size_type map_size,
+                                           size_type source_rows,
+                                           bool check_bounds)
+{
+  for (auto c = static_cast<size_type>(blockIdx.y); c < num_columns; c += gridDim.y) {
+    auto const& info = infos[c];
+    switch (info.element_size) {
+      case 1:
+        gather_elements<int8_t>(info, gather_map, map_size, source_rows, check_bounds);
+        break;
+      case 2:
+        gather_elements<int16_t>(info, gather_map, map_size, source_rows, check_bounds);
+        break;
+      case 4:
+        gather_elements<int32_t>(info, gather_map, map_size, source_rows, check_bounds);
+        break;
+      case 8:
+        gather_elements<int64_t>(info, gather_map, map_size, source_rows, check_bounds);
+        break;
+      case 16:
+        gather_elements<__int128_t>(info, gather_map, map_size, source_rows, check_bounds);
+        break;
+      default: break;
+    }
+  }
+}
+
+/**
+ * @brief Copy the chars of the gathered strings of many strings columns
+ *
+ * One warp copies each output string. `offsets` holds the output offsets of every column back
+ * to back, `map_size + 1` values per column.
+ */
+template <typename MapIterator>
+CUDF_KERNEL void gather_strings_chars_kernel(table_device_view sources,
+                                             char* const* targets,
+                                             int64_t const* offsets,
+                                             MapIterator gather_map,
+                                             size_type map_size)
+{
+  auto const total_strings = static_cast<int64_t>(sources.num_columns()) * map_size;
+  auto const warp_id       = grid_1d::global_thread_id() / warp_size;
+  auto const num_warps     = grid_1d::grid_stride() / warp_size;
+  auto const lane          = threadIdx.x % warp_size;
+
+  for (auto s = warp_id; s < total_strings; s += num_warps) {
+    auto const c     = static_cast<size_type>(s / map_size);
+    auto const row   = static_cast<size_type>(s % map_size);
+    auto const begin = offsets[c * (static_cast<int64_t>(map_size) + 1) + row];
+    auto const end   = offsets[c * (static_cast<int64_t>(map_size) + 1) + row + 1];
+    // empty, null and out-of-bounds rows all have no chars
+    if (begin == end) { continue; }
+
+    auto const input  = sources.column(c).element<string_view>(gather_map[row]).data();
+    auto const output = targets[c] + begin;
+    for (auto i = static_cast<int64_t>(lane); i < end - begin; i += warp_size) {
+      output[i] = input[i];
+    }
+  }
+}
+
+/**
+ * @brief Gather many strings columns with one sizes pass, one scan and one chars pass
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> gather_strings(table_view const& sources,
+                                                    MapIterator gather_map,
+                                                    size_type map_size,
+                                                    bool check_bounds,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr)
+{
+  auto const num_columns = sources.num_columns();
+  auto const d_sources   = table_device_view::create(sources, stream);
+  auto const stride      = static_cast<int64_t>(map_size) + 1;
+  auto const total       = stride * num_columns;
+
+  // sizes of every output row of every column; the last slot of each column is zero so the
+  // exclusive scan below leaves the column's total in it
+  auto offsets = rmm::device_uvector<int64_t>(total, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<int64_t>(0),
+    thrust::counting_iterator<int64_t>(total),
+    offsets.begin(),
+    cuda::proclaim_return_type<int64_t>(
+      [d_sources = *d_sources, gather_map, stride, map_size, check_bounds] __device__(
+        int64_t i) -> int64_t {
+        auto const row = static_cast<size_type>(i % stride);
+        if (row == map_size) { return 0; }
+        auto const d_column = d_sources.column(static_cast<size_type>(i / stride));
+        auto const index    = static_cast<size_type>(gather_map[row]);
+        if (check_bounds && (index < 0 || index >= d_column.size())) { return 0; }
+        if (d_column.is_null(index)) { return 0; }
+        return d_column.element<string_view>(index).size_bytes();
+      }));
+  auto const keys = thrust::make_transform_iterator(
+    thrust::counting_iterator<int64_t>(0),
+    cuda::proclaim_return_type<int64_t>([stride] __device__(int64_t i) { return i / stride; }));
+  thrust::exclusive_scan_by_key(
+    rmm::exec_policy_nosync(stream), keys, keys + total, offsets.begin(), offsets.begin());
+
+  auto d_totals = rmm::device_uvector<int64_t>(num_columns, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<int64_t>(0),
+                    thrust::counting_iterator<int64_t>(num_columns),
+                    d_totals.begin(),
+                    cuda::proclaim_return_type<int64_t>(
+                      [offsets = offsets.data(), stride] __device__(int64_t c) {
+                        return offsets[c * stride + stride - 1];
+                      }));
+  auto const totals = make_std_vector_sync(d_totals, stream);
+
+  // allocate each column's offsets and chars, choosing 64-bit offsets per column as needed
+  auto const threshold = strings::detail::get_offset64_threshold();
+  std::vector<std::unique_ptr<column>> offsets_columns;
+  std::vector<rmm::device_uvector<char>> chars;
+  std::vector<void*> offsets_targets;
+  std::vector<char*> chars_targets;
+  std::vector<uint8_t> offsets_is_64bit;
+  for (size_type c = 0; c < num_columns; ++c) {
+    CUDF_EXPECTS(strings::detail::is_large_strings_enabled() || totals[c] < threshold,
+                 "Size of output exceeds the column size limit",
+                 std::overflow_error);
+    auto const is_64bit = totals[c] >= threshold;
+    offsets_columns.push_back(
+      make_numeric_column(data_type{is_64bit ? type_id::INT64 : type_id::INT32},
+                          map_size + 1,
+                          mask_state::UNALLOCATED,
+                          stream,
+                          mr));
+    chars.emplace_back(totals[c], stream, mr);
+    offsets_targets.push_back(offsets_columns.back()->mutable_view().head());
+    chars_targets.push_back(chars.back().data());
+    offsets_is_64bit.push_back(is_64bit);
+  }
+  auto const d_offsets_targets =
+    make_device_uvector_async(offsets_targets, stream, rmm::mr::get_current_device_resource());
+  auto const d_chars_targets =
+    make_device_uvector_async(chars_targets, stream, rmm::mr::get_current_device_resource());
+  auto const d_offsets_is_64bit =
+    make_device_uvector_async(offsets_is_64bit, stream, rmm::mr::get_current_device_resource());
+
+  // copy every column's offsets out of the combined scan in one pass
+  thrust::for_each(rmm::exec_policy_nosync(stream),
+                   thrust::counting_iterator<int64_t>(0),
+                   thrust::counting_iterator<int64_t>(total),
+                   [offsets   = offsets.data(),
+                    targets   = d_offsets_targets.data(),
+                    is_64bit  = d_offsets_is_64bit.data(),
+                    stride] __device__(int64_t i) {
+                     auto const c   = i / stride;
+                     auto const row = i % stride;
+                     if (is_64bit[c]) {
+                       static_cast<int64_t*>(targets[c])[row] = offsets[i];
+                     } else {
+                       static_cast<int32_t*>(targets[c])[row] = static_cast<int32_t>(offsets[i]);
+                     }
+                   });
+
+  constexpr size_type block_size = 256;
+  auto const num_warps           = std::min(total, int64_t{65536} * (block_size / warp_size));
+  grid_1d const grid{static_cast<thread_index_type>(num_warps * warp_size), block_size};
+  gather_strings_chars_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+    *d_sources, d_chars_targets.data(), offsets.data(), gather_map, map_size);
+
+  std::vector<std::unique_ptr<column>> results;
+  for (size_type c = 0; c < num_columns; ++c) {
+    results.push_back(make_strings_column(map_size,
+                                          std::move(offsets_columns[c]),
+                                          chars[c].release(),
+                                          0,  // the bitmask pass sets these
+                                          rmm::device_buffer{}));
+  }
+  return results;
+}
+
+template <typename MapIterator>
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   MapIterator gather_map,
+                                                   size_type map_size,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto const check_bounds = bounds_policy == out_of_bounds_policy::NULLIFY;
+  auto const source_rows  = source_tables.front().num_rows();
+
+  // sort the columns of all tables into the batched groups
+  std::vector<column_view> fixed_width_sources;
+  std::vector<column_view> strings_sources;
+  std::vector<fixed_width_gather_info> fixed_width_infos;
+  std::vector<std::vector<std::unique_ptr<column>>> results(source_tables.size());
+  std::vector<std::unique_ptr<column>*> fixed_width_slots;
+  std::vector<std::unique_ptr<column>*> strings_slots;
+  for (std::size_t t = 0; t < source_tables.size(); ++t) {
+    results[t].resize(source_tables[t].num_columns());
+    for (size_type c = 0; c < source_tables[t].num_columns(); ++c) {
+      auto const& col = source_tables[t].column(c);
+      if (is_fixed_width(col.type()) && map_size > 0) {
+        results[t][c] =
+          make_fixed_width_column(col.type(), map_size, mask_state::UNALLOCATED, stream, mr);
+        auto const element_size = static_cast<int>(size_of(col.type()));
+        fixed_width_infos.push_back(
+          {col.head<uint8_t>() + static_cast<std::size_t>(col.offset()) * element_size,
+           results[t][c]->mutable_view().head(),
+           element_size});
+        fixed_width_sources.push_back(col);
+        fixed_width_slots.push_back(&results[t][c]);
+      } else if (col.type().id() == type_id::STRING && map_size > 0) {
+        strings_sources.push_back(col);
+        strings_slots.push_back(&results[t][c]);
+      } else {
+        // other types go through the regular per-column path, which also sets their bitmask
+        auto gathered = gather(table_view{{col}},
+                               gather_map,
+                               gather_map + map_size,
+                               bounds_policy,
+                               stream,
+                               mr);
+        results[t][c] = std::move(gathered->release().front());
+      }
+    }
+  }
+
+  if (not fixed_width_infos.empty()) {
+    auto const d_infos =
+      make_device_uvector_async(fixed_width_infos, stream, rmm::mr::get_current_device_resource());
+    constexpr size_type block_size = 256;
+    auto const num_columns         = static_cast<size_type>(fixed_width_infos.size());
+    // keep the total number of blocks bounded when there are many columns
+    grid_1d const grid{map_size, block_size};
+    auto const max_blocks_per_column = std::max(1, 65536 / num_columns);
+    dim3 const blocks(std::min(grid.num_blocks, max_blocks_per_column),
+                      std::min(num_columns, 65535));
+    gather_fixed_width_kernel<<<blocks, block_size, 0, stream.value()>>>(
+      d_infos.data(), num_columns, gather_map, map_size, source_rows, check_bounds);
+  }
+
+  if (not strings_sources.empty()) {
+    auto strings = gather_strings(
+      table_view{strings_sources}, gather_map, map_size, check_bounds, stream, mr);
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+      *strings_slots[i] = std::move(strings[i]);
+    }
+  }
+
+  // one bitmask pass covers every batched column
+  std::vector<column_view> batched_sources(fixed_width_sources);
+  batched_sources.insert(batched_sources.end(), strings_sources.begin(), strings_sources.end());
+  std::vector<std::unique_ptr<column>*> batched_slots(fixed_width_slots);
+  batched_slots.insert(batched_slots.end(), strings_slots.begin(), strings_slots.end());
+  auto const needs_bitmask =
+    check_bounds || std::any_of(batched_sources.begin(), batched_sources.end(), [](auto const& c) {
+      return c.nullable();
+    });
+  if (needs_bitmask && not batched_sources.empty()) {
+    std::vector<std::unique_ptr<column>> targets;
+    for (auto slot : batched_slots) {
+      targets.push_back(std::move(*slot));
+    }
+    auto const op = check_bounds ? gather_bitmask_op::NULLIFY : gather_bitmask_op::DONT_CHECK;
+    gather_bitmask(table_view{batched_sources}, gather_map, targets, op, stream, mr);
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+      *batched_slots[i] = std::move(targets[i]);
+    }
+  }
+
+  std::vector<std::unique_ptr<table>> tables;
+  for (auto& columns : results) {
+    tables.push_back(std::make_unique<table>(std::move(columns)));
+  }
+  return tables;
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   column_view const& gather_map,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   negative_index_policy neg_indices,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(not gather_map.has_nulls(), "gather_map contains nulls", std::invalid_argument);
+  if (source_tables.empty()) { return {}; }
+  auto const n_rows = source_tables.front().num_rows();
+  CUDF_EXPECTS(std::all_of(source_tables.begin(),
+                           source_tables.end(),
+                           [n_rows](auto const& t) { return t.num_rows() == n_rows; }),
+               "All source tables must have the same number of rows",
+               std::invalid_argument);
+
+  auto map_begin = indexalator_factory::make_input_iterator(gather_map);
+  if (neg_indices == negative_index_policy::ALLOWED) {
+    auto idx_converter = cuda::proclaim_return_type<size_type>(
+      [n_rows] __device__(size_type in) { return in < 0 ? in + n_rows : in; });
+    return batched_gather(source_tables,
+                          thrust::make_transform_iterator(map_begin, idx_converter),
+                          gather_map.size(),
+                          bounds_policy,
+                          stream,
+                          mr);
+  }
+  return batched_gather(source_tables, map_begin, gather_map.size(), bounds_policy, stream, mr);
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   column_view const& gather_map,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+
+  return detail::batched_gather(source_tables, gather_map, bounds_policy, index_policy, stream, mr);
+}
+
+}  // namespace cudf
@@ -480,6 +480,23 @@ void bounds_and_type_check(host_span<column_view const> cols, rmm::cuda_stream_v
   cudf::type_dispatcher(cols.front().type(), traverse_children{}, cols, stream);
 }
 
+/**
+ * @brief Concatenates columns that have already passed `bounds_and_type_check`
+ */
+std::unique_ptr<column> concatenate_checked(host_span<column_view const> columns_to_concat,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  if (std::all_of(columns_to_concat.begin(), columns_to_concat.end(), [](column_view const& c) {
+        return c.is_empty();
+      })) {
+    return empty_like(columns_to_concat.front());
+  }
+
+  return type_dispatcher<dispatch_storage_type>(
+    columns_to_concat.front().type(), concatenate_dispatch{columns_to_concat, stream, mr});
+}
+
 }  // anonymous namespace
 
 // Concatenates the elements from a vector of column_views
@@ -492,14 +509,7 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns_to_conc
   // verify all types match and that we won't overflow size_type in output size
   bounds_and_type_check(columns_to_concat, stream);
 
-  if (std::all_of(columns_to_concat.begin(), columns_to_concat.end(), [](column_view const& c) {
-        return c.is_empty();
-      })) {
-    return empty_like(columns_to_concat.front());
-  }
-
-  return type_dispatcher<dispatch_storage_type>(
-    columns_to_concat.front().type(), concatenate_dispatch{columns_to_concat, stream, mr});
+  return concatenate_checked(columns_to_concat, stream, mr);
 }
 
 std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
@@ -524,9 +534,10 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                    std::back_inserter(cols),
                    [i](auto const& t) { return t.column(i); });
 
-    // verify all types match and that we won't overflow size_type in output size
+    // verify all types match and that we won't overflow size_type in output size;
+    // checking nested columns reads their offsets from the device, so only do it once
     bounds_and_type_check(cols, stream);
-    concat_columns.emplace_back(detail::concatenate(cols, stream, mr));
+    concat_columns.emplace_back(concatenate_checked(cols, stream, mr));
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
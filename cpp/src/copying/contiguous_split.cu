@@ -22,12 +22,14 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -49,6 +51,7 @@
 
 #include <cstddef>
 #include <numeric>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 
@@ -75,7 +78,7 @@ static constexpr std::size_t desired_batch_size = 1 * 1024 * 1024;
  */
 struct src_buf_info {
   src_buf_info(cudf::type_id _type,
-               int const* _offsets,
+               void const* _offsets,
                int _offset_stack_pos,
                int _parent_offsets_index,
                bool _is_validity,
@@ -89,8 +92,19 @@ struct src_buf_info {
   {
   }
 
+  /**
+   * @brief Returns the offset value at `index` of this offsets buffer
+   *
+   * String offsets may be 32 or 64-bit, as given by `type`.
+   */
+  __device__ int64_t offset_at(int64_t index) const
+  {
+    return type == type_id::INT64 ? static_cast<int64_t const*>(offsets)[index]
+                                  : static_cast<int32_t const*>(offsets)[index];
+  }
+
   cudf::type_id type;
-  int const* offsets;        // a pointer to device memory offsets if I am an offset buffer
+  void const* offsets;       // a pointer to device memory offsets if I am an offset buffer
   int offset_stack_pos;      // position in the offset stack buffer
   int parent_offsets_index;  // immediate parent that has offsets, or -1 if none
   bool is_validity;          // if I am a validity buffer
@@ -107,14 +121,14 @@ struct src_buf_info {
 struct dst_buf_info {
   // constant across all copy commands for this buffer
   std::size_t buf_size;  // total size of buffer, including padding
-  int num_elements;      // # of elements to be copied
+  int64_t num_elements;  // # of elements to be copied
   int element_size;      // size of each element in bytes
-  int num_rows;  // # of rows to be copied(which may be different from num_elements in the case of
-                 // validity or offset buffers)
+  int64_t num_rows;  // # of rows to be copied(which may be different from num_elements in the case
+                     // of validity or offset buffers). this is a byte count for chars buffers.
 
-  int src_element_index;   // element index to start reading from my associated source buffer
-  std::size_t dst_offset;  // my offset into the per-partition allocation
-  int value_shift;         // amount to shift values down by (for offset buffers)
+  int64_t src_element_index;  // element index to start reading from my associated source buffer
+  std::size_t dst_offset;     // my offset into the per-partition allocation
+  int64_t value_shift;        // amount to shift values down by (for offset buffers)
   int bit_shift;           // # of bits to shift right by (for validity buffers)
   size_type valid_count;   // validity count for this block of work
 
@@ -146,7 +160,7 @@ struct dst_buf_info {
  * @param element_size Size of each element in bytes
  * @param src_element_index Element index to start copying at
  * @param stride Size of the kernel block
- * @param value_shift Shift incoming 4-byte offset values down by this amount
+ * @param value_shift Shift incoming 4 or 8-byte offset values down by this amount
  * @param bit_shift Shift incoming data right by this many bits
  * @param num_rows Number of rows being copied
  * @param valid_count Optional pointer to a value to store count of set bits
@@ -159,13 +173,25 @@ __device__ void copy_buffer(uint8_t* __restrict__ dst,
                             std::size_t element_size,
                             std::size_t src_element_index,
                             uint32_t stride,
-                            int value_shift,
+                            int64_t value_shift,
                             int bit_shift,
                             std::size_t num_rows,
                             size_type* valid_count)
 {
   src += (src_element_index * element_size);
 
+  // 64-bit offsets are shifted element by element. offsets buffers and their batches always
+  // start 8-byte aligned, so no misalignment handling is needed.
+  if (element_size == sizeof(int64_t) && value_shift != 0) {
+    auto const* in64 = reinterpret_cast<int64_t const*>(src);
+    auto* out64      = reinterpret_cast<int64_t*>(dst);
+    for (std::size_t idx = t; idx < num_elements; idx += stride) {
+      out64[idx] = in64[idx] - value_shift;
+    }
+    return;
+  }
+  auto const value_shift32 = static_cast<uint32_t>(value_shift);
+
   size_type thread_valid_count = 0;
 
   // handle misalignment. read 16 bytes in 4 byte reads. write in a single 16 byte store.
@@ -184,10 +210,10 @@ __device__ void copy_buffer(uint8_t* __restrict__ dst,
       v.z = __funnelshift_r(v.z, v.w, ofs * 8 + bit_shift);
       v.w = __funnelshift_r(v.w, in32[4], ofs * 8 + bit_shift);
     }
-    v.x -= value_shift;
-    v.y -= value_shift;
-    v.z -= value_shift;
-    v.w -= value_shift;
+    v.x -= value_shift32;
+    v.y -= value_shift32;
+    v.z -= value_shift32;
+    v.w -= value_shift32;
     reinterpret_cast<uint4*>(dst)[pos / 16] = v;
     if (valid_count) {
       thread_valid_count += (__popc(v.x) + __popc(v.y) + __popc(v.z) + __popc(v.w));
@@ -214,7 +240,8 @@ __device__ void copy_buffer(uint8_t* __restrict__ dst,
     // and will never both be true at the same time.
     if (value_shift || bit_shift) {
       std::size_t idx = (num_bytes - remainder) / 4;
-      uint32_t v = remainder > 0 ? (reinterpret_cast<uint32_t const*>(src)[idx] - value_shift) : 0;
+      uint32_t v =
+        remainder > 0 ? (reinterpret_cast<uint32_t const*>(src)[idx] - value_shift32) : 0;
 
       constexpr size_type rows_per_element = 32;
       auto const have_trailing_bits = ((num_elements * rows_per_element) - num_rows) < bit_shift;
@@ -222,9 +249,10 @@ __device__ void copy_buffer(uint8_t* __restrict__ dst,
         // if we're at the very last word of a validity copy, we do not always need to read the next
         // word to get the final trailing bits.
         auto const read_trailing_bits = bit_shift > 0 && remainder == 4 && have_trailing_bits;
-        uint32_t const next           = (read_trailing_bits || remainder > 4)
-                                          ? (reinterpret_cast<uint32_t const*>(src)[idx + 1] - value_shift)
-                                          : 0;
+        uint32_t const next =
+          (read_trailing_bits || remainder > 4)
+            ? (reinterpret_cast<uint32_t const*>(src)[idx + 1] - value_shift32)
+            : 0;
 
         uint32_t const val = (v >> bit_shift) | (next << (32 - bit_shift));
         if (valid_count) { thread_valid_count += __popc(val); }
@@ -537,10 +565,10 @@ std::pair<src_buf_info*, size_type> buf_info_functor::operator()<cudf::string_vi
     // info for the offsets buffer
     auto offset_col = current;
     CUDF_EXPECTS(not scv.offsets().nullable(), "Encountered nullable string offsets column");
-    *current = src_buf_info(type_id::INT32,
+    *current = src_buf_info(scv.offsets().type().id(),
                             // note: offsets can be null in the case where the string column
-                            // has been created with empty_like().
-                            scv.offsets().begin<cudf::id_to_type<type_id::INT32>>(),
+                            // has been created with empty_like(). they may be INT32 or INT64.
+                            scv.offsets().head(),
                             offset_stack_pos,
                             parent_offset_index,
                             false,
@@ -707,11 +735,12 @@ std::tuple<size_type, int64_t, int64_t, size_type> build_output_column_metadata(
 
       // use_src_null_count is used for the chunked contig split case, where we have
       // no splits: the null_count is just the source column's null_count
-      size_type const null_count = use_src_null_count
-                                     ? src.null_count()
-                                     : (current_info->num_elements == 0
-                                          ? 0
-                                          : (current_info->num_rows - current_info->valid_count));
+      size_type const null_count =
+        use_src_null_count
+          ? src.null_count()
+          : (current_info->num_elements == 0
+               ? 0
+               : static_cast<size_type>(current_info->num_rows - current_info->valid_count));
 
       ++current_info;
       return std::pair(bitmask_offset, null_count);
@@ -730,7 +759,7 @@ std::tuple<size_type, int64_t, int64_t, size_type> build_output_column_metadata(
 
       // otherwise my actual number of rows will be the num_rows field of the next dst_buf_info
       // struct (our child offsets column)
-      return (current_info + 1)->num_rows;
+      return static_cast<size_type>((current_info + 1)->num_rows);
     }
 
     // otherwise the number of rows is the number of elements
@@ -1248,28 +1277,30 @@ std::unique_ptr<packed_partition_buf_size_and_dst_buf_info> compute_splits(
         parent_offsets_index       = d_src_buf_info[parent_offsets_index].parent_offsets_index;
       }
       // make sure to include the -column- offset on the root column in our calculation.
-      int row_start = d_indices[split_index] + root_column_offset;
-      int row_end   = d_indices[split_index + 1] + root_column_offset;
+      // below a large strings column these become byte positions, which may exceed size_type.
+      int64_t row_start = d_indices[split_index] + root_column_offset;
+      int64_t row_end   = d_indices[split_index + 1] + root_column_offset;
       while (stack_size > 0) {
         stack_size--;
-        auto const offsets = d_src_buf_info[offset_stack[stack_size]].offsets;
+        auto const& offsets_info = d_src_buf_info[offset_stack[stack_size]];
         // this case can happen when you have empty string or list columns constructed with
         // empty_like()
-        if (offsets != nullptr) {
-          row_start = offsets[row_start];
-          row_end   = offsets[row_end];
+        if (offsets_info.offsets != nullptr) {
+          row_start = offsets_info.offset_at(row_start);
+          row_end   = offsets_info.offset_at(row_end);
         }
       }
 
       // final element indices and row count
-      int const src_element_index = src_info.is_validity ? row_start / 32 : row_start;
-      int const num_rows          = row_end - row_start;
+      int64_t const src_element_index = src_info.is_validity ? row_start / 32 : row_start;
+      int64_t const num_rows          = row_end - row_start;
       // if I am an offsets column, all my values need to be shifted
-      int const value_shift = src_info.offsets == nullptr ? 0 : src_info.offsets[row_start];
+      int64_t const value_shift =
+        src_info.offsets == nullptr ? 0 : src_info.offset_at(row_start);
       // if I am a validity column, we may need to shift bits
-      int const bit_shift = src_info.is_validity ? row_start % 32 : 0;
+      int const bit_shift = src_info.is_validity ? static_cast<int>(row_start % 32) : 0;
       // # of rows isn't necessarily the same as # of elements to be copied.
-      auto const num_elements = [&]() {
+      auto const num_elements = [&]() -> int64_t {
         if (src_info.offsets != nullptr && num_rows > 0) {
           return num_rows + 1;
         } else if (src_info.is_validity) {
@@ -1467,7 +1498,7 @@ std::unique_ptr<chunk_iteration_state> chunk_iteration_state::create(
      d_batch_offsets        = d_batch_offsets.begin(),
      out_to_in_index] __device__(size_type i) {
       size_type const in_buf_index = out_to_in_index(i);
-      size_type const batch_index  = i - d_batch_offsets[in_buf_index];
+      int64_t const batch_index    = i - d_batch_offsets[in_buf_index];
       auto const batch_size        = thrust::get<1>(batches[in_buf_index]);
       dst_buf_info const& in       = d_orig_dst_buf_info[in_buf_index];
 
@@ -1481,17 +1512,17 @@ std::unique_ptr<chunk_iteration_state> chunk_iteration_state::create(
       out.src_buf_index = in.src_buf_index;
       out.dst_buf_index = in.dst_buf_index;
 
-      size_type const elements_per_batch =
+      int64_t const elements_per_batch =
         out.element_size == 0 ? 0 : batch_size / out.element_size;
       out.num_elements = ((batch_index + 1) * elements_per_batch) > in.num_elements
                            ? in.num_elements - (batch_index * elements_per_batch)
                            : elements_per_batch;
 
-      size_type const rows_per_batch =
+      int64_t const rows_per_batch =
         // if this is a validity buffer, each element is a bitmask_type, which
         // corresponds to 32 rows.
         out.valid_count > 0
-          ? elements_per_batch * static_cast<size_type>(cudf::detail::size_in_bits<bitmask_type>())
+          ? elements_per_batch * static_cast<int64_t>(cudf::detail::size_in_bits<bitmask_type>())
           : elements_per_batch;
       out.num_rows = ((batch_index + 1) * rows_per_batch) > in.num_rows
                        ? in.num_rows - (batch_index * rows_per_batch)
@@ -1746,6 +1777,39 @@ bool check_inputs(cudf::table_view const& input, std::vector<size_type> const& s
   return input.column(0).size() == 0;
 }
 
+/**
+ * @brief A device bounce buffer used by `contiguous_split_to_host`.
+ *
+ * `packed` is recorded once a chunk has been packed into `data`, and `copied` once that chunk has
+ * been copied out to host, after which `data` may be reused.
+ */
+struct bounce_buffer {
+  bounce_buffer(std::size_t size, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+    : data(size, stream, mr)
+  {
+    CUDF_CUDA_TRY(cudaEventCreateWithFlags(&packed, cudaEventDisableTiming));
+    CUDF_CUDA_TRY(cudaEventCreateWithFlags(&copied, cudaEventDisableTiming));
+  }
+
+  ~bounce_buffer()
+  {
+    cudaEventDestroy(packed);
+    cudaEventDestroy(copied);
+  }
+
+  bounce_buffer(bounce_buffer const&)            = delete;
+  bounce_buffer& operator=(bounce_buffer const&) = delete;
+
+  [[nodiscard]] cudf::device_span<uint8_t> span()
+  {
+    return {static_cast<uint8_t*>(data.data()), data.size()};
+  }
+
+  rmm::device_buffer data;
+  cudaEvent_t packed{};
+  cudaEvent_t copied{};
+};
+
 };  // anonymous namespace
 
 namespace detail {
@@ -1872,6 +1936,48 @@ struct contiguous_split_state {
     return chunk_iter_state->advance_iteration();
   }
 
+  std::size_t contiguous_split_to_host(cudf::host_span<uint8_t> host_buffer)
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(host_buffer.size() >= get_total_contiguous_size(),
+                 "The host buffer is smaller than the packed table",
+                 std::invalid_argument);
+
+    // Two bounce buffers let the batched copy of one chunk run on `stream` while the previous
+    // chunk is still being transferred to host on `copy_stream`
+    constexpr int num_bounce_buffers = 2;
+    std::vector<std::unique_ptr<bounce_buffer>> bounce_buffers;
+    for (int i = 0; i < num_bounce_buffers && has_next(); ++i) {
+      bounce_buffers.push_back(std::make_unique<bounce_buffer>(user_buffer_size, stream, temp_mr));
+    }
+
+    auto const copy_streams = cudf::detail::fork_streams(stream, 1);
+    auto const copy_stream  = copy_streams.front();
+
+    std::size_t host_offset = 0;
+    for (std::size_t idx = 0; has_next(); idx = (idx + 1) % bounce_buffers.size()) {
+      auto& buffer = *bounce_buffers[idx];
+
+      // don't overwrite the bounce buffer until its previous chunk has reached the host
+      CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), buffer.copied, 0));
+      std::size_t const bytes_copied = contiguous_split_chunk(buffer.span());
+      CUDF_CUDA_TRY(cudaEventRecord(buffer.packed, stream.value()));
+
+      CUDF_CUDA_TRY(cudaStreamWaitEvent(copy_stream.value(), buffer.packed, 0));
+      CUDF_CUDA_TRY(cudaMemcpyAsync(host_buffer.data() + host_offset,
+                                    buffer.data.data(),
+                                    bytes_copied,
+                                    cudaMemcpyDefault,
+                                    copy_stream.value()));
+      CUDF_CUDA_TRY(cudaEventRecord(buffer.copied, copy_stream.value()));
+      host_offset += bytes_copied;
+    }
+
+    cudf::detail::join_streams(copy_streams, stream);
+    stream.synchronize();
+    return host_offset;
+  }
+
   std::unique_ptr<std::vector<uint8_t>> build_packed_column_metadata()
   {
     CUDF_EXPECTS(num_partitions == 1, "build_packed_column_metadata supported only without splits");
@@ -2111,6 +2217,11 @@ std::size_t chunked_pack::next(cudf::device_span<uint8_t> const& user_buffer)
   return state->contiguous_split_chunk(user_buffer);
 }
 
+std::size_t chunked_pack::pack_to_host(cudf::host_span<uint8_t> host_buffer)
+{
+  return state->contiguous_split_to_host(host_buffer);
+}
+
 std::unique_ptr<std::vector<uint8_t>> chunked_pack::build_metadata() const
 {
   return state->build_packed_column_metadata();
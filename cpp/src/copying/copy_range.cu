@@ -37,8 +37,6 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
-#include <thrust/iterator/constant_iterator.h>
-
 #include <memory>
 #include <stdexcept>
 
@@ -52,7 +50,11 @@ void in_place_copy_range(cudf::column_view const& source,
                          rmm::cuda_stream_view stream)
 {
   auto p_source_device_view = cudf::column_device_view::create(source, stream);
-  if (source.has_nulls()) {
+  // a range without nulls is copied without reading the source validity
+  if (source.has_nulls() && cudf::detail::null_count(source.null_mask(),
+                                                     source.offset() + source_begin,
+                                                     source.offset() + source_end,
+                                                     stream) > 0) {
     cudf::detail::copy_range(
       cudf::detail::make_null_replacement_iterator<T>(*p_source_device_view, T()) + source_begin,
       cudf::detail::make_validity_iterator(*p_source_device_view) + source_begin,
@@ -62,7 +64,7 @@ void in_place_copy_range(cudf::column_view const& source,
       stream);
   } else {
     cudf::detail::copy_range(p_source_device_view->begin<T>() + source_begin,
-                             thrust::make_constant_iterator(true),  // dummy
+                             true,
                              target,
                              target_begin,
                              target_begin + (source_end - source_begin),
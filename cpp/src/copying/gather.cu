@@ -44,6 +44,19 @@ std::unique_ptr<table> gather(table_view const& source_table,
 {
   CUDF_EXPECTS(not gather_map.has_nulls(), "gather_map contains nulls", std::invalid_argument);
 
+  // indices known to be in bounds need no negative-index or bounds handling, so an int32 map is
+  // read directly instead of through the type-dispatching indexalator
+  if (bounds_policy == out_of_bounds_policy::DONT_CHECK &&
+      neg_indices == negative_index_policy::NOT_ALLOWED &&
+      gather_map.type().id() == type_to_id<size_type>()) {
+    return gather(source_table,
+                  gather_map.begin<size_type>(),
+                  gather_map.end<size_type>(),
+                  out_of_bounds_policy::DONT_CHECK,
+                  stream,
+                  mr);
+  }
+
   // create index type normalizing iterator for the gather_map
   auto map_begin = indexalator_factory::make_input_iterator(gather_map);
   auto map_end   = map_begin + gather_map.size();
@@ -96,4 +109,26 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr);
 }
 
+std::unique_ptr<table> gather(table_view const& source_table,
+                              column_view const& gather_map,
+                              gather_map_policy map_policy,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (map_policy == gather_map_policy::IN_BOUNDS) {
+    return detail::gather(source_table,
+                          gather_map,
+                          out_of_bounds_policy::DONT_CHECK,
+                          detail::negative_index_policy::NOT_ALLOWED,
+                          stream,
+                          mr);
+  }
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+  return detail::gather(
+    source_table, gather_map, out_of_bounds_policy::DONT_CHECK, index_policy, stream, mr);
+}
+
 }  // namespace cudf
@@ -22,6 +22,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <stdexcept>
+
 namespace cudf {
 namespace detail {
 
@@ -199,6 +201,28 @@ class metadata_builder_impl {
   std::vector<detail::serialized_column> metadata;
 };
 
+packed_compression_info get_packed_compression(uint8_t const* metadata)
+{
+  // the first entry is the stub added by `metadata_builder`; it leaves `null_count` and the
+  // offsets unused, so the compression parameters are kept there
+  auto const stub = reinterpret_cast<serialized_column const*>(metadata)[0];
+  return {static_cast<io::compression_type>(stub.null_count),
+          static_cast<std::size_t>(stub.data_offset),
+          static_cast<std::size_t>(stub.null_mask_offset)};
+}
+
+void set_packed_compression(uint8_t* metadata, packed_compression_info const& info)
+{
+  auto stub              = reinterpret_cast<serialized_column*>(metadata);
+  stub->null_count       = static_cast<size_type>(info.compression);
+  stub->data_offset      = info.compression == io::compression_type::NONE
+                             ? -1
+                             : static_cast<int64_t>(info.uncompressed_size);
+  stub->null_mask_offset = info.compression == io::compression_type::NONE
+                             ? -1
+                             : static_cast<int64_t>(info.block_size);
+}
+
 /**
  * @copydoc cudf::detail::unpack
  */
@@ -206,6 +230,9 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
 {
   // gpu data can be null if everything is empty but the metadata must always be valid
   CUDF_EXPECTS(metadata != nullptr, "Encountered invalid packed column input");
+  CUDF_EXPECTS(get_packed_compression(metadata).compression == io::compression_type::NONE,
+               "Compressed packed columns must be decompressed before unpacking",
+               std::invalid_argument);
   auto serialized_columns = reinterpret_cast<serialized_column const*>(metadata);
   uint8_t const* base_ptr = gpu_data;
   // first entry is a stub where size == the total # of top level columns (see pack_metadata above)
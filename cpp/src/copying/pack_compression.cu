@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using io::compression_result;
+using io::compression_status;
+
+// Uncompressed size of each independently compressed block of `gpu_data`
+constexpr std::size_t packed_block_size = 64 * 1024;
+
+// Compressed blocks are stored at offsets aligned for the decompressors
+constexpr std::size_t packed_block_alignment = 8;
+
+io::nvcomp::compression_type to_nvcomp_compression_type(io::compression_type compression)
+{
+  switch (compression) {
+    case io::compression_type::LZ4: return io::nvcomp::compression_type::LZ4;
+    case io::compression_type::SNAPPY: return io::nvcomp::compression_type::SNAPPY;
+    case io::compression_type::ZSTD: return io::nvcomp::compression_type::ZSTD;
+    default:
+      CUDF_FAIL("Unsupported compression type for packed columns", std::invalid_argument);
+  }
+}
+
+/**
+ * @brief Splits `data` into consecutive blocks of at most `block_size` bytes.
+ */
+std::vector<device_span<uint8_t const>> make_blocks(device_span<uint8_t const> data,
+                                                    std::size_t block_size)
+{
+  auto const num_blocks = cudf::util::div_rounding_up_safe(data.size(), block_size);
+  std::vector<device_span<uint8_t const>> blocks;
+  blocks.reserve(num_blocks);
+  for (std::size_t offset = 0; offset < data.size(); offset += block_size) {
+    blocks.emplace_back(data.subspan(offset, std::min(block_size, data.size() - offset)));
+  }
+  return blocks;
+}
+
+/**
+ * @brief Copies each of `inputs` into the corresponding `outputs` with a single kernel.
+ */
+void copy_blocks(std::vector<device_span<uint8_t const>> const& inputs,
+                 std::vector<device_span<uint8_t>> const& outputs,
+                 rmm::cuda_stream_view stream)
+{
+  if (inputs.empty()) { return; }
+  auto const mr        = rmm::mr::get_current_device_resource();
+  auto const d_inputs  = cudf::detail::make_device_uvector_async(inputs, stream, mr);
+  auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream, mr);
+  io::gpu_copy_uncompressed_blocks(d_inputs, d_outputs, stream);
+}
+
+void expect_success(rmm::device_uvector<compression_result> const& results,
+                    rmm::cuda_stream_view stream,
+                    std::string const& error)
+{
+  auto const h_results = cudf::detail::make_std_vector_sync(results, stream);
+  CUDF_EXPECTS(std::all_of(h_results.begin(),
+                           h_results.end(),
+                           [](auto const& res) {
+                             return res.status == compression_status::SUCCESS;
+                           }),
+               error);
+}
+
+}  // namespace
+
+packed_columns compress_packed(packed_columns const& input,
+                               io::compression_type compression,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  auto const codec = to_nvcomp_compression_type(compression);
+  if (input.metadata->empty()) { return packed_columns{}; }
+  CUDF_EXPECTS(get_packed_compression(input.metadata->data()).compression ==
+                 io::compression_type::NONE,
+               "Packed columns are already compressed",
+               std::invalid_argument);
+  if (auto const reason = io::nvcomp::is_compression_disabled(codec); reason) {
+    CUDF_FAIL("Compression error: " + reason.value());
+  }
+
+  auto const data       = device_span<uint8_t const>(
+    static_cast<uint8_t const*>(input.gpu_data->data()), input.gpu_data->size());
+  auto const blocks     = make_blocks(data, packed_block_size);
+  auto const num_blocks = blocks.size();
+
+  // Compress every block into its own worst-case sized slot of a scratch buffer
+  auto const max_comp_block_size =
+    cudf::util::round_up_safe(io::nvcomp::compress_max_output_chunk_size(codec, packed_block_size),
+                              packed_block_alignment);
+  rmm::device_buffer comp_data(num_blocks * max_comp_block_size, stream);
+  auto const comp_base = static_cast<uint8_t*>(comp_data.data());
+  std::vector<device_span<uint8_t>> comp_blocks;
+  comp_blocks.reserve(num_blocks);
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    comp_blocks.emplace_back(comp_base + b * max_comp_block_size, max_comp_block_size);
+  }
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  rmm::device_uvector<compression_result> results(num_blocks, stream, temp_mr);
+  if (num_blocks > 0) {
+    thrust::fill(rmm::exec_policy_nosync(stream, temp_mr),
+                 results.begin(),
+                 results.end(),
+                 compression_result{0, compression_status::FAILURE});
+    auto const d_blocks = cudf::detail::make_device_uvector_async(blocks, stream, temp_mr);
+    auto const d_comp_blocks =
+      cudf::detail::make_device_uvector_async(comp_blocks, stream, temp_mr);
+    io::nvcomp::batched_compress(codec, d_blocks, d_comp_blocks, results, stream);
+  }
+  auto const h_results = cudf::detail::make_std_vector_sync(results, stream);
+
+  // Blocks that failed to compress or did not shrink are stored as-is, which `decompress_packed`
+  // detects from their stored size being the full block size
+  std::vector<uint64_t> stored_sizes(num_blocks);
+  std::vector<std::size_t> offsets(num_blocks + 1, 0);
+  std::vector<device_span<uint8_t const>> copy_in;
+  copy_in.reserve(num_blocks);
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    auto const& res       = h_results[b];
+    auto const is_smaller = res.status == compression_status::SUCCESS and
+                            res.bytes_written < blocks[b].size();
+    stored_sizes[b]       = is_smaller ? res.bytes_written : blocks[b].size();
+    offsets[b + 1] =
+      offsets[b] + cudf::util::round_up_safe(std::size_t{stored_sizes[b]}, packed_block_alignment);
+    copy_in.push_back(is_smaller
+                        ? device_span<uint8_t const>(comp_blocks[b].data(), stored_sizes[b])
+                        : blocks[b]);
+  }
+
+  auto gpu_data       = std::make_unique<rmm::device_buffer>(offsets.back(), stream, mr);
+  auto const out_base = static_cast<uint8_t*>(gpu_data->data());
+  std::vector<device_span<uint8_t>> copy_out;
+  copy_out.reserve(num_blocks);
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    copy_out.emplace_back(out_base + offsets[b], stored_sizes[b]);
+  }
+  copy_blocks(copy_in, copy_out, stream);
+
+  // The stored size of each block is appended to the column metadata
+  auto metadata       = std::make_unique<std::vector<uint8_t>>(*input.metadata);
+  auto const meta_end = metadata->size();
+  metadata->resize(meta_end + num_blocks * sizeof(uint64_t));
+  std::memcpy(metadata->data() + meta_end, stored_sizes.data(), num_blocks * sizeof(uint64_t));
+  set_packed_compression(metadata->data(), {compression, data.size(), packed_block_size});
+
+  stream.synchronize();
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+packed_columns decompress_packed(packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  if (input.metadata->empty()) { return packed_columns{}; }
+  auto const info = get_packed_compression(input.metadata->data());
+  CUDF_EXPECTS(info.compression != io::compression_type::NONE,
+               "Packed columns are not compressed",
+               std::invalid_argument);
+  auto const codec = to_nvcomp_compression_type(info.compression);
+
+  auto const num_blocks =
+    cudf::util::div_rounding_up_safe(info.uncompressed_size, info.block_size);
+  auto const trailer_size = num_blocks * sizeof(uint64_t);
+  CUDF_EXPECTS(input.metadata->size() > trailer_size, "Encountered invalid packed column input");
+  auto const meta_end = input.metadata->size() - trailer_size;
+  std::vector<uint64_t> stored_sizes(num_blocks);
+  std::memcpy(stored_sizes.data(), input.metadata->data() + meta_end, trailer_size);
+
+  auto gpu_data       = std::make_unique<rmm::device_buffer>(info.uncompressed_size, stream, mr);
+  auto const in_base  = static_cast<uint8_t const*>(input.gpu_data->data());
+  auto const out_base = static_cast<uint8_t*>(gpu_data->data());
+
+  std::vector<device_span<uint8_t const>> comp_in, copy_in;
+  std::vector<device_span<uint8_t>> comp_out, copy_out;
+  std::size_t in_offset = 0;
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    auto const out_offset = b * info.block_size;
+    auto const out_size   = std::min(info.block_size, info.uncompressed_size - out_offset);
+    auto const in_block   = device_span<uint8_t const>(in_base + in_offset, stored_sizes[b]);
+    auto const out_block  = device_span<uint8_t>(out_base + out_offset, out_size);
+    if (stored_sizes[b] < out_size) {
+      comp_in.push_back(in_block);
+      comp_out.push_back(out_block);
+    } else {
+      copy_in.push_back(in_block);
+      copy_out.push_back(out_block);
+    }
+    in_offset += cudf::util::round_up_safe(std::size_t{stored_sizes[b]}, packed_block_alignment);
+  }
+  CUDF_EXPECTS(in_offset == input.gpu_data->size(), "Encountered invalid packed column input");
+
+  if (not comp_in.empty()) {
+    if (auto const reason = io::nvcomp::is_decompression_disabled(codec); reason) {
+      CUDF_FAIL("Decompression error: " + reason.value());
+    }
+    auto const temp_mr    = rmm::mr::get_current_device_resource();
+    auto const d_comp_in  = cudf::detail::make_device_uvector_async(comp_in, stream, temp_mr);
+    auto const d_comp_out = cudf::detail::make_device_uvector_async(comp_out, stream, temp_mr);
+    rmm::device_uvector<compression_result> results(comp_in.size(), stream, temp_mr);
+    thrust::fill(rmm::exec_policy_nosync(stream, temp_mr),
+                 results.begin(),
+                 results.end(),
+                 compression_result{0, compression_status::FAILURE});
+    io::nvcomp::batched_decompress(
+      codec, d_comp_in, d_comp_out, results, info.block_size, info.uncompressed_size, stream);
+    expect_success(results, stream, "Decompression of packed columns failed");
+  }
+  copy_blocks(copy_in, copy_out, stream);
+
+  auto metadata = std::make_unique<std::vector<uint8_t>>(input.metadata->begin(),
+                                                         input.metadata->begin() + meta_end);
+  set_packed_compression(metadata->data(), {io::compression_type::NONE, 0, 0});
+
+  stream.synchronize();
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace detail
+
+packed_columns compress_packed(packed_columns const& input,
+                               io::compression_type compression,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress_packed(input, compression, cudf::get_default_stream(), mr);
+}
+
+packed_columns decompress_packed(packed_columns const& input, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_packed(input, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
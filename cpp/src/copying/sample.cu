@@ -20,21 +20,84 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// samples without replacement smaller than this fraction of the rows draw only the sampled
+// indices instead of shuffling every row index
+constexpr size_type sparse_sample_divisor = 8;
+
+/**
+ * @brief Returns `n` distinct random indices in `[0, num_rows)`, in random order
+ *
+ * Candidates are drawn with replacement, then sorted and deduplicated. When `n` is small
+ * relative to `num_rows` there are few duplicates, so a slightly larger draw almost always
+ * suffices and the memory used is proportional to `n` only.
+ */
+rmm::device_uvector<size_type> sample_distinct_indices(size_type n,
+                                                       size_type num_rows,
+                                                       int64_t seed,
+                                                       rmm::cuda_stream_view stream)
+{
+  auto num_candidates = static_cast<std::size_t>(n) + n / 4 + 32;
+  std::size_t drawn   = 0;
+  while (true) {
+    rmm::device_uvector<size_type> candidates(num_candidates, stream);
+    thrust::tabulate(rmm::exec_policy_nosync(stream),
+                     candidates.begin(),
+                     candidates.end(),
+                     [seed, num_rows, drawn] __device__(std::size_t i) {
+                       thrust::default_random_engine rng(seed);
+                       thrust::uniform_int_distribution<size_type> dist{0, num_rows - 1};
+                       rng.discard(drawn + i);
+                       return dist(rng);
+                     });
+    thrust::sort(rmm::exec_policy_nosync(stream), candidates.begin(), candidates.end());
+    auto const unique_end =
+      thrust::unique(rmm::exec_policy(stream), candidates.begin(), candidates.end());
+    auto const num_unique = thrust::distance(candidates.begin(), unique_end);
+    if (num_unique >= n) {
+      candidates.resize(num_unique, stream);
+      // the distinct values are a uniformly random subset; shuffling and truncating keeps it so
+      thrust::shuffle(rmm::exec_policy_nosync(stream),
+                      candidates.begin(),
+                      candidates.end(),
+                      thrust::default_random_engine(seed));
+      candidates.resize(n, stream);
+      return candidates;
+    }
+    drawn += num_candidates;
+    num_candidates *= 2;
+  }
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -63,6 +126,14 @@ std::unique_ptr<table> sample(table_view const& input,
     auto begin = cudf::detail::make_counting_transform_iterator(0, RandomGen);
 
     return detail::gather(input, begin, begin + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  } else if (n <= num_rows / sparse_sample_divisor) {
+    auto const gather_map = sample_distinct_indices(n, num_rows, seed, stream);
+    return detail::gather(input,
+                          gather_map.begin(),
+                          gather_map.end(),
+                          out_of_bounds_policy::DONT_CHECK,
+                          stream,
+                          mr);
   } else {
     auto gather_map =
       make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
@@ -86,6 +157,77 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> segmented_sample(
+  table_view const& input,
+  column_view const& segment_offsets,
+  size_type const n,
+  sample_with_replacement replacement,
+  int64_t const seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    n >= 0, "expected number of samples should be non-negative", std::invalid_argument);
+  CUDF_EXPECTS(segment_offsets.type().id() == type_id::INT32 and not segment_offsets.has_nulls(),
+               "segment_offsets must be a non-nullable INT32 column",
+               std::invalid_argument);
+
+  auto const num_segments = std::max(segment_offsets.size() - 1, 0);
+  auto out_offsets        = make_numeric_column(
+    data_type{type_id::INT32}, num_segments + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_in_offsets  = segment_offsets.begin<size_type>();
+  auto const d_out_offsets = out_offsets->mutable_view().begin<size_type>();
+  auto const with_replacement = replacement == sample_with_replacement::TRUE;
+
+  // the last size is zero so the exclusive scan leaves the total in the last offset
+  auto const sizes = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<size_type>(
+      [d_in_offsets, num_segments, n, with_replacement] __device__(size_type i) -> size_type {
+        if (i >= num_segments) { return 0; }
+        auto const segment_size = d_in_offsets[i + 1] - d_in_offsets[i];
+        if (with_replacement) { return segment_size > 0 ? n : 0; }
+        return segment_size < n ? segment_size : n;
+      }));
+  auto const total =
+    cudf::detail::sizes_to_offsets(sizes, sizes + num_segments + 1, d_out_offsets, stream);
+  CUDF_EXPECTS(total <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  rmm::device_uvector<size_type> gather_map(total, stream);
+  thrust::tabulate(
+    rmm::exec_policy_nosync(stream),
+    gather_map.begin(),
+    gather_map.end(),
+    [d_in_offsets, d_out_offsets, num_segments, seed, with_replacement] __device__(size_type i) {
+      auto const segment =
+        thrust::distance(d_out_offsets,
+                         thrust::upper_bound(
+                           thrust::seq, d_out_offsets, d_out_offsets + num_segments + 1, i)) -
+        1;
+      auto const segment_begin = d_in_offsets[segment];
+      auto const segment_size  = d_in_offsets[segment + 1] - segment_begin;
+      thrust::default_random_engine rng(seed);
+      rng.discard(i);
+      if (with_replacement) {
+        thrust::uniform_int_distribution<size_type> dist{0, segment_size - 1};
+        return segment_begin + dist(rng);
+      }
+      // draw sample j from the j-th of k contiguous strata of the segment
+      auto const j  = static_cast<int64_t>(i - d_out_offsets[segment]);
+      auto const k  = static_cast<int64_t>(d_out_offsets[segment + 1] - d_out_offsets[segment]);
+      auto const lo = static_cast<size_type>(j * segment_size / k);
+      auto const hi = static_cast<size_type>((j + 1) * segment_size / k);
+      thrust::uniform_int_distribution<size_type> dist{lo, hi - 1};
+      return segment_begin + dist(rng);
+    });
+
+  auto result = detail::gather(
+    input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+  return {std::move(result), std::move(out_offsets)};
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
@@ -98,4 +240,17 @@ std::unique_ptr<table> sample(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::sample(input, n, replacement, seed, stream, mr);
 }
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> segmented_sample(
+  table_view const& input,
+  column_view const& segment_offsets,
+  size_type const n,
+  sample_with_replacement replacement,
+  int64_t const seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sample(input, segment_offsets, n, replacement, seed, stream, mr);
+}
 }  // namespace cudf
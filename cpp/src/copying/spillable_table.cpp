@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/utilities/config_utils.hpp"
+
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/rmm_host_vector.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/spillable_table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief The data of a spilled table
+ *
+ * Spilled buffers up to the pinned allocation threshold of the readers and writers are pinned,
+ * so that their transfers are asynchronous.
+ */
+struct spilled_data {
+  spilled_data(std::size_t size, rmm::cuda_stream_view stream)
+    : data(size, {cudf::io::detail::host_memory_resource_for(size), stream})
+  {
+  }
+
+  rmm_host_vector<uint8_t> data;
+};
+
+}  // namespace detail
+
+spill_manager::spill_manager(rmm::cuda_stream_view stream) : _stream{stream} {}
+
+std::size_t spill_manager::spill(std::size_t bytes)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::size_t freed = 0;
+  for (auto table : _tables) {
+    if (freed >= bytes) { break; }
+    // a table locked by another thread is being accessed and is not worth spilling
+    std::unique_lock<std::recursive_mutex> table_lock(table->_mutex, std::try_to_lock);
+    if (table_lock.owns_lock()) { freed += table->spill_unlocked(_stream); }
+  }
+  return freed;
+}
+
+bool spill_manager::on_allocation_failure(std::size_t bytes, void* manager)
+{
+  return static_cast<spill_manager*>(manager)->spill(bytes) > 0;
+}
+
+void spill_manager::add(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.push_back(table);
+}
+
+void spill_manager::remove(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.remove(table);
+}
+
+void spill_manager::touch(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = std::find(_tables.begin(), _tables.end(), table);
+  if (it != _tables.end()) { _tables.splice(_tables.end(), _tables, it); }
+}
+
+spillable_table::pinned_view::pinned_view(spillable_table* table, table_view view)
+  : _table{table}, _view{view}
+{
+}
+
+spillable_table::pinned_view::pinned_view(pinned_view&& other) noexcept
+  : _table{other._table}, _view{other._view}
+{
+  other._table = nullptr;
+}
+
+spillable_table::pinned_view::~pinned_view()
+{
+  if (_table != nullptr) { _table->unpin(); }
+}
+
+spillable_table::spillable_table(table_view const& input,
+                                 spill_manager* manager,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+  : spillable_table(cudf::detail::pack(input, stream, mr), manager)
+{
+}
+
+spillable_table::spillable_table(packed_columns&& packed, spill_manager* manager)
+  : _manager{manager},
+    _metadata{std::move(packed.metadata)},
+    _device_data{std::move(packed.gpu_data)},
+    _size_bytes{_device_data->size()}
+{
+  CUDF_EXPECTS(
+    _metadata->empty() ||
+      detail::get_packed_compression(_metadata->data()).compression == io::compression_type::NONE,
+    "Compressed packed columns must be decompressed before spilling",
+    std::invalid_argument);
+  if (_manager != nullptr) { _manager->add(this); }
+}
+
+spillable_table::~spillable_table()
+{
+  if (_manager != nullptr) { _manager->remove(this); }
+}
+
+bool spillable_table::is_spilled() const
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return _host_data != nullptr;
+}
+
+std::size_t spillable_table::size_bytes() const
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return _size_bytes;
+}
+
+std::size_t spillable_table::spill(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return spill_unlocked(stream);
+}
+
+spillable_table::pinned_view spillable_table::pin(rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  unspill_unlocked(stream, mr);
+  ++_pin_count;
+  if (_manager != nullptr) { _manager->touch(this); }
+
+  auto const view = _metadata->empty()
+                      ? table_view{}
+                      : cudf::unpack(_metadata->data(),
+                                     static_cast<uint8_t const*>(_device_data->data()));
+  return pinned_view{this, view};
+}
+
+packed_columns spillable_table::release(rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  CUDF_EXPECTS(_pin_count == 0, "A pinned table cannot be released");
+  unspill_unlocked(stream, mr);
+
+  auto result = packed_columns{std::move(_metadata), std::move(_device_data)};
+  _metadata    = std::make_unique<std::vector<uint8_t>>();
+  _device_data = std::make_unique<rmm::device_buffer>();
+  _size_bytes  = 0;
+  return result;
+}
+
+std::size_t spillable_table::spill_unlocked(rmm::cuda_stream_view stream)
+{
+  if (_pin_count > 0 || _host_data != nullptr || _size_bytes == 0) { return 0; }
+
+  // the whole table is transferred at once since its data is contiguous
+  auto host_data = std::make_unique<detail::spilled_data>(_size_bytes, stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    host_data->data.data(), _device_data->data(), _size_bytes, cudaMemcpyDefault, stream.value()));
+  stream.synchronize();
+
+  _device_data.reset();
+  _host_data = std::move(host_data);
+  return _size_bytes;
+}
+
+void spillable_table::unspill_unlocked(rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  if (_host_data == nullptr) { return; }
+
+  // while allocating, the table is still spilled so that a manager spilling tables after a
+  // failed allocation does not try to spill it again
+  auto device_data = std::make_unique<rmm::device_buffer>(_size_bytes, stream, mr);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    device_data->data(), _host_data->data.data(), _size_bytes, cudaMemcpyDefault, stream.value()));
+  // the host data is freed below
+  stream.synchronize();
+
+  _device_data = std::move(device_data);
+  _host_data.reset();
+}
+
+void spillable_table::unpin()
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  --_pin_count;
+}
+
+}  // namespace cudf
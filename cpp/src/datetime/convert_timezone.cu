@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/timezone.cuh>
+#include <cudf/detail/timezone.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/std/chrono>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the offset from UTC of the local time `local` in the timezone of `tz_table`
+ *
+ * The candidate offsets are those in effect a day before and a day after `local`, which differ
+ * only when a transition is near. A candidate is valid when it is the offset at the instant it
+ * maps `local` to. When both are valid the local time occurs twice and the larger offset gives
+ * the earlier instant; when neither is valid the local time was skipped and the offset before
+ * the transition is used.
+ */
+__device__ duration_s local_utc_offset(table_device_view const& tz_table, timestamp_s local)
+{
+  auto constexpr day  = cuda::std::chrono::duration_cast<duration_s>(duration_D{1});
+  auto const before   = get_ut_offset(tz_table, local - day);
+  auto const after    = get_ut_offset(tz_table, local + day);
+  auto const is_valid = [&](duration_s offset) {
+    return get_ut_offset(tz_table, local - offset) == offset;
+  };
+
+  auto const before_valid = is_valid(before);
+  auto const after_valid  = is_valid(after);
+  if (before_valid and after_valid) { return before > after ? before : after; }
+  return after_valid ? after : before;
+}
+
+/**
+ * @brief Converts a wall-clock time from the timezone of `from_table` to that of `to_table`
+ */
+template <typename Timestamp>
+struct convert_timezone_fn {
+  table_device_view from_table;
+  table_device_view to_table;
+
+  __device__ Timestamp operator()(Timestamp ts) const
+  {
+    auto const local = timestamp_s{cuda::std::chrono::floor<duration_s>(ts.time_since_epoch())};
+    auto const from_offset = local_utc_offset(from_table, local);
+    auto const to_offset   = get_ut_offset(to_table, local - from_offset);
+    auto const shift       = to_offset - from_offset;
+    return ts + cuda::std::chrono::duration_cast<typename Timestamp::duration>(shift);
+  }
+};
+
+struct dispatch_convert_timezone_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_timestamp<T>() and not std::is_same_v<T, timestamp_D>;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(is_supported<T>())>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     table_device_view const& from_table,
+                                     table_device_view const& to_table,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto result = make_timestamp_column(input.type(),
+                                        input.size(),
+                                        detail::copy_bitmask(input, stream, mr),
+                                        input.null_count(),
+                                        stream,
+                                        mr);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      input.begin<T>(),
+                      input.end<T>(),
+                      result->mutable_view().begin<T>(),
+                      convert_timezone_fn<T>{from_table, to_table});
+    return result;
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_supported<T>())>
+  std::unique_ptr<column> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Timezones can only be converted for timestamps of seconds or finer resolutions",
+              cudf::data_type_error);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(cudf::is_timestamp(timestamps.type()),
+               "Timezones can only be converted for timestamp columns",
+               cudf::data_type_error);
+
+  auto const from_table = get_timezone_transition_table(tzif_dir, from_timezone, stream);
+  auto const to_table   = get_timezone_transition_table(tzif_dir, to_timezone, stream);
+  auto const d_from     = table_device_view::create(from_table->view(), stream);
+  auto const d_to       = table_device_view::create(to_table->view(), stream);
+
+  return type_dispatcher(
+    timestamps.type(), dispatch_convert_timezone_fn{}, timestamps, *d_from, *d_to, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(timestamps, from_timezone, to_timezone, tzif_dir, stream, mr);
+}
+
+}  // namespace cudf
@@ -24,40 +24,35 @@
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/durations.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-  MILLISECOND,
-  MICROSECOND,
-  NANOSECOND
-};
-
 enum class rounding_function {
   CEIL,   ///< Rounds up to the next integer multiple of the provided frequency
   FLOOR,  ///< Rounds down to the next integer multiple of the provided frequency
@@ -247,6 +242,85 @@ struct is_leap_year_op {
   }
 };
 
+/**
+ * @brief Writes the requested components of each timestamp, decomposing it once
+ *
+ * The calendar date and the time of day of a timestamp are computed once and every requested
+ * component is read from them, instead of decomposing the timestamp again for each component.
+ */
+template <typename Timestamp>
+struct extract_components_fn {
+  Timestamp const* input;
+  datetime_component const* components;
+  int16_t* const* outputs;
+  size_type num_components;
+  bool has_date_components;  ///< whether the calendar date of the timestamps is needed
+
+  __device__ void operator()(size_type idx) const
+  {
+    using namespace cuda::std::chrono;
+
+    auto const ts               = input[idx];
+    auto const days_since_epoch = floor<days>(ts);
+    auto time_since_midnight    = ts - days_since_epoch;
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    auto const hrs       = duration_cast<hours>(time_since_midnight);
+    auto const mins      = duration_cast<minutes>(time_since_midnight - hrs);
+    auto const secs      = duration_cast<seconds>(time_since_midnight - hrs - mins);
+    auto const subsecs   = time_since_midnight - hrs - mins - secs;
+    auto const millisecs = duration_cast<milliseconds>(subsecs);
+    auto const microsecs = duration_cast<microseconds>(subsecs - millisecs);
+    auto const nanosecs  = duration_cast<nanoseconds>(subsecs - millisecs - microsecs);
+
+    auto const date = has_date_components ? year_month_day(days_since_epoch) : year_month_day{};
+
+    for (size_type i = 0; i < num_components; ++i) {
+      outputs[i][idx] = [&]() -> int16_t {
+        switch (components[i]) {
+          case datetime_component::YEAR: return static_cast<int>(date.year());
+          case datetime_component::MONTH: return static_cast<unsigned>(date.month());
+          case datetime_component::DAY: return static_cast<unsigned>(date.day());
+          case datetime_component::WEEKDAY:
+            return year_month_weekday(days_since_epoch).weekday().iso_encoding();
+          case datetime_component::HOUR: return hrs.count();
+          case datetime_component::MINUTE: return mins.count();
+          case datetime_component::SECOND: return secs.count();
+          case datetime_component::MILLISECOND: return millisecs.count();
+          case datetime_component::MICROSECOND: return microsecs.count();
+          case datetime_component::NANOSECOND: return nanosecs.count();
+          default: return 0;
+        }
+      }();
+    }
+  }
+};
+
+struct dispatch_extract_components {
+  template <typename Timestamp, CUDF_ENABLE_IF(cudf::is_timestamp<Timestamp>())>
+  void operator()(column_view const& input,
+                  device_span<datetime_component const> components,
+                  device_span<int16_t* const> outputs,
+                  bool has_date_components,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       extract_components_fn<Timestamp>{input.begin<Timestamp>(),
+                                                        components.data(),
+                                                        outputs.data(),
+                                                        static_cast<size_type>(outputs.size()),
+                                                        has_date_components});
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_timestamp<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+};
+
 // Specific function for applying ceil/floor/round date ops
 struct dispatch_round {
   template <typename Timestamp>
@@ -454,7 +528,7 @@ std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -463,7 +537,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -472,7 +546,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -481,7 +555,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -490,7 +564,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -499,7 +573,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -508,7 +582,7 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -517,7 +591,7 @@ std::unique_ptr<column> extract_millisecond_fraction(column_view const& column,
                                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MILLISECOND>,
+    detail::extract_component_operator<datetime_component::MILLISECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -526,7 +600,7 @@ std::unique_ptr<column> extract_microsecond_fraction(column_view const& column,
                                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MICROSECOND>,
+    detail::extract_component_operator<datetime_component::MICROSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -535,10 +609,53 @@ std::unique_ptr<column> extract_nanosecond_fraction(column_view const& column,
                                                     rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::NANOSECOND>,
+    detail::extract_component_operator<datetime_component::NANOSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  std::vector<int16_t*> outputs;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    output_columns.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                                     column.size(),
+                                                     cudf::detail::copy_bitmask(column, stream, mr),
+                                                     column.null_count(),
+                                                     stream,
+                                                     mr));
+    outputs.push_back(output_columns.back()->mutable_view().data<int16_t>());
+  }
+  if (components.empty() || column.is_empty()) {
+    return std::make_unique<table>(std::move(output_columns));
+  }
+
+  auto const has_date_components =
+    std::any_of(components.begin(), components.end(), [](auto component) {
+      return component == datetime_component::YEAR || component == datetime_component::MONTH ||
+             component == datetime_component::DAY;
+    });
+  auto const d_components = cudf::detail::make_device_uvector_async(
+    components, stream, rmm::mr::get_current_device_resource());
+  auto const d_outputs = cudf::detail::make_device_uvector_async(
+    outputs, stream, rmm::mr::get_current_device_resource());
+  type_dispatcher(column.type(),
+                  dispatch_extract_components{},
+                  column,
+                  d_components,
+                  d_outputs,
+                  has_date_components,
+                  stream);
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr)
@@ -669,6 +786,16 @@ std::unique_ptr<column> extract_nanosecond_fraction(column_view const& column,
   return detail::extract_nanosecond_fraction(column, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, stream, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::device_async_resource_ref mr)
 {
@@ -19,11 +19,17 @@
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 
+#include <rmm/cuda_device.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
 
 namespace cudf {
 
@@ -512,5 +518,53 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   return std::make_unique<cudf::table>(std::move(tz_table_columns));
 }
 
+namespace {
+
+/**
+ * @brief Device-resident transition tables keyed by device, TZif directory and timezone name
+ */
+struct transition_table_cache {
+  std::mutex mutex;
+  std::map<std::tuple<int, std::string, std::string>, std::shared_ptr<table const>> tables;
+};
+
+transition_table_cache& get_transition_table_cache()
+{
+  // Never destroyed, so that the cached device memory is not freed after the CUDA context is torn
+  // down at exit
+  static auto* cache = new transition_table_cache{};
+  return *cache;
+}
+
+}  // namespace
+
+std::shared_ptr<table const> get_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                           std::string_view timezone_name,
+                                                           rmm::cuda_stream_view stream)
+{
+  auto key = std::tuple{rmm::get_current_cuda_device().value(),
+                        std::string{tzif_dir.value_or(tzif_system_directory)},
+                        std::string{timezone_name}};
+
+  auto& cache = get_transition_table_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto const cached = cache.tables.find(key);
+  if (cached != cache.tables.end()) { return cached->second; }
+
+  // The new table is complete on return, so it may be used on any stream
+  std::shared_ptr<table const> tz_table = make_timezone_transition_table(
+    tzif_dir, timezone_name, stream, rmm::mr::get_current_device_resource());
+  cache.tables.emplace(std::move(key), tz_table);
+  return tz_table;
+}
+
 }  // namespace detail
+
+void clear_timezone_transition_table_cache()
+{
+  auto& cache = detail::get_transition_table_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.tables.clear();
+}
+
 }  // namespace cudf
@@ -20,13 +20,18 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <functional>
+#include <stdexcept>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -40,32 +45,46 @@ struct indices_handler_fn {
     return d_indices.is_null(idx) ? oob_index : d_iterator[idx];
   }
 };
-}  // namespace
 
 /**
- * @brief Decode a column from a dictionary.
+ * @brief Gather rows of `values` using the indices of `source`
+ *
+ * Null rows in `source` produce null output rows and any nulls in `values`
+ * are carried into the output.
  */
-std::unique_ptr<column> decode(dictionary_column_view const& source,
-                               rmm::cuda_stream_view stream,
-                               rmm::device_async_resource_ref mr)
+std::unique_ptr<column> gather_by_indices(column_view const& values,
+                                          dictionary_column_view const& source,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
 {
-  if (source.is_empty()) return make_empty_column(type_id::EMPTY);
-
   // annotated indices include the offset, size and bitmask from it's parent
   auto const indices       = source.get_indices_annotated();
   auto const d_indices     = column_device_view::create(indices, stream);
   auto const d_iterator    = cudf::detail::indexalator_factory::make_input_iterator(indices);
   auto const indices_begin = cudf::detail::make_counting_transform_iterator(
-    0, indices_handler_fn{d_iterator, *d_indices, source.keys().size()});
+    0, indices_handler_fn{d_iterator, *d_indices, values.size()});
 
-  auto table_column = cudf::detail::gather(table_view{{source.keys()}},
+  auto table_column = cudf::detail::gather(table_view{{values}},
                                            indices_begin,
                                            indices_begin + source.size(),
                                            cudf::out_of_bounds_policy::NULLIFY,
                                            stream,
                                            mr)
                         ->release();
-  auto output_column = std::unique_ptr<column>(std::move(table_column.front()));
+  return std::move(table_column.front());
+}
+}  // namespace
+
+/**
+ * @brief Decode a column from a dictionary.
+ */
+std::unique_ptr<column> decode(dictionary_column_view const& source,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  if (source.is_empty()) return make_empty_column(type_id::EMPTY);
+
+  auto output_column = gather_by_indices(source.keys(), source, stream, mr);
 
   // apply any nulls to the output column
   output_column->set_null_mask(cudf::detail::copy_bitmask(source.parent(), stream, mr),
@@ -74,6 +93,45 @@ std::unique_ptr<column> decode(dictionary_column_view const& source,
   return output_column;
 }
 
+/**
+ * @copydoc cudf::dictionary::transform_distinct
+ */
+std::unique_ptr<column> transform_distinct(
+  column_view const& input,
+  std::function<std::unique_ptr<column>(column_view const&)> const& op,
+  bool keep_encoded,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  // a dictionary input is already encoded
+  auto const is_dictionary = input.type().id() == type_id::DICTIONARY32;
+  if (input.is_empty()) { return is_dictionary ? make_empty_column(type_id::EMPTY) : op(input); }
+
+  auto const encoded =
+    is_dictionary
+      ? std::unique_ptr<column>{}
+      : encode(input, data_type{type_id::UINT32}, stream, rmm::mr::get_current_device_resource());
+  auto const source = dictionary_column_view(is_dictionary ? input : encoded->view());
+
+  // the operation only sees each distinct value once
+  auto keys_result = op(source.keys());
+  CUDF_EXPECTS(keys_result->size() == source.keys_size(),
+               "operation must return one row per key",
+               std::invalid_argument);
+
+  if (!keep_encoded) { return gather_by_indices(keys_result->view(), source, stream, mr); }
+
+  // the results may contain duplicates and nulls so they are encoded again and
+  // the source indices are mapped through the new indices
+  auto const temp_mr           = rmm::mr::get_current_device_resource();
+  auto const result_dictionary =
+    encode(keys_result->view(), data_type{type_id::UINT32}, stream, temp_mr);
+  auto const results = dictionary_column_view(result_dictionary->view());
+  auto indices       = gather_by_indices(results.get_indices_annotated(), source, stream, mr);
+  auto keys          = std::make_unique<column>(results.keys(), stream, mr);
+  return make_dictionary_column(std::move(keys), std::move(indices), stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> decode(dictionary_column_view const& source,
@@ -84,5 +142,16 @@ std::unique_ptr<column> decode(dictionary_column_view const& source,
   return detail::decode(source, stream, mr);
 }
 
+std::unique_ptr<column> transform_distinct(
+  column_view const& input,
+  std::function<std::unique_ptr<column>(column_view const&)> const& op,
+  bool keep_encoded,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform_distinct(input, op, keep_encoded, stream, mr);
+}
+
 }  // namespace dictionary
 }  // namespace cudf
@@ -37,6 +37,8 @@
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -96,6 +98,24 @@ struct count_checker {
   }
 };
 
+/**
+ * @brief Functor mapping each output row of `repeat` to the input row it repeats.
+ *
+ * The output rows of input row `i` end at `offsets[i]`, so the input row of an output row is
+ * found by a binary search over the offsets of the input rows instead of being read from a
+ * gather map holding one entry per output row.
+ */
+struct repeated_row_fn {
+  cudf::size_type const* offsets;  ///< inclusive scan of the counts
+  cudf::size_type num_rows;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    return static_cast<cudf::size_type>(thrust::distance(
+      offsets, thrust::upper_bound(thrust::seq, offsets, offsets + num_rows, idx)));
+  }
+};
+
 }  // namespace
 
 namespace cudf {
@@ -117,16 +137,17 @@ std::unique_ptr<table> repeat(table_view const& input_table,
     rmm::exec_policy(stream), count_iter, count_iter + count.size(), offsets.begin());
 
   size_type output_size{offsets.back_element(stream)};
-  rmm::device_uvector<size_type> indices(output_size, stream);
-  thrust::upper_bound(rmm::exec_policy(stream),
-                      offsets.begin(),
-                      offsets.end(),
-                      thrust::make_counting_iterator(0),
-                      thrust::make_counting_iterator(output_size),
-                      indices.begin());
-
-  return gather(
-    input_table, indices.begin(), indices.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+  // The gather map is computed as the columns are gathered rather than materialized, so large
+  // counts only cost the output columns themselves.
+  auto const map_begin = cudf::detail::make_counting_transform_iterator(
+    0, repeated_row_fn{offsets.data(), input_table.num_rows()});
+
+  return gather(input_table,
+                map_begin,
+                map_begin + output_size,
+                out_of_bounds_policy::DONT_CHECK,
+                stream,
+                mr);
 }
 
 std::unique_ptr<table> repeat(table_view const& input_table,
@@ -20,6 +20,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
@@ -39,11 +40,17 @@
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -73,14 +80,126 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // always use sort groupby from now on. Because once keys are sorted,
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
-  // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
-  if (_keys_are_sorted == sorted::NO and not _helper and
-      detail::hash::can_use_hash_groupby(requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
-  } else {
-    return sort_aggregate(requests, stream, mr);
+  // Only use hash groupby if the keys aren't sorted. The aggregations that
+  // cannot be satisfied with a hash implementation are done by sort groupby.
+  if (_keys_are_sorted == sorted::NO and not _helper) {
+    // Keys clustered into runs of equal keys are aggregated run by run
+    if (detail::run_length::can_use_run_length_groupby(_keys, requests) and
+        detail::run_length::is_clustered(_keys, stream)) {
+      return detail::run_length::groupby(_keys, requests, _include_null_keys, stream, mr);
+    }
+    if (detail::hash::can_use_hash_groupby(requests)) {
+      return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+    }
+    auto const any_hash_aggregation =
+      std::any_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
+        return std::any_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+          return detail::hash::can_use_hash_groupby(r.values, *a);
+        });
+      });
+    if (any_hash_aggregation) { return split_aggregate(requests, stream, mr); }
+  }
+  return sort_aggregate(requests, stream, mr);
+}
+
+namespace {
+
+/**
+ * @brief Returns the hash group of each sort group of the keys
+ *
+ * @param sort_order The sorted order of the rows of the grouped keys
+ * @param labels The sort group of each sorted row
+ * @param key_indices The index of a row of the keys in each hash group
+ * @param num_rows The number of rows of the keys
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+rmm::device_uvector<size_type> sort_groups_to_hash_groups(column_view const& sort_order,
+                                                          device_span<size_type const> labels,
+                                                          device_span<size_type const> key_indices,
+                                                          size_type num_rows,
+                                                          rmm::cuda_stream_view stream)
+{
+  auto const num_groups = static_cast<size_type>(key_indices.size());
+
+  // The hash group of the rows of `key_indices`
+  rmm::device_uvector<size_type> hash_groups(num_rows, stream);
+  thrust::fill(rmm::exec_policy(stream),
+               hash_groups.begin(),
+               hash_groups.end(),
+               cudf::detail::CUDF_SIZE_TYPE_SENTINEL);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_groups),
+                  key_indices.begin(),
+                  hash_groups.begin());
+
+  rmm::device_uvector<size_type> sort_to_hash(num_groups, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     sort_order.size(),
+                     [sort_order   = sort_order.begin<size_type>(),
+                      labels       = labels.data(),
+                      hash_groups  = hash_groups.data(),
+                      sort_to_hash = sort_to_hash.data()] __device__(size_type i) {
+                       auto const hash_group = hash_groups[sort_order[i]];
+                       if (hash_group >= 0) { sort_to_hash[labels[i]] = hash_group; }
+                     });
+  return sort_to_hash;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::split_aggregate(
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  // Split the aggregations of each request into a hash request and a sort request of its values
+  std::vector<aggregation_request> hash_requests(requests.size());
+  std::vector<aggregation_request> sort_requests(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    hash_requests[i].values = requests[i].values;
+    sort_requests[i].values = requests[i].values;
+    for (auto const& agg : requests[i].aggregations) {
+      auto& split_request = detail::hash::can_use_hash_groupby(requests[i].values, *agg)
+                              ? hash_requests[i]
+                              : sort_requests[i];
+      split_request.aggregations.emplace_back(
+        dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+    }
+  }
+
+  auto const temp_mr               = rmm::mr::get_current_device_resource();
+  auto [key_indices, hash_results] = detail::hash::groupby_key_indices(
+    _keys, hash_requests, _include_null_keys, stream, temp_mr);
+  auto [unique_keys, sort_results] = sort_aggregate(sort_requests, stream, mr);
+
+  auto const sort_to_hash = sort_groups_to_hash_groups(helper().key_sort_order(stream),
+                                                       helper().group_labels(stream),
+                                                       key_indices,
+                                                       _keys.num_rows(),
+                                                       stream);
+
+  // Reorder the hash results to the sort groups and merge the results in the requested order
+  std::vector<aggregation_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    auto hash_result = hash_results[i].results.begin();
+    auto sort_result = sort_results[i].results.begin();
+    for (auto const& agg : requests[i].aggregations) {
+      if (detail::hash::can_use_hash_groupby(requests[i].values, *agg)) {
+        auto gathered = cudf::detail::gather(table_view{{(*hash_result++)->view()}},
+                                             device_span<size_type const>{sort_to_hash},
+                                             out_of_bounds_policy::DONT_CHECK,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             mr);
+        results[i].results.push_back(std::move(gathered->release()[0]));
+      } else {
+        results[i].results.push_back(std::move(*sort_result++));
+      }
+    }
   }
+  return std::pair(std::move(unique_keys), std::move(results));
 }
 
 // Destructor
@@ -122,6 +241,11 @@ struct empty_column_constructor {
     }
     if constexpr (k == aggregation::Kind::MERGE_HISTOGRAM) { return empty_like(values); }
 
+    if constexpr (k == aggregation::Kind::HLLPP || k == aggregation::Kind::MERGE_HLLPP) {
+      return make_lists_column(
+        0, make_empty_column(type_to_id<size_type>()), make_empty_column(type_id::INT8), 0, {});
+    }
+
     if constexpr (k == aggregation::Kind::RANK) {
       auto const& rank_agg = dynamic_cast<cudf::detail::rank_aggregation const&>(agg);
       if (rank_agg._method == cudf::rank_method::AVERAGE or
@@ -16,7 +16,9 @@
 
 #include "groupby/common/utils.hpp"
 #include "groupby/hash/groupby_kernels.cuh"
+#include "groupby/hash/shared_memory_kernels.cuh"
 #include "hash/concurrent_unordered_map.cuh"
+#include "stream_compaction/stream_compaction_common.cuh"
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -29,12 +31,17 @@
 #include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
@@ -42,15 +49,33 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.cuh>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuco/static_set.cuh>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
-
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 
@@ -67,11 +92,20 @@ using probing_scheme_type = cuco::linear_probing<
   cudf::experimental::row::hash::device_row_hasher<cudf::hashing::detail::default_hash,
                                                    cudf::nullate::DYNAMIC>>;
 
+/// Maximum range of integer keys aggregated into the results of their dense groups
+constexpr size_type dense_key_max_range = 1 << 16;
+/// Minimum number of rows of the keys whose number of groups is estimated to size the hash set
+constexpr size_type estimated_groups_min_rows = 1 << 20;
+/// Precision of the HyperLogLog sketch of the number of groups of the keys
+constexpr int32_t estimated_groups_precision = 12;
+/// Minimum number of groups of a hash set sized for the estimated number of groups
+constexpr size_type estimated_groups_min_size = 1024;
+
 /**
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 15> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -81,12 +115,37 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::ARGMAX,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
+                                                              aggregation::M2,
                                                               aggregation::STD,
-                                                              aggregation::VARIANCE};
+                                                              aggregation::VARIANCE,
+                                                              aggregation::NUNIQUE,
+                                                              aggregation::COLLECT_SET};
 
-// Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
+/**
+ * @brief List of hash-based aggregation operations that are computed from the distinct values of
+ * each group rather than by atomic updates of the results.
+ */
+constexpr std::array<aggregation::Kind, 2> hash_set_aggregations{aggregation::NUNIQUE,
+                                                                 aggregation::COLLECT_SET};
+
+/**
+ * @brief List of hash-based aggregation operations whose results are those of their single pass
+ * aggregation, and so computed directly into the results of dense groups of the keys.
+ */
+constexpr std::array<aggregation::Kind, 9> dense_key_aggregations{aggregation::SUM,
+                                                                  aggregation::PRODUCT,
+                                                                  aggregation::MIN,
+                                                                  aggregation::MAX,
+                                                                  aggregation::COUNT_VALID,
+                                                                  aggregation::COUNT_ALL,
+                                                                  aggregation::ARGMIN,
+                                                                  aggregation::ARGMAX,
+                                                                  aggregation::SUM_OF_SQUARES};
+
+// Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL,
 // Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
-// ARGMAX, ARGMIN
+// M2(SUM, COUNT_VALID), ARGMAX, ARGMIN
+// Distinct values of each group: NUNIQUE, COLLECT_SET
 
 // TODO replace with std::find in C++20 onwards.
 template <class T, size_t N>
@@ -147,6 +206,30 @@ class groupby_simple_aggregations_collector final
     return aggs;
   }
 
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::m2_aggregation const&) override
+  {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(make_sum_aggregation());
+    // COUNT_VALID
+    aggs.push_back(make_count_aggregation());
+
+    return aggs;
+  }
+
+  // NUNIQUE and COLLECT_SET are computed from the distinct values of each group
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::nunique_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::collect_set_aggregation const&) override
+  {
+    return {};
+  }
+
   std::vector<std::unique_ptr<aggregation>> visit(data_type,
                                                   cudf::detail::var_aggregation const&) override
   {
@@ -181,6 +264,101 @@ class groupby_simple_aggregations_collector final
   }
 };
 
+/**
+ * @brief Finds the rows of the distinct values of each group of `values`
+ *
+ * @param values The aggregated values
+ * @param gather_map The sparse row of each output group
+ * @param set The hash set of the rows of each group
+ * @param row_bitmask The rows of the keys that are not skipped, or nullptr if none are skipped
+ * @param null_handling Whether null values are excluded
+ * @param nulls_equal Whether null values are equal to each other
+ * @param nans_equal Whether NaN values are equal to each other
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The output group of each distinct value in ascending order, and the rows of the values
+ */
+template <typename SetType>
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> find_distinct_group_rows(
+  column_view const& values,
+  device_span<size_type const> gather_map,
+  SetType set,
+  bitmask_type const* row_bitmask,
+  null_policy null_handling,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = values.size();
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+
+  // The output group of the sparse row of each group
+  rmm::device_uvector<size_type> output_groups(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(static_cast<size_type>(gather_map.size())),
+                  gather_map.begin(),
+                  output_groups.begin());
+
+  // The output group of each row, or a negative value for the rows of skipped keys
+  rmm::device_uvector<size_type> row_groups(num_rows, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_rows),
+    row_groups.begin(),
+    [set, row_bitmask, output_groups = output_groups.data()] __device__(size_type row) {
+      if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row)) {
+        return cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+      }
+      return output_groups[*set.find(row)];
+    });
+
+  auto const groups_view = column_view{device_span<size_type const>{row_groups}};
+  auto rows              = cudf::detail::distinct_indices(table_view{{groups_view, values}},
+                                             duplicate_keep_option::KEEP_ANY,
+                                             nulls_equal,
+                                             nans_equal,
+                                             stream,
+                                             temp_mr);
+
+  auto const skip_nulls = null_handling == null_policy::EXCLUDE and values.has_nulls();
+  auto const d_values   = column_device_view::create(values, stream);
+  auto const rows_end   = thrust::remove_if(
+    rmm::exec_policy(stream),
+    rows.begin(),
+    rows.end(),
+    [row_groups = row_groups.data(), d_values = *d_values, skip_nulls] __device__(size_type row) {
+      return row_groups[row] < 0 or (skip_nulls and d_values.is_null(row));
+    });
+  rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+
+  rmm::device_uvector<size_type> groups(rows.size(), stream);
+  thrust::gather(
+    rmm::exec_policy(stream), rows.begin(), rows.end(), row_groups.begin(), groups.begin());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream), groups.begin(), groups.end(), rows.begin());
+  return {std::move(groups), std::move(rows)};
+}
+
+/**
+ * @brief Returns the offsets of the output groups in the ascending `groups` of distinct values
+ */
+std::unique_ptr<column> make_group_offsets(device_span<size_type const> groups,
+                                           size_type num_groups,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      groups.begin(),
+                      groups.end(),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_groups + 1),
+                      offsets->mutable_view().begin<size_type>());
+  return offsets;
+}
+
 template <typename SetType>
 class hash_compound_agg_finalizer final : public cudf::detail::aggregation_finalizer {
   column_view col;
@@ -337,6 +515,95 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     dense_results->add_result(col, agg, to_dense_agg_result(agg));
   }
 
+  void visit(cudf::detail::m2_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto sum_agg   = make_sum_aggregation();
+    auto count_agg = make_count_aggregation();
+    this->visit(*sum_agg);
+    this->visit(*count_agg);
+    column_view sum_result   = sparse_results->get_result(col, *sum_agg);
+    column_view count_result = sparse_results->get_result(col, *count_agg);
+
+    auto values_view = column_device_view::create(col, stream);
+    auto sum_view    = column_device_view::create(sum_result, stream);
+    auto count_view  = column_device_view::create(count_result, stream);
+
+    auto m2_result = make_fixed_width_column(
+      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+    auto m2_result_view = mutable_column_device_view::create(m2_result->mutable_view(), stream);
+    mutable_table_view m2_table_view{{m2_result->mutable_view()}};
+    cudf::detail::initialize_with_identity(m2_table_view, {agg.kind}, stream);
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      col.size(),
+      ::cudf::detail::m2_hash_functor{
+        set, row_bitmask, *m2_result_view, *values_view, *sum_view, *count_view});
+    sparse_results->add_result(col, agg, std::move(m2_result));
+    dense_results->add_result(col, agg, to_dense_agg_result(agg));
+  }
+
+  void visit(cudf::detail::nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto const num_groups     = static_cast<size_type>(gather_map.size());
+    auto const [groups, rows] = find_distinct_group_rows(col,
+                                                         gather_map,
+                                                         set,
+                                                         row_bitmask,
+                                                         agg._null_handling,
+                                                         null_equality::EQUAL,
+                                                         nan_equality::ALL_EQUAL,
+                                                         stream);
+    auto const offsets =
+      make_group_offsets(groups, num_groups, stream, rmm::mr::get_current_device_resource());
+
+    auto result = make_numeric_column(cudf::detail::target_type(result_type, agg.kind),
+                                      num_groups,
+                                      mask_state::UNALLOCATED,
+                                      stream,
+                                      mr);
+    auto const offsets_begin = offsets->view().begin<size_type>();
+    thrust::transform(rmm::exec_policy(stream),
+                      offsets_begin + 1,
+                      offsets_begin + num_groups + 1,
+                      offsets_begin,
+                      result->mutable_view().begin<size_type>(),
+                      thrust::minus<size_type>{});
+    dense_results->add_result(col, agg, std::move(result));
+  }
+
+  void visit(cudf::detail::collect_set_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto const num_groups     = static_cast<size_type>(gather_map.size());
+    auto const [groups, rows] = find_distinct_group_rows(col,
+                                                         gather_map,
+                                                         set,
+                                                         row_bitmask,
+                                                         agg._null_handling,
+                                                         agg._nulls_equal,
+                                                         agg._nans_equal,
+                                                         stream);
+    auto offsets = make_group_offsets(groups, num_groups, stream, mr);
+    auto child   = cudf::detail::gather(table_view{{col}},
+                                      device_span<size_type const>{rows},
+                                      out_of_bounds_policy::DONT_CHECK,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                      stream,
+                                      mr);
+    dense_results->add_result(
+      col,
+      agg,
+      make_lists_column(
+        num_groups, std::move(offsets), std::move(child->release()[0]), 0, {}, stream, mr));
+  }
+
   void visit(cudf::detail::std_aggregation const& agg) override
   {
     if (dense_results->has_result(col, agg)) return;
@@ -421,10 +688,11 @@ void sparse_to_dense_results(table_view const& keys,
   }
 }
 
-// make table that will hold sparse results
+// make table that will hold sparse results, with `num_rows` rows or as many rows as the values
 auto create_sparse_results_table(table_view const& flattened_values,
                                  std::vector<aggregation::Kind> aggs,
-                                 rmm::cuda_stream_view stream)
+                                 rmm::cuda_stream_view stream,
+                                 std::optional<size_type> num_rows = std::nullopt)
 {
   // TODO single allocation - room for performance improvement
   std::vector<std::unique_ptr<column>> sparse_columns;
@@ -433,7 +701,7 @@ auto create_sparse_results_table(table_view const& flattened_values,
     flattened_values.end(),
     aggs.begin(),
     std::back_inserter(sparse_columns),
-    [stream](auto const& col, auto const& agg) {
+    [stream, num_rows](auto const& col, auto const& agg) {
       bool nullable =
         (agg == aggregation::COUNT_VALID or agg == aggregation::COUNT_ALL)
           ? false
@@ -445,7 +713,7 @@ auto create_sparse_results_table(table_view const& flattened_values,
                         : col.type();
 
       return make_fixed_width_column(
-        cudf::detail::target_type(col_type, agg), col.size(), mask_flag, stream);
+        cudf::detail::target_type(col_type, agg), num_rows.value_or(col.size()), mask_flag, stream);
     });
 
   table sparse_table(std::move(sparse_columns));
@@ -520,6 +788,354 @@ rmm::device_uvector<size_type> extract_populated_keys(SetType const& key_set,
   return populated_keys;
 }
 
+/**
+ * @brief Estimates whether the keys have few enough groups to be aggregated in shared memory from
+ * the distinct hashes of a strided sample of the rows
+ */
+template <typename Hasher>
+bool has_few_groups(size_type num_keys, Hasher const& d_row_hash, rmm::cuda_stream_view stream)
+{
+  auto const sample_size = std::min(num_keys, shared_memory_sample_size);
+  if (sample_size == 0) { return false; }
+  auto const stride = num_keys / sample_size;
+
+  rmm::device_uvector<hash_value_type> hashes(sample_size, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(sample_size),
+                    hashes.begin(),
+                    [d_row_hash, stride] __device__(size_type i) {
+                      return d_row_hash(i * stride);
+                    });
+  thrust::sort(rmm::exec_policy(stream), hashes.begin(), hashes.end());
+  auto const num_distinct = thrust::distance(
+    hashes.begin(), thrust::unique(rmm::exec_policy(stream), hashes.begin(), hashes.end()));
+  return num_distinct <= shared_memory_max_groups / 2;
+}
+
+/**
+ * @brief Computes all aggregations from `requests` that require a single pass over the data in
+ * shared memory, if the keys have few groups, and stores the results in `sparse_results`
+ *
+ * The rows of the groups are first found in the hash set, which is then left populated with the
+ * keys as by `compute_single_pass_aggs`. The rows of each group are aggregated in the shared memory
+ * of each thread block, so that a single element of the sparse results of each group is updated
+ * by each block rather than by each row.
+ *
+ * @return Whether the aggregations were computed, otherwise they must be computed by
+ * `compute_single_pass_aggs`
+ */
+template <typename SetType, typename Hasher>
+bool compute_shared_memory_aggs(table_view const& keys,
+                                host_span<aggregation_request const> requests,
+                                cudf::detail::result_cache* sparse_results,
+                                SetType const& set,
+                                Hasher const& d_row_hash,
+                                bool keys_have_nulls,
+                                null_policy include_null_keys,
+                                rmm::cuda_stream_view stream)
+{
+  auto const num_keys                            = keys.num_rows();
+  auto const [flattened_values, agg_kinds, aggs] = flatten_single_pass_aggs(requests);
+
+  auto const is_supported = std::all_of(
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(flattened_values.num_columns()),
+    [&values = flattened_values, &kinds = agg_kinds](auto i) {
+      auto const type = values.column(i).type();
+      return not cudf::is_dictionary(type) and
+             cudf::detail::dispatch_type_and_aggregation(
+               type, kinds[i], is_shared_memory_aggregation_fn{});
+    });
+  if (not is_supported or not has_few_groups(num_keys, d_row_hash, stream)) { return false; }
+
+  auto const skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+  auto const row_bitmask =
+    skip_key_rows_with_nulls
+      ? cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first
+      : rmm::device_buffer{};
+
+  rmm::device_uvector<size_type> group_ids(num_keys, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_keys),
+                    group_ids.begin(),
+                    find_group_row_fn{set.ref(cuco::insert_and_find),
+                                      static_cast<bitmask_type const*>(row_bitmask.data()),
+                                      skip_key_rows_with_nulls});
+  auto const group_rows = extract_populated_keys(set, num_keys, stream);
+  auto const num_groups = static_cast<size_type>(group_rows.size());
+  // The sample missed too many groups: the keys are in the set, so the global path finds them
+  if (num_groups > shared_memory_max_groups) { return false; }
+
+  // Replace the sparse row of the group of each row by the dense index of the group
+  rmm::device_uvector<size_type> dense_groups(num_keys, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_groups),
+                  group_rows.begin(),
+                  dense_groups.begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    group_ids.begin(),
+                    group_ids.end(),
+                    group_ids.begin(),
+                    [dense_groups = dense_groups.data()] __device__(size_type row) {
+                      return row < 0 ? row : dense_groups[row];
+                    });
+
+  table sparse_table = create_sparse_results_table(flattened_values, agg_kinds, stream);
+  for (size_type i = 0; i < flattened_values.num_columns(); ++i) {
+    auto const d_source = column_device_view::create(flattened_values.column(i), stream);
+    auto d_target = mutable_column_device_view::create(sparse_table.get_column(i), stream);
+    cudf::detail::dispatch_type_and_aggregation(flattened_values.column(i).type(),
+                                                agg_kinds[i],
+                                                shared_memory_aggregate_fn{},
+                                                *d_source,
+                                                group_ids.data(),
+                                                num_groups,
+                                                group_rows.data(),
+                                                *d_target,
+                                                stream);
+  }
+
+  // Add results back to sparse_results cache
+  auto sparse_result_cols = sparse_table.release();
+  for (size_t i = 0; i < aggs.size(); i++) {
+    sparse_results->add_result(
+      flattened_values.column(i), *aggs[i], std::move(sparse_result_cols[i]));
+  }
+  return true;
+}
+
+/**
+ * @brief Indicates if all the aggregations of `requests` are single pass aggregations computed
+ * directly into the dense results of the groups of the keys
+ */
+bool are_dense_key_aggregations(host_span<aggregation_request const> requests)
+{
+  return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
+    return cudf::is_fixed_width(r.values.type()) and
+           std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+             return array_contains(dense_key_aggregations, a->kind) and
+                    can_use_hash_groupby(r.values, *a);
+           });
+  });
+}
+
+/**
+ * @brief Finds the dense group of each row of integer keys of a small range, the difference of
+ * its key and the minimum key
+ *
+ * @return The number of keys of the range, or nullopt if the range is too large
+ */
+struct find_integer_key_groups_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_integral_not_bool<T>())>
+  std::optional<size_type> operator()(column_view const& keys,
+                                      bool skip_null_keys,
+                                      size_type* group_ids,
+                                      rmm::cuda_stream_view stream) const
+  {
+    auto const [min, max] = cudf::minmax(keys, stream, rmm::mr::get_current_device_resource());
+    if (not min->is_valid(stream)) { return std::nullopt; }
+    auto const min_key = static_cast<numeric_scalar<T> const*>(min.get())->value(stream);
+    auto const max_key = static_cast<numeric_scalar<T> const*>(max.get())->value(stream);
+    // The difference of the keys modulo 2^64 is their difference, which may overflow `T`
+    auto const range = static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key);
+    if (range >= static_cast<uint64_t>(std::min(dense_key_max_range, keys.size()))) {
+      return std::nullopt;
+    }
+
+    auto const num_keys = static_cast<size_type>(range) + 1;
+    auto const d_keys   = column_device_view::create(keys, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(keys.size()),
+                      group_ids,
+                      integer_key_group_fn<T>{*d_keys, min_key, num_keys, skip_null_keys});
+    return num_keys;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_integral_not_bool<T>(), std::optional<size_type>> operator()(
+    Args&&...) const
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Computes groupby of a single key column whose keys map to dense groups without a hash
+ * table, if the keys are a dictionary or integers of a small range
+ *
+ * The dense group of a row is the index of its key in the dictionary or the difference of its key
+ * and the minimum key, and the null keys are the group after the keys. The rows are aggregated
+ * directly into the results of their groups, in shared memory if the groups are few, which are
+ * then compacted to the groups of at least one row into `cache`.
+ *
+ * @return The index vector, i.e. the index of the first row of `keys` in each group, or nullopt
+ * if the keys do not map to dense groups
+ */
+std::optional<rmm::device_uvector<size_type>> dense_key_groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  cudf::detail::result_cache* cache,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  if (keys.num_columns() != 1 or not are_dense_key_aggregations(requests)) { return std::nullopt; }
+  auto const key_column     = keys.column(0);
+  auto const num_rows       = keys.num_rows();
+  auto const skip_null_keys = include_null_keys == null_policy::EXCLUDE;
+
+  rmm::device_uvector<size_type> group_ids(num_rows, stream);
+  auto const num_keys = [&]() -> std::optional<size_type> {
+    if (not cudf::is_dictionary(key_column.type())) {
+      return cudf::type_dispatcher(key_column.type(),
+                                   find_integer_key_groups_fn{},
+                                   key_column,
+                                   skip_null_keys,
+                                   group_ids.data(),
+                                   stream);
+    }
+    // The dense results of a small slice of a large dictionary are mostly empty
+    auto const num_dictionary_keys = cudf::dictionary_column_view(key_column).keys_size();
+    if (num_dictionary_keys > num_rows) { return std::nullopt; }
+    auto const d_keys = column_device_view::create(key_column, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_rows),
+                      group_ids.begin(),
+                      dictionary_key_group_fn{*d_keys, num_dictionary_keys, skip_null_keys});
+    return num_dictionary_keys;
+  }();
+  if (not num_keys.has_value()) { return std::nullopt; }
+  auto const num_groups = *num_keys + 1;
+
+  auto constexpr no_row = std::numeric_limits<size_type>::max();
+  rmm::device_uvector<size_type> group_rows(num_groups, stream);
+  thrust::fill(rmm::exec_policy(stream), group_rows.begin(), group_rows.end(), no_row);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     find_first_group_row_fn{group_ids.data(), group_rows.data()});
+
+  auto const [flattened_values, agg_kinds, aggs] = flatten_single_pass_aggs(requests);
+  table dense_table = create_sparse_results_table(flattened_values, agg_kinds, stream, num_groups);
+
+  auto const is_shared_memory_aggregation = [&](size_type i) {
+    auto const type = flattened_values.column(i).type();
+    return cudf::detail::dispatch_type_and_aggregation(
+      type, agg_kinds[i], is_shared_memory_aggregation_fn{});
+  };
+  if (num_groups <= shared_memory_max_groups and
+      std::all_of(thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(flattened_values.num_columns()),
+                  is_shared_memory_aggregation)) {
+    // The rows of the results are the dense groups
+    rmm::device_uvector<size_type> dense_rows(num_groups, stream);
+    thrust::sequence(rmm::exec_policy(stream), dense_rows.begin(), dense_rows.end());
+    for (size_type i = 0; i < flattened_values.num_columns(); ++i) {
+      auto const d_source = column_device_view::create(flattened_values.column(i), stream);
+      auto d_target = mutable_column_device_view::create(dense_table.get_column(i), stream);
+      cudf::detail::dispatch_type_and_aggregation(flattened_values.column(i).type(),
+                                                  agg_kinds[i],
+                                                  shared_memory_aggregate_fn{},
+                                                  *d_source,
+                                                  group_ids.data(),
+                                                  num_groups,
+                                                  dense_rows.data(),
+                                                  *d_target,
+                                                  stream);
+    }
+  } else {
+    auto d_dense_table  = mutable_table_device_view::create(dense_table, stream);
+    auto const d_values = table_device_view::create(flattened_values, stream);
+    auto const d_aggs   = cudf::detail::make_device_uvector_async(
+      agg_kinds, stream, rmm::mr::get_current_device_resource());
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      num_rows,
+      compute_dense_aggs_fn{group_ids.data(), *d_values, *d_dense_table, d_aggs.data()});
+  }
+
+  // The groups of at least one row
+  rmm::device_uvector<size_type> groups(num_groups, stream);
+  auto const groups_end = thrust::copy_if(rmm::exec_policy(stream),
+                                          thrust::make_counting_iterator(0),
+                                          thrust::make_counting_iterator(num_groups),
+                                          groups.begin(),
+                                          [group_rows = group_rows.data()] __device__(size_type g) {
+                                            return group_rows[g] != no_row;
+                                          });
+  groups.resize(thrust::distance(groups.begin(), groups_end), stream);
+
+  rmm::device_uvector<size_type> key_indices(groups.size(), stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 groups.begin(),
+                 groups.end(),
+                 group_rows.begin(),
+                 key_indices.begin());
+
+  auto dense_columns = dense_table.release();
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    auto result = cudf::detail::gather(table_view{{dense_columns[i]->view()}},
+                                       device_span<size_type const>{groups},
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
+    cache->add_result(flattened_values.column(i), *aggs[i], std::move(result->release().front()));
+  }
+  return key_indices;
+}
+
+/**
+ * @brief Returns the number of groups the hash set of the groups of `keys` is sized for
+ *
+ * The groups of large keys are estimated by a HyperLogLog sketch, with a margin of twice the
+ * estimate, far above the error of the sketch, so that the set of few groups fits in the caches
+ * rather than having the capacity of all the rows.
+ */
+size_type hash_set_size(table_view const& keys,
+                        null_policy include_null_keys,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_keys = keys.num_rows();
+  if (num_keys < estimated_groups_min_rows) { return num_keys; }
+  auto const estimate = cudf::detail::approx_distinct_count(
+    keys, estimated_groups_precision, include_null_keys, stream);
+  return static_cast<size_type>(
+    std::min<int64_t>(num_keys, 2 * static_cast<int64_t>(estimate) + estimated_groups_min_size));
+}
+
+/**
+ * @brief Inserts the rows of `keys` into `set`, skipping the rows with null keys if they are
+ * excluded, and returns the number of groups of the keys
+ */
+template <typename SetType>
+size_type insert_keys(SetType& set,
+                      table_view const& keys,
+                      bool keys_have_nulls,
+                      null_policy include_null_keys,
+                      rmm::cuda_stream_view stream)
+{
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+  if (keys_have_nulls and include_null_keys == null_policy::EXCLUDE) {
+    auto const row_bitmask =
+      cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
+    return set.insert_if(rows,
+                         rows + keys.num_rows(),
+                         rows,
+                         cudf::detail::row_validity{
+                           static_cast<bitmask_type const*>(row_bitmask.data())},
+                         stream.value());
+  }
+  return set.insert(rows, rows + keys.num_rows(), stream.value());
+}
+
 /**
  * @brief Computes groupby using hash table.
  *
@@ -545,20 +1161,37 @@ rmm::device_uvector<size_type> extract_populated_keys(SetType const& key_set,
  * requested in `requests`, we gather sparse results into a column of dense
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
+ *
+ * @return The index vector, i.e. the index of a row of `keys` in each group
  */
-std::unique_ptr<table> groupby(table_view const& keys,
-                               host_span<aggregation_request const> requests,
-                               cudf::detail::result_cache* cache,
-                               bool const keys_have_nulls,
-                               null_policy const include_null_keys,
-                               rmm::cuda_stream_view stream,
-                               rmm::device_async_resource_ref mr)
+rmm::device_uvector<size_type> groupby(table_view const& keys,
+                                       host_span<aggregation_request const> requests,
+                                       cudf::detail::result_cache* cache,
+                                       bool const keys_have_nulls,
+                                       null_policy const include_null_keys,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
 {
+  if (auto key_indices =
+        dense_key_groupby(keys, requests, cache, include_null_keys, stream, mr)) {
+    return std::move(*key_indices);
+  }
+
   auto const num_keys            = keys.num_rows();
   auto const null_keys_are_equal = null_equality::EQUAL;
   auto const has_null            = nullate::DYNAMIC{cudf::has_nested_nulls(keys)};
 
-  auto preprocessed_keys = cudf::experimental::row::hash::preprocessed_table::create(keys, stream);
+  // Struct keys are hashed and compared as their validity and children, one column after the
+  // other, instead of walking down the levels of the structs for every key
+  auto const flattened_keys = cudf::structs::detail::flatten_nested_columns(
+    keys,
+    {},
+    {},
+    cudf::structs::detail::column_nullability::MATCH_INCOMING,
+    stream,
+    rmm::mr::get_current_device_resource());
+  auto preprocessed_keys = cudf::experimental::row::hash::preprocessed_table::create(
+    flattened_keys->flattened_columns(), stream);
   auto const comparator  = cudf::experimental::row::equality::self_comparator{preprocessed_keys};
   auto const row_hash    = cudf::experimental::row::hash::row_hasher{std::move(preprocessed_keys)};
   auto const d_row_hash  = row_hash.device_hasher(has_null);
@@ -568,47 +1201,67 @@ std::unique_ptr<table> groupby(table_view const& keys,
   cudf::detail::result_cache sparse_results(requests.size());
 
   auto const comparator_helper = [&](auto const d_key_equal) {
-    auto const set = cuco::static_set{num_keys,
-                                      0.5,  // desired load factor
-                                      cuco::empty_key{cudf::detail::CUDF_SIZE_TYPE_SENTINEL},
-                                      d_key_equal,
-                                      probing_scheme_type{d_row_hash},
-                                      cuco::thread_scope_device,
-                                      cuco::storage<1>{},
-                                      cudf::detail::cuco_allocator{stream},
-                                      stream.value()};
-
-    // Compute all single pass aggs first
-    compute_single_pass_aggs(keys,
-                             requests,
-                             &sparse_results,
-                             set.ref(cuco::insert_and_find),
-                             keys_have_nulls,
-                             include_null_keys,
-                             stream);
-
-    // Extract the populated indices from the hash set and create a gather map.
-    // Gathering using this map from sparse results will give dense results.
-    auto gather_map = extract_populated_keys(set, keys.num_rows(), stream);
-
-    // Compact all results from sparse_results and insert into cache
-    sparse_to_dense_results(keys,
-                            requests,
-                            &sparse_results,
-                            cache,
-                            gather_map,
-                            set.ref(cuco::find),
-                            keys_have_nulls,
-                            include_null_keys,
-                            stream,
-                            mr);
-
-    return cudf::detail::gather(keys,
-                                gather_map,
-                                out_of_bounds_policy::DONT_CHECK,
-                                cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                stream,
-                                mr);
+    auto const make_set = [&](size_type size) {
+      return cuco::static_set{size,
+                              0.5,  // desired load factor
+                              cuco::empty_key{cudf::detail::CUDF_SIZE_TYPE_SENTINEL},
+                              d_key_equal,
+                              probing_scheme_type{d_row_hash},
+                              cuco::thread_scope_device,
+                              cuco::storage<1>{},
+                              cudf::detail::cuco_allocator{stream},
+                              stream.value()};
+    };
+
+    auto const aggregate = [&](auto const& set) {
+      // Compute all single pass aggs first, in shared memory if the keys have few groups
+      if (not compute_shared_memory_aggs(keys,
+                                         requests,
+                                         &sparse_results,
+                                         set,
+                                         d_row_hash,
+                                         keys_have_nulls,
+                                         include_null_keys,
+                                         stream)) {
+        compute_single_pass_aggs(keys,
+                                 requests,
+                                 &sparse_results,
+                                 set.ref(cuco::insert_and_find),
+                                 keys_have_nulls,
+                                 include_null_keys,
+                                 stream);
+      }
+
+      // Extract the populated indices from the hash set and create a gather map.
+      // Gathering using this map from sparse results will give dense results.
+      auto gather_map = extract_populated_keys(set, keys.num_rows(), stream);
+
+      // Compact all results from sparse_results and insert into cache
+      sparse_to_dense_results(keys,
+                              requests,
+                              &sparse_results,
+                              cache,
+                              gather_map,
+                              set.ref(cuco::find),
+                              keys_have_nulls,
+                              include_null_keys,
+                              stream,
+                              mr);
+
+      return gather_map;
+    };
+
+    // The set of large keys is sized for their estimated number of groups. The estimate is
+    // verified by inserting the keys before any aggregation: a set with more groups than it was
+    // sized for is replaced by a set sized for all the rows.
+    auto const set_size = hash_set_size(keys, include_null_keys, stream);
+    if (set_size < num_keys) {
+      auto set = make_set(set_size);
+      if (insert_keys(set, keys, keys_have_nulls, include_null_keys, stream) <= set_size) {
+        return aggregate(set);
+      }
+    }
+    return aggregate(make_set(num_keys));
   };
 
   if (cudf::detail::has_nested_columns(keys)) {
@@ -622,6 +1275,32 @@ std::unique_ptr<table> groupby(table_view const& keys,
 
 }  // namespace
 
+/**
+ * @brief Indicates if the aggregation `agg` of `values` can be computed with a
+ * hash-based groupby implementation.
+ */
+bool can_use_hash_groupby(column_view const& values, aggregation const& agg)
+{
+  auto const v_type = is_dictionary(values.type())
+                        ? cudf::dictionary_column_view(values).keys().type()
+                        : values.type();
+
+  // Currently, input values (not keys) of STRUCT and LIST types are not supported in any of
+  // hash-based aggregations. For those situations, we fallback to sort-based aggregations.
+  if (v_type.id() == type_id::STRUCT or v_type.id() == type_id::LIST) { return false; }
+
+  if (not is_hash_aggregation(agg.kind)) { return false; }
+  // The distinct values of each group are found in the values themselves, not their keys
+  if (array_contains(hash_set_aggregations, agg.kind)) { return not is_dictionary(values.type()); }
+  if (agg.kind == aggregation::M2 and
+      (is_dictionary(values.type()) or not cudf::is_numeric(v_type))) {
+    return false;
+  }
+  // Fixed-point results are updated atomically through their storage type
+  return cudf::type_dispatcher<dispatch_storage_type>(cudf::detail::target_type(v_type, agg.kind),
+                                                      has_atomic_support_impl{});
+}
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -634,17 +1313,8 @@ std::unique_ptr<table> groupby(table_view const& keys,
 bool can_use_hash_groupby(host_span<aggregation_request const> requests)
 {
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    auto const v_type = is_dictionary(r.values.type())
-                          ? cudf::dictionary_column_view(r.values).keys().type()
-                          : r.values.type();
-
-    // Currently, input values (not keys) of STRUCT and LIST types are not supported in any of
-    // hash-based aggregations. For those situations, we fallback to sort-based aggregations.
-    if (v_type.id() == type_id::STRUCT or v_type.id() == type_id::LIST) { return false; }
-
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [v_type](auto const& a) {
-      return cudf::has_atomic_support(cudf::detail::target_type(v_type, a->kind)) and
-             is_hash_aggregation(a->kind);
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+      return can_use_hash_groupby(r.values, *a);
     });
   });
 }
@@ -656,13 +1326,31 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
+{
+  auto [key_indices, results] = groupby_key_indices(keys, requests, include_null_keys, stream, mr);
+
+  auto unique_keys = cudf::detail::gather(keys,
+                                          key_indices,
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                          stream,
+                                          mr);
+  return std::pair(std::move(unique_keys), std::move(results));
+}
+
+std::pair<rmm::device_uvector<size_type>, std::vector<aggregation_result>> groupby_key_indices(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
 {
   cudf::detail::result_cache cache(requests.size());
 
-  std::unique_ptr<table> unique_keys =
+  auto key_indices =
     groupby(keys, requests, &cache, cudf::has_nulls(keys), include_null_keys, stream, mr);
 
-  return std::pair(std::move(unique_keys), extract_results(requests, cache, stream, mr));
+  return std::pair(std::move(key_indices), extract_results(requests, cache, stream, mr));
 }
 }  // namespace hash
 }  // namespace detail
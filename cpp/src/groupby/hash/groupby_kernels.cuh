@@ -20,9 +20,11 @@
 
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/utilities/bit.hpp>
 
+#include <cuda/atomic>
 #include <thrust/pair.h>
 
 namespace cudf {
@@ -105,6 +107,104 @@ struct compute_single_pass_aggs_fn {
   }
 };
 
+/**
+ * @brief Inserts every row index `i` of the keys into `set` and returns the index of the row of
+ * its key in the set, i.e. the row of the group of `i` in the sparse results
+ *
+ * Rows with null keys that are skipped are not inserted and have no group, denoted by
+ * `cudf::detail::CUDF_SIZE_TYPE_SENTINEL`.
+ *
+ * @tparam SetType The type of the hash set device ref
+ */
+template <typename SetType>
+struct find_group_row_fn {
+  SetType set;
+  bitmask_type const* __restrict__ row_bitmask;
+  bool skip_rows_with_nulls;
+
+  __device__ size_type operator()(size_type i)
+  {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) {
+      return cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+    }
+    return *set.insert_and_find(i).first;
+  }
+};
+
+/**
+ * @brief Returns the dense group of each row of a dictionary key column, the index of its key in
+ * the dictionary
+ *
+ * The group of the rows with null keys is the number of keys of the dictionary, or -1 if they are
+ * skipped.
+ */
+struct dictionary_key_group_fn {
+  column_device_view keys;
+  size_type num_keys;
+  bool skip_rows_with_nulls;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    if (keys.is_null(i)) { return skip_rows_with_nulls ? -1 : num_keys; }
+    return keys.element<dictionary32>(i).value();
+  }
+};
+
+/**
+ * @brief Returns the dense group of each row of an integer key column, the difference of its key
+ * and the minimum key
+ *
+ * The group of the rows with null keys is the number of keys of the range, or -1 if they are
+ * skipped.
+ */
+template <typename T>
+struct integer_key_group_fn {
+  column_device_view keys;
+  T min_key;
+  size_type num_keys;
+  bool skip_rows_with_nulls;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    if (keys.is_null(i)) { return skip_rows_with_nulls ? -1 : num_keys; }
+    return static_cast<size_type>(keys.element<T>(i) - min_key);
+  }
+};
+
+/**
+ * @brief Records the first row of each dense group, the minimum of the rows of the group
+ */
+struct find_first_group_row_fn {
+  size_type const* __restrict__ group_ids;
+  size_type* __restrict__ group_rows;
+
+  __device__ void operator()(size_type i) const
+  {
+    auto const group = group_ids[i];
+    if (group < 0) { return; }
+    cuda::atomic_ref<size_type, cuda::thread_scope_device> ref{group_rows[group]};
+    ref.fetch_min(i, cuda::std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @brief Computes single-pass aggregations of the rows of dense groups into the dense
+ * `output_values` table of the groups, skipping the rows of negative groups
+ */
+struct compute_dense_aggs_fn {
+  size_type const* __restrict__ group_ids;
+  table_device_view input_values;
+  mutable_table_device_view output_values;
+  aggregation::Kind const* __restrict__ aggs;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const group = group_ids[i];
+    if (group < 0) { return; }
+    cudf::detail::aggregate_row<true, true>(output_values, group, input_values, i, aggs);
+  }
+};
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
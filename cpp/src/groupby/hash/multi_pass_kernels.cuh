@@ -111,5 +111,71 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief Adds the squared deviation of each row from the mean of its group to the M2 of the group
+ *
+ * The mean of each group is computed from the SUM and COUNT_VALID of the group.
+ */
+template <typename SetType, bool target_has_nulls = true, bool source_has_nulls = true>
+struct m2_hash_functor {
+  SetType set;
+  bitmask_type const* __restrict__ row_bitmask;
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view sum;
+  column_device_view count;
+  m2_hash_functor(SetType set,
+                  bitmask_type const* row_bitmask,
+                  mutable_column_device_view target,
+                  column_device_view source,
+                  column_device_view sum,
+                  column_device_view count)
+    : set(set), row_bitmask(row_bitmask), target(target), source(source), sum(sum), count(count)
+  {
+  }
+
+  template <typename Source>
+  constexpr static bool is_supported()
+  {
+    return is_numeric<Source>() && !is_fixed_point<Source>();
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<!is_supported<Source>()> operator()(column_device_view const& source,
+                                                                  size_type source_index,
+                                                                  size_type target_index) noexcept
+  {
+    CUDF_UNREACHABLE("Invalid source type for m2 aggregation.");
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<is_supported<Source>()> operator()(column_device_view const& source,
+                                                                 size_type source_index,
+                                                                 size_type target_index) noexcept
+  {
+    using Target    = target_type_t<Source, aggregation::M2>;
+    using SumType   = target_type_t<Source, aggregation::SUM>;
+    using CountType = target_type_t<Source, aggregation::COUNT_VALID>;
+
+    if (source_has_nulls and source.is_null(source_index)) return;
+    CountType group_size = count.element<CountType>(target_index);
+    if (group_size == 0) return;
+
+    auto x    = static_cast<Target>(source.element<Source>(source_index));
+    auto mean = static_cast<Target>(sum.element<SumType>(target_index)) / group_size;
+    cuda::atomic_ref<Target, cuda::thread_scope_device> ref{target.element<Target>(target_index)};
+    ref.fetch_add((x - mean) * (x - mean), cuda::std::memory_order_relaxed);
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+  __device__ inline void operator()(size_type source_index)
+  {
+    if (row_bitmask == nullptr or cudf::bit_is_set(row_bitmask, source_index)) {
+      auto const target_index = *set.find(source_index);
+      type_dispatcher(source.type(), *this, source, source_index, target_index);
+    }
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
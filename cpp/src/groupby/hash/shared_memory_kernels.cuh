@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/// Maximum number of groups aggregated in shared memory by each thread block
+constexpr size_type shared_memory_max_groups = 2048;
+/// Number of rows whose distinct hashes estimate the number of groups of the keys
+constexpr size_type shared_memory_sample_size = 4096;
+/// Number of threads of the blocks of the shared memory aggregation
+constexpr int shared_memory_block_size = 256;
+/// Number of rows aggregated by each thread of the shared memory aggregation
+constexpr int shared_memory_rows_per_thread = 16;
+
+/**
+ * @brief Indicates whether the aggregation `k` of `Source` values can be computed in shared memory
+ *
+ * Only the single pass aggregations of non-nullable numeric results, and ARGMIN/ARGMAX of
+ * relationally comparable values, are aggregated in shared memory.
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  if constexpr (not cudf::detail::is_valid_aggregation<Source, k>()) {
+    return false;
+  } else {
+    using Target = cudf::detail::target_type_t<Source, k>;
+    if constexpr (k == aggregation::ARGMIN or k == aggregation::ARGMAX) {
+      return cudf::is_relationally_comparable<Source, Source>() and
+             (cudf::is_numeric<Source>() or cudf::is_chrono<Source>() or
+              std::is_same_v<Source, cudf::string_view>);
+    } else if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+      return true;
+    } else if constexpr (k == aggregation::SUM or k == aggregation::PRODUCT or
+                         k == aggregation::MIN or k == aggregation::MAX or
+                         k == aggregation::SUM_OF_SQUARES) {
+      return cudf::is_numeric<Source>() and cudf::is_numeric<Target>() and
+             not std::is_same_v<Source, bool> and not std::is_same_v<Target, bool>;
+    } else {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Returns the value of an empty group of the aggregation `k`
+ */
+template <typename Target, aggregation::Kind k>
+__device__ constexpr Target shared_memory_identity()
+{
+  if constexpr (k == aggregation::ARGMIN or k == aggregation::ARGMAX) {
+    return cudf::detail::ARGMIN_SENTINEL;
+  } else if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+    return Target{0};
+  } else {
+    using Op = typename cudf::detail::corresponding_operator<k>::type;
+    return Op::template identity<Target>();
+  }
+}
+
+/**
+ * @brief Aggregates the row `row` of `source`, or the already aggregated `value`, into `target`
+ *
+ * ARGMIN and ARGMAX values are indices of rows of `source`, so that the aggregated rows and the
+ * aggregated values of partial groups are the same: the index of a row.
+ */
+template <typename Source, aggregation::Kind k, typename Target>
+__device__ void shared_memory_update(Target* target,
+                                     Target value,
+                                     column_device_view const& source)
+{
+  if constexpr (k == aggregation::ARGMIN or k == aggregation::ARGMAX) {
+    auto old = cudf::detail::atomic_cas(target, cudf::detail::ARGMIN_SENTINEL, value);
+    if (old != cudf::detail::ARGMIN_SENTINEL) {
+      auto const is_better = [&](size_type current) {
+        if constexpr (k == aggregation::ARGMIN) {
+          return source.element<Source>(value) < source.element<Source>(current);
+        } else {
+          return source.element<Source>(value) > source.element<Source>(current);
+        }
+      };
+      while (is_better(old)) {
+        old = cudf::detail::atomic_cas(target, old, value);
+      }
+    }
+  } else if constexpr (k == aggregation::PRODUCT) {
+    cudf::detail::atomic_mul(target, value);
+  } else if constexpr (k == aggregation::MIN) {
+    cudf::detail::atomic_min(target, value);
+  } else if constexpr (k == aggregation::MAX) {
+    cudf::detail::atomic_max(target, value);
+  } else {
+    // SUM, SUM_OF_SQUARES and the counts add the partial values
+    cudf::detail::atomic_add(target, value);
+  }
+}
+
+/**
+ * @brief Returns the value of the row `row` of `source` aggregated by `k` into an empty group
+ */
+template <typename Source, aggregation::Kind k, typename Target>
+__device__ Target shared_memory_row_value(column_device_view const& source, size_type row)
+{
+  if constexpr (k == aggregation::ARGMIN or k == aggregation::ARGMAX) {
+    return row;
+  } else if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+    return Target{1};
+  } else if constexpr (k == aggregation::SUM_OF_SQUARES) {
+    auto const value = static_cast<Target>(source.element<Source>(row));
+    return value * value;
+  } else {
+    return static_cast<Target>(source.element<Source>(row));
+  }
+}
+
+/**
+ * @brief Aggregates the rows of `source` into the groups of `group_ids`, first in a shared memory
+ * table of the groups of each thread block and then into the sparse `target`
+ *
+ * Privatizing the groups of each block turns the atomic updates of the rows of a group, which
+ * contend on a single element of `target` when the groups are few, into updates of shared memory.
+ * Each block then updates each element of `target` at most once.
+ *
+ * @param source The aggregated values
+ * @param group_ids The dense group of each row, or a negative value to skip the row
+ * @param num_groups The number of groups
+ * @param group_rows The row of `target` of each group
+ * @param target The sparse aggregation results
+ */
+template <typename Source, aggregation::Kind k>
+CUDF_KERNEL void __launch_bounds__(shared_memory_block_size)
+  shared_memory_aggregate(column_device_view source,
+                          size_type const* group_ids,
+                          size_type num_groups,
+                          size_type const* group_rows,
+                          mutable_column_device_view target)
+{
+  using Target = cudf::detail::target_type_t<Source, k>;
+
+  extern __shared__ char shared_memory[];
+  auto* values = reinterpret_cast<Target*>(shared_memory);
+  auto* valid  = reinterpret_cast<bool*>(values + num_groups);
+
+  for (auto group = static_cast<size_type>(threadIdx.x); group < num_groups;
+       group += blockDim.x) {
+    values[group] = shared_memory_identity<Target, k>();
+    valid[group]  = false;
+  }
+  __syncthreads();
+
+  auto const count_nulls = k == aggregation::COUNT_ALL;
+  auto const stride      = cudf::detail::grid_1d::grid_stride();
+  for (auto tidx = cudf::detail::grid_1d::global_thread_id(); tidx < source.size();
+       tidx += stride) {
+    auto const row   = static_cast<size_type>(tidx);
+    auto const group = group_ids[row];
+    if (group < 0 or (not count_nulls and source.is_null(row))) { continue; }
+    shared_memory_update<Source, k>(
+      values + group, shared_memory_row_value<Source, k, Target>(source, row), source);
+    valid[group] = true;
+  }
+  __syncthreads();
+
+  for (auto group = static_cast<size_type>(threadIdx.x); group < num_groups;
+       group += blockDim.x) {
+    if (not valid[group]) { continue; }
+    auto const target_row = group_rows[group];
+    shared_memory_update<Source, k>(&target.element<Target>(target_row), values[group], source);
+    if (target.nullable() and target.is_null(target_row)) { target.set_valid(target_row); }
+  }
+}
+
+/**
+ * @brief Returns whether the aggregation `k` of values of type `type` can be computed in shared
+ * memory
+ */
+struct is_shared_memory_aggregation_fn {
+  template <typename Source, aggregation::Kind k>
+  bool operator()() const noexcept
+  {
+    return is_shared_memory_aggregation<Source, k>();
+  }
+};
+
+/**
+ * @brief Launches the shared memory aggregation of `source` by `k`
+ */
+struct shared_memory_aggregate_fn {
+  template <typename Source, aggregation::Kind k>
+  void operator()(column_device_view const& source,
+                  size_type const* group_ids,
+                  size_type num_groups,
+                  size_type const* group_rows,
+                  mutable_column_device_view const& target,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target = cudf::detail::target_type_t<Source, k>;
+      auto const shared_memory_size = num_groups * (sizeof(Target) + sizeof(bool));
+      cudf::detail::grid_1d const grid{
+        source.size(), shared_memory_block_size, shared_memory_rows_per_thread};
+      shared_memory_aggregate<Source, k>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_memory_size, stream.value()>>>(
+          source, group_ids, num_groups, group_rows, target);
+    } else {
+      CUDF_FAIL("Unsupported shared memory aggregation");
+    }
+  }
+};
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/host_spill.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+/// Device memory used by the groupby of a bucket, as a multiple of the size of its rows
+constexpr std::size_t groupby_bytes_per_row_byte = 4;
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate_out_of_core(
+  host_span<aggregation_request const> requests,
+  std::size_t device_memory_budget,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(device_memory_budget > 0,
+               "The device memory budget must be positive",
+               std::invalid_argument);
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  // The keys and the values of the requests are partitioned together
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  for (auto const& request : requests) {
+    columns.push_back(request.values);
+  }
+  auto const input    = table_view{columns};
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) { return aggregate(requests, stream, mr); }
+
+  auto const input_bytes = cudf::detail::table_size_bytes(input, stream);
+  auto const num_buckets = static_cast<int>(
+    (input_bytes * groupby_bytes_per_row_byte + device_memory_budget - 1) / device_memory_budget);
+  if (num_buckets <= 1) { return aggregate(requests, stream, mr); }
+
+  // Partition chunks of the rows within half of the budget, so that a chunk and its partitions
+  // are in device memory at once, and spill the bucket of each partition to host memory
+  auto const rows_per_chunk = std::max<size_type>(
+    1,
+    static_cast<size_type>(static_cast<double>(num_rows) * (device_memory_budget / 2) /
+                           std::max<std::size_t>(input_bytes, 1)));
+  std::vector<size_type> key_columns(_keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  std::vector<std::vector<cudf::detail::host_spilled_table>> buckets(num_buckets);
+  for (size_type begin = 0; begin < num_rows; begin += rows_per_chunk) {
+    auto const end =
+      static_cast<size_type>(std::min<int64_t>(num_rows, int64_t{begin} + rows_per_chunk));
+    auto const chunk = cudf::detail::slice(input, {begin, end}, stream).front();
+    auto const [partitioned, offsets] = hash_partition(chunk,
+                                                       key_columns,
+                                                       num_buckets,
+                                                       hash_id::HASH_MURMUR3,
+                                                       DEFAULT_HASH_SEED,
+                                                       stream,
+                                                       rmm::mr::get_current_device_resource());
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+      auto const bucket_begin = offsets[bucket];
+      auto const bucket_end =
+        bucket + 1 < num_buckets ? offsets[bucket + 1] : partitioned->num_rows();
+      if (bucket_begin == bucket_end) { continue; }
+      buckets[bucket].push_back(cudf::detail::spill_to_host(
+        cudf::detail::slice(partitioned->view(), {bucket_begin, bucket_end}, stream).front(),
+        stream));
+    }
+  }
+
+  // The groups of a bucket are all in the bucket, so that each bucket is aggregated on its own
+  std::vector<std::unique_ptr<table>> bucket_keys;
+  std::vector<std::vector<aggregation_result>> bucket_results;
+  for (auto const& bucket : buckets) {
+    if (bucket.empty()) { continue; }
+    auto const rows =
+      cudf::detail::unspill_from_host(bucket, stream, rmm::mr::get_current_device_resource());
+    auto const rows_view = rows->view();
+    std::vector<aggregation_request> bucket_requests(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      bucket_requests[i].values = rows_view.column(_keys.num_columns() + i);
+      for (auto const& agg : requests[i].aggregations) {
+        bucket_requests[i].aggregations.emplace_back(
+          dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+      }
+    }
+    auto [keys, results] = groupby{rows_view.select(key_columns), _include_null_keys}.aggregate(
+      bucket_requests, stream, rmm::mr::get_current_device_resource());
+    bucket_keys.push_back(std::move(keys));
+    bucket_results.push_back(std::move(results));
+  }
+
+  std::vector<table_view> keys_views;
+  for (auto const& keys : bucket_keys) {
+    keys_views.push_back(keys->view());
+  }
+  auto out_keys = cudf::detail::concatenate(keys_views, stream, mr);
+
+  std::vector<aggregation_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      std::vector<column_view> result_views;
+      for (auto const& bucket_result : bucket_results) {
+        result_views.push_back(bucket_result[i].results[j]->view());
+      }
+      results[i].results.push_back(cudf::detail::concatenate(result_views, stream, mr));
+    }
+  }
+  return std::pair(std::move(out_keys), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reductions/segmented/counts.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/reduction/detail/segmented_reduction_functions.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace run_length {
+namespace {
+
+/// Minimum average number of rows of the runs of equal keys of clustered keys
+constexpr size_type min_average_run_length = 8;
+
+/**
+ * @brief Returns whether a row of the keys starts a run of equal keys
+ */
+template <typename Equal>
+struct is_run_start_fn {
+  Equal d_equal;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return row == 0 or not d_equal(row - 1, row);
+  }
+};
+
+/**
+ * @brief Returns the number of rows of `keys` that start a run of equal keys, and optionally
+ * writes these rows to `run_starts`
+ */
+size_type find_run_starts(table_view const& keys,
+                          size_type* run_starts,
+                          rmm::cuda_stream_view stream)
+{
+  auto const comparator = cudf::experimental::row::equality::self_comparator{keys, stream};
+  auto const d_equal    = comparator.equal_to<false>(
+    cudf::nullate::DYNAMIC{cudf::has_nested_nulls(keys)}, null_equality::EQUAL);
+  auto const is_run_start = is_run_start_fn<decltype(d_equal)>{d_equal};
+  auto const rows         = thrust::make_counting_iterator<size_type>(0);
+
+  if (run_starts == nullptr) {
+    return thrust::count_if(rmm::exec_policy(stream), rows, rows + keys.num_rows(), is_run_start);
+  }
+  auto const run_starts_end = thrust::copy_if(
+    rmm::exec_policy(stream), rows, rows + keys.num_rows(), run_starts, is_run_start);
+  return static_cast<size_type>(thrust::distance(run_starts, run_starts_end));
+}
+
+/**
+ * @brief Returns whether the aggregation `kind` is computed by the run-length groupby
+ */
+bool is_run_length_aggregation(column_view const& values, aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM:
+    case aggregation::PRODUCT: return cudf::is_numeric(values.type());
+    case aggregation::MIN:
+    case aggregation::MAX: return cudf::is_numeric(values.type()) or cudf::is_chrono(values.type());
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the aggregation `kind` of the rows of each run of `values`
+ */
+std::unique_ptr<column> aggregate_runs(column_view const& values,
+                                       aggregation::Kind kind,
+                                       device_span<size_type const> run_offsets,
+                                       rmm::cuda_stream_view stream)
+{
+  auto const mr          = rmm::mr::get_current_device_resource();
+  auto const target_type = cudf::detail::target_type(values.type(), kind);
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: {
+      auto const null_handling =
+        kind == aggregation::COUNT_ALL ? null_policy::INCLUDE : null_policy::EXCLUDE;
+      auto counts = cudf::reduction::detail::segmented_counts(
+        values.null_mask(), values.has_nulls(), run_offsets, null_handling, stream, mr);
+      return std::make_unique<column>(std::move(counts), rmm::device_buffer{}, 0);
+    }
+    case aggregation::SUM:
+      return cudf::reduction::detail::segmented_sum(
+        values, run_offsets, target_type, null_policy::EXCLUDE, std::nullopt, stream, mr);
+    case aggregation::PRODUCT:
+      return cudf::reduction::detail::segmented_product(
+        values, run_offsets, target_type, null_policy::EXCLUDE, std::nullopt, stream, mr);
+    case aggregation::MIN:
+      return cudf::reduction::detail::segmented_min(
+        values, run_offsets, target_type, null_policy::EXCLUDE, std::nullopt, stream, mr);
+    case aggregation::MAX:
+      return cudf::reduction::detail::segmented_max(
+        values, run_offsets, target_type, null_policy::EXCLUDE, std::nullopt, stream, mr);
+    default: CUDF_FAIL("Unsupported run-length groupby aggregation");
+  }
+}
+
+/**
+ * @brief Returns the aggregation that merges the results of `kind` of the runs of a group
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    // SUM and the counts add the results of the runs
+    default: return make_sum_aggregation<groupby_aggregation>();
+  }
+}
+
+}  // namespace
+
+bool can_use_run_length_groupby(table_view const& keys,
+                                host_span<aggregation_request const> requests)
+{
+  if (cudf::detail::has_nested_columns(keys)) { return false; }
+  auto const is_supported_request = [](aggregation_request const& r) {
+    return not cudf::is_dictionary(r.values.type()) and
+           std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+             return is_run_length_aggregation(r.values, a->kind);
+           });
+  };
+  return std::all_of(requests.begin(), requests.end(), is_supported_request) and
+         hash::can_use_hash_groupby(requests);
+}
+
+bool is_clustered(table_view const& keys, rmm::cuda_stream_view stream)
+{
+  if (keys.num_rows() < min_average_run_length) { return false; }
+  auto const num_runs = find_run_starts(keys, nullptr, stream);
+  return static_cast<int64_t>(num_runs) * min_average_run_length <= keys.num_rows();
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = keys.num_rows();
+
+  // The offsets of the runs of equal adjacent keys
+  rmm::device_uvector<size_type> run_offsets(num_rows + 1, stream);
+  auto const num_runs = find_run_starts(keys, run_offsets.data(), stream);
+  run_offsets.set_element_async(num_runs, num_rows, stream);
+  run_offsets.resize(num_runs + 1, stream);
+
+  auto const run_starts = device_span<size_type const>{run_offsets.data(), run_offsets.size() - 1};
+  auto const run_keys   = cudf::detail::gather(keys,
+                                             run_starts,
+                                             out_of_bounds_policy::DONT_CHECK,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             rmm::mr::get_current_device_resource());
+
+  // Aggregate the rows of each run with the segmented reductions, then merge the runs of equal
+  // keys, which are the partial results of the same group
+  std::vector<std::unique_ptr<column>> run_results;
+  std::vector<aggregation_request> merge_requests;
+  for (auto const& request : requests) {
+    for (auto const& agg : request.aggregations) {
+      run_results.push_back(aggregate_runs(request.values, agg->kind, run_offsets, stream));
+      merge_requests.emplace_back();
+      merge_requests.back().values = run_results.back()->view();
+      merge_requests.back().aggregations.push_back(make_merge_aggregation(agg->kind));
+    }
+  }
+  auto [unique_keys, merged_results] =
+    hash::groupby(run_keys->view(), merge_requests, include_null_keys, stream, mr);
+
+  std::vector<aggregation_result> results(requests.size());
+  auto merged_result = merged_results.begin();
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (auto const& agg : requests[i].aggregations) {
+      auto result = std::move(merged_result->results.front());
+      ++merged_result;
+      // The merged counts are SUM results
+      auto const target_type = cudf::detail::target_type(requests[i].values.type(), agg->kind);
+      if (result->type() != target_type) {
+        result = cudf::detail::cast(result->view(), target_type, stream, mr);
+      }
+      results[i].results.push_back(std::move(result));
+    }
+  }
+  return std::pair(std::move(unique_keys), std::move(results));
+}
+
+}  // namespace run_length
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
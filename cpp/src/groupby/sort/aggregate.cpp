@@ -32,6 +32,7 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -62,6 +63,38 @@ struct aggregate_result_functor final : store_result_functor {
   {
     CUDF_FAIL("Unsupported aggregation.");
   }
+
+ private:
+  /**
+   * @brief Computes the quantiles of each group
+   *
+   * The quantiles are selected from the grouped values so the values need not be sorted within
+   * each group. Dictionary values, and values already sorted for another aggregation, use the
+   * sorted values instead.
+   */
+  std::unique_ptr<column> compute_group_quantiles(column_view const& group_sizes,
+                                                  std::vector<double> const& quantiles,
+                                                  interpolation interp)
+  {
+    if (cudf::is_dictionary(values.type()) || sorted_values) {
+      return detail::group_quantiles(get_sorted_values(),
+                                     group_sizes,
+                                     helper.group_offsets(stream),
+                                     helper.num_groups(stream),
+                                     quantiles,
+                                     interp,
+                                     stream,
+                                     mr);
+    }
+    return detail::group_quantiles_by_selection(get_grouped_values(),
+                                                group_sizes,
+                                                helper.group_offsets(stream),
+                                                helper.num_groups(stream),
+                                                quantiles,
+                                                interp,
+                                                stream,
+                                                mr);
+  }
 };
 
 template <>
@@ -329,14 +362,8 @@ void aggregate_result_functor::operator()<aggregation::QUANTILE>(aggregation con
   column_view group_sizes = cache.get_result(values, *count_agg);
   auto& quantile_agg      = dynamic_cast<cudf::detail::quantile_aggregation const&>(agg);
 
-  auto result = detail::group_quantiles(get_sorted_values(),
-                                        group_sizes,
-                                        helper.group_offsets(stream),
-                                        helper.num_groups(stream),
-                                        quantile_agg._quantiles,
-                                        quantile_agg._interpolation,
-                                        stream,
-                                        mr);
+  auto result =
+    compute_group_quantiles(group_sizes, quantile_agg._quantiles, quantile_agg._interpolation);
   cache.add_result(values, agg, std::move(result));
 }
 
@@ -349,14 +376,7 @@ void aggregate_result_functor::operator()<aggregation::MEDIAN>(aggregation const
   operator()<aggregation::COUNT_VALID>(*count_agg);
   column_view group_sizes = cache.get_result(values, *count_agg);
 
-  auto result = detail::group_quantiles(get_sorted_values(),
-                                        group_sizes,
-                                        helper.group_offsets(stream),
-                                        helper.num_groups(stream),
-                                        {0.5},
-                                        interpolation::LINEAR,
-                                        stream,
-                                        mr);
+  auto result = compute_group_quantiles(group_sizes, {0.5}, interpolation::LINEAR);
   cache.add_result(values, agg, std::move(result));
 }
 
@@ -792,6 +812,49 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                               mr));
 }
 
+/**
+ * @brief Generate a HyperLogLog++ sketch of the values of each group.
+ *
+ * The sketch of a group is a list of `2^precision` INT8 registers, from which
+ * `cudf::estimate_distinct_count` estimates the number of distinct values of the group.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::HLLPP>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::hllpp_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::reduction::detail::group_hllpp(get_grouped_values(),
+                                                        helper.group_labels(stream),
+                                                        helper.num_groups(stream),
+                                                        precision,
+                                                        stream,
+                                                        mr));
+}
+
+/**
+ * @brief Merge the HyperLogLog++ sketches of each group into one sketch.
+ *
+ * The input values are sketches produced by `HLLPP` or `MERGE_HLLPP` aggregations.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_HLLPP>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::merge_hllpp_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::reduction::detail::group_merge_hllpp(get_grouped_values(),
+                                                              helper.group_labels(stream),
+                                                              helper.num_groups(stream),
+                                                              precision,
+                                                              stream,
+                                                              mr));
+}
+
 }  // namespace detail
 
 // Sort-based groupby
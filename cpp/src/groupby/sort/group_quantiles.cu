@@ -16,6 +16,7 @@
 
 #include "group_reductions.hpp"
 #include "quantiles/quantiles_util.hpp"
+#include "quantiles/radix_select.cuh"
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
@@ -152,6 +153,151 @@ struct quantiles_functor {
   }
 };
 
+/// Number of threads of the blocks selecting the quantiles of each group
+constexpr size_type group_radix_select_block_size = 256;
+
+/**
+ * @brief Computes the quantiles of each group by radix selecting the values they need
+ *
+ * Each block selects the values of one group: every pass over the group adds the next
+ * `radix_select_digit_bits` bits to the keys of up to `radix_select_ranks_per_pass` ranks,
+ * using histograms held in shared memory.
+ */
+template <typename T, typename ResultType>
+CUDF_KERNEL void group_radix_select_quantiles_kernel(column_device_view values,
+                                                     size_type const* group_sizes,
+                                                     size_type const* group_offsets,
+                                                     double const* quantiles,
+                                                     size_type num_quantiles,
+                                                     interpolation interp,
+                                                     cudf::detail::radix_key_t<T>* keys,
+                                                     mutable_column_device_view result,
+                                                     size_type* null_count)
+{
+  using Key = cudf::detail::radix_key_t<T>;
+
+  auto constexpr num_buckets = cudf::detail::radix_select_buckets;
+  auto constexpr max_ranks   = cudf::detail::radix_select_ranks_per_pass;
+
+  __shared__ size_type histograms[max_ranks * num_buckets];
+  __shared__ Key prefixes[max_ranks];
+  __shared__ size_type ranks[max_ranks];
+
+  auto const group      = static_cast<size_type>(blockIdx.x);
+  auto const size       = group_sizes[group];
+  auto const num_slots  = cudf::detail::ranks_per_quantile(interp);
+  auto const num_ranks  = num_quantiles * num_slots;
+  auto const group_keys = keys + static_cast<int64_t>(group) * num_ranks;
+  auto const tid        = static_cast<size_type>(threadIdx.x);
+
+  for (size_type first = 0; size > 0 && first < num_ranks; first += max_ranks) {
+    auto const batch_ranks = min(num_ranks - first, max_ranks);
+    if (tid < batch_ranks) {
+      auto const rank = first + tid;
+      prefixes[tid]   = Key{0};
+      ranks[tid] =
+        cudf::detail::quantile_rank(size, quantiles[rank / num_slots], interp, rank % num_slots);
+    }
+    auto constexpr first_shift =
+      static_cast<int>(sizeof(Key) * 8) - cudf::detail::radix_select_digit_bits;
+    for (int shift = first_shift; shift >= 0; shift -= cudf::detail::radix_select_digit_bits) {
+      for (auto idx = tid; idx < batch_ranks * num_buckets; idx += blockDim.x) {
+        histograms[idx] = 0;
+      }
+      __syncthreads();
+
+      for (auto idx = group_offsets[group] + tid; idx < group_offsets[group + 1];
+           idx += blockDim.x) {
+        if (values.is_null(idx)) { continue; }
+        auto const key   = cudf::detail::to_radix_key(values.element<T>(idx));
+        auto const digit = cudf::detail::radix_digit(key, shift);
+        for (size_type rank = 0; rank < batch_ranks; ++rank) {
+          if (cudf::detail::matches_radix_prefix(key, prefixes[rank], shift)) {
+            atomicAdd(histograms + rank * num_buckets + digit, 1);
+          }
+        }
+      }
+      __syncthreads();
+
+      if (tid < batch_ranks) {
+        cudf::detail::select_radix_digit(
+          histograms + tid * num_buckets, shift, prefixes[tid], ranks[tid]);
+      }
+      __syncthreads();
+    }
+    if (tid < batch_ranks) { group_keys[first + tid] = prefixes[tid]; }
+    __syncthreads();
+  }
+
+  for (auto idx = tid; idx < num_quantiles; idx += blockDim.x) {
+    auto const out = group * num_quantiles + idx;
+    if (size == 0) {
+      result.set_null(out);
+      atomicAdd(null_count, 1);
+      continue;
+    }
+    auto const slots    = group_keys + idx * num_slots;
+    T const selected[2] = {cudf::detail::from_radix_key<T>(slots[0]),
+                           cudf::detail::from_radix_key<T>(slots[num_slots - 1])};
+
+    result.element<ResultType>(out) = cudf::detail::select_quantile_from_ranks<ResultType>(
+      selected, size, quantiles[idx], interp);
+    result.set_valid(out);
+  }
+}
+
+struct quantiles_by_selection_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T>, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    column_view const& group_sizes,
+    cudf::device_span<size_type const> group_offsets,
+    size_type const num_groups,
+    device_span<double const> quantile,
+    interpolation interpolation,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr)
+  {
+    using ResultType = cudf::detail::target_type_t<T, aggregation::QUANTILE>;
+
+    auto result = make_numeric_column(data_type(type_to_id<ResultType>()),
+                                      group_sizes.size() * quantile.size(),
+                                      mask_state::UNINITIALIZED,
+                                      stream,
+                                      mr);
+    if (result->size() == 0) { return result; }
+
+    auto const num_ranks = static_cast<int64_t>(quantile.size()) *
+                           cudf::detail::ranks_per_quantile(interpolation);
+    auto keys = rmm::device_uvector<cudf::detail::radix_key_t<T>>(num_groups * num_ranks, stream);
+
+    auto values_view = column_device_view::create(values, stream);
+    auto result_view = mutable_column_device_view::create(result->mutable_view(), stream);
+    auto null_count  = rmm::device_scalar<cudf::size_type>(0, stream, mr);
+
+    group_radix_select_quantiles_kernel<T, ResultType>
+      <<<num_groups, group_radix_select_block_size, 0, stream.value()>>>(
+        *values_view,
+        group_sizes.begin<size_type>(),
+        group_offsets.data(),
+        quantile.data(),
+        static_cast<size_type>(quantile.size()),
+        interpolation,
+        keys.data(),
+        *result_view,
+        null_count.data());
+
+    result->set_null_count(null_count.value(stream));
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic_v<T>, std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only arithmetic types are supported in quantiles");
+  }
+};
+
 }  // namespace
 
 // TODO: add optional check for is_sorted. Use context.flag_sorted
@@ -183,6 +329,34 @@ std::unique_ptr<column> group_quantiles(column_view const& values,
                          mr);
 }
 
+std::unique_ptr<column> group_quantiles_by_selection(
+  column_view const& values,
+  column_view const& group_sizes,
+  cudf::device_span<size_type const> group_offsets,
+  size_type const num_groups,
+  std::vector<double> const& quantiles,
+  interpolation interp,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(!cudf::is_dictionary(values.type()),
+               "Quantiles of dictionary values must be computed from sorted values");
+
+  auto dv_quantiles = cudf::detail::make_device_uvector_async(
+    quantiles, stream, rmm::mr::get_current_device_resource());
+
+  return type_dispatcher(values.type(),
+                         quantiles_by_selection_functor{},
+                         values,
+                         group_sizes,
+                         group_offsets,
+                         num_groups,
+                         dv_quantiles,
+                         interp,
+                         stream,
+                         mr);
+}
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
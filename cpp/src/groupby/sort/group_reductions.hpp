@@ -329,6 +329,35 @@ std::unique_ptr<column> group_quantiles(column_view const& values,
                                         rmm::cuda_stream_view stream,
                                         rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Internal API to calculate groupwise quantiles without sorting the values within
+ * each group
+ *
+ * Computes the same quantiles as `group_quantiles` on the sorted values of each group, but
+ * radix selects the values adjacent to each quantile from the unsorted values of the group.
+ * Null values are skipped.
+ *
+ * @throws cudf::logic_error if @p values is a dictionary column
+ *
+ * @param values Grouped values to get quantiles from, in any order within each group
+ * @param group_sizes Number of valid elements per group
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param quantiles List of quantiles q where q lies in [0,1]
+ * @param interp Method to use when desired value lies between data points
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_quantiles_by_selection(
+  column_view const& values,
+  column_view const& group_sizes,
+  cudf::device_span<size_type const> group_offsets,
+  size_type const num_groups,
+  std::vector<double> const& quantiles,
+  interpolation interp,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @brief Internal API to calculate number of unique values in each group of
  *  @p values
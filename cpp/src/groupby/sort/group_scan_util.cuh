@@ -26,9 +26,9 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
-#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -40,6 +40,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace groupby {
@@ -209,8 +210,23 @@ struct group_scan_functor<K,
                                   thrust::equal_to{},
                                   binop_generator.binop());
 
+    // Null rows gather an out-of-bounds index so that the gather nullifies their children
+    // elements, pushing the nulls of the root structs column down to them in the same pass.
+    if (values.has_nulls()) {
+      thrust::transform(rmm::exec_policy_nosync(stream),
+                        thrust::counting_iterator<size_type>(0),
+                        thrust::counting_iterator<size_type>(values.size()),
+                        gather_map.begin(),
+                        gather_map.begin(),
+                        [mask      = values.null_mask(),
+                         offset    = values.offset(),
+                         oob_index = values.size()] __device__(size_type idx, size_type map) {
+                          return bit_is_set(mask, idx + offset) ? map : oob_index;
+                        });
+    }
+
     //
-    // Gather the children elements of the prefix min/max struct elements first.
+    // Gather the children elements of the prefix min/max struct elements.
     //
     // Typically, we should use `get_sliced_child` for each child column to properly handle the
     // input if it is a sliced view. However, since the input to this function is just generated
@@ -220,21 +236,13 @@ struct group_scan_functor<K,
       cudf::detail::gather(
         table_view(std::vector<column_view>{values.child_begin(), values.child_end()}),
         gather_map,
-        cudf::out_of_bounds_policy::DONT_CHECK,
+        values.has_nulls() ? cudf::out_of_bounds_policy::NULLIFY
+                           : cudf::out_of_bounds_policy::DONT_CHECK,
         cudf::detail::negative_index_policy::NOT_ALLOWED,
         stream,
         mr)
         ->release();
 
-    // After gathering the children elements, we need to push down nulls from the root structs
-    // column to them.
-    if (values.has_nulls()) {
-      for (std::unique_ptr<column>& child : scanned_children) {
-        child = structs::detail::superimpose_nulls(
-          values.null_mask(), values.null_count(), std::move(child), stream, mr);
-      }
-    }
-
     return make_structs_column(values.size(),
                                std::move(scanned_children),
                                values.null_count(),
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+std::unique_ptr<groupby_aggregation> clone_aggregation(groupby_aggregation const& agg)
+{
+  return std::unique_ptr<groupby_aggregation>(
+    dynamic_cast<groupby_aggregation*>(agg.clone().release()));
+}
+
+/**
+ * @brief Returns the aggregations of the values of a batch whose results are the partial results
+ * of `agg` for the groups of the batch
+ */
+std::vector<std::unique_ptr<groupby_aggregation>> make_partial_aggregations(
+  groupby_aggregation const& agg)
+{
+  std::vector<std::unique_ptr<groupby_aggregation>> aggs;
+  switch (agg.kind) {
+    case aggregation::MEAN:
+      aggs.push_back(make_sum_aggregation<groupby_aggregation>());
+      aggs.push_back(make_count_aggregation<groupby_aggregation>());
+      break;
+    case aggregation::M2:
+      // The input of MERGE_M2
+      aggs.push_back(make_count_aggregation<groupby_aggregation>());
+      aggs.push_back(make_mean_aggregation<groupby_aggregation>());
+      aggs.push_back(make_m2_aggregation<groupby_aggregation>());
+      break;
+    default: aggs.push_back(clone_aggregation(agg));
+  }
+  return aggs;
+}
+
+/**
+ * @brief Returns the aggregation that merges the partial results of `agg` of several groups
+ *
+ * @throws std::invalid_argument if `agg` is not supported by streaming groupby
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(groupby_aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::MEAN: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    case aggregation::M2: return make_merge_m2_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_LIST: return make_merge_lists_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_SET: {
+      auto const& set_agg = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      return make_merge_sets_aggregation<groupby_aggregation>(set_agg._nulls_equal,
+                                                              set_agg._nans_equal);
+    }
+    case aggregation::TDIGEST: {
+      auto const& tdigest_agg = dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg);
+      return make_merge_tdigest_aggregation<groupby_aggregation>(tdigest_agg.max_centroids);
+    }
+    case aggregation::HLLPP: {
+      auto const& hllpp_agg = dynamic_cast<cudf::detail::hllpp_aggregation const&>(agg);
+      return make_merge_hllpp_aggregation<groupby_aggregation>(hllpp_agg.precision);
+    }
+    default:
+      CUDF_FAIL("Unsupported aggregation for streaming groupby", std::invalid_argument);
+  }
+}
+
+/**
+ * @brief Converts the results of the partial aggregations of `agg` of a batch into the partial
+ * results of `agg`
+ *
+ * The partial results have the types of the results of their merge aggregation, so that the
+ * partial results of the batch and of the previous batches have the same types.
+ */
+std::unique_ptr<table> make_partial_results(groupby_aggregation const& agg,
+                                            std::vector<std::unique_ptr<column>>&& results,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  if (agg.kind == aggregation::M2) {
+    auto const num_rows = results.front()->size();
+    std::vector<std::unique_ptr<column>> partial_results;
+    partial_results.push_back(make_structs_column(num_rows, std::move(results), 0, {}, stream, mr));
+    return std::make_unique<table>(std::move(partial_results));
+  }
+
+  // Integral SUM and PRODUCT results, e.g. the merged counts, are 64-bit integers
+  auto const merge_kind = make_merge_aggregation(agg)->kind;
+  for (auto& result : results) {
+    auto const merged_type = cudf::detail::target_type(result->type(), merge_kind);
+    if ((merge_kind == aggregation::SUM or merge_kind == aggregation::PRODUCT) and
+        merged_type != result->type()) {
+      result = cudf::detail::cast(result->view(), merged_type, stream, mr);
+    }
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace
+
+streaming_groupby::~streaming_groupby() = default;
+
+streaming_groupby::streaming_groupby(
+  std::vector<std::unique_ptr<groupby_aggregation>>&& aggregations, null_policy include_null_keys)
+  : _aggregations{std::move(aggregations)}, _include_null_keys{include_null_keys}
+{
+  // Throws for the unsupported aggregations
+  for (auto const& agg : _aggregations) {
+    make_merge_aggregation(*agg);
+  }
+}
+
+void streaming_groupby::update(table_view const& keys,
+                               table_view const& values,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Mismatch in number of rows of the keys and values of the batch");
+  CUDF_EXPECTS(values.num_columns() == static_cast<size_type>(_aggregations.size()),
+               "Mismatch in number of columns of the values and aggregations");
+  if (_keys != nullptr and keys.num_rows() == 0) { return; }
+
+  auto const mr = rmm::mr::get_current_device_resource();
+
+  // Aggregate the batch into the partial results of its groups
+  std::vector<aggregation_request> requests(_aggregations.size());
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    requests[i].values       = values.column(i);
+    requests[i].aggregations = make_partial_aggregations(*_aggregations[i]);
+  }
+  auto [batch_keys, batch_results] =
+    groupby{keys, _include_null_keys}.aggregate(requests, stream, mr);
+
+  std::vector<std::unique_ptr<table>> batch_partial_results;
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    batch_partial_results.push_back(
+      make_partial_results(*_aggregations[i], std::move(batch_results[i].results), stream, mr));
+  }
+
+  if (_keys == nullptr) {
+    for (auto const& col : values) {
+      _value_types.push_back(cudf::is_dictionary(col.type())
+                               ? cudf::dictionary_column_view(col).keys().type()
+                               : col.type());
+    }
+    _keys            = std::move(batch_keys);
+    _partial_results = std::move(batch_partial_results);
+    return;
+  }
+
+  // Merge the partial results of the groups of the batch with those of the previous batches. Only
+  // the groups are aggregated again, never the rows of the previous batches.
+  auto const all_keys = cudf::detail::concatenate(
+    std::vector<table_view>{_keys->view(), batch_keys->view()}, stream, mr);
+
+  std::vector<std::unique_ptr<column>> all_partial_results;
+  std::vector<aggregation_request> merge_requests;
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    for (size_type j = 0; j < _partial_results[i]->num_columns(); ++j) {
+      all_partial_results.push_back(cudf::detail::concatenate(
+        std::vector<column_view>{_partial_results[i]->get_column(j),
+                                 batch_partial_results[i]->get_column(j)},
+        stream,
+        mr));
+      merge_requests.emplace_back();
+      merge_requests.back().values = all_partial_results.back()->view();
+      merge_requests.back().aggregations.push_back(make_merge_aggregation(*_aggregations[i]));
+    }
+  }
+  auto [merged_keys, merged_results] =
+    groupby{all_keys->view(), _include_null_keys}.aggregate(merge_requests, stream, mr);
+
+  auto merged_result = merged_results.begin();
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    std::vector<std::unique_ptr<column>> partial_results;
+    for (size_type j = 0; j < _partial_results[i]->num_columns(); ++j, ++merged_result) {
+      partial_results.push_back(std::move(merged_result->results.front()));
+    }
+    _partial_results[i] = std::make_unique<table>(std::move(partial_results));
+  }
+  _keys = std::move(merged_keys);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> streaming_groupby::results(
+  rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "No batch has been aggregated by the streaming groupby");
+
+  std::vector<std::unique_ptr<column>> results;
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    auto const partial_results = _partial_results[i]->view();
+    switch (_aggregations[i]->kind) {
+      case aggregation::COUNT_VALID:
+      case aggregation::COUNT_ALL:
+        results.push_back(cudf::detail::cast(
+          partial_results.column(0), data_type{type_to_id<size_type>()}, stream, mr));
+        break;
+      case aggregation::MEAN: {
+        auto const counts = cudf::detail::cast(partial_results.column(1),
+                                               data_type{type_to_id<size_type>()},
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+        results.push_back(cudf::detail::binary_operation(
+          partial_results.column(0),
+          counts->view(),
+          binary_operator::DIV,
+          cudf::detail::target_type(_value_types[i], aggregation::MEAN),
+          stream,
+          mr));
+        break;
+      }
+      case aggregation::M2:
+        results.push_back(std::make_unique<column>(
+          structs_column_view{partial_results.column(0)}.get_sliced_child(2, stream), stream, mr));
+        break;
+      default: results.push_back(std::make_unique<column>(partial_results.column(0), stream, mr));
+    }
+  }
+  return std::pair(std::make_unique<table>(_keys->view(), stream, mr), std::move(results));
+}
+
+size_type streaming_groupby::num_groups() const
+{
+  return _keys == nullptr ? 0 : _keys->num_rows();
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+/**
+ * @brief Returns true if the row hashes of `input` can be computed one column at a time
+ *
+ * This is the case when every column is fixed-width.
+ */
+inline bool is_fixed_width_row_hashable(table_view const& input)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+    return cudf::is_fixed_width(col.type());
+  });
+}
+
+/**
+ * @brief Updates the running hash of each row with the elements of one column
+ *
+ * @tparam T Type of the elements of the column
+ * @tparam HashValue Type of the hash values
+ * @tparam HashStep Functor returning the new hash of a row from its running hash and either a
+ *         valid element, through `operator()(hash, element)`, or a null, through `null(hash)`
+ */
+template <typename T, typename HashValue, typename HashStep>
+struct fixed_width_column_hash_fn {
+  table_device_view input;
+  size_type column_index;
+  HashValue* hashes;
+  HashStep step;
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const& col = input.column(column_index);
+    hashes[idx] =
+      col.is_null(idx) ? step.null(hashes[idx]) : step(hashes[idx], col.element<T>(idx));
+  }
+};
+
+/**
+ * @brief Type dispatched functor hashing one column into the running row hashes
+ */
+template <typename HashValue, typename HashStep>
+struct hash_fixed_width_column_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void operator()(table_device_view const& input,
+                  size_type column_index,
+                  HashValue* hashes,
+                  HashStep step,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.num_rows(),
+      fixed_width_column_hash_fn<T, HashValue, HashStep>{input, column_index, hashes, step});
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Only fixed-width columns can be hashed one column at a time");
+  }
+};
+
+/**
+ * @brief Computes the hash of each row of a table of fixed-width columns
+ *
+ * The generic row hashers dispatch on the type of every element of every row. Here the type of
+ * each column is dispatched once on the host and the running hash of every row is updated with
+ * that column in one pass, so each pass reads one column with coalesced loads.
+ *
+ * Each row hash starts from `seed` and is updated with the columns from first to last, which
+ * gives the same result as a row hasher accumulating the element hashes of a row.
+ *
+ * @tparam IdTypeMap Maps the type of a column to the type used to read and hash its elements
+ * @tparam HashValue Type of the hash values
+ * @tparam HashStep Functor updating the running hash of a row with one element
+ *
+ * @param input Table of fixed-width columns
+ * @param seed Initial hash of every row
+ * @param step Functor updating the running hash of a row with one element
+ * @param hashes Output hash of each row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <template <cudf::type_id> typename IdTypeMap, typename HashValue, typename HashStep>
+void hash_fixed_width_rows(table_view const& input,
+                           HashValue seed,
+                           HashStep step,
+                           HashValue* hashes,
+                           rmm::cuda_stream_view stream)
+{
+  thrust::fill_n(rmm::exec_policy_nosync(stream), hashes, input.num_rows(), seed);
+
+  auto const d_input = table_device_view::create(input, stream);
+  for (size_type idx = 0; idx < input.num_columns(); ++idx) {
+    cudf::type_dispatcher<IdTypeMap>(input.column(idx).type(),
+                                     hash_fixed_width_column_fn<HashValue, HashStep>{},
+                                     *d_input,
+                                     idx,
+                                     hashes,
+                                     step,
+                                     stream);
+  }
+}
+
+}  // namespace detail
+}  // namespace hashing
+}  // namespace cudf
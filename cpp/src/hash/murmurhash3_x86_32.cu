@@ -13,6 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
+#include "fixed_width_row_hash.cuh"
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -27,10 +30,34 @@
 
 #include <thrust/tabulate.h>
 
+#include <limits>
+
 namespace cudf {
 namespace hashing {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Combines the running hash of a row with the hash of one of its elements
+ */
+struct murmurhash3_x86_32_step {
+  uint32_t seed;
+
+  template <typename T>
+  __device__ hash_value_type operator()(hash_value_type hash, T const& value) const
+  {
+    return hash_combine(hash, MurmurHash3_x86_32<T>{seed}(value));
+  }
+
+  __device__ hash_value_type null(hash_value_type hash) const
+  {
+    return hash_combine(hash, std::numeric_limits<hash_value_type>::max());
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> murmurhash3_x86_32(table_view const& input,
                                            uint32_t seed,
                                            rmm::cuda_stream_view stream,
@@ -45,6 +72,16 @@ std::unique_ptr<column> murmurhash3_x86_32(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
+  // Fixed-width columns are hashed one column at a time without per-element dispatch
+  if (is_fixed_width_row_hashable(input)) {
+    hash_fixed_width_rows<dispatch_storage_type>(input,
+                                                 hash_value_type{seed},
+                                                 murmurhash3_x86_32_step{seed},
+                                                 output->mutable_view().data<hash_value_type>(),
+                                                 stream);
+    return output;
+  }
+
   bool const nullable   = has_nulls(input);
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
   auto output_view      = output->mutable_view();
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+/// Rows hashing fewer string bytes than this are hashed in their own order
+constexpr int64_t long_row_min_bytes = 1024;
+
+/**
+ * @brief Functor returning the number of string bytes hashed for a row
+ */
+struct row_string_bytes_fn {
+  table_device_view strings;  ///< the string columns of the hashed table
+
+  __device__ int64_t operator()(size_type row_index) const
+  {
+    int64_t bytes = 0;
+    for (auto const& col : strings) {
+      if (col.is_valid(row_index)) { bytes += col.element<string_view>(row_index).size_bytes(); }
+    }
+    return bytes;
+  }
+};
+
+/**
+ * @brief Returns the order in which the rows of `input` are hashed by the cryptographic hashes
+ *
+ * These hashes process the bytes of a row sequentially in one thread. When a few rows hold
+ * long strings, the threads hashing them keep their whole warps busy long after the other
+ * rows of those warps are done. Hashing the rows from the most to the fewest string bytes
+ * gives each warp rows of similar lengths and starts the longest rows first.
+ *
+ * @param input The table to hash
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The rows ordered from the most to the fewest string bytes, or an empty vector when
+ *         no row holds at least `long_row_min_bytes` string bytes
+ */
+inline rmm::device_uvector<size_type> long_rows_first_order(table_view const& input,
+                                                            rmm::cuda_stream_view stream)
+{
+  std::vector<column_view> strings;
+  std::copy_if(input.begin(), input.end(), std::back_inserter(strings), [](auto const& col) {
+    return col.type().id() == type_id::STRING;
+  });
+  if (strings.empty() || input.num_rows() == 0) {
+    return rmm::device_uvector<size_type>(0, stream);
+  }
+
+  auto const d_strings = table_device_view::create(table_view{strings}, stream);
+  rmm::device_uvector<int64_t> row_bytes(input.num_rows(), stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.num_rows()),
+                    row_bytes.begin(),
+                    row_string_bytes_fn{*d_strings});
+
+  auto const max_bytes = thrust::reduce(rmm::exec_policy(stream),
+                                        row_bytes.begin(),
+                                        row_bytes.end(),
+                                        int64_t{0},
+                                        thrust::maximum<int64_t>{});
+  if (max_bytes < long_row_min_bytes) { return rmm::device_uvector<size_type>(0, stream); }
+
+  rmm::device_uvector<size_type> order(input.num_rows(), stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), order.begin(), order.end());
+  thrust::sort_by_key(rmm::exec_policy_nosync(stream),
+                      row_bytes.begin(),
+                      row_bytes.end(),
+                      order.begin(),
+                      thrust::greater<int64_t>{});
+  return order;
+}
+
+}  // namespace detail
+}  // namespace hashing
+}  // namespace cudf
@@ -13,6 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
+#include "row_order.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -524,13 +527,15 @@ std::unique_ptr<column> sha_hash(table_view const& input,
   auto d_chars = chars.data();
 
   auto const device_input = table_device_view::create(input, stream);
+  auto const row_order    = long_rows_first_order(input, stream);
 
   // Hash each row, hashing each element sequentially left to right
   thrust::for_each(
     rmm::exec_policy(stream),
     thrust::make_counting_iterator(0),
     thrust::make_counting_iterator(input.num_rows()),
-    [d_chars, device_input = *device_input] __device__(auto row_index) {
+    [d_chars, device_input = *device_input, d_order = row_order.data()] __device__(auto idx) {
+      auto const row_index = d_order == nullptr ? idx : d_order[idx];
       Hasher hasher(d_chars + (static_cast<int64_t>(row_index) * Hasher::digest_size));
       for (auto const& col : device_input) {
         if (col.is_valid(row_index)) {
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixed_width_row_hash.cuh"
+#include "xxhash3.cuh"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/algorithm.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/table/table_device_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <limits>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Computes the XXH3 hash value of a row in the given table.
+ *
+ * Each column is hashed with the (low 64 bits of the) hash of the previous columns as seed.
+ *
+ * @tparam Bytes Hash of a byte sequence: `xxh3_64_bytes` or `xxh3_128_bytes`
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
+ */
+template <typename Bytes, typename Nullate>
+class xxhash3_device_row_hasher {
+ public:
+  using result_type = typename Bytes::result_type;
+
+  xxhash3_device_row_hasher(Nullate nulls, table_device_view const& t, uint64_t seed)
+    : _check_nulls(nulls), _table(t), _seed(seed)
+  {
+  }
+
+  __device__ result_type operator()(size_type row_index) const noexcept
+  {
+    return cudf::detail::accumulate(
+      _table.begin(),
+      _table.end(),
+      make_hash(_seed),
+      [row_index, nulls = _check_nulls] __device__(auto hash, auto column) {
+        return cudf::type_dispatcher(
+          column.type(), element_hasher_adapter{}, column, row_index, nulls, seed_of(hash));
+      });
+  }
+
+  /**
+   * @brief Computes the hash value of an element in the given column.
+   */
+  class element_hasher_adapter {
+   public:
+    template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+    __device__ result_type operator()(column_device_view const& col,
+                                      size_type const row_index,
+                                      Nullate const _check_nulls,
+                                      uint64_t const _seed) const noexcept
+    {
+      if (_check_nulls && col.is_null(row_index)) {
+        return make_hash(std::numeric_limits<uint64_t>::max());
+      }
+      return XXHash3<T, Bytes>{_seed}(col.element<T>(row_index));
+    }
+
+    template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+    __device__ result_type operator()(column_device_view const&,
+                                      size_type const,
+                                      Nullate const,
+                                      uint64_t const) const noexcept
+    {
+      CUDF_UNREACHABLE("Unsupported type for XXHash3");
+    }
+  };
+
+ private:
+  /// Returns the hash with every 64-bit word set to `value`
+  __device__ static result_type make_hash(uint64_t value)
+  {
+    if constexpr (std::is_same_v<result_type, uint64_t>) {
+      return value;
+    } else {
+      return {value, value};
+    }
+  }
+
+  /// Returns the seed used to hash the next column
+  __device__ static uint64_t seed_of(result_type hash)
+  {
+    if constexpr (std::is_same_v<result_type, uint64_t>) {
+      return hash;
+    } else {
+      return hash.first;
+    }
+  }
+
+  Nullate const _check_nulls;
+  table_device_view const _table;
+  uint64_t const _seed;
+};
+
+/**
+ * @brief Writes the low and high 64 bits of the XXH3 128-bit hash of each row
+ */
+template <typename Nullate>
+struct xxhash3_128_row_fn {
+  xxhash3_device_row_hasher<xxh3_128_bytes, Nullate> hasher;
+  uint64_t* d_low;
+  uint64_t* d_high;
+
+  __device__ void operator()(size_type row_index) const noexcept
+  {
+    auto const h      = hasher(row_index);
+    d_low[row_index]  = h.first;
+    d_high[row_index] = h.second;
+  }
+};
+
+/**
+ * @brief Hashes one element of a row seeded with the running hash of the row
+ */
+struct xxhash3_64_step {
+  template <typename T>
+  __device__ uint64_t operator()(uint64_t hash, T const& value) const
+  {
+    return XXHash3_64<T>{hash}(value);
+  }
+
+  __device__ uint64_t null(uint64_t) const { return std::numeric_limits<uint64_t>::max(); }
+};
+
+}  // namespace
+
+std::unique_ptr<column> xxhash3_64(table_view const& input,
+                                   uint64_t seed,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  auto d_output = output->mutable_view().data<uint64_t>();
+
+  // Fixed-width columns are hashed one column at a time without per-element dispatch
+  if (is_fixed_width_row_hashable(input)) {
+    hash_fixed_width_rows<id_to_type_impl>(input, seed, xxhash3_64_step{}, d_output, stream);
+    return output;
+  }
+
+  bool const nullable   = has_nulls(input);
+  auto const input_view = table_device_view::create(input, stream);
+
+  // Compute the hash value for each row
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    d_output,
+    d_output + input.num_rows(),
+    xxhash3_device_row_hasher<xxh3_64_bytes, nullate::DYNAMIC>(
+      nullate::DYNAMIC{nullable}, *input_view, seed));
+
+  return output;
+}
+
+std::unique_ptr<table> xxhash3_128(table_view const& input,
+                                   uint64_t seed,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto low = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto high = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() > 0 && input.num_rows() > 0) {
+    bool const nullable   = has_nulls(input);
+    auto const input_view = table_device_view::create(input, stream);
+
+    // Compute the hash value for each row
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::counting_iterator<size_type>(0),
+      input.num_rows(),
+      xxhash3_128_row_fn<nullate::DYNAMIC>{
+        {nullate::DYNAMIC{nullable}, *input_view, seed},
+        low->mutable_view().data<uint64_t>(),
+        high->mutable_view().data<uint64_t>()});
+  }
+
+  std::vector<std::unique_ptr<column>> out_columns(2);
+  out_columns.front() = std::move(low);
+  out_columns.back()  = std::move(high);
+  return std::make_unique<table>(std::move(out_columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> xxhash3_64(table_view const& input,
+                                   uint64_t seed,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::xxhash3_64(input, seed, stream, mr);
+}
+
+std::unique_ptr<table> xxhash3_128(table_view const& input,
+                                   uint64_t seed,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::xxhash3_128(input, seed, stream, mr);
+}
+
+}  // namespace hashing
+}  // namespace cudf
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/hashing/detail/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <thrust/pair.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace cudf::hashing::detail {
+
+// XXH3 implementation from
+// https://github.com/Cyan4973/xxHash
+// The scalar code path of the reference implementation is used since each thread hashes
+// its own key; the results match XXH3_64bits_withSeed and XXH3_128bits_withSeed.
+
+/// Size in bytes of the default XXH3 secret
+constexpr std::size_t xxh3_secret_size = 192;
+
+/// The default XXH3 secret
+const __constant__ uint8_t xxh3_default_secret[xxh3_secret_size] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+/**
+ * @brief Building blocks shared by the 64-bit and 128-bit XXH3 hashes
+ */
+struct xxh3_base {
+  static constexpr uint32_t prime32_1 = 0x9e3779b1u;
+  static constexpr uint32_t prime32_2 = 0x85ebca77u;
+  static constexpr uint32_t prime32_3 = 0xc2b2ae3du;
+  static constexpr uint64_t prime64_1 = 0x9e3779b185ebca87ul;
+  static constexpr uint64_t prime64_2 = 0xc2b2ae3d27d4eb4ful;
+  static constexpr uint64_t prime64_3 = 0x165667b19e3779f9ul;
+  static constexpr uint64_t prime64_4 = 0x85ebca77c2b2ae63ul;
+  static constexpr uint64_t prime64_5 = 0x27d4eb2f165667c5ul;
+  static constexpr uint64_t prime_mx1 = 0x165667919e3779f9ul;
+  static constexpr uint64_t prime_mx2 = 0x9fb21c651e98df25ul;
+
+  static constexpr std::size_t stripe_len          = 64;
+  static constexpr std::size_t secret_consume_rate = 8;
+  static constexpr std::size_t secret_size_min     = 136;
+  static constexpr std::size_t midsize_startoffset = 3;
+  static constexpr std::size_t midsize_lastoffset  = 17;
+  static constexpr std::size_t secret_lastacc      = 7;
+  static constexpr std::size_t secret_mergeaccs    = 11;
+  static constexpr std::size_t num_accumulators    = 8;
+
+  /// Low and high 64 bits of a 128-bit value
+  using uint128 = thrust::pair<uint64_t, uint64_t>;
+
+  // Inputs are read one byte at a time for safe unaligned access.
+  __device__ static inline uint32_t read32(uint8_t const* p)
+  {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  __device__ static inline uint64_t read64(uint8_t const* p)
+  {
+    return static_cast<uint64_t>(read32(p)) | (static_cast<uint64_t>(read32(p + 4)) << 32);
+  }
+
+  __device__ static inline uint32_t swap32(uint32_t x)
+  {
+    return ((x << 24) & 0xff000000u) | ((x << 8) & 0x00ff0000u) | ((x >> 8) & 0x0000ff00u) |
+           ((x >> 24) & 0x000000ffu);
+  }
+
+  __device__ static inline uint64_t swap64(uint64_t x)
+  {
+    return (static_cast<uint64_t>(swap32(static_cast<uint32_t>(x))) << 32) |
+           swap32(static_cast<uint32_t>(x >> 32));
+  }
+
+  __device__ static inline uint128 mult64to128(uint64_t lhs, uint64_t rhs)
+  {
+    auto const product = static_cast<__uint128_t>(lhs) * rhs;
+    return {static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64)};
+  }
+
+  __device__ static inline uint64_t mul128_fold64(uint64_t lhs, uint64_t rhs)
+  {
+    auto const product = mult64to128(lhs, rhs);
+    return product.first ^ product.second;
+  }
+
+  __device__ static inline uint64_t xxh64_avalanche(uint64_t h)
+  {
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  __device__ static inline uint64_t avalanche(uint64_t h)
+  {
+    h ^= h >> 37;
+    h *= prime_mx1;
+    h ^= h >> 32;
+    return h;
+  }
+
+  __device__ static inline uint64_t rrmxmx(uint64_t h, uint64_t len)
+  {
+    h ^= rotate_bits_left(h, 49) ^ rotate_bits_left(h, 24);
+    h *= prime_mx2;
+    h ^= (h >> 35) + len;
+    h *= prime_mx2;
+    h ^= h >> 28;
+    return h;
+  }
+
+  __device__ static inline uint64_t mix16B(uint8_t const* input,
+                                           uint8_t const* secret,
+                                           uint64_t seed)
+  {
+    return mul128_fold64(read64(input) ^ (read64(secret) + seed),
+                         read64(input + 8) ^ (read64(secret + 8) - seed));
+  }
+
+  __device__ static inline void accumulate_512(uint64_t* acc,
+                                               uint8_t const* input,
+                                               uint8_t const* secret)
+  {
+    for (std::size_t i = 0; i < num_accumulators; ++i) {
+      auto const data_val = read64(input + 8 * i);
+      auto const data_key = data_val ^ read64(secret + 8 * i);
+      acc[i ^ 1] += data_val;
+      acc[i] += static_cast<uint64_t>(static_cast<uint32_t>(data_key)) * (data_key >> 32);
+    }
+  }
+
+  __device__ static inline void scramble_acc(uint64_t* acc, uint8_t const* secret)
+  {
+    for (std::size_t i = 0; i < num_accumulators; ++i) {
+      auto a = acc[i];
+      a ^= a >> 47;
+      a ^= read64(secret + 8 * i);
+      a *= prime32_1;
+      acc[i] = a;
+    }
+  }
+
+  __device__ static inline uint64_t merge_accs(uint64_t const* acc,
+                                               uint8_t const* secret,
+                                               uint64_t start)
+  {
+    auto result = start;
+    for (std::size_t i = 0; i < 4; ++i) {
+      result += mul128_fold64(acc[2 * i] ^ read64(secret + 16 * i),
+                              acc[2 * i + 1] ^ read64(secret + 16 * i + 8));
+    }
+    return avalanche(result);
+  }
+
+  /**
+   * @brief Derives the secret used to hash inputs longer than 240 bytes with `seed`
+   */
+  __device__ static inline void init_custom_secret(uint8_t* secret, uint64_t seed)
+  {
+    for (std::size_t i = 0; i < xxh3_secret_size / 16; ++i) {
+      auto const lo = read64(xxh3_default_secret + 16 * i) + seed;
+      auto const hi = read64(xxh3_default_secret + 16 * i + 8) - seed;
+      for (std::size_t b = 0; b < 8; ++b) {
+        secret[16 * i + b]     = static_cast<uint8_t>(lo >> (8 * b));
+        secret[16 * i + 8 + b] = static_cast<uint8_t>(hi >> (8 * b));
+      }
+    }
+  }
+
+  /**
+   * @brief Runs the accumulation loop over an input longer than 240 bytes
+   */
+  __device__ static inline void hash_long_accumulate(uint64_t* acc,
+                                                     uint8_t const* input,
+                                                     std::size_t len,
+                                                     uint8_t const* secret)
+  {
+    acc[0] = prime32_3;
+    acc[1] = prime64_1;
+    acc[2] = prime64_2;
+    acc[3] = prime64_3;
+    acc[4] = prime64_4;
+    acc[5] = prime32_2;
+    acc[6] = prime64_5;
+    acc[7] = prime32_1;
+
+    auto constexpr stripes_per_block = (xxh3_secret_size - stripe_len) / secret_consume_rate;
+    auto constexpr block_len         = stripe_len * stripes_per_block;
+    auto const num_blocks            = (len - 1) / block_len;
+
+    for (std::size_t n = 0; n < num_blocks; ++n) {
+      for (std::size_t s = 0; s < stripes_per_block; ++s) {
+        accumulate_512(
+          acc, input + n * block_len + s * stripe_len, secret + s * secret_consume_rate);
+      }
+      scramble_acc(acc, secret + xxh3_secret_size - stripe_len);
+    }
+
+    // last partial block
+    auto const num_stripes = ((len - 1) - (block_len * num_blocks)) / stripe_len;
+    for (std::size_t s = 0; s < num_stripes; ++s) {
+      accumulate_512(
+        acc, input + num_blocks * block_len + s * stripe_len, secret + s * secret_consume_rate);
+    }
+
+    // last stripe
+    accumulate_512(
+      acc, input + len - stripe_len, secret + xxh3_secret_size - stripe_len - secret_lastacc);
+  }
+};
+
+/**
+ * @brief The XXH3 64-bit hash of a byte sequence
+ */
+struct xxh3_64_bytes : xxh3_base {
+  using result_type = uint64_t;
+
+  __device__ static uint64_t hash_0to16(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret = xxh3_default_secret;
+    if (len > 8) {
+      auto const bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+      auto const bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+      auto const input_lo = read64(input) ^ bitflip1;
+      auto const input_hi = read64(input + len - 8) ^ bitflip2;
+      auto const acc = len + swap64(input_lo) + input_hi + mul128_fold64(input_lo, input_hi);
+      return avalanche(acc);
+    }
+    if (len >= 4) {
+      seed ^= static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32;
+      auto const input1  = read32(input);
+      auto const input2  = read32(input + len - 4);
+      auto const bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+      auto const input64 = input2 + (static_cast<uint64_t>(input1) << 32);
+      return rrmxmx(input64 ^ bitflip, len);
+    }
+    if (len > 0) {
+      auto const c1       = static_cast<uint32_t>(input[0]);
+      auto const c2       = static_cast<uint32_t>(input[len >> 1]);
+      auto const c3       = static_cast<uint32_t>(input[len - 1]);
+      auto const combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<uint32_t>(len) << 8);
+      auto const bitflip  = static_cast<uint64_t>(read32(secret) ^ read32(secret + 4)) + seed;
+      return xxh64_avalanche(static_cast<uint64_t>(combined) ^ bitflip);
+    }
+    return xxh64_avalanche(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+  }
+
+  __device__ static uint64_t hash_17to128(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret = xxh3_default_secret;
+    uint64_t acc      = len * prime64_1;
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) {
+          acc += mix16B(input + 48, secret + 96, seed);
+          acc += mix16B(input + len - 64, secret + 112, seed);
+        }
+        acc += mix16B(input + 32, secret + 64, seed);
+        acc += mix16B(input + len - 48, secret + 80, seed);
+      }
+      acc += mix16B(input + 16, secret + 32, seed);
+      acc += mix16B(input + len - 32, secret + 48, seed);
+    }
+    acc += mix16B(input, secret, seed);
+    acc += mix16B(input + len - 16, secret + 16, seed);
+    return avalanche(acc);
+  }
+
+  __device__ static uint64_t hash_129to240(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret     = xxh3_default_secret;
+    uint64_t acc          = len * prime64_1;
+    auto const num_rounds = len / 16;
+    for (std::size_t i = 0; i < 8; ++i) {
+      acc += mix16B(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = avalanche(acc);
+    for (std::size_t i = 8; i < num_rounds; ++i) {
+      acc += mix16B(input + 16 * i, secret + 16 * (i - 8) + midsize_startoffset, seed);
+    }
+    // last bytes
+    acc += mix16B(input + len - 16, secret + secret_size_min - midsize_lastoffset, seed);
+    return avalanche(acc);
+  }
+
+  __device__ static uint64_t hash_long(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    uint8_t secret[xxh3_secret_size];
+    init_custom_secret(secret, seed);
+    uint64_t acc[num_accumulators];
+    hash_long_accumulate(acc, input, len, secret);
+    return merge_accs(acc, secret + secret_mergeaccs, len * prime64_1);
+  }
+
+  __device__ static uint64_t hash(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    if (len <= 16) { return hash_0to16(input, len, seed); }
+    if (len <= 128) { return hash_17to128(input, len, seed); }
+    if (len <= 240) { return hash_129to240(input, len, seed); }
+    return hash_long(input, len, seed);
+  }
+};
+
+/**
+ * @brief The XXH3 128-bit hash of a byte sequence
+ *
+ * The result holds the low 64 bits first.
+ */
+struct xxh3_128_bytes : xxh3_base {
+  using result_type = uint128;
+
+  __device__ static uint128 mix32B(uint128 acc,
+                                   uint8_t const* input_1,
+                                   uint8_t const* input_2,
+                                   uint8_t const* secret,
+                                   uint64_t seed)
+  {
+    acc.first += mix16B(input_1, secret, seed);
+    acc.first ^= read64(input_2) + read64(input_2 + 8);
+    acc.second += mix16B(input_2, secret + 16, seed);
+    acc.second ^= read64(input_1) + read64(input_1 + 8);
+    return acc;
+  }
+
+  __device__ static uint128 hash_0to16(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret = xxh3_default_secret;
+    if (len > 8) {
+      auto const bitflipl = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+      auto const bitfliph = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+      auto const input_lo = read64(input);
+      auto input_hi       = read64(input + len - 8);
+      auto m128           = mult64to128(input_lo ^ input_hi ^ bitflipl, prime64_1);
+      m128.first += static_cast<uint64_t>(len - 1) << 54;
+      input_hi ^= bitfliph;
+      m128.second += input_hi + static_cast<uint64_t>(static_cast<uint32_t>(input_hi)) *
+                                  static_cast<uint64_t>(prime32_2 - 1);
+      m128.first ^= swap64(m128.second);
+      auto h128 = mult64to128(m128.first, prime64_2);
+      h128.second += m128.second * prime64_2;
+      return {avalanche(h128.first), avalanche(h128.second)};
+    }
+    if (len >= 4) {
+      seed ^= static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32;
+      auto const input_lo = read32(input);
+      auto const input_hi = read32(input + len - 4);
+      auto const input_64 = input_lo + (static_cast<uint64_t>(input_hi) << 32);
+      auto const bitflip  = (read64(secret + 16) ^ read64(secret + 24)) + seed;
+      auto const keyed    = input_64 ^ bitflip;
+      // shift len to the left to ensure it is even, this avoids even multiplies
+      auto m128 = mult64to128(keyed, prime64_1 + (len << 2));
+      m128.second += m128.first << 1;
+      m128.first ^= m128.second >> 3;
+      m128.first ^= m128.first >> 35;
+      m128.first *= prime_mx2;
+      m128.first ^= m128.first >> 28;
+      m128.second = avalanche(m128.second);
+      return m128;
+    }
+    if (len > 0) {
+      auto const c1        = static_cast<uint32_t>(input[0]);
+      auto const c2        = static_cast<uint32_t>(input[len >> 1]);
+      auto const c3        = static_cast<uint32_t>(input[len - 1]);
+      auto const combinedl = (c1 << 16) | (c2 << 24) | c3 | (static_cast<uint32_t>(len) << 8);
+      auto const combinedh = rotate_bits_left(swap32(combinedl), 13);
+      auto const bitflipl  = static_cast<uint64_t>(read32(secret) ^ read32(secret + 4)) + seed;
+      auto const bitfliph =
+        static_cast<uint64_t>(read32(secret + 8) ^ read32(secret + 12)) - seed;
+      return {xxh64_avalanche(static_cast<uint64_t>(combinedl) ^ bitflipl),
+              xxh64_avalanche(static_cast<uint64_t>(combinedh) ^ bitfliph)};
+    }
+    auto const bitflipl = read64(secret + 64) ^ read64(secret + 72);
+    auto const bitfliph = read64(secret + 80) ^ read64(secret + 88);
+    return {xxh64_avalanche(seed ^ bitflipl), xxh64_avalanche(seed ^ bitfliph)};
+  }
+
+  __device__ static uint128 finalize_midsize(uint128 acc, std::size_t len, uint64_t seed)
+  {
+    auto const low  = acc.first + acc.second;
+    auto const high =
+      (acc.first * prime64_1) + (acc.second * prime64_4) + ((len - seed) * prime64_2);
+    return {avalanche(low), uint64_t{0} - avalanche(high)};
+  }
+
+  __device__ static uint128 hash_17to128(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret = xxh3_default_secret;
+    uint128 acc{len * prime64_1, 0};
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) { acc = mix32B(acc, input + 48, input + len - 64, secret + 96, seed); }
+        acc = mix32B(acc, input + 32, input + len - 48, secret + 64, seed);
+      }
+      acc = mix32B(acc, input + 16, input + len - 32, secret + 32, seed);
+    }
+    acc = mix32B(acc, input, input + len - 16, secret, seed);
+    return finalize_midsize(acc, len, seed);
+  }
+
+  __device__ static uint128 hash_129to240(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    auto const secret     = xxh3_default_secret;
+    auto const num_rounds = len / 32;
+    uint128 acc{len * prime64_1, 0};
+    for (std::size_t i = 0; i < 4; ++i) {
+      acc = mix32B(acc, input + 32 * i, input + 32 * i + 16, secret + 32 * i, seed);
+    }
+    acc = {avalanche(acc.first), avalanche(acc.second)};
+    for (std::size_t i = 4; i < num_rounds; ++i) {
+      acc = mix32B(acc,
+                   input + 32 * i,
+                   input + 32 * i + 16,
+                   secret + midsize_startoffset + 32 * (i - 4),
+                   seed);
+    }
+    // last bytes
+    acc = mix32B(acc,
+                 input + len - 16,
+                 input + len - 32,
+                 secret + secret_size_min - midsize_lastoffset - 16,
+                 uint64_t{0} - seed);
+    return finalize_midsize(acc, len, seed);
+  }
+
+  __device__ static uint128 hash_long(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    uint8_t secret[xxh3_secret_size];
+    init_custom_secret(secret, seed);
+    uint64_t acc[num_accumulators];
+    hash_long_accumulate(acc, input, len, secret);
+    return {merge_accs(acc, secret + secret_mergeaccs, len * prime64_1),
+            merge_accs(acc,
+                       secret + xxh3_secret_size - sizeof(acc) - secret_mergeaccs,
+                       ~(len * prime64_2))};
+  }
+
+  __device__ static uint128 hash(uint8_t const* input, std::size_t len, uint64_t seed)
+  {
+    if (len <= 16) { return hash_0to16(input, len, seed); }
+    if (len <= 128) { return hash_17to128(input, len, seed); }
+    if (len <= 240) { return hash_129to240(input, len, seed); }
+    return hash_long(input, len, seed);
+  }
+};
+
+/**
+ * @brief XXH3 hash of a key
+ *
+ * Keys are hashed the same way as by `XXHash_64`: booleans as one byte, floating-point values
+ * with NaNs normalized, strings as their bytes and fixed-point values as their unscaled value.
+ *
+ * @tparam Key Type of the key
+ * @tparam Bytes Hash of a byte sequence: `xxh3_64_bytes` or `xxh3_128_bytes`
+ */
+template <typename Key, typename Bytes>
+struct XXHash3 {
+  using result_type = typename Bytes::result_type;
+
+  constexpr XXHash3() = default;
+  constexpr XXHash3(uint64_t seed) : m_seed(seed) {}
+
+  result_type __device__ inline operator()(Key const& key) const
+  {
+    if constexpr (std::is_same_v<Key, bool>) {
+      return compute(static_cast<uint8_t>(key));
+    } else if constexpr (std::is_floating_point_v<Key>) {
+      return compute(normalize_nans(key));
+    } else if constexpr (std::is_same_v<Key, cudf::string_view>) {
+      return Bytes::hash(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes(), m_seed);
+    } else if constexpr (cudf::is_fixed_point<Key>()) {
+      return compute(key.value());
+    } else {
+      return compute(key);
+    }
+  }
+
+ private:
+  template <typename T>
+  result_type __device__ inline compute(T const& key) const
+  {
+    return Bytes::hash(reinterpret_cast<uint8_t const*>(&key), sizeof(T), m_seed);
+  }
+
+  uint64_t m_seed{};
+};
+
+template <typename Key>
+using XXHash3_64 = XXHash3<Key, xxh3_64_bytes>;
+
+template <typename Key>
+using XXHash3_128 = XXHash3<Key, xxh3_128_bytes>;
+
+}  // namespace cudf::hashing::detail
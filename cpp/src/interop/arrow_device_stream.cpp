@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/interop/arrow_device_stream.hpp>
+#include <cudf/interop/detail/arrow.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <nanoarrow/nanoarrow.h>
+#include <nanoarrow/nanoarrow.hpp>
+
+#include <cerrno>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Build the `column_metadata` used by `to_arrow_schema` from the reader's name info
+ *
+ * The reader describes list columns with an "offsets" child ahead of the element child, while
+ * `to_arrow_schema` only expects the element, so the two hierarchies are walked together.
+ */
+column_metadata make_column_metadata(io::column_name_info const& info, column_view const& col)
+{
+  column_metadata meta{info.name};
+  if (col.type().id() == type_id::LIST) {
+    auto constexpr child_index = std::size_t{lists_column_view::child_column_index};
+    auto const child           = lists_column_view{col}.child();
+    meta.children_meta.push_back(info.children.size() > child_index
+                                   ? make_column_metadata(info.children[child_index], child)
+                                   : column_metadata{"element"});
+  } else if (col.type().id() == type_id::STRUCT) {
+    for (size_type i = 0; i < col.num_children(); ++i) {
+      meta.children_meta.push_back(static_cast<std::size_t>(i) < info.children.size()
+                                     ? make_column_metadata(info.children[i], col.child(i))
+                                     : column_metadata{std::to_string(i)});
+    }
+  }
+  return meta;
+}
+
+/**
+ * @brief State owned by an `ArrowDeviceArrayStream` produced from a chunked Parquet reader
+ */
+struct parquet_stream_state {
+  std::unique_ptr<io::chunked_parquet_reader> reader;
+  std::optional<io::table_with_metadata> pending;  ///< First chunk, read to derive the schema
+  unique_schema_t schema{nullptr, [](ArrowSchema*) {}};
+  std::string last_error;
+  rmm::cuda_stream_view stream;
+  rmm::device_async_resource_ref mr;
+
+  parquet_stream_state(std::unique_ptr<io::chunked_parquet_reader>&& reader,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+    : reader(std::move(reader)), stream(stream), mr(mr)
+  {
+    pending = this->reader->read_chunk();
+
+    auto const view = pending->tbl->view();
+    std::vector<column_metadata> metadata;
+    for (size_type i = 0; i < view.num_columns(); ++i) {
+      auto const& infos = pending->metadata.schema_info;
+      metadata.push_back(static_cast<std::size_t>(i) < infos.size()
+                           ? make_column_metadata(infos[i], view.column(i))
+                           : column_metadata{std::to_string(i)});
+    }
+    schema = to_arrow_schema(view, metadata);
+  }
+
+  /**
+   * @brief Produce the next batch, leaving `out->array.release` null at the end of the stream
+   */
+  void next(ArrowDeviceArray* out)
+  {
+    if (not pending.has_value()) {
+      if (not reader->has_next()) {
+        out->array.release = nullptr;
+        return;
+      }
+      pending = reader->read_chunk();
+    }
+    auto chunk = std::move(*pending);
+    pending.reset();
+
+    auto result = to_arrow_device(std::move(*chunk.tbl), stream, mr);
+    *out        = *result;
+    // ownership of the buffers now lives in `out`
+    result->array.release = nullptr;
+  }
+};
+
+/**
+ * @brief Run `fn` and translate any exception into an errno code and a stored message
+ */
+template <typename Fn>
+int capture_errors(ArrowDeviceArrayStream* self, Fn&& fn)
+{
+  auto* state = reinterpret_cast<parquet_stream_state*>(self->private_data);
+  try {
+    fn(*state);
+    state->last_error.clear();
+    return 0;
+  } catch (std::bad_alloc const& e) {
+    state->last_error = e.what();
+    return ENOMEM;
+  } catch (std::exception const& e) {
+    state->last_error = e.what();
+    return EIO;
+  }
+}
+
+int parquet_stream_get_schema(ArrowDeviceArrayStream* self, ArrowSchema* out)
+{
+  return capture_errors(self, [out](parquet_stream_state& state) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaDeepCopy(state.schema.get(), out));
+  });
+}
+
+int parquet_stream_get_next(ArrowDeviceArrayStream* self, ArrowDeviceArray* out)
+{
+  return capture_errors(self, [out](parquet_stream_state& state) { state.next(out); });
+}
+
+char const* parquet_stream_get_last_error(ArrowDeviceArrayStream* self)
+{
+  auto* state = reinterpret_cast<parquet_stream_state*>(self->private_data);
+  return state->last_error.empty() ? nullptr : state->last_error.c_str();
+}
+
+void parquet_stream_release(ArrowDeviceArrayStream* self)
+{
+  delete reinterpret_cast<parquet_stream_state*>(self->private_data);
+  self->private_data = nullptr;
+  self->release      = nullptr;
+}
+
+}  // namespace
+
+void to_arrow_device_stream(std::unique_ptr<io::chunked_parquet_reader> reader,
+                            ArrowDeviceArrayStream* out,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "reader must not be null", std::invalid_argument);
+  CUDF_EXPECTS(out != nullptr, "output stream must not be null", std::invalid_argument);
+
+  auto state = std::make_unique<parquet_stream_state>(std::move(reader), stream, mr);
+
+  out->device_type    = ARROW_DEVICE_CUDA;
+  out->get_schema     = &parquet_stream_get_schema;
+  out->get_next       = &parquet_stream_get_next;
+  out->get_last_error = &parquet_stream_get_last_error;
+  out->release        = &parquet_stream_release;
+  out->private_data   = state.release();
+}
+
+std::size_t write_arrow_device_stream(ArrowDeviceArrayStream* input,
+                                      io::parquet_chunked_writer& writer,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input != nullptr && input->release != nullptr,
+               "input stream must be valid",
+               std::invalid_argument);
+
+  auto const release_stream = [](ArrowDeviceArrayStream* s) {
+    if (s->release != nullptr) { s->release(s); }
+  };
+  auto owned_input = std::unique_ptr<ArrowDeviceArrayStream, decltype(release_stream)>(
+    input, release_stream);
+
+  auto const check = [input](int code, char const* what) {
+    if (code == 0) { return; }
+    auto const* error = input->get_last_error(input);
+    CUDF_FAIL(std::string{what} + ": " + (error != nullptr ? error : std::to_string(code)));
+  };
+
+  nanoarrow::UniqueSchema schema;
+  check(input->get_schema(input, schema.get()), "failed to get stream schema");
+
+  std::size_t num_rows = 0;
+  while (true) {
+    ArrowDeviceArray batch{};
+    check(input->get_next(input, &batch), "failed to get next stream batch");
+    if (batch.array.release == nullptr) { break; }
+
+    auto owned_batch = unique_device_array_t(new ArrowDeviceArray(batch), [](ArrowDeviceArray* a) {
+      if (a->array.release != nullptr) { ArrowArrayRelease(&a->array); }
+      delete a;
+    });
+
+    auto const view = from_arrow_device(schema.get(), owned_batch.get(), stream, mr);
+    // the writer runs on its own stream, so conversions queued on `stream` must finish first
+    stream.synchronize();
+    writer.write(*view);
+    num_rows += view->num_rows();
+  }
+  return num_rows;
+}
+
+}  // namespace cudf
@@ -30,6 +30,10 @@
 #include <dlpack/dlpack.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
 namespace cudf {
 namespace {
@@ -130,16 +134,22 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
+/**
+ * @brief Layout of the columns of a DLPack tensor which cudf can read
+ */
+struct dlpack_layout {
+  data_type dtype;
+  size_type num_rows;
+  size_type num_columns;
+  std::size_t column_stride_bytes;  ///< bytes between the first elements of consecutive columns
+};
 
-namespace detail {
-std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                   rmm::cuda_stream_view stream,
-                                   rmm::device_async_resource_ref mr)
+/**
+ * @brief Checks that the tensor holds 1D or 2D column-major data on a supported device and
+ * returns the layout of its columns
+ */
+dlpack_layout get_dlpack_layout(DLTensor const& tensor)
 {
-  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
-  auto const& tensor = managed_tensor->dl_tensor;
-
   // We can copy from host or device pointers
   CUDF_EXPECTS(tensor.device.device_type == kDLCPU || tensor.device.device_type == kDLCUDA ||
                  tensor.device.device_type == kDLCUDAHost,
@@ -185,27 +195,57 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                  "DLTensor second dim exceeds the column size limit",
                  std::overflow_error);
   }
-  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
+  auto const num_columns = (tensor.ndim == 2) ? static_cast<size_type>(tensor.shape[1]) : 1;
 
   // Validate and convert data type to cudf
   data_type const dtype = DLDataType_to_data_type(tensor.dtype);
 
-  size_t const byte_width = size_of(dtype);
-  auto const num_rows     = static_cast<size_t>(tensor.shape[0]);
-  size_t const bytes      = num_rows * byte_width;
+  std::size_t const byte_width = size_of(dtype);
+  auto const num_rows          = static_cast<size_type>(tensor.shape[0]);
 
   // For 2D tensors, if the strides pointer is not null, then strides[1] is the
   // number of elements (not bytes) between the start of each column
-  size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
-                              ? byte_width * tensor.strides[1]
-                              : byte_width * num_rows;
+  std::size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
+                                   ? byte_width * tensor.strides[1]
+                                   : byte_width * num_rows;
+
+  return {dtype, num_rows, num_columns, col_stride};
+}
+
+/**
+ * @brief Makes work later submitted to `consumer_stream` wait for the work submitted to `stream`
+ *
+ * This follows the DLPack stream semantics: the producer orders the consumer's stream after its
+ * own work instead of blocking the host.
+ */
+void order_consumer_stream(rmm::cuda_stream_view stream, rmm::cuda_stream_view consumer_stream)
+{
+  if (consumer_stream.value() == stream.value()) { return; }
+  cudaEvent_t event;
+  CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  CUDF_CUDA_TRY(cudaEventRecord(event, stream.value()));
+  CUDF_CUDA_TRY(cudaStreamWaitEvent(consumer_stream.value(), event, 0));
+  CUDF_CUDA_TRY(cudaEventDestroy(event));
+}
+
+}  // namespace
+
+namespace detail {
+std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+  auto const layout  = get_dlpack_layout(tensor);
+  auto const bytes   = static_cast<std::size_t>(layout.num_rows) * size_of(layout.dtype);
 
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
 
   // Allocate columns and copy data from tensor
-  std::vector<std::unique_ptr<column>> columns(num_columns);
+  std::vector<std::unique_ptr<column>> columns(layout.num_columns);
   for (auto& col : columns) {
-    col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
+    col = make_numeric_column(layout.dtype, layout.num_rows, mask_state::UNALLOCATED, stream, mr);
 
     CUDF_CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
                                   reinterpret_cast<void*>(tensor_data),
@@ -213,12 +253,65 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                   cudaMemcpyDefault,
                                   stream.value()));
 
-    tensor_data += col_stride;
+    tensor_data += layout.column_stride_bytes;
   }
 
   return std::make_unique<table>(std::move(columns));
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+  CUDF_EXPECTS(tensor.device.device_type == kDLCUDA || tensor.device.device_type == kDLCUDAHost ||
+                 tensor.device.device_type == kDLCUDAManaged,
+               "DLTensor device type must be CUDA, CUDAHost or CUDAManaged to be viewed");
+  // managed memory is checked like device memory
+  auto device_tensor = tensor;
+  if (tensor.device.device_type == kDLCUDAManaged) { device_tensor.device.device_type = kDLCUDA; }
+  auto const layout = get_dlpack_layout(device_tensor);
+
+  auto const data = static_cast<char const*>(tensor.data) + tensor.byte_offset;
+  std::vector<column_view> columns;
+  columns.reserve(layout.num_columns);
+  for (size_type i = 0; i < layout.num_columns; ++i) {
+    columns.emplace_back(
+      layout.dtype, layout.num_rows, data + i * layout.column_stride_bytes, nullptr, 0);
+  }
+  return table_view{columns};
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           rmm::cuda_stream_view consumer_stream,
+                           rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input != nullptr, "input column is null", std::invalid_argument);
+  DLDataType const dltype = data_type_to_DLDataType(input->type());
+  CUDF_EXPECTS(input->null_count() == 0, "Input required to have null count zero");
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = input->size();
+
+  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  // the tensor takes over the data buffer of the column; the null mask is dropped
+  context->buffer = std::move(*input->release().data);
+  tensor.data     = context->buffer.data();
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  order_consumer_stream(stream, consumer_stream);
+  return managed_tensor.release();
+}
+
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::cuda_stream_view stream,
                            rmm::device_async_resource_ref mr)
@@ -312,4 +405,18 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::device_async_resource_r
   return detail::to_dlpack(input, cudf::get_default_stream(), mr);
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_dlpack_view(managed_tensor);
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input,
+                           rmm::cuda_stream_view consumer_stream,
+                           rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack(std::move(input), consumer_stream, stream);
+}
+
 }  // namespace cudf
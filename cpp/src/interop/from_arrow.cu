@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include <cudf/column/column_factories.hpp>
+#include "io/utilities/config_utils.hpp"
+
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
@@ -23,21 +25,32 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/thread_pool.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/aligned.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/gather.h>
 
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace cudf {
 
 namespace detail {
@@ -90,12 +103,161 @@ data_type arrow_to_cudf_type(arrow::DataType const& arrow_type)
 }
 
 namespace {
+
+/**
+ * @brief Returns the thread pool used to gather Arrow host buffers into pinned staging memory
+ *
+ * The pool size can be set with the `LIBCUDF_ARROW_HOST_COPY_THREAD_COUNT` environment variable.
+ *
+ * @return The shared thread pool
+ */
+cudf::detail::thread_pool& host_copy_thread_pool()
+{
+  constexpr std::size_t default_thread_count = 8;
+  static cudf::detail::thread_pool pool(
+    cudf::io::detail::getenv_or("LIBCUDF_ARROW_HOST_COPY_THREAD_COUNT", default_thread_count));
+  return pool;
+}
+
+/**
+ * @brief Uploads every host-resident buffer of an Arrow table to the device in one go
+ *
+ * Converting column by column copies each buffer from pageable host memory on its own, and the
+ * per-copy overhead dominates for wide tables. The stager moves all buffers to a single device
+ * allocation up front, and the column conversion then copies from the staged device addresses.
+ * Buffers that are already device-resident are left untouched.
+ */
+class host_buffer_stager {
+ public:
+  host_buffer_stager(arrow::Table const& table,
+                     arrow_host_buffer_policy policy,
+                     rmm::cuda_stream_view stream)
+  {
+    std::vector<arrow::Buffer const*> buffers;
+    std::unordered_set<arrow::Buffer const*> seen;
+    for (auto const& chunked_array : table.columns()) {
+      for (auto const& chunk : chunked_array->chunks()) {
+        collect_host_buffers(*chunk->data(), buffers, seen);
+      }
+    }
+    if (buffers.empty()) { return; }
+
+    // keep every staged buffer aligned like a standalone allocation
+    std::vector<std::size_t> offsets;
+    offsets.reserve(buffers.size());
+    std::size_t total_size = 0;
+    for (auto const* buffer : buffers) {
+      offsets.push_back(total_size);
+      total_size += cudf::util::round_up_safe(static_cast<std::size_t>(buffer->size()),
+                                              rmm::CUDA_ALLOCATION_ALIGNMENT);
+    }
+    _staged = rmm::device_buffer(total_size, stream, rmm::mr::get_current_device_resource());
+
+    auto const staged = static_cast<uint8_t*>(_staged.data());
+    if (policy == arrow_host_buffer_policy::STAGE_PINNED) {
+      cudf::detail::pinned_host_vector<uint8_t> staging(total_size);
+      host_copy_thread_pool().parallelize_loop(
+        std::size_t{0}, buffers.size() - 1, [&](std::size_t i) {
+          std::memcpy(staging.data() + offsets[i], buffers[i]->data(), buffers[i]->size());
+        });
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        staged, staging.data(), total_size, cudaMemcpyHostToDevice, stream.value()));
+      // the staging memory is released on return
+      stream.synchronize();
+    } else {
+      registered_host_buffers registered{stream};
+      for (std::size_t i = 0; i < buffers.size(); ++i) {
+        registered.add(buffers[i]);
+        CUDF_CUDA_TRY(cudaMemcpyAsync(staged + offsets[i],
+                                      buffers[i]->data(),
+                                      buffers[i]->size(),
+                                      cudaMemcpyDefault,
+                                      stream.value()));
+      }
+    }
+
+    for (std::size_t i = 0; i < buffers.size(); ++i) {
+      _device_addresses.emplace(buffers[i], staged + offsets[i]);
+    }
+  }
+
+  /**
+   * @brief Returns the address to copy the contents of `buffer` from
+   *
+   * @param buffer Arrow buffer of the table the stager was created from
+   * @return The staged device copy of `buffer` if it was host-resident, its own address otherwise
+   */
+  [[nodiscard]] uint8_t const* address(arrow::Buffer const& buffer) const
+  {
+    auto const it = _device_addresses.find(&buffer);
+    return it != _device_addresses.end() ? it->second
+                                         : reinterpret_cast<uint8_t const*>(buffer.address());
+  }
+
+ private:
+  /**
+   * @brief Page-locks Arrow buffers in place for the lifetime of the object
+   *
+   * Buffers that cannot be registered, e.g. because they already are, are copied from as is.
+   */
+  class registered_host_buffers {
+   public:
+    explicit registered_host_buffers(rmm::cuda_stream_view stream) : _stream{stream} {}
+
+    void add(arrow::Buffer const* buffer)
+    {
+      auto const ptr = const_cast<uint8_t*>(buffer->data());
+      if (cudaHostRegister(ptr, buffer->size(), cudaHostRegisterDefault) == cudaSuccess) {
+        _ptrs.push_back(ptr);
+      } else {
+        // clear the sticky error state of the failed registration
+        cudaGetLastError();
+      }
+    }
+
+    ~registered_host_buffers()
+    {
+      // the copies from the registered memory must complete before it is unregistered
+      RMM_ASSERT_CUDA_SUCCESS(cudaStreamSynchronize(_stream.value()));
+      for (auto* ptr : _ptrs) {
+        RMM_ASSERT_CUDA_SUCCESS(cudaHostUnregister(ptr));
+      }
+    }
+
+    registered_host_buffers(registered_host_buffers const&)            = delete;
+    registered_host_buffers& operator=(registered_host_buffers const&) = delete;
+
+   private:
+    rmm::cuda_stream_view _stream;
+    std::vector<void*> _ptrs;
+  };
+
+  static void collect_host_buffers(arrow::ArrayData const& data,
+                                   std::vector<arrow::Buffer const*>& buffers,
+                                   std::unordered_set<arrow::Buffer const*>& seen)
+  {
+    for (auto const& buffer : data.buffers) {
+      if (buffer == nullptr or not buffer->is_cpu() or buffer->size() == 0) { continue; }
+      if (seen.insert(buffer.get()).second) { buffers.push_back(buffer.get()); }
+    }
+    for (auto const& child : data.child_data) {
+      collect_host_buffers(*child, buffers, seen);
+    }
+    if (data.dictionary != nullptr) { collect_host_buffers(*data.dictionary, buffers, seen); }
+  }
+
+  rmm::device_buffer _staged;
+  std::unordered_map<arrow::Buffer const*, uint8_t const*> _device_addresses;
+};
+
 /**
  * @brief Functor to return column for a corresponding arrow array. column
  * is formed from buffer underneath the arrow array along with any offset and
  * change in length that array has.
  */
 struct dispatch_to_cudf_column {
+  host_buffer_stager const& staged;  ///< Device copies of the table's host buffers
+
   /**
    * @brief Returns mask from an array without any offsets.
    */
@@ -112,7 +274,7 @@ struct dispatch_to_cudf_column {
     auto mask        = std::make_unique<rmm::device_buffer>(allocation_size, stream, mr);
     auto mask_buffer = array.null_bitmap();
     CUDF_CUDA_TRY(cudaMemcpyAsync(mask->data(),
-                                  reinterpret_cast<uint8_t const*>(mask_buffer->address()),
+                                  staged.address(*mask_buffer),
                                   null_bitmap_size,
                                   cudaMemcpyDefault,
                                   stream.value()));
@@ -146,7 +308,7 @@ struct dispatch_to_cudf_column {
     auto mutable_column_view = col->mutable_view();
     CUDF_CUDA_TRY(cudaMemcpyAsync(
       mutable_column_view.data<T>(),
-      reinterpret_cast<uint8_t const*>(data_buffer->address()) + array.offset() * sizeof(T),
+      staged.address(*data_buffer) + array.offset() * sizeof(T),
       sizeof(T) * num_rows,
       cudaMemcpyDefault,
       stream.value()));
@@ -186,6 +348,7 @@ std::unique_ptr<column> get_empty_type_column(size_type size)
 std::unique_ptr<column> get_column(arrow::Array const& array,
                                    data_type type,
                                    bool skip_mask,
+                                   host_buffer_stager const& staged,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
@@ -206,7 +369,7 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<numeric::decimal128>
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(
     mutable_column_view.data<DeviceType>(),
-    reinterpret_cast<uint8_t const*>(data_buffer->address()) + array.offset() * sizeof(DeviceType),
+    staged.address(*data_buffer) + array.offset() * sizeof(DeviceType),
     sizeof(DeviceType) * num_rows,
     cudaMemcpyDefault,
     stream.value()));
@@ -242,7 +405,7 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<bool>(arrow::Array c
   auto data = rmm::device_buffer(
     cudf::bitmask_allocation_size_bytes(data_buffer->size() * CHAR_BIT), stream, mr);
   CUDF_CUDA_TRY(cudaMemcpyAsync(data.data(),
-                                reinterpret_cast<uint8_t const*>(data_buffer->address()),
+                                staged.address(*data_buffer),
                                 data_buffer->size(),
                                 cudaMemcpyDefault,
                                 stream.value()));
@@ -282,9 +445,9 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::string_view>(
   auto char_array = std::make_unique<arrow::Int8Array>(
     str_array->value_data()->size(), str_array->value_data(), nullptr);
 
-  auto offsets_column = dispatch_to_cudf_column{}.operator()<int32_t>(
+  auto offsets_column = dispatch_to_cudf_column{staged}.operator()<int32_t>(
     *offset_array, data_type(type_id::INT32), true, stream, mr);
-  auto chars_column = dispatch_to_cudf_column{}.operator()<int8_t>(
+  auto chars_column = dispatch_to_cudf_column{staged}.operator()<int8_t>(
     *char_array, data_type(type_id::INT8), true, stream, mr);
 
   auto const num_rows = offsets_column->size() - 1;
@@ -315,10 +478,12 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::dictionary32>(
 {
   auto dict_array  = static_cast<arrow::DictionaryArray const*>(&array);
   auto dict_type   = arrow_to_cudf_type(*(dict_array->dictionary()->type()));
-  auto keys_column = get_column(*(dict_array->dictionary()), dict_type, true, stream, mr);
-  auto ind_type    = arrow_to_cudf_type(*(dict_array->indices()->type()));
+  auto keys_column =
+    get_column(*(dict_array->dictionary()), dict_type, true, staged, stream, mr);
+  auto ind_type = arrow_to_cudf_type(*(dict_array->indices()->type()));
 
-  auto indices_column = get_column(*(dict_array->indices()), ind_type, false, stream, mr);
+  auto indices_column =
+    get_column(*(dict_array->indices()), ind_type, false, staged, stream, mr);
   // If index type is not of type uint32_t, then cast it to uint32_t
   auto const dict_indices_type = data_type{type_id::UINT32};
   if (indices_column->type().id() != dict_indices_type.id())
@@ -353,9 +518,9 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::struct_view>(
   std::transform(array_children.cbegin(),
                  array_children.cend(),
                  std::back_inserter(child_columns),
-                 [&mr, &stream](auto const& child_array) {
+                 [this, &mr, &stream](auto const& child_array) {
                    auto type = arrow_to_cudf_type(*(child_array->type()));
-                   return get_column(*child_array, type, false, stream, mr);
+                   return get_column(*child_array, type, false, staged, stream, mr);
                  });
 
   auto out_mask = std::move(*(get_mask_buffer(array, stream, mr)));
@@ -382,11 +547,12 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::list_view>(
   auto list_array   = static_cast<arrow::ListArray const*>(&array);
   auto offset_array = std::make_unique<arrow::Int32Array>(
     list_array->value_offsets()->size() / sizeof(int32_t), list_array->value_offsets(), nullptr);
-  auto offsets_column = dispatch_to_cudf_column{}.operator()<int32_t>(
+  auto offsets_column = dispatch_to_cudf_column{staged}.operator()<int32_t>(
     *offset_array, data_type(type_id::INT32), true, stream, mr);
 
   auto child_type   = arrow_to_cudf_type(*(list_array->values()->type()));
-  auto child_column = get_column(*(list_array->values()), child_type, false, stream, mr);
+  auto child_column =
+    get_column(*(list_array->values()), child_type, false, staged, stream, mr);
 
   auto const num_rows = offsets_column->size() - 1;
   auto out_col        = make_lists_column(num_rows,
@@ -411,27 +577,31 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::list_view>(
 std::unique_ptr<column> get_column(arrow::Array const& array,
                                    data_type type,
                                    bool skip_mask,
+                                   host_buffer_stager const& staged,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr)
 {
   return type.id() != type_id::EMPTY
-           ? type_dispatcher(type, dispatch_to_cudf_column{}, array, type, skip_mask, stream, mr)
+           ? type_dispatcher(
+               type, dispatch_to_cudf_column{staged}, array, type, skip_mask, stream, mr)
            : get_empty_type_column(array.length());
 }
 
 }  // namespace
 
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
+                                  arrow_host_buffer_policy policy,
                                   rmm::cuda_stream_view stream,
                                   rmm::device_async_resource_ref mr)
 {
   if (input_table.num_columns() == 0) { return std::make_unique<table>(); }
+  auto const staged = host_buffer_stager(input_table, policy, stream);
   std::vector<std::unique_ptr<column>> columns;
   auto chunked_arrays = input_table.columns();
   std::transform(chunked_arrays.begin(),
                  chunked_arrays.end(),
                  std::back_inserter(columns),
-                 [&mr, &stream](auto const& chunked_array) {
+                 [&staged, &mr, &stream](auto const& chunked_array) {
                    std::vector<std::unique_ptr<column>> concat_columns;
                    auto cudf_type    = arrow_to_cudf_type(*(chunked_array->type()));
                    auto array_chunks = chunked_array->chunks();
@@ -441,8 +611,9 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
                    std::transform(array_chunks.begin(),
                                   array_chunks.end(),
                                   std::back_inserter(concat_columns),
-                                  [&cudf_type, &mr, &stream](auto const& array_chunk) {
-                                    return get_column(*array_chunk, cudf_type, false, stream, mr);
+                                  [&cudf_type, &staged, &mr, &stream](auto const& array_chunk) {
+                                    return get_column(
+                                      *array_chunk, cudf_type, false, staged, stream, mr);
                                   });
                    if (concat_columns.empty()) {
                      return std::make_unique<column>(
@@ -474,7 +645,8 @@ std::unique_ptr<cudf::scalar> from_arrow(arrow::Scalar const& input,
 
   auto table = arrow::Table::Make(arrow::schema({field}), {array});
 
-  auto cudf_table = detail::from_arrow(*table, stream, mr);
+  auto cudf_table =
+    detail::from_arrow(*table, arrow_host_buffer_policy::STAGE_PINNED, stream, mr);
 
   auto cv = cudf_table->view().column(0);
   return get_element(cv, 0, stream);
@@ -488,7 +660,17 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
 {
   CUDF_FUNC_RANGE();
 
-  return detail::from_arrow(input_table, stream, mr);
+  return detail::from_arrow(input_table, arrow_host_buffer_policy::STAGE_PINNED, stream, mr);
+}
+
+std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
+                                  arrow_host_buffer_policy policy,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::from_arrow(input_table, policy, stream, mr);
 }
 
 std::unique_ptr<cudf::scalar> from_arrow(arrow::Scalar const& input,
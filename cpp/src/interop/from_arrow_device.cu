@@ -58,7 +58,8 @@ data_type arrow_to_cudf_type(const ArrowSchemaView* arrow_view)
     case NANOARROW_TYPE_FLOAT: return data_type(type_id::FLOAT32);
     case NANOARROW_TYPE_DOUBLE: return data_type(type_id::FLOAT64);
     case NANOARROW_TYPE_DATE32: return data_type(type_id::TIMESTAMP_DAYS);
-    case NANOARROW_TYPE_STRING: return data_type(type_id::STRING);
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING: return data_type(type_id::STRING);
     case NANOARROW_TYPE_LIST: return data_type(type_id::LIST);
     case NANOARROW_TYPE_DICTIONARY: return data_type(type_id::DICTIONARY32);
     case NANOARROW_TYPE_STRUCT: return data_type(type_id::STRUCT);
@@ -91,6 +92,8 @@ namespace {
 using dispatch_tuple_t = std::tuple<column_view, owned_columns_t>;
 
 struct dispatch_from_arrow_device {
+  arrow_copy_policy policy;
+
   template <typename T,
             CUDF_ENABLE_IF(not is_rep_layout_compatible<T>() &&
                            !std::is_same_v<T, numeric::decimal128>)>
@@ -132,6 +135,7 @@ dispatch_tuple_t get_column(ArrowSchemaView* schema,
                             ArrowArray const* input,
                             data_type type,
                             bool skip_mask,
+                            arrow_copy_policy policy,
                             rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr);
 
@@ -154,6 +158,9 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<bool>(ArrowSchemaView* s
       {});
   }
 
+  CUDF_EXPECTS(policy == arrow_copy_policy::ALLOW_COPY,
+               "BOOL8 columns must be copied to convert from Arrow",
+               cudf::data_type_error);
   auto out_col = mask_to_bools(
     reinterpret_cast<bitmask_type const*>(input->buffers[fixed_width_data_buffer_idx]),
     input->offset,
@@ -197,7 +204,10 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::string_view>(
       {});
   }
 
-  auto offsets_view = column_view{data_type(type_id::INT32),
+  // large strings have 64-bit offsets, which cudf strings columns support as-is
+  auto const offsets_type =
+    schema->type == NANOARROW_TYPE_LARGE_STRING ? type_id::INT64 : type_id::INT32;
+  auto offsets_view = column_view{data_type(offsets_type),
                                   static_cast<size_type>(input->offset + input->length) + 1,
                                   input->buffers[fixed_width_data_buffer_idx],
                                   nullptr,
@@ -230,7 +240,7 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::dictionary32>(
 
   auto const keys_type = arrow_to_cudf_type(&keys_schema_view);
   auto [keys_view, owned_cols] =
-    get_column(&keys_schema_view, input->dictionary, keys_type, true, stream, mr);
+    get_column(&keys_schema_view, input->dictionary, keys_type, true, policy, stream, mr);
 
   auto const dict_indices_type = [&schema]() -> data_type {
     // cudf dictionary requires an unsigned type for the indices,
@@ -287,11 +297,12 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::struct_view>(
     input->children + input->n_children,
     schema->schema->children,
     std::back_inserter(children),
-    [&out_owned_cols, &stream, &mr](ArrowArray const* child, ArrowSchema const* child_schema) {
+    [&out_owned_cols, &stream, &mr, this](ArrowArray const* child,
+                                          ArrowSchema const* child_schema) {
       ArrowSchemaView view;
       NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, child_schema, nullptr));
       auto type              = arrow_to_cudf_type(&view);
-      auto [out_view, owned] = get_column(&view, child, type, false, stream, mr);
+      auto [out_view, owned] = get_column(&view, child, type, false, policy, stream, mr);
       if (out_owned_cols.empty()) {
         out_owned_cols = std::move(owned);
       } else {
@@ -340,7 +351,7 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::list_view>(
     ArrowSchemaViewInit(&child_schema_view, schema->schema->children[0], nullptr));
   auto child_type = arrow_to_cudf_type(&child_schema_view);
   auto [child_view, owned] =
-    get_column(&child_schema_view, input->children[0], child_type, false, stream, mr);
+    get_column(&child_schema_view, input->children[0], child_type, false, policy, stream, mr);
 
   // in the scenario where we were sliced and there are more elements in the child_view
   // than can be referenced by the sliced offsets, we need to slice the child_view
@@ -363,12 +374,19 @@ dispatch_tuple_t get_column(ArrowSchemaView* schema,
                             ArrowArray const* input,
                             data_type type,
                             bool skip_mask,
+                            arrow_copy_policy policy,
                             rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr)
 {
   return type.id() != type_id::EMPTY
-           ? std::move(type_dispatcher(
-               type, dispatch_from_arrow_device{}, schema, input, type, skip_mask, stream, mr))
+           ? std::move(type_dispatcher(type,
+                                       dispatch_from_arrow_device{policy},
+                                       schema,
+                                       input,
+                                       type,
+                                       skip_mask,
+                                       stream,
+                                       mr))
            : std::make_tuple<column_view, owned_columns_t>({data_type(type_id::EMPTY),
                                                             static_cast<size_type>(input->length),
                                                             nullptr,
@@ -381,6 +399,7 @@ dispatch_tuple_t get_column(ArrowSchemaView* schema,
 
 unique_table_view_t from_arrow_device(ArrowSchemaView* schema,
                                       ArrowDeviceArray const* input,
+                                      arrow_copy_policy policy,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
 {
@@ -401,11 +420,11 @@ unique_table_view_t from_arrow_device(ArrowSchemaView* schema,
     input->array.children + input->array.n_children,
     schema->schema->children,
     std::back_inserter(columns),
-    [&owned_mem, &stream, &mr](ArrowArray const* child, ArrowSchema const* child_schema) {
+    [&owned_mem, &stream, &mr, policy](ArrowArray const* child, ArrowSchema const* child_schema) {
       ArrowSchemaView view;
       NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, child_schema, nullptr));
       auto type              = arrow_to_cudf_type(&view);
-      auto [out_view, owned] = get_column(&view, child, type, false, stream, mr);
+      auto [out_view, owned] = get_column(&view, child, type, false, policy, stream, mr);
       if (owned_mem.empty()) {
         owned_mem = std::move(owned);
       } else {
@@ -422,6 +441,7 @@ unique_table_view_t from_arrow_device(ArrowSchemaView* schema,
 
 unique_column_view_t from_arrow_device_column(ArrowSchemaView* schema,
                                               ArrowDeviceArray const* input,
+                                              arrow_copy_policy policy,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource* mr)
 {
@@ -431,7 +451,7 @@ unique_column_view_t from_arrow_device_column(ArrowSchemaView* schema,
   }
 
   auto type             = arrow_to_cudf_type(schema);
-  auto [colview, owned] = get_column(schema, &input->array, type, false, stream, mr);
+  auto [colview, owned] = get_column(schema, &input->array, type, false, policy, stream, mr);
   return unique_column_view_t{new column_view{colview},
                               custom_view_deleter<cudf::column_view>{std::move(owned)}};
 }
@@ -442,6 +462,15 @@ unique_table_view_t from_arrow_device(ArrowSchema const* schema,
                                       ArrowDeviceArray const* input,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
+{
+  return from_arrow_device(schema, input, arrow_copy_policy::ALLOW_COPY, stream, mr);
+}
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      arrow_copy_policy policy,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(schema != nullptr && input != nullptr,
                "input ArrowSchema and ArrowDeviceArray must not be NULL");
@@ -456,11 +485,20 @@ unique_table_view_t from_arrow_device(ArrowSchema const* schema,
     rmm::cuda_device_id{static_cast<rmm::cuda_device_id::value_type>(input->device_id)});
   ArrowSchemaView view;
   NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, schema, nullptr));
-  return detail::from_arrow_device(&view, input, stream, mr);
+  return detail::from_arrow_device(&view, input, policy, stream, mr);
+}
+
+unique_column_view_t from_arrow_device_column(ArrowSchema const* schema,
+                                              ArrowDeviceArray const* input,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  return from_arrow_device_column(schema, input, arrow_copy_policy::ALLOW_COPY, stream, mr);
 }
 
 unique_column_view_t from_arrow_device_column(ArrowSchema const* schema,
                                               ArrowDeviceArray const* input,
+                                              arrow_copy_policy policy,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource* mr)
 {
@@ -477,7 +515,7 @@ unique_column_view_t from_arrow_device_column(ArrowSchema const* schema,
     rmm::cuda_device_id{static_cast<rmm::cuda_device_id::value_type>(input->device_id)});
   ArrowSchemaView view;
   NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, schema, nullptr));
-  return detail::from_arrow_device_column(&view, input, stream, mr);
+  return detail::from_arrow_device_column(&view, input, policy, stream, mr);
 }
 
 }  // namespace cudf
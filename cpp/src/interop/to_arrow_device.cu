@@ -31,6 +31,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -46,6 +47,8 @@
 #include <nanoarrow/nanoarrow.h>
 #include <nanoarrow/nanoarrow.hpp>
 
+#include <string>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -65,6 +68,17 @@ int initialize_array(ArrowArray* arr, ArrowType storage_type, cudf::column_view
   return NANOARROW_OK;
 }
 
+/**
+ * @brief Arrow type of a strings column: large strings share the 64-bit offsets of cudf
+ */
+ArrowType strings_arrow_type(cudf::column_view column)
+{
+  return column.size() > 0 and
+             cudf::strings_column_view(column).offsets().type().id() == type_id::INT64
+           ? NANOARROW_TYPE_LARGE_STRING
+           : NANOARROW_TYPE_STRING;
+}
+
 template <typename>
 struct is_device_scalar : public std::false_type {};
 
@@ -258,7 +272,7 @@ int dispatch_to_arrow_device::operator()<cudf::string_view>(cudf::column&& colum
                                                             ArrowArray* out)
 {
   nanoarrow::UniqueArray tmp;
-  NANOARROW_RETURN_NOT_OK(initialize_array(tmp.get(), NANOARROW_TYPE_STRING, column));
+  NANOARROW_RETURN_NOT_OK(initialize_array(tmp.get(), strings_arrow_type(column), column));
 
   if (column.size() == 0) {
     // the scalar zero here is necessary because the spec for string arrays states
@@ -378,6 +392,7 @@ struct dispatch_to_arrow_device_view {
   cudf::column_view column;
   rmm::cuda_stream_view stream;
   rmm::device_async_resource_ref mr;
+  arrow_copy_policy policy;
 
   template <typename T, CUDF_ENABLE_IF(not is_rep_layout_compatible<T>())>
   int operator()(ArrowArray*) const
@@ -423,6 +438,13 @@ struct dispatch_to_arrow_device_view {
     return NANOARROW_OK;
   }
 
+  void expect_copy_allowed(char const* type_name) const
+  {
+    CUDF_EXPECTS(policy == arrow_copy_policy::ALLOW_COPY,
+                 std::string{type_name} + " columns must be copied to convert to Arrow",
+                 cudf::data_type_error);
+  }
+
   int set_view_to_buffer(column_view column, ArrowArray* out) const
   {
     auto const type_size = cudf::size_of(column.type());
@@ -436,6 +458,7 @@ struct dispatch_to_arrow_device_view {
 template <>
 int dispatch_to_arrow_device_view::operator()<numeric::decimal32>(ArrowArray* out) const
 {
+  expect_copy_allowed("DECIMAL32");
   using DeviceType = int32_t;
   NANOARROW_RETURN_NOT_OK(decimals_to_arrow<DeviceType>(column, stream, mr, out));
   NANOARROW_RETURN_NOT_OK(set_null_mask(column, out));
@@ -445,6 +468,7 @@ int dispatch_to_arrow_device_view::operator()<numeric::decimal32>(ArrowArray* ou
 template <>
 int dispatch_to_arrow_device_view::operator()<numeric::decimal64>(ArrowArray* out) const
 {
+  expect_copy_allowed("DECIMAL64");
   using DeviceType = int64_t;
   NANOARROW_RETURN_NOT_OK(decimals_to_arrow<DeviceType>(column, stream, mr, out));
   NANOARROW_RETURN_NOT_OK(set_null_mask(column, out));
@@ -467,6 +491,7 @@ int dispatch_to_arrow_device_view::operator()<numeric::decimal128>(ArrowArray* o
 template <>
 int dispatch_to_arrow_device_view::operator()<bool>(ArrowArray* out) const
 {
+  expect_copy_allowed("BOOL8");
   nanoarrow::UniqueArray tmp;
   NANOARROW_RETURN_NOT_OK(initialize_array(tmp.get(), NANOARROW_TYPE_BOOL, column));
 
@@ -483,7 +508,7 @@ template <>
 int dispatch_to_arrow_device_view::operator()<cudf::string_view>(ArrowArray* out) const
 {
   nanoarrow::UniqueArray tmp;
-  NANOARROW_RETURN_NOT_OK(initialize_array(tmp.get(), NANOARROW_TYPE_STRING, column));
+  NANOARROW_RETURN_NOT_OK(initialize_array(tmp.get(), strings_arrow_type(column), column));
 
   if (column.size() == 0) {
     // https://github.com/rapidsai/cudf/pull/15047#discussion_r1546528552
@@ -523,7 +548,7 @@ int dispatch_to_arrow_device_view::operator()<cudf::struct_view>(ArrowArray* out
     ArrowArray* child_ptr = tmp->children[i];
     auto const child      = column.child(i);
     NANOARROW_RETURN_NOT_OK(cudf::type_dispatcher(
-      child.type(), dispatch_to_arrow_device_view{child, stream, mr}, child_ptr));
+      child.type(), dispatch_to_arrow_device_view{child, stream, mr, policy}, child_ptr));
   }
 
   ArrowArrayMove(tmp.get(), out);
@@ -544,7 +569,7 @@ int dispatch_to_arrow_device_view::operator()<cudf::list_view>(ArrowArray* out)
 
   auto child = lcv.child();
   NANOARROW_RETURN_NOT_OK(cudf::type_dispatcher(
-    child.type(), dispatch_to_arrow_device_view{child, stream, mr}, tmp->children[0]));
+    child.type(), dispatch_to_arrow_device_view{child, stream, mr, policy}, tmp->children[0]));
 
   ArrowArrayMove(tmp.get(), out);
   return NANOARROW_OK;
@@ -567,7 +592,7 @@ int dispatch_to_arrow_device_view::operator()<cudf::dictionary32>(ArrowArray* ou
 
   auto keys = dcv.keys();
   NANOARROW_RETURN_NOT_OK(cudf::type_dispatcher(
-    keys.type(), dispatch_to_arrow_device_view{keys, stream, mr}, tmp->dictionary));
+    keys.type(), dispatch_to_arrow_device_view{keys, stream, mr, policy}, tmp->dictionary));
 
   ArrowArrayMove(tmp.get(), out);
   return NANOARROW_OK;
@@ -648,6 +673,7 @@ unique_device_array_t to_arrow_device(cudf::column&& col,
 }
 
 unique_device_array_t to_arrow_device(cudf::table_view const& table,
+                                      arrow_copy_policy policy,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr)
 {
@@ -662,20 +688,21 @@ unique_device_array_t to_arrow_device(cudf::table_view const& table,
     auto child = tmp->children[i];
     auto col   = table.column(i);
     NANOARROW_THROW_NOT_OK(cudf::type_dispatcher(
-      col.type(), detail::dispatch_to_arrow_device_view{col, stream, mr}, child));
+      col.type(), detail::dispatch_to_arrow_device_view{col, stream, mr, policy}, child));
   }
 
   return create_device_array(std::move(tmp), stream);
 }
 
 unique_device_array_t to_arrow_device(cudf::column_view const& col,
+                                      arrow_copy_policy policy,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr)
 {
   nanoarrow::UniqueArray tmp;
 
   NANOARROW_THROW_NOT_OK(cudf::type_dispatcher(
-    col.type(), detail::dispatch_to_arrow_device_view{col, stream, mr}, tmp.get()));
+    col.type(), detail::dispatch_to_arrow_device_view{col, stream, mr, policy}, tmp.get()));
 
   return create_device_array(std::move(tmp), stream);
 }
@@ -703,14 +730,32 @@ unique_device_array_t to_arrow_device(cudf::table_view const& table,
                                       rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::to_arrow_device(table, stream, mr);
+  return detail::to_arrow_device(table, arrow_copy_policy::ALLOW_COPY, stream, mr);
+}
+
+unique_device_array_t to_arrow_device(cudf::table_view const& table,
+                                      arrow_copy_policy policy,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(table, policy, stream, mr);
+}
+
+unique_device_array_t to_arrow_device(cudf::column_view const& col,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(col, arrow_copy_policy::ALLOW_COPY, stream, mr);
 }
 
 unique_device_array_t to_arrow_device(cudf::column_view const& col,
+                                      arrow_copy_policy policy,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::to_arrow_device(col, stream, mr);
+  return detail::to_arrow_device(col, policy, stream, mr);
 }
 }  // namespace cudf
@@ -120,7 +120,10 @@ int dispatch_to_arrow_type::operator()<cudf::string_view>(column_view input,
                                                           column_metadata const&,
                                                           ArrowSchema* out)
 {
-  return ArrowSchemaSetType(out, NANOARROW_TYPE_STRING);
+  // matches the array type chosen by `to_arrow_device`, which shares the cudf offsets buffer
+  auto const is_large = input.size() > 0 and
+                        strings_column_view(input).offsets().type().id() == type_id::INT64;
+  return ArrowSchemaSetType(out, is_large ? NANOARROW_TYPE_LARGE_STRING : NANOARROW_TYPE_STRING);
 }
 
 // these forward declarations are needed due to the recursive calls to them
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -48,6 +48,7 @@ std::string container::get_encoded()
 {
   auto const len = [&] {
     auto const len = get_encoded<uint64_t>();
+    if (not(len & 1) && (len >> 1) > static_cast<uint64_t>(m_end - m_cur)) { m_truncated = true; }
     return (len & 1) || (m_cur >= m_end) ? 0
                                          : std::min(len >> 1, static_cast<uint64_t>(m_end - m_cur));
   }();
@@ -59,13 +60,13 @@ std::string container::get_encoded()
 /**
  * @brief AVRO file metadata parser
  *
+ * Parses the file header; the data blocks that follow it are enumerated by the reader.
+ *
  * @param[out] md parsed avro file metadata
- * @param[in] max_num_rows maximum number of rows
- * @param[in] first_row drop blocks below first_row
  *
- * @returns true if successful, false if error
+ * @returns true if successful, false if error or if the data does not hold the whole header
  */
-bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
+bool container::parse(file_metadata* md)
 {
   constexpr uint32_t avro_magic = (('O' << 0) | ('b' << 8) | ('j' << 16) | (0x01 << 24));
 
@@ -96,126 +97,9 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   // differ, the data should be interpreted as corrupted.
   md->sync_marker[0] = get_raw<uint64_t>();
   md->sync_marker[1] = get_raw<uint64_t>();
+  if (m_truncated) { return false; }
 
-  // Initialize remaining metadata fields.
-  md->metadata_size  = m_cur - m_base;
-  md->skip_rows      = first_row;
-  md->total_num_rows = 0;
-
-  // Enumerate the blocks in this file.  Each block starts with a count of
-  // objects (rows) in the block (uint64_t), and then the total size in bytes
-  // of the block (uint64_t).  We walk each block and do the following:
-  //    1. Capture the total number of rows present across all blocks.
-  //    2. Add each block to the metadata's list of blocks.
-  //    3. Handle the case where we've been asked to skip or limit rows.
-  //    4. Verify sync markers at the end of each block.
-  //
-  // A row offset is also maintained, and added to each block.  This reflects
-  // the absolute offset that needs to be added to any given row in order to
-  // get the row's index within the destination array.  See `dst_row` in
-  // `avro_decode_row()` for more information.
-  //
-  // N.B. "object" and "row" are used interchangeably here; "object" is
-  //      avro nomenclature, "row" is ours.
-  //
-  // N.B. If we're skipping rows, we ignore blocks (i.e. don't add them to
-  //      md->block_list) that precede the block containing the first row
-  //      we're interested in.
-  //
-
-  // Number of rows in the current block.
-  uint32_t num_rows = 0;
-
-  // Absolute row offset of the current block relative to all blocks selected by
-  // the skip rows/limit rows constraints, if any.  Otherwise, absolute row
-  // offset relative to all blocks.
-  uint32_t row_offset = 0;
-
-  // Maximum block size in bytes encountered whilst processing all blocks
-  // selected by the skip rows/limit rows constraints, if any.  Otherwise,
-  // maximum block size across all blocks.
-  uint32_t max_block_size = 0;
-
-  // Accumulates the total number of rows across all blocks selected by the skip
-  // rows/limit rows constraints, if any.  Otherwise, total number of rows across
-  // all blocks.
-  size_t total_object_count = 0;
-
-  // N.B. The 18 below is (presumably) intended to account for the two 64-bit
-  //      object count and block size integers (16 bytes total), and then an
-  //      additional two bytes to represent the smallest possible row size.
-  while (m_cur + 18 < m_end && total_object_count < max_num_rows) {
-    auto const object_count = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const block_size   = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const next_end     = m_cur + block_size + 16;
-    // Abort on terminal conditions.  We keep these as separate lines instead of
-    // combining them into a single if in order to facilitate setting specific
-    // line breakpoints in the debugger.
-    if (block_size <= 0) { return false; }
-    if (object_count <= 0) { return false; }
-    if (next_end > m_end) { return false; }
-
-    // Update our total row count.  This is only captured for information
-    // purposes.
-    md->total_num_rows += object_count;
-
-    if (object_count <= first_row) {
-      // We've been asked to skip rows, and we haven't yet reached our desired
-      // number of rows to skip.  Subtract this block's rows (`object_count`)
-      // from the remaining rows to skip (`first_row`).  Do not add this block
-      // to our block list.
-      first_row -= object_count;
-    } else {
-      // Either we weren't asked to skip rows, or we were, but we've already hit
-      // our target number of rows to skip.  Add this block to our block list.
-      max_block_size = std::max(max_block_size, block_size);
-      total_object_count += object_count;
-      if (!md->block_list.size()) {
-        // This is the first block, so add it to our list with the current value
-        // of `first_row`, which will reflect the number of rows to skip *in
-        // this block*.
-        m_start = m_cur;
-        total_object_count -= first_row;
-        num_rows = total_object_count;
-        CUDF_EXPECTS(row_offset == 0, "Invariant check failed: row_offset != 0");
-        if ((max_num_rows > 0) && (max_num_rows < total_object_count)) { num_rows = max_num_rows; }
-        md->block_list.emplace_back(m_cur - m_base, block_size, row_offset, first_row, num_rows);
-        first_row = 0;
-        row_offset += num_rows;
-      } else {
-        // Not our first block; `first_row` should always be zero here.
-        CUDF_EXPECTS(first_row == 0, "Invariant check failed: first_row != 0");
-
-        num_rows = object_count;
-        if ((max_num_rows > 0) && (max_num_rows < total_object_count)) {
-          num_rows -= (total_object_count - max_num_rows);
-        }
-
-        md->block_list.emplace_back(m_cur - m_base, block_size, row_offset, first_row, num_rows);
-        row_offset += num_rows;
-      }
-    }
-    m_cur += block_size;
-    // Read the next sync markers and ensure they match the first ones we
-    // encountered.  If they don't, we have to assume the data is corrupted,
-    // and thus, we terminate processing immediately.
-    uint64_t const sync_marker[] = {get_raw<uint64_t>(), get_raw<uint64_t>()};
-    bool valid_sync_markers =
-      ((sync_marker[0] == md->sync_marker[0]) && (sync_marker[1] == md->sync_marker[1]));
-    if (!valid_sync_markers) { return false; }
-  }
-  md->max_block_size = max_block_size;
-  // N.B. `total_object_count` has skip_rows applied to it at this point, i.e.
-  //      it represents the number of rows that will be returned *after* rows
-  //      have been skipped (if requested).
-  if ((max_num_rows <= 0) || (max_num_rows > total_object_count)) {
-    md->num_rows = total_object_count;
-  } else {
-    md->num_rows = max_num_rows;
-  }
-  md->total_data_size = m_cur - (m_base + md->metadata_size);
-  CUDF_EXPECTS(m_cur > m_start, "Invariant check failed: `m_cur > m_start` is false.");
-  md->selected_data_size = m_cur - m_start;
+  md->metadata_size = m_cur - m_base;
   // Extract columns
   for (size_t i = 0; i < md->schema.size(); i++) {
     type_kind_e kind                = md->schema[i].kind;
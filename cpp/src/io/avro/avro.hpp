@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -62,35 +62,23 @@ struct column_desc {
  *
  * `metadata_size` is the size in bytes of the avro file header.
  *
- * `total_data_size` is the size of all data minus `metadata_size`.
+ * The data blocks that follow the header are enumerated by the reader, one
+ * pass over a range of the file at a time.  The remaining members describe
+ * the blocks of the current pass:
  *
- * `selected_data_size` is the size of all data minus `metadata_size`, with any
- * adjustments made to account for the number of rows or rows to skip per the
- * user's request.  This is the value used to size device-side buffers.
+ * `num_rows` is the number of rows that will be processed in the pass, after
+ * the `skip_rows` and `num_rows` parameters of `read_avro()` have been taken
+ * into consideration.
  *
- * `num_rows` is the number of rows that will be processed.  If the user has not
- * requested the number of rows to be limited (i.e. via the `num_rows` param to
- * `read_avro()`), this number will represent all rows in the file *after* the
- * `skip_rows` parameter has been taken into consideration (assuming a request
- * has been made to also skip rows).
+ * `block_list` is a list of the blocks of the pass that contain selected rows.
+ * The offset of each block is relative to the start of the data of the pass.
  *
- * `total_num_rows` is the total number of rows present in the file, across all
- * blocks.  This may be more than `num_rows` if the user has requested a limit
- * on the number of rows to return, or if `skip_rows` is active.
- *
- * `skip_rows` is the number of rows the user has requested to skip.  Note that
- * this value may differ from the `block_desc_s.first_row` member, which will
- * capture the number of rows to skip for a given block.
- *
- * `block_list` is a list of all blocks that contain the selected rows.  If no
- * row filtering has been done via `num_rows` or `skip_rows`; it will contain
- * all blocks.  Otherwise, it will contain only blocks selected by those
- * constraints.
+ * `max_block_size` is the size in bytes of the largest block in `block_list`.
  *
  * N.B. It is important to note that the coordination of skipping and limiting
  *      rows is dictated by the `first_row` and `num_rows` members of each block
- *      in the block list, *not* the `skip_rows` and `num_rows` members of this
- *      struct.
+ *      in the block list, *not* the `skip_rows` and `num_rows` parameters of
+ *      `read_avro()`.
  *
  *      This is because the first row and number of rows to process for each
  *      block needs to be handled at the individual block level in order to
@@ -100,8 +88,15 @@ struct column_desc {
  */
 struct file_metadata {
   std::map<std::string, std::string> user_data;
-  std::string codec         = "";
-  uint64_t sync_marker[2]   = {0, 0};
+  std::string codec       = "";
+  uint64_t sync_marker[2] = {0, 0};
+  size_t metadata_size    = 0;
+  size_type num_rows      = 0;
+  uint32_t max_block_size = 0;
+  std::vector<schema_entry> schema;
+  std::vector<block_desc_s> block_list;
+  std::vector<column_desc> columns;
+};
   size_t metadata_size      = 0;
   size_t total_data_size    = 0;
   size_t selected_data_size = 0;
@@ -147,10 +142,18 @@ class container {
 
   [[nodiscard]] auto bytecount() const { return m_cur - m_start; }
 
+  /**
+   * @brief Returns whether parsing ran past the end of the data
+   */
+  [[nodiscard]] bool is_truncated() const { return m_truncated; }
+
   template <typename T>
   T get_raw()
   {
-    if (m_cur + sizeof(T) > m_end) return T{};
+    if (m_cur + sizeof(T) > m_end) {
+      m_truncated = true;
+      return T{};
+    }
     T val;
     memcpy(&val, m_cur, sizeof(T));
     m_cur += sizeof(T);
@@ -161,22 +164,20 @@ class container {
   T get_encoded();
 
  public:
-  bool parse(file_metadata* md, size_t max_num_rows = 0x7fff'ffff, size_t first_row = 0);
+  bool parse(file_metadata* md);
 
  protected:
   // Base address of the file data.  This will always point to the file's metadata.
   uint8_t const* m_base;
 
-  // Start, current, and end pointers for the file.  These pointers refer to the
-  // actual data content of the file, not the metadata.  `m_cur` and `m_start`
-  // will only ever differ if a user has requested `read_avro()` to skip rows;
-  // in this case, `m_start` will be the base address of the block that contains
-  // the first row to be processed.  `m_cur` is updated as the file is parsed,
-  // until either `m_end` is reached, or the number of rows requested by the user
-  // is reached.
+  // Start, current, and end pointers for the file.  `m_cur` is updated as the
+  // header is parsed.
   uint8_t const* m_start;
   uint8_t const* m_cur;
   uint8_t const* m_end;
+
+  // Whether a read ran past `m_end`, i.e. the data does not hold the whole header.
+  bool m_truncated = false;
 };
 
 }  // namespace avro
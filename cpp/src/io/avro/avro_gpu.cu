@@ -17,6 +17,14 @@
 #include "io/utilities/block_utils.cuh"
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <cstring>
 
 using cudf::device_span;
 
@@ -409,6 +417,86 @@ CUDF_KERNEL void __launch_bounds__(num_warps * 32, 2)
   }
 }
 
+namespace {
+
+/**
+ * @brief Functor that returns whether the sync marker occurs at a position of the data
+ */
+struct is_sync_marker_fn {
+  device_span<uint8_t const> data;
+  uint8_t marker[sync_marker_size];
+
+  __device__ bool operator()(size_t pos) const
+  {
+    if (pos + sync_marker_size > data.size()) { return false; }
+    for (size_t i = 0; i < sync_marker_size; ++i) {
+      if (data[pos + i] != marker[i]) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Functor that decodes the header of the candidate block that starts at the beginning of
+ * the data (index 0) or after the sync marker at `marker_positions[i - 1]`
+ */
+struct decode_block_header_fn {
+  is_sync_marker_fn is_sync_marker;
+  size_t const* marker_positions;
+
+  __device__ block_header_s operator()(size_t i) const
+  {
+    auto const& data   = is_sync_marker.data;
+    auto const offset  = (i == 0) ? size_t{0} : marker_positions[i - 1] + sync_marker_size;
+    uint8_t const* cur = data.data() + offset;
+    uint8_t const* end = data.data() + data.size();
+
+    auto const num_rows    = avro_decode_zigzag_varint(cur, end);
+    auto const block_size  = avro_decode_zigzag_varint(cur, end);
+    auto const data_offset = static_cast<size_t>(cur - data.data());
+
+    bool const is_valid = (num_rows > 0 && num_rows <= UINT32_MAX) &&
+                          (block_size > 0 && block_size <= UINT32_MAX) &&
+                          is_sync_marker(data_offset + static_cast<size_t>(block_size));
+    return {offset,
+            data_offset,
+            static_cast<uint32_t>(block_size),
+            static_cast<uint32_t>(num_rows),
+            is_valid};
+  }
+};
+
+}  // namespace
+
+rmm::device_uvector<block_header_s> FindAvroBlocks(device_span<uint8_t const> data,
+                                                   uint64_t const* sync_marker,
+                                                   rmm::cuda_stream_view stream)
+{
+  is_sync_marker_fn const is_sync_marker = [&] {
+    is_sync_marker_fn fn{data, {}};
+    std::memcpy(fn.marker, sync_marker, sync_marker_size);
+    return fn;
+  }();
+
+  // Every byte position is a potential sync marker, as blocks are not aligned
+  auto const positions   = thrust::make_counting_iterator<size_t>(0);
+  auto const num_markers = thrust::count_if(
+    rmm::exec_policy(stream), positions, positions + data.size(), is_sync_marker);
+  rmm::device_uvector<size_t> marker_positions(num_markers, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  positions,
+                  positions + data.size(),
+                  marker_positions.begin(),
+                  is_sync_marker);
+
+  rmm::device_uvector<block_header_s> headers(num_markers + 1, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   headers.begin(),
+                   headers.end(),
+                   decode_block_header_fn{is_sync_marker, marker_positions.data()});
+  return headers;
+}
+
 /**
  * @brief Launches kernel for decoding column data
  *
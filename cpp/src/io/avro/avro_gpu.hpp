@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,12 +20,16 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 namespace cudf {
 namespace io {
 namespace avro {
 namespace gpu {
 
+// Size in bytes of the sync marker that follows each data block
+constexpr size_t sync_marker_size = 16;
+
 /**
  * @brief Struct to describe the avro schema
  */
@@ -37,6 +41,35 @@ struct schemadesc_s {
   void* dataptr;   // Ptr to column data, or null if column not selected
 };
 
+/**
+ * @brief Struct to describe a candidate data block, as found by `FindAvroBlocks`
+ */
+struct block_header_s {
+  size_t offset;       // offset of the block header in the searched data
+  size_t data_offset;  // offset of the block data in the searched data
+  uint32_t size;       // size of the block data in bytes
+  uint32_t num_rows;   // number of rows (objects) in the block
+  bool is_valid;       // whether the block data is complete and followed by the sync marker
+};
+
+/**
+ * @brief Finds the candidate data blocks in a range of file data
+ *
+ * A candidate block starts at the beginning of the data and after each occurrence of the sync
+ * marker. The candidates include all the blocks of the range, plus one for each occurrence of the
+ * sync marker bytes inside block data; the blocks are recovered by following the chain of valid
+ * blocks from the beginning of the data.
+ *
+ * @param[in] data File data that starts with a data block
+ * @param[in] sync_marker Sync marker of the file
+ * @param[in] stream CUDA stream to use
+ *
+ * @return Candidate blocks, ordered by offset
+ */
+rmm::device_uvector<block_header_s> FindAvroBlocks(cudf::device_span<uint8_t const> data,
+                                                   uint64_t const* sync_marker,
+                                                   rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for decoding column data
  *
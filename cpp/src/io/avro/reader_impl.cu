@@ -20,6 +20,7 @@
 #include "io/utilities/column_buffer.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
@@ -43,8 +44,11 @@
 
 #include <nvcomp/snappy.h>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -61,6 +65,13 @@ using namespace cudf::io::avro;
 using namespace cudf::io;
 
 namespace {
+// Size of the prefix of the source that is first read to parse the file header
+constexpr size_t initial_header_read_size = 64 * 1024;
+
+// Smallest number of bytes that can hold a data block: the object count and block size
+// varints, the two bytes of the smallest possible row and the sync marker
+constexpr size_t min_block_size = 18;
+
 /**
  * @brief Function that translates Avro data kind to cuDF type enum
  */
@@ -106,6 +117,69 @@ type_id to_type_id(avro::schema_entry const* col)
   }
 }
 
+/**
+ * @brief Selects the rows requested by `skip_rows` and `num_rows`, one data block at a time
+ *
+ * Blocks are passed in file order; the selection state carries over between read passes.
+ */
+class row_selector {
+ public:
+  row_selector(size_type skip_rows, size_type num_rows)
+    : _rows_to_skip{static_cast<size_t>(std::max(skip_rows, 0))},
+      _rows_to_read{num_rows < 0 ? std::numeric_limits<size_t>::max()
+                                 : static_cast<size_t>(num_rows)}
+  {
+  }
+
+  /**
+   * @brief Returns the index of the first row and the number of rows to save from a block, or
+   * nothing if the block has no selected rows
+   *
+   * @param block_num_rows Number of rows in the block
+   */
+  std::optional<std::pair<uint32_t, uint32_t>> select(uint32_t block_num_rows)
+  {
+    if (block_num_rows <= _rows_to_skip) {
+      _rows_to_skip -= block_num_rows;
+      return std::nullopt;
+    }
+    auto const first_row = static_cast<uint32_t>(_rows_to_skip);
+    auto const num_rows =
+      static_cast<uint32_t>(std::min<size_t>(block_num_rows - first_row, _rows_to_read));
+    _rows_to_skip = 0;
+    _rows_to_read -= num_rows;
+    return std::pair{first_row, num_rows};
+  }
+
+  /**
+   * @brief Returns whether all requested rows have been selected
+   */
+  [[nodiscard]] bool is_done() const { return _rows_to_read == 0; }
+
+ private:
+  size_t _rows_to_skip;
+  size_t _rows_to_read;
+};
+
+/**
+ * @brief Reads a range of the source into device memory
+ */
+rmm::device_buffer read_data(datasource& source,
+                             size_t offset,
+                             size_t size,
+                             rmm::cuda_stream_view stream)
+{
+  if (source.is_device_read_preferred(size)) {
+    auto data = rmm::device_buffer{size, stream};
+    auto const read_size =
+      source.device_read(offset, size, static_cast<uint8_t*>(data.data()), stream);
+    data.resize(read_size, stream);
+    return data;
+  }
+  auto const buffer = source.host_read(offset, size);
+  return rmm::device_buffer{buffer->data(), buffer->size(), stream};
+}
+
 }  // namespace
 
 /**
@@ -117,18 +191,21 @@ class metadata : public file_metadata {
   explicit metadata(datasource* const src) : source(src) {}
 
   /**
-   * @brief Initializes the parser and filters down to a subset of rows
+   * @brief Initializes the parser from the file header
    *
-   * @param[in,out] row_start Starting row of the selection
-   * @param[in,out] row_count Total number of rows selected
+   * Only the header is read; its size is not known ahead of time, so a growing prefix of the
+   * source is read until it holds the whole header.
    */
-  void init_and_select_rows(size_type& row_start, size_type& row_count)
+  void init()
   {
-    auto const buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
-    CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
-    row_start = skip_rows;
-    row_count = num_rows;
+    for (auto read_size = std::min(initial_header_read_size, source->size());;
+         read_size = std::min(2 * read_size, source->size())) {
+      auto const buffer = source->host_read(0, read_size);
+      avro::container pod(buffer->data(), buffer->size());
+      if (pod.parse(this)) { return; }
+      CUDF_EXPECTS(pod.is_truncated() && read_size < source->size(), "Cannot parse metadata");
+      static_cast<file_metadata&>(*this) = file_metadata{};
+    }
   }
 
   /**
@@ -184,6 +261,55 @@ class metadata : public file_metadata {
   datasource* const source;
 };
 
+/**
+ * @brief Enumerates the data blocks in a range of the file and selects the requested rows
+ *
+ * The blocks are found on the device, as the candidates that start after each sync marker, and
+ * then chained from the start of the range. Fills `meta.block_list`, `meta.max_block_size` and
+ * `meta.num_rows` with the selected blocks; their offsets are relative to the start of the range.
+ *
+ * @param meta File metadata
+ * @param data File data of the range; starts with a data block
+ * @param rows Row selection state
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Size in bytes of the complete blocks at the start of the range; blocks after the last
+ * selected row are not included
+ */
+size_t select_blocks(metadata& meta,
+                     rmm::device_buffer const& data,
+                     row_selector& rows,
+                     rmm::cuda_stream_view stream)
+{
+  auto const headers = cudf::detail::make_std_vector_sync(
+    gpu::FindAvroBlocks(
+      {static_cast<uint8_t const*>(data.data()), data.size()}, meta.sync_marker, stream),
+    stream);
+
+  meta.block_list.clear();
+  meta.max_block_size = 0;
+  meta.num_rows       = 0;
+
+  // Candidates that are not on the chain start after sync marker bytes within block data
+  size_t blocks_end = 0;
+  for (auto const& header : headers) {
+    if (rows.is_done()) { break; }
+    if (header.offset != blocks_end) { continue; }
+    if (not header.is_valid) { break; }
+    if (auto const selection = rows.select(header.num_rows)) {
+      auto const [first_row, num_rows] = *selection;
+      meta.block_list.emplace_back(header.data_offset,
+                                   header.size,
+                                   static_cast<uint32_t>(meta.num_rows),
+                                   first_row,
+                                   num_rows);
+      meta.max_block_size = std::max(meta.max_block_size, header.size);
+      meta.num_rows += num_rows;
+    }
+    blocks_end = header.data_offset + header.size + gpu::sync_marker_size;
+  }
+  return blocks_end;
+}
+
 rmm::device_buffer decompress_data(datasource& source,
                                    metadata& meta,
                                    rmm::device_buffer const& comp_block_data,
@@ -208,9 +334,8 @@ rmm::device_buffer decompress_data(datasource& source,
 
     rmm::device_buffer decomp_block_data(uncomp_size, stream);
 
-    auto const base_offset = meta.block_list[0].offset;
     for (size_t i = 0, dst_pos = 0; i < meta.block_list.size(); i++) {
-      auto const src_pos = meta.block_list[i].offset - base_offset;
+      auto const src_pos = meta.block_list[i].offset;
 
       inflate_in[i]  = {static_cast<uint8_t const*>(comp_block_data.data()) + src_pos,
                         meta.block_list[i].size};
@@ -266,17 +391,13 @@ rmm::device_buffer decompress_data(datasource& source,
   } else if (meta.codec == "snappy") {
     size_t const num_blocks = meta.block_list.size();
 
-    // comp_block_data contains contents of the avro file starting from the first block, excluding
-    // file header. meta.block_list[i].offset refers to offset of block i in the file, including
-    // file header.
-    // Find ptrs to each compressed block in comp_block_data by removing header offset.
+    // meta.block_list[i].offset refers to the offset of block i in comp_block_data
     cudf::detail::hostdevice_vector<void const*> compressed_data_ptrs(num_blocks, stream);
     std::transform(meta.block_list.begin(),
                    meta.block_list.end(),
                    compressed_data_ptrs.host_ptr(),
                    [&](auto const& block) {
-                     return static_cast<std::byte const*>(comp_block_data.data()) +
-                            (block.offset - meta.block_list[0].offset);
+                     return static_cast<std::byte const*>(comp_block_data.data()) + block.offset;
                    });
     compressed_data_ptrs.host_to_device_async(stream);
 
@@ -486,16 +607,14 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr)
 {
-  auto skip_rows = options.get_skip_rows();
-  auto num_rows  = options.get_num_rows();
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata_out;
 
   // Open the source Avro dataset metadata
   auto meta = metadata(source.get());
 
-  // Select and read partial metadata / schema within the subset of rows
-  meta.init_and_select_rows(skip_rows, num_rows);
+  // Read the file header
+  meta.init();
 
   // Select only columns required by the options
   auto selected_columns = meta.select_columns(options.get_columns());
@@ -510,97 +629,113 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
       column_types.emplace_back(col_type);
     }
 
-    if (meta.num_rows > 0) {
-      rmm::device_buffer block_data;
-      if (source->is_device_read_preferred(meta.selected_data_size)) {
-        block_data      = rmm::device_buffer{meta.selected_data_size, stream};
-        auto read_bytes = source->device_read(meta.block_list[0].offset,
-                                              meta.selected_data_size,
-                                              static_cast<uint8_t*>(block_data.data()),
-                                              stream);
-        block_data.resize(read_bytes, stream);
-      } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.selected_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
-      }
+    size_t total_dictionary_entries = 0;
+    size_t dictionary_data_size     = 0;
 
-      if (meta.codec != "" && meta.codec != "null") {
-        auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
-        block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = meta.block_list[0].offset;
-        for (size_t i = 0; i < meta.block_list.size(); i++) {
-          meta.block_list[i].offset -= dst_ofs;
-        }
+    auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
+
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      auto col_idx     = selected_columns[i].first;
+      auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
+      dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
+      dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
+      total_dictionary_entries += dict[i].second;
+      for (auto const& sym : col_schema.symbols) {
+        dictionary_data_size += sym.length();
       }
+    }
 
-      size_t total_dictionary_entries = 0;
-      size_t dictionary_data_size     = 0;
+    auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
+    auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
 
-      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
+    if (total_dictionary_entries > 0) {
+      auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
+      auto h_global_dict_data = std::vector<char>(dictionary_data_size);
+      size_t dict_pos         = 0;
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
-        total_dictionary_entries += dict[i].second;
-        for (auto const& sym : col_schema.symbols) {
-          dictionary_data_size += sym.length();
+        auto const col_idx          = selected_columns[i].first;
+        auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
+        auto const col_dict_entries = &(h_global_dict[dict[i].first]);
+        for (size_t j = 0; j < dict[i].second; j++) {
+          auto const& symbols = col_schema.symbols[j];
+
+          auto const data_dst        = h_global_dict_data.data() + dict_pos;
+          auto const len             = symbols.length();
+          col_dict_entries[j].first  = data_dst;
+          col_dict_entries[j].second = len;
+
+          std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
+          dict_pos += len;
         }
       }
 
-      auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
-      auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
-
-      if (total_dictionary_entries > 0) {
-        auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
-        auto h_global_dict_data = std::vector<char>(dictionary_data_size);
-        size_t dict_pos         = 0;
-
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx          = selected_columns[i].first;
-          auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
-          for (size_t j = 0; j < dict[i].second; j++) {
-            auto const& symbols = col_schema.symbols[j];
+      d_global_dict = cudf::detail::make_device_uvector_async(
+        h_global_dict, stream, rmm::mr::get_current_device_resource());
+      d_global_dict_data = cudf::detail::make_device_uvector_async(
+        h_global_dict_data, stream, rmm::mr::get_current_device_resource());
 
-            auto const data_dst        = h_global_dict_data.data() + dict_pos;
-            auto const len             = symbols.length();
-            col_dict_entries[j].first  = data_dst;
-            col_dict_entries[j].second = len;
-
-            std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
-            dict_pos += len;
-          }
-        }
+      stream.synchronize();
+    }
 
-        d_global_dict = cudf::detail::make_device_uvector_async(
-          h_global_dict, stream, rmm::mr::get_current_device_resource());
-        d_global_dict_data = cudf::detail::make_device_uvector_async(
-          h_global_dict_data, stream, rmm::mr::get_current_device_resource());
+    // Read, decompress and decode the data blocks in passes over ranges of the file, so that the
+    // raw and decompressed data of at most one range is held in device memory at a time
+    auto rows                 = row_selector{options.get_skip_rows(), options.get_num_rows()};
+    auto const data_end       = source->size();
+    auto const read_limit     = options.get_pass_read_limit();
+    auto const pass_read_size = (read_limit > 0) ? read_limit : data_end;
+    auto read_size            = pass_read_size;
+    std::vector<std::unique_ptr<table>> pass_tables;
+    for (auto pass_start = meta.metadata_size;
+         pass_start + min_block_size < data_end and not rows.is_done();) {
+      auto const pass_end   = std::min(data_end, pass_start + read_size);
+      auto block_data       = read_data(*source, pass_start, pass_end - pass_start, stream);
+      auto const blocks_end = select_blocks(meta, block_data, rows, stream);
+      if (blocks_end == 0) {
+        // The first block does not fit in the range; retry with a larger range
+        CUDF_EXPECTS(pass_end < data_end, "Cannot parse data block");
+        read_size *= 2;
+        continue;
+      }
+      pass_start += blocks_end;
+      read_size = pass_read_size;
+      if (meta.num_rows == 0) { continue; }
 
-        stream.synchronize();
+      if (meta.codec != "" && meta.codec != "null") {
+        block_data = decompress_data(*source, meta, block_data, stream);
       }
 
       auto out_buffers = decode_data(meta,
                                      block_data,
                                      dict,
                                      d_global_dict,
-                                     num_rows,
+                                     meta.num_rows,
                                      selected_columns,
                                      column_types,
                                      stream,
                                      mr);
 
+      std::vector<std::unique_ptr<column>> pass_columns;
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
+        pass_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
       }
-    } else {
+      pass_tables.emplace_back(std::make_unique<table>(std::move(pass_columns)));
+    }
+
+    if (pass_tables.empty()) {
       // Create empty columns
       for (size_t i = 0; i < column_types.size(); ++i) {
         out_columns.emplace_back(make_empty_column(column_types[i]));
       }
+    } else if (pass_tables.size() == 1) {
+      out_columns = pass_tables.front()->release();
+    } else {
+      std::vector<table_view> pass_views;
+      std::transform(pass_tables.cbegin(),
+                     pass_tables.cend(),
+                     std::back_inserter(pass_views),
+                     [](auto const& tbl) { return tbl->view(); });
+      out_columns = cudf::detail::concatenate(pass_views, stream, mr)->release();
     }
   }
 
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "comp.hpp"
+
+#include "gpuinflate.hpp"
+#include "nvcomp_adapter.hpp"
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+#include <array>
+
+namespace cudf::io::detail {
+namespace {
+
+// Uncompressed size of a block; nvCOMP's Deflate and the Snappy framing format limit blocks to
+// 64KB, Zstandard benefits from larger blocks
+constexpr size_t gzip_block_size   = 64 * 1024;
+constexpr size_t snappy_block_size = 64 * 1024;
+constexpr size_t zstd_block_size   = 256 * 1024;
+
+// Device writes smaller than this are coalesced with other writes on the host
+constexpr size_t min_compressed_write_size = 64 * 1024;
+
+// Reflected CRC-32 polynomial, used by GZIP
+constexpr uint32_t crc32_polynomial = 0xedb88320;
+// Reflected CRC-32C (Castagnoli) polynomial, used by the Snappy framing format
+constexpr uint32_t crc32c_polynomial = 0x82f63b78;
+
+constexpr int crc_block_size = 128;
+
+// GZIP member header: magic, Deflate method, no flags, no modification time, unknown OS
+constexpr std::array<uint8_t, 10> gzip_header{0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+constexpr size_t gzip_trailer_size = 8;  // CRC-32 and size of the uncompressed data
+
+// Stream identifier chunk that starts a framed Snappy stream
+constexpr std::array<uint8_t, 10> snappy_stream_identifier{
+  0xff, 0x06, 0x00, 0x00, 's', 'N', 'a', 'P', 'p', 'Y'};
+constexpr uint8_t snappy_compressed_chunk = 0x00;
+constexpr size_t snappy_chunk_header_size = 8;  // type, 3-byte length, masked CRC-32C
+
+/**
+ * @brief Computes the CRC of each input buffer (one thread per buffer)
+ *
+ * @tparam polynomial Reflected CRC polynomial
+ *
+ * @param[in] inputs Buffers to compute the CRC of
+ * @param[out] crcs CRC of each buffer
+ */
+template <uint32_t polynomial>
+CUDF_KERNEL void __launch_bounds__(crc_block_size)
+  crc_kernel(device_span<device_span<uint8_t const> const> inputs, device_span<uint32_t> crcs)
+{
+  __shared__ uint32_t table[256];
+  for (int i = threadIdx.x; i < 256; i += crc_block_size) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; ++k) {
+      c = (c & 1) ? (c >> 1) ^ polynomial : c >> 1;
+    }
+    table[i] = c;
+  }
+  __syncthreads();
+
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx >= static_cast<thread_index_type>(inputs.size())) { return; }
+  uint32_t crc = ~0u;
+  for (auto const byte : inputs[idx]) {
+    crc = table[(crc ^ byte) & 0xff] ^ (crc >> 8);
+  }
+  crcs[idx] = ~crc;
+}
+
+nvcomp::compression_type to_nvcomp_compression_type(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP: return nvcomp::compression_type::DEFLATE;
+    case compression_type::SNAPPY: return nvcomp::compression_type::SNAPPY;
+    case compression_type::ZSTD: return nvcomp::compression_type::ZSTD;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+size_t compression_block_size(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP: return gzip_block_size;
+    case compression_type::SNAPPY: return snappy_block_size;
+    case compression_type::ZSTD: return zstd_block_size;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+size_t block_header_size(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP: return gzip_header.size();
+    case compression_type::SNAPPY: return snappy_chunk_header_size;
+    default: return 0;
+  }
+}
+
+size_t block_trailer_size(compression_type compression)
+{
+  return compression == compression_type::GZIP ? gzip_trailer_size : 0;
+}
+
+void write_le32(uint8_t* dst, uint32_t value)
+{
+  for (int i = 0; i < 4; ++i) {
+    dst[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+void compress_blocks(compression_type compression,
+                     device_span<device_span<uint8_t const> const> inputs,
+                     device_span<device_span<uint8_t> const> outputs,
+                     device_span<compression_result> results,
+                     rmm::cuda_stream_view stream)
+{
+  auto const codec = to_nvcomp_compression_type(compression);
+  if (compression == compression_type::SNAPPY and nvcomp::is_compression_disabled(codec)) {
+    gpu_snap(inputs, outputs, results, stream);
+    return;
+  }
+  if (auto const reason = nvcomp::is_compression_disabled(codec); reason) {
+    CUDF_FAIL("Compression error: " + reason.value());
+  }
+  nvcomp::batched_compress(codec, inputs, outputs, results, stream);
+}
+
+}  // namespace
+
+bool is_supported_stream_compression(compression_type compression)
+{
+  return compression == compression_type::GZIP or compression == compression_type::SNAPPY or
+         compression == compression_type::ZSTD;
+}
+
+std::vector<uint8_t> compress(compression_type compression,
+                              device_span<uint8_t const> src,
+                              rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_supported_stream_compression(compression), "Unsupported compression type");
+  if (src.empty()) { return {}; }
+
+  auto const mr         = rmm::mr::get_current_device_resource();
+  auto const block_size = compression_block_size(compression);
+  auto const num_blocks = cudf::util::div_rounding_up_unsafe(src.size(), block_size);
+  // Keep the output of each block aligned for the compressors
+  auto const max_comp_block_size = cudf::util::round_up_unsafe(
+    nvcomp::compress_max_output_chunk_size(to_nvcomp_compression_type(compression), block_size),
+    size_t{8});
+
+  rmm::device_buffer comp_data(num_blocks * max_comp_block_size, stream);
+  auto const comp_base = static_cast<uint8_t*>(comp_data.data());
+  std::vector<device_span<uint8_t const>> blocks;
+  std::vector<device_span<uint8_t>> comp_blocks;
+  blocks.reserve(num_blocks);
+  comp_blocks.reserve(num_blocks);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    auto const offset = b * block_size;
+    blocks.emplace_back(src.subspan(offset, std::min(block_size, src.size() - offset)));
+    comp_blocks.emplace_back(comp_base + b * max_comp_block_size, max_comp_block_size);
+  }
+  auto const d_blocks      = cudf::detail::make_device_uvector_async(blocks, stream, mr);
+  auto const d_comp_blocks = cudf::detail::make_device_uvector_async(comp_blocks, stream, mr);
+
+  rmm::device_uvector<compression_result> results(num_blocks, stream);
+  thrust::fill(rmm::exec_policy_nosync(stream),
+               results.begin(),
+               results.end(),
+               compression_result{0, compression_status::FAILURE});
+  compress_blocks(compression, d_blocks, d_comp_blocks, results, stream);
+
+  // Zstandard frames are self-contained; the other formats store a CRC of each block
+  auto const has_crc = compression != compression_type::ZSTD;
+  rmm::device_uvector<uint32_t> crcs(has_crc ? num_blocks : 0, stream);
+  if (has_crc) {
+    auto const grid_size = cudf::util::div_rounding_up_unsafe(num_blocks, size_t{crc_block_size});
+    if (compression == compression_type::GZIP) {
+      crc_kernel<crc32_polynomial>
+        <<<grid_size, crc_block_size, 0, stream.value()>>>(d_blocks, crcs);
+    } else {
+      crc_kernel<crc32c_polynomial>
+        <<<grid_size, crc_block_size, 0, stream.value()>>>(d_blocks, crcs);
+    }
+  }
+
+  auto const h_results = cudf::detail::make_std_vector_sync(results, stream);
+  CUDF_EXPECTS(std::all_of(h_results.begin(),
+                           h_results.end(),
+                           [](auto const& res) {
+                             return res.status == compression_status::SUCCESS;
+                           }),
+               "Compression failed");
+  auto const h_crcs = cudf::detail::make_std_vector_sync(crcs, stream);
+
+  // Gather the compressed blocks, leaving room for the block headers and trailers
+  auto const header_size  = block_header_size(compression);
+  auto const trailer_size = block_trailer_size(compression);
+  std::vector<size_t> offsets(num_blocks + 1, 0);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    offsets[b + 1] = offsets[b] + header_size + h_results[b].bytes_written + trailer_size;
+  }
+  rmm::device_buffer framed_data(offsets.back(), stream);
+  auto const framed_base = static_cast<uint8_t*>(framed_data.data());
+  std::vector<device_span<uint8_t const>> comp_in;
+  std::vector<device_span<uint8_t>> framed_out;
+  comp_in.reserve(num_blocks);
+  framed_out.reserve(num_blocks);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    comp_in.emplace_back(comp_blocks[b].data(), h_results[b].bytes_written);
+    framed_out.emplace_back(framed_base + offsets[b] + header_size, h_results[b].bytes_written);
+  }
+  auto const d_comp_in    = cudf::detail::make_device_uvector_async(comp_in, stream, mr);
+  auto const d_framed_out = cudf::detail::make_device_uvector_async(framed_out, stream, mr);
+  gpu_copy_uncompressed_blocks(d_comp_in, d_framed_out, stream);
+
+  std::vector<uint8_t> output(offsets.back());
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    output.data(), framed_data.data(), output.size(), cudaMemcpyDefault, stream.value()));
+  stream.synchronize();
+
+  for (size_t b = 0; b < num_blocks; ++b) {
+    auto const block     = output.data() + offsets[b];
+    auto const comp_size = h_results[b].bytes_written;
+    switch (compression) {
+      case compression_type::GZIP:
+        std::copy(gzip_header.begin(), gzip_header.end(), block);
+        write_le32(block + header_size + comp_size, h_crcs[b]);
+        write_le32(block + header_size + comp_size + 4, static_cast<uint32_t>(blocks[b].size()));
+        break;
+      case compression_type::SNAPPY: {
+        // Chunk length includes the CRC; the CRC is masked as specified by the framing format
+        auto const chunk_size = static_cast<uint32_t>(comp_size + 4);
+        auto const masked_crc = ((h_crcs[b] >> 15) | (h_crcs[b] << 17)) + 0xa282ead8u;
+        block[0]              = snappy_compressed_chunk;
+        block[1]              = static_cast<uint8_t>(chunk_size);
+        block[2]              = static_cast<uint8_t>(chunk_size >> 8);
+        block[3]              = static_cast<uint8_t>(chunk_size >> 16);
+        write_le32(block + 4, masked_crc);
+        break;
+      }
+      default: break;
+    }
+  }
+  return output;
+}
+
+compressed_sink::compressed_sink(compression_type compression,
+                                 data_sink* sink,
+                                 rmm::cuda_stream_view stream)
+  : _compression{compression}, _sink{sink}, _stream{stream}
+{
+  CUDF_EXPECTS(is_supported_stream_compression(compression),
+               "Unsupported compression type; supported types are GZIP, SNAPPY and ZSTD");
+}
+
+void compressed_sink::host_write(void const* data, size_t size)
+{
+  auto const bytes = static_cast<uint8_t const*>(data);
+  _pending.insert(_pending.end(), bytes, bytes + size);
+  if (_pending.size() >= min_compressed_write_size) { write_compressed(nullptr, 0, _stream); }
+}
+
+void compressed_sink::device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream)
+{
+  if (size < min_compressed_write_size) {
+    auto const pending_size = _pending.size();
+    _pending.resize(pending_size + size);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      _pending.data() + pending_size, gpu_data, size, cudaMemcpyDefault, stream.value()));
+    stream.synchronize();
+    if (_pending.size() >= min_compressed_write_size) { write_compressed(nullptr, 0, stream); }
+    return;
+  }
+  write_compressed(gpu_data, size, stream);
+}
+
+void compressed_sink::flush()
+{
+  if (not _pending.empty()) { write_compressed(nullptr, 0, _stream); }
+  _sink->flush();
+}
+
+void compressed_sink::write_compressed(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream)
+{
+  // Compress the pending data and the device data together, in a buffer aligned for the
+  // compressors, so that the pending data does not end up in a separate, small block
+  rmm::device_buffer data(_pending.size() + size, stream);
+  auto const data_ptr = static_cast<uint8_t*>(data.data());
+  if (not _pending.empty()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      data_ptr, _pending.data(), _pending.size(), cudaMemcpyDefault, stream.value()));
+  }
+  if (size > 0) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      data_ptr + _pending.size(), gpu_data, size, cudaMemcpyDefault, stream.value()));
+  }
+
+  auto const compressed =
+    compress(_compression, device_span<uint8_t const>{data_ptr, data.size()}, stream);
+  _pending.clear();
+
+  if (not _is_stream_started and _compression == compression_type::SNAPPY) {
+    _sink->host_write(snappy_stream_identifier.data(), snappy_stream_identifier.size());
+  }
+  _is_stream_started = true;
+  _sink->host_write(compressed.data(), compressed.size());
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Returns whether `compression` is supported by the GPU stream compressor
+ *
+ * @param compression Compression type
+ */
+[[nodiscard]] bool is_supported_stream_compression(compression_type compression);
+
+/**
+ * @brief Compresses a device buffer on the GPU into a sequence of independently compressed blocks
+ *
+ * The output is framed in the format of the compression type, so that the concatenation of the
+ * outputs of several calls is a valid compressed stream:
+ *  - GZIP: one GZIP member per block
+ *  - SNAPPY: one compressed data chunk of the Snappy framing format per block; the stream
+ *    identifier that starts a framed Snappy stream is not included
+ *  - ZSTD: one Zstandard frame per block
+ *
+ * @param compression Compression type; one of GZIP, SNAPPY and ZSTD
+ * @param src Device buffer to compress
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The compressed data in host memory
+ */
+[[nodiscard]] std::vector<uint8_t> compress(compression_type compression,
+                                            device_span<uint8_t const> src,
+                                            rmm::cuda_stream_view stream);
+
+/**
+ * @brief Data sink that compresses the written data on the GPU before passing it to another sink
+ *
+ * Small writes are coalesced on the host and compressed together with the next large write, or
+ * when the sink is flushed; `flush()` must be called after the last write.
+ */
+class compressed_sink : public data_sink {
+ public:
+  /**
+   * @brief Constructs a sink that writes compressed data to `sink`
+   *
+   * @param compression Compression type; one of GZIP, SNAPPY and ZSTD
+   * @param sink Sink that receives the compressed data
+   * @param stream CUDA stream used to compress data written from host memory
+   */
+  compressed_sink(compression_type compression, data_sink* sink, rmm::cuda_stream_view stream);
+
+  void host_write(void const* data, size_t size) override;
+
+  [[nodiscard]] bool supports_device_write() const override { return true; }
+
+  [[nodiscard]] bool is_device_write_preferred(size_t size) const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override;
+
+  void flush() override;
+
+  size_t bytes_written() override { return _sink->bytes_written(); }
+
+ private:
+  /**
+   * @brief Compresses the pending host data followed by `gpu_data` and writes it to the sink
+   */
+  void write_compressed(void const* gpu_data, size_t size, rmm::cuda_stream_view stream);
+
+  compression_type _compression;
+  data_sink* _sink;
+  rmm::cuda_stream_view _stream;
+  std::vector<uint8_t> _pending;  // small writes that have not been compressed yet
+  bool _is_stream_started = false;
+};
+
+}  // namespace cudf::io::detail
@@ -82,6 +82,7 @@ For more information on these sources, see the manual.
 #include "io_uncomp.hpp"
 #include "unbz2.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <vector>
@@ -597,5 +598,76 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+std::vector<uint64_t> find_bz2_block_starts(uint8_t const* input,
+                                            size_t inlen,
+                                            size_t begin,
+                                            size_t end)
+{
+  constexpr uint64_t block_signature = 0x3141'5926'5359;  // 48-bit block start signature
+
+  std::vector<uint64_t> block_starts;
+  end = std::min(end, inlen);
+  if (begin >= end) { return block_starts; }
+
+  // Sliding window over the 8 bytes starting at byte `i`; covers signatures at any bit offset
+  uint64_t window = 0;
+  for (size_t j = begin; j < begin + 8; j++) {
+    window = (window << 8) | (j < inlen ? input[j] : 0);
+  }
+  for (size_t i = begin; i < end; i++) {
+    for (uint32_t shift = 0; shift < 8; shift++) {
+      if (((window << shift) >> 16) == block_signature) { block_starts.push_back(i * 8 + shift); }
+    }
+    window = (window << 8) | (i + 8 < inlen ? input[i + 8] : 0);
+  }
+  return block_starts;
+}
+
+int32_t cpu_bz2_uncompress_block(uint8_t const* input,
+                                 size_t inlen,
+                                 uint64_t block_start,
+                                 std::vector<uint8_t>& dst,
+                                 uint64_t* block_end)
+{
+  unbz_state_s s{};
+  int32_t ret;
+
+  if (input == nullptr || block_end == nullptr || inlen < 12) return BZ_PARAM_ERROR;
+  if (input[0] != BZ_HDR_B || input[1] != BZ_HDR_Z || input[2] != BZ_HDR_h)
+    return BZ_DATA_ERROR_MAGIC;
+  if (input[3] < BZ_HDR_0 + 1 || input[3] > BZ_HDR_0 + 9) return BZ_DATA_ERROR_MAGIC;
+  s.blockSize100k = input[3] - BZ_HDR_0;
+
+  // We will not read the final combined CRC (last 4 bytes of the file)
+  s.base   = input;
+  s.end    = input + inlen - 4;
+  s.cur    = input + (size_t)(block_start >> 3);
+  s.bitpos = (uint32_t)(block_start & 7);
+  if (block_start < bz2_first_block_start || s.cur + 8 > s.end) return BZ_PARAM_ERROR;
+  s.bitbuf = __builtin_bswap64(*reinterpret_cast<uint64_t const*>(s.cur));
+
+  s.tt.resize(s.blockSize100k * 100000);
+
+  ret = bz2_decompress_block(&s);
+  if (ret != BZ_OK && ret != BZ_STREAM_END) return ret;
+  *block_end = ((s.cur - s.base) << 3) + (s.bitpos);
+
+  // The run-length decoder counts the output bytes past the end of the buffer, so a second pass
+  // with the exact output size is enough if the initial guess is too small
+  dst.resize(std::max<size_t>(s.save_nblock, 1));
+  for (int pass = 0; pass < 2; pass++) {
+    s.out     = dst.data();
+    s.outend  = dst.data() + dst.size();
+    s.outbase = dst.data();
+    bzUnRLE(&s);
+    if (s.out <= s.outend) break;
+    dst.resize(s.out - s.outbase);
+  }
+  if (s.nblock_used != s.save_nblock + 1) return BZ_UNEXPECTED_EOF;
+  dst.resize(s.out - s.outbase);
+
+  return ret;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace cudf::io {
+
+/**
+ * @brief Size classes of compressed chunks, based on their uncompressed size
+ *
+ * Decompressing all chunks of a batch in a single call lets a few large chunks dominate the
+ * latency of the call, while the scratch memory and the launch configuration of batched
+ * decompressors are sized for the largest chunk. Decompressing each size class separately keeps
+ * the work per chunk, and the resources per batch, uniform.
+ */
+enum class chunk_size_bucket : int { SMALL, MEDIUM, LARGE };
+
+constexpr std::size_t num_chunk_size_buckets = 3;
+
+// Largest uncompressed size of a chunk in the `SMALL` bucket
+constexpr std::size_t small_chunk_max_size = 64 * 1024;
+// Largest uncompressed size of a chunk in the `MEDIUM` bucket
+constexpr std::size_t medium_chunk_max_size = 1024 * 1024;
+
+/**
+ * @brief Returns the size bucket of a chunk with the given uncompressed size
+ */
+constexpr chunk_size_bucket get_chunk_size_bucket(std::size_t uncomp_size)
+{
+  if (uncomp_size <= small_chunk_max_size) { return chunk_size_bucket::SMALL; }
+  if (uncomp_size <= medium_chunk_max_size) { return chunk_size_bucket::MEDIUM; }
+  return chunk_size_bucket::LARGE;
+}
+
+/**
+ * @brief Chunks of a batch, grouped by size bucket
+ */
+struct chunk_size_buckets {
+  /// Chunk indices, grouped by bucket; chunks of the same bucket keep their input order
+  std::vector<std::size_t> chunks;
+  /// Offsets of the buckets in `chunks`
+  std::array<std::size_t, num_chunk_size_buckets + 1> offsets{};
+  /// Uncompressed size of the largest chunk in each bucket
+  std::array<std::size_t, num_chunk_size_buckets> max_uncomp_size{};
+  /// Total uncompressed size of the chunks in each bucket
+  std::array<std::size_t, num_chunk_size_buckets> total_uncomp_size{};
+
+  /**
+   * @brief Returns the number of chunks in the given bucket
+   */
+  [[nodiscard]] std::size_t size(chunk_size_bucket bucket) const
+  {
+    auto const b = static_cast<int>(bucket);
+    return offsets[b + 1] - offsets[b];
+  }
+};
+
+/**
+ * @brief Groups the chunks of a batch by the size bucket of their uncompressed size
+ *
+ * The relative order of the chunks within a bucket is preserved.
+ *
+ * @param uncomp_sizes Uncompressed size of each chunk
+ * @return Chunk indices grouped by bucket, with the per-bucket maximum and total sizes
+ */
+inline chunk_size_buckets bucket_chunks_by_size(std::vector<std::size_t> const& uncomp_sizes)
+{
+  chunk_size_buckets buckets;
+  std::array<std::size_t, num_chunk_size_buckets> counts{};
+  for (auto const size : uncomp_sizes) {
+    auto const b = static_cast<int>(get_chunk_size_bucket(size));
+    ++counts[b];
+    buckets.max_uncomp_size[b] = std::max(buckets.max_uncomp_size[b], size);
+    buckets.total_uncomp_size[b] += size;
+  }
+  for (std::size_t b = 0; b < num_chunk_size_buckets; ++b) {
+    buckets.offsets[b + 1] = buckets.offsets[b] + counts[b];
+  }
+
+  buckets.chunks.resize(uncomp_sizes.size());
+  auto next = buckets.offsets;
+  for (std::size_t i = 0; i < uncomp_sizes.size(); ++i) {
+    auto const b              = static_cast<int>(get_chunk_size_bucket(uncomp_sizes[i]));
+    buckets.chunks[next[b]++] = i;
+  }
+  return buckets;
+}
+
+}  // namespace cudf::io
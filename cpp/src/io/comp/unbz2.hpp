@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,48 @@ int32_t cpu_bz2_uncompress(uint8_t const* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+/**
+ * @brief Bit offset of the first block of a bzip2 stream, after the 32-bit stream header
+ */
+constexpr uint64_t bz2_first_block_start = 32;
+
+/**
+ * @brief Finds the bit offsets of all potential block start signatures in a bzip2 stream
+ *
+ * Block signatures are not byte-aligned, and may also occur within the compressed data of a
+ * block; each returned offset is only a candidate block start.
+ *
+ * @param input Compressed bzip2 stream
+ * @param inlen Size of the compressed stream, in bytes
+ * @param begin First byte of the range to search
+ * @param end End of the range to search; signatures that start in [begin, end) are returned
+ * @return Sorted candidate bit offsets of block starts
+ */
+std::vector<uint64_t> find_bz2_block_starts(uint8_t const* input,
+                                            size_t inlen,
+                                            size_t begin,
+                                            size_t end);
+
+/**
+ * @brief Decompresses a single block of a bzip2 stream
+ *
+ * Blocks of a bzip2 stream are decoded independently of each other, so that the blocks of a
+ * stream can be decompressed in parallel once their start offsets are known.
+ *
+ * @param input Compressed bzip2 stream, including the stream header
+ * @param inlen Size of the compressed stream, in bytes
+ * @param block_start Bit offset of the start of the block
+ * @param dst Decompressed output; resized to the decompressed size of the block
+ * @param block_end Bit offset of the end of the block; the start of the next block if BZ_OK is
+ * returned
+ * @return BZ_OK if another block follows, BZ_STREAM_END if this is the last block of the stream,
+ * or an error code
+ */
+int32_t cpu_bz2_uncompress_block(uint8_t const* input,
+                                 size_t inlen,
+                                 uint64_t block_start,
+                                 std::vector<uint8_t>& dst,
+                                 uint64_t* block_end);
+
 }  // namespace io
 }  // namespace cudf
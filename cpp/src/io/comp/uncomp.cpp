@@ -14,20 +14,25 @@
  * limitations under the License.
  */
 
+#include "io/utilities/config_utils.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 #include "io_uncomp.hpp"
 #include "nvcomp_adapter.hpp"
 #include "unbz2.hpp"  // bz2 uncompress
 
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/thread_pool.hpp>
 
 #include <cuda_runtime.h>
 
 #include <zlib.h>  // uncompress
 
+#include <algorithm>
 #include <cstring>  // memset
+#include <future>
 
 using cudf::host_span;
 
@@ -277,6 +282,154 @@ void cpu_inflate_vector(std::vector<uint8_t>& dst, uint8_t const* comp_data, siz
   CUDF_EXPECTS(zerr == Z_STREAM_END, "Error in DEFLATE stream");
 }
 
+/**
+ * @brief Uncompresses all members of a GZIP stream to a char vector.
+ *
+ * A GZIP stream can consist of several concatenated members, e.g. when it is written in
+ * independently compressed blocks; its uncompressed data is the concatenation of the uncompressed
+ * data of the members. Data that follows the last member is ignored.
+ *
+ * @param[out] dst Destination vector, grown as needed
+ * @param[in] raw GZIP stream, starting with the header of the first member
+ * @param[in] len Size of the GZIP stream
+ */
+void cpu_inflate_gzip_vector(std::vector<uint8_t>& dst, uint8_t const* raw, size_t len)
+{
+  z_stream strm{};
+  strm.next_in   = const_cast<Bytef*>(reinterpret_cast<Bytef const*>(raw));
+  strm.avail_in  = len;
+  strm.next_out  = dst.data();
+  strm.avail_out = dst.size();
+  // 16 + 15 to decode the GZIP header and trailer of each member
+  auto zerr = inflateInit2(&strm, 16 + 15);
+  CUDF_EXPECTS(zerr == 0, "Error in GZIP stream");
+  // `total_out` is reset with each member
+  auto const out_pos = [&] { return static_cast<size_t>(strm.next_out - dst.data()); };
+  do {
+    if (strm.avail_out == 0) {
+      auto const pos = out_pos();
+      dst.resize(pos + std::clamp<size_t>(pos, 1 << 20, 1 << 30));
+      strm.next_out  = dst.data() + pos;
+      strm.avail_out = dst.size() - pos;
+    }
+    zerr = inflate(&strm, Z_SYNC_FLUSH);
+    // Continue with the next member, if any
+    if (zerr == Z_STREAM_END and strm.avail_in >= 2 and strm.next_in[0] == 0x1f and
+        strm.next_in[1] == 0x8b) {
+      zerr = inflateReset(&strm);
+    }
+  } while (zerr == Z_OK or (zerr == Z_BUF_ERROR and strm.avail_out == 0));
+  dst.resize(out_pos());
+  inflateEnd(&strm);
+  CUDF_EXPECTS(zerr == Z_STREAM_END, "Error in GZIP stream");
+}
+
+namespace {
+
+/**
+ * @brief Returns the thread pool used to decompress host buffers
+ *
+ * The pool size can be set with the `LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT` environment
+ * variable.
+ *
+ * @return The shared thread pool
+ */
+cudf::detail::thread_pool& host_decompression_thread_pool()
+{
+  constexpr std::size_t default_thread_count = 8;
+  static cudf::detail::thread_pool pool(cudf::io::detail::getenv_or(
+    "LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT", default_thread_count));
+  return pool;
+}
+
+// Minimum size of the input range that a thread searches for bzip2 block signatures
+constexpr size_t bz2_min_search_range_size = 1 << 20;
+
+struct bz2_block {
+  int32_t status;
+  uint64_t end;
+  std::vector<uint8_t> data;
+};
+
+}  // namespace
+
+/**
+ * @brief Uncompresses a BZIP2 stream, decompressing its blocks in parallel
+ *
+ * The blocks of a BZIP2 stream are independently compressed, but their start offsets are only
+ * known once the previous block has been decoded. The input is searched for block signatures
+ * instead, and every candidate block is decoded in parallel. The stream is then reassembled by
+ * following the blocks from the start of the stream, each block ending where the next one
+ * starts; candidates that are not actual block starts, i.e. signatures that occur in compressed
+ * data by chance, are not part of this chain and are discarded.
+ *
+ * @param raw BZIP2 stream, starting with the stream header
+ * @param len Size of the BZIP2 stream
+ * @return Uncompressed data
+ */
+std::vector<uint8_t> cpu_bz2_uncompress_parallel(uint8_t const* raw, size_t len)
+{
+  auto& pool = host_decompression_thread_pool();
+
+  auto const search_range_size =
+    std::max(bz2_min_search_range_size,
+             cudf::util::div_rounding_up_safe<size_t>(len, pool.get_thread_count()));
+  std::vector<std::future<std::vector<uint64_t>>> search_tasks;
+  for (size_t begin = 0; begin < len; begin += search_range_size) {
+    search_tasks.emplace_back(pool.submit([=] {
+      return find_bz2_block_starts(raw, len, begin, begin + search_range_size);
+    }));
+  }
+  std::vector<uint64_t> block_starts;
+  for (auto& task : search_tasks) {
+    auto const starts = task.get();
+    block_starts.insert(block_starts.end(), starts.begin(), starts.end());
+  }
+
+  auto const decode_block = [raw, len](uint64_t start) {
+    bz2_block block{};
+    block.status = cpu_bz2_uncompress_block(raw, len, start, block.data, &block.end);
+    return block;
+  };
+  std::vector<std::future<bz2_block>> decode_tasks;
+  decode_tasks.reserve(block_starts.size());
+  for (auto const start : block_starts) {
+    decode_tasks.emplace_back(pool.submit(decode_block, start));
+  }
+  std::vector<bz2_block> blocks;
+  blocks.reserve(decode_tasks.size());
+  for (auto& task : decode_tasks) {
+    blocks.emplace_back(task.get());
+  }
+
+  // Follow the chain of blocks from the start of the stream
+  std::vector<bz2_block const*> chain;
+  uint64_t start = bz2_first_block_start;
+  while (true) {
+    // Every block starts with a signature, so the start of each block is a candidate
+    auto const it = std::lower_bound(block_starts.begin(), block_starts.end(), start);
+    CUDF_EXPECTS(it != block_starts.end() and *it == start, "Decompression: error in stream");
+    auto const block = &blocks[std::distance(block_starts.begin(), it)];
+    CUDF_EXPECTS(block->status == BZ_OK or block->status == BZ_STREAM_END,
+                 "Decompression: error in stream");
+    chain.push_back(block);
+    if (block->status == BZ_STREAM_END) { break; }
+    start = block->end;
+  }
+
+  size_t uncomp_len = 0;
+  for (auto const block : chain) {
+    uncomp_len += block->data.size();
+  }
+  std::vector<uint8_t> dst(uncomp_len);
+  size_t dst_ofs = 0;
+  for (auto const block : chain) {
+    std::copy(block->data.begin(), block->data.end(), dst.begin() + dst_ofs);
+    dst_ofs += block->data.size();
+  }
+  return dst;
+}
+
 std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t const> src)
 {
   CUDF_EXPECTS(src.data() != nullptr, "Decompression: Source cannot be nullptr");
@@ -362,34 +515,19 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
                                        // ~4:1 compression for initial size
   }
 
-  if (compression == compression_type::GZIP || compression == compression_type::ZIP) {
+  if (compression == compression_type::GZIP) {
+    std::vector<uint8_t> dst(uncomp_len);
+    cpu_inflate_gzip_vector(dst, raw, src.size());
+    return dst;
+  }
+  if (compression == compression_type::ZIP) {
     // INFLATE
     std::vector<uint8_t> dst(uncomp_len);
     cpu_inflate_vector(dst, comp_data, comp_len);
     return dst;
   }
   if (compression == compression_type::BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<uint8_t> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err = cpu_bz2_uncompress(comp_data, comp_len, dst.data() + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
-    return dst;
+    return cpu_bz2_uncompress_parallel(comp_data, comp_len);
   }
 
   CUDF_FAIL("Unsupported compressed stream type");
@@ -502,7 +640,7 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
 }
 
 /**
- * @brief ZSTD decompressor that uses nvcomp
+ * @brief ZSTD decompressor that uses nvcomp, or the cuDF decoder if nvcomp's is disabled
  */
 size_t decompress_zstd(host_span<uint8_t const> src,
                        host_span<uint8_t> dst,
@@ -525,13 +663,17 @@ size_t decompress_zstd(host_span<uint8_t const> src,
   hd_stats[0]   = compression_result{0, compression_status::FAILURE};
   hd_stats.host_to_device_async(stream);
   auto const max_uncomp_page_size = dst.size();
-  nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                             hd_srcs,
-                             hd_dsts,
-                             hd_stats,
-                             max_uncomp_page_size,
-                             max_uncomp_page_size,
-                             stream);
+  if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+    gpu_unzstd(hd_srcs, hd_dsts, hd_stats, stream);
+  } else {
+    nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                               hd_srcs,
+                               hd_dsts,
+                               hd_stats,
+                               max_uncomp_page_size,
+                               max_uncomp_page_size,
+                               stream);
+  }
 
   hd_stats.device_to_host_sync(stream);
   CUDF_EXPECTS(hd_stats[0].status == compression_status::SUCCESS, "ZSTD decompression failed");
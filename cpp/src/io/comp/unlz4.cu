@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unlz4.cu
+ *
+ * CUDA-based LZ4 decompression
+ *
+ * LZ4 Block Format
+ * https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ */
+
+#include "gpuinflate.hpp"
+
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+// One warp per compressed block
+constexpr int unlz4_block_size = 32;
+// Number of sequences that are parsed before the warp copies them to the output
+constexpr int unlz4_batch_size = 32;
+constexpr uint32_t min_match_length = 4;
+
+/**
+ * @brief Describes a single LZ4 sequence: literals followed by a copy of earlier output
+ */
+struct lz4_sequence_s {
+  uint32_t literal_start;   ///< Position of the literals in the compressed block
+  uint32_t literal_length;  ///< Number of literals
+  uint32_t match_offset;    ///< Distance of the copy source from the copy destination
+  uint32_t match_length;    ///< Number of bytes to copy; 0 for the last sequence
+};
+
+/**
+ * @brief LZ4 decompression state
+ */
+struct unlz4_state_s {
+  uint8_t const* src;  ///< input for current block
+  uint8_t* dst;        ///< output for current block
+  size_t src_size;     ///< size of the input
+  size_t dst_size;     ///< size of the output
+  uint32_t src_pos;           ///< position of the next sequence in the input
+  compression_status status;  ///< current status
+  int32_t batch_len;          ///< number of sequences in the batch
+  lz4_sequence_s batch[unlz4_batch_size];
+};
+
+/**
+ * @brief Reads the extension bytes of a literal or match length
+ *
+ * @return false if the input ends before the length does
+ */
+__device__ bool read_length(device_span<uint8_t const> src, uint32_t& pos, uint32_t& length)
+{
+  uint8_t byte;
+  do {
+    if (pos >= src.size()) { return false; }
+    byte = src[pos++];
+    length += byte;
+  } while (byte == 0xff);
+  return true;
+}
+
+/**
+ * @brief Parses the next batch of sequences of the block (single thread)
+ *
+ * @param s decompression state
+ * @param out_pos number of bytes written by the previous sequences
+ */
+__device__ void lz4_parse_sequences(unlz4_state_s* s, size_t out_pos)
+{
+  auto const src = device_span<uint8_t const>{s->src, s->src_size};
+  auto pos       = s->src_pos;
+  int32_t count  = 0;
+  while (count < unlz4_batch_size && pos < src.size()) {
+    auto const token = src[pos++];
+
+    uint32_t literal_length = token >> 4;
+    if (literal_length == 0xf and not read_length(src, pos, literal_length)) {
+      s->status = compression_status::FAILURE;
+      break;
+    }
+    if (literal_length > src.size() - pos) {
+      s->status = compression_status::FAILURE;
+      break;
+    }
+    auto const literal_start = pos;
+    pos += literal_length;
+
+    // The last sequence only has literals
+    uint32_t match_offset = 0;
+    uint32_t match_length = 0;
+    if (pos < src.size()) {
+      if (pos + 2 > src.size()) {
+        s->status = compression_status::FAILURE;
+        break;
+      }
+      match_offset = src[pos] | (src[pos + 1] << 8);
+      pos += 2;
+      match_length = token & 0xf;
+      if (match_length == 0xf and not read_length(src, pos, match_length)) {
+        s->status = compression_status::FAILURE;
+        break;
+      }
+      match_length += min_match_length;
+      if (match_offset == 0 or match_offset > out_pos + literal_length) {
+        s->status = compression_status::FAILURE;
+        break;
+      }
+    }
+    if (static_cast<size_t>(literal_length) + match_length > s->dst_size - out_pos) {
+      s->status = compression_status::OUTPUT_OVERFLOW;
+      break;
+    }
+
+    s->batch[count++] = {literal_start, literal_length, match_offset, match_length};
+    out_pos += literal_length + match_length;
+  }
+  s->src_pos   = pos;
+  s->batch_len = (s->status == compression_status::SUCCESS) ? count : 0;
+}
+
+/**
+ * @brief Writes the literals and the match of a sequence to the output (warp)
+ *
+ * The source of every byte of a match lies before the match, so the bytes of the match are
+ * independent of each other even if the match overlaps its source.
+ *
+ * @param s decompression state
+ * @param seq sequence to write
+ * @param out_pos number of bytes written by the previous sequences, updated
+ * @param t warp lane id
+ */
+__device__ void lz4_write_sequence(unlz4_state_s const* s,
+                                   lz4_sequence_s const& seq,
+                                   size_t& out_pos,
+                                   int t)
+{
+  auto const literals = s->src + seq.literal_start;
+  auto out            = s->dst + out_pos;
+  for (uint32_t i = t; i < seq.literal_length; i += unlz4_block_size) {
+    out[i] = literals[i];
+  }
+  __syncwarp();
+
+  out += seq.literal_length;
+  auto const match_src = out - seq.match_offset;
+  for (uint32_t i = t; i < seq.match_length; i += unlz4_block_size) {
+    out[i] = match_src[i % seq.match_offset];
+  }
+  __syncwarp();
+
+  out_pos += seq.literal_length + seq.match_length;
+}
+
+/**
+ * @brief LZ4 decompression kernel
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source buffers, one raw LZ4 block per buffer
+ * @param[out] outputs Destination buffers
+ * @param[out] results Decompression status per block
+ */
+CUDF_KERNEL void __launch_bounds__(unlz4_block_size)
+  unlz4_kernel(device_span<device_span<uint8_t const> const> inputs,
+               device_span<device_span<uint8_t> const> outputs,
+               device_span<compression_result> results)
+{
+  __shared__ __align__(16) unlz4_state_s state_g;
+  int const t        = threadIdx.x;
+  unlz4_state_s* s   = &state_g;
+  auto const strm_id = blockIdx.x;
+
+  if (t == 0) {
+    s->src      = inputs[strm_id].data();
+    s->dst      = outputs[strm_id].data();
+    s->src_size = inputs[strm_id].size();
+    s->dst_size = outputs[strm_id].size();
+    s->src_pos  = 0;
+    // An empty block still consists of a token
+    s->status = s->src_size == 0 ? compression_status::FAILURE : compression_status::SUCCESS;
+  }
+  __syncwarp();
+
+  size_t out_pos = 0;
+  while (true) {
+    if (t == 0 and s->status == compression_status::SUCCESS) { lz4_parse_sequences(s, out_pos); }
+    __syncwarp();
+    auto const batch_len = (s->status == compression_status::SUCCESS) ? s->batch_len : 0;
+    __syncwarp();
+    if (batch_len == 0) { break; }
+    for (int i = 0; i < batch_len; ++i) {
+      lz4_write_sequence(s, s->batch[i], out_pos, t);
+    }
+  }
+
+  if (t == 0) {
+    results[strm_id].bytes_written = out_pos;
+    results[strm_id].status        = s->status;
+    results[strm_id].reserved      = 0;
+  }
+}
+
+}  // namespace
+
+void gpu_unlz4(device_span<device_span<uint8_t const> const> inputs,
+               device_span<device_span<uint8_t> const> outputs,
+               device_span<compression_result> results,
+               rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(unlz4_block_size, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(inputs.size(), 1);
+  if (inputs.size() > 0) {
+    unlz4_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, results);
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,1086 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unzstd.cu
+ *
+ * CUDA-based Zstandard decompression
+ *
+ * Zstandard Compression and the 'application/zstd' Media Type
+ * https://www.rfc-editor.org/rfc/rfc8878
+ *
+ * Each input is decoded by a single warp. Lane 0 parses the frame, block and table headers and
+ * decodes the sequences in batches; the warp decodes the (up to four) Huffman literal streams and
+ * writes the literals and matches of each sequence to the output. Dictionaries are not supported
+ * and content checksums are not verified.
+ */
+
+#include "gpuinflate.hpp"
+
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+// One warp per compressed input
+constexpr int unzstd_block_size = 32;
+// Number of sequences that are decoded before the warp writes them to the output
+constexpr int unzstd_batch_size = 32;
+
+constexpr uint32_t zstd_frame_magic      = 0xfd2f'b528;
+constexpr uint32_t zstd_skippable_magic  = 0x184d'2a50;  // The lowest 4 bits may have any value
+constexpr uint32_t zstd_max_block_size   = 128 * 1024;
+constexpr int max_huffman_bits           = 11;
+constexpr int max_huffman_weight_log     = 6;
+constexpr int max_huffman_weight_symbol  = 12;
+constexpr int max_literal_length_log     = 9;
+constexpr int max_match_length_log       = 9;
+constexpr int max_offset_log             = 8;
+constexpr int max_literal_length_symbol  = 35;
+constexpr int max_match_length_symbol    = 52;
+constexpr int max_offset_symbol          = 31;
+constexpr int default_literal_length_log = 6;
+constexpr int default_match_length_log   = 6;
+constexpr int default_offset_log         = 5;
+constexpr int num_default_offset_symbols = 29;
+
+enum block_type_e : int32_t { RAW_BLOCK = 0, RLE_BLOCK, COMPRESSED_BLOCK, NO_BLOCK };
+
+enum literals_type_e : int32_t {
+  RAW_LITERALS = 0,
+  RLE_LITERALS,
+  HUFFMAN_LITERALS,
+  TREELESS_LITERALS
+};
+
+enum symbol_mode_e : uint32_t { PREDEFINED_MODE = 0, RLE_MODE, FSE_MODE, REPEAT_MODE };
+
+// Predefined distributions of the literal length, match length and offset codes
+__device__ __constant__ int16_t const default_literal_length_norm[max_literal_length_symbol + 1] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+  -1, -1, -1, -1};
+__device__ __constant__ int16_t const default_match_length_norm[max_match_length_symbol + 1] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+__device__ __constant__ int16_t const default_offset_norm[num_default_offset_symbols] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+
+// Baselines and numbers of extra bits of the literal length and match length codes
+__device__ __constant__ uint32_t const literal_length_base[max_literal_length_symbol + 1] = {
+  0,  1,  2,  3,  4,  5,  6,  7,  8,   9,   10,  11,   12,   13,   14,   15,   16,   18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+__device__ __constant__ uint8_t const literal_length_bits[max_literal_length_symbol + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 16};
+__device__ __constant__ uint32_t const match_length_base[max_match_length_symbol + 1] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11, 12,  13,  14,  15,  16,  17,   18,   19,   20,
+  21, 22, 23, 24, 25, 26, 27, 28, 29, 30,  31,  32,  33,  34,  35,   37,   39,   41,
+  43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+__device__ __constant__ uint8_t const match_length_bits[max_match_length_symbol + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+/**
+ * @brief Entry of an FSE decoding table
+ */
+struct fse_entry_s {
+  uint16_t baseline;  ///< Base of the next state
+  uint8_t symbol;     ///< Decoded symbol
+  uint8_t num_bits;   ///< Number of bits to add to the baseline to get the next state
+};
+
+/**
+ * @brief Decoded sequence
+ */
+struct zstd_sequence_s {
+  uint32_t literal_length;
+  uint32_t match_length;
+  uint32_t offset;
+};
+
+/**
+ * @brief Bitstream that is read backwards, from its last byte to its first one
+ */
+struct backward_bitstream_s {
+  uint8_t const* base;  ///< first byte of the stream
+  uint32_t size;        ///< size of the stream in bytes
+  int32_t pos;          ///< number of bits left; negative once more bits have been read than exist
+};
+
+/**
+ * @brief Zstandard decompression state
+ */
+struct unzstd_state_s {
+  uint8_t const* src;         ///< input for current stream
+  uint8_t* dst;               ///< output for current stream
+  size_t src_size;            ///< size of the input
+  size_t dst_size;            ///< size of the output
+  compression_status status;  ///< current status
+
+  uint32_t src_pos;      ///< position of the next block (or frame) in the input
+  size_t frame_start;    ///< output position of the current frame
+  bool in_frame;         ///< whether the last block of the current frame has not been read yet
+  bool has_checksum;     ///< whether the current frame ends with a content checksum
+  int32_t block_type;    ///< type of the current block
+  uint32_t block_start;  ///< position of the content of the current block in the input
+  uint32_t block_size;   ///< size of the current block (content size if compressed)
+
+  int32_t literals_type;       ///< type of the literals of the current block
+  uint32_t num_literals;       ///< number of literals of the current block
+  uint8_t const* literals;     ///< literals of the current block, once decoded
+  uint8_t rle_literal;         ///< value of all literals of the current block if RLE
+  uint32_t num_streams;        ///< number of Huffman streams of the literals
+  uint8_t const* streams[4];   ///< Huffman streams of the literals
+  uint32_t stream_sizes[4];    ///< sizes of the Huffman streams in bytes
+  uint32_t sequences_start;    ///< position of the sequences section in the block
+  uint32_t huffman_bits;       ///< maximum Huffman code length; 0 if there is no table yet
+  uint16_t huffman_table[1 << max_huffman_bits];  ///< (symbol << 8) | code length
+
+  int32_t literal_length_log;  ///< accuracy log of the table; -1 if there is no table yet
+  int32_t match_length_log;
+  int32_t offset_log;
+  fse_entry_s literal_length_table[1 << max_literal_length_log];
+  fse_entry_s match_length_table[1 << max_match_length_log];
+  fse_entry_s offset_table[1 << max_offset_log];
+  fse_entry_s weight_table[1 << max_huffman_weight_log];
+
+  uint32_t num_sequences;   ///< number of sequences of the current block
+  uint32_t sequences_left;  ///< number of sequences that have not been decoded yet
+  backward_bitstream_s sequence_bits;
+  uint32_t literal_length_state;
+  uint32_t match_length_state;
+  uint32_t offset_state;
+  uint32_t repeat_offsets[3];
+  int32_t batch_len;  ///< number of sequences in the batch
+  zstd_sequence_s batch[unzstd_batch_size];
+};
+
+inline __device__ uint32_t highbit(uint32_t v) { return 31 - __clz(v); }
+
+inline __device__ uint32_t load_le(uint8_t const* p, int num_bytes)
+{
+  uint32_t v = 0;
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+/**
+ * @brief Returns `num_bits` (up to 32) bits of a little-endian bit buffer, starting at bit `pos`
+ *
+ * Bits before the start or after the end of the buffer read as zeros.
+ */
+__device__ uint32_t get_bits(uint8_t const* base, uint32_t size, int64_t pos, uint32_t num_bits)
+{
+  if (num_bits == 0) { return 0; }
+  uint32_t shift = 0;
+  if (pos < 0) {
+    if (-pos >= num_bits) { return 0; }
+    shift = -pos;
+    num_bits -= shift;
+    pos = 0;
+  }
+  auto const first = static_cast<uint32_t>(pos >> 3);
+  if (first >= size) { return 0; }
+  auto const last = min(static_cast<uint32_t>((pos + num_bits - 1) >> 3), size - 1);
+  uint64_t bits   = 0;
+  for (auto i = last + 1; i > first; --i) {
+    bits = (bits << 8) | base[i - 1];
+  }
+  auto const mask = (1ul << num_bits) - 1;
+  return static_cast<uint32_t>((bits >> (pos & 7)) & mask) << shift;
+}
+
+/**
+ * @brief Initializes a backward bitstream; its last byte holds a 1 bit above the first bit to read
+ *
+ * @return false if the stream is empty or does not end with the 1 bit
+ */
+__device__ bool init_bitstream(backward_bitstream_s& bits, uint8_t const* base, uint32_t size)
+{
+  if (size == 0 or base[size - 1] == 0) { return false; }
+  bits.base = base;
+  bits.size = size;
+  bits.pos  = 8 * (size - 1) + highbit(base[size - 1]);
+  return true;
+}
+
+inline __device__ uint32_t peek_bits(backward_bitstream_s const& bits, uint32_t num_bits)
+{
+  return get_bits(bits.base, bits.size, static_cast<int64_t>(bits.pos) - num_bits, num_bits);
+}
+
+inline __device__ uint32_t read_bits(backward_bitstream_s& bits, uint32_t num_bits)
+{
+  auto const v = peek_bits(bits, num_bits);
+  bits.pos -= num_bits;
+  return v;
+}
+
+/**
+ * @brief Reads an FSE table description (normalized symbol counts)
+ *
+ * @return number of bytes of the description, 0 if it is invalid
+ */
+__device__ uint32_t read_fse_description(uint8_t const* data,
+                                         uint32_t size,
+                                         int max_symbol,
+                                         int max_log,
+                                         int16_t* norm,
+                                         int& num_symbols,
+                                         int& accuracy_log)
+{
+  if (size == 0) { return 0; }
+  for (int i = 0; i <= max_symbol; ++i) {
+    norm[i] = 0;
+  }
+  auto const log = static_cast<int>(get_bits(data, size, 0, 4)) + 5;
+  if (log > max_log) { return 0; }
+
+  int64_t pos        = 4;
+  int remaining      = (1 << log) + 1;
+  int threshold      = 1 << log;
+  int num_bits       = log + 1;
+  int symbol         = 0;
+  bool previous_zero = false;
+  while (remaining > 1 and symbol <= max_symbol) {
+    if (previous_zero) {
+      // 2-bit repeat flags give the number of additional zero counts; 3 means more flags follow
+      uint32_t repeat;
+      do {
+        repeat = get_bits(data, size, pos, 2);
+        pos += 2;
+        symbol += repeat;
+      } while (repeat == 3);
+      if (symbol > max_symbol) { break; }
+    }
+    auto const max  = (2 * threshold - 1) - remaining;
+    auto const bits = static_cast<int>(get_bits(data, size, pos, num_bits));
+    int count;
+    if ((bits & (threshold - 1)) < max) {
+      count = bits & (threshold - 1);
+      pos += num_bits - 1;
+    } else {
+      count = bits & (2 * threshold - 1);
+      if (count >= threshold) { count -= max; }
+      pos += num_bits;
+    }
+    --count;  // -1 stands for "less than one"
+    remaining -= (count < 0) ? -count : count;
+    norm[symbol++] = count;
+    previous_zero  = (count == 0);
+    while (remaining < threshold) {
+      --num_bits;
+      threshold >>= 1;
+    }
+  }
+  auto const num_bytes = static_cast<uint32_t>((pos + 7) >> 3);
+  if (remaining != 1 or symbol > max_symbol + 1 or num_bytes > size) { return 0; }
+  num_symbols  = symbol;
+  accuracy_log = log;
+  return num_bytes;
+}
+
+/**
+ * @brief Builds the FSE decoding table from the normalized symbol counts
+ *
+ * @return false if the counts are inconsistent
+ */
+__device__ bool build_fse_table(int16_t const* norm,
+                                int num_symbols,
+                                int accuracy_log,
+                                fse_entry_s* table)
+{
+  int const table_size = 1 << accuracy_log;
+  uint16_t next_state[max_match_length_symbol + 1];
+  int high = table_size - 1;
+  // Symbols with a "less than one" probability take a single cell at the end of the table
+  for (int s = 0; s < num_symbols; ++s) {
+    if (norm[s] == -1) {
+      if (high < 0) { return false; }
+      table[high--].symbol = s;
+      next_state[s]        = 1;
+    } else {
+      next_state[s] = norm[s];
+    }
+  }
+  int const step = (table_size >> 1) + (table_size >> 3) + 3;
+  int const mask = table_size - 1;
+  int pos        = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    for (int i = 0; i < norm[s]; ++i) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  if (pos != 0) { return false; }
+  for (int i = 0; i < table_size; ++i) {
+    auto const s        = table[i].symbol;
+    auto const state    = next_state[s]++;
+    auto const num_bits = accuracy_log - static_cast<int>(highbit(state));
+    table[i].num_bits   = num_bits;
+    table[i].baseline   = (state << num_bits) - table_size;
+  }
+  return true;
+}
+
+/**
+ * @brief Reads the Huffman tree description and builds the decoding table (single thread)
+ *
+ * @return number of bytes of the description, 0 if it is invalid
+ */
+__device__ uint32_t read_huffman_table(unzstd_state_s* s, uint8_t const* data, uint32_t size)
+{
+  if (size == 0) { return 0; }
+  uint8_t weights[256];
+  uint32_t num_weights = 0;
+  uint32_t num_bytes   = 0;
+  auto const header    = data[0];
+  if (header >= 128) {
+    // Weights are stored directly, 4 bits each
+    num_weights = header - 127;
+    num_bytes   = 1 + (num_weights + 1) / 2;
+    if (num_bytes > size) { return 0; }
+    for (uint32_t i = 0; i < num_weights; ++i) {
+      auto const byte = data[1 + i / 2];
+      weights[i]      = (i % 2 == 0) ? (byte >> 4) : (byte & 0xf);
+    }
+  } else {
+    // Weights are FSE compressed, with two interleaved states over a single table
+    num_bytes = 1 + header;
+    if (header == 0 or num_bytes > size) { return 0; }
+    int16_t norm[max_huffman_weight_symbol + 1];
+    int num_symbols             = 0;
+    int accuracy_log            = 0;
+    auto const description_size = read_fse_description(data + 1,
+                                                        header,
+                                                        max_huffman_weight_symbol,
+                                                        max_huffman_weight_log,
+                                                        norm,
+                                                        num_symbols,
+                                                        accuracy_log);
+    if (description_size == 0 or
+        not build_fse_table(norm, num_symbols, accuracy_log, s->weight_table)) {
+      return 0;
+    }
+    backward_bitstream_s bits;
+    if (not init_bitstream(bits, data + 1 + description_size, header - description_size)) {
+      return 0;
+    }
+    auto const table = s->weight_table;
+    uint32_t state[2];
+    state[0] = read_bits(bits, accuracy_log);
+    state[1] = read_bits(bits, accuracy_log);
+    for (int i = 0;; i ^= 1) {
+      if (num_weights >= 255) { return 0; }
+      auto const entry       = table[state[i]];
+      weights[num_weights++] = entry.symbol;
+      state[i]               = entry.baseline + read_bits(bits, entry.num_bits);
+      if (bits.pos < 0) {
+        // The stream is exhausted, the other state holds the last weight
+        if (num_weights >= 255) { return 0; }
+        weights[num_weights++] = table[state[i ^ 1]].symbol;
+        break;
+      }
+    }
+  }
+
+  // The weight of the last symbol is implied by the others adding up to a power of two
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < num_weights; ++i) {
+    if (weights[i] > max_huffman_bits) { return 0; }
+    if (weights[i] != 0) { total += 1 << (weights[i] - 1); }
+  }
+  if (total == 0) { return 0; }
+  auto const max_bits = highbit(total) + 1;
+  if (max_bits > max_huffman_bits) { return 0; }
+  auto const rest = (1u << max_bits) - total;
+  if ((rest & (rest - 1)) != 0) { return 0; }
+  weights[num_weights]   = highbit(rest) + 1;
+  auto const num_symbols = num_weights + 1;
+
+  // Codes are assigned by increasing weight, then by increasing symbol value
+  uint32_t rank_start[max_huffman_bits + 2] = {};
+  for (uint32_t i = 0; i < num_symbols; ++i) {
+    rank_start[weights[i]] += (weights[i] != 0) ? (1 << (weights[i] - 1)) : 0;
+  }
+  uint32_t next_start = 0;
+  for (uint32_t w = 1; w <= max_bits; ++w) {
+    auto const count = rank_start[w];
+    rank_start[w]    = next_start;
+    next_start += count;
+  }
+  for (uint32_t i = 0; i < num_symbols; ++i) {
+    auto const w = weights[i];
+    if (w == 0) { continue; }
+    auto const entry = static_cast<uint16_t>((i << 8) | (max_bits + 1 - w));
+    for (uint32_t j = 0; j < (1u << (w - 1)); ++j) {
+      s->huffman_table[rank_start[w] + j] = entry;
+    }
+    rank_start[w] += 1 << (w - 1);
+  }
+  s->huffman_bits = max_bits;
+  return num_bytes;
+}
+
+/**
+ * @brief Parses the literals section header of a compressed block (single thread)
+ *
+ * @param s decompression state
+ * @param block content of the block
+ * @param out_pos number of bytes written to the output
+ */
+__device__ void parse_literals_section(unzstd_state_s* s, uint8_t const* block, size_t out_pos)
+{
+  auto const size        = s->block_size;
+  auto const type        = block[0] & 3;
+  auto const size_format = (block[0] >> 2) & 3;
+  uint32_t num_literals  = 0;
+  uint32_t section_size  = 0;
+  s->literals_type       = type;
+  if (type == RAW_LITERALS or type == RLE_LITERALS) {
+    uint32_t header_size;
+    if ((size_format & 1) == 0) {
+      header_size  = 1;
+      num_literals = block[0] >> 3;
+    } else {
+      header_size = size_format == 1 ? 2 : 3;
+      if (header_size > size) {
+        s->status = compression_status::FAILURE;
+        return;
+      }
+      num_literals = load_le(block, header_size) >> 4;
+    }
+    section_size = header_size + ((type == RAW_LITERALS) ? num_literals : 1);
+    if (section_size > size) {
+      s->status = compression_status::FAILURE;
+      return;
+    }
+    s->literals = block + header_size;
+    if (type == RLE_LITERALS) { s->rle_literal = block[header_size]; }
+  } else {
+    uint32_t const header_size = (size_format < 2) ? 3 : size_format + 2;
+    uint32_t const size_bits   = (size_format < 2) ? 10 : 4 * size_format + 6;
+    if (header_size > size) {
+      s->status = compression_status::FAILURE;
+      return;
+    }
+    uint64_t header = 0;
+    for (int i = header_size - 1; i >= 0; --i) {
+      header = (header << 8) | block[i];
+    }
+    auto const mask           = (1u << size_bits) - 1;
+    num_literals              = (header >> 4) & mask;
+    auto const compressed_len = static_cast<uint32_t>((header >> (4 + size_bits)) & mask);
+    section_size              = header_size + compressed_len;
+    if (section_size > size) {
+      s->status = compression_status::FAILURE;
+      return;
+    }
+    auto data      = block + header_size;
+    auto data_size = compressed_len;
+    if (type == HUFFMAN_LITERALS) {
+      auto const table_size = read_huffman_table(s, data, data_size);
+      if (table_size == 0) {
+        s->status = compression_status::FAILURE;
+        return;
+      }
+      data += table_size;
+      data_size -= table_size;
+    } else if (s->huffman_bits == 0) {
+      // Treeless literals reuse the table of a previous block
+      s->status = compression_status::FAILURE;
+      return;
+    }
+    if (size_format == 0) {
+      s->num_streams     = 1;
+      s->streams[0]      = data;
+      s->stream_sizes[0] = data_size;
+    } else {
+      // Jump table with the sizes of the first three streams
+      if (data_size < 6) {
+        s->status = compression_status::FAILURE;
+        return;
+      }
+      s->num_streams = 4;
+      uint32_t total = 6;
+      for (int i = 0; i < 3; ++i) {
+        s->stream_sizes[i] = load_le(data + 2 * i, 2);
+        total += s->stream_sizes[i];
+      }
+      if (total > data_size or (num_literals + 3) / 4 * 3 > num_literals) {
+        s->status = compression_status::FAILURE;
+        return;
+      }
+      s->stream_sizes[3] = data_size - total;
+      auto stream        = data + 6;
+      for (int i = 0; i < 4; ++i) {
+        s->streams[i] = stream;
+        stream += s->stream_sizes[i];
+      }
+    }
+  }
+  if (num_literals > s->dst_size - out_pos) {
+    s->status = compression_status::OUTPUT_OVERFLOW;
+    return;
+  }
+  // Decoded literals are stored at the end of the output buffer; the output never overtakes them
+  if (type != RAW_LITERALS) { s->literals = s->dst + s->dst_size - num_literals; }
+  s->num_literals    = num_literals;
+  s->sequences_start = section_size;
+}
+
+/**
+ * @brief Builds the decoding table of one of the sequence codes, as selected by its mode
+ *
+ * @return number of bytes of the table description, or -1 if it is invalid
+ */
+__device__ int read_sequence_table(uint32_t mode,
+                                   uint8_t const* data,
+                                   uint32_t size,
+                                   int16_t const* default_norm,
+                                   int default_num_symbols,
+                                   int default_log,
+                                   int max_symbol,
+                                   int max_log,
+                                   fse_entry_s* table,
+                                   int32_t& log)
+{
+  switch (mode) {
+    case PREDEFINED_MODE: {
+      int16_t norm[max_match_length_symbol + 1];
+      for (int i = 0; i < default_num_symbols; ++i) {
+        norm[i] = default_norm[i];
+      }
+      log = default_log;
+      return build_fse_table(norm, default_num_symbols, default_log, table) ? 0 : -1;
+    }
+    case RLE_MODE:
+      if (size < 1 or data[0] > max_symbol) { return -1; }
+      table[0] = {0, data[0], 0};
+      log      = 0;
+      return 1;
+    case FSE_MODE: {
+      int16_t norm[max_match_length_symbol + 1];
+      int num_symbols  = 0;
+      int accuracy_log = 0;
+      auto const num_bytes =
+        read_fse_description(data, size, max_symbol, max_log, norm, num_symbols, accuracy_log);
+      if (num_bytes == 0 or not build_fse_table(norm, num_symbols, accuracy_log, table)) {
+        return -1;
+      }
+      log = accuracy_log;
+      return num_bytes;
+    }
+    default:
+      // Repeat the table of the previous block
+      return (log < 0) ? -1 : 0;
+  }
+}
+
+/**
+ * @brief Parses the sequences section header of a compressed block (single thread)
+ *
+ * @param s decompression state
+ * @param block content of the block
+ */
+__device__ void parse_sequences_section(unzstd_state_s* s, uint8_t const* block)
+{
+  auto data = block + s->sequences_start;
+  auto size = s->block_size - s->sequences_start;
+  if (size == 0) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  uint32_t num_sequences = data[0];
+  uint32_t header_size   = 1;
+  if (num_sequences >= 128) {
+    header_size = (num_sequences < 255) ? 2 : 3;
+    if (header_size > size) {
+      s->status = compression_status::FAILURE;
+      return;
+    }
+    num_sequences = (num_sequences < 255) ? ((num_sequences - 128) << 8) + data[1]
+                                          : load_le(data + 1, 2) + 0x7f00;
+  }
+  s->num_sequences  = num_sequences;
+  s->sequences_left = num_sequences;
+  if (num_sequences == 0) { return; }
+
+  if (header_size + 1 > size) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  auto const modes = data[header_size];
+  if ((modes & 3) != 0) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  data += header_size + 1;
+  size -= header_size + 1;
+
+  auto const literal_length_size = read_sequence_table(modes >> 6,
+                                                       data,
+                                                       size,
+                                                       default_literal_length_norm,
+                                                       max_literal_length_symbol + 1,
+                                                       default_literal_length_log,
+                                                       max_literal_length_symbol,
+                                                       max_literal_length_log,
+                                                       s->literal_length_table,
+                                                       s->literal_length_log);
+  if (literal_length_size < 0) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  data += literal_length_size;
+  size -= literal_length_size;
+  auto const offset_size = read_sequence_table((modes >> 4) & 3,
+                                               data,
+                                               size,
+                                               default_offset_norm,
+                                               num_default_offset_symbols,
+                                               default_offset_log,
+                                               max_offset_symbol,
+                                               max_offset_log,
+                                               s->offset_table,
+                                               s->offset_log);
+  if (offset_size < 0) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  data += offset_size;
+  size -= offset_size;
+  auto const match_length_size = read_sequence_table((modes >> 2) & 3,
+                                                     data,
+                                                     size,
+                                                     default_match_length_norm,
+                                                     max_match_length_symbol + 1,
+                                                     default_match_length_log,
+                                                     max_match_length_symbol,
+                                                     max_match_length_log,
+                                                     s->match_length_table,
+                                                     s->match_length_log);
+  if (match_length_size < 0) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  data += match_length_size;
+  size -= match_length_size;
+
+  auto& bits = s->sequence_bits;
+  if (not init_bitstream(bits, data, size)) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  s->literal_length_state = read_bits(bits, s->literal_length_log);
+  s->offset_state         = read_bits(bits, s->offset_log);
+  s->match_length_state   = read_bits(bits, s->match_length_log);
+}
+
+/**
+ * @brief Decodes the next batch of sequences of the block (single thread)
+ *
+ * @param s decompression state
+ * @param out_pos number of bytes written by the previous sequences
+ * @param literal_pos number of literals consumed by the previous sequences
+ */
+__device__ void decode_sequences(unzstd_state_s* s, size_t out_pos, uint32_t literal_pos)
+{
+  auto& bits     = s->sequence_bits;
+  auto& rep      = s->repeat_offsets;
+  auto const end = s->dst_size;
+  int32_t count  = 0;
+  while (count < unzstd_batch_size and s->sequences_left > 0) {
+    auto const ll_entry = s->literal_length_table[s->literal_length_state];
+    auto const of_entry = s->offset_table[s->offset_state];
+    auto const ml_entry = s->match_length_table[s->match_length_state];
+
+    auto const offset_code  = of_entry.symbol;
+    auto const offset_value = (1u << offset_code) + read_bits(bits, offset_code);
+    auto const match_length =
+      match_length_base[ml_entry.symbol] + read_bits(bits, match_length_bits[ml_entry.symbol]);
+    auto const literal_length = literal_length_base[ll_entry.symbol] +
+                                read_bits(bits, literal_length_bits[ll_entry.symbol]);
+
+    uint32_t offset;
+    if (offset_value > 3) {
+      offset = offset_value - 3;
+      rep[2] = rep[1];
+      rep[1] = rep[0];
+      rep[0] = offset;
+    } else {
+      // Repeat offsets are shifted by one if there are no literals
+      auto const idx = offset_value - 1 + (literal_length == 0 ? 1 : 0);
+      if (idx == 0) {
+        offset = rep[0];
+      } else {
+        offset = (idx == 3) ? rep[0] - 1 : rep[idx];
+        if (idx > 1) { rep[2] = rep[1]; }
+        rep[1] = rep[0];
+        rep[0] = offset;
+      }
+    }
+
+    if (--s->sequences_left > 0) {
+      s->literal_length_state = ll_entry.baseline + read_bits(bits, ll_entry.num_bits);
+      s->match_length_state   = ml_entry.baseline + read_bits(bits, ml_entry.num_bits);
+      s->offset_state         = of_entry.baseline + read_bits(bits, of_entry.num_bits);
+    } else if (bits.pos > 0) {
+      s->status = compression_status::FAILURE;
+    }
+    if (bits.pos < 0 or literal_length > s->num_literals - literal_pos or offset == 0 or
+        offset > out_pos + literal_length - s->frame_start) {
+      s->status = compression_status::FAILURE;
+    }
+    // The output must not reach the literals that are still to be written
+    auto const literals_left = s->num_literals - literal_pos;
+    if (s->status == compression_status::SUCCESS and match_length > end - out_pos - literals_left) {
+      s->status = compression_status::OUTPUT_OVERFLOW;
+    }
+    if (s->status != compression_status::SUCCESS) { break; }
+
+    s->batch[count++] = {literal_length, match_length, offset};
+    out_pos += literal_length + match_length;
+    literal_pos += literal_length;
+  }
+  s->batch_len = (s->status == compression_status::SUCCESS) ? count : 0;
+}
+
+/**
+ * @brief Copies literals to the output (warp)
+ *
+ * The literals may be stored later in the output buffer (but never earlier than the
+ * destination), so all lanes read before any lane writes.
+ */
+__device__ void write_literals(uint8_t* out, uint8_t const* literals, uint32_t count, int t)
+{
+  for (uint32_t i = 0; i < count; i += unzstd_block_size) {
+    auto const idx = i + t;
+    uint8_t b      = 0;
+    if (idx < count) { b = literals[idx]; }
+    __syncwarp();
+    if (idx < count) { out[idx] = b; }
+    __syncwarp();
+  }
+}
+
+/**
+ * @brief Writes the literals and the match of a sequence to the output (warp)
+ *
+ * The source of every byte of a match lies before the match, so the bytes of the match are
+ * independent of each other even if the match overlaps its source.
+ */
+__device__ void write_sequence(unzstd_state_s const* s,
+                               zstd_sequence_s const& seq,
+                               size_t& out_pos,
+                               uint8_t const*& literals,
+                               int t)
+{
+  auto out = s->dst + out_pos;
+  write_literals(out, literals, seq.literal_length, t);
+  literals += seq.literal_length;
+
+  out += seq.literal_length;
+  auto const match_src = out - seq.offset;
+  for (uint32_t i = t; i < seq.match_length; i += unzstd_block_size) {
+    out[i] = match_src[i % seq.offset];
+  }
+  __syncwarp();
+
+  out_pos += seq.literal_length + seq.match_length;
+}
+
+/**
+ * @brief Decodes a compressed block (warp)
+ *
+ * @param s decompression state
+ * @param out_pos number of bytes written to the output, updated
+ * @param t warp lane id
+ */
+__device__ void decode_compressed_block(unzstd_state_s* s, size_t& out_pos, int t)
+{
+  auto const block = s->src + s->block_start;
+  if (t == 0) { parse_literals_section(s, block, out_pos); }
+  __syncwarp();
+  auto const literals_ok   = (s->status == compression_status::SUCCESS);
+  auto const literals_type = s->literals_type;
+  auto const num_literals  = s->num_literals;
+  auto const num_streams   = s->num_streams;
+  __syncwarp();
+  if (not literals_ok) { return; }
+
+  auto const literals = s->dst + s->dst_size - num_literals;
+  if (literals_type == RLE_LITERALS) {
+    for (uint32_t i = t; i < num_literals; i += unzstd_block_size) {
+      literals[i] = s->rle_literal;
+    }
+  } else if (literals_type != RAW_LITERALS) {
+    // Each stream but the last one decodes to a quarter of the literals, rounded up
+    auto const segment_size = (num_streams == 1) ? num_literals : (num_literals + 3) / 4;
+    for (uint32_t i = t; i < num_streams; i += unzstd_block_size) {
+      auto const out   = literals + i * segment_size;
+      auto const count = (i + 1 < num_streams) ? segment_size : num_literals - i * segment_size;
+      auto const max_bits = s->huffman_bits;
+      backward_bitstream_s bits;
+      if (not init_bitstream(bits, s->streams[i], s->stream_sizes[i])) {
+        s->status = compression_status::FAILURE;
+        continue;
+      }
+      for (uint32_t j = 0; j < count; ++j) {
+        auto const entry = s->huffman_table[peek_bits(bits, max_bits)];
+        out[j]           = entry >> 8;
+        bits.pos -= entry & 0xff;
+      }
+      if (bits.pos != 0) { s->status = compression_status::FAILURE; }
+    }
+  }
+  __syncwarp();
+
+  if (t == 0 and s->status == compression_status::SUCCESS) { parse_sequences_section(s, block); }
+  __syncwarp();
+  auto const sequences_ok = (s->status == compression_status::SUCCESS);
+  auto literal_src        = s->literals;
+  __syncwarp();
+  if (not sequences_ok) { return; }
+
+  uint32_t literal_pos = 0;
+  while (true) {
+    if (t == 0) { decode_sequences(s, out_pos, literal_pos); }
+    __syncwarp();
+    auto const batch_len = s->batch_len;
+    __syncwarp();
+    if (batch_len == 0) { break; }
+    for (int i = 0; i < batch_len; ++i) {
+      literal_pos += s->batch[i].literal_length;
+      write_sequence(s, s->batch[i], out_pos, literal_src, t);
+    }
+  }
+  __syncwarp();
+  auto const sequences_done = (s->status == compression_status::SUCCESS);
+  __syncwarp();
+  if (not sequences_done) { return; }
+
+  // The remaining literals follow the last sequence
+  write_literals(s->dst + out_pos, literal_src, num_literals - literal_pos, t);
+  out_pos += num_literals - literal_pos;
+}
+
+/**
+ * @brief Parses the header of the next frame, skipping skippable frames (single thread)
+ *
+ * @return false if there are no more frames
+ */
+__device__ bool parse_frame_header(unzstd_state_s* s, size_t out_pos)
+{
+  auto const src = device_span<uint8_t const>{s->src, s->src_size};
+  auto pos       = s->src_pos;
+  while (true) {
+    if (pos == src.size()) { return false; }
+    if (pos + 4 > src.size()) {
+      s->status = compression_status::FAILURE;
+      return false;
+    }
+    auto const magic = load_le(src.data() + pos, 4);
+    if ((magic & ~0xfu) != zstd_skippable_magic) { break; }
+    if (pos + 8 > src.size()) {
+      s->status = compression_status::FAILURE;
+      return false;
+    }
+    auto const frame_size = load_le(src.data() + pos + 4, 4);
+    if (frame_size > src.size() - pos - 8) {
+      s->status = compression_status::FAILURE;
+      return false;
+    }
+    pos += 8 + frame_size;
+  }
+  if (pos + 5 > src.size() or load_le(src.data() + pos, 4) != zstd_frame_magic) {
+    s->status = compression_status::FAILURE;
+    return false;
+  }
+  auto const descriptor         = src[pos + 4];
+  auto const content_flag       = descriptor >> 6;
+  auto const single_segment     = (descriptor >> 5) & 1;
+  auto const dictionary_id_size = (descriptor & 3) == 3 ? 4 : (descriptor & 3);
+  auto const content_size_size  = (content_flag == 0) ? single_segment : (1 << content_flag);
+  pos += 5;
+  // A Window_Descriptor byte leads the optional fields unless the frame is a single segment
+  auto const header_size = (1 - single_segment) + dictionary_id_size + content_size_size;
+  if ((descriptor & 0x08) != 0 or pos + header_size > src.size()) {
+    s->status = compression_status::FAILURE;
+    return false;
+  }
+  pos += 1 - single_segment;
+  if (dictionary_id_size != 0 and load_le(src.data() + pos, dictionary_id_size) != 0) {
+    // Dictionaries are not supported
+    s->status = compression_status::FAILURE;
+    return false;
+  }
+  pos += dictionary_id_size + content_size_size;
+
+  s->src_pos            = pos;
+  s->frame_start        = out_pos;
+  s->in_frame           = true;
+  s->has_checksum       = (descriptor >> 2) & 1;
+  s->huffman_bits       = 0;
+  s->literal_length_log = -1;
+  s->match_length_log   = -1;
+  s->offset_log         = -1;
+  s->repeat_offsets[0]  = 1;
+  s->repeat_offsets[1]  = 4;
+  s->repeat_offsets[2]  = 8;
+  return true;
+}
+
+/**
+ * @brief Parses the header of the next block, starting new frames as needed (single thread)
+ */
+__device__ void parse_block_header(unzstd_state_s* s, size_t out_pos)
+{
+  s->block_type = NO_BLOCK;
+  if (not s->in_frame and not parse_frame_header(s, out_pos)) { return; }
+
+  auto const src = device_span<uint8_t const>{s->src, s->src_size};
+  auto pos       = s->src_pos;
+  if (pos + 3 > src.size()) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  auto const header     = load_le(src.data() + pos, 3);
+  auto const last_block = header & 1;
+  auto const type       = static_cast<int32_t>((header >> 1) & 3);
+  auto const size       = header >> 3;
+  pos += 3;
+  auto const content_size = (type == RLE_BLOCK) ? 1 : size;
+  if (type == NO_BLOCK or size > zstd_max_block_size or content_size > src.size() - pos) {
+    s->status = compression_status::FAILURE;
+    return;
+  }
+  if (type != COMPRESSED_BLOCK and size > s->dst_size - out_pos) {
+    s->status = compression_status::OUTPUT_OVERFLOW;
+    return;
+  }
+  s->block_start = pos;
+  s->block_size  = size;
+  pos += content_size;
+  if (last_block) {
+    s->in_frame = false;
+    if (s->has_checksum) {
+      if (pos + 4 > src.size()) {
+        s->status = compression_status::FAILURE;
+        return;
+      }
+      pos += 4;
+    }
+  }
+  s->src_pos    = pos;
+  s->block_type = type;
+}
+
+/**
+ * @brief Zstandard decompression kernel
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source buffers, each holding one or more frames
+ * @param[out] outputs Destination buffers
+ * @param[out] results Decompression status per input
+ */
+CUDF_KERNEL void __launch_bounds__(unzstd_block_size)
+  unzstd_kernel(device_span<device_span<uint8_t const> const> inputs,
+                device_span<device_span<uint8_t> const> outputs,
+                device_span<compression_result> results)
+{
+  __shared__ __align__(16) unzstd_state_s state_g;
+  int const t        = threadIdx.x;
+  unzstd_state_s* s  = &state_g;
+  auto const strm_id = blockIdx.x;
+
+  if (t == 0) {
+    s->src      = inputs[strm_id].data();
+    s->dst      = outputs[strm_id].data();
+    s->src_size = inputs[strm_id].size();
+    s->dst_size = outputs[strm_id].size();
+    s->src_pos  = 0;
+    s->in_frame = false;
+    s->status   = s->src_size == 0 ? compression_status::FAILURE : compression_status::SUCCESS;
+  }
+  __syncwarp();
+
+  size_t out_pos = 0;
+  while (true) {
+    if (t == 0) {
+      if (s->status == compression_status::SUCCESS) {
+        parse_block_header(s, out_pos);
+      } else {
+        s->block_type = NO_BLOCK;
+      }
+    }
+    __syncwarp();
+    auto const block_type  = (s->status == compression_status::SUCCESS) ? s->block_type : NO_BLOCK;
+    auto const block_start = s->block_start;
+    auto const block_size  = s->block_size;
+    __syncwarp();
+    if (block_type == NO_BLOCK) { break; }
+
+    auto const out = s->dst + out_pos;
+    if (block_type == RAW_BLOCK) {
+      auto const in = s->src + block_start;
+      for (uint32_t i = t; i < block_size; i += unzstd_block_size) {
+        out[i] = in[i];
+      }
+      out_pos += block_size;
+    } else if (block_type == RLE_BLOCK) {
+      auto const value = s->src[block_start];
+      for (uint32_t i = t; i < block_size; i += unzstd_block_size) {
+        out[i] = value;
+      }
+      out_pos += block_size;
+    } else {
+      decode_compressed_block(s, out_pos, t);
+    }
+    __syncwarp();
+  }
+
+  if (t == 0) {
+    results[strm_id].bytes_written = out_pos;
+    results[strm_id].status        = s->status;
+    results[strm_id].reserved      = 0;
+  }
+}
+
+}  // namespace
+
+void gpu_unzstd(device_span<device_span<uint8_t const> const> inputs,
+                device_span<device_span<uint8_t> const> outputs,
+                device_span<compression_result> results,
+                rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(unzstd_block_size, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(inputs.size(), 1);
+  if (inputs.size() > 0) {
+    unzstd_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, results);
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
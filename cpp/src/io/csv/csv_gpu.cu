@@ -165,6 +165,7 @@ __device__ __inline__ bool is_floatingpoint(long len,
  * @param csv_text The entire CSV data to read
  * @param column_flags Per-column parsing behavior flags
  * @param row_offsets The start the CSV data of interest
+ * @param row_stride Distance between the rows that are processed
  * @param d_column_data The count for each column data type
  */
 CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
@@ -172,13 +173,14 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
                       device_span<char const> csv_text,
                       device_span<column_parse::flags const> const column_flags,
                       device_span<uint64_t const> const row_offsets,
+                      size_t const row_stride,
                       device_span<column_type_histogram> d_column_data)
 {
   auto const raw_csv = csv_text.data();
 
   // ThreadIds range per block, so also need the blockId
-  // This is entry into the fields; threadId is an element within `num_records`
-  auto const rec_id      = grid_1d::global_thread_id();
+  // This is entry into the fields; threadId is an element within the sampled records
+  auto const rec_id      = grid_1d::global_thread_id() * row_stride;
   auto const rec_id_next = rec_id + 1;
 
   // we can have more threads than data, make sure we are not past the end of the data
@@ -799,18 +801,20 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<char const> const data,
   device_span<column_parse::flags const> const column_flags,
   device_span<uint64_t const> const row_starts,
+  size_t const row_stride,
   size_t const num_active_columns,
   rmm::cuda_stream_view stream)
 {
-  // Calculate actual block count to use based on records count
-  int const block_size = csvparse_block_dim;
-  int const grid_size  = (row_starts.size() + block_size - 1) / block_size;
+  // Calculate actual block count to use based on sampled records count
+  int const block_size   = csvparse_block_dim;
+  auto const num_threads = (row_starts.size() + row_stride - 1) / row_stride;
+  int const grid_size    = (num_threads + block_size - 1) / block_size;
 
   auto d_stats = detail::make_zeroed_device_uvector_async<column_type_histogram>(
     num_active_columns, stream, rmm::mr::get_current_device_resource());
 
   data_type_detection<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_starts, d_stats);
+    options, data, column_flags, row_starts, row_stride, d_stats);
 
   return detail::make_std_vector_sync(d_stats, stream);
 }
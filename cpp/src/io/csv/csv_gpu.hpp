@@ -195,6 +195,8 @@ device_span<uint64_t> remove_blank_rows(cudf::io::parse_options_view const& opti
  * @param[in] data The row-column data
  * @param[in] column_flags Flags that control individual column parsing
  * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] row_stride Distance between the rows that are sampled; 1 to sample all rows
+ * @param[in] num_active_columns Number of columns whose types are detected
  * @param[in] stream CUDA stream to use
  *
  * @return stats Histogram of each dtypes' occurrence for each column
@@ -204,6 +206,7 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<char const> data,
   device_span<column_parse::flags const> column_flags,
   device_span<uint64_t const> row_offsets,
+  size_t const row_stride,
   size_t const num_active_columns,
   rmm::cuda_stream_view stream);
 
@@ -26,6 +26,8 @@
 #include "io/utilities/hostdevice_vector.hpp"
 #include "io/utilities/parsing_utils.cuh"
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
@@ -45,6 +47,8 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cstring>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -504,11 +508,19 @@ void get_data_types_from_column_names(std::map<std::string, data_type> const& us
   }
 }
 
+/**
+ * @brief Infers the types of the columns flagged as inferred from (a sample of) the rows.
+ *
+ * @param max_sample_rows Maximum number of rows to infer the types from, -1 to use all rows
+ * @param sampling Which rows to infer the types from if not all rows are used
+ */
 void infer_column_types(parse_options const& parse_opts,
                         host_span<column_parse::flags const> column_flags,
                         device_span<char const> data,
                         device_span<uint64_t const> row_offsets,
                         int32_t num_records,
+                        size_type max_sample_rows,
+                        csv_type_inference_sampling_t sampling,
                         data_type timestamp_type,
                         host_span<data_type> column_types,
                         rmm::cuda_stream_view stream)
@@ -528,11 +540,20 @@ void infer_column_types(parse_options const& parse_opts,
     });
   if (num_inferred_columns == 0) { return; }
 
+  auto const num_samples =
+    max_sample_rows < 0 ? num_records : std::min<int32_t>(max_sample_rows, num_records);
+  auto const row_stride =
+    sampling == csv_type_inference_sampling_t::UNIFORM ? num_records / num_samples : 1;
+  // Offsets up to the end of the last sampled row
+  auto const sample_offsets =
+    row_offsets.first(static_cast<size_t>(num_samples - 1) * row_stride + 2);
+
   auto const column_stats = cudf::io::csv::gpu::detect_column_types(
     parse_opts.view(),
     data,
     make_device_uvector_async(column_flags, stream, rmm::mr::get_current_device_resource()),
-    row_offsets,
+    sample_offsets,
+    row_stride,
     num_inferred_columns,
     stream);
   stream.synchronize();
@@ -541,7 +562,7 @@ void infer_column_types(parse_options const& parse_opts,
   for (auto col_idx = 0u; col_idx < column_flags.size(); ++col_idx) {
     if (not(column_flags[col_idx] & column_parse::inferred)) { continue; }
     auto const& stats = column_stats[inf_col_idx++];
-    if (stats.null_count == num_records or stats.total_count() == 0) {
+    if (stats.null_count == num_samples or stats.total_count() == 0) {
       // Entire column is NULL; allocate the smallest amount of memory
       column_types[col_idx] = data_type(cudf::type_id::INT8);
     } else if (stats.string_count > 0L) {
@@ -621,12 +642,19 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
   return out_buffers;
 }
 
+/**
+ * @brief Returns the types of the active columns, either specified by the user or inferred.
+ *
+ * @param sample_rows Whether to infer the types from the sample of rows selected by the options,
+ * rather than from all rows
+ */
 std::vector<data_type> determine_column_types(csv_reader_options const& reader_opts,
                                               parse_options const& parse_opts,
                                               host_span<std::string const> column_names,
                                               device_span<char const> data,
                                               device_span<uint64_t const> row_offsets,
                                               int32_t num_records,
+                                              bool sample_rows,
                                               host_span<column_parse::flags> column_flags,
                                               rmm::cuda_stream_view stream)
 {
@@ -647,6 +675,8 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
                      data,
                      row_offsets,
                      num_records,
+                     sample_rows ? reader_opts.get_type_inference_rows() : -1,
+                     reader_opts.get_type_inference_sampling(),
                      reader_opts.get_timestamp_type(),
                      column_types,
                      stream);
@@ -664,11 +694,18 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
   return active_col_types;
 }
 
+/**
+ * @brief Reads the data of the source that is selected by the options.
+ *
+ * @param[out] active_column_indexes If not null, set to the indexes of the returned columns among
+ * all columns of the input
+ */
 table_with_metadata read_csv(cudf::io::datasource* source,
                              csv_reader_options const& reader_opts,
                              parse_options const& parse_opts,
                              rmm::cuda_stream_view stream,
-                             rmm::device_async_resource_ref mr)
+                             rmm::device_async_resource_ref mr,
+                             std::vector<int>* active_column_indexes = nullptr)
 {
   std::vector<char> header;
 
@@ -839,10 +876,27 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   // Return empty table rather than exception if nothing to load
   if (num_active_columns == 0) { return {std::make_unique<table>(), {}}; }
 
+  if (active_column_indexes != nullptr) {
+    active_column_indexes->clear();
+    for (int col = 0; col < num_actual_columns; ++col) {
+      if (column_flags[col] & column_parse::enabled) { active_column_indexes->push_back(col); }
+    }
+  }
+
   // Exclude the end-of-data row from number of rows with actual data
   auto const num_records  = std::max(row_offsets.size(), 1ul) - 1;
-  auto const column_types = determine_column_types(
-    reader_opts, parse_opts, column_names, data, row_offsets, num_records, column_flags, stream);
+  // Whether the inferred types are only based on a sample of the rows
+  auto const is_sampled = reader_opts.get_type_inference_rows() != -1 and
+                          reader_opts.get_type_inference_rows() < static_cast<int64_t>(num_records);
+  auto column_types = determine_column_types(reader_opts,
+                                             parse_opts,
+                                             column_names,
+                                             data,
+                                             row_offsets,
+                                             num_records,
+                                             is_sampled,
+                                             column_flags,
+                                             stream);
 
   auto metadata    = table_metadata{};
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
@@ -861,6 +915,46 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       stream,
       mr);
 
+    if (is_sampled) {
+      // Values outside of the sample that fail to parse as the inferred type are decoded as nulls;
+      // in that case, infer the types from all rows and decode again if any of them changes
+      auto has_inferred_nulls = false;
+      for (int col = 0, active_col = 0; col < num_actual_columns; ++col) {
+        if (not(column_flags[col] & column_parse::enabled)) { continue; }
+        if ((column_flags[col] & column_parse::inferred) and
+            column_types[active_col].id() != type_id::STRING and
+            out_buffers[active_col].null_count() != 0) {
+          has_inferred_nulls = true;
+        }
+        ++active_col;
+      }
+      if (has_inferred_nulls) {
+        auto all_rows_types = determine_column_types(reader_opts,
+                                                     parse_opts,
+                                                     column_names,
+                                                     data,
+                                                     row_offsets,
+                                                     num_records,
+                                                     false,
+                                                     column_flags,
+                                                     stream);
+        if (all_rows_types != column_types) {
+          column_types = std::move(all_rows_types);
+          out_buffers  = decode_data(parse_opts,
+                                    column_flags,
+                                    column_names,
+                                    data,
+                                    row_offsets,
+                                    column_types,
+                                    num_records,
+                                    num_actual_columns,
+                                    num_active_columns,
+                                    stream,
+                                    mr);
+        }
+      }
+    }
+
     cudf::string_scalar quotechar_scalar(std::string(1, parse_opts.quotechar), true, stream);
     cudf::string_scalar dblquotechar_scalar(std::string(2, parse_opts.quotechar), true, stream);
     for (size_t i = 0; i < column_types.size(); ++i) {
@@ -993,6 +1087,50 @@ parse_options make_parse_options(csv_reader_options const& reader_opts,
   return parse_opts;
 }
 
+/**
+ * @brief Datasource that serves the reads within a range of the input that has already been read
+ * into host memory, and forwards all other reads to the input.
+ */
+class prefetched_source : public datasource {
+ public:
+  prefetched_source(datasource* source, size_t offset, host_span<uint8_t const> data)
+    : _source{source}, _offset{offset}, _data{data}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    if (not is_prefetched(offset, size)) { return _source->host_read(offset, size); }
+    return std::make_unique<non_owning_buffer>(_data.data() + (offset - _offset),
+                                               read_size(offset, size));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    if (not is_prefetched(offset, size)) { return _source->host_read(offset, size, dst); }
+    auto const num_bytes = read_size(offset, size);
+    std::memcpy(dst, _data.data() + (offset - _offset), num_bytes);
+    return num_bytes;
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+ private:
+  [[nodiscard]] size_t read_size(size_t offset, size_t size) const
+  {
+    return std::min(size, _source->size() - std::min(offset, _source->size()));
+  }
+
+  [[nodiscard]] bool is_prefetched(size_t offset, size_t size) const
+  {
+    return offset >= _offset and offset + read_size(offset, size) <= _offset + _data.size();
+  }
+
+  datasource* _source;
+  size_t _offset;
+  host_span<uint8_t const> _data;
+};
+
 }  // namespace
 
 table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
@@ -1005,6 +1143,134 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
   return read_csv(source.get(), options, parse_options, stream, mr);
 }
 
+chunked_reader::chunked_reader(std::size_t input_chunk_size,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               csv_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _source{std::move(source)},
+    _options{options},
+    _input_chunk_size{input_chunk_size},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(_options.get_compression() == compression_type::NONE,
+               "Chunked reading of compressed inputs is not supported");
+  CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+               "Chunked reading does not support specifying a byte range");
+  CUDF_EXPECTS(_options.get_skiprows() <= 0 and _options.get_skipfooter() <= 0 and
+                 _options.get_nrows() < 0,
+               "Chunked reading does not support skiprows, skipfooter or nrows");
+  if (_input_chunk_size == 0) { _input_chunk_size = std::max<std::size_t>(_source->size(), 1); }
+
+  prefetch_next_chunk();
+}
+
+chunked_reader::~chunked_reader()
+{
+  // The pending read writes into the host buffers
+  if (_prefetch.valid()) { _prefetch.wait(); }
+}
+
+bool chunked_reader::has_next() const
+{
+  return _num_chunks_read == 0 or _offset < _source->size();
+}
+
+csv_reader_options chunked_reader::chunk_options(std::size_t offset, std::size_t size) const
+{
+  auto options = _options;
+  options.set_byte_range_offset(offset);
+  options.set_byte_range_size(size);
+  if (_schema_columns != nullptr) {
+    // The header, and the names, selection and types of the columns are set by the first chunk
+    options.set_header(-1);
+    options.set_names(_column_names);
+    options.set_use_cols_names({});
+    options.set_use_cols_indexes(_column_indexes);
+    options.set_dtypes(_column_types);
+  }
+  return options;
+}
+
+void chunked_reader::prefetch_next_chunk()
+{
+  auto const total_size = _source->size();
+  if (_offset >= total_size) { return; }
+
+  auto const options   = chunk_options(_offset, std::min(_input_chunk_size, total_size - _offset));
+  auto const read_size = std::min(options.get_byte_range_size_with_padding(), total_size - _offset);
+
+  // The spare buffer has been copied to the device when the chunk before the current one was read
+  _stream.synchronize();
+  _prefetch_buffer = (_prefetch_buffer + 1) % _host_buffers.size();
+  _prefetch_offset = _offset;
+  auto& buffer     = _host_buffers[_prefetch_buffer];
+  buffer.resize(read_size);
+  _prefetch = std::async(
+    std::launch::async, [source = _source.get(), offset = _offset, read_size, dst = buffer.data()] {
+      return source->host_read(offset, read_size, dst);
+    });
+}
+
+table_with_metadata chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  auto const total_size = _source->size();
+  while (_offset < total_size) {
+    auto const is_first_chunk  = _schema_columns == nullptr;
+    auto const chunk_offset    = _offset;
+    auto chunk_size            = std::min(_input_chunk_size, total_size - _offset);
+    auto const prefetched_size = _prefetch.valid() ? _prefetch.get() : 0;
+    auto source                = prefetched_source{
+      _source.get(),
+      _prefetch_offset,
+      host_span<uint8_t const>{_host_buffers[_prefetch_buffer].data(), prefetched_size}};
+    _offset += chunk_size;
+
+    // Read the next chunk while this one is parsed. The options of the chunks after the first one
+    // depend on its schema, so they can only be prefetched once it has been parsed.
+    if (not is_first_chunk) { prefetch_next_chunk(); }
+
+    auto const read_range = [&](std::vector<int>& column_indexes) {
+      auto const options = chunk_options(chunk_offset, chunk_size);
+      return read_csv(
+        &source, options, make_parse_options(options, _stream), _stream, _mr, &column_indexes);
+    };
+    std::vector<int> column_indexes;
+    auto chunk = read_range(column_indexes);
+
+    if (is_first_chunk) {
+      // The schema is inferred from the first chunk, so it is extended until it contains a row
+      while (chunk.tbl->num_rows() == 0 and _offset < total_size) {
+        chunk_size = std::min(2 * chunk_size, total_size);
+        _offset    = chunk_size;
+        chunk      = read_range(column_indexes);
+      }
+      _column_indexes = std::move(column_indexes);
+      _column_names.clear();
+      _column_types.clear();
+      for (size_type i = 0; i < chunk.tbl->num_columns(); ++i) {
+        auto const& name = chunk.metadata.schema_info[i].name;
+        _column_names.push_back(name);
+        _column_types.emplace(name, chunk.tbl->get_column(i).type());
+      }
+      _schema_columns  = cudf::empty_like(chunk.tbl->view());
+      _schema_metadata = chunk.metadata;
+      prefetch_next_chunk();
+    } else if (chunk.tbl->num_rows() == 0) {
+      // Byte ranges without a row terminator contain no rows; continue with the next one
+      continue;
+    }
+    ++_num_chunks_read;
+    return chunk;
+  }
+
+  ++_num_chunks_read;
+  if (_schema_columns == nullptr) { return {std::make_unique<table>(), {}}; }
+  return {std::make_unique<table>(_schema_columns->view(), _stream, _mr), _schema_metadata};
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -22,21 +22,31 @@
 #include "csv_common.hpp"
 #include "csv_gpu.hpp"
 #include "durations.hpp"
+#include "io/comp/comp.hpp"
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/detail/csv.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/convert/fixed_point_to_string.cuh>
+#include <cudf/strings/detail/convert/int_to_string.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -50,7 +60,9 @@
 #include <thrust/tabulate.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -79,7 +91,7 @@ struct escape_strings_fn {
   char* d_chars{};
   cudf::detail::input_offsetalator d_offsets;
 
-  __device__ void write_char(char_utf8 chr, char*& d_buffer, size_type& bytes)
+  __device__ static void write_char(char_utf8 chr, char*& d_buffer, size_type& bytes)
   {
     if (d_buffer)
       d_buffer += cudf::strings::detail::from_char_utf8(chr, d_buffer);
@@ -87,18 +99,22 @@ struct escape_strings_fn {
       bytes += cudf::strings::detail::bytes_in_char_utf8(chr);
   }
 
-  __device__ void operator()(size_type idx)
+  /**
+   * @brief Writes `d_str` escaped for CSV format
+   *
+   * @param d_str The string to write
+   * @param d_delimiter The column delimiter
+   * @param d_buffer Output position, advanced past the written bytes; nullptr to only count them
+   * @param bytes Incremented by the number of bytes when `d_buffer` is nullptr
+   */
+  __device__ static void write_escaped_string(string_view const d_str,
+                                              string_view const d_delimiter,
+                                              char*& d_buffer,
+                                              size_type& bytes)
   {
-    if (d_column.is_null(idx)) {
-      if (!d_chars) { d_sizes[idx] = 0; }
-      return;
-    }
-
     constexpr char_utf8 const quote    = '\"';  // check for quote
     constexpr char_utf8 const new_line = '\n';  // and for new-line
 
-    auto const d_str = d_column.element<string_view>(idx);
-
     // if quote, new-line or a column delimiter appear in the string
     // the entire string must be double-quoted.
     bool const quote_row = thrust::any_of(
@@ -106,20 +122,246 @@ struct escape_strings_fn {
         return chr == quote || chr == new_line || chr == d_delimiter[0];
       });
 
-    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
-    size_type bytes = 0;
-
     if (quote_row) write_char(quote, d_buffer, bytes);
     for (auto chr : d_str) {
       if (chr == quote) write_char(quote, d_buffer, bytes);
       write_char(chr, d_buffer, bytes);
     }
     if (quote_row) write_char(quote, d_buffer, bytes);
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+
+    write_escaped_string(d_column.element<string_view>(idx), d_delimiter, d_buffer, bytes);
 
     if (!d_chars) { d_sizes[idx] = bytes; }
   }
 };
 
+/**
+ * @brief Copies `d_str` to `d_buffer`, or adds its size to `bytes` when `d_buffer` is nullptr
+ */
+__device__ inline void write_csv_string(string_view const d_str, char*& d_buffer, size_type& bytes)
+{
+  if (d_buffer) {
+    d_buffer = cudf::strings::detail::copy_string(d_buffer, d_str);
+  } else {
+    bytes += d_str.size_bytes();
+  }
+}
+
+/**
+ * @brief Returns true if every column of `input` can be written by `fused_rows_to_csv`
+ */
+bool is_fused_csv_table(table_view const& input)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+    return col.type().id() == type_id::STRING || cudf::is_integral(col.type()) ||
+           cudf::is_fixed_point(col.type());
+  });
+}
+
+/**
+ * @brief Type dispatched functor writing one valid value of a column in CSV format
+ *
+ * Writes the same characters as the per-column conversions of `column_to_strings_fn`.
+ */
+struct write_csv_value_fn {
+  string_view const delimiter;
+  string_view const true_value;
+  string_view const false_value;
+  bool const escape_strings;
+
+  template <typename T>
+  __device__ void operator()(column_device_view const& col,
+                             size_type row,
+                             char*& d_buffer,
+                             size_type& bytes) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const d_str = col.element<string_view>(row);
+      if (escape_strings) {
+        escape_strings_fn::write_escaped_string(d_str, delimiter, d_buffer, bytes);
+      } else {
+        write_csv_string(d_str, d_buffer, bytes);
+      }
+    } else if constexpr (std::is_same_v<T, bool>) {
+      write_csv_string(col.element<bool>(row) ? true_value : false_value, d_buffer, bytes);
+    } else if constexpr (std::is_integral_v<T>) {
+      auto const value = col.element<T>(row);
+      if (d_buffer) {
+        d_buffer += cudf::strings::detail::integer_to_string(value, d_buffer);
+      } else {
+        bytes += cudf::strings::detail::count_digits(value);
+      }
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      auto const value = col.element<device_storage_type_t<T>>(row);
+      auto const scale = col.type().scale();
+      auto const size  = cudf::strings::detail::fixed_point_string_size(value, scale);
+      if (d_buffer) {
+        cudf::strings::detail::fixed_point_to_string(value, scale, d_buffer);
+        d_buffer += size;
+      } else {
+        bytes += size;
+      }
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for fused CSV serialization");
+    }
+  }
+};
+
+/**
+ * @brief Functor writing each row of a table as a CSV line, including its line terminator
+ *
+ * Used with `make_strings_children`: the first pass computes the size of each line and the
+ * second pass writes the line into its position of the output characters.
+ */
+struct row_to_csv_fn {
+  table_device_view const tbl;
+  string_view const delimiter;
+  string_view const terminator;
+  string_view const narep;
+  write_csv_value_fn const write_value;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type idx)
+  {
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+
+    for (size_type col_idx = 0; col_idx < tbl.num_columns(); ++col_idx) {
+      if (col_idx > 0) { write_csv_string(delimiter, d_buffer, bytes); }
+      auto const& col = tbl.column(col_idx);
+      if (col.is_null(idx)) {
+        write_csv_string(narep, d_buffer, bytes);
+      } else {
+        cudf::type_dispatcher(col.type(), write_value, col, idx, d_buffer, bytes);
+      }
+    }
+    write_csv_string(terminator, d_buffer, bytes);
+
+    if (!d_chars) { d_sizes[idx] = bytes; }
+  }
+};
+
+/**
+ * @brief Formats the rows of a table of columns accepted by `is_fused_csv_table` as CSV lines
+ *
+ * Produces the same characters as converting each column to strings, concatenating them, and
+ * joining the rows with line terminators, without the intermediate strings columns.
+ *
+ * @param input The rows to format
+ * @param options Options controlling the output format
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The characters of all lines, each followed by the line terminator
+ */
+rmm::device_uvector<char> fused_rows_to_csv(table_view const& input,
+                                            csv_writer_options const& options,
+                                            rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  string_scalar const delimiter{std::string{options.get_inter_column_delimiter()}, true, stream};
+  string_scalar const terminator{options.get_line_terminator(), true, stream};
+  string_scalar const narep{options.get_na_rep(), true, stream};
+  string_scalar const true_value{options.get_true_value(), true, stream};
+  string_scalar const false_value{options.get_false_value(), true, stream};
+
+  auto const d_input = table_device_view::create(input, stream);
+  auto const escape  = options.get_quoting() != cudf::io::quote_style::NONE;
+  auto const write_value = write_csv_value_fn{
+    delimiter.value(stream), true_value.value(stream), false_value.value(stream), escape};
+  auto [offsets, chars] = cudf::strings::detail::make_strings_children(
+    row_to_csv_fn{*d_input,
+                  delimiter.value(stream),
+                  terminator.value(stream),
+                  narep.value(stream),
+                  write_value},
+    input.num_rows(),
+    stream,
+    rmm::mr::get_current_device_resource());
+  return std::move(chars);
+}
+
+/**
+ * @brief Writes chunks of formatted rows from device memory to a data sink
+ *
+ * Each chunk is copied into one of two pinned host buffers and written to the sink when the next
+ * chunk is written, so the host write of a chunk overlaps the copy of the next one. Device sinks
+ * are written to directly.
+ */
+class csv_chunk_writer {
+ public:
+  csv_chunk_writer(data_sink* sink, rmm::cuda_stream_view stream) : _sink{sink}, _stream{stream}
+  {
+    for (auto& event : _copied) {
+      CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+  }
+
+  ~csv_chunk_writer()
+  {
+    for (auto event : _copied) {
+      cudaEventDestroy(event);
+    }
+  }
+
+  csv_chunk_writer(csv_chunk_writer const&)            = delete;
+  csv_chunk_writer& operator=(csv_chunk_writer const&) = delete;
+
+  /**
+   * @brief Writes the chunk after the previous ones; the write may complete in a later call
+   */
+  void write(device_span<char const> chars)
+  {
+    if (chars.empty()) { return; }
+    if (_sink->is_device_write_preferred(chars.size())) {
+      flush();
+      _sink->device_write(chars.data(), chars.size(), _stream);
+      return;
+    }
+
+    // The other buffer may still hold the chunk waiting to be written.
+    auto const idx = _pending.has_value() ? 1 - *_pending : 0;
+    auto& buffer   = _buffers[idx];
+    buffer.resize(chars.size());
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      buffer.data(), chars.data(), chars.size(), cudaMemcpyDefault, _stream.value()));
+    CUDF_CUDA_TRY(cudaEventRecord(_copied[idx], _stream.value()));
+
+    flush();
+    _pending = idx;
+  }
+
+  /**
+   * @brief Writes the chunk waiting in a pinned buffer, if any, to the sink
+   */
+  void flush()
+  {
+    if (!_pending.has_value()) { return; }
+    auto const idx = *_pending;
+    _pending.reset();
+    CUDF_CUDA_TRY(cudaEventSynchronize(_copied[idx]));
+    _sink->host_write(_buffers[idx].data(), _buffers[idx].size());
+  }
+
+ private:
+  data_sink* _sink;
+  rmm::cuda_stream_view _stream;
+  std::array<cudf::detail::pinned_host_vector<char>, 2> _buffers;
+  std::array<cudaEvent_t, 2> _copied{};
+  std::optional<int> _pending;  // index of the buffer waiting to be written
+};
+
 struct column_to_strings_fn {
   // compile-time predicate that defines unsupported column types;
   // based on the conditions used for instantiations of individual
@@ -414,6 +656,14 @@ void write_csv(data_sink* out_sink,
                rmm::cuda_stream_view stream,
                rmm::device_async_resource_ref mr)
 {
+  // Compress the output on the GPU, if requested
+  std::unique_ptr<data_sink> compressed_out;
+  if (options.get_compression() != compression_type::NONE) {
+    compressed_out = std::make_unique<cudf::io::detail::compressed_sink>(
+      options.get_compression(), out_sink, stream);
+    out_sink       = compressed_out.get();
+  }
+
   // write header: column names separated by delimiter:
   // (even for tables with no rows)
   //
@@ -449,51 +699,67 @@ void write_csv(data_sink* out_sink,
       vector_views = cudf::detail::split(table, splits, stream);
     }
 
-    // convert each chunk to CSV:
+    // format the chunks of a table of strings, integers and decimals in one pass per chunk:
     //
-    column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
-    for (auto&& sub_view : vector_views) {
-      // Skip if the table has no rows
-      if (sub_view.num_rows() == 0) continue;
-      std::vector<std::unique_ptr<column>> str_column_vec;
-
-      // populate vector of string-converted columns:
-      //
-      std::transform(
-        sub_view.begin(),
-        sub_view.end(),
-        std::back_inserter(str_column_vec),
-        [&converter = std::as_const(converter)](auto const& current_col) {
-          return cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
-            current_col.type(), converter, current_col);
-        });
-
-      // create string table view from str_column_vec:
-      //
-      auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
-      auto str_table_view = str_table_ptr->view();
-
-      // concatenate columns in each row into one big string column
-      // (using null representation and delimiter):
+    if (is_fused_csv_table(table)) {
+      csv_chunk_writer writer{out_sink, stream};
+      for (auto&& sub_view : vector_views) {
+        if (sub_view.num_rows() == 0) continue;
+        auto const chars = fused_rows_to_csv(sub_view, options, stream);
+        writer.write(chars);
+      }
+      writer.flush();
+    } else {
+      // convert each chunk to CSV:
       //
-      auto str_concat_col = [&] {
-        cudf::string_scalar delimiter_str{
-          std::string{options.get_inter_column_delimiter()}, true, stream};
-        cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
-        if (str_table_view.num_columns() > 1)
-          return cudf::strings::detail::concatenate(str_table_view,
-                                                    delimiter_str,
-                                                    options_narep,
-                                                    strings::separator_on_nulls::YES,
-                                                    stream,
-                                                    rmm::mr::get_current_device_resource());
-        return cudf::strings::detail::replace_nulls(
-          str_table_view.column(0), options_narep, stream, rmm::mr::get_current_device_resource());
-      }();
-
-      write_chunked(out_sink, str_concat_col->view(), options, stream, mr);
+      column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+      for (auto&& sub_view : vector_views) {
+        // Skip if the table has no rows
+        if (sub_view.num_rows() == 0) continue;
+        std::vector<std::unique_ptr<column>> str_column_vec;
+
+        // populate vector of string-converted columns:
+        //
+        std::transform(
+          sub_view.begin(),
+          sub_view.end(),
+          std::back_inserter(str_column_vec),
+          [&converter = std::as_const(converter)](auto const& current_col) {
+            return cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
+              current_col.type(), converter, current_col);
+          });
+
+        // create string table view from str_column_vec:
+        //
+        auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
+        auto str_table_view = str_table_ptr->view();
+
+        // concatenate columns in each row into one big string column
+        // (using null representation and delimiter):
+        //
+        auto str_concat_col = [&] {
+          cudf::string_scalar delimiter_str{
+            std::string{options.get_inter_column_delimiter()}, true, stream};
+          cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
+          if (str_table_view.num_columns() > 1)
+            return cudf::strings::detail::concatenate(str_table_view,
+                                                      delimiter_str,
+                                                      options_narep,
+                                                      strings::separator_on_nulls::YES,
+                                                      stream,
+                                                      rmm::mr::get_current_device_resource());
+          return cudf::strings::detail::replace_nulls(str_table_view.column(0),
+                                                      options_narep,
+                                                      stream,
+                                                      rmm::mr::get_current_device_resource());
+        }();
+
+        write_chunked(out_sink, str_concat_col->view(), options, stream, mr);
+      }
     }
   }
+
+  if (compressed_out) { compressed_out->flush(); }
 }
 
 }  // namespace csv
@@ -21,11 +21,24 @@
 #include <thrust/execution_policy.h>
 #include <thrust/sequence.h>
 
+#include <type_traits>
+
 namespace cudf::io::fst::detail {
 
 /// Type used to enumerate (and index) into the states defined by a DFA
 using StateIndexT = uint32_t;
 
+/**
+ * @brief Compile-time reflection to check if the transition table `OpT` provides the composed
+ * transitions of symbol pairs.
+ */
+template <typename OpT, typename = void>
+struct has_symbol_pair_transitions : std::false_type {};
+
+template <typename OpT>
+struct has_symbol_pair_transitions<OpT, std::void_t<decltype(OpT::HAS_SYMBOL_PAIR_TRANSITIONS)>>
+  : std::bool_constant<OpT::HAS_SYMBOL_PAIR_TRANSITIONS> {};
+
 /**
  * @brief Implements an associative composition operation for state transition vectors to be used
  * with a prefix scan.
@@ -241,6 +254,45 @@ struct AgentDFA {
     }
   }
 
+  /**
+   * @brief Transitions the states of all DFA instances, reading two symbols per lookup of the
+   * composed symbol pair transitions of the transition table.
+   */
+  template <int32_t NUM_SYMBOLS,
+            typename SymbolMatcherT,
+            typename TransitionTableT,
+            std::size_t NUM_INSTANCES,
+            int32_t IS_FULL_BLOCK>
+  __device__ __forceinline__ static void ThreadParseSymbolPairs(
+    SymbolMatcherT const& symbol_matcher,
+    TransitionTableT const& transition_table,
+    CharT const* chars,
+    SymbolIndexT const& max_num_chars,
+    std::array<StateIndexT, NUM_INSTANCES>& state_vector,
+    cub::Int2Type<IS_FULL_BLOCK> /*IS_FULL_BLOCK*/)
+  {
+    auto const thread_offset = threadIdx.x * SYMBOLS_PER_THREAD;
+    // Iterate over pairs of symbols
+#pragma unroll
+    for (int32_t i = 0; i < NUM_SYMBOLS; i += 2) {
+      bool const has_first  = IS_FULL_BLOCK || thread_offset + i < max_num_chars;
+      bool const has_second = i + 1 < NUM_SYMBOLS &&
+                              (IS_FULL_BLOCK || thread_offset + i + 1 < max_num_chars);
+      if (has_second) {
+        auto const matched_id_0 = symbol_matcher(chars[i]);
+        auto const matched_id_1 = symbol_matcher(chars[i + 1]);
+        for (std::size_t j = 0; j < NUM_INSTANCES; ++j) {
+          state_vector[j] = transition_table(state_vector[j], matched_id_0, matched_id_1);
+        }
+      } else if (has_first) {
+        auto const matched_id = symbol_matcher(chars[i]);
+        for (std::size_t j = 0; j < NUM_INSTANCES; ++j) {
+          state_vector[j] = transition_table(state_vector[j], matched_id);
+        }
+      }
+    }
+  }
+
   template <int32_t NUM_SYMBOLS,
             typename SymbolMatcherT,
             typename StateTransitionOpT,
@@ -422,8 +474,25 @@ struct AgentDFA {
     // Thread's symbols
     CharT* t_chars = &temp_storage.chars[threadIdx.x * SYMBOLS_PER_THREAD];
 
-    // Parse thread's symbols and transition the state-vector
-    if (is_full_block) {
+    // Parse thread's symbols and transition the state-vector, two symbols at a time if the
+    // transition table has composed the transitions of symbol pairs
+    if constexpr (has_symbol_pair_transitions<TransitionTableT>::value) {
+      if (is_full_block) {
+        ThreadParseSymbolPairs<SYMBOLS_PER_THREAD>(symbol_matcher,
+                                                   transition_table,
+                                                   t_chars,
+                                                   num_block_chars,
+                                                   state_vector,
+                                                   cub::Int2Type<true>());
+      } else {
+        ThreadParseSymbolPairs<SYMBOLS_PER_THREAD>(symbol_matcher,
+                                                   transition_table,
+                                                   t_chars,
+                                                   num_block_chars,
+                                                   state_vector,
+                                                   cub::Int2Type<false>());
+      }
+    } else if (is_full_block) {
       GetThreadStateTransitions<SYMBOLS_PER_THREAD>(
         symbol_matcher, t_chars, num_block_chars, transition_op, cub::Int2Type<true>());
     } else {
@@ -546,6 +615,12 @@ __launch_bounds__(int32_t(AgentDFAPolicy::BLOCK_THREADS)) CUDF_KERNEL
     // Initialize the seed state transition vector with the identity vector
     thrust::sequence(thrust::seq, std::begin(state_vector), std::end(state_vector));
 
+    // Only the state transition vector is computed in this stage, so symbols can be read in pairs.
+    // The composed transitions are synchronized along with the block's characters.
+    if constexpr (has_symbol_pair_transitions<decltype(transition_table)>::value) {
+      transition_table.InitSymbolPairTransitions();
+    }
+
     // Compute the state transition vector
     agent_dfa.GetThreadStateTransitionVector<NUM_STATES>(symbol_matcher,
                                                          transition_table,
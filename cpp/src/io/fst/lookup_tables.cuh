@@ -342,6 +342,11 @@ auto make_symbol_group_lut(std::array<std::string, NUM_SYMBOL_GROUPS> const& sym
  * @brief Lookup table mapping (old_state, symbol_group_id) transitions to a new target state. The
  * class uses shared memory for the lookups.
  *
+ * If it fits into `MAX_SYMBOL_PAIR_TABLE_SIZE` bytes, the table also provides the composition of
+ * the transitions of any two consecutive symbol groups, i.e., (old_state, match_id_0, match_id_1)
+ * -> new_state, which halves the number of lookups when only the state reached after reading a
+ * sequence of symbols is of interest.
+ *
  * @tparam MAX_NUM_SYMBOLS The maximum number of symbols being output by a single state transition
  * @tparam MAX_NUM_STATES The maximum number of states that this lookup table shall support
  */
@@ -351,8 +356,21 @@ class TransitionTable {
   // Type used
   using ItemT = char;
 
+  // Maximum number of bytes of shared memory used by the composed transitions of symbol pairs
+  static constexpr int32_t MAX_SYMBOL_PAIR_TABLE_SIZE = 16 * 1024;
+
+ public:
+  static constexpr bool HAS_SYMBOL_PAIR_TRANSITIONS =
+    sizeof(ItemT) * MAX_NUM_STATES * MAX_NUM_SYMBOLS * MAX_NUM_SYMBOLS <=
+    MAX_SYMBOL_PAIR_TABLE_SIZE;
+
+ private:
+  static constexpr int32_t NUM_SYMBOL_PAIR_TRANSITIONS =
+    HAS_SYMBOL_PAIR_TRANSITIONS ? MAX_NUM_STATES * MAX_NUM_SYMBOLS * MAX_NUM_SYMBOLS : 1;
+
   struct _TempStorage {
     ItemT transitions[MAX_NUM_STATES * MAX_NUM_SYMBOLS];
+    ItemT symbol_pair_transitions[NUM_SYMBOL_PAIR_TRANSITIONS];
   };
 
  public:
@@ -415,6 +433,46 @@ class TransitionTable {
     return temp_storage.transitions[match_id * MAX_NUM_STATES + state_id];
   }
 
+  /**
+   * @brief Composes the transitions of all pairs of symbol groups. Must be called by all threads
+   * of the thread block, and the composed transitions are available after the next
+   * `__syncthreads()`.
+   */
+  CUDF_HOST_DEVICE void InitSymbolPairTransitions()
+  {
+    static_assert(HAS_SYMBOL_PAIR_TRANSITIONS, "The symbol pair transitions exceed their budget");
+#if CUB_PTX_ARCH > 0
+    for (int i = threadIdx.x; i < NUM_SYMBOL_PAIR_TRANSITIONS; i += blockDim.x) {
+#else
+    for (int i = 0; i < NUM_SYMBOL_PAIR_TRANSITIONS; ++i) {
+#endif
+      auto const state_id   = i % MAX_NUM_STATES;
+      auto const match_id_0 = (i / MAX_NUM_STATES) % MAX_NUM_SYMBOLS;
+      auto const match_id_1 = i / (MAX_NUM_STATES * MAX_NUM_SYMBOLS);
+      temp_storage.symbol_pair_transitions[i] =
+        temp_storage.transitions[match_id_1 * MAX_NUM_STATES +
+                                 temp_storage.transitions[match_id_0 * MAX_NUM_STATES + state_id]];
+    }
+  }
+
+  /**
+   * @brief Returns the state reached from `state_id` after reading a symbol of group `match_id_0`
+   * followed by a symbol of group `match_id_1`. Requires `InitSymbolPairTransitions()`.
+   *
+   * @param state_id The DFA's current state index from which we'll transition
+   * @param match_id_0 The symbol group id of the first symbol that we read in
+   * @param match_id_1 The symbol group id of the second symbol that we read in
+   */
+  template <typename StateIndexT, typename SymbolIndexT>
+  constexpr CUDF_HOST_DEVICE int32_t operator()(StateIndexT const state_id,
+                                                SymbolIndexT const match_id_0,
+                                                SymbolIndexT const match_id_1) const
+  {
+    return temp_storage.symbol_pair_transitions[(match_id_1 * MAX_NUM_SYMBOLS + match_id_0) *
+                                                  MAX_NUM_STATES +
+                                                state_id];
+  }
+
  private:
   _TempStorage& temp_storage;
 
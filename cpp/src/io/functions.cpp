@@ -215,6 +215,38 @@ table_with_metadata read_json(json_reader_options options,
   return json::detail::read_json(datasources, options, stream, mr);
 }
 
+chunked_json_reader::chunked_json_reader(std::size_t input_chunk_size,
+                                         json_reader_options const& options,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  auto reader_options = options;
+  reader_options.set_compression(
+    infer_compression_type(options.get_compression(), options.get_source()));
+
+  reader = std::make_unique<json::detail::chunked_reader>(input_chunk_size,
+                                                          make_datasources(options.get_source()),
+                                                          reader_options,
+                                                          stream,
+                                                          mr);
+}
+
+chunked_json_reader::~chunked_json_reader() = default;
+
+bool chunked_json_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+table_with_metadata chunked_json_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 void write_json(json_writer_options const& options,
                 rmm::cuda_stream_view stream,
                 rmm::device_async_resource_ref mr)
@@ -251,6 +283,38 @@ table_with_metadata read_csv(csv_reader_options options,
     mr);
 }
 
+chunked_csv_reader::chunked_csv_reader(std::size_t input_chunk_size,
+                                       csv_reader_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  auto reader_options = options;
+  reader_options.set_compression(
+    infer_compression_type(options.get_compression(), options.get_source()));
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  reader = std::make_unique<detail::csv::chunked_reader>(
+    input_chunk_size, std::move(datasources[0]), reader_options, stream, mr);
+}
+
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+table_with_metadata chunked_csv_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options,
                rmm::cuda_stream_view stream,
@@ -861,6 +925,19 @@ parquet_writer_options_builder& parquet_writer_options_builder::write_v2_headers
   return *this;
 }
 
+parquet_writer_options_builder& parquet_writer_options_builder::dictionary_cardinality_estimate(
+  bool enabled)
+{
+  options.enable_dictionary_cardinality_estimate(enabled);
+  return *this;
+}
+
+parquet_writer_options_builder& parquet_writer_options_builder::encoded_row_group_size(bool enabled)
+{
+  options.enable_encoded_row_group_size(enabled);
+  return *this;
+}
+
 parquet_writer_options_builder& parquet_writer_options_builder::sorting_columns(
   std::vector<sorting_column> sorting_columns)
 {
@@ -956,6 +1033,20 @@ chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::
   return *this;
 }
 
+chunked_parquet_writer_options_builder&
+chunked_parquet_writer_options_builder::dictionary_cardinality_estimate(bool enabled)
+{
+  options.enable_dictionary_cardinality_estimate(enabled);
+  return *this;
+}
+
+chunked_parquet_writer_options_builder&
+chunked_parquet_writer_options_builder::encoded_row_group_size(bool enabled)
+{
+  options.enable_encoded_row_group_size(enabled);
+  return *this;
+}
+
 chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::sorting_columns(
   std::vector<sorting_column> sorting_columns)
 {
@@ -652,17 +652,20 @@ void make_device_json_column(device_span<SymbolT const> input,
   };
 
   // Prune columns that are not required to be parsed.
-  if (options.is_enabled_prune_columns()) {
+  auto const selected_paths = split_column_paths(options.get_columns());
+  if (options.is_enabled_prune_columns() or not selected_paths.empty()) {
     for (auto const this_col_id : unique_col_ids) {
       if (column_categories[this_col_id] == NC_ERR || column_categories[this_col_id] == NC_FN) {
         continue;
       }
       // Struct, List, String, Value
       auto [name, parent_col_id] = name_and_parent_index(this_col_id);
-      // get path of this column, and get its dtype if present in options
-      auto const nt                             = tree_path.get_path(this_col_id);
-      std::optional<data_type> const user_dtype = get_path_data_type(nt, options);
-      if (!user_dtype.has_value() and parent_col_id != parent_node_sentinel) {
+      // get path of this column, and check if it is selected and its dtype present in options
+      auto const nt          = tree_path.get_path(this_col_id);
+      auto const is_selected = selected_paths.empty() or is_selected_path(nt, selected_paths);
+      auto const is_in_schema =
+        not options.is_enabled_prune_columns() or get_path_data_type(nt, options).has_value();
+      if (!(is_selected and is_in_schema) and parent_col_id != parent_node_sentinel) {
         is_pruned[this_col_id] = 1;
         continue;
       } else {
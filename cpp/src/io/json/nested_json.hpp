@@ -331,6 +331,27 @@ std::optional<data_type> get_path_data_type(
   host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
   cudf::io::json_reader_options const& options);
 
+/**
+ * @brief Splits the dot-separated column paths of the reader options into field names
+ *
+ * @param columns Paths of the selected columns
+ * @return Field names of each path, from the root to the selected column
+ */
+std::vector<std::vector<std::string>> split_column_paths(std::vector<std::string> const& columns);
+
+/**
+ * @brief Whether a column is read when only the given column paths are selected
+ *
+ * A column is read if it is selected, if it is a descendant of a selected column, or if it is an
+ * ancestor of a selected column. Children of list columns are matched by the path of the list.
+ *
+ * @param path path of the column, as returned by `path_from_tree::get_path`
+ * @param selected_paths Field names of the selected column paths
+ * @return true if the column is read
+ */
+bool is_selected_path(host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
+                      host_span<std::vector<std::string> const> selected_paths);
+
 /**
  * @brief Helper class to get path of a column by column id from reduced column tree
  *
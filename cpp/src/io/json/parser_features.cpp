@@ -18,6 +18,7 @@
 
 #include <cudf/detail/utilities/visitor_overload.hpp>
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <vector>
@@ -101,6 +102,46 @@ std::optional<data_type> get_path_data_type(
   }
 }
 
+std::vector<std::vector<std::string>> split_column_paths(std::vector<std::string> const& columns)
+{
+  std::vector<std::vector<std::string>> paths;
+  paths.reserve(columns.size());
+  for (auto const& column : columns) {
+    std::vector<std::string> names;
+    std::size_t begin = 0;
+    while (true) {
+      auto const end = column.find('.', begin);
+      names.push_back(column.substr(begin, end == std::string::npos ? end : end - begin));
+      if (end == std::string::npos) { break; }
+      begin = end + 1;
+    }
+    paths.push_back(std::move(names));
+  }
+  return paths;
+}
+
+bool is_selected_path(host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
+                      host_span<std::vector<std::string> const> selected_paths)
+{
+  // field names from the root to the leaf; children of lists have no field name of their own
+  std::vector<std::string const*> names;
+  names.reserve(path.size());
+  for (auto i = path.size(); i > 0; --i) {
+    if (i < path.size() and path[i].second == NC_LIST) { continue; }
+    names.push_back(&path[i - 1].first);
+  }
+  // A column is read if it is selected, a descendant of a selected column, or an ancestor of one
+  return std::any_of(selected_paths.begin(), selected_paths.end(), [&](auto const& selected) {
+    auto const common = std::min(selected.size(), names.size());
+    return std::equal(selected.begin(),
+                      selected.begin() + common,
+                      names.begin(),
+                      [](std::string const& name, std::string const* path_name) {
+                        return name == *path_name;
+                      });
+  });
+}
+
 // idea: write a memoizer using template and lambda?, then call recursively.
 std::vector<path_from_tree::path_rep> path_from_tree::get_path(NodeIndexT this_col_id)
 {
@@ -19,20 +19,27 @@
 #include "io/json/nested_json.hpp"
 #include "read_json.hpp"
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/detail/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/fill.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/scatter.h>
 
+#include <algorithm>
+#include <map>
 #include <numeric>
 
 namespace cudf::io::json::detail {
@@ -271,6 +278,8 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   if (reader_opts.is_enabled_legacy()) {
+    CUDF_EXPECTS(reader_opts.get_columns().empty(),
+                 "Selecting columns is not supported by the legacy JSON reader");
     return legacy::read_json(sources, reader_opts, stream, mr);
   }
 #pragma GCC diagnostic pop
@@ -308,4 +317,144 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
   return device_parse_nested_json(buffer, reader_opts, stream, mr);
 }
 
+namespace {
+
+/**
+ * @brief Builds the schema element of a column read from a JSON input.
+ *
+ * @param col The column
+ * @param info Names of the column and its children
+ * @param[out] is_complete Set to false if the element type of a list column is unknown
+ */
+schema_element make_schema_element(column_view const& col,
+                                   column_name_info const& info,
+                                   bool& is_complete)
+{
+  schema_element element{col.type()};
+  if (col.type().id() == type_id::STRUCT) {
+    for (size_type i = 0; i < col.num_children(); ++i) {
+      element.child_types.emplace(info.children[i].name,
+                                  make_schema_element(col.child(i), info.children[i], is_complete));
+    }
+  } else if (col.type().id() == type_id::LIST) {
+    auto const child = col.child(lists_column_view::child_column_index);
+    // Lists without any elements have a placeholder child, its type is inferred from later chunks
+    if (child.size() == 0 or info.children.size() <= lists_column_view::child_column_index) {
+      is_complete = false;
+    } else {
+      auto const& child_info = info.children[lists_column_view::child_column_index];
+      element.child_types.emplace(child_info.name,
+                                  make_schema_element(child, child_info, is_complete));
+    }
+  }
+  return element;
+}
+
+}  // namespace
+
+chunked_reader::chunked_reader(std::size_t input_chunk_size,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               json_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _sources{std::move(sources)},
+    _options{options},
+    _input_chunk_size{input_chunk_size},
+    _total_size{sources_size(_sources, 0, 0)},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(_options.is_enabled_lines(), "Chunked reading is supported only for JSON Lines");
+  CUDF_EXPECTS(_options.get_compression() == compression_type::NONE,
+               "Chunked reading of compressed inputs is not supported");
+  CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+               "Chunked reading does not support specifying a byte range");
+  CUDF_EXPECTS(not _options.is_enabled_legacy(), "Chunked reading requires the nested JSON reader");
+  if (_input_chunk_size == 0) { _input_chunk_size = std::max<std::size_t>(_total_size, 1); }
+}
+
+bool chunked_reader::has_next() const { return _num_chunks_read == 0 or _offset < _total_size; }
+
+table_with_metadata chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  // Byte ranges without a line delimiter contain no records; continue with the next one
+  while (_offset < _total_size) {
+    auto const chunk_size = std::min(_input_chunk_size, _total_size - _offset);
+    auto chunk_options    = _options;
+    chunk_options.set_byte_range_offset(_offset);
+    chunk_options.set_byte_range_size(chunk_size);
+    _offset += chunk_size;
+
+    auto chunk = read_json(_sources, chunk_options, _stream, _mr);
+    if (chunk.tbl->num_rows() == 0) { continue; }
+    ++_num_chunks_read;
+    return conform_to_schema(std::move(chunk));
+  }
+
+  ++_num_chunks_read;
+  if (_schema_columns == nullptr) { return {std::make_unique<table>(), {}}; }
+  return {std::make_unique<table>(_schema_columns->view(), _stream, _mr), _schema_metadata};
+}
+
+table_with_metadata chunked_reader::conform_to_schema(table_with_metadata&& chunk)
+{
+  if (_schema_columns == nullptr) {
+    // The first chunk defines the schema of all chunks
+    _schema_columns  = cudf::empty_like(chunk.tbl->view());
+    _schema_metadata = chunk.metadata;
+
+    auto const has_user_dtypes =
+      std::visit([](auto const& dtypes) { return not dtypes.empty(); }, _options.get_dtypes());
+    if (not has_user_dtypes) {
+      std::map<std::string, schema_element> dtypes;
+      bool is_complete = true;
+      auto const view  = chunk.tbl->view();
+      for (size_type i = 0; i < view.num_columns(); ++i) {
+        auto const& info = chunk.metadata.schema_info[i];
+        dtypes.emplace(info.name, make_schema_element(view.column(i), info, is_complete));
+      }
+      _options.set_dtypes(std::move(dtypes));
+      // Columns that are not in the first chunk cannot be pruned while the element types of some
+      // list columns are still unknown, since pruning would also drop those list elements
+      _options.enable_prune_columns(is_complete);
+    }
+    return std::move(chunk);
+  }
+
+  auto const& schema_info = _schema_metadata.schema_info;
+  auto const num_rows     = chunk.tbl->num_rows();
+  auto chunk_columns      = chunk.tbl->release();
+  std::vector<std::unique_ptr<column>> columns;
+  columns.reserve(schema_info.size());
+  for (size_t i = 0; i < schema_info.size(); ++i) {
+    auto const schema_column = _schema_columns->view().column(i);
+    auto const it =
+      std::find_if(chunk.metadata.schema_info.cbegin(),
+                   chunk.metadata.schema_info.cend(),
+                   [&](auto const& info) { return info.name == schema_info[i].name; });
+    if (it == chunk.metadata.schema_info.cend()) {
+      // Gathering out of bounds from the empty column of the schema yields all nulls
+      rmm::device_uvector<size_type> gather_map(num_rows, _stream);
+      thrust::fill(
+        rmm::exec_policy_nosync(_stream), gather_map.begin(), gather_map.end(), size_type{0});
+      auto nulls = cudf::detail::gather(table_view{{schema_column}},
+                                        gather_map,
+                                        out_of_bounds_policy::NULLIFY,
+                                        cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                        _stream,
+                                        _mr);
+      columns.push_back(std::move(nulls->release().front()));
+      continue;
+    }
+    auto& column = chunk_columns[std::distance(chunk.metadata.schema_info.cbegin(), it)];
+    CUDF_EXPECTS(cudf::have_same_types(column->view(), schema_column),
+                 "The schema of a chunk differs from the schema of the first chunk; specify the "
+                 "data types of the columns with `set_dtypes`",
+                 cudf::data_type_error);
+    columns.push_back(std::move(column));
+  }
+  return {std::make_unique<table>(std::move(columns)), _schema_metadata};
+}
+
 }  // namespace cudf::io::json::detail
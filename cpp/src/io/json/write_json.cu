@@ -19,6 +19,7 @@
  * @brief cuDF-IO JSON writer implementation
  */
 
+#include "io/comp/comp.hpp"
 #include "io/csv/durations.hpp"
 #include "io/utilities/parsing_utils.cuh"
 #include "lists/utilities.hpp"
@@ -35,13 +36,18 @@
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/convert/fixed_point_to_string.cuh>
+#include <cudf/strings/detail/convert/int_to_string.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -82,7 +88,7 @@ struct escape_strings_fn {
   char* d_chars{};
   cudf::detail::input_offsetalator d_offsets;
 
-  __device__ void write_char(char_utf8 chr, char*& d_buffer, size_type& bytes)
+  __device__ static void write_char(char_utf8 chr, char*& d_buffer, size_type& bytes)
   {
     if (d_buffer)
       d_buffer += cudf::strings::detail::from_char_utf8(chr, d_buffer);
@@ -90,12 +96,14 @@ struct escape_strings_fn {
       bytes += cudf::strings::detail::bytes_in_char_utf8(chr);
   }
 
-  __device__ inline char nibble_to_hex(uint8_t nibble) const
+  __device__ static inline char nibble_to_hex(uint8_t nibble)
   {
     return nibble < 10 ? '0' + nibble : 'a' + nibble - 10;
   }
 
-  __device__ void write_utf8_codepoint(uint16_t codepoint, char*& d_buffer, size_type& bytes)
+  __device__ static void write_utf8_codepoint(uint16_t codepoint,
+                                              char*& d_buffer,
+                                              size_type& bytes)
   {
     if (d_buffer) {
       d_buffer[0] = '\\';
@@ -110,7 +118,9 @@ struct escape_strings_fn {
     }
   }
 
-  __device__ void write_utf16_codepoint(uint32_t codepoint, char*& d_buffer, size_type& bytes)
+  __device__ static void write_utf16_codepoint(uint32_t codepoint,
+                                               char*& d_buffer,
+                                               size_type& bytes)
   {
     constexpr uint16_t UTF16_HIGH_SURROGATE_BEGIN = 0xD800;
     constexpr uint16_t UTF16_LOW_SURROGATE_BEGIN  = 0xDC00;
@@ -121,23 +131,21 @@ struct escape_strings_fn {
     write_utf8_codepoint(hex_low, d_buffer, bytes);
   }
 
-  __device__ void operator()(size_type idx)
+  /**
+   * @brief Writes `d_str` double-quoted with its escape characters converted
+   *
+   * @param d_str The string to write
+   * @param d_buffer Output position, advanced past the written bytes; nullptr to only count them
+   * @param bytes Incremented by the number of bytes when `d_buffer` is nullptr
+   */
+  __device__ static void write_escaped_string(string_view const d_str,
+                                              char*& d_buffer,
+                                              size_type& bytes)
   {
-    if (d_column.is_null(idx)) {
-      if (!d_chars) { d_sizes[idx] = 0; }
-      return;
-    }
-
-    auto const d_str = d_column.element<string_view>(idx);
-
     // entire string must be double-quoted.
     constexpr char_utf8 const quote = '\"';  // wrap quotes
-    bool constexpr quote_row        = true;
-
-    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
-    size_type bytes = 0;
 
-    if (quote_row) write_char(quote, d_buffer, bytes);
+    write_char(quote, d_buffer, bytes);
     for (auto utf8_char : d_str) {
       if (utf8_char > 0x0000'00FF) {
         // multi-byte char
@@ -160,7 +168,22 @@ struct escape_strings_fn {
         write_char(escaped_chars.second, d_buffer, bytes);
       }
     }
-    if (quote_row) write_char(quote, d_buffer, bytes);
+    write_char(quote, d_buffer, bytes);
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+
+    auto const d_str = d_column.element<string_view>(idx);
+
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+
+    write_escaped_string(d_str, d_buffer, bytes);
     constexpr char_utf8 const colon = ':';  // append colon
     if (append_colon) write_char(colon, d_buffer, bytes);
 
@@ -357,6 +380,177 @@ std::unique_ptr<column> struct_to_strings(table_view const& strings_columns,
     {});
 }
 
+/**
+ * @brief Copies `d_str` to `d_buffer`, or adds its size to `bytes` when `d_buffer` is nullptr
+ */
+__device__ inline void write_json_string(string_view const d_str,
+                                         char*& d_buffer,
+                                         size_type& bytes)
+{
+  if (d_buffer) {
+    d_buffer = cudf::strings::detail::copy_string(d_buffer, d_str);
+  } else {
+    bytes += d_str.size_bytes();
+  }
+}
+
+/**
+ * @brief Returns true if every column of `input` can be written by `flat_table_to_json`
+ */
+bool is_flat_json_table(table_view const& input)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+    return col.type().id() == type_id::STRING || cudf::is_integral(col.type()) ||
+           cudf::is_fixed_point(col.type());
+  });
+}
+
+/**
+ * @brief Type dispatched functor writing one valid value of a column in JSON format
+ *
+ * Writes the same characters as the per-column conversions of `column_to_strings_fn`.
+ */
+struct write_json_value_fn {
+  string_view const true_value;
+  string_view const false_value;
+
+  template <typename T>
+  __device__ void operator()(column_device_view const& col,
+                             size_type row,
+                             char*& d_buffer,
+                             size_type& bytes) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      escape_strings_fn::write_escaped_string(col.element<string_view>(row), d_buffer, bytes);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      write_json_string(col.element<bool>(row) ? true_value : false_value, d_buffer, bytes);
+    } else if constexpr (std::is_integral_v<T>) {
+      auto const value = col.element<T>(row);
+      if (d_buffer) {
+        d_buffer += cudf::strings::detail::integer_to_string(value, d_buffer);
+      } else {
+        bytes += cudf::strings::detail::count_digits(value);
+      }
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      auto const value = col.element<device_storage_type_t<T>>(row);
+      auto const scale = col.type().scale();
+      auto const size  = cudf::strings::detail::fixed_point_string_size(value, scale);
+      if (d_buffer) {
+        cudf::strings::detail::fixed_point_to_string(value, scale, d_buffer);
+        d_buffer += size;
+      } else {
+        bytes += size;
+      }
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for direct JSON serialization");
+    }
+  }
+};
+
+/**
+ * @brief Functor writing each row of a table as a JSON object
+ *
+ * Used with `make_strings_children`: the first pass computes the size of each row and the second
+ * pass writes the row into its position of the output characters.
+ */
+struct flat_row_to_json_fn {
+  table_device_view const tbl;
+  column_device_view const col_names;  // escaped column names followed by ':'
+  string_view const row_prefix;        // "{"
+  string_view const row_suffix;        // "}" or "}\n" for json-lines
+  string_view const value_separator;   // ","
+  string_view const narep;             // null entry replacement
+  bool const include_nulls;
+  write_json_value_fn const write_value;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type idx)
+  {
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+
+    write_json_string(row_prefix, d_buffer, bytes);
+    bool has_values = false;
+    for (size_type col_idx = 0; col_idx < tbl.num_columns(); ++col_idx) {
+      auto const& col    = tbl.column(col_idx);
+      auto const is_null = col.is_null(idx);
+      if (is_null && !include_nulls) { continue; }
+      if (has_values) { write_json_string(value_separator, d_buffer, bytes); }
+      has_values = true;
+
+      // column_name: value
+      write_json_string(col_names.element<string_view>(col_idx), d_buffer, bytes);
+      if (is_null) {
+        write_json_string(narep, d_buffer, bytes);
+      } else {
+        cudf::type_dispatcher(col.type(), write_value, col, idx, d_buffer, bytes);
+      }
+    }
+    write_json_string(row_suffix, d_buffer, bytes);
+
+    if (!d_chars) { d_sizes[idx] = bytes; }
+  }
+};
+
+/**
+ * @brief Writes each row of a table of string, boolean, integer and decimal columns as a JSON
+ * object
+ *
+ * Produces the same strings as converting each column to strings and joining them with
+ * `struct_to_strings`, but formats the values of each row directly into the output. This avoids
+ * the strings column of each input column and the joining passes over them.
+ *
+ * @param input Table of columns accepted by `is_flat_json_table`
+ * @param column_names Column of escaped names, followed by ':', of each column in the table
+ * @param row_prefix Prepend this string to each row
+ * @param row_suffix Append this string to each row
+ * @param value_separator Separator between values
+ * @param narep Null-String replacement
+ * @param true_value String written for true booleans
+ * @param false_value String written for false booleans
+ * @param include_nulls Include null entries in the output
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource to use for device memory allocation.
+ * @return New strings column of JSON structs in each row
+ */
+std::unique_ptr<column> flat_table_to_json(table_view const& input,
+                                           column_view const& column_names,
+                                           string_view const row_prefix,
+                                           string_view const row_suffix,
+                                           string_view const value_separator,
+                                           string_scalar const& narep,
+                                           string_scalar const& true_value,
+                                           string_scalar const& false_value,
+                                           bool include_nulls,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(column_names.type().id() == type_id::STRING, "Column names must be of type string");
+  CUDF_EXPECTS(input.num_columns() == column_names.size(),
+               "Number of column names should be equal to number of columns in the table");
+  if (input.num_rows() == 0) { return make_empty_column(type_id::STRING); }
+
+  auto const d_input        = table_device_view::create(input, stream);
+  auto const d_column_names = column_device_view::create(column_names, stream);
+  auto [offsets, chars]     = cudf::strings::detail::make_strings_children(
+    flat_row_to_json_fn{*d_input,
+                        *d_column_names,
+                        row_prefix,
+                        row_suffix,
+                        value_separator,
+                        narep.value(stream),
+                        include_nulls,
+                        write_json_value_fn{true_value.value(stream), false_value.value(stream)}},
+    input.num_rows(),
+    stream,
+    mr);
+
+  return make_strings_column(input.num_rows(), std::move(offsets), chars.release(), 0, {});
+}
+
 /**
  * @brief Concatenates a list of strings columns into a single strings column.
  *
@@ -690,6 +884,23 @@ struct column_to_strings_fn {
     auto const num_columns = std::distance(column_begin, column_end);
     auto column_names      = make_column_names_column(children_names, num_columns, stream_);
     auto column_names_view = column_names->view();
+
+    // Write the rows directly when no column needs the per-column conversion.
+    std::vector<column_view> const columns(column_begin, column_end);
+    if (is_flat_json_table(table_view{columns})) {
+      return flat_table_to_json(table_view{columns},
+                                column_names_view,
+                                struct_row_begin_wrap.value(stream_),
+                                row_end_wrap_value,
+                                struct_value_separator.value(stream_),
+                                narep,
+                                true_value,
+                                false_value,
+                                options_.is_enabled_include_nulls(),
+                                stream_,
+                                rmm::mr::get_current_device_resource());
+    }
+
     std::vector<std::unique_ptr<cudf::column>> str_column_vec;
 
     // populate vector of string-converted columns:
@@ -847,6 +1058,15 @@ void write_json(data_sink* out_sink,
       return names;
     }
   }();
+
+  // Compress the output on the GPU, if requested
+  std::unique_ptr<data_sink> compressed_out;
+  if (options.get_compression() != compression_type::NONE) {
+    compressed_out = std::make_unique<cudf::io::detail::compressed_sink>(
+      options.get_compression(), out_sink, stream);
+    out_sink       = compressed_out.get();
+  }
+
   auto const line_terminator = std::string(options.is_enabled_lines() ? "\n" : ",");
   string_scalar const d_line_terminator_with_row_end{"}" + line_terminator, true, stream};
   string_scalar const d_line_terminator{line_terminator, true, stream};
@@ -931,6 +1151,8 @@ void write_json(data_sink* out_sink,
       out_sink->host_write(list_braces.data() + 1, 1);
     }
   }
+
+  if (compressed_out) { compressed_out->flush(); }
 }
 
 }  // namespace cudf::io::json::detail
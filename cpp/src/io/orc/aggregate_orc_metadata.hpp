@@ -18,6 +18,11 @@
 
 #include "orc.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <functional>
 #include <map>
 #include <optional>
 #include <vector>
@@ -129,6 +134,30 @@ class aggregate_orc_metadata {
     std::optional<size_type> const& num_read_rows,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Filters the stripes using the stripe statistics and, optionally, the row index
+   * statistics of the columns referenced by the filter.
+   *
+   * A stripe is kept unless its statistics prove that none of its rows satisfies the filter.
+   * With `use_row_index`, the row index of each stripe that survives the stripe statistics is read
+   * as well, and the stripe is dropped if none of its row groups can satisfy the filter.
+   *
+   * @param stripe_indices Lists of stripes to filter, one per source; all stripes if empty
+   * @param output_dtypes Datatypes of the output columns
+   * @param output_column_ids ORC column IDs of the output columns
+   * @param filter AST expression to filter the stripes with, referencing the output columns
+   * @param use_row_index Whether to also evaluate the filter on the row index statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered stripe indices, one list per source; `nullopt` if no stripe was filtered out
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_stripes(
+    host_span<std::vector<size_type> const> stripe_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_ids,
+    std::reference_wrapper<ast::expression const> filter,
+    bool use_row_index,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Hashing and sizing of ORC `BLOOM_FILTER_UTF8` bloom filters, usable on host and device
+ *
+ * These follow the Java ORC implementation (`org.apache.orc.util.BloomFilter`) bit for bit, so that
+ * the filters written by cuDF can be used by other readers and vice versa: integers and dates are
+ * hashed with Thomas Wang's 64-bit integer hash, floating point values are hashed as the bits of
+ * the double value, and strings are hashed with ORC's 64-bit variant of Murmur3.
+ */
+
+namespace cudf::io::orc {
+
+// Number of bits in a word of the bloom filter bitset
+constexpr uint32_t bloom_filter_word_bits = 64;
+
+/**
+ * @brief Computes the bloom filter hash of an integer (or date) value
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(int64_t value)
+{
+  // Java shifts are arithmetic on `long`, additions wrap around
+  auto const sra = [](uint64_t v, int n) {
+    return static_cast<uint64_t>(static_cast<int64_t>(v) >> n);
+  };
+  auto key = static_cast<uint64_t>(value);
+  key      = (~key) + (key << 21);
+  key      = key ^ sra(key, 24);
+  key      = (key + (key << 3)) + (key << 8);
+  key      = key ^ sra(key, 14);
+  key      = (key + (key << 2)) + (key << 4);
+  key      = key ^ sra(key, 28);
+  key      = key + (key << 31);
+  return key;
+}
+
+/**
+ * @brief Computes the bloom filter hash of a floating point value
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_double_hash(double value)
+{
+  // Java's `doubleToLongBits` maps every NaN to the canonical NaN
+  int64_t bits = 0x7ff8000000000000L;
+  if (value == value) { memcpy(&bits, &value, sizeof(bits)); }
+  return bloom_filter_long_hash(bits);
+}
+
+/**
+ * @brief Computes the bloom filter hash of a byte string (ORC's Murmur3 `hash64`)
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_bytes_hash(char const* data, size_type size)
+{
+  constexpr uint64_t c1   = 0x87c37b91114253d5UL;
+  constexpr uint64_t c2   = 0x4cf5ad432745937fUL;
+  constexpr uint64_t m    = 5;
+  constexpr uint64_t n1   = 0x52dce729;
+  constexpr uint64_t seed = 104729;
+
+  auto const rotl = [](uint64_t v, int r) { return (v << r) | (v >> (64 - r)); };
+  auto const byte = [data](size_type i) {
+    return static_cast<uint64_t>(static_cast<uint8_t>(data[i]));
+  };
+
+  uint64_t hash      = seed;
+  auto const nblocks = size / 8;
+  for (size_type block = 0; block < nblocks; ++block) {
+    uint64_t k = 0;
+    for (int b = 0; b < 8; ++b) {
+      k |= byte(block * 8 + b) << (8 * b);
+    }
+    k *= c1;
+    k = rotl(k, 31);
+    k *= c2;
+    hash ^= k;
+    hash = rotl(hash, 27) * m + n1;
+  }
+
+  auto const tail_start = nblocks * 8;
+  if (size > tail_start) {
+    uint64_t k = 0;
+    for (auto i = size - 1; i >= tail_start; --i) {
+      k ^= byte(i) << (8 * (i - tail_start));
+    }
+    k *= c1;
+    k = rotl(k, 31);
+    k *= c2;
+    hash ^= k;
+  }
+
+  hash ^= static_cast<uint64_t>(size);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdUL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53UL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns the position of the bit set by the `i`-th (one based) hash function for `hash`
+ *
+ * @param hash Hash of the value
+ * @param i Index of the hash function, in range [1, number of hash functions]
+ * @param num_bits Number of bits in the bloom filter
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  // Java `int` arithmetic, wrapping around on overflow
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + i * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Returns the number of 64-bit words of a bloom filter sized for the given number of
+ * entries and false positive probability
+ */
+inline uint32_t bloom_filter_num_words(uint32_t expected_entries, double fpp)
+{
+  auto const log2     = std::log(2.0);
+  auto const entries  = static_cast<double>(std::max(expected_entries, 1u));
+  auto const num_bits = static_cast<int64_t>(-entries * std::log(fpp) / (log2 * log2));
+  return static_cast<uint32_t>(
+    std::max<int64_t>(1, (num_bits + bloom_filter_word_bits - 1) / bloom_filter_word_bits));
+}
+
+/**
+ * @brief Returns the number of hash functions of a bloom filter with the given size
+ */
+inline uint32_t bloom_filter_num_hash_functions(uint32_t expected_entries, uint32_t num_words)
+{
+  auto const entries  = static_cast<double>(std::max(expected_entries, 1u));
+  auto const num_bits = static_cast<double>(num_words) * bloom_filter_word_bits;
+  return static_cast<uint32_t>(std::max(1L, std::lround(num_bits / entries * std::log(2.0))));
+}
+
+}  // namespace cudf::io::orc
@@ -168,6 +168,23 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::optional<column_statistics> statistics;  // statistics of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // the number of hash functions
+  std::string utf8bitset;         // the bitset as little-endian 64-bit words (BLOOM_FILTER_UTF8)
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one bloom filter per row group of the stripe
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -255,6 +272,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -528,6 +549,8 @@ class ProtobufWriter {
   size_t write(ColumnEncoding const&);
   size_t write(StripeStatistics const&);
   size_t write(Metadata const&);
+  size_t write(BloomFilter const&);
+  size_t write(BloomFilterIndex const&);
 
  protected:
   std::vector<uint8_t> m_buff;
@@ -199,6 +199,16 @@ struct stripe_dictionary {
   bool is_enabled       = false;     // true if dictionary encoding is enabled for this stripe
 };
 
+/**
+ * @brief Struct to describe the bloom filters of a single column, one filter per rowgroup
+ */
+struct bloom_filter_column {
+  uint32_t column_idx;          // column index
+  uint32_t num_hash_functions;  // number of hash functions of each filter
+  uint32_t num_words;           // number of 64-bit words of each filter
+  uint64_t* bitsets;            // filter words [rowgroup][word], zero-initialized
+};
+
 /**
  * @brief Initializes the hash maps storage for dictionary encoding to sentinel values.
  *
@@ -491,6 +501,19 @@ void reduce_pushdown_masks(device_span<orc_column_device_view const> orc_columns
                            device_2dspan<cudf::size_type> set_counts,
                            rmm::cuda_stream_view stream);
 
+/**
+ * @brief Inserts the valid elements of each rowgroup into the rowgroup's bloom filter.
+ *
+ * @param[in,out] filters Bloom filter descriptors, one per column with bloom filters enabled
+ * @param[in] orc_columns Pre-order flattened device array of ORC column views
+ * @param[in] rowgroup_bounds Ranges of rows in each rowgroup [rowgroup][column]
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void build_bloom_filters(device_span<bloom_filter_column const> filters,
+                         device_span<orc_column_device_view const> orc_columns,
+                         device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                         rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace orc
 }  // namespace io
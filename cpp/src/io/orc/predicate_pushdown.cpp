@@ -0,0 +1,694 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/orc/aggregate_orc_metadata.hpp"
+#include "io/orc/bloom_filter.hpp"
+#include "io/utilities/bloom_filter_expression_converter.hpp"
+#include "io/utilities/stats_expression_converter.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace cudf::io::orc::detail {
+
+using cudf::io::detail::bloom_filter_expression_converter;
+
+namespace {
+
+/**
+ * @brief Collects the indices of the columns referenced by an AST expression.
+ */
+class column_reference_collector : public ast::detail::expression_transformer {
+ public:
+  explicit column_reference_collector(ast::expression const& expr) { expr.accept(*this); }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    _indices.insert(expr.get_column_index());
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    CUDF_FAIL("Column name reference is not supported in ORC reader filter");
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    for (auto const& operand : expr.get_operands()) {
+      operand.get().accept(*this);
+    }
+    return expr;
+  }
+
+  /**
+   * @brief Returns the indices of the referenced columns.
+   *
+   * @return Indices of the columns referenced by the expression
+   */
+  [[nodiscard]] auto const& get_indices() const { return _indices; }
+
+ private:
+  std::unordered_set<size_type> _indices;
+};
+
+/**
+ * @brief Converts the ORC statistics of a column in each pruning unit (stripe or row group) to 2
+ * device columns - min, max values.
+ *
+ * Units without statistics, and units of decimal columns, get null min and max values, so that
+ * the filter evaluates to null and the unit is kept.
+ */
+struct stats_caster {
+  host_span<std::optional<column_statistics> const> stats;
+  TypeKind kind;
+
+  template <typename T>
+  using host_value_type = std::conditional_t<std::is_same_v<T, string_view>, std::string, T>;
+
+  template <typename T>
+  using minmax_type =
+    std::pair<std::optional<host_value_type<T>>, std::optional<host_value_type<T>>>;
+
+  // Converts a timestamp in milliseconds since the epoch to `T`, rounding down or up
+  template <typename T>
+  static T to_timestamp(int64_t millis, bool round_up)
+  {
+    auto const duration = cudf::duration_ms{millis};
+    return T{round_up ? cuda::std::chrono::ceil<typename T::duration>(duration)
+                      : cuda::std::chrono::floor<typename T::duration>(duration)};
+  }
+
+  template <typename T>
+  minmax_type<T> minmax(column_statistics const& s) const
+  {
+    if constexpr (cudf::is_boolean<T>()) {
+      if (not s.bucket_stats.has_value() or s.bucket_stats->count.empty() or
+          not s.number_of_values.has_value()) {
+        return {};
+      }
+      auto const num_true = s.bucket_stats->count[0];
+      return {num_true == s.number_of_values.value(), num_true > 0};
+    } else if constexpr (cudf::is_integral<T>()) {
+      // decimal columns are dispatched as their storage type, but their statistics are strings
+      if (kind == DECIMAL or not s.int_stats.has_value() or not s.int_stats->minimum.has_value() or
+          not s.int_stats->maximum.has_value()) {
+        return {};
+      }
+      return {static_cast<T>(s.int_stats->minimum.value()),
+              static_cast<T>(s.int_stats->maximum.value())};
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      if (not s.double_stats.has_value() or not s.double_stats->minimum.has_value() or
+          not s.double_stats->maximum.has_value()) {
+        return {};
+      }
+      return {static_cast<T>(s.double_stats->minimum.value()),
+              static_cast<T>(s.double_stats->maximum.value())};
+    } else if constexpr (std::is_same_v<T, string_view>) {
+      if (not s.string_stats.has_value() or not s.string_stats->minimum.has_value() or
+          not s.string_stats->maximum.has_value()) {
+        return {};
+      }
+      return {s.string_stats->minimum, s.string_stats->maximum};
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      if (kind == DATE) {
+        if (not s.date_stats.has_value() or not s.date_stats->minimum.has_value() or
+            not s.date_stats->maximum.has_value()) {
+          return {};
+        }
+        auto const day_millis = int64_t{24 * 60 * 60 * 1000};
+        return {to_timestamp<T>(s.date_stats->minimum.value() * day_millis, false),
+                to_timestamp<T>(s.date_stats->maximum.value() * day_millis, true)};
+      }
+      // the output is in UTC; the local time statistics cannot be used
+      if (not s.timestamp_stats.has_value() or not s.timestamp_stats->minimum_utc.has_value() or
+          not s.timestamp_stats->maximum_utc.has_value()) {
+        return {};
+      }
+      // the statistics are truncated to milliseconds, so the maximum is rounded up
+      return {to_timestamp<T>(s.timestamp_stats->minimum_utc.value(), false),
+              to_timestamp<T>(s.timestamp_stats->maximum_utc.value() + 1, true)};
+    } else {
+      return {};
+    }
+  }
+
+  // Local struct to hold host columns
+  template <typename T>
+  struct host_column {
+    // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+    thrust::host_vector<host_value_type<T>> val;
+    std::vector<bitmask_type> null_mask;
+    cudf::size_type null_count = 0;
+    host_column(size_type num_units)
+      : val(num_units),
+        null_mask(
+          cudf::util::div_rounding_up_safe<size_type>(
+            cudf::bitmask_allocation_size_bytes(num_units), sizeof(bitmask_type)),
+          ~bitmask_type{0})
+    {
+    }
+
+    void set_index(size_type index, std::optional<host_value_type<T>> const& value)
+    {
+      if (value.has_value()) {
+        val[index] = value.value();
+        return;
+      }
+      clear_bit_unsafe(null_mask.data(), index);
+      null_count++;
+    }
+
+    auto to_device(cudf::data_type dtype,
+                   rmm::cuda_stream_view stream,
+                   rmm::device_async_resource_ref mr)
+    {
+      if constexpr (std::is_same_v<T, string_view>) {
+        std::vector<char> chars{};
+        std::vector<cudf::size_type> offsets(1, 0);
+        for (auto const& str : val) {
+          chars.insert(chars.end(), str.cbegin(), str.cend());
+          offsets.push_back(offsets.back() + str.size());
+        }
+        auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+        auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+        return cudf::make_strings_column(
+          val.size(),
+          std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+          d_chars.release(),
+          null_count,
+          rmm::device_buffer{
+            null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
+      } else {
+        return std::make_unique<column>(
+          dtype,
+          val.size(),
+          cudf::detail::make_device_uvector_async(val, stream, mr).release(),
+          rmm::device_buffer{
+            null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
+          null_count);
+      }
+    }
+  };  // local struct host_column
+
+  // Creates device columns from column statistics (min, max)
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    cudf::data_type dtype, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+  {
+    // List, Struct, Dictionary types are not supported
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
+    } else {
+      auto const num_units = static_cast<size_type>(stats.size());
+      host_column<T> min(num_units);
+      host_column<T> max(num_units);
+      for (size_type unit_idx = 0; unit_idx < num_units; ++unit_idx) {
+        auto const [min_value, max_value] =
+          stats[unit_idx].has_value() ? minmax<T>(stats[unit_idx].value()) : minmax_type<T>{};
+        min.set_index(unit_idx, min_value);
+        max.set_index(unit_idx, max_value);
+      }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
+    }
+  }
+};
+
+/**
+ * @brief Evaluates the filter on the min/max statistics of the pruning units.
+ *
+ * @param stats Statistics of each unit, per output column; empty for the columns that are not
+ * referenced by the filter
+ * @param num_units Number of pruning units
+ * @param output_dtypes Datatypes of the output columns
+ * @param output_kinds ORC type kinds of the output columns
+ * @param filter AST expression referencing the output columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Whether each unit may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_stats_filter(
+  std::vector<std::vector<std::optional<column_statistics>>> const& stats,
+  size_type num_units,
+  host_span<data_type const> output_dtypes,
+  host_span<TypeKind const> output_kinds,
+  ast::expression const& filter,
+  rmm::cuda_stream_view stream)
+{
+  if (num_units == 0) { return {}; }
+  auto mr = rmm::mr::get_current_device_resource();
+
+  // Converts the statistics to a table where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype = output_dtypes[col_idx];
+    if (stats[col_idx].empty() or (cudf::is_compound(dtype) and dtype.id() != type_id::STRING)) {
+      // placeholder only for unreferenced columns and unsupported types.
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_units, rmm::device_buffer{}, 0, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_units, rmm::device_buffer{}, 0, stream, mr));
+      continue;
+    }
+    auto [min_col, max_col] = cudf::type_dispatcher<dispatch_storage_type>(
+      dtype, stats_caster{stats[col_idx], output_kinds[col_idx]}, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto const stats_table = cudf::table(std::move(columns));
+
+  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
+  cudf::io::detail::stats_expression_converter const stats_expr{
+    filter, static_cast<size_type>(output_dtypes.size())};
+  auto const predicate_col =
+    cudf::detail::compute_column(stats_table, stats_expr.get_stats_expr().get(), stream, mr);
+  auto const predicate = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto const host_bitmask =
+    predicate.nullable()
+      ? cudf::detail::make_std_vector_async(
+          device_span<bitmask_type const>(predicate.null_mask(), num_bitmask_words(num_units)),
+          stream)
+      : std::vector<bitmask_type>(num_bitmask_words(num_units), ~bitmask_type{0});
+  auto const is_unit_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  // Units with unknown (null) result may contain matching rows
+  std::vector<bool> result(num_units);
+  for (size_type unit_idx = 0; unit_idx < num_units; ++unit_idx) {
+    result[unit_idx] =
+      not bit_is_set(host_bitmask.data(), unit_idx) or is_unit_required[unit_idx] != 0;
+  }
+  return result;
+}
+
+/**
+ * @brief Parses the statistics of a column in a stripe, if present in the file.
+ */
+std::optional<column_statistics> stripe_column_statistics(metadata const& file_meta,
+                                                          size_type stripe_idx,
+                                                          int column_id)
+{
+  auto const& stripe_stats = file_meta.md.stripeStats;
+  if (static_cast<size_t>(stripe_idx) >= stripe_stats.size()) { return std::nullopt; }
+  auto const& col_stats = stripe_stats[stripe_idx].colStats;
+  if (static_cast<size_t>(column_id) >= col_stats.size() or col_stats[column_id].empty()) {
+    return std::nullopt;
+  }
+  column_statistics stats;
+  ProtobufReader(col_stats[column_id].data(), col_stats[column_id].size()).read(stats);
+  return stats;
+}
+
+/**
+ * @brief Row index statistics and bloom filters of the columns of a stripe.
+ */
+struct stripe_row_index {
+  // Row group statistics per output column, empty for the columns that are not read
+  std::vector<std::vector<std::optional<column_statistics>>> statistics;
+  // Row group bloom filters per output column, empty if the column has no bloom filter stream
+  std::vector<std::vector<BloomFilter>> bloom_filters;
+};
+
+/**
+ * @brief Reads the row index statistics and the bloom filters of the given columns in a stripe.
+ *
+ * @return Row index of the stripe; `nullopt` if the row index of some column is missing or
+ * incomplete
+ */
+std::optional<stripe_row_index> read_row_index(metadata const& file_meta,
+                                               StripeInformation const& stripe,
+                                               std::unordered_set<size_type> const& column_indices,
+                                               host_span<int const> output_column_ids,
+                                               size_type num_row_groups,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const footer_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  CUDF_EXPECTS(footer_offset + stripe.footerLength < file_meta.source->size(),
+               "Invalid stripe information");
+  StripeFooter footer;
+  {
+    auto const buffer = file_meta.source->host_read(footer_offset, stripe.footerLength);
+    auto const data =
+      file_meta.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+    ProtobufReader(data.data(), data.size()).read(footer);
+  }
+
+  // All the index streams are stored at the start of the stripe, so read them with a single read
+  auto const index_buffer = file_meta.source->host_read(stripe.offset, stripe.indexLength);
+
+  stripe_row_index row_index{
+    std::vector<std::vector<std::optional<column_statistics>>>(output_column_ids.size()),
+    std::vector<std::vector<BloomFilter>>(output_column_ids.size())};
+  uint64_t stream_offset = 0;
+  for (auto const& stream_info : footer.streams) {
+    auto const offset = stream_offset;
+    stream_offset += stream_info.length;
+    if ((stream_info.kind != ROW_INDEX and stream_info.kind != BLOOM_FILTER_UTF8) or
+        not stream_info.column_id.has_value()) {
+      continue;
+    }
+    if (stream_offset > index_buffer->size()) { return std::nullopt; }
+
+    for (auto const col_idx : column_indices) {
+      if (output_column_ids[col_idx] != static_cast<int>(stream_info.column_id.value())) {
+        continue;
+      }
+      auto const data = file_meta.decompressor->decompress_blocks(
+        {index_buffer->data() + offset, stream_info.length}, stream);
+      if (stream_info.kind == ROW_INDEX) {
+        RowIndex index;
+        ProtobufReader(data.data(), data.size()).read(index);
+        if (index.entry.size() != static_cast<size_t>(num_row_groups)) { return std::nullopt; }
+        std::transform(index.entry.begin(),
+                       index.entry.end(),
+                       std::back_inserter(row_index.statistics[col_idx]),
+                       [](auto& entry) { return std::move(entry.statistics); });
+      } else {
+        BloomFilterIndex index;
+        ProtobufReader(data.data(), data.size()).read(index);
+        // An incomplete bloom filter index is not used, the row groups are not pruned by it
+        if (index.bloomFilter.size() == static_cast<size_t>(num_row_groups)) {
+          row_index.bloom_filters[col_idx] = std::move(index.bloomFilter);
+        }
+      }
+    }
+  }
+
+  auto const is_complete =
+    std::all_of(column_indices.cbegin(), column_indices.cend(), [&](auto col_idx) {
+      return not row_index.statistics[col_idx].empty();
+    });
+  if (not is_complete) { return std::nullopt; }
+  return row_index;
+}
+
+/**
+ * @brief Computes the ORC bloom filter hash of a literal compared with a column of the given kind
+ */
+struct literal_hasher {
+  cudf::scalar const& scalar;
+  TypeKind kind;
+  rmm::cuda_stream_view stream;
+
+  template <typename T>
+  std::optional<uint64_t> operator()() const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (kind != STRING and kind != VARCHAR and kind != CHAR and kind != BINARY) {
+        return std::nullopt;
+      }
+      auto const value = static_cast<string_scalar const&>(scalar).to_string(stream);
+      return bloom_filter_bytes_hash(value.data(), static_cast<size_type>(value.size()));
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      if (kind != BYTE and kind != SHORT and kind != INT and kind != LONG) { return std::nullopt; }
+      return bloom_filter_long_hash(static_cast<numeric_scalar<T> const&>(scalar).value(stream));
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      if (kind != FLOAT and kind != DOUBLE) { return std::nullopt; }
+      auto const value = static_cast<numeric_scalar<T> const&>(scalar).value(stream);
+      // Bloom filters hash the value bits, so `0.0 == -0.0` and NaN cannot be answered by them
+      if (value == 0 or std::isnan(value)) { return std::nullopt; }
+      return bloom_filter_double_hash(value);
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      if (kind != DATE) { return std::nullopt; }
+      auto const value = static_cast<timestamp_scalar<T> const&>(scalar).value(stream);
+      return bloom_filter_long_hash(value.time_since_epoch().count());
+    } else {
+      // Other timestamp resolutions, fixed point and boolean values are stored in a different
+      // representation than the cudf type, so they are never pruned by bloom filters
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Returns whether the value with the given hash might have been inserted into the filter
+ */
+bool bloom_filter_might_contain(BloomFilter const& filter, uint64_t hash)
+{
+  auto const& bitset  = filter.utf8bitset;
+  auto const num_bits = static_cast<uint32_t>(bitset.size() * 8);
+  if (filter.numHashFunctions == 0 or num_bits == 0) { return true; }
+  for (uint32_t i = 1; i <= filter.numHashFunctions; ++i) {
+    // The bitset is stored as little-endian 64-bit words
+    auto const bit = bloom_filter_bit(hash, i, num_bits);
+    if ((static_cast<uint8_t>(bitset[bit / 8]) & (1u << (bit % 8))) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Evaluates the equality predicates of the filter on the bloom filters of the row groups.
+ *
+ * @param membership Whether each row group might contain the literal of each equality predicate
+ * @param num_row_groups Number of row groups
+ * @param bloom_filter_expr Converter of the filter to an expression over the membership table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Whether each row group may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_bloom_filters(std::vector<std::vector<bool>> const& membership,
+                                         size_type num_row_groups,
+                                         bloom_filter_expression_converter const& bloom_filter_expr,
+                                         rmm::cuda_stream_view stream)
+{
+  // Build the membership table; column 0 is the constant `true` column.
+  auto mr = rmm::mr::get_current_device_resource();
+  std::vector<std::unique_ptr<column>> columns;
+  auto const make_bool_column = [&](std::vector<bool> const& values) {
+    std::vector<uint8_t> host_values(values.begin(), values.end());
+    return std::make_unique<column>(
+      data_type{type_id::BOOL8},
+      num_row_groups,
+      cudf::detail::make_device_uvector_async(host_values, stream, mr).release(),
+      rmm::device_buffer{},
+      0);
+  };
+  columns.push_back(make_bool_column(std::vector<bool>(num_row_groups, true)));
+  for (auto const& values : membership) {
+    columns.push_back(make_bool_column(values));
+  }
+  auto const membership_table = cudf::table(std::move(columns));
+
+  auto const predicate_col = cudf::detail::compute_column(
+    membership_table, bloom_filter_expr.get_bloom_filter_expr().get(), stream, mr);
+  auto const predicate = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+  auto const is_row_group_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+  return {is_row_group_required.begin(), is_row_group_required.end()};
+}
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_orc_metadata::filter_stripes(
+  host_span<std::vector<size_type> const> stripe_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_ids,
+  std::reference_wrapper<ast::expression const> filter,
+  bool use_row_index,
+  rmm::cuda_stream_view stream) const
+{
+  // Create stripe indices.
+  std::vector<std::vector<size_type>> input_stripes;
+  if (stripe_indices.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(input_stripes),
+                   [](auto const& file_meta) {
+                     std::vector<size_type> stripe_idx(file_meta.ff.stripes.size());
+                     std::iota(stripe_idx.begin(), stripe_idx.end(), 0);
+                     return stripe_idx;
+                   });
+  } else {
+    input_stripes.assign(stripe_indices.begin(), stripe_indices.end());
+  }
+
+  column_reference_collector const collector{filter.get()};
+  auto const& referenced_columns = collector.get_indices();
+  CUDF_EXPECTS(std::all_of(referenced_columns.cbegin(),
+                           referenced_columns.cend(),
+                           [&](auto col_idx) {
+                             return col_idx < static_cast<size_type>(output_dtypes.size());
+                           }),
+               "Column index cannot be more than number of columns in the table");
+
+  std::vector<TypeKind> output_kinds;
+  std::transform(output_column_ids.begin(),
+                 output_column_ids.end(),
+                 std::back_inserter(output_kinds),
+                 [&](auto col_id) { return get_col_type(col_id).kind; });
+
+  // Evaluate the filter on the stripe statistics
+  std::vector<std::vector<std::optional<column_statistics>>> stripe_stats(output_dtypes.size());
+  size_type num_input_stripes = 0;
+  for (size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+    for (auto const stripe_idx : input_stripes[src_idx]) {
+      for (auto const col_idx : referenced_columns) {
+        stripe_stats[col_idx].push_back(stripe_column_statistics(
+          per_file_metadata[src_idx], stripe_idx, output_column_ids[col_idx]));
+      }
+      ++num_input_stripes;
+    }
+  }
+  auto is_stripe_required = evaluate_stats_filter(
+    stripe_stats, num_input_stripes, output_dtypes, output_kinds, filter.get(), stream);
+
+  // Evaluate the filter on the row index statistics and bloom filters of the remaining stripes; a
+  // stripe is only dropped when none of its row groups can contain rows that satisfy the filter
+  auto const row_index_stride = per_file_metadata[0].ff.rowIndexStride;
+  if (use_row_index and row_index_stride > 0 and not referenced_columns.empty()) {
+    bloom_filter_expression_converter const bloom_filter_expr{
+      filter.get(), static_cast<size_type>(output_dtypes.size()), output_dtypes};
+    auto const& predicates = bloom_filter_expr.get_equality_predicates();
+
+    std::vector<std::vector<std::optional<column_statistics>>> row_group_stats(
+      output_dtypes.size());
+    // Membership of each equality predicate's literal per row group; `true` means the row group
+    // might contain the literal
+    std::vector<std::vector<bool>> membership(predicates.size());
+    bool any_pruned_by_bloom_filter = false;
+    // stripe (as the index into `is_stripe_required`) and number of row groups of each stripe
+    // with complete row index statistics
+    std::vector<std::pair<size_type, size_type>> indexed_stripes;
+    size_type stripe_pos = 0;
+    for (size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+      auto const& file_meta = per_file_metadata[src_idx];
+      for (auto const stripe_idx : input_stripes[src_idx]) {
+        auto const pos = stripe_pos++;
+        if (not is_stripe_required[pos]) { continue; }
+        auto const& stripe        = file_meta.ff.stripes[stripe_idx];
+        auto const num_row_groups = static_cast<size_type>(
+          cudf::util::div_rounding_up_unsafe<uint64_t>(stripe.numberOfRows, row_index_stride));
+        auto row_index = read_row_index(
+          file_meta, stripe, referenced_columns, output_column_ids, num_row_groups, stream);
+        if (not row_index.has_value()) { continue; }
+        for (auto const col_idx : referenced_columns) {
+          auto& col_stats = row_group_stats[col_idx];
+          std::move(row_index->statistics[col_idx].begin(),
+                    row_index->statistics[col_idx].end(),
+                    std::back_inserter(col_stats));
+        }
+        for (size_t pred_idx = 0; pred_idx < predicates.size(); ++pred_idx) {
+          auto const col_idx        = predicates[pred_idx].first;
+          auto const lit            = predicates[pred_idx].second;
+          auto const& bloom_filters = row_index->bloom_filters[col_idx];
+          auto const hash = [&]() -> std::optional<uint64_t> {
+            if (bloom_filters.empty() or not lit->is_valid(stream)) { return std::nullopt; }
+            return cudf::type_dispatcher(
+              output_dtypes[col_idx],
+              literal_hasher{lit->get_scalar(), output_kinds[col_idx], stream});
+          }();
+          for (size_type rg_idx = 0; rg_idx < num_row_groups; ++rg_idx) {
+            auto const might_contain = not hash.has_value() or
+                                       bloom_filter_might_contain(bloom_filters[rg_idx], *hash);
+            membership[pred_idx].push_back(might_contain);
+            any_pruned_by_bloom_filter |= not might_contain;
+          }
+        }
+        indexed_stripes.emplace_back(pos, num_row_groups);
+      }
+    }
+
+    auto const num_row_groups = std::accumulate(
+      indexed_stripes.cbegin(), indexed_stripes.cend(), size_type{0}, [](auto sum, auto const& s) {
+        return sum + s.second;
+      });
+    auto is_row_group_required = evaluate_stats_filter(
+      row_group_stats, num_row_groups, output_dtypes, output_kinds, filter.get(), stream);
+    if (any_pruned_by_bloom_filter) {
+      auto const bloom_filter_result =
+        evaluate_bloom_filters(membership, num_row_groups, bloom_filter_expr, stream);
+      std::transform(is_row_group_required.begin(),
+                     is_row_group_required.end(),
+                     bloom_filter_result.begin(),
+                     is_row_group_required.begin(),
+                     std::logical_and<>{});
+    }
+    size_type row_group_pos = 0;
+    for (auto const& [pos, stripe_row_groups] : indexed_stripes) {
+      auto const first = is_row_group_required.cbegin() + row_group_pos;
+      is_stripe_required[pos] =
+        std::any_of(first, first + stripe_row_groups, [](bool required) { return required; });
+      row_group_pos += stripe_row_groups;
+    }
+  }
+
+  if (std::all_of(is_stripe_required.cbegin(), is_stripe_required.cend(), [](bool required) {
+        return required;
+      })) {
+    return std::nullopt;
+  }
+
+  // Return only filtered stripes based on predicate
+  std::vector<std::vector<size_type>> filtered_stripe_indices;
+  size_type stripe_pos = 0;
+  for (auto const& src_stripes : input_stripes) {
+    std::vector<size_type> filtered_stripes;
+    for (auto const stripe_idx : src_stripes) {
+      if (is_stripe_required[stripe_pos++]) { filtered_stripes.push_back(stripe_idx); }
+    }
+    filtered_stripe_indices.push_back(std::move(filtered_stripes));
+  }
+  return {std::move(filtered_stripe_indices)};
+}
+
+}  // namespace cudf::io::orc::detail
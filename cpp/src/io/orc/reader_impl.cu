@@ -173,12 +173,14 @@ reader_impl::reader_impl(std::size_t chunk_read_limit,
              options.get_decimal128_columns(),
              options.get_skip_rows(),
              options.get_num_rows(),
-             options.get_stripes()},
+             options.get_stripes(),
+             options.get_filter()},
     _col_meta{std::make_unique<reader_column_meta>()},
     _sources(std::move(sources)),
     _metadata{_sources, stream},
     _selected_columns{_metadata.select_columns(options.get_columns())},
-    _chunk_read_data{chunk_read_limit, pass_read_limit, output_row_granularity}
+    _chunk_read_data{chunk_read_limit, pass_read_limit, output_row_granularity},
+    _chunk_stats_output{options.get_chunk_statistics()}
 {
   // Selected columns at different levels of nesting are stored in different elements
   // of `selected_columns`; thus, size == 1 means no nested columns.
@@ -201,7 +203,13 @@ bool reader_impl::has_next()
 table_with_metadata reader_impl::read_chunk()
 {
   prepare_data(read_mode::CHUNKED_READ);
-  return make_output_chunk();
+  auto chunk = make_output_chunk();
+
+  // The work done for this chunk, including that done in a preceding `has_next()`.
+  if (_chunk_stats_output != nullptr) { *_chunk_stats_output = _chunk_stats; }
+  _chunk_stats = {};
+
+  return chunk;
 }
 
 chunked_reader::chunked_reader(std::size_t chunk_read_limit,
@@ -178,6 +178,9 @@ class reader_impl {
     int64_t const skip_rows;
     std::optional<int64_t> num_read_rows;
     std::vector<std::vector<size_type>> const selected_stripes;
+
+    // Predicate filter as AST to prune the stripes with and filter the output rows.
+    std::optional<std::reference_wrapper<ast::expression const>> filter;
   } const _options;
 
   // Intermediate data for reading.
@@ -188,6 +191,10 @@ class reader_impl {
   file_intermediate_data _file_itm_data;
   chunk_read_data _chunk_read_data;
 
+  // Statistics of the work done since the last chunk was returned, and where to report them.
+  reader_chunk_statistics _chunk_stats;
+  std::shared_ptr<reader_chunk_statistics> const _chunk_stats_output;
+
   // Intermediate data for output.
   std::unique_ptr<table_metadata> _meta_with_user_data;
   table_metadata _out_metadata;
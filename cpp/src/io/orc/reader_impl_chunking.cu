@@ -19,10 +19,12 @@
 #include "io/orc/reader_impl_chunking.hpp"
 #include "io/orc/reader_impl_helpers.hpp"
 #include "io/utilities/hostdevice_span.hpp"
+#include "io/utilities/stage_range.hpp"
 
 #include <cudf/detail/timezone.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/device_buffer.hpp>
 #include <rmm/exec_policy.hpp>
@@ -32,6 +34,8 @@
 #include <thrust/scan.h>
 
 #include <algorithm>
+#include <map>
+#include <numeric>
 #include <tuple>
 
 namespace cudf::io::orc::detail {
@@ -71,6 +75,11 @@ std::size_t gather_stream_info_and_column_desc(
   };
 
   for (auto const& stream : stripefooter->streams) {
+    if (stream.kind == orc::BLOOM_FILTER or stream.kind == orc::BLOOM_FILTER_UTF8) {
+      // Bloom filters are only used to prune stripes before reading, not for decoding
+      src_offset += stream.length;
+      continue;
+    }
     if (!stream.column_id || *stream.column_id >= orc2gdf.size()) {
       // Ignore reading this stream from source.
       CUDF_LOG_WARN("Unexpected stream in the input ORC source. The stream will be ignored.");
@@ -229,13 +238,45 @@ void reader_impl::preprocess_file(read_mode mode)
   if (_file_itm_data.global_preprocessed) { return; }
   _file_itm_data.global_preprocessed = true;
 
+  //
+  // Prune the stripes with the filter, unless rows are selected:
+  //
+  auto const filtered_stripes = [&]() -> std::optional<std::vector<std::vector<size_type>>> {
+    if (not _options.filter.has_value() or _options.skip_rows != 0 or
+        _options.num_read_rows.has_value() or _selected_columns.num_levels() == 0) {
+      return std::nullopt;
+    }
+    std::vector<data_type> output_dtypes;
+    std::vector<int> output_column_ids;
+    for (auto const& col : _selected_columns.levels[0]) {
+      auto const col_type =
+        to_cudf_type(_metadata.get_col_type(col.id).kind,
+                     _options.use_np_dtypes,
+                     _options.timestamp_type.id(),
+                     to_cudf_decimal_type(_options.decimal128_columns, _metadata, col.id));
+      auto const scale = -static_cast<size_type>(_metadata.get_col_type(col.id).scale.value_or(0));
+      output_dtypes.push_back(cudf::is_fixed_point(data_type{col_type})
+                                ? data_type{col_type, scale}
+                                : data_type{col_type});
+      output_column_ids.push_back(col.id);
+    }
+    return _metadata.filter_stripes(_options.selected_stripes,
+                                    output_dtypes,
+                                    output_column_ids,
+                                    _options.filter.value(),
+                                    _options.use_index,
+                                    _stream);
+  }();
+
   //
   // Load stripes' metadata:
   //
   std::tie(
     _file_itm_data.rows_to_skip, _file_itm_data.rows_to_read, _file_itm_data.selected_stripes) =
-    _metadata.select_stripes(
-      _options.selected_stripes, _options.skip_rows, _options.num_read_rows, _stream);
+    _metadata.select_stripes(filtered_stripes.value_or(_options.selected_stripes),
+                             _options.skip_rows,
+                             _options.num_read_rows,
+                             _stream);
   if (!_file_itm_data.has_data()) { return; }
 
   CUDF_EXPECTS(
@@ -258,9 +299,10 @@ void reader_impl::preprocess_file(read_mode mode)
         });
       });
 
-    return has_timestamp_column ? cudf::detail::make_timezone_transition_table(
-                                    {}, selected_stripes[0].stripe_footer->writerTimezone, _stream)
-                                : std::make_unique<cudf::table>();
+    return has_timestamp_column
+             ? cudf::detail::get_timezone_transition_table(
+                 {}, selected_stripes[0].stripe_footer->writerTimezone, _stream)
+             : std::make_shared<cudf::table const>();
   }();
 
   //
@@ -472,6 +514,7 @@ void reader_impl::load_next_stripe_data(read_mode mode)
   auto const num_levels = _selected_columns.num_levels();
 
   // Prepare the buffer to read raw data onto.
+  std::size_t loaded_size = 0;
   for (std::size_t level = 0; level < num_levels; ++level) {
     auto& stripe_data = lvl_stripe_data[level];
     stripe_data.resize(stripe_count);
@@ -480,55 +523,89 @@ void reader_impl::load_next_stripe_data(read_mode mode)
       auto const stripe_size = _file_itm_data.lvl_stripe_sizes[level][idx + stripe_start];
       stripe_data[idx]       = rmm::device_buffer(
         cudf::util::round_up_safe(stripe_size, BUFFER_PADDING_MULTIPLE), _stream);
+      loaded_size += stripe_data[idx].size();
     }
   }
+  _chunk_stats.peak_temp_memory_bytes = std::max(_chunk_stats.peak_temp_memory_bytes, loaded_size);
 
   //
   // Load stripe data into memory:
   //
 
-  // If we load data from sources into host buffers, we need to transfer (async) data to device
-  // memory. Such host buffers need to be kept alive until we sync the transfers.
-  std::vector<std::unique_ptr<cudf::io::datasource::buffer>> host_read_buffers;
-
-  // If we load data directly from sources into device memory, the loads are also async.
-  // Thus, we need to make sure to sync all them at the end.
-  std::vector<std::pair<std::future<std::size_t>, std::size_t>> device_read_tasks;
-
-  // Range of the read info (offset, length) to read for the current being loaded stripes.
-  auto const [read_begin, read_end] =
-    merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
-
-  for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
-    auto const& read_info = _file_itm_data.data_read_info[read_idx];
-    auto const source_ptr = _metadata.per_file_metadata[read_info.source_idx].source;
-    auto const dst_base   = static_cast<uint8_t*>(
-      lvl_stripe_data[read_info.level][read_info.stripe_idx - stripe_start].data());
-
-    if (source_ptr->is_device_read_preferred(read_info.length)) {
-      device_read_tasks.push_back(
-        std::pair(source_ptr->device_read_async(
-                    read_info.offset, read_info.length, dst_base + read_info.dst_pos, _stream),
-                  read_info.length));
-
-    } else {
-      auto buffer = source_ptr->host_read(read_info.offset, read_info.length);
-      CUDF_EXPECTS(buffer->size() == read_info.length, "Unexpected discrepancy in bytes read.");
-      CUDF_CUDA_TRY(cudaMemcpyAsync(dst_base + read_info.dst_pos,
-                                    buffer->data(),
-                                    read_info.length,
-                                    cudaMemcpyDefault,
-                                    _stream.value()));
-      host_read_buffers.emplace_back(std::move(buffer));
+  {
+    io::detail::stage_range stage{"orc::reader::load stripe data", _chunk_stats.read_time};
+
+    // If we load data from sources into host buffers, we need to transfer (async) data to device
+    // memory. Such host buffers need to be kept alive until we sync the transfers.
+    std::vector<std::vector<uint8_t>> host_read_buffers;
+
+    // Host reads are batched per source, so that each source can coalesce nearby ranges.
+    struct host_read_info {
+      std::vector<cudf::io::datasource::read_range> ranges;
+      std::vector<uint8_t*> dsts;
+    };
+    std::map<std::size_t, host_read_info> host_reads;
+
+    // If we load data directly from sources into device memory, the loads are also async.
+    // Thus, we need to make sure to sync all them at the end.
+    std::vector<std::pair<std::future<std::size_t>, std::size_t>> device_read_tasks;
+
+    // Range of the read info (offset, length) to read for the current being loaded stripes.
+    auto const [read_begin, read_end] =
+      merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
+
+    for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
+      auto const& read_info = _file_itm_data.data_read_info[read_idx];
+      auto const source_ptr = _metadata.per_file_metadata[read_info.source_idx].source;
+      auto const dst_base   = static_cast<uint8_t*>(
+        lvl_stripe_data[read_info.level][read_info.stripe_idx - stripe_start].data());
+      _chunk_stats.num_bytes_read += read_info.length;
+
+      if (source_ptr->is_device_read_preferred(read_info.length)) {
+        device_read_tasks.push_back(
+          std::pair(source_ptr->device_read_async(
+                      read_info.offset, read_info.length, dst_base + read_info.dst_pos, _stream),
+                    read_info.length));
+
+      } else {
+        auto& source_reads = host_reads[read_info.source_idx];
+        source_reads.ranges.push_back({read_info.offset, read_info.length});
+        source_reads.dsts.push_back(dst_base + read_info.dst_pos);
+      }
     }
-  }
 
-  if (host_read_buffers.size() > 0) {  // if there was host read
-    _stream.synchronize();
-    host_read_buffers.clear();  // its data was copied to device memory after stream sync
-  }
-  for (auto& task : device_read_tasks) {  // if there was device read
-    CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
+    for (auto const& [source_idx, reads] : host_reads) {
+      auto const source_ptr = _metadata.per_file_metadata[source_idx].source;
+      auto const total_size = std::accumulate(reads.ranges.begin(),
+                                              reads.ranges.end(),
+                                              std::size_t{0},
+                                              [](auto sum, auto const& range) {
+                                                return sum + range.size;
+                                              });
+      auto& buffer = host_read_buffers.emplace_back(total_size);
+
+      std::vector<uint8_t*> host_dsts;
+      auto host_dst = buffer.data();
+      for (auto const& range : reads.ranges) {
+        host_dsts.push_back(host_dst);
+        host_dst += range.size;
+      }
+      auto const bytes_read = source_ptr->host_read_ranges(reads.ranges, host_dsts);
+      for (std::size_t i = 0; i < reads.ranges.size(); ++i) {
+        CUDF_EXPECTS(bytes_read[i] == reads.ranges[i].size,
+                     "Unexpected discrepancy in bytes read.");
+        CUDF_CUDA_TRY(cudaMemcpyAsync(
+          reads.dsts[i], host_dsts[i], bytes_read[i], cudaMemcpyDefault, _stream.value()));
+      }
+    }
+
+    if (host_read_buffers.size() > 0) {  // if there was host read
+      _stream.synchronize();
+      host_read_buffers.clear();  // its data was copied to device memory after stream sync
+    }
+    for (auto& task : device_read_tasks) {  // if there was device read
+      CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
+    }
   }
 
   // Compute number of rows in the loading stripes.
@@ -152,8 +152,8 @@ struct file_intermediate_data {
   std::vector<std::vector<range>> lvl_stripe_stream_ranges;
 
   // The buffers to store raw data read from disk, initialized for each reading stripe chunks.
-  // After decoding, such buffers can be released.
-  // This can only be implemented after chunked output is ready.
+  // When the data is compressed, the raw buffers of the decoding stripes at a level are replaced
+  // by their decompressed data, which is released as soon as that level is decoded.
   std::vector<std::vector<rmm::device_buffer>> lvl_stripe_data;
 
   // Store the size of each stripe at each nested level.
@@ -166,8 +166,9 @@ struct file_intermediate_data {
   // List of nested type columns at each nested level.
   std::vector<std::vector<orc_column_meta>> lvl_nested_cols;
 
-  // Table for converting timestamp columns from local to UTC time.
-  std::unique_ptr<cudf::table> tz_table;
+  // Table for converting timestamp columns from local to UTC time, shared through the cache of
+  // transition tables.
+  std::shared_ptr<cudf::table const> tz_table;
 
   bool global_preprocessed{false};
 };
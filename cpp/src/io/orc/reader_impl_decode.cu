@@ -21,8 +21,10 @@
 #include "io/orc/reader_impl_helpers.hpp"
 #include "io/utilities/config_utils.hpp"
 #include "io/utilities/hostdevice_span.hpp"
+#include "io/utilities/stage_range.hpp"
 
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -223,30 +225,30 @@ rmm::device_buffer decompress_stripe_data(
         }
         break;
       case compression_type::ZSTD:
-        if (auto const reason = nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD);
-            reason) {
-          CUDF_FAIL("Decompression error: " + reason.value());
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+          gpu_unzstd(inflate_in_view, inflate_out_view, inflate_res, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     inflate_res,
+                                     max_uncomp_block_size,
+                                     total_decomp_size,
+                                     stream);
         }
-        nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                                   inflate_in_view,
-                                   inflate_out_view,
-                                   inflate_res,
-                                   max_uncomp_block_size,
-                                   total_decomp_size,
-                                   stream);
         break;
       case compression_type::LZ4:
-        if (auto const reason = nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4);
-            reason) {
-          CUDF_FAIL("Decompression error: " + reason.value());
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4)) {
+          gpu_unlz4(inflate_in_view, inflate_out_view, inflate_res, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     inflate_res,
+                                     max_uncomp_block_size,
+                                     total_decomp_size,
+                                     stream);
         }
-        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
-                                   inflate_in_view,
-                                   inflate_out_view,
-                                   inflate_res,
-                                   max_uncomp_block_size,
-                                   total_decomp_size,
-                                   stream);
         break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
@@ -667,7 +669,7 @@ std::vector<range> find_table_splits(table_view const& input,
                                      std::size_t size_limit,
                                      rmm::cuda_stream_view stream)
 {
-  if (size_limit == 0) {
+  if (size_limit == 0 or input.num_rows() == 0) {
     return std::vector<range>{range{0, static_cast<std::size_t>(input.num_rows())}};
   }
 
@@ -947,19 +949,32 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
     if (_metadata.per_file_metadata[0].ps.compression != orc::NONE) {
       auto compinfo = cudf::detail::hostdevice_span<gpu::CompressedStreamInfo>(
         hd_compinfo.begin(), hd_compinfo.d_begin(), stream_range.size());
-      auto decomp_data = decompress_stripe_data(load_stripe_range,
-                                                stream_range,
-                                                stripe_count,
-                                                compinfo,
-                                                _file_itm_data.compinfo_map,
-                                                *_metadata.per_file_metadata[0].decompressor,
-                                                stripe_data,
-                                                stream_info,
-                                                chunks,
-                                                row_groups,
-                                                _metadata.get_row_index_stride(),
-                                                level == 0,
-                                                _stream);
+      auto const compressed_size = std::accumulate(
+        stripe_data.begin() + stripe_start - load_stripe_start,
+        stripe_data.begin() + stripe_start - load_stripe_start + stripe_count,
+        std::size_t{0},
+        [](std::size_t sum, auto const& buffer) { return sum + buffer.size(); });
+      auto decomp_data = [&] {
+        io::detail::stage_range stage{"orc::reader::decompress stripe data",
+                                      _chunk_stats.decompress_time};
+        return decompress_stripe_data(load_stripe_range,
+                                      stream_range,
+                                      stripe_count,
+                                      compinfo,
+                                      _file_itm_data.compinfo_map,
+                                      *_metadata.per_file_metadata[0].decompressor,
+                                      stripe_data,
+                                      stream_info,
+                                      chunks,
+                                      row_groups,
+                                      _metadata.get_row_index_stride(),
+                                      level == 0,
+                                      _stream);
+      }();
+      _chunk_stats.num_compressed_bytes += compressed_size;
+      _chunk_stats.num_decompressed_bytes += decomp_data.size();
+      _chunk_stats.peak_temp_memory_bytes = std::max(_chunk_stats.peak_temp_memory_bytes,
+                                                     compressed_size + decomp_data.size());
 
       // Just save the decompressed data and clear out the raw data to free up memory.
       stripe_data[stripe_start - load_stripe_start] = std::move(decomp_data);
@@ -1002,16 +1017,30 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
         column_types[i], is_list_type ? n_rows + 1 : n_rows, is_nullable, _stream, _mr);
     }
 
-    decode_stream_data(num_dict_entries,
-                       rows_to_skip,
-                       _metadata.get_row_index_stride(),
-                       level,
-                       *tz_table_dptr,
-                       chunks,
-                       row_groups,
-                       _out_buffers[level],
-                       _stream,
-                       _mr);
+    {
+      io::detail::stage_range stage{"orc::reader::decode stream data", _chunk_stats.decode_time};
+      decode_stream_data(num_dict_entries,
+                         rows_to_skip,
+                         _metadata.get_row_index_stride(),
+                         level,
+                         *tz_table_dptr,
+                         chunks,
+                         row_groups,
+                         _out_buffers[level],
+                         _stream,
+                         _mr);
+    }
+
+    // The stripe data of this level is fully decoded into the output buffers, so release it now
+    // instead of keeping the data of all levels resident until the output table is assembled.
+    // Deallocation is ordered on `_stream`, after the decoding kernels.
+    if (_metadata.per_file_metadata[0].ps.compression != orc::NONE) {
+      stripe_data[stripe_start - load_stripe_start] = {};
+    } else {
+      for (std::size_t i = 0; i < stripe_count; ++i) {
+        stripe_data[i + stripe_start - load_stripe_start] = {};
+      }
+    }
 
     if (nested_cols.size()) {
       // Extract information to process nested child columns.
@@ -1037,6 +1066,7 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
     num_processed_prev_lvl_columns = num_processed_lvl_columns;
     num_processed_lvl_columns += num_lvl_columns;
   }  // end loop level
+  _chunk_stats.num_pages_decoded += stripe_count;
 
   // Now generate a table from the decoded result.
   std::vector<std::unique_ptr<column>> out_columns;
@@ -1053,18 +1083,21 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
     });
   _chunk_read_data.decoded_table = std::make_unique<table>(std::move(out_columns));
 
-  // Free up temp memory used for decoding.
-  for (std::size_t level = 0; level < _selected_columns.num_levels(); ++level) {
-    _out_buffers[level].resize(0);
+  // Remove the rows that do not satisfy the filter; the stripe pruning is only coarse-grained.
+  if (_options.filter.has_value()) {
+    auto const predicate = cudf::detail::compute_column(_chunk_read_data.decoded_table->view(),
+                                                        _options.filter.value().get(),
+                                                        _stream,
+                                                        rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+                 "Predicate filter should return a boolean");
+    _chunk_read_data.decoded_table = cudf::detail::apply_boolean_mask(
+      _chunk_read_data.decoded_table->view(), *predicate, _stream, _mr);
+  }
 
-    auto& stripe_data = _file_itm_data.lvl_stripe_data[level];
-    if (_metadata.per_file_metadata[0].ps.compression != orc::NONE) {
-      stripe_data[stripe_start - load_stripe_start] = {};
-    } else {
-      for (std::size_t i = 0; i < stripe_count; ++i) {
-        stripe_data[i + stripe_start - load_stripe_start] = {};
-      }
-    }
+  // Free up temp memory used for decoding. The stripe data was already released level by level.
+  for (auto& buffers : _out_buffers) {
+    buffers.resize(0);
   }
 
   // Output table range is reset to start from the first position.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "bloom_filter.hpp"
 #include "io/comp/nvcomp_adapter.hpp"
 #include "io/utilities/block_utils.cuh"
 #include "io/utilities/config_utils.hpp"
@@ -26,6 +27,7 @@
 #include <cudf/io/orc_types.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -1296,6 +1298,54 @@ CUDF_KERNEL void decimal_sizes_to_offsets_kernel(device_2dspan<rowgroup_rows con
   }
 }
 
+/**
+ * @brief Computes the ORC bloom filter hash of a column element
+ */
+struct bloom_filter_hasher {
+  template <typename T>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = col.element<string_view>(row);
+      return bloom_filter_bytes_hash(str.data(), str.size_bytes());
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return bloom_filter_double_hash(col.element<T>(row));
+    } else if constexpr (std::is_integral_v<T> and not std::is_same_v<T, bool>) {
+      return bloom_filter_long_hash(col.element<T>(row));
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      // ORC dates are hashed as the number of days since the epoch
+      return bloom_filter_long_hash(col.element<T>(row).time_since_epoch().count());
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for ORC bloom filters");
+    }
+  }
+};
+
+// blockDim {256,1,1}
+CUDF_KERNEL void __launch_bounds__(256)
+  gpu_build_bloom_filters(device_span<bloom_filter_column const> filters,
+                          device_span<orc_column_device_view const> orc_columns,
+                          device_2dspan<rowgroup_rows const> rowgroup_bounds)
+{
+  auto const rowgroup_id = blockIdx.x;
+  auto const& filter     = filters[blockIdx.y];
+  auto const& column     = orc_columns[filter.column_idx];
+  auto const rg          = rowgroup_bounds[rowgroup_id][filter.column_idx];
+  auto const num_bits    = filter.num_words * bloom_filter_word_bits;
+  auto const bitset =
+    reinterpret_cast<unsigned long long*>(filter.bitsets + rowgroup_id * filter.num_words);
+
+  for (auto row = rg.begin + static_cast<size_type>(threadIdx.x); row < rg.end;
+       row += blockDim.x) {
+    if (column.is_null(row)) { continue; }
+    auto const hash = type_dispatcher(column.type(), bloom_filter_hasher{}, column, row);
+    for (uint32_t i = 1; i <= filter.num_hash_functions; ++i) {
+      auto const bit = bloom_filter_bit(hash, i, num_bits);
+      atomicOr(bitset + bit / bloom_filter_word_bits, 1ull << (bit % bloom_filter_word_bits));
+    }
+  }
+}
+
 void EncodeOrcColumnData(device_2dspan<EncChunk const> chunks,
                          device_2dspan<encoder_chunk_streams> streams,
                          rmm::cuda_stream_view stream)
@@ -1410,6 +1460,19 @@ std::optional<writer_compression_statistics> CompressOrcDataStreams(
   }
 }
 
+void build_bloom_filters(device_span<bloom_filter_column const> filters,
+                         device_span<orc_column_device_view const> orc_columns,
+                         device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                         rmm::cuda_stream_view stream)
+{
+  if (filters.empty() or rowgroup_bounds.size().first == 0) { return; }
+
+  dim3 dim_block(256, 1);
+  dim3 dim_grid(rowgroup_bounds.size().first, filters.size());  // 1 rowgroup per block
+  gpu_build_bloom_filters<<<dim_grid, dim_block, 0, stream.value()>>>(
+    filters, orc_columns, rowgroup_bounds);
+}
+
 void decimal_sizes_to_offsets(device_2dspan<rowgroup_rows const> rg_bounds,
                               std::map<uint32_t, rmm::device_uvector<uint32_t>>& elem_sizes,
                               rmm::cuda_stream_view stream)
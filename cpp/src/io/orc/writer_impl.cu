@@ -19,6 +19,7 @@
  * @brief cuDF-IO ORC writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "io/comp/nvcomp_adapter.hpp"
 #include "io/statistics/column_statistics.cuh"
 #include "io/utilities/column_utils.cuh"
@@ -216,6 +217,11 @@ class orc_column_view {
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
+    if (metadata.is_enabled_bloom_filter() and supports_bloom_filter()) {
+      CUDF_EXPECTS(metadata.get_bloom_filter_fpp() > 0 and metadata.get_bloom_filter_fpp() < 1,
+                   "Bloom filter false positive probability must be in the range (0, 1)");
+      bloom_filter_fpp = metadata.get_bloom_filter_fpp();
+    }
     if (parent != nullptr) {
       parent->add_child(_index);
       _parent_index = parent->index();
@@ -296,7 +302,28 @@ class orc_column_view {
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
 
+  // Target false positive probability of the rowgroup bloom filters, if enabled for this column
+  [[nodiscard]] auto const& bloom_filter_probability() const noexcept { return bloom_filter_fpp; }
+
  private:
+  // Bloom filters are only written for top-level columns of the types that can be hashed the same
+  // way as the Java ORC implementation does
+  [[nodiscard]] bool supports_bloom_filter() const noexcept
+  {
+    if (_is_child) { return false; }
+    switch (type().id()) {
+      case type_id::INT8:
+      case type_id::INT16:
+      case type_id::INT32:
+      case type_id::INT64:
+      case type_id::FLOAT32:
+      case type_id::FLOAT64:
+      case type_id::STRING:
+      case type_id::TIMESTAMP_DAYS: return true;
+      default: return false;
+    }
+  }
+
   column_view cudf_column;
 
   // Identifier within the set of columns
@@ -324,6 +351,7 @@ class orc_column_view {
   uint32_t* d_decimal_offsets = nullptr;
 
   std::optional<bool> nullable_from_metadata;
+  std::optional<double> bloom_filter_fpp;
   std::vector<uint32_t> children;
   std::optional<uint32_t> _parent_index;
 };
@@ -1558,13 +1586,31 @@ void write_index_stream(int32_t stripe_id,
   stripe->indexLength += pbw.size();
 }
 
+/**
+ * @brief Returns the device data of the specified column's data stream
+ *
+ * @param[in] strm_desc Stream's descriptor
+ * @param[in] enc_stream Chunk's streams
+ * @param[in] compressed_data Compressed stream data
+ * @param[in] compression_kind The compression kind
+ */
+uint8_t const* data_stream_device_ptr(gpu::StripeStream const& strm_desc,
+                                      gpu::encoder_chunk_streams const& enc_stream,
+                                      uint8_t const* compressed_data,
+                                      CompressionKind compression_kind)
+{
+  return (compression_kind == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
+                                    : (compressed_data + strm_desc.bfr_offset);
+}
+
 /**
  * @brief Write the specified column's data streams
  *
  * @param[in] strm_desc Stream's descriptor
  * @param[in] enc_stream Chunk's streams
  * @param[in] compressed_data Compressed stream data
- * @param[in,out] stream_out Temporary host output buffer
+ * @param[in] host_data Copy of the stream in host memory; `nullptr` if the stream is written
+ * directly from device memory
  * @param[in,out] stripe Stream's parent stripe
  * @param[in,out] streams List of all streams
  * @param[in] compression_kind The compression kind
@@ -1575,7 +1621,7 @@ void write_index_stream(int32_t stripe_id,
 std::future<void> write_data_stream(gpu::StripeStream const& strm_desc,
                                     gpu::encoder_chunk_streams const& enc_stream,
                                     uint8_t const* compressed_data,
-                                    uint8_t* stream_out,
+                                    uint8_t const* host_data,
                                     StripeInformation* stripe,
                                     orc_streams* streams,
                                     CompressionKind compression_kind,
@@ -1588,18 +1634,13 @@ std::future<void> write_data_stream(gpu::StripeStream const& strm_desc,
     return std::async(std::launch::deferred, [] {});
   }
 
-  auto const* stream_in = (compression_kind == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
-                                                     : (compressed_data + strm_desc.bfr_offset);
-
   auto write_task = [&]() {
-    if (out_sink->is_device_write_preferred(length)) {
+    if (host_data == nullptr) {
+      auto const* stream_in =
+        data_stream_device_ptr(strm_desc, enc_stream, compressed_data, compression_kind);
       return out_sink->device_write_async(stream_in, length, stream);
     } else {
-      CUDF_CUDA_TRY(
-        cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDefault, stream.value()));
-      stream.synchronize();
-
-      out_sink->host_write(stream_out, length);
+      out_sink->host_write(host_data, length);
       return std::async(std::launch::deferred, [] {});
     }
   }();
@@ -1636,6 +1677,54 @@ void add_uncompressed_block_headers(CompressionKind compression_kind,
   }
 }
 
+/**
+ * @brief Writes the specified column's bloom filter stream.
+ *
+ * The stream holds one `BLOOM_FILTER_UTF8` bloom filter per rowgroup of the stripe.
+ *
+ * @param[in] stripe_id Stripe's identifier
+ * @param[in] filters Rowgroup bloom filters of the column
+ * @param[in] column_id Id of the column in the ORC file
+ * @param[in] segmentation stripe and rowgroup ranges
+ * @param[in,out] stripe Stream's parent stripe
+ * @param[in] compression_kind The compression kind
+ * @param[in] compression_blocksize The block size used for compression
+ * @param[in] out_sink Sink for writing data
+ * @return Description of the written stream
+ */
+Stream write_bloom_filter_stream(int32_t stripe_id,
+                                 column_bloom_filters const& filters,
+                                 uint32_t column_id,
+                                 file_segmentation const& segmentation,
+                                 StripeInformation* stripe,
+                                 CompressionKind compression_kind,
+                                 size_t compression_blocksize,
+                                 std::unique_ptr<data_sink> const& out_sink)
+{
+  auto const& rowgroups_range = segmentation.stripes[stripe_id];
+  auto const filter_bytes     = filters.num_words * sizeof(uint64_t);
+
+  BloomFilterIndex index;
+  index.bloomFilter.reserve(rowgroups_range.size);
+  std::for_each(rowgroups_range.cbegin(), rowgroups_range.cend(), [&](auto rowgroup) {
+    // The bitset words are stored in little-endian byte order
+    auto& filter            = index.bloomFilter.emplace_back();
+    filter.numHashFunctions = filters.num_hash_functions;
+    filter.utf8bitset.resize(filter_bytes);
+    std::memcpy(filter.utf8bitset.data(),
+                filters.bitsets.data() + rowgroup * filters.num_words,
+                filter_bytes);
+  });
+
+  ProtobufWriter pbw((compression_kind != NONE) ? 3 : 0);
+  pbw.write(index);
+  add_uncompressed_block_headers(compression_kind, compression_blocksize, pbw.buffer());
+
+  out_sink->host_write(pbw.data(), pbw.size());
+  stripe->indexLength += pbw.size();
+  return Stream{BLOOM_FILTER_UTF8, column_id, pbw.size()};
+}
+
 void pushdown_lists_null_mask(orc_column_view const& col,
                               device_span<orc_column_device_view> d_columns,
                               bitmask_type const* parent_pd_mask,
@@ -2252,6 +2341,62 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
           std::move(dict_order_owner)};
 }
 
+/**
+ * @brief Builds the rowgroup bloom filters of the columns that have them enabled.
+ *
+ * Each filter is sized for `row_index_stride` entries and the false positive probability
+ * requested for the column.
+ *
+ * @param orc_table Non-owning view of a cuDF table w/ ORC-related info
+ * @param segmentation stripe and rowgroup ranges
+ * @param row_index_stride The row index stride
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Bloom filters of each column that has them enabled, copied to the host
+ */
+std::vector<column_bloom_filters> build_bloom_filters(orc_table_view const& orc_table,
+                                                      file_segmentation const& segmentation,
+                                                      size_type row_index_stride,
+                                                      rmm::cuda_stream_view stream)
+{
+  std::vector<gpu::bloom_filter_column> h_filters;
+  std::vector<size_t> word_offsets{0};
+  for (auto const& column : orc_table.columns) {
+    auto const& fpp = column.bloom_filter_probability();
+    if (not fpp.has_value()) { continue; }
+    auto const num_words = bloom_filter_num_words(row_index_stride, fpp.value());
+    h_filters.push_back({column.index(),
+                         bloom_filter_num_hash_functions(row_index_stride, num_words),
+                         num_words,
+                         nullptr});
+    word_offsets.push_back(word_offsets.back() +
+                           static_cast<size_t>(num_words) * segmentation.num_rowgroups());
+  }
+  if (word_offsets.back() == 0) { return {}; }
+
+  rmm::device_uvector<uint64_t> bitsets(word_offsets.back(), stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.data(), 0, bitsets.size() * sizeof(uint64_t), stream.value()));
+  for (size_t i = 0; i < h_filters.size(); ++i) {
+    h_filters[i].bitsets = bitsets.data() + word_offsets[i];
+  }
+
+  auto const d_filters = cudf::detail::make_device_uvector_async(
+    h_filters, stream, rmm::mr::get_current_device_resource());
+  gpu::build_bloom_filters(d_filters, orc_table.d_columns, segmentation.rowgroups, stream);
+  auto const h_bitsets = cudf::detail::make_std_vector_sync(bitsets, stream);
+
+  std::vector<column_bloom_filters> filters;
+  filters.reserve(h_filters.size());
+  for (size_t i = 0; i < h_filters.size(); ++i) {
+    auto const& filter = h_filters[i];
+    std::vector<uint64_t> words(h_bitsets.begin() + word_offsets[i],
+                                h_bitsets.begin() + word_offsets[i + 1]);
+    filters.push_back(
+      {filter.column_idx, filter.num_hash_functions, filter.num_words, std::move(words)});
+  }
+  return filters;
+}
+
 /**
  * @brief Perform the processing steps needed to convert the input table into the output ORC data
  * for writing, such as compression and ORC encoding.
@@ -2338,6 +2483,7 @@ auto convert_table_to_orc_data(table_view const& input,
                       std::optional<writer_compression_statistics>{},
                       std::move(streams),
                       std::move(stripes),
+                      std::vector<column_bloom_filters>{},
                       std::move(stripe_dicts.views),
                       cudf::detail::pinned_host_vector<uint8_t>()};
   }
@@ -2397,20 +2543,28 @@ auto convert_table_to_orc_data(table_view const& input,
     comp_results.device_to_host_sync(stream);
   }
 
-  auto const max_out_stream_size = [&]() {
-    uint32_t max_stream_size = 0;
-    for (auto const& ss : strm_descs.host_view().flat_view()) {
-      if (!out_sink.is_device_write_preferred(ss.stream_size)) {
-        max_stream_size = std::max(max_stream_size, ss.stream_size);
+  // The data streams of a stripe that are written from host memory are copied to the bounce buffer
+  // together; two stripes are buffered so that copying a stripe overlaps with writing the previous
+  auto const max_out_stripe_size = [&]() {
+    size_t max_stripe_size  = 0;
+    auto const h_strm_descs = strm_descs.host_view();
+    for (size_t stripe_id = 0; stripe_id < segmentation.num_stripes(); ++stripe_id) {
+      size_t stripe_size = 0;
+      for (auto const& ss : h_strm_descs[stripe_id]) {
+        if (!out_sink.is_device_write_preferred(ss.stream_size)) { stripe_size += ss.stream_size; }
       }
+      max_stripe_size = std::max(max_stripe_size, stripe_size);
     }
-    return max_stream_size;
+    return max_stripe_size;
   }();
 
-  cudf::detail::pinned_host_vector<uint8_t> bounce_buffer(max_out_stream_size);
+  cudf::detail::pinned_host_vector<uint8_t> bounce_buffer(
+    max_out_stripe_size * std::min<size_t>(segmentation.num_stripes(), 2));
 
   auto intermediate_stats = gather_statistic_blobs(stats_freq, orc_table, segmentation, stream);
 
+  auto bloom_filters = build_bloom_filters(orc_table, segmentation, row_index_stride, stream);
+
   return std::tuple{std::move(enc_data),
                     std::move(segmentation),
                     std::move(orc_table),
@@ -2421,6 +2575,7 @@ auto convert_table_to_orc_data(table_view const& input,
                     std::move(compression_stats),
                     std::move(streams),
                     std::move(stripes),
+                    std::move(bloom_filters),
                     std::move(stripe_dicts.views),
                     std::move(bounce_buffer)};
 }
@@ -2492,6 +2647,7 @@ void writer::impl::write(table_view const& input)
                          compression_stats,
                          streams,
                          stripes,
+                         bloom_filters,
                          stripe_dicts, /* unused, but its data will be accessed via pointer later */
                          bounce_buffer] = [&] {
     try {
@@ -2531,8 +2687,16 @@ void writer::impl::write(table_view const& input)
                          intermediate_stats.rowgroup_blobs,
                          streams,
                          stripes,
+                         bloom_filters,
                          bounce_buffer);
 
+  // Device writes that are still in flight read from the encoded streams; they are completed by the
+  // next write or by `close()`
+  if (not _pending_writes.empty()) {
+    _pending_writes.hold(std::move(enc_data.data));
+    _pending_writes.hold(std::move(compressed_data));
+  }
+
   // Update data into the footer. This needs to be called even when num_rows==0.
   add_table_to_footer_data(orc_table, stripes);
 
@@ -2564,14 +2728,50 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                                           host_span<ColStatsBlob const> rg_stats,
                                           orc_streams& streams,
                                           host_span<StripeInformation> stripes,
+                                          host_span<column_bloom_filters const> bloom_filters,
                                           host_span<uint8_t> bounce_buffer)
 {
   if (orc_table.num_rows() == 0) { return; }
 
+  // The data streams of each stripe that are written from host memory are copied to one half of
+  // the bounce buffer on a pooled stream, so that the copy of the next stripe runs while the
+  // current stripe is written to the sink
+  auto const num_bounce_buffers = std::min<size_t>(stripes.size(), 2);
+  auto const bounce_buffer_size = bounce_buffer.size() / num_bounce_buffers;
+  auto const copy_streams       = cudf::detail::fork_streams(_stream, num_bounce_buffers);
+
+  auto const copy_stripe_to_host = [&](size_t stripe_id) {
+    auto const buffer_idx = stripe_id % num_bounce_buffers;
+    auto const stream     = copy_streams[buffer_idx];
+    auto host_ptr         = bounce_buffer.data() + buffer_idx * bounce_buffer_size;
+    std::vector<uint8_t const*> host_data;
+    for (auto const& strm_desc : strm_descs[stripe_id]) {
+      auto const length = strm_desc.stream_size;
+      if (length == 0 or _out_sink->is_device_write_preferred(length)) {
+        host_data.push_back(nullptr);
+        continue;
+      }
+      auto const& enc_stream =
+        enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first];
+      auto const* stream_in =
+        data_stream_device_ptr(strm_desc, enc_stream, compressed_data.data(), _compression_kind);
+      CUDF_CUDA_TRY(
+        cudaMemcpyAsync(host_ptr, stream_in, length, cudaMemcpyDefault, stream.value()));
+      host_data.push_back(host_ptr);
+      host_ptr += length;
+    }
+    return host_data;
+  };
+
+  // The device writes of the previous table have overlapped with the encoding of this one
+  _pending_writes.wait();
+
   // Write stripes
-  std::vector<std::future<void>> write_tasks;
+  auto next_host_data = copy_stripe_to_host(0);
   for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
-    auto& stripe = stripes[stripe_id];
+    auto& stripe         = stripes[stripe_id];
+    auto const host_data = std::move(next_host_data);
+    if (stripe_id + 1 < stripes.size()) { next_host_data = copy_stripe_to_host(stripe_id + 1); }
 
     stripe.offset = _out_sink->bytes_written();
 
@@ -2593,13 +2793,30 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                          _out_sink);
     }
 
+    // Bloom filter streams follow the row index streams
+    std::vector<Stream> bloom_filter_streams;
+    bloom_filter_streams.reserve(bloom_filters.size());
+    for (auto const& filters : bloom_filters) {
+      bloom_filter_streams.push_back(
+        write_bloom_filter_stream(stripe_id,
+                                  filters,
+                                  orc_table.column(filters.column_idx).id(),
+                                  segmentation,
+                                  &stripe,
+                                  _compression_kind,
+                                  _compression_blocksize,
+                                  _out_sink));
+    }
+
     // Column data consisting one or more separate streams
-    for (auto const& strm_desc : strm_descs[stripe_id]) {
-      write_tasks.push_back(write_data_stream(
+    copy_streams[stripe_id % num_bounce_buffers].synchronize();
+    for (size_t i = 0; i < strm_descs[stripe_id].size(); ++i) {
+      auto const& strm_desc = strm_descs[stripe_id][i];
+      _pending_writes.push(write_data_stream(
         strm_desc,
         enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first],
         compressed_data.data(),
-        bounce_buffer.data(),
+        host_data[i],
         &stripe,
         &streams,
         _compression_kind,
@@ -2610,6 +2827,9 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
     // Write stripefooter consisting of stream information
     StripeFooter sf;
     sf.streams = streams;
+    sf.streams.insert(sf.streams.begin() + num_index_streams,
+                      bloom_filter_streams.begin(),
+                      bloom_filter_streams.end());
     sf.columns.resize(orc_table.num_columns() + 1);
     sf.columns[0].kind = DIRECT;
     for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -2631,9 +2851,7 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
     }
     _out_sink->host_write(pbw.data(), pbw.size());
   }
-  for (auto const& task : write_tasks) {
-    task.wait();
-  }
+  cudf::detail::join_streams(copy_streams, _stream);
 }
 
 void writer::impl::add_table_to_footer_data(orc_table_view const& orc_table,
@@ -2690,6 +2908,7 @@ void writer::impl::add_table_to_footer_data(orc_table_view const& orc_table,
 
 void writer::impl::close()
 {
+  _pending_writes.wait();
   if (_state != writer_state::DATA_WRITTEN) {
     // writer is either closed or no data has been written
     _state = writer_state::CLOSED;
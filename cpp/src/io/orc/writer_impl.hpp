@@ -17,6 +17,7 @@
 #pragma once
 
 #include "io/utilities/hostdevice_vector.hpp"
+#include "io/utilities/pending_device_writes.hpp"
 #include "orc.hpp"
 #include "orc_gpu.hpp"
 
@@ -139,6 +140,16 @@ struct encoded_data {
   hostdevice_2dvector<gpu::encoder_chunk_streams> streams;  // streams of encoded data, per chunk
 };
 
+/**
+ * @brief Rowgroup bloom filters of a single column, copied to the host for writing.
+ */
+struct column_bloom_filters {
+  uint32_t column_idx;            // index of the column in the table
+  uint32_t num_hash_functions;    // number of hash functions of each filter
+  uint32_t num_words;             // number of 64-bit words of each filter
+  std::vector<uint64_t> bitsets;  // words of all filters [rowgroup][word]
+};
+
 /**
  * @brief Dictionary data for string columns and their device views, per column.
  */
@@ -302,6 +313,7 @@ class writer::impl {
    * @param[in] rg_stats row group level statistics
    * @param[in,out] streams List of stream descriptors
    * @param[in,out] stripes List of stripe description
+   * @param[in] bloom_filters Rowgroup bloom filters of the columns that have them enabled
    * @param[out] bounce_buffer Temporary host output buffer
    */
   void write_orc_data_to_sink(encoded_data const& enc_data,
@@ -313,6 +325,7 @@ class writer::impl {
                               host_span<ColStatsBlob const> rg_stats,
                               orc_streams& streams,
                               host_span<StripeInformation> stripes,
+                              host_span<column_bloom_filters const> bloom_filters,
                               host_span<uint8_t> bounce_buffer);
 
   /**
@@ -352,6 +365,8 @@ class writer::impl {
                                                // write. This enables some internal optimizations.
   std::map<std::string, std::string> const _kv_meta;  // Optional user metadata.
   std::unique_ptr<data_sink> const _out_sink;
+  // Device writes to `_out_sink` that are in flight; destroyed before the sink
+  cudf::io::detail::pending_device_writes _pending_writes;
 
   // Debug parameter---currently not yet supported to be user-specified.
   static bool constexpr _enable_dictionary = true;
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compact_protocol_reader.hpp"
+#include "io/utilities/bloom_filter_expression_converter.hpp"
+#include "parquet.hpp"
+#include "reader_impl_helpers.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+
+namespace cudf::io::parquet::detail {
+
+using cudf::io::detail::bloom_filter_expression_converter;
+
+namespace {
+
+/**
+ * @brief Host implementation of the XXH64 hash function
+ *
+ * The Parquet specification mandates XXH64 with a seed of 0 over the plain encoded value for
+ * Bloom filters.
+ */
+class xxhash_64 {
+  static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+  static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+  static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+  static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+  static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+  static constexpr uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+  static uint64_t load64(uint8_t const* p)
+  {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+      v = (v << 8) | p[i];
+    }
+    return v;
+  }
+
+  static uint32_t load32(uint8_t const* p)
+  {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  static constexpr uint64_t round(uint64_t acc, uint64_t input)
+  {
+    return rotl(acc + input * prime2, 31) * prime1;
+  }
+
+  static constexpr uint64_t merge_round(uint64_t acc, uint64_t val)
+  {
+    return (acc ^ round(0, val)) * prime1 + prime4;
+  }
+
+ public:
+  static uint64_t compute(uint8_t const* data, size_t len, uint64_t seed = 0)
+  {
+    auto const end = data + len;
+    uint64_t h64;
+    if (len >= 32) {
+      auto const limit = end - 32;
+      uint64_t v1      = seed + prime1 + prime2;
+      uint64_t v2      = seed + prime2;
+      uint64_t v3      = seed;
+      uint64_t v4      = seed - prime1;
+      do {
+        v1 = round(v1, load64(data));
+        v2 = round(v2, load64(data + 8));
+        v3 = round(v3, load64(data + 16));
+        v4 = round(v4, load64(data + 24));
+        data += 32;
+      } while (data <= limit);
+      h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = seed + prime5;
+    }
+    h64 += static_cast<uint64_t>(len);
+
+    for (; data + 8 <= end; data += 8) {
+      h64 ^= round(0, load64(data));
+      h64 = rotl(h64, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+      h64 ^= static_cast<uint64_t>(load32(data)) * prime1;
+      h64 = rotl(h64, 23) * prime2 + prime3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      h64 ^= static_cast<uint64_t>(*data) * prime5;
+      h64 = rotl(h64, 11) * prime1;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+};
+
+/**
+ * @brief Checks the split block Bloom filter (SBBF) bitset for the given hash
+ *
+ * @param bitset The SBBF bitset, made up of 256-bit blocks of eight 32-bit words
+ * @param hash The XXH64 hash of the plain encoded value
+ * @return `false` if the value is definitely not present, `true` otherwise
+ */
+bool sbbf_might_contain(host_span<uint8_t const> bitset, uint64_t hash)
+{
+  constexpr uint32_t salt[split_block_bloom_filter_words] = {0x47b6137bU,
+                                                             0x44974d91U,
+                                                             0x8824ad5bU,
+                                                             0xa2b7289dU,
+                                                             0x705495c7U,
+                                                             0x2df1424bU,
+                                                             0x9efc4947U,
+                                                             0x5c6bfb31U};
+  constexpr auto block_size = split_block_bloom_filter_words * sizeof(uint32_t);
+
+  auto const num_blocks = bitset.size() / block_size;
+  if (num_blocks == 0) { return true; }
+  auto const block_idx = ((hash >> 32) * num_blocks) >> 32;
+  auto const key       = static_cast<uint32_t>(hash);
+  auto const block     = bitset.data() + block_idx * block_size;
+  for (size_t i = 0; i < split_block_bloom_filter_words; ++i) {
+    uint32_t word;
+    std::memcpy(&word, block + i * sizeof(uint32_t), sizeof(uint32_t));
+    auto const mask = uint32_t{1} << ((key * salt[i]) >> 27);
+    if ((word & mask) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Reads the Bloom filter bitset of a column chunk, if present and supported
+ *
+ * @param source Data source of the file containing the column chunk
+ * @param meta Metadata of the column chunk
+ * @return The bitset bytes, or empty if there is no usable Bloom filter for the column chunk
+ */
+std::vector<uint8_t> read_bloom_filter_bitset(datasource& source, ColumnChunkMetaData const& meta)
+{
+  if (not meta.bloom_filter_offset.has_value()) { return {}; }
+  auto const offset = static_cast<size_t>(meta.bloom_filter_offset.value());
+
+  // The header is small, so when the length is not recorded in the footer read a fixed window
+  // large enough to hold it and fetch the bitset separately once its size is known.
+  constexpr size_t header_read_size = 256;
+  auto const read_size =
+    meta.bloom_filter_length.has_value()
+      ? static_cast<size_t>(meta.bloom_filter_length.value())
+      : std::min(header_read_size, source.size() > offset ? source.size() - offset : 0);
+  if (read_size == 0) { return {}; }
+  auto const buffer = source.host_read(offset, read_size);
+
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  cp.read(&header);
+  if (header.algorithm.algorithm != BloomFilterAlgorithm::SPLIT_BLOCK or
+      header.hash.hash != BloomFilterHash::XXHASH or
+      header.compression.compression != BloomFilterCompression::UNCOMPRESSED or
+      header.num_bytes <= 0) {
+    return {};
+  }
+
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (header_size + num_bytes <= buffer->size()) {
+    auto const bitset_start = buffer->data() + header_size;
+    return {bitset_start, bitset_start + num_bytes};
+  }
+  auto const bitset = source.host_read(offset + header_size, num_bytes);
+  if (bitset->size() != num_bytes) { return {}; }
+  return {bitset->data(), bitset->data() + num_bytes};
+}
+
+/**
+ * @brief Computes the XXH64 hash of a literal as it would be plain encoded for the given
+ * physical type
+ */
+struct literal_hasher {
+  cudf::scalar const& scalar;
+  Type physical_type;
+  rmm::cuda_stream_view stream;
+
+  template <typename T>
+  static uint64_t hash_value(T value)
+  {
+    return xxhash_64::compute(reinterpret_cast<uint8_t const*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  std::optional<uint64_t> operator()() const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (physical_type != BYTE_ARRAY) { return std::nullopt; }
+      auto const value = static_cast<string_scalar const&>(scalar).to_string(stream);
+      return xxhash_64::compute(reinterpret_cast<uint8_t const*>(value.data()), value.size());
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      auto const value = static_cast<numeric_scalar<T> const&>(scalar).value(stream);
+      switch (physical_type) {
+        case INT32: return hash_value(static_cast<int32_t>(value));
+        case INT64: return hash_value(static_cast<int64_t>(value));
+        default: return std::nullopt;
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      if (physical_type != (std::is_same_v<T, float> ? FLOAT : DOUBLE)) { return std::nullopt; }
+      auto const value = static_cast<numeric_scalar<T> const&>(scalar).value(stream);
+      // Bloom filters hash the raw bytes, so `0.0 == -0.0` and NaN cannot be answered by them
+      if (value == 0 or std::isnan(value)) { return std::nullopt; }
+      return hash_value(value);
+    } else {
+      // Chrono, fixed point and boolean values may be stored in a different representation than
+      // the cudf type, so they are never pruned by Bloom filters.
+      return std::nullopt;
+    }
+  }
+};
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::apply_bloom_filters(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::vector<size_type> const> input_row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  bloom_filter_expression_converter bloom_filter_expr{
+    filter.get(), static_cast<size_type>(output_dtypes.size()), output_dtypes};
+  auto const& predicates = bloom_filter_expr.get_equality_predicates();
+  if (predicates.empty()) { return std::nullopt; }
+
+  auto const total_row_groups = std::accumulate(input_row_group_indices.begin(),
+                                                input_row_group_indices.end(),
+                                                size_type{0},
+                                                [](size_type sum, auto const& per_file_row_groups) {
+                                                  return sum + per_file_row_groups.size();
+                                                });
+  if (total_row_groups == 0) { return std::nullopt; }
+
+  // Membership of each equality predicate's literal per input row group; `true` means the
+  // row group might contain the literal.
+  std::vector<std::vector<bool>> membership(predicates.size(),
+                                            std::vector<bool>(total_row_groups, true));
+  bool any_pruned = false;
+  size_type rg_pos = 0;
+  for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+    for (auto const rg_idx : input_row_group_indices[src_idx]) {
+      auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
+      // Cache bitsets per schema index since several predicates may refer to the same column.
+      std::unordered_map<int, std::vector<uint8_t>> bitsets;
+      for (size_t pred_idx = 0; pred_idx < predicates.size(); ++pred_idx) {
+        auto const [col_index, lit] = predicates[pred_idx];
+        auto const schema_idx       = output_column_schemas[col_index];
+        auto const col              = std::find_if(
+          row_group.columns.begin(), row_group.columns.end(), [schema_idx](ColumnChunk const& c) {
+            return c.schema_idx == schema_idx;
+          });
+        if (col == row_group.columns.end()) { continue; }
+        auto const& meta = col->meta_data;
+
+        auto bitset_it = bitsets.find(schema_idx);
+        if (bitset_it == bitsets.end()) {
+          bitset_it =
+            bitsets.emplace(schema_idx, read_bloom_filter_bitset(*sources[src_idx], meta)).first;
+        }
+        if (bitset_it->second.empty() or not lit->is_valid(stream)) { continue; }
+
+        auto const hash = cudf::type_dispatcher<dispatch_storage_type>(
+          output_dtypes[col_index], literal_hasher{lit->get_scalar(), meta.type, stream});
+        if (hash.has_value() && !sbbf_might_contain(bitset_it->second, hash.value())) {
+          membership[pred_idx][rg_pos] = false;
+          any_pruned                   = true;
+        }
+      }
+      ++rg_pos;
+    }
+  }
+  if (not any_pruned) { return std::nullopt; }
+
+  // Build the membership table; column 0 is the constant `true` column.
+  auto mr = rmm::mr::get_current_device_resource();
+  std::vector<std::unique_ptr<column>> columns;
+  auto const make_bool_column = [&](std::vector<bool> const& values) {
+    std::vector<uint8_t> host_values(values.begin(), values.end());
+    return std::make_unique<column>(
+      data_type{type_id::BOOL8},
+      total_row_groups,
+      cudf::detail::make_device_uvector_async(host_values, stream, mr).release(),
+      rmm::device_buffer{},
+      0);
+  };
+  columns.push_back(make_bool_column(std::vector<bool>(total_row_groups, true)));
+  for (auto const& values : membership) {
+    columns.push_back(make_bool_column(values));
+  }
+  auto const membership_table = cudf::table(std::move(columns));
+
+  auto predicate_col = cudf::detail::compute_column(
+    membership_table, bloom_filter_expr.get_bloom_filter_expr().get(), stream, mr);
+  auto const predicate = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+  auto const is_row_group_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  std::vector<std::vector<size_type>> filtered_row_group_indices;
+  size_type is_required_idx = 0;
+  for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+    std::vector<size_type> filtered_row_groups;
+    for (auto const rg_idx : input_row_group_indices[src_idx]) {
+      if (is_row_group_required[is_required_idx]) { filtered_row_groups.push_back(rg_idx); }
+      ++is_required_idx;
+    }
+    filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+  }
+  return {std::move(filtered_row_group_indices)};
+}
+
+}  // namespace cudf::io::parquet::detail
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_common.hpp"
+#include "parquet_gpu.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/hashing/detail/xxhash_64.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+namespace cudf::io::parquet::detail {
+
+namespace {
+
+constexpr int DEFAULT_BLOCK_SIZE = 256;
+
+/**
+ * @brief Computes the XXH64 hash (seed 0) of a leaf value as it is plain encoded in Parquet
+ */
+struct plain_value_hasher {
+  Type physical_type;
+
+  template <typename T>
+  __device__ uint64_t operator()(column_device_view const& col, size_type idx) const
+  {
+    auto const hasher = cudf::hashing::detail::XXHash_64<T>{0};
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = col.element<string_view>(idx);
+      auto bytes     = device_span<std::byte const>(reinterpret_cast<std::byte const*>(str.data()),
+                                                str.size_bytes());
+      return hasher.compute_bytes(bytes);
+    } else if constexpr (cudf::is_fixed_point<T>() or
+                         (cudf::is_integral<T>() and not cudf::is_boolean<T>())) {
+      auto const value = col.element<device_storage_type_t<T>>(idx);
+      if (physical_type == Type::INT32) { return hasher.compute(static_cast<int32_t>(value)); }
+      return hasher.compute(static_cast<int64_t>(value));
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      // hash the raw bytes; NaNs and signed zeros are not normalized in Parquet bloom filters
+      return hasher.compute(col.element<T>(idx));
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for Parquet bloom filter");
+    }
+  }
+};
+
+/**
+ * @brief Sets the bits for `hash` in a split block bloom filter
+ *
+ * @param bitset The filter bitset, made up of `num_blocks` blocks of eight 32-bit words
+ * @param num_blocks Number of 256-bit blocks in the filter
+ * @param hash The XXH64 hash of the plain encoded value
+ */
+__device__ void sbbf_insert(uint32_t* bitset, uint64_t num_blocks, uint64_t hash)
+{
+  constexpr uint32_t salt[split_block_bloom_filter_words] = {0x47b6137bU,
+                                                             0x44974d91U,
+                                                             0x8824ad5bU,
+                                                             0xa2b7289dU,
+                                                             0x705495c7U,
+                                                             0x2df1424bU,
+                                                             0x9efc4947U,
+                                                             0x5c6bfb31U};
+
+  auto const block_idx = ((hash >> 32) * num_blocks) >> 32;
+  auto const key       = static_cast<uint32_t>(hash);
+  auto const block     = bitset + block_idx * split_block_bloom_filter_words;
+#pragma unroll
+  for (int i = 0; i < split_block_bloom_filter_words; ++i) {
+    atomicOr(block + i, uint32_t{1} << ((key * salt[i]) >> 27));
+  }
+}
+
+}  // namespace
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  build_bloom_filters_kernel(cudf::detail::device_2dspan<PageFragment const> frags)
+{
+  auto const frag  = frags[blockIdx.y][blockIdx.x];
+  auto const chunk = frag.chunk;
+
+  if (chunk->bloom_filter_size == 0) { return; }
+
+  auto const col = chunk->col_desc;
+
+  // Find the bounds of values in leaf column to be inserted into the filter for current chunk
+  size_type const start_value_idx = row_to_value_idx(frag.start_row, *col);
+  size_type const end_value_idx   = row_to_value_idx(frag.start_row + frag.num_rows, *col);
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto const num_blocks =
+    chunk->bloom_filter_size / (split_block_bloom_filter_words * sizeof(uint32_t));
+  auto const hasher = plain_value_hasher{col->physical_type};
+
+  for (thread_index_type val_idx = start_value_idx + threadIdx.x; val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (val_idx < data_col.size() and data_col.is_valid(val_idx)) {
+      auto const hash = type_dispatcher(data_col.type(), hasher, data_col, val_idx);
+      sbbf_insert(chunk->bloom_filter_data, num_blocks, hash);
+    }
+  }
+}
+
+void BuildBloomFilters(cudf::detail::device_2dspan<PageFragment const> frags,
+                       rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  build_bloom_filters_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
+}  // namespace cudf::io::parquet::detail
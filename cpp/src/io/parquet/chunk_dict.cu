@@ -188,6 +188,90 @@ CUDF_KERNEL void __launch_bounds__(block_size)
   }  // while
 }
 
+struct map_hash_fn {
+  template <typename T>
+  __device__ uint32_t operator()(column_device_view const& col, size_type i) const
+  {
+    if constexpr (column_device_view::has_element_accessor<T>()) {
+      return hash_functor<T>{col}(i);
+    } else {
+      CUDF_UNREACHABLE("Unsupported type to hash");
+    }
+  }
+};
+
+/**
+ * @brief Adds the valid values in `[start_value_idx, end_value_idx)` of a fragment to a
+ * HyperLogLog sketch
+ *
+ * The fragment's sketch is accumulated in shared memory before it is merged into `registers`.
+ * Must be called by all threads of the block.
+ */
+template <int block_size>
+__device__ void update_cardinality_sketch(column_device_view const& data_col,
+                                          size_type start_value_idx,
+                                          size_type end_value_idx,
+                                          uint32_t* registers)
+{
+  __shared__ uint32_t frag_registers[CARDINALITY_SKETCH_SIZE];
+  for (int i = threadIdx.x; i < CARDINALITY_SKETCH_SIZE; i += block_size) {
+    frag_registers[i] = 0;
+  }
+  __syncthreads();
+
+  for (thread_index_type val_idx = start_value_idx + threadIdx.x; val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (val_idx < data_col.size() and data_col.is_valid(val_idx)) {
+      auto const hash = type_dispatcher(data_col.type(), map_hash_fn{}, data_col, val_idx);
+      // The top bits select the register, the rank is the position of the first set bit in the
+      // remaining bits. The sentinel bit caps the rank when all remaining bits are zero.
+      auto const reg  = hash >> (32 - CARDINALITY_SKETCH_BITS);
+      auto const rest = (hash << CARDINALITY_SKETCH_BITS) | (1u << (CARDINALITY_SKETCH_BITS - 1));
+      atomicMax(&frag_registers[reg], static_cast<uint32_t>(__clz(rest) + 1));
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < CARDINALITY_SKETCH_SIZE; i += block_size) {
+    if (frag_registers[i] != 0) { atomicMax(&registers[i], frag_registers[i]); }
+  }
+}
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  estimate_chunk_cardinality_kernel(cudf::detail::device_2dspan<PageFragment const> frags,
+                                    EncColumnChunk const* chunks,
+                                    uint32_t* registers)
+{
+  auto const frag  = frags[blockIdx.y][blockIdx.x];
+  auto const chunk = frag.chunk;
+  auto const col   = chunk->col_desc;
+
+  if (not chunk->use_dictionary) { return; }
+
+  update_cardinality_sketch<block_size>(
+    *col->leaf_column,
+    row_to_value_idx(frag.start_row, *col),
+    row_to_value_idx(frag.start_row + frag.num_rows, *col),
+    registers + (chunk - chunks) * CARDINALITY_SKETCH_SIZE);
+}
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  estimate_column_cardinality_kernel(cudf::detail::device_2dspan<PageFragment const> frags,
+                                     device_span<parquet_column_device_view const> col_desc,
+                                     uint32_t* registers)
+{
+  auto const col_idx = blockIdx.y;
+  auto const frag    = frags[col_idx][blockIdx.x];
+  auto const& col    = col_desc[col_idx];
+
+  update_cardinality_sketch<block_size>(*col.leaf_column,
+                                        row_to_value_idx(frag.start_row, col),
+                                        row_to_value_idx(frag.start_row + frag.num_rows, col),
+                                        registers + col_idx * CARDINALITY_SKETCH_SIZE);
+}
+
 template <int block_size>
 CUDF_KERNEL void __launch_bounds__(block_size)
   collect_map_entries_kernel(device_span<EncColumnChunk> chunks)
@@ -282,6 +366,26 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<PageFragment const> fr
     <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
 }
 
+void estimate_chunk_cardinality(cudf::detail::device_2dspan<PageFragment const> frags,
+                                device_span<EncColumnChunk const> chunks,
+                                device_span<uint32_t> registers,
+                                rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  estimate_chunk_cardinality_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags, chunks.data(), registers.data());
+}
+
+void estimate_column_cardinality(cudf::detail::device_2dspan<PageFragment const> frags,
+                                 device_span<parquet_column_device_view const> col_desc,
+                                 device_span<uint32_t> registers,
+                                 rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  estimate_column_cardinality_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags, col_desc, registers.data());
+}
+
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
 {
   constexpr int block_size = 1024;
@@ -651,6 +651,8 @@ void CompactProtocolReader::read(ColumnChunk* c)
 
 void CompactProtocolReader::read(ColumnChunkMetaData* c)
 {
+  using optional_i32 = parquet_field_optional<int32_t, parquet_field_int32>;
+  using optional_i64 = parquet_field_optional<int64_t, parquet_field_int64>;
   using optional_size_statistics =
     parquet_field_optional<SizeStatistics, parquet_field_struct<SizeStatistics>>;
   using optional_list_enc_stats =
@@ -668,6 +670,8 @@ void CompactProtocolReader::read(ColumnChunkMetaData* c)
                             parquet_field_int64(11, c->dictionary_page_offset),
                             parquet_field_struct(12, c->statistics),
                             optional_list_enc_stats(13, c->encoding_stats),
+                            optional_i64(14, c->bloom_filter_offset),
+                            optional_i32(15, c->bloom_filter_length),
                             optional_size_statistics(16, c->size_statistics));
   function_builder(this, op);
 }
@@ -798,6 +802,33 @@ void CompactProtocolReader::read(SortingColumn* s)
   function_builder(this, op);
 }
 
+void CompactProtocolReader::read(BloomFilterAlgorithm* bf)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, bf->algorithm));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterHash* bf)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, bf->hash));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterCompression* bf)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, bf->compression));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterHeader* bf)
+{
+  auto op = std::make_tuple(parquet_field_int32(1, bf->num_bytes),
+                            parquet_field_struct(2, bf->algorithm),
+                            parquet_field_struct(3, bf->hash),
+                            parquet_field_struct(4, bf->compression));
+  function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
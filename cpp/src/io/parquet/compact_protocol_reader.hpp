@@ -122,6 +122,10 @@ class CompactProtocolReader {
   void read(ColumnOrder* c);
   void read(PageEncodingStats* s);
   void read(SortingColumn* s);
+  void read(BloomFilterAlgorithm* bf);
+  void read(BloomFilterHash* bf);
+  void read(BloomFilterCompression* bf);
+  void read(BloomFilterHeader* bf);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -189,6 +189,8 @@ size_t CompactProtocolWriter::write(ColumnChunkMetaData const& s)
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   c.field_struct(12, s.statistics);
   if (s.encoding_stats.has_value()) { c.field_struct_list(13, s.encoding_stats.value()); }
+  if (s.bloom_filter_offset.has_value()) { c.field_int(14, s.bloom_filter_offset.value()); }
+  if (s.bloom_filter_length.has_value()) { c.field_int(15, s.bloom_filter_length.value()); }
   if (s.size_statistics.has_value()) { c.field_struct(16, s.size_statistics.value()); }
   return c.value();
 }
@@ -269,6 +271,50 @@ size_t CompactProtocolWriter::write(SortingColumn const& sc)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(BloomFilterAlgorithm const& algorithm)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (algorithm.algorithm) {
+    case BloomFilterAlgorithm::SPLIT_BLOCK: c.field_empty_struct(algorithm.algorithm); break;
+    default:
+      CUDF_FAIL("Trying to write an invalid BloomFilterAlgorithm " +
+                std::to_string(algorithm.algorithm));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHash const& hash)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (hash.hash) {
+    case BloomFilterHash::XXHASH: c.field_empty_struct(hash.hash); break;
+    default: CUDF_FAIL("Trying to write an invalid BloomFilterHash " + std::to_string(hash.hash));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterCompression const& compression)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (compression.compression) {
+    case BloomFilterCompression::UNCOMPRESSED: c.field_empty_struct(compression.compression); break;
+    default:
+      CUDF_FAIL("Trying to write an invalid BloomFilterCompression " +
+                std::to_string(compression.compression));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHeader const& header)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, header.num_bytes);
+  c.field_struct(2, header.algorithm);
+  c.field_struct(3, header.hash);
+  c.field_struct(4, header.compression);
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(uint8_t const* raw, uint32_t len)
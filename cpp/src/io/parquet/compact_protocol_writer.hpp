@@ -55,6 +55,10 @@ class CompactProtocolWriter {
   size_t write(ColumnOrder const&);
   size_t write(PageEncodingStats const&);
   size_t write(SortingColumn const&);
+  size_t write(BloomFilterAlgorithm const&);
+  size_t write(BloomFilterHash const&);
+  size_t write(BloomFilterCompression const&);
+  size_t write(BloomFilterHeader const&);
 
  protected:
   std::vector<uint8_t>& m_buf;
@@ -73,6 +73,24 @@ class kernel_error {
     return _error_code[0];
   }
 
+  /**
+   * @brief Start copying the current value of the error to the host
+   *
+   * The value can be read with `value()` once `stream` has been synchronized. This allows the
+   * error check to share a synchronization with other device to host copies.
+   *
+   * @param stream The CUDA stream to copy on
+   */
+  void device_to_host_async(rmm::cuda_stream_view stream) const
+  {
+    _error_code.device_to_host_async(stream);
+  }
+
+  /**
+   * @brief Return the value of the error copied by the last `device_to_host_async()` call
+   */
+  [[nodiscard]] auto value() const { return _error_code[0]; }
+
   /**
    * @brief Return a hexadecimal string representation of an error code
    *
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <cudf/io/parquet.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <filesystem>
+#include <system_error>
+
+namespace cudf::io {
+
+parquet_metadata_cache::parquet_metadata_cache(std::size_t max_size_bytes)
+  : _impl{std::make_unique<parquet::detail::metadata_cache>(max_size_bytes)}
+{
+}
+
+parquet_metadata_cache::~parquet_metadata_cache() = default;
+
+void parquet_metadata_cache::clear() { _impl->clear(); }
+
+std::size_t parquet_metadata_cache::num_entries() const { return _impl->num_entries(); }
+
+std::size_t parquet_metadata_cache::size_bytes() const { return _impl->size_bytes(); }
+
+std::size_t parquet_metadata_cache::max_size_bytes() const { return _impl->max_size_bytes(); }
+
+namespace parquet::detail {
+
+std::shared_ptr<metadata const> metadata_cache::find(std::string const& key,
+                                                     bool needs_page_indexes)
+{
+  std::lock_guard lock(_mutex);
+  auto const it = _entries.find(key);
+  if (it == _entries.end()) { return nullptr; }
+  // entries parsed without page indexes cannot serve reads that need them
+  if (needs_page_indexes and not it->second.meta->page_indexes_read) { return nullptr; }
+  _lru.splice(_lru.begin(), _lru, it->second.lru_pos);
+  return it->second.meta;
+}
+
+void metadata_cache::insert(std::string const& key, std::shared_ptr<metadata const> meta)
+{
+  auto const size = meta->serialized_size;
+  if (size > _max_size_bytes) { return; }
+
+  std::lock_guard lock(_mutex);
+  if (auto const it = _entries.find(key); it != _entries.end()) { erase(it); }
+  while (_size_bytes + size > _max_size_bytes) {
+    erase(_entries.find(_lru.back()));
+  }
+  _lru.push_front(key);
+  _entries.emplace(key, entry{std::move(meta), _lru.begin()});
+  _size_bytes += size;
+}
+
+void metadata_cache::erase(std::unordered_map<std::string, entry>::iterator it)
+{
+  _size_bytes -= it->second.meta->serialized_size;
+  _lru.erase(it->second.lru_pos);
+  _entries.erase(it);
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard lock(_mutex);
+  _entries.clear();
+  _lru.clear();
+  _size_bytes = 0;
+}
+
+std::size_t metadata_cache::num_entries() const
+{
+  std::lock_guard lock(_mutex);
+  return _entries.size();
+}
+
+std::size_t metadata_cache::size_bytes() const
+{
+  std::lock_guard lock(_mutex);
+  return _size_bytes;
+}
+
+std::vector<std::string> metadata_cache_keys(source_info const& info,
+                                             host_span<std::string const> user_keys,
+                                             std::size_t num_sources)
+{
+  if (not user_keys.empty()) {
+    CUDF_EXPECTS(user_keys.size() == num_sources,
+                 "Number of metadata cache keys must match the number of sources");
+    return {user_keys.begin(), user_keys.end()};
+  }
+
+  std::vector<std::string> keys(num_sources);
+  if (info.type() != io_type::FILEPATH or info.filepaths().size() != num_sources) { return keys; }
+
+  for (std::size_t i = 0; i < num_sources; ++i) {
+    auto const& path = info.filepaths()[i];
+    std::error_code size_error;
+    std::error_code time_error;
+    auto const size  = std::filesystem::file_size(path, size_error);
+    auto const mtime = std::filesystem::last_write_time(path, time_error);
+    // leave the key empty, and the file uncached, if it cannot be identified (e.g. remote paths)
+    if (size_error or time_error) { continue; }
+    keys[i] = path + ':' + std::to_string(size) + ':' +
+              std::to_string(mtime.time_since_epoch().count());
+  }
+  return keys;
+}
+
+}  // namespace parquet::detail
+}  // namespace cudf::io
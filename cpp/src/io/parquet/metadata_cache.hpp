@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "reader_impl_helpers.hpp"
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf::io::parquet::detail {
+
+/**
+ * @brief Thread-safe LRU cache of parsed file metadata, keyed by source identity.
+ */
+class metadata_cache {
+ public:
+  explicit metadata_cache(std::size_t max_size_bytes) : _max_size_bytes{max_size_bytes} {}
+
+  /**
+   * @brief Looks up the metadata of a source.
+   *
+   * @param key Key identifying the source
+   * @param needs_page_indexes Whether the page indexes must have been read
+   * @return The cached metadata, or nullptr if not found
+   */
+  [[nodiscard]] std::shared_ptr<metadata const> find(std::string const& key,
+                                                     bool needs_page_indexes);
+
+  /**
+   * @brief Adds the metadata of a source, evicting the least recently used entries as needed.
+   *
+   * Metadata larger than the cache bound is not added.
+   *
+   * @param key Key identifying the source
+   * @param meta Parsed metadata of the source
+   */
+  void insert(std::string const& key, std::shared_ptr<metadata const> meta);
+
+  void clear();
+
+  [[nodiscard]] std::size_t num_entries() const;
+
+  [[nodiscard]] std::size_t size_bytes() const;
+
+  [[nodiscard]] std::size_t max_size_bytes() const { return _max_size_bytes; }
+
+ private:
+  struct entry {
+    std::shared_ptr<metadata const> meta;
+    std::list<std::string>::iterator lru_pos;
+  };
+
+  void erase(std::unordered_map<std::string, entry>::iterator it);
+
+  std::size_t const _max_size_bytes;
+
+  mutable std::mutex _mutex;
+  std::size_t _size_bytes{0};
+  // keys, most recently used first
+  std::list<std::string> _lru;
+  std::unordered_map<std::string, entry> _entries;
+};
+
+/**
+ * @brief Computes the metadata cache key of each source.
+ *
+ * User provided keys are used as is. Otherwise, file paths are identified by their path, size and
+ * modification time; an empty key is returned for sources that cannot be identified.
+ *
+ * @param info Source information of the reader
+ * @param user_keys Keys set in the reader options
+ * @param num_sources Number of sources being read
+ * @return One key per source, empty for sources that must not be cached
+ */
+[[nodiscard]] std::vector<std::string> metadata_cache_keys(source_info const& info,
+                                                           host_span<std::string const> user_keys,
+                                                           std::size_t num_sources);
+
+}  // namespace cudf::io::parquet::detail
@@ -16,6 +16,7 @@
 
 #include "delta_enc.cuh"
 #include "io/parquet/parquet_gpu.hpp"
+#include "io/statistics/column_statistics.cuh"
 #include "io/utilities/block_utils.cuh"
 #include "page_string_utils.cuh"
 #include "parquet_gpu.cuh"
@@ -454,7 +455,9 @@ CUDF_KERNEL void __launch_bounds__(block_size)
 template <int block_size>
 CUDF_KERNEL void __launch_bounds__(block_size)
   gpuCalculatePageFragments(device_span<PageFragment> frag,
-                            device_span<size_type const> column_frag_sizes)
+                            device_span<size_type const> column_frag_sizes,
+                            device_span<statistics_chunk> frag_stats,
+                            bool int96_timestamps)
 {
   __shared__ __align__(16) frag_init_state_s state_g;
 
@@ -476,25 +479,28 @@ CUDF_KERNEL void __launch_bounds__(block_size)
 
   calculate_frag_size<block_size>(s, t);
   if (t == 0) { frag[blockIdx.x] = s->frag; }
-}
 
-// blockDim {128,1,1}
-CUDF_KERNEL void __launch_bounds__(128)
-  gpuInitFragmentStats(device_span<statistics_group> groups,
-                       device_span<PageFragment const> fragments)
-{
-  uint32_t const lane_id = threadIdx.x & WARP_MASK;
-  uint32_t const frag_id = blockIdx.x * 4 + (threadIdx.x / cudf::detail::warp_size);
-  if (frag_id < fragments.size()) {
-    if (lane_id == 0) {
-      statistics_group g;
-      auto* const ck_g = fragments[frag_id].chunk;
-      g.col            = ck_g->col_desc;
-      g.start_row      = fragments[frag_id].start_value_idx;
-      g.num_rows       = fragments[frag_id].num_leaf_values;
-      g.non_leaf_nulls = fragments[frag_id].num_values - g.num_rows;
-      groups[frag_id]  = g;
+  // Gather the fragment statistics while the values just sized are still cached, instead of
+  // reading them again in a separate statistics pass.
+  if (not frag_stats.empty()) {
+    __shared__ __align__(8) stats_state_s stats_g;
+    __shared__ block_reduce_storage<block_size> stats_storage;
+
+    cooperative_load(stats_g.ck);
+    if (t == 0) {
+      stats_g.col                  = s->col;
+      stats_g.group.col            = ck_g->col_desc;
+      stats_g.group.start_row      = s->frag.start_value_idx;
+      stats_g.group.num_rows       = s->frag.num_leaf_values;
+      stats_g.group.non_leaf_nulls = s->frag.num_values - s->frag.num_leaf_values;
     }
+    __syncthreads();
+
+    calculate_group_statistics_block<block_size, detail::io_file_format::PARQUET>(
+      stats_g, stats_storage, int96_timestamps);
+    __syncthreads();
+
+    cooperative_load(frag_stats[blockIdx.x], &stats_g.ck);
   }
 }
 
@@ -3376,19 +3382,12 @@ void InitRowGroupFragments(device_2dspan<PageFragment> frag,
 
 void CalculatePageFragments(device_span<PageFragment> frag,
                             device_span<size_type const> column_frag_sizes,
+                            device_span<statistics_chunk> frag_stats,
+                            bool int96_timestamps,
                             rmm::cuda_stream_view stream)
 {
-  gpuCalculatePageFragments<512><<<frag.size(), 512, 0, stream.value()>>>(frag, column_frag_sizes);
-}
-
-void InitFragmentStatistics(device_span<statistics_group> groups,
-                            device_span<PageFragment const> fragments,
-                            rmm::cuda_stream_view stream)
-{
-  int const num_fragments = fragments.size();
-  int const dim =
-    util::div_rounding_up_safe(num_fragments, encode_block_size / cudf::detail::warp_size);
-  gpuInitFragmentStats<<<dim, encode_block_size, 0, stream.value()>>>(groups, fragments);
+  gpuCalculatePageFragments<512><<<frag.size(), 512, 0, stream.value()>>>(
+    frag, column_frag_sizes, frag_stats, int96_timestamps);
 }
 
 void InitEncoderPages(device_2dspan<EncColumnChunk> chunks,
@@ -381,6 +381,56 @@ struct ColumnChunkMetaData {
   // The histograms contained in these statistics can also be useful in some cases for more
   // fine-grained nullability/list length filter pushdown.
   thrust::optional<SizeStatistics> size_statistics;
+  // Byte offset from beginning of file to Bloom filter data.
+  thrust::optional<int64_t> bloom_filter_offset;
+  // Size of Bloom filter data including the serialized header, in bytes. Added in 2.10 so readers
+  // may not read this field from old files and it can be obtained after the BloomFilterHeader has
+  // been deserialized.
+  thrust::optional<int32_t> bloom_filter_length;
+};
+
+/**
+ * @brief Thrift-derived struct describing the algorithm used by a Bloom filter
+ *
+ * Only the split block Bloom filter (SBBF) algorithm is defined by the specification.
+ */
+struct BloomFilterAlgorithm {
+  enum Algorithm { UNDEFINED, SPLIT_BLOCK };
+  Algorithm algorithm{Algorithm::SPLIT_BLOCK};
+};
+
+/**
+ * @brief Thrift-derived struct describing the hash function used by a Bloom filter
+ *
+ * Only xxHash (XXH64 with a seed of 0) is defined by the specification.
+ */
+struct BloomFilterHash {
+  enum Hash { UNDEFINED, XXHASH };
+  Hash hash{Hash::XXHASH};
+};
+
+/**
+ * @brief Thrift-derived struct describing the compression of a Bloom filter bitset
+ *
+ * Only an uncompressed bitset is defined by the specification.
+ */
+struct BloomFilterCompression {
+  enum Compression { UNDEFINED, UNCOMPRESSED };
+  Compression compression{Compression::UNCOMPRESSED};
+};
+
+/**
+ * @brief Thrift-derived struct for the header that precedes a Bloom filter bitset
+ */
+struct BloomFilterHeader {
+  // The size of the bitset in bytes
+  int32_t num_bytes = 0;
+  // The algorithm for setting bits
+  BloomFilterAlgorithm algorithm;
+  // The hash function used for Bloom filter
+  BloomFilterHash hash;
+  // The compression used in the Bloom filter
+  BloomFilterCompression compression;
 };
 
 /**
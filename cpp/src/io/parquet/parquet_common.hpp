@@ -26,6 +26,10 @@ auto constexpr MAX_DECIMAL32_PRECISION  = 9;
 auto constexpr MAX_DECIMAL64_PRECISION  = 18;
 auto constexpr MAX_DECIMAL128_PRECISION = 38;  // log10(2^(sizeof(int128_t) * 8 - 1) - 1)
 
+// Number of 32-bit words in a split block Bloom filter block, as defined by the parquet spec:
+// https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+auto constexpr split_block_bloom_filter_words = 8;
+
 /**
  * @brief Basic data types in Parquet, determines how data is physically stored
  */
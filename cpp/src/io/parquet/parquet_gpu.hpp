@@ -48,6 +48,12 @@ constexpr int MAX_DICT_BITS = 24;
 // Total number of unsigned 24 bit values
 constexpr size_type MAX_DICT_SIZE = (1 << MAX_DICT_BITS) - 1;
 
+// Number of hash bits used to select a register of a chunk's HyperLogLog cardinality sketch
+constexpr int CARDINALITY_SKETCH_BITS = 10;
+
+// Number of registers in a chunk's HyperLogLog cardinality sketch
+constexpr int CARDINALITY_SKETCH_SIZE = 1 << CARDINALITY_SKETCH_BITS;
+
 // level decode buffer size.
 constexpr int LEVEL_DECODE_BUF_SIZE = 2048;
 
@@ -206,16 +212,19 @@ enum level_type {
  * Used to control which decode kernels to run.
  */
 enum class decode_kernel_mask {
-  NONE                   = 0,
-  GENERAL                = (1 << 0),  // Run catch-all decode kernel
-  STRING                 = (1 << 1),  // Run decode kernel for string data
-  DELTA_BINARY           = (1 << 2),  // Run decode kernel for DELTA_BINARY_PACKED data
-  DELTA_BYTE_ARRAY       = (1 << 3),  // Run decode kernel for DELTA_BYTE_ARRAY encoded data
-  DELTA_LENGTH_BA        = (1 << 4),  // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY encoded data
-  FIXED_WIDTH_NO_DICT    = (1 << 5),  // Run decode kernel for fixed width non-dictionary pages
-  FIXED_WIDTH_DICT       = (1 << 6),  // Run decode kernel for fixed width dictionary pages
-  BYTE_STREAM_SPLIT      = (1 << 7),  // Run decode kernel for BYTE_STREAM_SPLIT encoded data
-  BYTE_STREAM_SPLIT_FLAT = (1 << 8),  // Same as above but with a flat schema
+  NONE                       = 0,
+  GENERAL                    = (1 << 0),   // Run catch-all decode kernel
+  STRING                     = (1 << 1),   // Run decode kernel for string data
+  DELTA_BINARY               = (1 << 2),   // Run decode kernel for DELTA_BINARY_PACKED data
+  DELTA_BYTE_ARRAY           = (1 << 3),   // Run decode kernel for DELTA_BYTE_ARRAY encoded data
+  DELTA_LENGTH_BA            = (1 << 4),   // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY data
+  FIXED_WIDTH_NO_DICT        = (1 << 5),   // Run decode kernel for fixed width non-dictionary pages
+  FIXED_WIDTH_DICT           = (1 << 6),   // Run decode kernel for fixed width dictionary pages
+  BYTE_STREAM_SPLIT          = (1 << 7),   // Run decode kernel for BYTE_STREAM_SPLIT encoded data
+  BYTE_STREAM_SPLIT_FLAT     = (1 << 8),   // Same as above but with a flat schema
+  FIXED_WIDTH_NO_DICT_NESTED = (1 << 9),   // Same as FIXED_WIDTH_NO_DICT with structs, no lists
+  FIXED_WIDTH_DICT_NESTED    = (1 << 10),  // Same as FIXED_WIDTH_DICT with structs, no lists
+  BYTE_STREAM_SPLIT_NESTED   = (1 << 11),  // Same as BYTE_STREAM_SPLIT_FLAT with structs, no lists
 };
 
 // mask representing all the ways in which a string can be encoded
@@ -489,6 +498,7 @@ struct parquet_column_device_view : stats_column_desc {
   bool output_as_byte_array;   //!< Indicates this list column is being written as a byte array
   bool skip_compression;       //!< Skip compression for this column
   column_encoding requested_encoding;  //!< User specified encoding for this column.
+  double bloom_filter_fpp;             //!< Bloom filter false positive probability, 0 if unset
 };
 
 struct EncColumnChunk;
@@ -577,6 +587,8 @@ struct EncColumnChunk {
   uint32_t* def_histogram_data;  //!< Buffers for size histograms. One for chunk and one per page.
   uint32_t* rep_histogram_data;  //!< Size is (max(level) + 1) * (num_data_pages + 1).
   size_t var_bytes_size;         //!< Sum of var_bytes_size from the pages (byte arrays only)
+  uint32_t* bloom_filter_data;   //!< Split block bloom filter bitset for this chunk
+  uint32_t bloom_filter_size;    //!< Size of bloom filter bitset in bytes, 0 if no bloom filter
 
   constexpr uint32_t num_dict_pages() const { return use_dictionary ? 1 : 0; }
 
@@ -893,6 +905,7 @@ void DecodeDeltaLengthByteArray(cudf::detail::hostdevice_span<PageInfo> pages,
  * @param[in] num_rows Total number of rows to read
  * @param[in] min_row Minimum number of rows to read
  * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_nesting Whether to decode the pages of nested columns without lists
  * @param[out] error_code Error code for kernel failures
  * @param[in] stream CUDA stream to use
  */
@@ -901,6 +914,7 @@ void DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
                          std::size_t num_rows,
                          size_t min_row,
                          int level_type_size,
+                         bool has_nesting,
                          kernel_error::pointer error_code,
                          rmm::cuda_stream_view stream);
 
@@ -915,6 +929,7 @@ void DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
  * @param[in] num_rows Total number of rows to read
  * @param[in] min_row Minimum number of rows to read
  * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_nesting Whether to decode the pages of nested columns without lists
  * @param[out] error_code Error code for kernel failures
  * @param[in] stream CUDA stream to use
  */
@@ -923,11 +938,13 @@ void DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pages,
                              std::size_t num_rows,
                              size_t min_row,
                              int level_type_size,
+                             bool has_nesting,
                              kernel_error::pointer error_code,
                              rmm::cuda_stream_view stream);
 
 /**
- * @brief Launches kernel for reading dictionary fixed width column data stored in the pages
+ * @brief Launches kernel for reading BYTE_STREAM_SPLIT fixed width column data stored in the
+ * pages of columns without lists
  *
  * The page data will be written to the output pointed to in the page's
  * associated column chunk.
@@ -937,6 +954,7 @@ void DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pages,
  * @param[in] num_rows Total number of rows to read
  * @param[in] min_row Minimum number of rows to read
  * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_nesting Whether to decode the pages of nested columns without lists
  * @param[out] error_code Error code for kernel failures
  * @param[in] stream CUDA stream to use
  */
@@ -945,6 +963,7 @@ void DecodeSplitPageDataFlat(cudf::detail::hostdevice_span<PageInfo> pages,
                              std::size_t num_rows,
                              size_t min_row,
                              int level_type_size,
+                             bool has_nesting,
                              kernel_error::pointer error_code,
                              rmm::cuda_stream_view stream);
 
@@ -975,25 +994,21 @@ void InitRowGroupFragments(cudf::detail::device_2dspan<PageFragment> frag,
  * Based on the number of rows in each fragment, populates the value count, the size of data in the
  * fragment, the number of unique values, and the data size of unique values.
  *
+ * When `frag_stats` is not empty, the statistics of each fragment are gathered in the same pass
+ * over its values.
+ *
  * This assumes an initial call to InitRowGroupFragments has been made.
  *
  * @param[out] frag Fragment array [fragment_id]
  * @param[in] column_frag_sizes Number of rows per fragment per column [column_id]
+ * @param[out] frag_stats Fragment statistics [fragment_id], or empty to skip statistics
+ * @param[in] int96_timestamps Flag to indicate if timestamps will be written as INT96
  * @param[in] stream CUDA stream to use
  */
 void CalculatePageFragments(device_span<PageFragment> frag,
                             device_span<size_type const> column_frag_sizes,
-                            rmm::cuda_stream_view stream);
-
-/**
- * @brief Launches kernel for initializing fragment statistics groups with variable fragment sizes
- *
- * @param[out] groups Statistics groups [total_fragments]
- * @param[in] fragments Page fragments [total_fragments]
- * @param[in] stream CUDA stream to use
- */
-void InitFragmentStatistics(device_span<statistics_group> groups,
-                            device_span<PageFragment const> fragments,
+                            device_span<statistics_chunk> frag_stats,
+                            bool int96_timestamps,
                             rmm::cuda_stream_view stream);
 
 /**
@@ -1013,6 +1028,40 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
 void populate_chunk_hash_maps(cudf::detail::device_2dspan<PageFragment const> frags,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Build a HyperLogLog sketch of the distinct valid values of each column chunk
+ *
+ * Chunks that do not have `use_dictionary` set are skipped. Each chunk owns
+ * `CARDINALITY_SKETCH_SIZE` consecutive registers, starting at the chunk's flat index into
+ * `chunks` times `CARDINALITY_SKETCH_SIZE`. The registers must be zero initialized.
+ *
+ * @param frags Column fragments
+ * @param chunks Flat span of the chunks referenced by `frags`
+ * @param registers Sketch registers for all chunks
+ * @param stream CUDA stream to use
+ */
+void estimate_chunk_cardinality(cudf::detail::device_2dspan<PageFragment const> frags,
+                                device_span<EncColumnChunk const> chunks,
+                                device_span<uint32_t> registers,
+                                rmm::cuda_stream_view stream);
+
+/**
+ * @brief Build a HyperLogLog sketch of the distinct valid values of each leaf column
+ *
+ * Same as `estimate_chunk_cardinality`, but sketches whole columns before any chunks exist.
+ * Column `i` owns the `CARDINALITY_SKETCH_SIZE` registers starting at
+ * `i * CARDINALITY_SKETCH_SIZE`. The registers must be zero initialized.
+ *
+ * @param frags Row group fragments [column_id][fragment_id]
+ * @param col_desc Column description array [column_id]
+ * @param registers Sketch registers for all columns
+ * @param stream CUDA stream to use
+ */
+void estimate_column_cardinality(cudf::detail::device_2dspan<PageFragment const> frags,
+                                 device_span<parquet_column_device_view const> col_desc,
+                                 device_span<uint32_t> registers,
+                                 rmm::cuda_stream_view stream);
+
 /**
  * @brief Compact dictionary hash map entries into chunk.dict_data
  *
@@ -1036,6 +1085,19 @@ void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_vi
 void get_dictionary_indices(cudf::detail::device_2dspan<PageFragment const> frags,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert the valid leaf values of each column chunk into the chunk's split block bloom
+ * filter
+ *
+ * Chunks with a `bloom_filter_size` of 0 are skipped. The bitsets pointed to by
+ * `bloom_filter_data` must be zero initialized.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void BuildBloomFilters(cudf::detail::device_2dspan<PageFragment const> frags,
+                       rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for initializing encoder data pages
  *
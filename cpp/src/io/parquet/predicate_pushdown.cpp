@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "io/utilities/stats_expression_converter.hpp"
 #include "reader_impl_helpers.hpp"
 
 #include <cudf/ast/detail/expression_transformer.hpp>
@@ -34,12 +35,15 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <optional>
 #include <unordered_set>
 
 namespace cudf::io::parquet::detail {
 
+using cudf::io::detail::stats_expression_converter;
+
 namespace {
 /**
  * @brief Converts statistics in column chunks to 2 device columns - min, max values.
@@ -126,6 +130,78 @@ struct stats_caster {
     }
   }
 
+  // Local struct to hold host columns
+  template <typename T>
+  struct host_column {
+    // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+    thrust::host_vector<T> val;
+    std::vector<bitmask_type> null_mask;
+    cudf::size_type null_count = 0;
+    host_column(size_type total_row_groups)
+      : val(total_row_groups),
+        null_mask(
+          cudf::util::div_rounding_up_safe<size_type>(
+            cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
+          ~bitmask_type{0})
+    {
+    }
+
+    void set_index(size_type index,
+                   thrust::optional<std::vector<uint8_t>> const& binary_value,
+                   Type const type)
+    {
+      if (binary_value.has_value()) { return set_index(index, binary_value.value(), type); }
+      clear_bit_unsafe(null_mask.data(), index);
+      null_count++;
+    }
+
+    // `binary_value` must outlive this column since string values are not copied.
+    void set_index(size_type index, std::vector<uint8_t> const& binary_value, Type const type)
+    {
+      val[index] = convert<T>(binary_value.data(), binary_value.size(), type);
+    }
+
+    static auto make_strings_children(host_span<string_view> host_strings,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+    {
+      std::vector<char> chars{};
+      std::vector<cudf::size_type> offsets(1, 0);
+      for (auto const& str : host_strings) {
+        auto tmp =
+          str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
+        chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
+        offsets.push_back(offsets.back() + tmp.length());
+      }
+      auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+      auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+      return std::tuple{std::move(d_chars), std::move(d_offsets)};
+    }
+
+    auto to_device(cudf::data_type dtype,
+                   rmm::cuda_stream_view stream,
+                   rmm::device_async_resource_ref mr)
+    {
+      if constexpr (std::is_same_v<T, string_view>) {
+        auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
+        return cudf::make_strings_column(
+          val.size(),
+          std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+          d_chars.release(),
+          null_count,
+          rmm::device_buffer{
+            null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
+      }
+      return std::make_unique<column>(
+        dtype,
+        val.size(),
+        cudf::detail::make_device_uvector_async(val, stream, mr).release(),
+        rmm::device_buffer{
+          null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
+        null_count);
+    }
+  };  // local struct host_column
+
   // Creates device columns from column statistics (min, max)
   template <typename T>
   std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
@@ -138,76 +214,8 @@ struct stats_caster {
     if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
       CUDF_FAIL("Compound types do not have statistics");
     } else {
-      // Local struct to hold host columns
-      struct host_column {
-        // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
-        thrust::host_vector<T> val;
-        std::vector<bitmask_type> null_mask;
-        cudf::size_type null_count = 0;
-        host_column(size_type total_row_groups)
-          : val(total_row_groups),
-            null_mask(
-              cudf::util::div_rounding_up_safe<size_type>(
-                cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
-              ~bitmask_type{0})
-        {
-        }
-
-        void set_index(size_type index,
-                       thrust::optional<std::vector<uint8_t>> const& binary_value,
-                       Type const type)
-        {
-          if (binary_value.has_value()) {
-            val[index] = convert<T>(binary_value.value().data(), binary_value.value().size(), type);
-          }
-          if (not binary_value.has_value()) {
-            clear_bit_unsafe(null_mask.data(), index);
-            null_count++;
-          }
-        }
-
-        static auto make_strings_children(host_span<string_view> host_strings,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
-        {
-          std::vector<char> chars{};
-          std::vector<cudf::size_type> offsets(1, 0);
-          for (auto const& str : host_strings) {
-            auto tmp =
-              str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
-            chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
-            offsets.push_back(offsets.back() + tmp.length());
-          }
-          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
-          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
-          return std::tuple{std::move(d_chars), std::move(d_offsets)};
-        }
-
-        auto to_device(cudf::data_type dtype,
-                       rmm::cuda_stream_view stream,
-                       rmm::device_async_resource_ref mr)
-        {
-          if constexpr (std::is_same_v<T, string_view>) {
-            auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
-            return cudf::make_strings_column(
-              val.size(),
-              std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
-              d_chars.release(),
-              null_count,
-              rmm::device_buffer{
-                null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
-          }
-          return std::make_unique<column>(
-            dtype,
-            val.size(),
-            cudf::detail::make_device_uvector_async(val, stream, mr).release(),
-            rmm::device_buffer{
-              null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
-            null_count);
-        }
-      };  // local struct host_column
-      host_column min(total_row_groups);
-      host_column max(total_row_groups);
+      host_column<T> min(total_row_groups);
+      host_column<T> max(total_row_groups);
       size_type stats_idx = 0;
       for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
         for (auto const rg_idx : row_group_indices[src_idx]) {
@@ -242,151 +250,79 @@ struct stats_caster {
 };
 
 /**
- * @brief Converts AST expression to StatsAST for comparing with column statistics
- * This is used in row group filtering based on predicate.
- * statistics min value of a column is referenced by column_index*2
- * statistics max value of a column is referenced by column_index*2+1
- *
+ * @brief A range of rows within a row group that lies within a single page of each column that
+ * has a page index.
  */
-class stats_expression_converter : public ast::detail::expression_transformer {
- public:
-  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
-    : _num_columns{num_columns}
-  {
-    expr.accept(*this);
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
-  {
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
-  {
-    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
-                 "Statistics AST supports only left table");
-    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
-                 "Column index cannot be more than number of columns in the table");
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
+struct page_fragment {
+  size_type src_idx;
+  size_type rg_idx;
+  int64_t start_row;  // first row of the fragment, relative to the row group
+  int64_t end_row;    // one past the last row of the fragment, relative to the row group
+};
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(
-    ast::column_name_reference const& expr) override
-  {
-    CUDF_FAIL("Column name reference is not supported in statistics AST");
-  }
+/**
+ * @brief Converts page statistics in column indexes to 2 device columns - min, max values.
+ *
+ * Each row of the output columns corresponds to one `page_fragment`.
+ */
+struct page_stats_caster {
+  std::vector<metadata> const& per_file_metadata;
+  host_span<page_fragment const> fragments;
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  // Creates device columns from page statistics (min, max)
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    int schema_idx,
+    cudf::data_type dtype,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const
   {
-    using cudf::ast::ast_operator;
-    auto const operands = expr.get_operands();
-    auto const op       = expr.get_operator();
-
-    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
-      // First operand should be column reference, second should be literal.
-      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
-                   "Only binary operations are supported on column reference");
-      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
-                   "Second operand of binary operation with column reference must be a literal");
-      v->accept(*this);
-      auto const col_index = v->get_column_index();
-      switch (op) {
-        /* transform to stats conditions. op(col, literal)
-        col1 == val --> vmin <= val && vmax >= val
-        col1 != val --> !(vmin == val && vmax == val)
-        col1 >  val --> vmax > val
-        col1 <  val --> vmin < val
-        col1 >= val --> vmax >= val
-        col1 <= val --> vmin <= val
-        */
-        case ast_operator::EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1 =
-            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
-          break;
-        }
-        case ast_operator::NOT_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
-          break;
-        }
-        case ast_operator::LESS: [[fallthrough]];
-        case ast_operator::LESS_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          _operators.emplace_back(op, vmin, operands[1].get());
-          break;
-        }
-        case ast_operator::GREATER: [[fallthrough]];
-        case ast_operator::GREATER_EQUAL: {
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          _operators.emplace_back(op, vmax, operands[1].get());
-          break;
-        }
-        default: CUDF_FAIL("Unsupported operation in Statistics AST");
-      };
+    // List, Struct, Dictionary types are not supported
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
     } else {
-      auto new_operands = visit_operands(operands);
-      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
-        _operators.emplace_back(op, new_operands.front(), new_operands.back());
-      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
-        _operators.emplace_back(op, new_operands.front());
+      auto const num_fragments = static_cast<size_type>(fragments.size());
+      stats_caster::host_column<T> min(num_fragments);
+      stats_caster::host_column<T> max(num_fragments);
+      for (size_type frag_idx = 0; frag_idx < num_fragments; ++frag_idx) {
+        auto const& frag      = fragments[frag_idx];
+        auto const& row_group = per_file_metadata[frag.src_idx].row_groups[frag.rg_idx];
+        auto col              = std::find_if(
+          row_group.columns.begin(),
+          row_group.columns.end(),
+          [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx; });
+        if (col != std::end(row_group.columns) and col->column_index.has_value() and
+            col->offset_index.has_value()) {
+          auto const& column_index = col->column_index.value();
+          auto const& locations    = col->offset_index.value().page_locations;
+          // page containing the first row of the fragment
+          auto const it = std::upper_bound(
+            locations.begin(),
+            locations.end(),
+            frag.start_row,
+            [](int64_t row, PageLocation const& loc) { return row < loc.first_row_index; });
+          auto const page_idx = std::distance(locations.begin(), it) - 1;
+          if (page_idx >= 0 and static_cast<size_t>(page_idx) < column_index.min_values.size() and
+              static_cast<size_t>(page_idx) < column_index.max_values.size() and
+              static_cast<size_t>(page_idx) < column_index.null_pages.size() and
+              not column_index.null_pages[page_idx]) {
+            min.set_index(frag_idx, column_index.min_values[page_idx], col->meta_data.type);
+            max.set_index(frag_idx, column_index.max_values[page_idx], col->meta_data.type);
+            continue;
+          }
+        }
+        // Marking it null, if page statistics are not available
+        min.set_index(frag_idx, thrust::nullopt, {});
+        max.set_index(frag_idx, thrust::nullopt, {});
       }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
     }
-    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
-    return std::reference_wrapper<ast::expression const>(_operators.back());
-  }
-
-  /**
-   * @brief Returns the AST to apply on Column chunk statistics.
-   *
-   * @return AST operation expression
-   */
-  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
-  {
-    return _stats_expr.value().get();
-  }
-
- private:
-  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
-    std::vector<std::reference_wrapper<ast::expression const>> operands)
-  {
-    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
-    for (auto const& operand : operands) {
-      auto const new_operand = operand.get().accept(*this);
-      transformed_operands.push_back(new_operand);
-    }
-    return transformed_operands;
   }
-  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
-  size_type _num_columns;
-  std::list<ast::column_reference> _col_ref;
-  std::list<ast::operation> _operators;
 };
 }  // namespace
 
 std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::filter_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   host_span<data_type const> output_dtypes,
   host_span<int const> output_column_schemas,
@@ -466,12 +402,13 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
     device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
 
   // Return only filtered row groups based on predicate
-  // if all are required or all are nulls, return.
+  // if all are required or all are nulls, try the bloom filters on the input row groups.
   if (std::all_of(is_row_group_required.cbegin(),
                   is_row_group_required.cend(),
                   [](auto i) { return bool(i); }) or
       predicate.null_count() == predicate.size()) {
-    return std::nullopt;
+    return apply_bloom_filters(
+      sources, input_row_group_indices, output_dtypes, output_column_schemas, filter, stream);
   }
   size_type is_required_idx = 0;
   for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
@@ -484,9 +421,138 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
     }
     filtered_row_group_indices.push_back(std::move(filtered_row_groups));
   }
+
+  // Further prune the row groups that survived the statistics using bloom filters.
+  auto bloom_filtered_row_group_indices =
+    apply_bloom_filters(sources,
+                        host_span<std::vector<size_type> const>(filtered_row_group_indices),
+                        output_dtypes,
+                        output_column_schemas,
+                        filter,
+                        stream);
+  if (bloom_filtered_row_group_indices.has_value()) { return bloom_filtered_row_group_indices; }
   return {std::move(filtered_row_group_indices)};
 }
 
+std::optional<std::vector<std::vector<page_row_range>>> aggregate_reader_metadata::filter_pages(
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  auto mr = rmm::mr::get_current_device_resource();
+
+  // Split each row group into fragments at the page boundaries of all the output columns so that
+  // every fragment lies within a single page of each column.
+  std::vector<page_fragment> fragments;
+  std::vector<size_t> rg_fragment_offsets{0};
+  bool has_page_index = false;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    for (auto const rg_idx : row_group_indices[src_idx]) {
+      auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
+      std::vector<int64_t> boundaries{0};
+      for (size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+        auto const& dtype = output_dtypes[col_idx];
+        if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) { continue; }
+        auto const schema_idx = output_column_schemas[col_idx];
+        auto col              = std::find_if(
+          row_group.columns.begin(),
+          row_group.columns.end(),
+          [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx; });
+        if (col == std::end(row_group.columns) or not col->offset_index.has_value() or
+            not col->column_index.has_value()) {
+          continue;
+        }
+        has_page_index = true;
+        for (auto const& loc : col->offset_index.value().page_locations) {
+          if (loc.first_row_index > 0 and loc.first_row_index < row_group.num_rows) {
+            boundaries.push_back(loc.first_row_index);
+          }
+        }
+      }
+      std::sort(boundaries.begin(), boundaries.end());
+      boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+      for (size_t b = 0; b < boundaries.size(); ++b) {
+        auto const end_row = b + 1 < boundaries.size() ? boundaries[b + 1] : row_group.num_rows;
+        fragments.push_back({static_cast<size_type>(src_idx), rg_idx, boundaries[b], end_row});
+      }
+      rg_fragment_offsets.push_back(fragments.size());
+    }
+  }
+  if (not has_page_index or fragments.empty()) { return std::nullopt; }
+  CUDF_EXPECTS(fragments.size() <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Number of page fragments exceeds the column size limit");
+
+  // Converts page statistics to a table
+  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  // For each column, it contains one row per page fragment.
+  auto const num_fragments = static_cast<size_type>(fragments.size());
+  std::vector<std::unique_ptr<column>> columns;
+  page_stats_caster stats_col{per_file_metadata, fragments};
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const schema_idx = output_column_schemas[col_idx];
+    auto const& dtype     = output_dtypes[col_idx];
+    // Only comparable types except fixed point are supported.
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) {
+      // placeholder only for unsupported types.
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_fragments, rmm::device_buffer{}, 0, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_fragments, rmm::device_buffer{}, 0, stream, mr));
+      continue;
+    }
+    auto [min_col, max_col] =
+      cudf::type_dispatcher<dispatch_storage_type>(dtype, stats_col, schema_idx, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto stats_table = cudf::table(std::move(columns));
+
+  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
+  stats_expression_converter stats_expr{filter.get(), static_cast<size_type>(output_dtypes.size())};
+  auto stats_ast     = stats_expr.get_stats_expr();
+  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
+  auto predicate     = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto num_bitmasks = num_bitmask_words(predicate.size());
+  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
+  if (predicate.nullable()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
+                                  predicate.null_mask(),
+                                  num_bitmasks * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+  auto is_fragment_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  // Collect the row ranges of the surviving fragments, merging adjacent ones.
+  bool any_pruned = false;
+  std::vector<std::vector<page_row_range>> row_ranges;
+  for (size_t rg = 0; rg + 1 < rg_fragment_offsets.size(); ++rg) {
+    std::vector<page_row_range> ranges;
+    for (auto frag_idx = rg_fragment_offsets[rg]; frag_idx < rg_fragment_offsets[rg + 1];
+         ++frag_idx) {
+      auto const& frag = fragments[frag_idx];
+      if (bit_is_set(host_bitmask.data(), frag_idx) and not is_fragment_required[frag_idx]) {
+        any_pruned = true;
+        continue;
+      }
+      if (not ranges.empty() and ranges.back().second == frag.start_row) {
+        ranges.back().second = frag.end_row;
+      } else {
+        ranges.emplace_back(frag.start_row, frag.end_row);
+      }
+    }
+    row_ranges.push_back(std::move(ranges));
+  }
+  if (not any_pruned) { return std::nullopt; }
+  return {std::move(row_ranges)};
+}
+
 // convert column named expression to column index reference expression
 named_to_reference_converter::named_to_reference_converter(
   std::optional<std::reference_wrapper<ast::expression const>> expr, table_metadata const& metadata)
@@ -536,7 +602,9 @@ std::reference_wrapper<ast::expression const> named_to_reference_converter::visi
   auto const operands = expr.get_operands();
   auto op             = expr.get_operator();
   auto new_operands   = visit_operands(operands);
-  if (cudf::ast::detail::ast_operator_arity(op) == 2) {
+  if (cudf::ast::detail::ast_operator_arity(op) == 3) {
+    _operators.emplace_back(op, new_operands[0], new_operands[1], new_operands[2]);
+  } else if (cudf::ast::detail::ast_operator_arity(op) == 2) {
     _operators.emplace_back(op, new_operands.front(), new_operands.back());
   } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
     _operators.emplace_back(op, new_operands.front());
@@ -628,6 +696,53 @@ class names_from_expression : public ast::detail::expression_transformer {
   std::unordered_set<std::string> _skip_names;
 };
 
+/**
+ * @brief Detects `column_reference`s in an AST expression
+ */
+class index_reference_finder : public ast::detail::expression_transformer {
+ public:
+  index_reference_finder(ast::expression const& expr) { expr.accept(*this); }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    return expr;
+  }
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    _has_index_reference = true;
+    return expr;
+  }
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    return expr;
+  }
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    for (auto const& operand : expr.get_operands()) {
+      operand.get().accept(*this);
+    }
+    return expr;
+  }
+
+  [[nodiscard]] bool has_index_reference() const { return _has_index_reference; }
+
+ private:
+  bool _has_index_reference = false;
+};
+
 [[nodiscard]] std::vector<std::string> get_column_names_in_expression(
   std::optional<std::reference_wrapper<ast::expression const>> expr,
   std::vector<std::string> const& skip_names)
@@ -635,4 +750,9 @@ class names_from_expression : public ast::detail::expression_transformer {
   return names_from_expression(expr, skip_names).to_vector();
 }
 
+[[nodiscard]] bool has_column_index_references(ast::expression const& expr)
+{
+  return index_reference_finder(expr).has_index_reference();
+}
+
 }  // namespace cudf::io::parquet::detail
@@ -17,17 +17,23 @@
 #include "reader_impl.hpp"
 
 #include "error.hpp"
+#include "io/utilities/stage_range.hpp"
+#include "metadata_cache.hpp"
 
+#include <cudf/detail/replace.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
 #include <bitset>
 #include <numeric>
 
@@ -273,6 +279,19 @@ void reader::impl::decode_page_data(read_mode mode, size_t skip_rows, size_t num
                             num_rows,
                             skip_rows,
                             level_type_size,
+                            false,
+                            error_code.data(),
+                            streams[s_idx++]);
+  }
+
+  // launch byte stream split decoder for columns nested in structs
+  if (BitAnd(kernel_mask, decode_kernel_mask::BYTE_STREAM_SPLIT_NESTED) != 0) {
+    DecodeSplitPageDataFlat(subpass.pages,
+                            pass.chunks,
+                            num_rows,
+                            skip_rows,
+                            level_type_size,
+                            true,
                             error_code.data(),
                             streams[s_idx++]);
   }
@@ -294,6 +313,18 @@ void reader::impl::decode_page_data(read_mode mode, size_t skip_rows, size_t num
                         num_rows,
                         skip_rows,
                         level_type_size,
+                        false,
+                        error_code.data(),
+                        streams[s_idx++]);
+  }
+
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_NO_DICT_NESTED) != 0) {
+    DecodePageDataFixed(subpass.pages,
+                        pass.chunks,
+                        num_rows,
+                        skip_rows,
+                        level_type_size,
+                        true,
                         error_code.data(),
                         streams[s_idx++]);
   }
@@ -304,6 +335,18 @@ void reader::impl::decode_page_data(read_mode mode, size_t skip_rows, size_t num
                             num_rows,
                             skip_rows,
                             level_type_size,
+                            false,
+                            error_code.data(),
+                            streams[s_idx++]);
+  }
+
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_DICT_NESTED) != 0) {
+    DecodePageDataFixedDict(subpass.pages,
+                            pass.chunks,
+                            num_rows,
+                            skip_rows,
+                            level_type_size,
+                            true,
                             error_code.data(),
                             streams[s_idx++]);
   }
@@ -427,16 +470,34 @@ reader::impl::impl(std::size_t chunk_read_limit,
     _output_chunk_read_limit{chunk_read_limit},
     _input_pass_read_limit{pass_read_limit}
 {
-  // Open and parse the source dataset metadata
-  _metadata =
-    std::make_unique<aggregate_reader_metadata>(_sources, options.is_enabled_use_arrow_schema());
+  // Open and parse the source dataset metadata, looking the footers up in the cache if given
+  auto const metadata_cache = options.get_metadata_cache();
+  auto const cache_keys = metadata_cache != nullptr
+                            ? metadata_cache_keys(options.get_source(),
+                                                  options.get_metadata_cache_keys(),
+                                                  _sources.size())
+                            : std::vector<std::string>{};
+  _metadata = std::make_unique<aggregate_reader_metadata>(_sources,
+                                                          options.is_enabled_use_arrow_schema(),
+                                                          options.get_filter().has_value(),
+                                                          metadata_cache.get(),
+                                                          cache_keys);
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  // Dictionary-encoded strings may be returned as dictionary columns
+  _dictionary_string_columns = options.is_enabled_dictionary_string_columns();
+
   // Binary columns can be read as binary or strings
   _reader_column_schema = options.get_column_schema();
 
+  // Prefetching only pays off when there is more than one pass to read
+  _prefetch_next_pass = options.is_enabled_prefetch_next_pass() and _input_pass_read_limit > 0;
+
+  // Statistics of each chunk are reported if requested
+  _chunk_stats_output = options.get_chunk_statistics();
+
   // Select only columns required by the options and filter
   std::optional<std::vector<std::string>> filter_columns_names;
   if (options.get_filter().has_value() and options.get_columns().has_value()) {
@@ -453,6 +514,13 @@ reader::impl::impl(std::size_t chunk_read_limit,
                               _strings_to_categorical,
                               _options.timestamp_type.id());
 
+  // Output columns may be allocated with their own memory resources
+  _output_mrs = options.get_output_memory_resources();
+  CUDF_EXPECTS(_output_mrs.empty() or
+                 _output_mrs.size() == _output_buffers.size() - _num_filter_only_columns,
+               "There must be one output memory resource per output column",
+               std::invalid_argument);
+
   // Save the states of the output buffers for reuse in `chunk_read()`.
   for (auto const& buff : _output_buffers) {
     _output_buffers_template.emplace_back(cudf::io::detail::inline_column_buffer::empty_like(buff));
@@ -463,6 +531,23 @@ reader::impl::impl(std::size_t chunk_read_limit,
   table_metadata metadata;
   populate_metadata(metadata);
   _expr_conv = named_to_reference_converter(options.get_filter(), metadata);
+
+  // Late materialization reads the filter columns on their own, which requires them to be
+  // referenced by name, and reads whole row groups in both phases.
+  if (options.is_enabled_late_materialization() and _output_chunk_read_limit == 0 and
+      _input_pass_read_limit == 0 and options.get_filter().has_value() and
+      options.get_columns().has_value() and _options.skip_rows == 0 and
+      not _options.num_rows.has_value() and not _reader_column_schema.has_value() and
+      not has_column_index_references(options.get_filter().value().get())) {
+    auto const filter_names = get_column_names_in_expression(options.get_filter(), {});
+    auto const& columns     = options.get_columns().value();
+    // nothing to gain if all the selected columns are needed by the filter anyway
+    auto const has_payload_columns =
+      std::any_of(columns.cbegin(), columns.cend(), [&](auto const& name) {
+        return std::find(filter_names.cbegin(), filter_names.cend(), name) == filter_names.cend();
+      });
+    if (has_payload_columns) { _late_materialization_options = options; }
+  }
 }
 
 void reader::impl::prepare_data(read_mode mode)
@@ -518,7 +603,11 @@ table_with_metadata reader::impl::read_chunk_internal(read_mode mode)
   allocate_columns(mode, read_info.skip_rows, read_info.num_rows);
 
   // Parse data into the output buffers.
-  decode_page_data(mode, read_info.skip_rows, read_info.num_rows);
+  {
+    io::detail::stage_range stage{"decode pages", _chunk_stats.decode_time};
+    decode_page_data(mode, read_info.skip_rows, read_info.num_rows);
+  }
+  _chunk_stats.num_pages_decoded += subpass.pages.size();
 
   // Create the final output cudf columns.
   for (size_t i = 0; i < _output_buffers.size(); ++i) {
@@ -555,9 +644,11 @@ table_with_metadata reader::impl::finalize_output(table_metadata& out_metadata,
   for (size_t i = out_columns.size(); i < _output_buffers.size(); ++i) {
     if (!_output_metadata) {
       column_name_info& col_name = out_metadata.schema_info[i];
-      out_columns.emplace_back(io::detail::empty_like(_output_buffers[i], &col_name, _stream, _mr));
+      out_columns.emplace_back(
+        io::detail::empty_like(_output_buffers[i], &col_name, _stream, output_mr(i)));
     } else {
-      out_columns.emplace_back(io::detail::empty_like(_output_buffers[i], nullptr, _stream, _mr));
+      out_columns.emplace_back(
+        io::detail::empty_like(_output_buffers[i], nullptr, _stream, output_mr(i)));
     }
   }
 
@@ -590,11 +681,69 @@ table_with_metadata reader::impl::finalize_output(table_metadata& out_metadata,
     auto counting_it        = thrust::make_counting_iterator<std::size_t>(0);
     auto const output_count = read_table->num_columns() - _num_filter_only_columns;
     auto only_output        = read_table->select(counting_it, counting_it + output_count);
-    auto output_table = cudf::detail::apply_boolean_mask(only_output, *predicate, _stream, _mr);
+    auto output_table       = filter_output(only_output, *predicate);
     if (_num_filter_only_columns > 0) { out_metadata.schema_info.resize(output_count); }
-    return {std::move(output_table), std::move(out_metadata)};
+    return {encode_dictionary_columns(std::move(output_table)), std::move(out_metadata)};
+  }
+  return {encode_dictionary_columns(std::make_unique<table>(std::move(out_columns))),
+          std::move(out_metadata)};
+}
+
+void reader::impl::select_dictionary_columns()
+{
+  _dictionary_output_columns.assign(_output_buffers.size(), false);
+  auto const& row_groups = _file_itm_data.row_groups;
+  if (row_groups.empty()) { return; }
+
+  for (auto const& col : _input_columns) {
+    // strings nested in lists or structs are left as they are
+    if (col.nesting_depth() != 1 or
+        _output_buffers[col.nesting[0]].type.id() != type_id::STRING) {
+      continue;
+    }
+    _dictionary_output_columns[col.nesting[0]] =
+      std::all_of(row_groups.cbegin(), row_groups.cend(), [&](auto const& rg) {
+        auto const& encodings =
+          _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx).encodings;
+        return std::any_of(encodings.cbegin(), encodings.cend(), [](auto encoding) {
+          return encoding == Encoding::PLAIN_DICTIONARY or encoding == Encoding::RLE_DICTIONARY;
+        });
+      });
+  }
+}
+
+std::unique_ptr<table> reader::impl::encode_dictionary_columns(std::unique_ptr<table> output)
+{
+  if (std::none_of(_dictionary_output_columns.cbegin(),
+                   _dictionary_output_columns.cend(),
+                   [](bool is_dictionary) { return is_dictionary; })) {
+    return output;
+  }
+
+  auto columns = output->release();
+  for (std::size_t i = 0; i < columns.size() and i < _dictionary_output_columns.size(); ++i) {
+    if (_dictionary_output_columns[i] and columns[i]->type().id() == type_id::STRING) {
+      columns[i] = cudf::dictionary::detail::encode(
+        columns[i]->view(), data_type{type_id::UINT32}, _stream, output_mr(i));
+    }
   }
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  return std::make_unique<table>(std::move(columns));
+}
+
+std::unique_ptr<table> reader::impl::filter_output(table_view const& output,
+                                                   column_view const& predicate)
+{
+  if (_output_mrs.empty()) {
+    return cudf::detail::apply_boolean_mask(output, predicate, _stream, _mr);
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_type i = 0; i < output.num_columns(); ++i) {
+    auto filtered = cudf::detail::apply_boolean_mask(
+      table_view{{output.column(i)}}, predicate, _stream, output_mr(i));
+    columns.push_back(std::move(filtered->release().front()));
+  }
+  return std::make_unique<table>(std::move(columns));
 }
 
 table_with_metadata reader::impl::read()
@@ -602,10 +751,113 @@ table_with_metadata reader::impl::read()
   CUDF_EXPECTS(_output_chunk_read_limit == 0,
                "Reading the whole file must not have non-zero byte_limit.");
 
+  if (_late_materialization_options.has_value()) { return read_late_materialized(); }
+
   prepare_data(read_mode::READ_ALL);
   return read_chunk_internal(read_mode::READ_ALL);
 }
 
+table_with_metadata reader::impl::read_late_materialized()
+{
+  auto const& options = _late_materialization_options.value();
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+
+  // Prune the row groups with the filter the same way a regular read does
+  std::vector<data_type> output_dtypes;
+  std::transform(_output_buffers_template.cbegin(),
+                 _output_buffers_template.cend(),
+                 std::back_inserter(output_dtypes),
+                 [](auto const& col) { return col.type; });
+  auto const row_groups = std::get<2>(_metadata->select_row_groups(_sources,
+                                                                   _options.row_group_indices,
+                                                                   _options.skip_rows,
+                                                                   _options.num_rows,
+                                                                   output_dtypes,
+                                                                   _output_column_schemas,
+                                                                   _expr_conv.get_converted_expr(),
+                                                                   _stream));
+
+  // Per-source lists of the selected row groups for which `keep(i)` holds
+  auto const row_group_lists = [&](auto const& keep) {
+    std::vector<std::vector<size_type>> lists(_sources.size());
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      if (keep(i)) { lists[row_groups[i].source_index].push_back(row_groups[i].index); }
+    }
+    return lists;
+  };
+
+  // Reads whole row groups of the given columns over non-owning views of our sources
+  auto const read_phase = [&](std::vector<std::string> columns,
+                              std::vector<std::vector<size_type>> row_group_indices,
+                              bool use_pandas_metadata,
+                              bool dictionary_string_columns) {
+    auto const phase_options =
+      parquet_reader_options::builder(options.get_source())
+        .columns(std::move(columns))
+        .row_groups(std::move(row_group_indices))
+        .convert_strings_to_categories(options.is_enabled_convert_strings_to_categories())
+        .dictionary_string_columns(dictionary_string_columns)
+        .use_pandas_metadata(use_pandas_metadata)
+        .use_arrow_schema(options.is_enabled_use_arrow_schema())
+        .timestamp_type(options.get_timestamp_type())
+        .build();
+    std::vector<std::unique_ptr<datasource>> sources;
+    std::transform(_sources.cbegin(),
+                   _sources.cend(),
+                   std::back_inserter(sources),
+                   [](auto const& source) { return datasource::create(source.get()); });
+    return impl(std::move(sources), phase_options, _stream, temp_mr).read();
+  };
+
+  // Phase 1: decode the filter columns and evaluate the filter on them
+  auto const filter_table =
+    read_phase(get_column_names_in_expression(options.get_filter(), {}),
+               row_group_lists([](auto) { return true; }),
+               false,
+               false);
+  auto const filter_conv =
+    named_to_reference_converter(options.get_filter(), filter_table.metadata);
+  auto predicate = cudf::detail::compute_column(
+    filter_table.tbl->view(), filter_conv.get_converted_expr().value().get(), _stream, temp_mr);
+  CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+               "Predicate filter should return a boolean");
+  // rows with a null predicate never pass the filter
+  if (predicate->has_nulls()) {
+    predicate = cudf::detail::replace_nulls(
+      predicate->view(), numeric_scalar<bool>(false, true, _stream), _stream, temp_mr);
+  }
+  auto const h_predicate = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate->view().data<uint8_t>(), predicate->size()), _stream);
+
+  // Keep the row groups with at least one row passing the filter, and their part of the mask
+  std::vector<bool> has_passing_rows(row_groups.size());
+  std::vector<uint8_t> h_payload_mask;
+  auto rg_begin = h_predicate.cbegin();
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    auto const rg_num_rows =
+      _metadata->get_row_group(row_groups[i].index, row_groups[i].source_index).num_rows;
+    CUDF_EXPECTS(rg_num_rows <= std::distance(rg_begin, h_predicate.cend()),
+                 "Filter columns have fewer rows than the selected row groups");
+    auto const rg_end   = rg_begin + rg_num_rows;
+    has_passing_rows[i] = std::any_of(rg_begin, rg_end, [](auto value) { return value != 0; });
+    if (has_passing_rows[i]) { h_payload_mask.insert(h_payload_mask.end(), rg_begin, rg_end); }
+    rg_begin = rg_end;
+  }
+
+  // Phase 2: decode the selected columns of the surviving row groups only
+  auto payload = read_phase(options.get_columns().value(),
+                            row_group_lists([&](auto i) { return has_passing_rows[i]; }),
+                            options.is_enabled_use_pandas_metadata(),
+                            options.is_enabled_dictionary_string_columns());
+  auto const payload_mask =
+    column(data_type{type_id::BOOL8},
+           static_cast<size_type>(h_payload_mask.size()),
+           cudf::detail::make_device_uvector_async(h_payload_mask, _stream, temp_mr).release(),
+           rmm::device_buffer{},
+           0);
+  return {filter_output(payload.tbl->view(), payload_mask.view()), std::move(payload.metadata)};
+}
+
 table_with_metadata reader::impl::read_chunk()
 {
   // Reset the output buffers to their original states (right after reader construction).
@@ -619,7 +871,13 @@ table_with_metadata reader::impl::read_chunk()
   }
 
   prepare_data(read_mode::CHUNKED_READ);
-  return read_chunk_internal(read_mode::CHUNKED_READ);
+  auto chunk = read_chunk_internal(read_mode::CHUNKED_READ);
+
+  // the work done for this chunk, including that done in a preceding `has_next()`
+  if (_chunk_stats_output != nullptr) { *_chunk_stats_output = _chunk_stats; }
+  _chunk_stats = {};
+
+  return chunk;
 }
 
 bool reader::impl::has_next()
@@ -650,9 +908,11 @@ parquet_metadata read_parquet_metadata(host_span<std::unique_ptr<datasource> con
 {
   // do not use arrow schema when reading information from parquet metadata.
   static constexpr auto use_arrow_schema = false;
+  // page indexes are only needed for filtering.
+  static constexpr auto has_filter = false;
 
   // Open and parse the source dataset metadata
-  auto metadata = aggregate_reader_metadata(sources, use_arrow_schema);
+  auto metadata = aggregate_reader_metadata(sources, use_arrow_schema, has_filter);
 
   return parquet_metadata{parquet_schema{walk_schema(&metadata, 0)},
                           metadata.get_num_rows(),
@@ -126,6 +126,17 @@ class reader::impl {
    */
   enum class read_mode { READ_ALL, CHUNKED_READ };
 
+  /**
+   * @brief Read the filter columns first, then the selected columns of the row groups that have
+   * rows passing the filter.
+   *
+   * Each phase is read by a separate reader over the same data sources. The row groups given to
+   * the first phase are pruned with the filter exactly as in a regular read.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_late_materialized();
+
   /**
    * @brief Perform the necessary data preprocessing for parsing file later on.
    *
@@ -185,14 +196,32 @@ class reader::impl {
   // utility functions
  private:
   /**
-   * @brief Read the set of column chunks to be processed for this pass.
+   * @brief Read the set of column chunks of the given row groups.
+   *
+   * Does not decompress the chunk data. Device buffers are always allocated on `_stream`, while
+   * the data is copied to them on `read_stream`.
    *
-   * Does not decompress the chunk data.
+   * @param row_groups Row groups whose column chunks are read
+   * @param raw_page_data Output buffers holding the chunk data
+   * @param chunks Descriptors of the column chunks, updated to point to the read data
+   * @param read_stream CUDA stream used to copy the chunk data to the device
    *
    * @return pair of boolean indicating if compressed chunks were found and a vector of futures for
    * read completion
    */
-  std::pair<bool, std::vector<std::future<void>>> read_column_chunks();
+  std::pair<bool, std::vector<std::future<void>>> read_column_chunks(
+    host_span<row_group_info const> row_groups,
+    std::vector<std::unique_ptr<datasource::buffer>>& raw_page_data,
+    host_span<ColumnChunkDesc> chunks,
+    rmm::cuda_stream_view read_stream);
+
+  /**
+   * @brief Start reading the column chunks of the pass following the current one in the
+   * background, if there is one.
+   *
+   * The result is picked up by `read_compressed_data()` once that pass is set up.
+   */
+  void prefetch_next_pass();
 
   /**
    * @brief Read compressed data and page information for the current pass.
@@ -269,6 +298,42 @@ class reader::impl {
   table_with_metadata finalize_output(table_metadata& out_metadata,
                                       std::vector<std::unique_ptr<column>>& out_columns);
 
+  /**
+   * @brief Finds the top-level string output columns whose column chunks all have a dictionary
+   * page in the selected row groups.
+   *
+   * These are the columns returned as dictionary columns when the option is enabled.
+   */
+  void select_dictionary_columns();
+
+  /**
+   * @brief Encodes the output columns selected by `select_dictionary_columns()` as dictionaries.
+   *
+   * @param output The output table, without the columns only used by the filter
+   * @return The output table with the selected string columns dictionary encoded
+   */
+  std::unique_ptr<table> encode_dictionary_columns(std::unique_ptr<table> output);
+
+  /**
+   * @brief Returns the memory resource used to allocate the given output column.
+   *
+   * @param output_column_idx Index of the output column
+   * @return The resource set for the column in the options, or the resource of the read
+   */
+  [[nodiscard]] rmm::device_async_resource_ref output_mr(std::size_t output_column_idx) const
+  {
+    return output_column_idx < _output_mrs.size() ? _output_mrs[output_column_idx] : _mr;
+  }
+
+  /**
+   * @brief Keeps the rows of the output columns passing the filter.
+   *
+   * @param output The output columns, without the columns only used by the filter
+   * @param predicate Boolean column of the rows to keep
+   * @return The filtered output columns, each allocated with its `output_mr()`
+   */
+  std::unique_ptr<table> filter_output(table_view const& output, column_view const& predicate);
+
   /**
    * @brief Allocate data buffers for the output columns.
    *
@@ -343,6 +408,8 @@ class reader::impl {
 
   rmm::cuda_stream_view _stream;
   rmm::device_async_resource_ref _mr{rmm::mr::get_current_device_resource()};
+  // memory resource of each output column; `_mr` is used for all if empty
+  std::vector<rmm::device_async_resource_ref> _output_mrs;
 
   // Reader configs.
   struct {
@@ -357,6 +424,9 @@ class reader::impl {
   // name to reference converter to extract AST output filter
   named_to_reference_converter _expr_conv{std::nullopt, table_metadata{}};
 
+  // Options to create the phase readers with, set only if late materialization is used
+  std::optional<parquet_reader_options> _late_materialization_options;
+
   std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<aggregate_reader_metadata> _metadata;
 
@@ -380,6 +450,11 @@ class reader::impl {
 
   bool _strings_to_categorical = false;
 
+  // whether dictionary-encoded string columns are returned as dictionary columns, and which
+  // output columns are
+  bool _dictionary_string_columns = false;
+  std::vector<bool> _dictionary_output_columns;
+
   // are there usable page indexes available
   bool _has_page_index = false;
 
@@ -399,8 +474,19 @@ class reader::impl {
 
   std::unique_ptr<pass_intermediate_data> _pass_itm_data;
 
+  // whether the next pass is read while the current one is decoded
+  bool _prefetch_next_pass{false};
+
+  // compressed data of the next pass being read in the background. declared after the sources
+  // and metadata so that any read still in flight is waited on before they are destroyed.
+  std::unique_ptr<prefetched_pass_data> _prefetched_pass;
+
   std::size_t _output_chunk_read_limit{0};  // output chunk size limit in bytes
   std::size_t _input_pass_read_limit{0};    // input pass memory usage limit in bytes
+
+  // statistics of the work done since the last chunk was returned, and where to report them
+  reader_chunk_statistics _chunk_stats;
+  std::shared_ptr<reader_chunk_statistics> _chunk_stats_output;
 };
 
 }  // namespace cudf::io::parquet::detail
@@ -16,7 +16,9 @@
 
 #include "compact_protocol_reader.hpp"
 #include "io/comp/nvcomp_adapter.hpp"
+#include "io/comp/size_buckets.hpp"
 #include "io/utilities/config_utils.hpp"
+#include "io/utilities/stage_range.hpp"
 #include "io/utilities/time_utils.cuh"
 #include "reader_impl.hpp"
 #include "reader_impl_chunking.hpp"
@@ -727,6 +729,7 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
  * @param pages List of page information
  * @param dict_pages If true, decompress dictionary pages only. Otherwise decompress non-dictionary
  * pages only.
+ * @param stats Chunk statistics to which the compressed and decompressed sizes are added
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return Device buffer to decompressed page data
@@ -735,6 +738,7 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
   cudf::detail::hostdevice_span<ColumnChunkDesc const> chunks,
   cudf::detail::hostdevice_span<PageInfo> pages,
   bool dict_pages,
+  reader_chunk_statistics& stats,
   rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
@@ -754,13 +758,12 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
 
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
+  size_t total_comp_size   = 0;
   size_t total_decomp_size = 0;
 
   struct codec_stats {
-    Compression compression_type  = UNCOMPRESSED;
-    size_t num_pages              = 0;
-    int32_t max_decompressed_size = 0;
-    size_t total_decomp_size      = 0;
+    Compression compression_type = UNCOMPRESSED;
+    size_t num_pages             = 0;
   };
 
   std::array codecs{codec_stats{GZIP},
@@ -785,9 +788,8 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
       auto page_uncomp_size = pages[page].uncompressed_page_size;
+      total_comp_size += pages[page].compressed_page_size;
       total_decomp_size += page_uncomp_size;
-      codec.total_decomp_size += page_uncomp_size;
-      codec.max_decompressed_size = std::max(codec.max_decompressed_size, page_uncomp_size);
       codec.num_pages++;
       num_comp_pages++;
     });
@@ -818,43 +820,22 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                comp_res.end(),
                compression_result{0, compression_status::FAILURE});
 
-  size_t decomp_offset = 0;
-  int32_t start_pos    = 0;
-  for (auto const& codec : codecs) {
-    if (codec.num_pages == 0) { continue; }
-
-    for_each_codec_page(codec.compression_type, [&](size_t page_idx) {
-      auto const dst_base = static_cast<uint8_t*>(decomp_pages.data()) + decomp_offset;
-      auto& page          = pages[page_idx];
-      // offset will only be non-zero for V2 pages
-      auto const offset =
-        page.lvl_bytes[level_type::DEFINITION] + page.lvl_bytes[level_type::REPETITION];
-      // for V2 need to copy def and rep level info into place, and then offset the
-      // input and output buffers. otherwise we'd have to keep both the compressed
-      // and decompressed data.
-      if (offset != 0) {
-        copy_in.emplace_back(page.page_data, offset);
-        copy_out.emplace_back(dst_base, offset);
-      }
-      comp_in.emplace_back(page.page_data + offset,
-                           static_cast<size_t>(page.compressed_page_size - offset));
-      comp_out.emplace_back(dst_base + offset,
-                            static_cast<size_t>(page.uncompressed_page_size - offset));
-      page.page_data = dst_base;
-      decomp_offset += page.uncompressed_page_size;
-    });
-
+  // Dispatches the pages in [start_pos, start_pos + num_pages) of `comp_in` to the decompressor
+  auto decompress_batch = [&](Compression compression,
+                              size_t start_pos,
+                              size_t num_pages,
+                              size_t max_decomp_size,
+                              size_t total_decomp_size) {
     host_span<device_span<uint8_t const> const> comp_in_view{comp_in.data() + start_pos,
-                                                             codec.num_pages};
+                                                             num_pages};
     auto const d_comp_in = cudf::detail::make_device_uvector_async(
       comp_in_view, stream, rmm::mr::get_current_device_resource());
-    host_span<device_span<uint8_t> const> comp_out_view(comp_out.data() + start_pos,
-                                                        codec.num_pages);
+    host_span<device_span<uint8_t> const> comp_out_view(comp_out.data() + start_pos, num_pages);
     auto const d_comp_out = cudf::detail::make_device_uvector_async(
       comp_out_view, stream, rmm::mr::get_current_device_resource());
-    device_span<compression_result> d_comp_res_view(comp_res.data() + start_pos, codec.num_pages);
+    device_span<compression_result> d_comp_res_view(comp_res.data() + start_pos, num_pages);
 
-    switch (codec.compression_type) {
+    switch (compression) {
       case GZIP:
         gpuinflate(d_comp_in, d_comp_out, d_comp_res_view, gzip_header_included::YES, stream);
         break;
@@ -864,21 +845,25 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                                      d_comp_in,
                                      d_comp_out,
                                      d_comp_res_view,
-                                     codec.max_decompressed_size,
-                                     codec.total_decomp_size,
+                                     max_decomp_size,
+                                     total_decomp_size,
                                      stream);
         } else {
           gpu_unsnap(d_comp_in, d_comp_out, d_comp_res_view, stream);
         }
         break;
       case ZSTD:
-        nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                                   d_comp_in,
-                                   d_comp_out,
-                                   d_comp_res_view,
-                                   codec.max_decompressed_size,
-                                   codec.total_decomp_size,
-                                   stream);
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+          gpu_unzstd(d_comp_in, d_comp_out, d_comp_res_view, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                                     d_comp_in,
+                                     d_comp_out,
+                                     d_comp_res_view,
+                                     max_decomp_size,
+                                     total_decomp_size,
+                                     stream);
+        }
         break;
       case BROTLI:
         gpu_debrotli(d_comp_in,
@@ -889,17 +874,71 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                      stream);
         break;
       case LZ4_RAW:
-        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
-                                   d_comp_in,
-                                   d_comp_out,
-                                   d_comp_res_view,
-                                   codec.max_decompressed_size,
-                                   codec.total_decomp_size,
-                                   stream);
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4)) {
+          gpu_unlz4(d_comp_in, d_comp_out, d_comp_res_view, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     d_comp_in,
+                                     d_comp_out,
+                                     d_comp_res_view,
+                                     max_decomp_size,
+                                     total_decomp_size,
+                                     stream);
+        }
         break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
-    start_pos += codec.num_pages;
+  };
+
+  size_t decomp_offset = 0;
+  size_t start_pos     = 0;
+  for (auto const& codec : codecs) {
+    if (codec.num_pages == 0) { continue; }
+
+    std::vector<size_t> codec_pages;
+    codec_pages.reserve(codec.num_pages);
+    std::vector<size_t> codec_page_sizes;
+    codec_page_sizes.reserve(codec.num_pages);
+    for_each_codec_page(codec.compression_type, [&](size_t page_idx) {
+      codec_pages.push_back(page_idx);
+      codec_page_sizes.push_back(pages[page_idx].uncompressed_page_size);
+    });
+
+    // Decompress pages of similar size together, so that a few large pages do not hold up the
+    // batch of small pages, and the batch resources are sized for the pages in the batch
+    auto const buckets = bucket_chunks_by_size(codec_page_sizes);
+    for (size_t b = 0; b < num_chunk_size_buckets; ++b) {
+      auto const bucket_size = buckets.size(static_cast<chunk_size_bucket>(b));
+      if (bucket_size == 0) { continue; }
+
+      for (auto i = buckets.offsets[b]; i < buckets.offsets[b + 1]; ++i) {
+        auto& page          = pages[codec_pages[buckets.chunks[i]]];
+        auto const dst_base = static_cast<uint8_t*>(decomp_pages.data()) + decomp_offset;
+        // offset will only be non-zero for V2 pages
+        auto const offset =
+          page.lvl_bytes[level_type::DEFINITION] + page.lvl_bytes[level_type::REPETITION];
+        // for V2 need to copy def and rep level info into place, and then offset the
+        // input and output buffers. otherwise we'd have to keep both the compressed
+        // and decompressed data.
+        if (offset != 0) {
+          copy_in.emplace_back(page.page_data, offset);
+          copy_out.emplace_back(dst_base, offset);
+        }
+        comp_in.emplace_back(page.page_data + offset,
+                             static_cast<size_t>(page.compressed_page_size - offset));
+        comp_out.emplace_back(dst_base + offset,
+                              static_cast<size_t>(page.uncompressed_page_size - offset));
+        page.page_data = dst_base;
+        decomp_offset += page.uncompressed_page_size;
+      }
+
+      decompress_batch(codec.compression_type,
+                       start_pos,
+                       bucket_size,
+                       buckets.max_uncomp_size[b],
+                       buckets.total_uncomp_size[b]);
+      start_pos += bucket_size;
+    }
   }
 
   CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
@@ -923,6 +962,9 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
 
   pages.host_to_device_async(stream);
 
+  stats.num_compressed_bytes += total_comp_size;
+  stats.num_decompressed_bytes += total_decomp_size;
+
   stream.synchronize();
   return decomp_pages;
 }
@@ -1080,12 +1122,20 @@ struct get_decomp_scratch {
         break;
 
       case ZSTD:
+        if (cudf::io::nvcomp::is_decompression_disabled(
+              cudf::io::nvcomp::compression_type::ZSTD)) {
+          return 0;
+        }
         return cudf::io::nvcomp::batched_decompress_temp_size(
           cudf::io::nvcomp::compression_type::ZSTD,
           di.num_pages,
           di.max_page_decompressed_size,
           di.total_decompressed_size);
       case LZ4_RAW:
+        if (cudf::io::nvcomp::is_decompression_disabled(
+              cudf::io::nvcomp::compression_type::LZ4)) {
+          return 0;
+        }
         return cudf::io::nvcomp::batched_decompress_temp_size(
           cudf::io::nvcomp::compression_type::LZ4,
           di.num_pages,
@@ -1191,6 +1241,7 @@ void reader::impl::handle_chunking(read_mode mode)
 
 void reader::impl::setup_next_pass(read_mode mode)
 {
+  cudf::scoped_range range{"parquet::reader::setup_next_pass"};
   auto const num_passes = _file_itm_data.num_passes();
 
   // always create the pass struct, even if we end up with no work.
@@ -1265,7 +1316,9 @@ void reader::impl::setup_next_pass(read_mode mode)
 
     // decompress dictionary data if applicable.
     if (pass.has_compressed_data) {
-      pass.decomp_dict_data = decompress_page_data(pass.chunks, pass.pages, true, _stream);
+      io::detail::stage_range stage{"decompress dictionary pages", _chunk_stats.decompress_time};
+      pass.decomp_dict_data =
+        decompress_page_data(pass.chunks, pass.pages, true, _chunk_stats, _stream);
     }
 
     // store off how much memory we've used so far. This includes the compressed page data and the
@@ -1276,6 +1329,8 @@ void reader::impl::setup_next_pass(read_mode mode)
     pass.base_mem_size =
       pass.decomp_dict_data.size() +
       thrust::reduce(rmm::exec_policy(_stream), chunk_iter, chunk_iter + pass.chunks.size());
+    _chunk_stats.peak_temp_memory_bytes =
+      std::max(_chunk_stats.peak_temp_memory_bytes, pass.base_mem_size);
 
     // since there is only ever 1 dictionary per chunk (the first page), do it at the
     // pass level.
@@ -1306,11 +1361,15 @@ void reader::impl::setup_next_pass(read_mode mode)
 #endif
 
     _stream.synchronize();
+
+    // start reading the next pass while this one is decoded
+    if (_prefetch_next_pass) { prefetch_next_pass(); }
   }
 }
 
 void reader::impl::setup_next_subpass(read_mode mode)
 {
+  cudf::scoped_range range{"parquet::reader::setup_next_subpass"};
   auto& pass    = *_pass_itm_data;
   pass.subpass  = std::make_unique<subpass_intermediate_data>();
   auto& subpass = *pass.subpass;
@@ -1428,8 +1487,12 @@ void reader::impl::setup_next_subpass(read_mode mode)
 
   // decompress the data for the pages in this subpass.
   if (pass.has_compressed_data) {
-    subpass.decomp_page_data = decompress_page_data(pass.chunks, subpass.pages, false, _stream);
+    io::detail::stage_range stage{"decompress data pages", _chunk_stats.decompress_time};
+    subpass.decomp_page_data =
+      decompress_page_data(pass.chunks, subpass.pages, false, _chunk_stats, _stream);
   }
+  _chunk_stats.peak_temp_memory_bytes = std::max(
+    _chunk_stats.peak_temp_memory_bytes, pass.base_mem_size + subpass.decomp_page_data.size());
 
   // buffers needed by the decode kernels
   {
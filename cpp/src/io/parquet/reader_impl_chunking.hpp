@@ -20,6 +20,8 @@
 
 #include <cudf/types.hpp>
 
+#include <future>
+
 namespace cudf::io::parquet::detail {
 
 /**
@@ -139,4 +141,24 @@ struct pass_intermediate_data {
   std::unique_ptr<subpass_intermediate_data> subpass{};
 };
 
+/**
+ * @brief Struct to store the compressed data of a pass that is read ahead of time.
+ *
+ * The data is read on a background thread while the previous pass is being decoded.
+ * The chunk descriptors are a copy of the pass' entries in `file_intermediate_data::chunks`
+ * whose `compressed_data` point into `raw_page_data` once `ready` completes.
+ */
+struct prefetched_pass_data {
+  // index of the prefetched pass
+  size_t pass_idx{0};
+
+  std::vector<std::unique_ptr<datasource::buffer>> raw_page_data;
+  std::vector<ColumnChunkDesc> chunks;
+  bool has_compressed_data{false};
+
+  // completes once all chunk data is in device memory. declared last so that it is destroyed
+  // (and thus waited on) before the buffers being read into.
+  std::future<void> ready;
+};
+
 }  // namespace cudf::io::parquet::detail
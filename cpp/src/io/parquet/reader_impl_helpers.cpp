@@ -17,8 +17,10 @@
 #include "reader_impl_helpers.hpp"
 
 #include "compact_protocol_reader.hpp"
+#include "metadata_cache.hpp"
 #include "io/parquet/parquet.hpp"
 #include "io/utilities/base64_utilities.hpp"
+#include "io/utilities/config_utils.hpp"
 #include "io/utilities/row_selection.hpp"
 #include "ipc/Message_generated.h"
 #include "ipc/Schema_generated.h"
@@ -27,6 +29,7 @@
 #include <thrust/iterator/zip_iterator.h>
 
 #include <functional>
+#include <future>
 #include <numeric>
 #include <regex>
 
@@ -279,7 +282,7 @@ void metadata::sanitize_schema()
   process(0);
 }
 
-metadata::metadata(datasource* source)
+metadata::metadata(datasource* source, bool has_filter)
 {
   constexpr auto header_len = sizeof(file_header_s);
   constexpr auto ender_len  = sizeof(file_ender_s);
@@ -299,9 +302,11 @@ metadata::metadata(datasource* source)
   CompactProtocolReader cp(buffer->data(), ender->footer_len);
   cp.read(this);
   CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+  serialized_size = ender->footer_len;
 
-  // Reading the page indexes is somewhat expensive, so skip if there are no byte array columns.
-  // Currently the indexes are only used for the string size calculations.
+  // Reading the page indexes is somewhat expensive, so skip if there are no byte array columns
+  // and no filter. The indexes are used for the string size calculations and for page-level
+  // predicate pushdown.
   // Could also just read indexes for string columns, but that would require changes elsewhere
   // where we're trying to determine if we have the indexes or not.
   // Note: This will have to be modified if there are other uses in the future (e.g. calculating
@@ -309,7 +314,8 @@ metadata::metadata(datasource* source)
   auto const has_strings = std::any_of(
     schema.begin(), schema.end(), [](auto const& elem) { return elem.type == BYTE_ARRAY; });
 
-  if (has_strings and not row_groups.empty() and not row_groups.front().columns.empty()) {
+  page_indexes_read = has_strings or has_filter;
+  if (page_indexes_read and not row_groups.empty() and not row_groups.front().columns.empty()) {
     // column index and offset index are encoded back to back.
     // the first column of the first row group will have the first column index, the last
     // column of the last row group will have the final offset index.
@@ -320,6 +326,7 @@ metadata::metadata(datasource* source)
     if (max_offset > 0) {
       int64_t const length = max_offset - min_offset;
       auto const idx_buf   = source->host_read(min_offset, length);
+      serialized_size += length;
 
       // now loop over row groups
       for (auto& rg : row_groups) {
@@ -347,13 +354,40 @@ metadata::metadata(datasource* source)
 }
 
 std::vector<metadata> aggregate_reader_metadata::metadatas_from_sources(
-  host_span<std::unique_ptr<datasource> const> sources)
+  host_span<std::unique_ptr<datasource> const> sources,
+  bool has_filter,
+  parquet_metadata_cache* cache,
+  host_span<std::string const> cache_keys)
 {
+  auto const read_metadata = [&](std::size_t src_idx) {
+    auto const use_cache =
+      cache != nullptr and src_idx < cache_keys.size() and not cache_keys[src_idx].empty();
+    if (use_cache) {
+      if (auto const cached = cache->_impl->find(cache_keys[src_idx], has_filter); cached) {
+        return metadata(*cached);
+      }
+    }
+    auto meta = metadata(sources[src_idx].get(), has_filter);
+    if (use_cache) { cache->_impl->insert(cache_keys[src_idx], std::make_shared<metadata>(meta)); }
+    return meta;
+  };
+
   std::vector<metadata> metadatas;
-  std::transform(
-    sources.begin(), sources.end(), std::back_inserter(metadatas), [](auto const& source) {
-      return metadata(source.get());
-    });
+  if (sources.size() == 1) {
+    metadatas.emplace_back(read_metadata(0));
+    return metadatas;
+  }
+
+  // Footer reads are small and latency bound, so fetch and parse them concurrently
+  std::vector<std::future<metadata>> tasks;
+  tasks.reserve(sources.size());
+  for (std::size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+    tasks.emplace_back(host_io_thread_pool().submit(read_metadata, src_idx));
+  }
+  metadatas.reserve(tasks.size());
+  for (auto& task : tasks) {
+    metadatas.emplace_back(task.get());
+  }
   return metadatas;
 }
 
@@ -537,8 +571,12 @@ void aggregate_reader_metadata::column_info_for_row_group(row_group_info& rg_inf
 }
 
 aggregate_reader_metadata::aggregate_reader_metadata(
-  host_span<std::unique_ptr<datasource> const> sources, bool use_arrow_schema)
-  : per_file_metadata(metadatas_from_sources(sources)),
+  host_span<std::unique_ptr<datasource> const> sources,
+  bool use_arrow_schema,
+  bool has_filter,
+  parquet_metadata_cache* cache,
+  host_span<std::string const> cache_keys)
+  : per_file_metadata(metadatas_from_sources(sources, has_filter, cache, cache_keys)),
     keyval_maps(collect_keyval_metadata()),
     num_rows(calc_num_rows()),
     num_row_groups(calc_num_row_groups())
@@ -952,6 +990,7 @@ std::vector<std::string> aggregate_reader_metadata::get_pandas_index_names() con
 
 std::tuple<int64_t, size_type, std::vector<row_group_info>>
 aggregate_reader_metadata::select_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   int64_t skip_rows_opt,
   std::optional<size_type> const& num_rows_opt,
@@ -961,14 +1000,60 @@ aggregate_reader_metadata::select_row_groups(
   rmm::cuda_stream_view stream) const
 {
   std::optional<std::vector<std::vector<size_type>>> filtered_row_group_indices;
+  // rows to skip and read within the selected row groups after page-level predicate pushdown
+  std::optional<std::pair<int64_t, size_type>> page_filtered_rows;
   // if filter is not empty, then gather row groups to read after predicate pushdown
   if (filter.has_value()) {
     filtered_row_group_indices = filter_row_groups(
-      row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
+      sources, row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
     if (filtered_row_group_indices.has_value()) {
       row_group_indices =
         host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
     }
+
+    // refine with the page indexes, if present
+    std::vector<std::vector<size_type>> all_row_group_indices;
+    auto const input_row_group_indices = [&]() {
+      if (not row_group_indices.empty()) { return row_group_indices; }
+      std::transform(per_file_metadata.cbegin(),
+                     per_file_metadata.cend(),
+                     std::back_inserter(all_row_group_indices),
+                     [](auto const& file_meta) {
+                       std::vector<size_type> rg_idx(file_meta.row_groups.size());
+                       std::iota(rg_idx.begin(), rg_idx.end(), 0);
+                       return rg_idx;
+                     });
+      return host_span<std::vector<size_type> const>(all_row_group_indices);
+    }();
+    auto const page_row_ranges = filter_pages(
+      input_row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
+    if (page_row_ranges.has_value()) {
+      // drop the row groups without any surviving pages
+      std::vector<std::vector<size_type>> page_filtered_row_group_indices;
+      int64_t first_row = -1;
+      int64_t last_row  = 0;
+      int64_t num_rows  = 0;
+      size_t rg_pos     = 0;
+      for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+        std::vector<size_type> filtered_row_groups;
+        for (auto const rg_idx : input_row_group_indices[src_idx]) {
+          auto const& ranges = page_row_ranges.value()[rg_pos++];
+          if (ranges.empty()) { continue; }
+          filtered_row_groups.push_back(rg_idx);
+          if (first_row < 0) { first_row = num_rows + ranges.front().first; }
+          last_row = num_rows + ranges.back().second;
+          num_rows += get_row_group(rg_idx, src_idx).num_rows;
+        }
+        page_filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+      }
+      filtered_row_group_indices = std::move(page_filtered_row_group_indices);
+      row_group_indices = host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
+      // Rows outside the surviving pages never pass the filter, so skip them when the caller
+      // doesn't restrict the rows to read.
+      if (skip_rows_opt == 0 and not num_rows_opt.has_value() and first_row >= 0) {
+        page_filtered_rows = {first_row, static_cast<size_type>(last_row - first_row)};
+      }
+    }
   }
   std::vector<row_group_info> selection;
   auto [rows_to_skip, rows_to_read] = [&]() {
@@ -1015,6 +1100,10 @@ aggregate_reader_metadata::select_row_groups(
     }
   }
 
+  if (page_filtered_rows.has_value()) {
+    std::tie(rows_to_skip, rows_to_read) = page_filtered_rows.value();
+  }
+
   return {rows_to_skip, rows_to_read, std::move(selection)};
 }
 
@@ -1282,4 +1371,12 @@ aggregate_reader_metadata::select_columns(
     std::move(input_columns), std::move(output_columns), std::move(output_column_schemas));
 }
 
+cudf::detail::thread_pool& host_io_thread_pool()
+{
+  constexpr std::size_t default_thread_count = 8;
+  static cudf::detail::thread_pool pool(
+    cudf::io::detail::getenv_or("LIBCUDF_PARQUET_READER_THREAD_COUNT", default_thread_count));
+  return pool;
+}
+
 }  // namespace cudf::io::parquet::detail
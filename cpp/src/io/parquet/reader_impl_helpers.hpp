@@ -22,7 +22,9 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/parquet.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/thread_pool.hpp>
 
 #include <list>
 #include <tuple>
@@ -67,6 +69,11 @@ struct column_chunk_info {
   }
 };
 
+/**
+ * @brief Half-open range of rows [first, second) relative to the start of a row group
+ */
+using page_row_range = std::pair<int64_t, int64_t>;
+
 /**
  * @brief The row_group_info class
  */
@@ -113,8 +120,19 @@ struct row_group_info {
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource* source);
+  /**
+   * @brief Parses the footer of the source
+   *
+   * @param source Data source of the file
+   * @param has_filter Whether a filter will be applied; the page indexes are always read if so
+   */
+  metadata(datasource* source, bool has_filter);
   void sanitize_schema();
+
+  // whether the page indexes were read, if present
+  bool page_indexes_read{false};
+  // number of footer and page index bytes parsed
+  std::size_t serialized_size{0};
 };
 
 struct arrow_schema_data_types {
@@ -131,9 +149,14 @@ class aggregate_reader_metadata {
 
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Sources with a non-empty key are looked up in, and added to, `cache` if one is given.
    */
   static std::vector<metadata> metadatas_from_sources(
-    host_span<std::unique_ptr<datasource> const> sources);
+    host_span<std::unique_ptr<datasource> const> sources,
+    bool has_filter,
+    parquet_metadata_cache* cache,
+    host_span<std::string const> cache_keys);
 
   /**
    * @brief Collect the keyvalue maps from each per-file metadata object into a vector of maps.
@@ -180,7 +203,10 @@ class aggregate_reader_metadata {
 
  public:
   aggregate_reader_metadata(host_span<std::unique_ptr<datasource> const> sources,
-                            bool use_arrow_schema);
+                            bool use_arrow_schema,
+                            bool has_filter,
+                            parquet_metadata_cache* cache           = nullptr,
+                            host_span<std::string const> cache_keys = {});
 
   [[nodiscard]] RowGroup const& get_row_group(size_type row_group_index, size_type src_idx) const;
 
@@ -252,6 +278,10 @@ class aggregate_reader_metadata {
   /**
    * @brief Filters the row groups based on predicate filter
    *
+   * Row groups are first pruned using Column chunk statistics, and the survivors are then pruned
+   * using the split block bloom filters of the column chunks referenced by equality predicates.
+   *
+   * @param sources Dataset sources, used to read the bloom filters
    * @param row_group_indices Lists of row groups to read, one per source
    * @param output_dtypes Datatypes of of output columns
    * @param output_column_schemas schema indices of output columns
@@ -260,6 +290,50 @@ class aggregate_reader_metadata {
    * @return Filtered row group indices, if any is filtered.
    */
   [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Filters the row groups using the bloom filters of their column chunks
+   *
+   * Only `column == literal` predicates combined with `LOGICAL_AND` / `LOGICAL_OR` are used for
+   * pruning; all other sub-expressions are treated as possibly true.
+   *
+   * @param sources Dataset sources, used to read the bloom filters
+   * @param input_row_group_indices Lists of row groups to consider, one per source
+   * @param output_dtypes Datatypes of of output columns
+   * @param output_column_schemas schema indices of output columns
+   * @param filter AST expression with column index references
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> apply_bloom_filters(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> input_row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Filters the pages of the row groups based on predicate filter using the page indexes
+   *
+   * Each row group is split into fragments at the page boundaries of the output columns, and the
+   * filter is evaluated against the page-level min/max values from the column indexes.
+   *
+   * @param row_group_indices Lists of row groups to consider, one per source
+   * @param output_dtypes Datatypes of of output columns
+   * @param output_column_schemas schema indices of output columns
+   * @param filter AST expression to filter pages based on page statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return For each input row group in order, the row ranges that may satisfy the filter, if
+   *         any page fragment is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<page_row_range>>> filter_pages(
     host_span<std::vector<size_type> const> row_group_indices,
     host_span<data_type const> output_dtypes,
     host_span<int const> output_column_schemas,
@@ -272,6 +346,7 @@ class aggregate_reader_metadata {
    * The input `row_start` and `row_count` parameters will be recomputed and output as the valid
    * values based on the input row group list.
    *
+   * @param sources Dataset sources, used to read the bloom filters when `filter` is set
    * @param row_group_indices Lists of row groups to read, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
@@ -283,6 +358,7 @@ class aggregate_reader_metadata {
    *         starting row
    */
   [[nodiscard]] std::tuple<int64_t, size_type, std::vector<row_group_info>> select_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
     host_span<std::vector<size_type> const> row_group_indices,
     int64_t row_start,
     std::optional<size_type> const& row_count,
@@ -374,4 +450,22 @@ class named_to_reference_converter : public ast::detail::expression_transformer
   std::optional<std::reference_wrapper<ast::expression const>> expr,
   std::vector<std::string> const& skip_names);
 
+/**
+ * @brief Check whether an expression references any column by its index
+ *
+ * @param expr The expression object to check
+ * @return `true` if the expression contains a `column_reference`
+ */
+[[nodiscard]] bool has_column_index_references(ast::expression const& expr);
+
+/**
+ * @brief Returns the thread pool used to parse footers and read column chunks of multiple
+ * sources in parallel
+ *
+ * The pool size can be set with the `LIBCUDF_PARQUET_READER_THREAD_COUNT` environment variable.
+ *
+ * @return The shared thread pool
+ */
+[[nodiscard]] cudf::detail::thread_pool& host_io_thread_pool();
+
 }  // namespace cudf::io::parquet::detail
@@ -15,11 +15,13 @@
  */
 
 #include "error.hpp"
+#include "io/utilities/stage_range.hpp"
 #include "reader_impl.hpp"
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 
 #include <rmm/exec_policy.hpp>
@@ -41,7 +43,9 @@
 #include <thrust/transform_scan.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
 #include <bitset>
+#include <map>
 #include <numeric>
 
 namespace cudf::io::parquet::detail {
@@ -203,19 +207,37 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
  * @param column_chunk_offsets File offset for all chunks
  * @param chunk_source_map Association between each column chunk and its source
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param read_stream CUDA stream used to copy the chunk data to the device
  *
  * @return A future object for reading synchronization
  */
 [[nodiscard]] std::future<void> read_column_chunks_async(
   std::vector<std::unique_ptr<datasource>> const& sources,
   std::vector<std::unique_ptr<datasource::buffer>>& page_data,
-  cudf::detail::hostdevice_vector<ColumnChunkDesc>& chunks,
+  host_span<ColumnChunkDesc> chunks,
   size_t begin_chunk,
   size_t end_chunk,
   std::vector<size_t> const& column_chunk_offsets,
   std::vector<size_type> const& chunk_source_map,
-  rmm::cuda_stream_view stream)
+  rmm::cuda_stream_view stream,
+  rmm::cuda_stream_view read_stream)
 {
+  // Buffers are allocated on `stream`, so any copy on a different stream must wait for the work
+  // already enqueued on `stream` that may still use the allocated memory
+  auto const order_after_allocation = [&]() {
+    if (read_stream.value() != stream.value()) {
+      cudf::detail::join_streams(std::vector<rmm::cuda_stream_view>{stream}, read_stream);
+    }
+  };
+
+  // Host reads to issue, per source
+  struct host_read_info {
+    size_t offset;
+    size_t size;
+    uint8_t* dst;
+  };
+  std::map<size_type, std::vector<host_read_info>> host_reads;
+
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
@@ -243,18 +265,19 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
         // Required by `gpuDecodePageData`.
         auto buffer =
           rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE), stream);
+        order_after_allocation();
         auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
+          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), read_stream);
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
       } else {
-        auto const read_buffer = source->host_read(io_offset, io_size);
         // Buffer needs to be padded.
         // Required by `gpuDecodePageData`.
-        auto tmp_buffer = rmm::device_buffer(
-          cudf::util::round_up_safe(read_buffer->size(), BUFFER_PADDING_MULTIPLE), stream);
-        CUDF_CUDA_TRY(cudaMemcpyAsync(
-          tmp_buffer.data(), read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
+        auto tmp_buffer =
+          rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE), stream);
+        order_after_allocation();
+        host_reads[chunk_source_map[chunk]].push_back(
+          {io_offset, io_size, static_cast<uint8_t*>(tmp_buffer.data())});
         page_data[chunk] = datasource::buffer::create(std::move(tmp_buffer));
       }
       auto d_compdata = page_data[chunk]->data();
@@ -266,9 +289,59 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
       chunk = next_chunk;
     }
   }
+
+  auto read_to_device = [read_stream](datasource* source,
+                                      std::vector<host_read_info> const& reads) {
+    // Stage all ranges of the source in host memory with a single vectored read, so that the
+    // source can coalesce nearby chunks that are not exactly adjacent
+    std::vector<datasource::read_range> ranges;
+    std::vector<size_t> staging_offsets;
+    size_t staging_size = 0;
+    for (auto const& read : reads) {
+      ranges.push_back({read.offset, read.size});
+      staging_offsets.push_back(staging_size);
+      staging_size += read.size;
+    }
+    std::vector<uint8_t> staging(staging_size);
+    std::vector<uint8_t*> staging_ptrs;
+    std::transform(staging_offsets.begin(),
+                   staging_offsets.end(),
+                   std::back_inserter(staging_ptrs),
+                   [&](auto offset) { return staging.data() + offset; });
+    auto const bytes_read = source->host_read_ranges(ranges, staging_ptrs);
+
+    size_t total_size = 0;
+    for (size_t i = 0; i < reads.size(); ++i) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        reads[i].dst, staging_ptrs[i], bytes_read[i], cudaMemcpyDefault, read_stream));
+      total_size += bytes_read[i];
+    }
+    return total_size;
+  };
+  if (host_reads.size() == 1) {
+    auto const& [source_idx, reads] = *host_reads.begin();
+    read_to_device(sources[source_idx].get(), reads);
+  } else if (host_reads.size() > 1) {
+    // Reads of different sources are independent, so issue them concurrently to avoid paying the
+    // latency of each of many small files in turn. Reads of a single source stay sequential.
+    int device_id{};
+    CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+    for (auto& [source_idx, reads] : host_reads) {
+      auto read_source = [device_id,
+                          read_to_device,
+                          source = sources[source_idx].get(),
+                          reads  = std::move(reads)]() {
+        CUDF_CUDA_TRY(cudaSetDevice(device_id));
+        return read_to_device(source, reads);
+      };
+      read_tasks.emplace_back(host_io_thread_pool().submit(read_source));
+    }
+  }
+
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
-      task.wait();
+      // rethrows any error raised by the read
+      task.get();
     }
   };
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
@@ -290,13 +363,15 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
   kernel_error error_code(stream);
   chunks.host_to_device_async(stream);
   DecodePageHeaders(chunks.device_ptr(), nullptr, chunks.size(), error_code.data(), stream);
-  chunks.device_to_host_sync(stream);
+  chunks.device_to_host_async(stream);
+  error_code.device_to_host_async(stream);
+  stream.synchronize();
 
   // It's required to ignore unsupported encodings in this function
   // so that we can actually compile a list of all the unsupported encodings found
   // in the pages. That cannot be done here since we do not have the pages vector here.
   // see https://github.com/rapidsai/cudf/pull/14453#pullrequestreview-1778346688
-  if (auto const error = error_code.value_sync(stream);
+  if (auto const error = error_code.value();
       error != 0 and error != static_cast<uint32_t>(decode_error::UNSUPPORTED_ENCODING)) {
     CUDF_FAIL("Parquet header parsing failed with code(s) while counting page headers " +
               kernel_error::to_string(error));
@@ -463,14 +538,17 @@ std::string encoding_to_string(Encoding encoding)
 /**
  * @brief Sort pages in chunk/schema order
  *
+ * Does not synchronize `stream`.
+ *
  * @param unsorted_pages The unsorted pages
  * @param chunks The chunks associated with the pages
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @returns The sorted vector of pages
+ * @returns The sorted vector of pages and the input column index of each sorted page
  */
-cudf::detail::hostdevice_vector<PageInfo> sort_pages(device_span<PageInfo const> unsorted_pages,
-                                                     device_span<ColumnChunkDesc const> chunks,
-                                                     rmm::cuda_stream_view stream)
+std::pair<cudf::detail::hostdevice_vector<PageInfo>, rmm::device_uvector<int32_t>> sort_pages(
+  device_span<PageInfo const> unsorted_pages,
+  device_span<ColumnChunkDesc const> chunks,
+  rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
 
@@ -523,22 +601,41 @@ cudf::detail::hostdevice_vector<PageInfo> sort_pages(device_span<PageInfo const>
     pass_pages.d_begin(),
     cuda::proclaim_return_type<PageInfo>([unsorted_pages = unsorted_pages.begin()] __device__(
                                            int32_t i) { return unsorted_pages[i]; }));
-  stream.synchronize();
-  return pass_pages;
+  return {std::move(pass_pages), std::move(page_keys)};
 }
 
 /**
  * @brief Decode the page information for a given pass.
  *
+ * All the work is enqueued on `stream` and synchronized once at the end, including the decode
+ * error check, so that the cost does not grow with the number of steps for passes made of many
+ * small pages.
+ *
  * @param pass_intermediate_data The struct containing pass information
+ * @param unsorted_pages Storage for the pages of all chunks in the pass
+ * @param has_page_index Whether the page information can be filled in from the page indexes
+ * @param num_columns Number of input columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
  */
 void decode_page_headers(pass_intermediate_data& pass,
                          device_span<PageInfo> unsorted_pages,
                          bool has_page_index,
+                         size_t num_columns,
                          rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
 
+  // the page offsets computed below assume that all input columns have pages. the page counts
+  // are already known on the host at this point.
+  std::vector<size_t> column_page_counts(num_columns, 0);
+  for (auto const& chunk : pass.chunks) {
+    column_page_counts[chunk.src_col_index] += chunk.num_data_pages + chunk.num_dict_pages;
+  }
+  CUDF_EXPECTS(std::all_of(column_page_counts.begin(),
+                           column_page_counts.end(),
+                           [](auto count) { return count > 0; }),
+               "Encountered page_offsets / num_columns mismatch");
+
   auto iter = thrust::make_counting_iterator(0);
   rmm::device_uvector<size_t> chunk_page_counts(pass.chunks.size() + 1, stream);
   thrust::transform_exclusive_scan(
@@ -563,6 +660,11 @@ void decode_page_headers(pass_intermediate_data& pass,
                      cpi[i].pages = &unsorted_pages[chunk_page_counts[i]];
                    });
 
+  // errors are only checked once all the work below is done, so make sure that pages whose
+  // headers fail to decode still refer to a valid chunk until then
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(unsorted_pages.data(), 0, unsorted_pages.size_bytes(), stream.value()));
+
   kernel_error error_code(stream);
   DecodePageHeaders(pass.chunks.d_begin(),
                     d_chunk_page_info.begin(),
@@ -570,56 +672,33 @@ void decode_page_headers(pass_intermediate_data& pass,
                     error_code.data(),
                     stream);
 
-  if (auto const error = error_code.value_sync(stream); error != 0) {
-    if (BitAnd(error, decode_error::UNSUPPORTED_ENCODING) != 0) {
-      auto const unsupported_str =
-        ". With unsupported encodings found: " + list_unsupported_encodings(pass.pages, stream);
-      CUDF_FAIL("Parquet header parsing failed with code(s) " + kernel_error::to_string(error) +
-                unsupported_str);
-    } else {
-      CUDF_FAIL("Parquet header parsing failed with code(s) " + kernel_error::to_string(error));
-    }
-  }
-
   if (has_page_index) { fill_in_page_info(pass.chunks, unsorted_pages, stream); }
 
-  // compute max bytes needed for level data
-  auto level_bit_size = cudf::detail::make_counting_transform_iterator(
-    0, cuda::proclaim_return_type<int>([chunks = pass.chunks.d_begin()] __device__(int i) {
-      auto c = chunks[i];
-      return static_cast<int>(
-        max(c.level_bits[level_type::REPETITION], c.level_bits[level_type::DEFINITION]));
-    }));
-  // max level data bit size.
-  int const max_level_bits = thrust::reduce(rmm::exec_policy(stream),
-                                            level_bit_size,
-                                            level_bit_size + pass.chunks.size(),
-                                            0,
-                                            thrust::maximum<int>());
-  pass.level_type_size     = std::max(1, cudf::util::div_rounding_up_safe(max_level_bits, 8));
+  // compute max bytes needed for level data. the level bits are known on the host.
+  auto const max_level_bits = std::accumulate(
+    pass.chunks.begin(), pass.chunks.end(), 0, [](int bits, ColumnChunkDesc const& c) {
+      return std::max({bits,
+                       static_cast<int>(c.level_bits[level_type::REPETITION]),
+                       static_cast<int>(c.level_bits[level_type::DEFINITION])});
+    });
+  pass.level_type_size = std::max(1, cudf::util::div_rounding_up_safe(max_level_bits, 8));
 
   // sort the pages in chunk/schema order.
-  pass.pages = sort_pages(unsorted_pages, pass.chunks, stream);
+  auto [sorted_pages, sorted_page_columns] = sort_pages(unsorted_pages, pass.chunks, stream);
+  pass.pages                               = std::move(sorted_pages);
 
-  // compute offsets to each group of input pages.
+  // compute offsets to each group of input pages. the pages are sorted by input column index,
+  // so the offsets are the positions of the first page of each column.
   // page_keys:   1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3
   //
   // result:      0,          4,          8
-  rmm::device_uvector<size_type> page_counts(pass.pages.size() + 1, stream);
-  auto page_keys             = make_page_key_iterator(pass.pages);
-  auto const page_counts_end = thrust::reduce_by_key(rmm::exec_policy(stream),
-                                                     page_keys,
-                                                     page_keys + pass.pages.size(),
-                                                     thrust::make_constant_iterator(1),
-                                                     thrust::make_discard_iterator(),
-                                                     page_counts.begin())
-                                 .second;
-  auto const num_page_counts = page_counts_end - page_counts.begin();
-  pass.page_offsets          = rmm::device_uvector<size_type>(num_page_counts + 1, stream);
-  thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
-                         page_counts.begin(),
-                         page_counts.begin() + num_page_counts + 1,
-                         pass.page_offsets.begin());
+  pass.page_offsets = rmm::device_uvector<size_type>(num_columns + 1, stream);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      sorted_page_columns.begin(),
+                      sorted_page_columns.end(),
+                      thrust::make_counting_iterator<int32_t>(0),
+                      thrust::make_counting_iterator<int32_t>(num_columns + 1),
+                      pass.page_offsets.begin());
 
   // setup dict_page for each chunk if necessary
   thrust::for_each(rmm::exec_policy_nosync(stream),
@@ -633,7 +712,19 @@ void decode_page_headers(pass_intermediate_data& pass,
 
   pass.pages.device_to_host_async(stream);
   pass.chunks.device_to_host_async(stream);
+  error_code.device_to_host_async(stream);
   stream.synchronize();
+
+  if (auto const error = error_code.value(); error != 0) {
+    if (BitAnd(error, decode_error::UNSUPPORTED_ENCODING) != 0) {
+      auto const unsupported_str =
+        ". With unsupported encodings found: " + list_unsupported_encodings(pass.pages, stream);
+      CUDF_FAIL("Parquet header parsing failed with code(s) " + kernel_error::to_string(error) +
+                unsupported_str);
+    } else {
+      CUDF_FAIL("Parquet header parsing failed with code(s) " + kernel_error::to_string(error));
+    }
+  }
 }
 
 constexpr bool is_string_chunk(ColumnChunkDesc const& chunk)
@@ -920,13 +1011,12 @@ void reader::impl::allocate_level_decode_space()
   }
 }
 
-std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks()
+std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks(
+  host_span<row_group_info const> row_groups_info,
+  std::vector<std::unique_ptr<datasource::buffer>>& raw_page_data,
+  host_span<ColumnChunkDesc> chunks,
+  rmm::cuda_stream_view read_stream)
 {
-  auto const& row_groups_info = _pass_itm_data->row_groups;
-
-  auto& raw_page_data = _pass_itm_data->raw_page_data;
-  auto& chunks        = _pass_itm_data->chunks;
-
   // Descriptors for all the chunks that make up the selected columns
   auto const num_input_columns = _input_columns.size();
   auto const num_chunks        = row_groups_info.size() * num_input_columns;
@@ -981,11 +1071,49 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
                                                       chunks.size(),
                                                       column_chunk_offsets,
                                                       chunk_source_map,
-                                                      _stream));
+                                                      _stream,
+                                                      read_stream));
 
   return {total_decompressed_size > 0, std::move(read_chunk_tasks)};
 }
 
+void reader::impl::prefetch_next_pass()
+{
+  auto const next_pass = _file_itm_data._current_input_pass + 1;
+  if (next_pass >= _file_itm_data.num_passes()) { return; }
+
+  auto const row_group_start     = _file_itm_data.input_pass_row_group_offsets[next_pass];
+  auto const row_group_end       = _file_itm_data.input_pass_row_group_offsets[next_pass + 1];
+  auto const chunks_per_rowgroup = _input_columns.size();
+
+  auto prefetch      = std::make_unique<prefetched_pass_data>();
+  prefetch->pass_idx = next_pass;
+  prefetch->chunks   = std::vector<ColumnChunkDesc>(
+    _file_itm_data.chunks.begin() + (row_group_start * chunks_per_rowgroup),
+    _file_itm_data.chunks.begin() + (row_group_end * chunks_per_rowgroup));
+
+  auto const row_groups = host_span<row_group_info const>(
+    _file_itm_data.row_groups.data() + row_group_start, row_group_end - row_group_start);
+  auto const read_stream = cudf::detail::global_cuda_stream_pool().get_stream();
+  int device_id{};
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+
+  // Host reads block, so they run on their own thread to overlap with the decode of the current
+  // pass. Nothing it touches other than `prefetch` is modified until `ready` completes.
+  prefetch->ready = std::async(
+    std::launch::async, [this, device_id, row_groups, read_stream, prefetch = prefetch.get()]() {
+      CUDF_CUDA_TRY(cudaSetDevice(device_id));
+      auto [has_compressed_data, read_chunks_tasks] =
+        read_column_chunks(row_groups, prefetch->raw_page_data, prefetch->chunks, read_stream);
+      prefetch->has_compressed_data = has_compressed_data;
+      for (auto& task : read_chunks_tasks) {
+        task.wait();
+      }
+      read_stream.synchronize();
+    });
+  _prefetched_pass = std::move(prefetch);
+}
+
 void reader::impl::read_compressed_data()
 {
   auto& pass = *_pass_itm_data;
@@ -995,12 +1123,35 @@ void reader::impl::read_compressed_data()
 
   auto& chunks = pass.chunks;
 
-  auto const [has_compressed_data, read_chunks_tasks] = read_column_chunks();
-  pass.has_compressed_data                            = has_compressed_data;
+  {
+    io::detail::stage_range stage{"read column chunks", _chunk_stats.read_time};
+    if (_prefetched_pass != nullptr and
+        _prefetched_pass->pass_idx == _file_itm_data._current_input_pass) {
+      // rethrows any error raised while reading
+      _prefetched_pass->ready.get();
+      pass.raw_page_data       = std::move(_prefetched_pass->raw_page_data);
+      pass.has_compressed_data = _prefetched_pass->has_compressed_data;
+      for (size_t c = 0; c < chunks.size(); c++) {
+        chunks[c].compressed_data = _prefetched_pass->chunks[c].compressed_data;
+      }
+      _prefetched_pass.reset();
+    } else {
+      auto const [has_compressed_data, read_chunks_tasks] =
+        read_column_chunks(pass.row_groups, pass.raw_page_data, chunks, _stream);
+      pass.has_compressed_data = has_compressed_data;
 
-  for (auto& task : read_chunks_tasks) {
-    task.wait();
+      for (auto& task : read_chunks_tasks) {
+        task.wait();
+      }
+    }
   }
+  _chunk_stats.num_bytes_read +=
+    std::accumulate(pass.raw_page_data.cbegin(),
+                    pass.raw_page_data.cend(),
+                    std::size_t{0},
+                    [](std::size_t sum, auto const& buffer) {
+                      return buffer != nullptr ? sum + buffer->size() : sum;
+                    });
 
   // Process dataset chunk pages into output columns
   auto const total_pages = _has_page_index ? count_page_headers_with_pgidx(chunks, _stream)
@@ -1009,9 +1160,7 @@ void reader::impl::read_compressed_data()
   rmm::device_uvector<PageInfo> unsorted_pages(total_pages, _stream);
 
   // decoding of column/page information
-  decode_page_headers(pass, unsorted_pages, _has_page_index, _stream);
-  CUDF_EXPECTS(pass.page_offsets.size() - 1 == static_cast<size_t>(_input_columns.size()),
-               "Encountered page_offsets / num_columns mismatch");
+  decode_page_headers(pass, unsorted_pages, _has_page_index, _input_columns.size(), _stream);
 }
 
 namespace {
@@ -1237,7 +1386,8 @@ void reader::impl::preprocess_file(read_mode mode)
 
   std::tie(
     _file_itm_data.global_skip_rows, _file_itm_data.global_num_rows, _file_itm_data.row_groups) =
-    _metadata->select_row_groups(_options.row_group_indices,
+    _metadata->select_row_groups(_sources,
+                                 _options.row_group_indices,
                                  _options.skip_rows,
                                  _options.num_rows,
                                  output_dtypes,
@@ -1260,6 +1410,8 @@ void reader::impl::preprocess_file(read_mode mode)
     compute_input_passes();
   }
 
+  if (_dictionary_string_columns) { select_dictionary_columns(); }
+
 #if defined(PARQUET_CHUNK_LOGGING)
   printf("==============================================\n");
   setlocale(LC_NUMERIC, "");
@@ -1504,7 +1656,7 @@ void reader::impl::allocate_columns(read_mode mode, size_t skip_rows, size_t num
           out_buf.type.id() == type_id::LIST && l_idx < max_depth ? num_rows + 1 : num_rows,
           cudf::mask_state::ALL_VALID,
           _stream,
-          _mr);
+          output_mr(input_col.nesting[0]));
       }
     }
   }
@@ -1581,7 +1733,8 @@ void reader::impl::allocate_columns(read_mode mode, size_t skip_rows, size_t num
 
           // allocate
           // we're going to start null mask as all valid and then turn bits off if necessary
-          out_buf.create_with_mask(size, cudf::mask_state::ALL_VALID, _stream, _mr);
+          out_buf.create_with_mask(
+            size, cudf::mask_state::ALL_VALID, _stream, output_mr(input_col.nesting[0]));
         }
       }
     }
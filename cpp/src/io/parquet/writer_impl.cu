@@ -44,6 +44,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/thread_pool.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -53,8 +54,11 @@
 #include <thrust/for_each.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <future>
 #include <iterator>
+#include <map>
 #include <numeric>
 #include <utility>
 
@@ -176,6 +180,7 @@ struct aggregate_writer_metadata {
     std::vector<KeyValue> key_value_metadata;
     std::vector<OffsetIndex> offset_indexes;
     std::vector<std::vector<uint8_t>> column_indexes;
+    std::vector<std::vector<uint8_t>> bloom_filters;  // empty for chunks without a bloom filter
   };
   std::vector<per_file_metadata> files;
   thrust::optional<std::vector<ColumnOrder>> column_orders = thrust::nullopt;
@@ -183,6 +188,9 @@ struct aggregate_writer_metadata {
 
 namespace {
 
+// Target size of the host buffer used to stage column chunks that are written to host sinks
+constexpr size_t host_write_batch_size = 64 * 1024 * 1024;
+
 /**
  * @brief Function that translates GDF compression to parquet compression.
  *
@@ -320,6 +328,8 @@ bool is_col_fixed_width(column_view const& column)
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
  * 4. requested_encoding: A user provided encoding to use for the column.
+ * 5. bloom_filter_fpp: Target false positive probability of the column's bloom filter, or 0 if no
+ *    bloom filter is to be written.
  */
 struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
@@ -327,6 +337,7 @@ struct schema_tree_node : public SchemaElement {
   int32_t ts_scale;
   column_encoding requested_encoding;
   bool skip_compression;
+  double bloom_filter_fpp;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -741,6 +752,43 @@ std::vector<schema_tree_node> construct_schema_tree(
         }
       };
 
+      // only call this after col_schema.type and col_schema.leaf_column have been set
+      auto set_bloom_filter = [](schema_tree_node& s, column_in_metadata const& col_meta) {
+        s.bloom_filter_fpp = 0;
+        if (not col_meta.is_enabled_bloom_filter()) { return; }
+
+        auto const fpp = col_meta.get_bloom_filter_fpp();
+        CUDF_EXPECTS(fpp > 0 and fpp < 1,
+                     "Bloom filter false positive probability must be in the range (0, 1)");
+
+        auto const col_type     = s.leaf_column->type().id();
+        auto const is_supported = [&]() {
+          switch (col_type) {
+            case type_id::INT8:
+            case type_id::INT16:
+            case type_id::INT32:
+            case type_id::INT64:
+            case type_id::UINT8:
+            case type_id::UINT16:
+            case type_id::UINT32:
+            case type_id::UINT64:
+            case type_id::FLOAT32:
+            case type_id::FLOAT64:
+            case type_id::DECIMAL32:
+            case type_id::DECIMAL64: return true;
+            case type_id::STRING: return s.type == Type::BYTE_ARRAY;
+            default: return false;
+          }
+        }();
+        if (not is_supported) {
+          CUDF_LOG_WARN(
+            "Bloom filters are only supported for integral, floating point, 32/64-bit decimal "
+            "and string columns; the requested bloom filter will be ignored");
+          return;
+        }
+        s.bloom_filter_fpp = fpp;
+      };
+
       // There is a special case for a list<int8> column with one byte column child. This column can
       // have a special flag that indicates we write this out as binary instead of a list. This is a
       // more efficient storage mechanism for a single-depth list of bytes, but is a departure from
@@ -773,6 +821,7 @@ std::vector<schema_tree_node> construct_schema_tree(
         set_encoding(col_schema, col_meta);
         col_schema.output_as_byte_array = col_meta.is_enabled_output_as_binary();
         col_schema.skip_compression     = col_meta.is_enabled_skip_compression();
+        set_bloom_filter(col_schema, col_meta);
         schema.push_back(col_schema);
       } else if (col->type().id() == type_id::STRUCT) {
         // if struct, add current and recursively call for all children
@@ -909,6 +958,7 @@ std::vector<schema_tree_node> construct_schema_tree(
         set_field_id(col_schema, col_meta);
         set_encoding(col_schema, col_meta);
         col_schema.skip_compression = col_meta.is_enabled_skip_compression();
+        set_bloom_filter(col_schema, col_meta);
         schema.push_back(col_schema);
       }
     };
@@ -1101,6 +1151,7 @@ parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_stream
   desc.max_rep_level      = _max_rep_level;
   desc.requested_encoding = schema_node.requested_encoding;
   desc.skip_compression   = schema_node.skip_compression;
+  desc.bloom_filter_fpp   = schema_node.bloom_filter_fpp;
   return desc;
 }
 
@@ -1130,43 +1181,26 @@ void init_row_group_fragments(cudf::detail::hostdevice_2dvector<PageFragment>& f
 }
 
 /**
- * @brief Recalculate page fragments
+ * @brief Recalculate page fragments and gather their statistics
  *
  * This calculates fragments to be used to determine page boundaries within
- * column chunks.
+ * column chunks. The statistics of each fragment are gathered in the same pass.
  *
  * @param frag Destination page fragments
  * @param frag_sizes Array of fragment sizes for each column
+ * @param frag_stats Output fragment statistics, or empty if statistics are not written
+ * @param int96_timestamps Flag to indicate if timestamps will be written as INT96
  * @param stream CUDA stream used for device memory operations and kernel launches
  */
 void calculate_page_fragments(device_span<PageFragment> frag,
                               host_span<size_type const> frag_sizes,
+                              device_span<statistics_chunk> frag_stats,
+                              bool int96_timestamps,
                               rmm::cuda_stream_view stream)
 {
   auto d_frag_sz = cudf::detail::make_device_uvector_async(
     frag_sizes, stream, rmm::mr::get_current_device_resource());
-  CalculatePageFragments(frag, d_frag_sz, stream);
-}
-
-/**
- * @brief Gather per-fragment statistics
- *
- * @param frag_stats output statistics
- * @param frags Input page fragments
- * @param int96_timestamps Flag to indicate if timestamps will be written as INT96
- * @param stream CUDA stream used for device memory operations and kernel launches
- */
-void gather_fragment_statistics(device_span<statistics_chunk> frag_stats,
-                                device_span<PageFragment const> frags,
-                                bool int96_timestamps,
-                                rmm::cuda_stream_view stream)
-{
-  rmm::device_uvector<statistics_group> frag_stats_group(frag_stats.size(), stream);
-
-  InitFragmentStatistics(frag_stats_group, frags, stream);
-  detail::calculate_group_statistics<detail::io_file_format::PARQUET>(
-    frag_stats.data(), frag_stats_group.data(), frag_stats.size(), stream, int96_timestamps);
-  stream.synchronize();
+  CalculatePageFragments(frag, d_frag_sz, frag_stats, int96_timestamps, stream);
 }
 
 auto to_nvcomp_compression_type(Compression codec)
@@ -1290,6 +1324,154 @@ size_t max_page_bytes(Compression compression, size_t max_page_size_bytes)
   return std::min<size_t>(max_size, std::numeric_limits<int32_t>::max());
 }
 
+/**
+ * @brief Computes the HyperLogLog estimate of the number of distinct values from a sketch
+ *
+ * @param registers The `CARDINALITY_SKETCH_SIZE` registers of one chunk's sketch
+ * @return Estimated number of distinct values
+ */
+double sketch_cardinality(host_span<uint32_t const> registers)
+{
+  constexpr double num_registers = CARDINALITY_SKETCH_SIZE;
+  constexpr double alpha         = 0.7213 / (1.0 + 1.079 / num_registers);
+
+  double inverse_sum = 0;
+  int zero_registers = 0;
+  for (auto const reg : registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(reg));
+    if (reg == 0) { ++zero_registers; }
+  }
+  auto const estimate = alpha * num_registers * num_registers / inverse_sum;
+  // linear counting is more accurate while many registers are still empty
+  if (estimate <= 2.5 * num_registers and zero_registers > 0) {
+    return num_registers * std::log(num_registers / zero_registers);
+  }
+  return estimate;
+}
+
+/**
+ * @brief Returns `true` if the chunks of a column may be dictionary encoded
+ */
+bool is_dictionary_candidate(parquet_column_device_view const& col_desc)
+{
+  auto const is_requested_non_dict = col_desc.requested_encoding != column_encoding::USE_DEFAULT &&
+                                     col_desc.requested_encoding != column_encoding::DICTIONARY;
+  auto const is_type_non_dict =
+    col_desc.physical_type == Type::BOOLEAN || col_desc.output_as_byte_array;
+  return not(is_type_non_dict || is_requested_non_dict);
+}
+
+/**
+ * @brief Estimates the dictionary encoded size of a column chunk from its number of distinct
+ * values
+ *
+ * Distinct values are assumed to have the average plain encoded size of the chunk's values. The
+ * same checks are applied as to the exact dictionary in `build_chunk_dictionaries`.
+ *
+ * @return The estimated size of the dictionary and the indices, or `std::nullopt` if the chunk
+ * would not be dictionary encoded
+ */
+std::optional<size_t> estimated_dictionary_size(size_t num_distinct,
+                                                size_t plain_data_size,
+                                                size_t num_values,
+                                                Compression compression,
+                                                dictionary_policy dict_policy,
+                                                size_t max_dict_size)
+{
+  if (num_values == 0 or num_distinct > MAX_DICT_SIZE) { return std::nullopt; }
+
+  auto const max_dict_index = num_distinct > 0 ? static_cast<uint32_t>(num_distinct - 1) : 0;
+  auto const nbits = std::max(CompactProtocolReader::NumRequiredBits(max_dict_index), 1);
+  if (nbits > MAX_DICT_BITS) { return std::nullopt; }
+
+  auto const uniq_data_size =
+    static_cast<size_t>(static_cast<double>(plain_data_size) * num_distinct / num_values);
+  auto const rle_byte_size = util::div_rounding_up_safe<size_t>(num_values * nbits, 8);
+  if (plain_data_size <= uniq_data_size + rle_byte_size) { return std::nullopt; }
+  if (dict_policy == dictionary_policy::ADAPTIVE and
+      uniq_data_size > max_page_bytes(compression, max_dict_size)) {
+    return std::nullopt;
+  }
+  return uniq_data_size + rle_byte_size;
+}
+
+/**
+ * @brief Disables dictionary encoding for the chunks whose estimated cardinality rules it out
+ *
+ * Builds a HyperLogLog sketch of every dictionary candidate chunk and applies the same size
+ * checks that are later applied to the exact dictionary, but against a lower bound of the
+ * estimated number of distinct values. Chunks that fail are never given a hash map.
+ */
+void disable_high_cardinality_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
+                                           host_span<parquet_column_device_view const> col_desc,
+                                           device_2dspan<PageFragment const> frags,
+                                           Compression compression,
+                                           dictionary_policy dict_policy,
+                                           size_t max_dict_size,
+                                           rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+
+  auto registers = cudf::detail::make_zeroed_device_uvector_async<uint32_t>(
+    h_chunks.size() * CARDINALITY_SKETCH_SIZE, stream, rmm::mr::get_current_device_resource());
+  chunks.host_to_device_async(stream);
+  estimate_chunk_cardinality(frags, chunks.device_view().flat_view(), registers, stream);
+  auto const h_registers = cudf::detail::make_host_vector_sync(registers, stream);
+
+  // three standard errors below the estimate, so that chunks are only rejected when the exact
+  // count would almost certainly reject them too
+  auto const lower_bound_factor = 1.0 - 3 * 1.04 / std::sqrt(double{CARDINALITY_SKETCH_SIZE});
+
+  for (std::size_t i = 0; i < h_chunks.size(); ++i) {
+    auto& ck = h_chunks[i];
+    if (not ck.use_dictionary or ck.num_values == 0) { continue; }
+    // honor explicit requests; the exact check below decides and warns when they cannot be met
+    if (col_desc[ck.col_desc_id].requested_encoding == column_encoding::DICTIONARY) { continue; }
+
+    auto const sketch = host_span<uint32_t const>(
+      h_registers.data() + i * CARDINALITY_SKETCH_SIZE, CARDINALITY_SKETCH_SIZE);
+    auto const num_distinct = static_cast<size_t>(std::min<double>(
+      sketch_cardinality(sketch) * lower_bound_factor, static_cast<double>(ck.num_values)));
+    if (not estimated_dictionary_size(num_distinct,
+                                      ck.plain_data_size,
+                                      ck.num_values,
+                                      compression,
+                                      dict_policy,
+                                      max_dict_size)) {
+      ck.use_dictionary = false;
+    }
+  }
+}
+
+/**
+ * @brief Estimates the number of distinct values of each leaf column
+ *
+ * @return The estimated number of distinct values per column, or 0 for columns that will not be
+ * dictionary encoded
+ */
+std::vector<double> estimate_column_cardinalities(
+  host_span<parquet_column_device_view const> h_col_desc,
+  device_span<parquet_column_device_view const> d_col_desc,
+  device_2dspan<PageFragment const> frags,
+  dictionary_policy dict_policy,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<double> cardinalities(h_col_desc.size(), 0);
+  if (dict_policy == dictionary_policy::NEVER or frags.is_empty()) { return cardinalities; }
+
+  auto registers = cudf::detail::make_zeroed_device_uvector_async<uint32_t>(
+    h_col_desc.size() * CARDINALITY_SKETCH_SIZE, stream, rmm::mr::get_current_device_resource());
+  estimate_column_cardinality(frags, d_col_desc, registers, stream);
+  auto const h_registers = cudf::detail::make_host_vector_sync(registers, stream);
+
+  for (std::size_t c = 0; c < h_col_desc.size(); ++c) {
+    if (not is_dictionary_candidate(h_col_desc[c])) { continue; }
+    cardinalities[c] = sketch_cardinality(host_span<uint32_t const>(
+      h_registers.data() + c * CARDINALITY_SKETCH_SIZE, CARDINALITY_SKETCH_SIZE));
+  }
+  return cardinalities;
+}
+
 std::pair<std::vector<rmm::device_uvector<size_type>>, std::vector<rmm::device_uvector<size_type>>>
 build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
                          host_span<parquet_column_device_view const> col_desc,
@@ -1297,6 +1479,7 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
                          Compression compression,
                          dictionary_policy dict_policy,
                          size_t max_dict_size,
+                         bool estimate_cardinality,
                          rmm::cuda_stream_view stream)
 {
   // At this point, we know all chunks and their sizes. We want to allocate dictionaries for each
@@ -1316,21 +1499,21 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
     return std::pair(std::move(dict_data), std::move(dict_index));
   }
 
+  for (auto& chunk : h_chunks) {
+    chunk.use_dictionary = is_dictionary_candidate(col_desc[chunk.col_desc_id]);
+  }
+
+  // Skip building the hash maps of chunks that are too distinct to ever use a dictionary
+  if (estimate_cardinality) {
+    disable_high_cardinality_dictionaries(
+      chunks, col_desc, frags, compression, dict_policy, max_dict_size, stream);
+  }
+
   // Allocate slots for each chunk
   std::vector<rmm::device_uvector<slot_type>> hash_maps_storage;
   hash_maps_storage.reserve(h_chunks.size());
   for (auto& chunk : h_chunks) {
-    auto const& chunk_col_desc = col_desc[chunk.col_desc_id];
-    auto const is_requested_non_dict =
-      chunk_col_desc.requested_encoding != column_encoding::USE_DEFAULT &&
-      chunk_col_desc.requested_encoding != column_encoding::DICTIONARY;
-    auto const is_type_non_dict =
-      chunk_col_desc.physical_type == Type::BOOLEAN || chunk_col_desc.output_as_byte_array;
-
-    if (is_type_non_dict || is_requested_non_dict) {
-      chunk.use_dictionary = false;
-    } else {
-      chunk.use_dictionary = true;
+    if (chunk.use_dictionary) {
       // cuCollections suggests using a hash map of size N * (1/0.7) = num_values * 1.43
       // https://github.com/NVIDIA/cuCollections/blob/3a49fc71/include/cuco/static_map.cuh#L190-L193
       auto& inserted_map   = hash_maps_storage.emplace_back(chunk.num_values * 1.43, stream);
@@ -1633,6 +1816,40 @@ size_t column_index_buffer_size(EncColumnChunk* ck,
   return ck->ck_stat_size * num_pages + column_index_truncate_length + padding + size_struct_size;
 }
 
+/**
+ * @brief Function to calculate the size of the split block bloom filter bitset of the given
+ * column chunk.
+ *
+ * The number of distinct values is taken from the dictionary if the chunk is dictionary encoded,
+ * and is otherwise bounded by the number of values in the chunk.
+ *
+ * @param ck The column chunk
+ * @param col `parquet_column_device_view` for the column
+ * @return Size of the bitset in bytes, or 0 if the chunk does not get a bloom filter
+ */
+uint32_t bloom_filter_buffer_size(EncColumnChunk const& ck, parquet_column_device_view const& col)
+{
+  if (col.bloom_filter_fpp <= 0 or ck.num_values == 0) { return 0; }
+
+  // the spec bounds the bitset to [32 bytes, 128 MiB], and the bitset size must be a power of 2
+  constexpr size_t min_bytes = split_block_bloom_filter_words * sizeof(uint32_t);
+  constexpr size_t max_bytes = 128 * 1024 * 1024;
+
+  // with k bits set per insert, the optimal number of bits for n values at false positive
+  // probability p is -k * n / ln(1 - p^(1/k))
+  auto const num_distinct = std::max(ck.use_dictionary ? ck.num_dict_entries : ck.num_values, 1);
+  auto const k            = static_cast<double>(split_block_bloom_filter_words);
+  auto const num_bits =
+    -k * num_distinct / std::log(1.0 - std::pow(col.bloom_filter_fpp, 1.0 / k));
+  auto const num_bytes = static_cast<size_t>(std::ceil(num_bits / 8));
+
+  size_t size = min_bytes;
+  while (size < num_bytes and size < max_bytes) {
+    size *= 2;
+  }
+  return static_cast<uint32_t>(size);
+}
+
 /**
  * @brief Fill the table metadata with default column names.
  *
@@ -1674,6 +1891,10 @@ void fill_table_meta(std::unique_ptr<table_input_metadata> const& table_meta)
  * @param collect_statistics Flag to indicate if statistics should be collected
  * @param dict_policy Policy for dictionary use
  * @param max_dictionary_size Maximum dictionary size, in bytes
+ * @param estimate_dict_cardinality Flag to indicate if chunks should be rejected for dictionary
+ *        encoding based on an estimate of their cardinality before building the dictionary
+ * @param encoded_row_group_size Flag to indicate if `max_row_group_size` bounds the estimated
+ *        encoded size of row groups instead of the input data size
  * @param single_write_mode Flag to indicate that we are guaranteeing a single table write
  * @param int96_timestamps Flag to indicate if timestamps will be written as INT96
  * @param utc_timestamps Flag to indicate if timestamps are UTC
@@ -1699,6 +1920,8 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                    bool collect_compression_statistics,
                                    dictionary_policy dict_policy,
                                    size_t max_dictionary_size,
+                                   bool estimate_dict_cardinality,
+                                   bool encoded_row_group_size,
                                    single_write_mode write_mode,
                                    bool int96_timestamps,
                                    bool utc_timestamps,
@@ -1844,25 +2067,59 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
 
   auto global_rowgroup_base = agg_meta->num_row_groups_per_file();
 
-  // Decide row group boundaries based on uncompressed data size
+  // Decide row group boundaries based on uncompressed data size, or on the estimated encoded size
+  // if requested
   size_type num_rowgroups = 0;
 
+  std::vector<double> column_cardinalities;
+  if (encoded_row_group_size) {
+    column_cardinalities =
+      estimate_column_cardinalities(col_desc, col_desc, row_group_fragments, dict_policy, stream);
+  }
+  // plain data size and number of values of each column chunk in the current row group
+  std::vector<size_t> curr_chunk_data_size(num_columns);
+  std::vector<size_t> curr_chunk_num_values(num_columns);
+  auto const encoded_rg_data_size = [&](int f) {
+    size_t rg_data_size = 0;
+    for (auto c = 0; c < num_columns; c++) {
+      auto const& frag           = row_group_fragments[c][f];
+      auto const plain_data_size = curr_chunk_data_size[c] + frag.fragment_data_size;
+      auto const num_values      = curr_chunk_num_values[c] + frag.num_values;
+      auto const num_distinct    = static_cast<size_t>(
+        std::min(column_cardinalities[c], static_cast<double>(num_values)));
+      rg_data_size += column_cardinalities[c] > 0
+                        ? estimated_dictionary_size(num_distinct,
+                                                    plain_data_size,
+                                                    num_values,
+                                                    compression,
+                                                    dict_policy,
+                                                    max_dictionary_size)
+                            .value_or(plain_data_size)
+                        : plain_data_size;
+    }
+    return rg_data_size;
+  };
+
   std::vector<int> num_rg_in_part(partitions.size());
   for (size_t p = 0; p < partitions.size(); ++p) {
     size_type curr_rg_num_rows = 0;
     size_t curr_rg_data_size   = 0;
     int first_frag_in_rg       = part_frag_offset[p];
     int last_frag_in_part      = part_frag_offset[p + 1] - 1;
+    std::fill(curr_chunk_data_size.begin(), curr_chunk_data_size.end(), 0);
+    std::fill(curr_chunk_num_values.begin(), curr_chunk_num_values.end(), 0);
     for (auto f = first_frag_in_rg; f <= last_frag_in_part; ++f) {
       size_t fragment_data_size = 0;
       for (auto c = 0; c < num_columns; c++) {
         fragment_data_size += row_group_fragments[c][f].fragment_data_size;
       }
       size_type fragment_num_rows = row_group_fragments[0][f].num_rows;
+      auto const next_rg_data_size =
+        encoded_row_group_size ? encoded_rg_data_size(f) : curr_rg_data_size + fragment_data_size;
 
       // If the fragment size gets larger than rg limit then break off a rg
       if (f > first_frag_in_rg &&  // There has to be at least one fragment in row group
-          (curr_rg_data_size + fragment_data_size > max_row_group_size ||
+          (next_rg_data_size > max_row_group_size ||
            curr_rg_num_rows + fragment_num_rows > max_row_group_rows)) {
         auto& rg    = agg_meta->file(p).row_groups.emplace_back();
         rg.num_rows = curr_rg_num_rows;
@@ -1871,9 +2128,15 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         curr_rg_num_rows  = 0;
         curr_rg_data_size = 0;
         first_frag_in_rg  = f;
+        std::fill(curr_chunk_data_size.begin(), curr_chunk_data_size.end(), 0);
+        std::fill(curr_chunk_num_values.begin(), curr_chunk_num_values.end(), 0);
       }
       curr_rg_num_rows += fragment_num_rows;
       curr_rg_data_size += fragment_data_size;
+      for (auto c = 0; c < num_columns; c++) {
+        curr_chunk_data_size[c] += row_group_fragments[c][f].fragment_data_size;
+        curr_chunk_num_values[c] += row_group_fragments[c][f].num_values;
+      }
 
       // TODO: (wishful) refactor to consolidate with above if block
       if (f == last_frag_in_part) {
@@ -1948,7 +2211,14 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
 
   row_group_fragments.host_to_device_async(stream);
   [[maybe_unused]] auto dict_info_owner = build_chunk_dictionaries(
-    chunks, col_desc, row_group_fragments, compression, dict_policy, max_dictionary_size, stream);
+    chunks,
+    col_desc,
+    row_group_fragments,
+    compression,
+    dict_policy,
+    max_dictionary_size,
+    estimate_dict_cardinality,
+    stream);
 
   // The code preceding this used a uniform fragment size for all columns. Now recompute
   // fragments with a (potentially) varying number of fragments per column.
@@ -1996,17 +2266,10 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
 
     chunks.host_to_device_async(stream);
 
-    // re-initialize page fragments
+    // re-initialize page fragments and gather fragment statistics
     page_fragments.host_to_device_async(stream);
-    calculate_page_fragments(page_fragments, column_frag_size, stream);
-
-    // and gather fragment statistics
-    if (not frag_stats.is_empty()) {
-      gather_fragment_statistics(frag_stats,
-                                 {page_fragments.device_ptr(), static_cast<size_t>(total_frags)},
-                                 int96_timestamps,
-                                 stream);
-    }
+    calculate_page_fragments(
+      page_fragments, column_frag_size, frag_stats, int96_timestamps, stream);
   }
 
   // Build chunk dictionaries and count pages. Sends chunks to device.
@@ -2034,6 +2297,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   size_t column_index_bfr_size  = 0;
   size_t def_histogram_bfr_size = 0;
   size_t rep_histogram_bfr_size = 0;
+  size_t bloom_filter_bfr_size  = 0;
   size_t rowgroup_size          = 0;
   size_t comp_rowgroup_size     = 0;
   for (size_type r = 0; r <= num_rowgroups; r++) {
@@ -2046,6 +2310,8 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         comp_rowgroup_size += ck->compressed_size;
         max_chunk_bfr_size =
           std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
+        ck->bloom_filter_size = bloom_filter_buffer_size(*ck, col_desc[ck->col_desc_id]);
+        bloom_filter_bfr_size += ck->bloom_filter_size / sizeof(uint32_t);
         if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
           auto const& col = col_desc[ck->col_desc_id];
           column_index_bfr_size += column_index_buffer_size(ck, col, column_index_truncate_length);
@@ -2094,11 +2360,16 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   thrust::uninitialized_fill(
     rmm::exec_policy_nosync(stream), rep_level_histogram.begin(), rep_level_histogram.end(), 0);
 
+  rmm::device_uvector<uint32_t> bloom_filter_bfr(bloom_filter_bfr_size, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy_nosync(stream), bloom_filter_bfr.begin(), bloom_filter_bfr.end(), 0);
+
   // This contains stats for both the pages and the rowgroups. TODO: make them separate.
   rmm::device_uvector<statistics_chunk> page_stats(num_stats_bfr, stream);
   auto bfr_i = static_cast<uint8_t*>(col_idx_bfr.data());
   auto bfr_r = rep_level_histogram.data();
   auto bfr_d = def_level_histogram.data();
+  auto bfr_b = bloom_filter_bfr.data();
   if (num_rowgroups != 0) {
     auto bfr   = static_cast<uint8_t*>(uncomp_bfr.data());
     auto bfr_c = static_cast<uint8_t*>(comp_bfr.data());
@@ -2108,8 +2379,10 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         ck.uncompressed_bfr  = bfr;
         ck.compressed_bfr    = bfr_c;
         ck.column_index_blob = bfr_i;
+        ck.bloom_filter_data = bfr_b;
         bfr += ck.bfr_size;
         bfr_c += ck.compressed_size;
+        bfr_b += ck.bloom_filter_size / sizeof(uint32_t);
         if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
           auto const& col      = col_desc[ck.col_desc_id];
           ck.column_index_size = column_index_buffer_size(&ck, col, column_index_truncate_length);
@@ -2129,6 +2402,12 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     }
   }
 
+  // Populate the bloom filters now that the bitsets have been assigned to their chunks
+  if (not bloom_filter_bfr.is_empty()) {
+    chunks.host_to_device_async(stream);
+    BuildBloomFilters(row_group_fragments, stream);
+  }
+
   if (num_pages != 0) {
     init_encoder_pages(chunks,
                        col_desc,
@@ -2149,6 +2428,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   // Check device write support for all chunks and initialize bounce_buffer.
   bool all_device_write   = true;
   uint32_t max_write_size = 0;
+  size_t host_write_size  = 0;
   std::optional<writer_compression_statistics> comp_stats;
   if (collect_compression_statistics) { comp_stats = writer_compression_statistics{}; }
 
@@ -2185,6 +2465,9 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
       }
     }
 
+    // chunk statistics are copied for all chunks at once and parsed after the sync below
+    std::vector<std::pair<ColumnChunkMetaData*, std::vector<uint8_t>>> stats_blobs;
+
     for (int r = 0; r < num_rowgroups; r++) {
       int p           = rg_to_part[r];
       int global_r    = global_rowgroup_base[p] + r - first_rg_in_part[p];
@@ -2198,6 +2481,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         if (ck.is_compressed) { column_chunk_meta.codec = compression; }
         if (!out_sink[p]->is_device_write_preferred(ck.compressed_size)) {
           all_device_write = false;
+          host_write_size += ck.compressed_size;
         }
         max_write_size = std::max(max_write_size, ck.compressed_size);
 
@@ -2205,13 +2489,30 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         update_chunk_encoding_stats(column_chunk_meta, ck, write_v2_headers);
 
         if (ck.ck_stat_size != 0) {
-          std::vector<uint8_t> const stats_blob = cudf::detail::make_std_vector_sync(
-            device_span<uint8_t const>(dev_bfr, ck.ck_stat_size), stream);
-          CompactProtocolReader cp(stats_blob.data(), stats_blob.size());
-          cp.read(&column_chunk_meta.statistics);
+          stats_blobs.emplace_back(&column_chunk_meta,
+                                   cudf::detail::make_std_vector_async(
+                                     device_span<uint8_t const>(dev_bfr, ck.ck_stat_size), stream));
           need_sync = true;
         }
 
+        // bloom filters are stored as the serialized header followed by the bitset
+        std::vector<uint8_t> bloom_filter;
+        if (ck.bloom_filter_size != 0) {
+          BloomFilterHeader header;
+          header.num_bytes = static_cast<int32_t>(ck.bloom_filter_size);
+          CompactProtocolWriter cpw(&bloom_filter);
+          cpw.write(header);
+          auto const header_size = bloom_filter.size();
+          bloom_filter.resize(header_size + ck.bloom_filter_size);
+          CUDF_CUDA_TRY(cudaMemcpyAsync(bloom_filter.data() + header_size,
+                                        ck.bloom_filter_data,
+                                        ck.bloom_filter_size,
+                                        cudaMemcpyDefault,
+                                        stream.value()));
+          need_sync = true;
+        }
+        agg_meta->file(p).bloom_filters.push_back(std::move(bloom_filter));
+
         row_group.total_byte_size += ck.bfr_size;
         row_group.total_compressed_size =
           row_group.total_compressed_size.value_or(0) + ck.compressed_size;
@@ -2223,6 +2524,11 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     // Sync before calling the next `encode_pages` which may alter the stats data.
     if (need_sync) { stream.synchronize(); }
 
+    for (auto const& [column_chunk_meta, stats_blob] : stats_blobs) {
+      CompactProtocolReader cp(stats_blob.data(), stats_blob.size());
+      cp.read(&column_chunk_meta->statistics);
+    }
+
     // now add to the column chunk SizeStatistics if necessary
     if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
       auto h_def_ptr = h_def_histogram.data();
@@ -2277,8 +2583,13 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     }
   }
 
-  auto bounce_buffer =
-    cudf::detail::pinned_host_vector<uint8_t>(all_device_write ? 0 : max_write_size);
+  // Host writes are staged in batches so that the chunks of many partitions can be copied with a
+  // single synchronization. The buffer must still be able to hold the largest chunk.
+  auto const bounce_buffer_size =
+    all_device_write
+      ? size_t{0}
+      : std::max<size_t>(max_write_size, std::min(host_write_size, host_write_batch_size));
+  auto bounce_buffer = cudf::detail::pinned_host_vector<uint8_t>(bounce_buffer_size);
 
   return std::tuple{std::move(agg_meta),
                     std::move(pages),
@@ -2293,6 +2604,21 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                     std::move(bounce_buffer)};
 }
 
+/**
+ * @brief Returns the thread pool used to write to multiple sinks concurrently
+ *
+ * The pool size can be set with the `LIBCUDF_PARQUET_WRITER_THREAD_COUNT` environment variable.
+ *
+ * @return The shared thread pool
+ */
+cudf::detail::thread_pool& sink_write_thread_pool()
+{
+  constexpr std::size_t default_thread_count = 8;
+  static cudf::detail::thread_pool pool(
+    cudf::io::detail::getenv_or("LIBCUDF_PARQUET_WRITER_THREAD_COUNT", default_thread_count));
+  return pool;
+}
+
 }  // namespace
 
 writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
@@ -2308,6 +2634,8 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _stats_granularity(options.get_stats_level()),
     _dict_policy(options.get_dictionary_policy()),
     _max_dictionary_size(options.get_max_dictionary_size()),
+    _dictionary_cardinality_estimate(options.is_enabled_dictionary_cardinality_estimate()),
+    _encoded_row_group_size(options.is_enabled_encoded_row_group_size()),
     _max_page_fragment_size(options.get_max_page_fragment_size()),
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
@@ -2338,6 +2666,8 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _stats_granularity(options.get_stats_level()),
     _dict_policy(options.get_dictionary_policy()),
     _max_dictionary_size(options.get_max_dictionary_size()),
+    _dictionary_cardinality_estimate(options.is_enabled_dictionary_cardinality_estimate()),
+    _encoded_row_group_size(options.is_enabled_encoded_row_group_size()),
     _max_page_fragment_size(options.get_max_page_fragment_size()),
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
@@ -2416,6 +2746,8 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                                            _compression_statistics != nullptr,
                                            _dict_policy,
                                            _max_dictionary_size,
+                                           _dictionary_cardinality_estimate,
+                                           _encoded_row_group_size,
                                            _single_write_mode,
                                            _int96_timestamps,
                                            _utc_timestamps,
@@ -2439,6 +2771,13 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                              rg_to_part,
                              bounce_buffer);
 
+  // Device writes that are still in flight read from the encoded chunks; they are completed by the
+  // next write or by `close()`
+  if (not _pending_writes.empty()) {
+    _pending_writes.hold(std::move(uncomp_bfr));
+    _pending_writes.hold(std::move(comp_bfr));
+  }
+
   update_compression_statistics(comp_stats);
 
   _last_write_successful = true;
@@ -2457,8 +2796,54 @@ void writer::impl::write_parquet_data_to_sink(
   auto const num_rowgroups = chunks.size().first;
   auto const num_columns   = chunks.size().second;
 
+  // The device writes of the previous table have overlapped with the encoding of this one
+  _pending_writes.wait();
+
   if (num_rowgroups != 0) {
-    std::vector<std::future<void>> write_tasks;
+    // Chunks that have been copied to the bounce buffer but not yet written to their host sinks
+    struct staged_write {
+      int part;
+      size_t offset;
+      size_t size;
+    };
+    std::vector<staged_write> staged_writes;
+    std::vector<size_type> staged_writes_per_part(_out_sink.size(), 0);
+    size_t staged_size = 0;
+
+    // Writes all staged chunks. Chunks of the same sink are written in order, different sinks are
+    // written concurrently.
+    auto const flush_staged_writes = [&]() {
+      if (staged_writes.empty()) { return; }
+      _stream.synchronize();
+
+      std::map<int, std::vector<staged_write>> part_writes;
+      for (auto const& write : staged_writes) {
+        part_writes[write.part].push_back(write);
+      }
+      auto const write_part = [&](std::vector<staged_write> const& writes) {
+        for (auto const& write : writes) {
+          _out_sink[write.part]->host_write(bounce_buffer.data() + write.offset, write.size);
+        }
+      };
+      if (part_writes.size() == 1) {
+        write_part(part_writes.begin()->second);
+      } else {
+        std::vector<std::future<void>> part_tasks;
+        part_tasks.reserve(part_writes.size());
+        for (auto const& part : part_writes) {
+          auto const& writes = part.second;
+          part_tasks.emplace_back(
+            sink_write_thread_pool().submit([&write_part, &writes]() { write_part(writes); }));
+        }
+        for (auto& task : part_tasks) {
+          task.get();
+        }
+      }
+
+      staged_writes.clear();
+      std::fill(staged_writes_per_part.begin(), staged_writes_per_part.end(), 0);
+      staged_size = 0;
+    };
 
     for (auto r = 0; r < static_cast<int>(num_rowgroups); r++) {
       int const p        = rg_to_part[r];
@@ -2472,18 +2857,22 @@ void writer::impl::write_parquet_data_to_sink(
         // Skip the range [0, ck.ck_stat_size) since it has already been copied to host
         // and stored in _agg_meta before.
         if (_out_sink[p]->is_device_write_preferred(ck.compressed_size)) {
-          write_tasks.push_back(_out_sink[p]->device_write_async(
+          // keep the writes to this sink in order
+          if (staged_writes_per_part[p] != 0) { flush_staged_writes(); }
+          _pending_writes.push(_out_sink[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, _stream));
         } else {
           CUDF_EXPECTS(bounce_buffer.size() >= ck.compressed_size,
                        "Bounce buffer was not properly initialized.");
-          CUDF_CUDA_TRY(cudaMemcpyAsync(bounce_buffer.data(),
+          if (staged_size + ck.compressed_size > bounce_buffer.size()) { flush_staged_writes(); }
+          CUDF_CUDA_TRY(cudaMemcpyAsync(bounce_buffer.data() + staged_size,
                                         dev_bfr + ck.ck_stat_size,
                                         ck.compressed_size,
                                         cudaMemcpyDefault,
                                         _stream.value()));
-          _stream.synchronize();
-          _out_sink[p]->host_write(bounce_buffer.data(), ck.compressed_size);
+          staged_writes.push_back({p, staged_size, ck.compressed_size});
+          ++staged_writes_per_part[p];
+          staged_size += ck.compressed_size;
         }
 
         auto const chunk_offset = _current_chunk_offset[p];
@@ -2497,9 +2886,7 @@ void writer::impl::write_parquet_data_to_sink(
         if (i == 0) { row_group.file_offset = chunk_offset; }
       }
     }
-    for (auto const& task : write_tasks) {
-      task.wait();
-    }
+    flush_staged_writes();
   }
 
   if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
@@ -2508,6 +2895,9 @@ void writer::impl::write_parquet_data_to_sink(
 
     // add column and offset indexes to metadata
     if (num_rowgroups != 0) {
+      // column indexes in chunk order, with the partition they belong to
+      std::vector<std::pair<int, std::vector<uint8_t>>> column_indexes;
+      column_indexes.reserve(num_rowgroups * num_columns);
       auto curr_page_idx = chunks[0][0].first_page;
       for (auto r = 0; r < static_cast<int>(num_rowgroups); r++) {
         int const p           = rg_to_part[r];
@@ -2518,7 +2908,7 @@ void writer::impl::write_parquet_data_to_sink(
           auto const& column_chunk_meta = row_group.columns[i].meta_data;
 
           // start transfer of the column index
-          std::vector<uint8_t> column_idx;
+          auto& column_idx = column_indexes.emplace_back(p, std::vector<uint8_t>{}).second;
           column_idx.resize(ck.column_index_size);
           CUDF_CUDA_TRY(cudaMemcpyAsync(column_idx.data(),
                                         ck.column_index_blob,
@@ -2550,11 +2940,14 @@ void writer::impl::write_parquet_data_to_sink(
 
           if (is_byte_arr) { offset_idx.unencoded_byte_array_data_bytes = std::move(var_bytes); }
 
-          _stream.synchronize();
           _agg_meta->file(p).offset_indexes.emplace_back(std::move(offset_idx));
-          _agg_meta->file(p).column_indexes.emplace_back(std::move(column_idx));
         }
       }
+      // wait for all column index transfers at once
+      _stream.synchronize();
+      for (auto& [p, column_idx] : column_indexes) {
+        _agg_meta->file(p).column_indexes.emplace_back(std::move(column_idx));
+      }
     }
   }
 }
@@ -2564,6 +2957,7 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
 {
   if (_closed) { return nullptr; }
   _closed = true;
+  _pending_writes.wait();
   if (not _last_write_successful) { return nullptr; }
   for (size_t p = 0; p < _out_sink.size(); p++) {
     std::vector<uint8_t> buffer;
@@ -2571,9 +2965,21 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
     file_ender_s fendr;
     auto& fmd = _agg_meta->file(p);
 
+    // write bloom filters, updating column metadata along the way
+    int chunkidx = 0;
+    for (auto& r : fmd.row_groups) {
+      for (auto& c : r.columns) {
+        auto const& bloom_filter = fmd.bloom_filters[chunkidx++];
+        if (bloom_filter.empty()) { continue; }
+        c.meta_data.bloom_filter_offset = _out_sink[p]->bytes_written();
+        c.meta_data.bloom_filter_length = static_cast<int32_t>(bloom_filter.size());
+        _out_sink[p]->host_write(bloom_filter.data(), bloom_filter.size());
+      }
+    }
+
     if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
       // write column indices, updating column metadata along the way
-      int chunkidx = 0;
+      chunkidx = 0;
       for (auto& r : fmd.row_groups) {
         for (auto& c : r.columns) {
           auto const& index     = fmd.column_indexes[chunkidx++];
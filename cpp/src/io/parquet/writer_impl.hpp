@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "io/utilities/pending_device_writes.hpp"
 #include "parquet.hpp"
 #include "parquet_gpu.hpp"
 
@@ -152,6 +153,8 @@ class writer::impl {
   statistics_freq const _stats_granularity;
   dictionary_policy const _dict_policy;
   size_t const _max_dictionary_size;
+  bool const _dictionary_cardinality_estimate;
+  bool const _encoded_row_group_size;
   std::optional<size_type> const _max_page_fragment_size;
   bool const _int96_timestamps;
   bool const _utc_timestamps;
@@ -164,6 +167,8 @@ class writer::impl {
                          // indicate that we are guaranteeing a single table
                          // write. This enables some internal optimizations.
   std::vector<std::unique_ptr<data_sink>> const _out_sink;
+  // Device writes to `_out_sink` that are in flight; destroyed before the sinks
+  cudf::io::detail::pending_device_writes _pending_writes;
 
   // Internal states, filled during `write()` and written to sink during `write` and `close()`.
   std::unique_ptr<table_input_metadata> _table_meta;
@@ -279,30 +279,23 @@ __device__ void cooperative_load(T& destination, T const* source = nullptr)
 }
 
 /**
- * @brief Kernel to calculate group statistics
+ * @brief Calculates the statistics of a group using all the threads of a block
  *
- * @param[out] chunks Statistics results [num_chunks]
- * @param[in] groups Statistics row groups [num_chunks]
+ * Kernels which already read the rows of a group can use this to gather its statistics in the
+ * same pass.
+ *
+ * @param[in,out] state `col` and `group` describe the rows to use; the result is stored into `ck`,
+ * which must be zero-initialized
+ * @param storage Temporary storage for the block reductions
+ * @param int96_timestamps Whether timestamps are written as INT96 (Parquet only)
  * @tparam block_size Dimension of the block
  * @tparam IO File format for which statistics calculation is being done
  */
 template <int block_size, detail::io_file_format IO>
-CUDF_KERNEL void __launch_bounds__(block_size, 1)
-  gpu_calculate_group_statistics(statistics_chunk* chunks,
-                                 statistics_group const* groups,
-                                 bool const int96_timestamps)
+__device__ void calculate_group_statistics_block(stats_state_s& state,
+                                                 block_reduce_storage<block_size>& storage,
+                                                 bool const int96_timestamps)
 {
-  __shared__ __align__(8) stats_state_s state;
-  __shared__ block_reduce_storage<block_size> storage;
-
-  // Load state members
-  cooperative_load(state.group, &groups[blockIdx.x]);
-  cooperative_load(state.ck);
-  __syncthreads();
-  cooperative_load(state.col, state.group.col);
-  __syncthreads();
-
-  // Calculate statistics
   if constexpr (IO == detail::io_file_format::PARQUET) {
     // Do not convert ns to us for int64 timestamps
     if (not int96_timestamps) {
@@ -328,6 +321,34 @@ CUDF_KERNEL void __launch_bounds__(block_size, 1)
                     state,
                     threadIdx.x);
   }
+}
+
+/**
+ * @brief Kernel to calculate group statistics
+ *
+ * @param[out] chunks Statistics results [num_chunks]
+ * @param[in] groups Statistics row groups [num_chunks]
+ * @tparam block_size Dimension of the block
+ * @tparam IO File format for which statistics calculation is being done
+ */
+template <int block_size, detail::io_file_format IO>
+CUDF_KERNEL void __launch_bounds__(block_size, 1)
+  gpu_calculate_group_statistics(statistics_chunk* chunks,
+                                 statistics_group const* groups,
+                                 bool const int96_timestamps)
+{
+  __shared__ __align__(8) stats_state_s state;
+  __shared__ block_reduce_storage<block_size> storage;
+
+  // Load state members
+  cooperative_load(state.group, &groups[blockIdx.x]);
+  cooperative_load(state.ck);
+  __syncthreads();
+  cooperative_load(state.col, state.group.col);
+  __syncthreads();
+
+  // Calculate statistics
+  calculate_group_statistics_block<block_size, IO>(state, storage, int96_timestamps);
   __syncthreads();
 
   cooperative_load(chunks[blockIdx.x], &state.ck);
@@ -248,6 +248,39 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
     }
   }
 
+  /**
+   * @brief Skips the BGZIP blocks whose decompressed data lies within the next `size` bytes
+   *
+   * Only the header and footer of a skipped block are read; its compressed data is neither read
+   * nor decompressed, so skipping to a byte range deep into a file only costs a seek per block.
+   *
+   * @param size Maximum number of decompressed bytes to skip
+   * @return The number of decompressed bytes skipped
+   */
+  std::size_t skip_compressed_blocks(std::size_t size)
+  {
+    std::size_t skipped_size = 0;
+    while (true) {
+      // calling peek on an already EOF stream causes it to fail, we need to avoid that
+      if (_data_stream->eof()) { break; }
+      _data_stream->peek();
+      // the last GZIP block is restricted to the bytes up to _local_end, so it is always read
+      if (_data_stream->eof() || _compressed_pos >= _compressed_end) { break; }
+      auto const block_begin = _data_stream->tellg();
+      auto const header      = detail::bgzip::read_header(*_data_stream);
+      _data_stream->seekg(header.data_size(), std::ios_base::cur);
+      auto const footer = detail::bgzip::read_footer(*_data_stream);
+      if (skipped_size + footer.decompressed_size > size) {
+        // the block contains data past the skipped range, it needs to be read
+        _data_stream->seekg(block_begin);
+        break;
+      }
+      skipped_size += footer.decompressed_size;
+      _compressed_pos += header.block_size;
+    }
+    return skipped_size;
+  }
+
   constexpr static std::size_t chunk_load_size = 1 << 24;  // load 16 MB of data by default
 
  public:
@@ -282,6 +315,7 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
     while (read_size > _curr_blocks.remaining_size()) {
       read_size -= _curr_blocks.remaining_size();
       _curr_blocks.consume_bytes(_curr_blocks.remaining_size());
+      read_size -= skip_compressed_blocks(read_size);
       read_next_compressed_chunk(chunk_load_size);
       // calling peek on an already EOF stream causes it to fail, we need to avoid that
       if (_data_stream->eof()) { break; }
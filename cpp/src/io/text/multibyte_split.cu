@@ -27,6 +27,7 @@
 #include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/io/text/detail/multistate.hpp>
 #include <cudf/io/text/detail/tile_state.hpp>
+#include <cudf/io/text/detail/trie.hpp>
 #include <cudf/io/text/multibyte_split.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
@@ -43,15 +44,20 @@
 #include <cub/block/block_scan.cuh>
 #include <cuda/functional>
 #include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -90,6 +96,73 @@ constexpr multistate transition(char c, multistate state, cudf::device_span<char
   return result;
 }
 
+/**
+ * @brief Finds matches of a single delimiter, tracking partial matches by their position in the
+ * delimiter.
+ */
+struct delimiter_matcher {
+  cudf::device_span<char const> delim;
+
+  __device__ multistate transition_init(char c) { return ::transition_init(c, delim); }
+
+  __device__ multistate transition(char c, multistate state)
+  {
+    return ::transition(c, state, delim);
+  }
+
+  __device__ bool is_match(multistate state) { return state.max_tail() == delim.size(); }
+};
+
+/**
+ * @brief Finds matches of any of a set of delimiters, tracking partial matches by their node in
+ * the trie of all delimiters.
+ */
+struct trie_matcher {
+  cudf::io::text::detail::trie_device_view trie;
+
+  __device__ multistate transition_init(char c) { return trie.transition_init(c); }
+
+  __device__ multistate transition(char c, multistate state) { return trie.transition(c, state); }
+
+  __device__ bool is_match(multistate state)
+  {
+    for (uint8_t i = 0; i < state.size(); i++) {
+      if (trie.is_match(state.get_tail(i))) { return true; }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Matches a single-byte delimiter.
+ */
+struct byte_matcher {
+  char delim;
+
+  __device__ bool operator()(char c) const { return c == delim; }
+};
+
+/**
+ * @brief Matches any of a set of single-byte delimiters.
+ */
+struct byte_set_matcher {
+  uint32_t bits[256 / 32];
+
+  explicit byte_set_matcher(std::vector<std::string> const& delimiters) : bits{}
+  {
+    for (auto const& delimiter : delimiters) {
+      auto const b = static_cast<uint8_t>(delimiter[0]);
+      bits[b / 32] |= 1u << (b % 32);
+    }
+  }
+
+  __device__ bool operator()(char c) const
+  {
+    auto const b = static_cast<uint8_t>(c);
+    return (bits[b / 32] >> (b % 32)) & 1u;
+  }
+};
+
 struct PatternScan {
   using BlockScan         = cub::BlockScan<multistate, THREADS_PER_TILE>;
   using BlockScanCallback = cudf::io::text::detail::scan_tile_state_callback<multistate>;
@@ -104,16 +177,17 @@ struct PatternScan {
 
   __device__ inline PatternScan(TempStorage& temp_storage) : _temp_storage(temp_storage.Alias()) {}
 
+  template <typename Matcher>
   __device__ inline void Scan(cudf::size_type tile_idx,
                               cudf::io::text::detail::scan_tile_state_view<multistate> tile_state,
-                              cudf::device_span<char const> delim,
+                              Matcher& matcher,
                               char (&thread_data)[ITEMS_PER_THREAD],
                               multistate& thread_multistate)
   {
-    thread_multistate = transition_init(thread_data[0], delim);
+    thread_multistate = matcher.transition_init(thread_data[0]);
 
     for (uint32_t i = 1; i < ITEMS_PER_THREAD; i++) {
-      thread_multistate = transition(thread_data[i], thread_multistate, delim);
+      thread_multistate = matcher.transition(thread_data[i], thread_multistate);
     }
 
     auto prefix_callback = BlockScanCallback(tile_state, tile_idx);
@@ -153,13 +227,14 @@ CUDF_KERNEL void multibyte_split_init_kernel(
   }
 }
 
+template <typename Matcher>
 CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   cudf::size_type base_tile_idx,
   byte_offset base_input_offset,
   output_offset base_output_offset,
   cudf::io::text::detail::scan_tile_state_view<multistate> tile_multistates,
   cudf::io::text::detail::scan_tile_state_view<output_offset> tile_output_offsets,
-  cudf::device_span<char const> delim,
+  Matcher matcher,
   cudf::device_span<char const> chunk_input_chars,
   cudf::split_device_span<byte_offset> row_offsets)
 {
@@ -196,7 +271,7 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
 
   __syncthreads();  // required before temp_memory re-use
   PatternScan(temp_storage.pattern_scan)
-    .Scan(tile_idx, tile_multistates, delim, thread_chars, thread_multistate);
+    .Scan(tile_idx, tile_multistates, matcher, thread_chars, thread_multistate);
 
   // STEP 3: Flag matches
 
@@ -204,9 +279,8 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   uint32_t thread_match_mask[(ITEMS_PER_THREAD + 31) / 32]{};
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_multistate       = transition(thread_chars[i], thread_multistate, delim);
-    auto const thread_state = thread_multistate.max_tail();
-    auto const is_match     = i < thread_input_size and thread_state == delim.size();
+    thread_multistate   = matcher.transition(thread_chars[i], thread_multistate);
+    auto const is_match = i < thread_input_size and matcher.is_match(thread_multistate);
     thread_match_mask[i / 32] |= uint32_t{is_match} << (i % 32);
     thread_offset += output_offset{is_match};
   }
@@ -230,12 +304,13 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   }
 }
 
+template <typename ByteMatcher>
 CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void byte_split_kernel(
   cudf::size_type base_tile_idx,
   byte_offset base_input_offset,
   output_offset base_output_offset,
   cudf::io::text::detail::scan_tile_state_view<output_offset> tile_output_offsets,
-  char delim,
+  ByteMatcher delim,
   cudf::device_span<char const> chunk_input_chars,
   cudf::split_device_span<byte_offset> row_offsets)
 {
@@ -271,7 +346,7 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void byte_split_kernel(
   uint32_t thread_match_mask[(ITEMS_PER_THREAD + 31) / 32]{};
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    auto const is_match = i < thread_input_size and thread_chars[i] == delim;
+    auto const is_match = i < thread_input_size and delim(thread_chars[i]);
     thread_match_mask[i / 32] |= uint32_t{is_match} << (i % 32);
     thread_offset += output_offset{is_match};
   }
@@ -303,7 +378,7 @@ namespace text {
 namespace detail {
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
-                                              std::string const& delimiter,
+                                              std::vector<std::string> const& delimiters,
                                               byte_range_info byte_range,
                                               bool strip_delimiters,
                                               rmm::cuda_stream_view stream,
@@ -311,28 +386,59 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 {
   CUDF_FUNC_RANGE();
 
-  if (byte_range.empty()) { return make_empty_column(type_id::STRING); }
+  CUDF_EXPECTS(not delimiters.empty(), "at least one delimiter is required.");
+  CUDF_EXPECTS(std::none_of(delimiters.begin(),
+                            delimiters.end(),
+                            [](auto const& delimiter) { return delimiter.empty(); }),
+               "delimiters must not be empty.");
 
-  auto device_delim = cudf::string_scalar(delimiter, true, stream, mr);
+  if (byte_range.empty()) { return make_empty_column(type_id::STRING); }
 
-  auto sorted_delim = delimiter;
-  std::sort(sorted_delim.begin(), sorted_delim.end());
-  auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
-    sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
-      if (std::get<0>(acc) != c) {
-        std::get<0>(acc) = c;
-        std::get<1>(acc) = 0;
-      }
-      std::get<1>(acc)++;
-      std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
-      return acc;
+  auto const is_single_delimiter = delimiters.size() == 1;
+  auto const is_byte_delimiter =
+    std::all_of(delimiters.begin(), delimiters.end(), [](auto const& delimiter) {
+      return delimiter.size() == 1;
     });
-
-  CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
-               "delimiter contains too many duplicate tokens to produce a deterministic result.");
-
-  CUDF_EXPECTS(delimiter.size() < multistate::max_segment_value,
-               "delimiter contains too many total tokens to produce a deterministic result.");
+  auto const max_delimiter_size =
+    std::max_element(delimiters.begin(), delimiters.end(), [](auto const& a, auto const& b) {
+      return a.size() < b.size();
+    })->size();
+
+  auto const& delimiter = delimiters.front();
+  auto device_delim     = cudf::string_scalar(delimiter, true, stream, mr);
+  // a set of multi-byte delimiters is matched by tracking partial matches in the trie of all
+  // delimiters, a single delimiter by tracking the position within the delimiter
+  std::optional<trie> delimiter_trie;
+
+  if (is_single_delimiter) {
+    auto sorted_delim = delimiter;
+    std::sort(sorted_delim.begin(), sorted_delim.end());
+    auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
+      sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
+        if (std::get<0>(acc) != c) {
+          std::get<0>(acc) = c;
+          std::get<1>(acc) = 0;
+        }
+        std::get<1>(acc)++;
+        std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
+        return acc;
+      });
+
+    CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
+                 "delimiter contains too many duplicate tokens to produce a deterministic result.");
+
+    CUDF_EXPECTS(delimiter.size() < multistate::max_segment_value,
+                 "delimiter contains too many total tokens to produce a deterministic result.");
+  } else if (not is_byte_delimiter) {
+    delimiter_trie = trie::create(delimiters, stream, rmm::mr::get_current_device_resource());
+
+    CUDF_EXPECTS(delimiter_trie->max_duplicate_tokens() < multistate::max_segment_count,
+                 "delimiters contain too many duplicate tokens to produce a deterministic result.");
+
+    // the trie nodes, excluding its trailing sentinel node, are the states of the multistate
+    CUDF_EXPECTS(delimiter_trie->size() - 2 < multistate::max_segment_value,
+                 "delimiters contain too many total tokens to produce a deterministic result.");
+  }
 
   auto const concurrency = 2;
 
@@ -371,7 +477,8 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     stream);
 
   auto reader               = source.create_reader();
-  auto chunk_offset         = std::max<byte_offset>(0, byte_range.offset() - delimiter.size());
+  auto chunk_offset =
+    std::max<byte_offset>(0, byte_range.offset() - static_cast<byte_offset>(max_delimiter_size));
   auto const byte_range_end = byte_range.offset() + byte_range.size();
   reader->skip_bytes(chunk_offset);
   // amortize output chunk allocations over 8 worst-case outputs. This limits the overallocation
@@ -418,32 +525,47 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 
     CUDF_CUDA_TRY(cudaStreamWaitEvent(scan_stream.value(), last_launch_event));
 
-    if (delimiter.size() == 1) {
+    if (is_byte_delimiter) {
       // the single-byte case allows for a much more efficient kernel, so we special-case it
-      byte_split_kernel<<<tiles_in_launch,
-                          THREADS_PER_TILE,
-                          0,
-                          scan_stream.value()>>>(  //
-        base_tile_idx,
-        chunk_offset,
-        row_offset_storage.size(),
-        tile_offsets,
-        delimiter[0],
-        *chunk,
-        row_offsets);
+      auto const launch_byte_split = [&](auto byte_delimiter) {
+        byte_split_kernel<<<tiles_in_launch,
+                            THREADS_PER_TILE,
+                            0,
+                            scan_stream.value()>>>(  //
+          base_tile_idx,
+          chunk_offset,
+          row_offset_storage.size(),
+          tile_offsets,
+          byte_delimiter,
+          *chunk,
+          row_offsets);
+      };
+      if (is_single_delimiter) {
+        launch_byte_split(byte_matcher{delimiter[0]});
+      } else {
+        launch_byte_split(byte_set_matcher{delimiters});
+      }
     } else {
-      multibyte_split_kernel<<<tiles_in_launch,
-                               THREADS_PER_TILE,
-                               0,
-                               scan_stream.value()>>>(  //
-        base_tile_idx,
-        chunk_offset,
-        row_offset_storage.size(),
-        tile_multistates,
-        tile_offsets,
-        {device_delim.data(), static_cast<std::size_t>(device_delim.size())},
-        *chunk,
-        row_offsets);
+      auto const launch_multibyte_split = [&](auto matcher) {
+        multibyte_split_kernel<<<tiles_in_launch,
+                                 THREADS_PER_TILE,
+                                 0,
+                                 scan_stream.value()>>>(  //
+          base_tile_idx,
+          chunk_offset,
+          row_offset_storage.size(),
+          tile_multistates,
+          tile_offsets,
+          matcher,
+          *chunk,
+          row_offsets);
+      };
+      if (is_single_delimiter) {
+        launch_multibyte_split(delimiter_matcher{
+          {device_delim.data(), static_cast<std::size_t>(device_delim.size())}});
+      } else {
+        launch_multibyte_split(trie_matcher{delimiter_trie->view()});
+      }
     }
 
     // load the next chunk
@@ -533,7 +655,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
                         return static_cast<int32_t>(global_offset - baseline);
                       }));
   auto string_count = offsets.size() - 1;
-  if (strip_delimiters) {
+  if (strip_delimiters and is_single_delimiter) {
     auto it = cudf::detail::make_counting_transform_iterator(
       0,
       cuda::proclaim_return_type<thrust::pair<char*, int32_t>>(
@@ -551,6 +673,50 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
           };
         }));
     return cudf::strings::detail::make_strings_column(it, it + string_count, stream, mr);
+  } else if (strip_delimiters) {
+    // rows can end with any of the delimiters: strip the longest one that ends the row
+    std::vector<size_type> h_delimiter_offsets{0};
+    for (auto const& delim : delimiters) {
+      h_delimiter_offsets.push_back(h_delimiter_offsets.back() +
+                                    static_cast<size_type>(delim.size()));
+    }
+    auto const delimiter_offsets = cudf::detail::make_device_uvector_sync(
+      h_delimiter_offsets, stream, rmm::mr::get_current_device_resource());
+    auto const delimiter_chars = cudf::detail::make_device_uvector_sync(
+      std::accumulate(delimiters.begin(), delimiters.end(), std::string{}),
+      stream,
+      rmm::mr::get_current_device_resource());
+    auto it = cudf::detail::make_counting_transform_iterator(
+      0,
+      cuda::proclaim_return_type<thrust::pair<char*, int32_t>>(
+        [ofs         = offsets.data(),
+         chars       = chars.data(),
+         delim_chars = delimiter_chars.data(),
+         delim_ofs   = delimiter_offsets.data(),
+         num_delims  = static_cast<size_type>(delimiters.size()),
+         last_row    = static_cast<size_type>(string_count) - 1,
+         insert_end] __device__(size_type row) {
+          auto const begin = ofs[row];
+          auto const end   = ofs[row + 1];
+          if (row == last_row && insert_end) {
+            return thrust::make_pair(chars + begin, end - begin);
+          }
+          size_type delim_size = 0;
+          for (size_type d = 0; d < num_delims; d++) {
+            auto const size = delim_ofs[d + 1] - delim_ofs[d];
+            // like the row, the delimiter ends at `end`; it may overlap the previous row
+            if (size > delim_size && size <= end &&
+                thrust::equal(thrust::seq,
+                              delim_chars + delim_ofs[d],
+                              delim_chars + delim_ofs[d + 1],
+                              chars + end - size)) {
+              delim_size = size;
+            }
+          }
+          return thrust::make_pair(chars + begin,
+                                   std::max<size_type>(0, end - begin - delim_size));
+        }));
+    return cudf::strings::detail::make_strings_column(it, it + string_count, stream, mr);
   } else {
     return cudf::make_strings_column(
       string_count,
@@ -576,11 +742,19 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
                                               std::string const& delimiter,
                                               parse_options options,
                                               rmm::device_async_resource_ref mr)
+{
+  return multibyte_split(source, std::vector<std::string>{delimiter}, options, mr);
+}
+
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              parse_options options,
+                                              rmm::device_async_resource_ref mr)
 {
   auto stream = cudf::get_default_stream();
 
   auto result = detail::multibyte_split(
-    source, delimiter, options.byte_range, options.strip_delimiters, stream, mr);
+    source, delimiters, options.byte_range, options.strip_delimiters, stream, mr);
 
   return result;
 }
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <functional>
+#include <list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Converts AST expression to an AST over Bloom filter membership columns
+ *
+ * Each `column == literal` predicate is replaced with a reference to a BOOL8 column containing,
+ * per pruning unit (e.g. row group), whether the unit's Bloom filter might contain the literal.
+ * Column 0 of the membership table is always `true` and stands in for every sub-expression that
+ * cannot be answered by a Bloom filter. Only `LOGICAL_AND` and `LOGICAL_OR` are propagated, so the
+ * converted expression evaluates to `false` only when the unit is guaranteed not to match.
+ */
+class bloom_filter_expression_converter : public ast::detail::expression_transformer {
+ public:
+  bloom_filter_expression_converter(ast::expression const& expr,
+                                    size_type num_columns,
+                                    host_span<data_type const> output_dtypes)
+    : _num_columns{num_columns}, _output_dtypes{output_dtypes}
+  {
+    _always_true = &_col_ref.emplace_back(0);
+    expr.accept(*this);
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    _bloom_filter_expr = std::reference_wrapper<ast::expression const>(*_always_true);
+    return *_always_true;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
+                 "Bloom filter AST supports only left table");
+    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
+                 "Column index cannot be more than number of columns in the table");
+    _bloom_filter_expr = std::reference_wrapper<ast::expression const>(*_always_true);
+    return *_always_true;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    CUDF_FAIL("Column name reference is not supported in Bloom filter AST");
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    std::reference_wrapper<ast::expression const> result = *_always_true;
+    if (op == ast_operator::EQUAL) {
+      auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+      auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+      if (col != nullptr and lit != nullptr) {
+        col->accept(*this);
+        auto const col_index = col->get_column_index();
+        if (lit->get_data_type() == _output_dtypes[col_index]) {
+          _predicates.push_back({col_index, lit});
+          result = _col_ref.emplace_back(static_cast<size_type>(_predicates.size()));
+        }
+      }
+    } else if (op == ast_operator::LOGICAL_AND or op == ast_operator::LOGICAL_OR) {
+      auto new_operands = visit_operands(operands);
+      result            = _operators.emplace_back(op, new_operands.front(), new_operands.back());
+    }
+    // All other operators, including NOT, cannot be answered by membership tests.
+    _bloom_filter_expr = result;
+    return result;
+  }
+
+  /**
+   * @brief Returns the AST to apply on the Bloom filter membership table.
+   *
+   * @return AST operation expression
+   */
+  [[nodiscard]] std::reference_wrapper<ast::expression const> get_bloom_filter_expr() const
+  {
+    return _bloom_filter_expr.value().get();
+  }
+
+  /**
+   * @brief Returns the equality predicates as (output column index, literal) pairs.
+   *
+   * Predicate `i` corresponds to column `i + 1` of the membership table.
+   */
+  [[nodiscard]] auto const& get_equality_predicates() const { return _predicates; }
+
+ private:
+  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
+    std::vector<std::reference_wrapper<ast::expression const>> operands)
+  {
+    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
+    for (auto const& operand : operands) {
+      auto const new_operand = operand.get().accept(*this);
+      transformed_operands.push_back(new_operand);
+    }
+    return transformed_operands;
+  }
+
+  std::optional<std::reference_wrapper<ast::expression const>> _bloom_filter_expr;
+  size_type _num_columns;
+  host_span<data_type const> _output_dtypes;
+  ast::column_reference const* _always_true;
+  std::vector<std::pair<size_type, ast::literal const*>> _predicates;
+  std::list<ast::column_reference> _col_ref;
+  std::list<ast::operation> _operators;
+};
+
+}  // namespace cudf::io::detail
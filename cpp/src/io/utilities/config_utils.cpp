@@ -26,7 +26,9 @@
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <atomic>
 #include <cstdlib>
+#include <new>
 #include <string>
 
 namespace cudf::io {
@@ -207,6 +209,65 @@ static_assert(cuda::mr::resource_with<fixed_pinned_pool_memory_resource,
                                       cuda::mr::host_accessible>,
               "");
 
+/**
+ * @brief Host memory resource that allocates pageable memory
+ *
+ * Used for host allocations above the pinned allocation threshold.
+ */
+class pageable_host_memory_resource {
+ public:
+  void* allocate(std::size_t bytes, std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT)
+  {
+    return ::operator new(bytes, std::align_val_t{alignment});
+  }
+
+  void deallocate(void* ptr,
+                  std::size_t bytes,
+                  std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT) noexcept
+  {
+    ::operator delete(ptr, bytes, std::align_val_t{alignment});
+  }
+
+  void* allocate_async(std::size_t bytes, cuda::stream_ref) { return allocate(bytes); }
+
+  void* allocate_async(std::size_t bytes, std::size_t alignment, cuda::stream_ref)
+  {
+    return allocate(bytes, alignment);
+  }
+
+  void deallocate_async(void* ptr, std::size_t bytes, cuda::stream_ref) noexcept
+  {
+    deallocate(ptr, bytes);
+  }
+
+  void deallocate_async(void* ptr,
+                        std::size_t bytes,
+                        std::size_t alignment,
+                        cuda::stream_ref) noexcept
+  {
+    deallocate(ptr, bytes, alignment);
+  }
+
+  bool operator==(pageable_host_memory_resource const&) const { return true; }
+
+  bool operator!=(pageable_host_memory_resource const&) const { return false; }
+
+  [[maybe_unused]] friend void get_property(pageable_host_memory_resource const&,
+                                            cuda::mr::host_accessible) noexcept
+  {
+  }
+};
+
+static_assert(
+  cuda::mr::async_resource_with<pageable_host_memory_resource, cuda::mr::host_accessible>, "");
+
+std::atomic<size_t>& allocate_host_as_pinned_threshold()
+{
+  static std::atomic<size_t> threshold =
+    detail::getenv_or<size_t>("LIBCUDF_PINNED_ALLOCATION_THRESHOLD", size_t{16} * 1024 * 1024);
+  return threshold;
+}
+
 }  // namespace
 
 CUDF_EXPORT rmm::host_async_resource_ref& make_default_pinned_mr(std::optional<size_t> config_size)
@@ -290,4 +351,22 @@ bool config_default_host_memory_resource(host_mr_options const& opts)
   return did_configure;
 }
 
+void set_allocate_host_as_pinned_threshold(size_t threshold)
+{
+  allocate_host_as_pinned_threshold() = threshold;
+}
+
+size_t get_allocate_host_as_pinned_threshold() { return allocate_host_as_pinned_threshold(); }
+
+namespace detail {
+
+rmm::host_async_resource_ref host_memory_resource_for(size_t size)
+{
+  static pageable_host_memory_resource pageable_mr{};
+  if (size <= get_allocate_host_as_pinned_threshold()) { return get_host_memory_resource(); }
+  return pageable_mr;
+}
+
+}  // namespace detail
+
 }  // namespace cudf::io
@@ -17,6 +17,8 @@
 
 #include <cudf/detail/utilities/logger.hpp>
 
+#include <rmm/resource_ref.hpp>
+
 #include <sstream>
 #include <string>
 
@@ -78,4 +80,12 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+/**
+ * @brief Returns the resource to use for a host allocation of `size` bytes
+ *
+ * Allocations up to the threshold set with `set_allocate_host_as_pinned_threshold` use the host
+ * memory resource (a pinned pool by default); larger allocations use pageable memory.
+ */
+rmm::host_async_resource_ref host_memory_resource_for(size_t size);
+
 }  // namespace cudf::io::detail
@@ -83,11 +83,12 @@ class file_sink : public data_sink {
     _bytes_written += size;
 
     if (!_kvikio_file.closed()) {
-      // KvikIO's `pwrite()` returns a `std::future<size_t>` so we convert it
-      // to `std::future<void>`
-      return std::async(std::launch::deferred, [this, gpu_data, size, offset] {
-        _kvikio_file.pwrite(gpu_data, size, offset).get();
-      });
+      // Start the write now so that it overlaps with the caller's work; KvikIO's `pwrite()`
+      // returns a `std::future<size_t>` so we convert it to `std::future<void>`
+      return std::async(std::launch::deferred,
+                        [write = _kvikio_file.pwrite(gpu_data, size, offset)]() mutable {
+                          write.get();
+                        });
     }
     return _cufile_out->write_async(gpu_data, offset, size);
   }
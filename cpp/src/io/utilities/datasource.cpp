@@ -17,6 +17,7 @@
 #include "file_io_utilities.hpp"
 #include "io/utilities/config_utils.hpp"
 
+#include <cudf/detail/utilities/rmm_host_vector.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +31,9 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <unordered_map>
 
 namespace cudf {
@@ -255,7 +259,8 @@ class direct_read_source : public file_source {
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
-    std::vector<uint8_t> v(read_size);
+    auto v = cudf::detail::rmm_host_vector<uint8_t>(
+      read_size, {detail::host_memory_resource_for(read_size), cudf::get_default_stream()});
     CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
@@ -418,6 +423,13 @@ class user_datasource_wrapper : public datasource {
     return source->device_read_async(offset, size, dst, stream);
   }
 
+  std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                       host_span<uint8_t* const> dsts,
+                                       size_t max_gap) override
+  {
+    return source->host_read_ranges(ranges, dsts, max_gap);
+  }
+
   [[nodiscard]] size_t size() const override { return source->size(); }
 
   [[nodiscard]] bool is_empty() const override { return source->is_empty(); }
@@ -428,6 +440,47 @@ class user_datasource_wrapper : public datasource {
 
 }  // namespace
 
+std::vector<size_t> datasource::host_read_ranges(host_span<read_range const> ranges,
+                                                 host_span<uint8_t* const> dsts,
+                                                 size_t max_gap)
+{
+  CUDF_EXPECTS(ranges.size() == dsts.size(), "Each range needs a destination buffer");
+
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  std::vector<size_t> bytes_read(ranges.size(), 0);
+  for (size_t first = 0; first < order.size();) {
+    // merge the following ranges while they start within `max_gap` bytes of the merged range
+    auto const read_offset = ranges[order[first]].offset;
+    auto read_end          = read_offset + ranges[order[first]].size;
+    auto last              = first + 1;
+    while (last < order.size() and ranges[order[last]].offset <= read_end + max_gap) {
+      read_end = std::max(read_end, ranges[order[last]].offset + ranges[order[last]].size);
+      ++last;
+    }
+
+    if (last == first + 1) {
+      auto const idx  = order[first];
+      bytes_read[idx] = host_read(ranges[idx].offset, ranges[idx].size, dsts[idx]);
+    } else {
+      auto const buffer = host_read(read_offset, read_end - read_offset);
+      for (auto i = first; i < last; ++i) {
+        auto const idx        = order[i];
+        auto const buf_offset = ranges[idx].offset - read_offset;
+        if (buf_offset >= buffer->size()) { continue; }
+        bytes_read[idx] = std::min(ranges[idx].size, buffer->size() - buf_offset);
+        std::memcpy(dsts[idx], buffer->data() + buf_offset, bytes_read[idx]);
+      }
+    }
+    first = last;
+  }
+  return bytes_read;
+}
+
 std::unique_ptr<datasource> datasource::create(std::string const& filepath,
                                                size_t offset,
                                                size_t size)
@@ -23,6 +23,7 @@
 #include <cudf/io/types.hpp>
 #include <cudf/lists/list_view.hpp>
 #include <cudf/strings/detail/convert/fixed_point.cuh>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/span.hpp>
@@ -222,8 +223,10 @@ __host__ __device__ std::optional<T> parse_numeric(char const* begin,
   // Skip over the "0x" prefix for hex notation
   if (base == 16 && begin + 2 < end && *begin == '0' && *(begin + 1) == 'x') { begin += 2; }
 
-  // Handle the whole part of the number
-  // auto index = begin;
+  // Handle the whole part of the number, 8 digits at a time while possible
+  if constexpr (base == 10 && !std::is_same_v<T, bool>) {
+    cudf::strings::detail::parse_digits_by_eight(begin, end, value);
+  }
   while (begin < end) {
     if (*begin == opts.decimal) {
       ++begin;
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "config_utils.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Device writes to data sinks that are in flight, with the device buffers they read from
+ *
+ * Lets a writer return from a `write` call, and encode the next table, while the device writes of
+ * the current table complete. The number of writes in flight is bounded; adding a write beyond the
+ * bound waits for the oldest one. The bound can be set with the
+ * `LIBCUDF_MAX_PENDING_DEVICE_WRITES` environment variable.
+ */
+class pending_device_writes {
+ public:
+  pending_device_writes() = default;
+
+  pending_device_writes(pending_device_writes const&)            = delete;
+  pending_device_writes& operator=(pending_device_writes const&) = delete;
+
+  ~pending_device_writes()
+  {
+    // The buffers must outlive the writes that read from them
+    for (auto const& task : _tasks) {
+      if (task.valid()) { task.wait(); }
+    }
+  }
+
+  /**
+   * @brief Adds a write that is in flight, waiting for the oldest write if at the bound
+   */
+  void push(std::future<void>&& task)
+  {
+    if (_tasks.size() >= max_pending()) {
+      _tasks.front().get();
+      _tasks.pop_front();
+    }
+    _tasks.push_back(std::move(task));
+  }
+
+  /**
+   * @brief Keeps `buffer` alive until all writes in flight have completed
+   */
+  template <typename Buffer>
+  void hold(Buffer&& buffer)
+  {
+    _buffers.push_back(std::make_shared<std::decay_t<Buffer>>(std::forward<Buffer>(buffer)));
+  }
+
+  /**
+   * @brief Waits for all writes in flight and releases the buffers they read from
+   *
+   * @throws Rethrows the first error of the writes
+   */
+  void wait()
+  {
+    while (not _tasks.empty()) {
+      auto task = std::move(_tasks.front());
+      _tasks.pop_front();
+      task.get();
+    }
+    _buffers.clear();
+  }
+
+  /**
+   * @brief Returns whether any writes are in flight
+   */
+  [[nodiscard]] bool empty() const { return _tasks.empty(); }
+
+ private:
+  static std::size_t max_pending()
+  {
+    static auto const max_pending =
+      std::max<std::size_t>(getenv_or("LIBCUDF_MAX_PENDING_DEVICE_WRITES", std::size_t{64}), 1);
+    return max_pending;
+  }
+
+  std::vector<std::shared_ptr<void>> _buffers;
+  std::deque<std::future<void>> _tasks;
+};
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/detail/nvtx/ranges.hpp>
+
+#include <chrono>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief NVTX range over one stage of a reader that also adds its duration to the stage time
+ *
+ * Used by the chunked readers to report the time spent in each stage of a chunk in
+ * `reader_chunk_statistics`. The time is measured on the host, so the scope should end where the
+ * reader waits for the device work of the stage.
+ */
+class stage_range {
+ public:
+  /**
+   * @brief Starts the named range
+   *
+   * @param name Name of the NVTX range
+   * @param total Time to which the duration of the range is added when it ends
+   */
+  stage_range(char const* name, std::chrono::nanoseconds& total)
+    : _range{name}, _total{total}, _start{std::chrono::steady_clock::now()}
+  {
+  }
+
+  stage_range(stage_range const&)            = delete;
+  stage_range& operator=(stage_range const&) = delete;
+
+  ~stage_range() { _total += std::chrono::steady_clock::now() - _start; }
+
+ private:
+  cudf::scoped_range _range;
+  std::chrono::nanoseconds& _total;
+  std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace cudf::io::detail
@@ -14,14 +14,22 @@
  * limitations under the License.
  */
 
+#include "jit/cache.hpp"
+
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
 
 #include <cuda.h>
 
 #include <jitify2.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace cudf {
 namespace jit {
@@ -46,6 +54,32 @@ std::filesystem::path get_user_home_cache_dir()
 #define LIBCUDF_KERNEL_CACHE_PATH get_user_home_cache_dir()
 #endif
 
+/**
+ * @brief Copy the kernels of the shared read-only cache that are missing from a cache directory.
+ *
+ * The shared cache is named by the `LIBCUDF_KERNEL_CACHE_SHARED_PATH` environment variable and
+ * has the same `<version>/<compute capability>` layout as the writable cache. It is never written
+ * to, so a single directory can be mounted read-only into many containers.
+ */
+void seed_from_shared_cache(std::filesystem::path const& kernel_cache_path,
+                            std::filesystem::path const& relative_path)
+{
+  auto const shared_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_SHARED_PATH");
+  if (shared_path_env == nullptr) { return; }
+  auto const shared_cache_path = std::filesystem::path(shared_path_env) / relative_path;
+  if (shared_cache_path == kernel_cache_path) { return; }
+
+  // Failures only cost a compilation, so errors are ignored rather than reported
+  std::error_code ec;
+  for (auto const& entry : std::filesystem::directory_iterator(shared_cache_path, ec)) {
+    if (not entry.is_regular_file(ec)) { continue; }
+    std::filesystem::copy_file(entry.path(),
+                               kernel_cache_path / entry.path().filename(),
+                               std::filesystem::copy_options::skip_existing,
+                               ec);
+  }
+}
+
 /**
  * @brief Get the string path to the JITIFY kernel cache directory.
  *
@@ -71,7 +105,7 @@ std::filesystem::path get_cache_dir()
   // Cache path could be empty when env HOME is unset or LIBCUDF_KERNEL_CACHE_PATH is defined to be
   // empty, to disallow use of file cache at runtime.
   if (not kernel_cache_path.empty()) {
-    kernel_cache_path /= std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+    auto relative_path = std::filesystem::path(std::string{CUDF_STRINGIFY(CUDF_VERSION)});
 
     // Make per device cache based on compute capability. This is to avoid multiple devices of
     // different compute capability to access the same kernel cache.
@@ -83,7 +117,8 @@ std::filesystem::path get_cache_dir()
     CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
     int cc = cc_major * 10 + cc_minor;
 
-    kernel_cache_path /= std::to_string(cc);
+    relative_path /= std::to_string(cc);
+    kernel_cache_path /= relative_path;
 
     try {
       // `mkdir -p` the kernel cache path if it doesn't exist
@@ -92,6 +127,7 @@ std::filesystem::path get_cache_dir()
       // if directory creation fails for any reason, return empty path
       return std::filesystem::path();
     }
+    seed_from_shared_cache(kernel_cache_path, relative_path);
   }
   return kernel_cache_path;
 }
@@ -140,5 +176,64 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+namespace {
+
+/**
+ * @brief Counters behind `cudf::get_kernel_cache_statistics`.
+ */
+struct kernel_cache_tracker {
+  std::mutex mutex;
+  std::unordered_set<std::string> requested;  ///< Keys of the kernels requested so far
+  kernel_cache_statistics statistics;
+};
+
+kernel_cache_tracker& get_kernel_cache_tracker()
+{
+  static kernel_cache_tracker tracker;
+  return tracker;
+}
+
+}  // namespace
+
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           std::string const& header_name,
+                           std::string const& header_source)
+{
+  // jitify keys its cache on the program, the kernel name and the headers
+  auto key = preprog.name();
+  key.append(1, '\0').append(kernel_name).append(1, '\0').append(header_source);
+
+  auto& tracker    = get_kernel_cache_tracker();
+  auto const start = std::chrono::steady_clock::now();
+  auto kernel      = get_program_cache(preprog).get_kernel(
+    kernel_name, {}, {{header_name, header_source}}, {"-arch=sm_."});
+  auto const elapsed = std::chrono::steady_clock::now() - start;
+
+  std::lock_guard<std::mutex> lock(tracker.mutex);
+  if (tracker.requested.insert(std::move(key)).second) {
+    ++tracker.statistics.misses;
+    tracker.statistics.miss_time += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+  } else {
+    ++tracker.statistics.hits;
+  }
+  return kernel;
+}
+
 }  // namespace jit
+
+kernel_cache_statistics get_kernel_cache_statistics()
+{
+  auto& tracker = jit::get_kernel_cache_tracker();
+  std::lock_guard<std::mutex> lock(tracker.mutex);
+  return tracker.statistics;
+}
+
+void reset_kernel_cache_statistics()
+{
+  auto& tracker = jit::get_kernel_cache_tracker();
+  std::lock_guard<std::mutex> lock(tracker.mutex);
+  tracker.statistics = kernel_cache_statistics{};
+}
+
 }  // namespace cudf
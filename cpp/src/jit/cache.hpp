@@ -19,11 +19,28 @@
 #include <jitify2.hpp>
 
 #include <memory>
+#include <string>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Get a kernel of a preprocessed program whose operation is defined by a generated header.
+ *
+ * The request is recorded in the statistics returned by `cudf::get_kernel_cache_statistics`.
+ *
+ * @param preprog The preprocessed program containing the kernel
+ * @param kernel_name The instantiated name of the kernel
+ * @param header_name The name of the header that defines the operation of the kernel
+ * @param header_source The source of that header
+ * @return The compiled kernel
+ */
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           std::string const& header_name,
+                           std::string const& header_source);
+
 }  // namespace jit
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include "join/conditional_join.hpp"
 #include "join/conditional_join_kernels.cuh"
+#include "join/conditional_range_join.hpp"
 #include "join/join_common_utils.cuh"
 #include "join/join_common_utils.hpp"
 
@@ -37,6 +38,110 @@
 namespace cudf {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Computes an inner or left conditional join by evaluating the predicate on every pair of
+ * left and right rows
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_nested_loop_join(table_device_view const& left_table,
+                             table_device_view const& right_table,
+                             ast::detail::expression_parser const& parser,
+                             bool has_nulls,
+                             join_kind kernel_join_type,
+                             std::optional<std::size_t> output_size,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  // For inner joins we support optimizing the join by launching one thread for
+  // whichever table is larger rather than always using the left table.
+  auto swap_tables = (kernel_join_type == join_kind::INNER_JOIN) &&
+                     (right_table.num_rows() > left_table.num_rows());
+  detail::grid_1d const config(swap_tables ? right_table.num_rows() : left_table.num_rows(),
+                               DEFAULT_JOIN_BLOCK_SIZE);
+  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // If the join size was not provided as an input, compute it here.
+  std::size_t join_size;
+  if (output_size.has_value()) {
+    join_size = *output_size;
+  } else {
+    // Allocate storage for the counter used to get the size of the join output
+    rmm::device_scalar<std::size_t> size(0, stream, mr);
+    if (has_nulls) {
+      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          left_table,
+          right_table,
+          kernel_join_type,
+          parser.device_expression_data,
+          swap_tables,
+          size.data());
+    } else {
+      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          left_table,
+          right_table,
+          kernel_join_type,
+          parser.device_expression_data,
+          swap_tables,
+          size.data());
+    }
+    join_size = size.value(stream);
+  }
+
+  // The initial early exit clauses guarantee that we will not reach this point
+  // unless both the left and right tables are non-empty. Under that
+  // constraint, neither left nor full joins can return an empty result since
+  // at minimum we are guaranteed null matches for all non-matching rows. In
+  // all other cases (inner, left semi, and left anti joins) if we reach this
+  // point we can safely return an empty result.
+  if (join_size == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  rmm::device_scalar<std::size_t> write_index(0, stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  auto const& join_output_l = left_indices->data();
+  auto const& join_output_r = right_indices->data();
+
+  if (has_nulls) {
+    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        left_table,
+        right_table,
+        kernel_join_type,
+        join_output_l,
+        join_output_r,
+        write_index.data(),
+        parser.device_expression_data,
+        join_size,
+        swap_tables);
+  } else {
+    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        left_table,
+        right_table,
+        kernel_join_type,
+        join_output_l,
+        join_output_r,
+        write_index.data(),
+        parser.device_expression_data,
+        join_size,
+        swap_tables);
+  }
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
 std::unique_ptr<rmm::device_uvector<size_type>> conditional_join_anti_semi(
   table_view const& left,
   table_view const& right,
@@ -183,90 +288,27 @@ conditional_join(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows());
-  detail::grid_1d const config(swap_tables ? right.num_rows() : left.num_rows(),
-                               DEFAULT_JOIN_BLOCK_SIZE);
-  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
-
-  // If the join size was not provided as an input, compute it here.
-  std::size_t join_size;
-  if (output_size.has_value()) {
-    join_size = *output_size;
-  } else {
-    // Allocate storage for the counter used to get the size of the join output
-    rmm::device_scalar<std::size_t> size(0, stream, mr);
-    if (has_nulls) {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table,
-          *right_table,
-          kernel_join_type,
-          parser.device_expression_data,
-          swap_tables,
-          size.data());
-    } else {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table,
-          *right_table,
-          kernel_join_type,
-          parser.device_expression_data,
-          swap_tables,
-          size.data());
+  auto join_indices = [&] {
+    // If the predicate bounds a left column by right columns, only the pairs of each right row
+    // and the left rows within its bounds need to be evaluated rather than the cross product.
+    if (auto const range = find_range_predicate(binary_predicate, left, right);
+        range.has_value()) {
+      return conditional_range_join(left,
+                                    right,
+                                    *left_table,
+                                    *right_table,
+                                    parser,
+                                    has_nulls,
+                                    *range,
+                                    kernel_join_type,
+                                    stream,
+                                    mr);
     }
-    join_size = size.value(stream);
-  }
-
-  // The initial early exit clauses guarantee that we will not reach this point
-  // unless both the left and right tables are non-empty. Under that
-  // constraint, neither left nor full joins can return an empty result since
-  // at minimum we are guaranteed null matches for all non-matching rows. In
-  // all other cases (inner, left semi, and left anti joins) if we reach this
-  // point we can safely return an empty result.
-  if (join_size == 0) {
-    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
-                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
-  }
-
-  rmm::device_scalar<std::size_t> write_index(0, stream);
-
-  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-
-  auto const& join_output_l = left_indices->data();
-  auto const& join_output_r = right_indices->data();
-
-  if (has_nulls) {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size,
-        swap_tables);
-  } else {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size,
-        swap_tables);
-  }
-
-  auto join_indices = std::pair(std::move(left_indices), std::move(right_indices));
+    return conditional_nested_loop_join(
+      *left_table, *right_table, parser, has_nulls, kernel_join_type, output_size, stream, mr);
+  }();
 
   // For full joins, get the indices in the right table that were not joined to
   // by any row in the left table.
@@ -335,6 +377,23 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
+  // The matches of a range predicate are few enough to be found rather than counted
+  if (auto const range = find_range_predicate(binary_predicate, left, right);
+      range.has_value() and
+      (join_type == join_kind::INNER_JOIN or join_type == join_kind::LEFT_JOIN)) {
+    return conditional_range_join(left,
+                                  right,
+                                  *left_table,
+                                  *right_table,
+                                  parser,
+                                  has_nulls,
+                                  *range,
+                                  join_type,
+                                  stream,
+                                  rmm::mr::get_current_device_resource())
+      .first->size();
+  }
+
   // For inner joins we support optimizing the join by launching one thread for
   // whichever table is larger rather than always using the left table.
   auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows());
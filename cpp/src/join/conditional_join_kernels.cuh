@@ -469,6 +469,52 @@ CUDF_KERNEL void conditional_join_anti_semi(
   }
 }
 
+/**
+ * @brief Evaluates a predicate on candidate pairs of left and right rows
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam has_nulls Whether or not the inputs may contain nulls.
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[in] candidates_l The left rows of the candidate pairs
+ * @param[in] candidates_r The right rows of the candidate pairs
+ * @param[in] num_candidates The number of candidate pairs
+ * @param[out] matches Whether the predicate is true for each candidate pair
+ */
+template <int block_size, bool has_nulls>
+CUDF_KERNEL void evaluate_conditional_join_candidates(
+  table_device_view left_table,
+  table_device_view right_table,
+  ast::detail::expression_device_view device_expression_data,
+  cudf::size_type const* candidates_l,
+  cudf::size_type const* candidates_r,
+  std::size_t num_candidates,
+  bool* matches)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  auto const start_idx = cudf::detail::grid_1d::global_thread_id<block_size>();
+  auto const stride    = cudf::detail::grid_1d::grid_stride<block_size>();
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  for (auto idx = start_idx; idx < static_cast<cudf::thread_index_type>(num_candidates);
+       idx += stride) {
+    auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+    evaluator.evaluate(
+      output_dest, candidates_l[idx], candidates_r[idx], 0, thread_intermediate_storage);
+    matches[idx] = output_dest.is_valid() && output_dest.value();
+  }
+}
+
 }  // namespace detail
 
 }  // namespace cudf
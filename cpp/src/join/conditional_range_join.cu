@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/conditional_join_kernels.cuh"
+#include "join/conditional_range_join.hpp"
+#include "join/join_common_utils.cuh"
+#include "join/join_common_utils.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A comparison `left_column op right_column` of a left and a right column
+ */
+struct column_comparison {
+  size_type left_column;
+  size_type right_column;
+  ast::ast_operator op;
+};
+
+/**
+ * @brief Collects the comparisons of a left and a right column in the top-level conjunction of
+ * an expression
+ *
+ * Both operands of a conjunction must be true for a pair of rows to match, so each comparison of
+ * the conjunction bounds the matching rows on its own.
+ */
+class column_comparison_collector : public ast::detail::expression_transformer {
+ public:
+  column_comparison_collector(ast::expression const& expr) { expr.accept(*this); }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    if (op == ast_operator::LOGICAL_AND or op == ast_operator::NULL_LOGICAL_AND) {
+      for (auto const& operand : operands) {
+        operand.get().accept(*this);
+      }
+      return expr;
+    }
+    if (operands.size() != 2) { return expr; }
+
+    auto const* lhs = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+    auto const* rhs = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+    if (lhs == nullptr or rhs == nullptr) { return expr; }
+
+    // Normalize the comparison to have the left column first: `right op left` is `left op' right`
+    auto const lhs_is_left = lhs->get_table_source() == ast::table_reference::LEFT and
+                             rhs->get_table_source() == ast::table_reference::RIGHT;
+    auto const rhs_is_left = lhs->get_table_source() == ast::table_reference::RIGHT and
+                             rhs->get_table_source() == ast::table_reference::LEFT;
+    if (not lhs_is_left and not rhs_is_left) { return expr; }
+    auto const* left_ref  = lhs_is_left ? lhs : rhs;
+    auto const* right_ref = lhs_is_left ? rhs : lhs;
+    auto const normalized = [&]() -> std::optional<ast_operator> {
+      switch (op) {
+        case ast_operator::EQUAL: return op;
+        case ast_operator::LESS: return lhs_is_left ? op : ast_operator::GREATER;
+        case ast_operator::LESS_EQUAL: return lhs_is_left ? op : ast_operator::GREATER_EQUAL;
+        case ast_operator::GREATER: return lhs_is_left ? op : ast_operator::LESS;
+        case ast_operator::GREATER_EQUAL: return lhs_is_left ? op : ast_operator::LESS_EQUAL;
+        default: return std::nullopt;
+      }
+    }();
+    if (normalized.has_value()) {
+      _comparisons.push_back(
+        {left_ref->get_column_index(), right_ref->get_column_index(), *normalized});
+    }
+    return expr;
+  }
+
+  /**
+   * @brief Returns the comparisons of a left and a right column in the top-level conjunction
+   */
+  [[nodiscard]] std::vector<column_comparison> const& get_comparisons() const
+  {
+    return _comparisons;
+  }
+
+ private:
+  std::vector<column_comparison> _comparisons;
+};
+
+/**
+ * @brief Returns the bounds of `left_column` by the comparisons
+ */
+range_predicate make_range_predicate(std::vector<column_comparison> const& comparisons,
+                                     size_type left_column)
+{
+  auto range = range_predicate{left_column, {}, {}};
+  for (auto const& comparison : comparisons) {
+    if (comparison.left_column != left_column) { continue; }
+    auto const right_column = comparison.right_column;
+    switch (comparison.op) {
+      case ast::ast_operator::EQUAL:
+        range.lower_bounds.push_back({right_column, true});
+        range.upper_bounds.push_back({right_column, true});
+        break;
+      case ast::ast_operator::LESS: range.upper_bounds.push_back({right_column, false}); break;
+      case ast::ast_operator::LESS_EQUAL: range.upper_bounds.push_back({right_column, true}); break;
+      case ast::ast_operator::GREATER: range.lower_bounds.push_back({right_column, false}); break;
+      case ast::ast_operator::GREATER_EQUAL:
+        range.lower_bounds.push_back({right_column, true});
+        break;
+      default: break;
+    }
+  }
+  return range;
+}
+
+/**
+ * @brief Returns the number of candidate left rows of a right row
+ *
+ * The candidates of right row `i` are the sorted left rows in `[begins[i], ends[i])`, unless a
+ * bound of the right row is null.
+ */
+struct candidate_count_fn {
+  size_type const* begins;
+  size_type const* ends;
+  bitmask_type const* row_bitmask;  // right rows with valid bounds, or nullptr if all are valid
+
+  __device__ std::size_t operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row)) { return 0; }
+    return ends[row] > begins[row] ? ends[row] - begins[row] : 0;
+  }
+};
+
+}  // namespace
+
+std::optional<range_predicate> find_range_predicate(ast::expression const& binary_predicate,
+                                                    table_view const& left,
+                                                    table_view const& right)
+{
+  auto const collector = column_comparison_collector{binary_predicate};
+
+  // The sorted order of the left column must agree with the comparisons of the predicate
+  std::vector<column_comparison> comparisons;
+  std::copy_if(collector.get_comparisons().begin(),
+               collector.get_comparisons().end(),
+               std::back_inserter(comparisons),
+               [&](column_comparison const& comparison) {
+                 if (comparison.left_column >= left.num_columns() or
+                     comparison.right_column >= right.num_columns()) {
+                   return false;
+                 }
+                 auto const type = left.column(comparison.left_column).type();
+                 return type == right.column(comparison.right_column).type() and
+                        (cudf::is_numeric(type) or cudf::is_chrono(type));
+               });
+
+  // Prefer a left column bounded on both sides, whose ranges are usually far narrower
+  std::optional<range_predicate> best;
+  auto best_sides = 0;
+  for (auto const& comparison : comparisons) {
+    auto range       = make_range_predicate(comparisons, comparison.left_column);
+    auto const sides = static_cast<int>(not range.lower_bounds.empty()) +
+                       static_cast<int>(not range.upper_bounds.empty());
+    if (sides > best_sides) {
+      best       = std::move(range);
+      best_sides = sides;
+    }
+  }
+  return best;
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_range_join(table_view const& left,
+                       table_view const& right,
+                       table_device_view const& left_table,
+                       table_device_view const& right_table,
+                       ast::detail::expression_parser const& parser,
+                       bool has_nulls,
+                       range_predicate const& range,
+                       join_kind join_type,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(join_type == join_kind::INNER_JOIN or join_type == join_kind::LEFT_JOIN,
+               "Invalid join kind.");
+
+  auto const temp_mr       = rmm::mr::get_current_device_resource();
+  auto const column_order  = std::vector<order>{order::ASCENDING};
+  auto const null_ordering = std::vector<null_order>{null_order::AFTER};
+
+  // Sort the left rows on the bounded column, with the null rows, which match nothing, last
+  auto const left_keys = table_view{{left.column(range.left_column)}};
+  auto const sorted_order =
+    cudf::detail::sorted_order(left_keys, column_order, null_ordering, stream, temp_mr);
+  auto const sorted_keys = cudf::detail::gather(left_keys,
+                                                sorted_order->view(),
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                temp_mr);
+  auto const num_valid   = left_keys.num_rows() - left_keys.column(0).null_count();
+
+  auto const right_num_rows = right.num_rows();
+  rmm::device_uvector<size_type> begins(right_num_rows, stream);
+  rmm::device_uvector<size_type> ends(right_num_rows, stream);
+  thrust::fill(rmm::exec_policy_nosync(stream), begins.begin(), begins.end(), 0);
+  thrust::fill(rmm::exec_policy_nosync(stream), ends.begin(), ends.end(), num_valid);
+
+  // The sorted left values `>= v` start at the lower bound of `v`, and those `> v` at its upper
+  // bound. The values `<= v` end at the upper bound of `v`, and those `< v` at its lower bound.
+  auto const narrow_ranges = [&](std::vector<range_bound> const& bounds, bool is_lower) {
+    for (auto const& bound : bounds) {
+      auto const needles   = table_view{{right.column(bound.right_column)}};
+      auto const positions = bound.inclusive == is_lower
+                               ? cudf::detail::lower_bound(sorted_keys->view(),
+                                                           needles,
+                                                           column_order,
+                                                           null_ordering,
+                                                           stream,
+                                                           temp_mr)
+                               : cudf::detail::upper_bound(sorted_keys->view(),
+                                                           needles,
+                                                           column_order,
+                                                           null_ordering,
+                                                           stream,
+                                                           temp_mr);
+      auto& range_ends = is_lower ? begins : ends;
+      if (is_lower) {
+        thrust::transform(rmm::exec_policy_nosync(stream),
+                          range_ends.begin(),
+                          range_ends.end(),
+                          positions->view().begin<size_type>(),
+                          range_ends.begin(),
+                          thrust::maximum<size_type>{});
+      } else {
+        thrust::transform(rmm::exec_policy_nosync(stream),
+                          range_ends.begin(),
+                          range_ends.end(),
+                          positions->view().begin<size_type>(),
+                          range_ends.begin(),
+                          thrust::minimum<size_type>{});
+      }
+    }
+  };
+  narrow_ranges(range.lower_bounds, true);
+  narrow_ranges(range.upper_bounds, false);
+
+  // Right rows with a null bound match nothing
+  std::vector<column_view> bound_columns;
+  for (auto const& bounds : {range.lower_bounds, range.upper_bounds}) {
+    for (auto const& bound : bounds) {
+      bound_columns.push_back(right.column(bound.right_column));
+    }
+  }
+  auto const bound_table = table_view{bound_columns};
+  auto row_bitmask       = rmm::device_buffer{0, stream, temp_mr};
+  if (cudf::has_nulls(bound_table)) {
+    row_bitmask = cudf::detail::bitmask_and(bound_table, stream, temp_mr).first;
+  }
+  auto const candidate_count = candidate_count_fn{
+    begins.data(),
+    ends.data(),
+    row_bitmask.is_empty() ? nullptr : static_cast<bitmask_type const*>(row_bitmask.data())};
+
+  // Expand the ranges into candidate pairs. The right row of each candidate is found by a binary
+  // search of the candidate offsets of the right rows, so that uneven ranges balance.
+  rmm::device_uvector<std::size_t> candidate_ends(right_num_rows, stream);
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::counting_iterator<size_type>(0),
+                                   thrust::counting_iterator<size_type>(right_num_rows),
+                                   candidate_ends.begin(),
+                                   candidate_count,
+                                   thrust::plus<std::size_t>{});
+  auto const num_candidates =
+    right_num_rows == 0 ? std::size_t{0} : candidate_ends.back_element(stream);
+
+  rmm::device_uvector<size_type> candidates_l(num_candidates, stream);
+  rmm::device_uvector<size_type> candidates_r(num_candidates, stream);
+  rmm::device_uvector<bool> matches(num_candidates, stream);
+  if (num_candidates > 0) {
+    thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                        candidate_ends.begin(),
+                        candidate_ends.end(),
+                        thrust::counting_iterator<std::size_t>(0),
+                        thrust::counting_iterator<std::size_t>(num_candidates),
+                        candidates_r.begin());
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::counting_iterator<std::size_t>(0),
+                       num_candidates,
+                       [candidate_count,
+                        candidate_ends = candidate_ends.data(),
+                        sorted_order   = sorted_order->view().begin<size_type>(),
+                        d_left         = candidates_l.data(),
+                        d_right        = candidates_r.data()] __device__(std::size_t idx) {
+                         auto const row  = d_right[idx];
+                         auto const rank = idx - (candidate_ends[row] - candidate_count(row));
+                         d_left[idx] =
+                           sorted_order[candidate_count.begins[row] + static_cast<size_type>(rank)];
+                       });
+
+    detail::grid_1d const config(static_cast<cudf::thread_index_type>(num_candidates),
+                                 DEFAULT_JOIN_BLOCK_SIZE);
+    auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+    if (has_nulls) {
+      evaluate_conditional_join_candidates<DEFAULT_JOIN_BLOCK_SIZE, true>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          left_table,
+          right_table,
+          parser.device_expression_data,
+          candidates_l.data(),
+          candidates_r.data(),
+          num_candidates,
+          matches.data());
+    } else {
+      evaluate_conditional_join_candidates<DEFAULT_JOIN_BLOCK_SIZE, false>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          left_table,
+          right_table,
+          parser.device_expression_data,
+          candidates_l.data(),
+          candidates_r.data(),
+          num_candidates,
+          matches.data());
+    }
+  }
+  auto const num_matches = static_cast<std::size_t>(
+    thrust::count(rmm::exec_policy(stream), matches.begin(), matches.end(), true));
+
+  // A left join also outputs each left row without a match, with no right row
+  rmm::device_uvector<bool> is_matched(0, stream);
+  std::size_t num_unmatched = 0;
+  if (join_type == join_kind::LEFT_JOIN) {
+    is_matched.resize(left.num_rows(), stream);
+    thrust::fill(rmm::exec_policy_nosync(stream), is_matched.begin(), is_matched.end(), false);
+    thrust::scatter_if(rmm::exec_policy_nosync(stream),
+                       thrust::constant_iterator<bool>(true),
+                       thrust::constant_iterator<bool>(true) + num_candidates,
+                       candidates_l.begin(),
+                       matches.begin(),
+                       is_matched.begin());
+    num_unmatched = static_cast<std::size_t>(
+      thrust::count(rmm::exec_policy(stream), is_matched.begin(), is_matched.end(), false));
+  }
+
+  auto const join_size = num_matches + num_unmatched;
+  auto left_indices    = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices   = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  thrust::make_zip_iterator(candidates_l.begin(), candidates_r.begin()),
+                  thrust::make_zip_iterator(candidates_l.end(), candidates_r.end()),
+                  matches.begin(),
+                  thrust::make_zip_iterator(left_indices->begin(), right_indices->begin()),
+                  thrust::identity<bool>{});
+  if (num_unmatched > 0) {
+    thrust::copy_if(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(left.num_rows()),
+                    left_indices->begin() + num_matches,
+                    [is_matched = is_matched.data()] __device__(size_type row) {
+                      return not is_matched[row];
+                    });
+    thrust::fill(rmm::exec_policy_nosync(stream),
+                 right_indices->begin() + num_matches,
+                 right_indices->end(),
+                 JoinNoneValue);
+  }
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+}  // namespace cudf
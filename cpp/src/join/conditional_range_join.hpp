@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "join_common_utils.hpp"
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A bound of a left column by a right column, `left <(=) right` or `left >(=) right`
+ */
+struct range_bound {
+  size_type right_column;  ///< Index of the right column bounding the left column
+  bool inclusive;          ///< Whether left values equal to the right value are in the range
+};
+
+/**
+ * @brief The conjuncts of a join predicate that bound one left column by right columns
+ *
+ * The left rows that may match a right row are those whose value in `left_column` is within the
+ * bounds of the right row, so that they form a contiguous range of the left rows sorted on
+ * `left_column`.
+ */
+struct range_predicate {
+  size_type left_column;                  ///< Index of the bounded left column
+  std::vector<range_bound> lower_bounds;  ///< Conjuncts `left >(=) right`
+  std::vector<range_bound> upper_bounds;  ///< Conjuncts `left <(=) right`
+};
+
+/**
+ * @brief Finds the comparisons of a left and a right column in the top-level conjunction of
+ * `binary_predicate` that bound a single left column
+ *
+ * Only non-nested comparisons `<`, `<=`, `>`, `>=` and `==` of two column references of the same
+ * numeric or chrono type are used. The left column with both lower and upper bounds is preferred.
+ *
+ * @param binary_predicate The join predicate
+ * @param left The left table
+ * @param right The right table
+ *
+ * @return The bounds of a left column, or nullopt if the predicate bounds no left column
+ */
+std::optional<range_predicate> find_range_predicate(ast::expression const& binary_predicate,
+                                                    table_view const& left,
+                                                    table_view const& right);
+
+/**
+ * @brief Computes an inner or left conditional join whose predicate bounds a left column
+ *
+ * The left table is sorted on the bounded column and the range of sorted left rows within the
+ * bounds of each right row is found by binary searches. The predicate is then evaluated only on
+ * the pairs of each right row and the left rows of its range.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_table Device view of the left table
+ * @param right_table Device view of the right table
+ * @param parser The parsed join predicate
+ * @param has_nulls Whether the predicate may evaluate to null
+ * @param range The bounds of a left column by the predicate
+ * @param join_type The type of join, `INNER_JOIN` or `LEFT_JOIN`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return Join output indices vector pair
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_range_join(table_view const& left,
+                       table_view const& right,
+                       table_device_view const& left_table,
+                       table_device_view const& right_table,
+                       ast::detail::expression_parser const& parser,
+                       bool has_nulls,
+                       range_predicate const& range,
+                       join_kind join_type,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
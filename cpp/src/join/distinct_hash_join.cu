@@ -33,7 +33,9 @@
 #include <cooperative_groups.h>
 #include <cub/block/block_scan.cuh>
 #include <cuco/static_set.cuh>
+#include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/sequence.h>
 
@@ -94,6 +96,16 @@ struct output_fn {
     return static_cast<cudf::size_type>(x.second);
   }
 };
+
+/**
+ * @brief Device functor telling whether a probe row is kept by a semi (`keep_matches`) or an anti
+ * join, given whether it has a match
+ */
+struct is_kept_fn {
+  bool keep_matches;
+
+  __device__ constexpr bool operator()(bool has_match) const { return has_match == keep_matches; }
+};
 }  // namespace
 
 template <cudf::has_nested HasNested>
@@ -226,6 +238,61 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::l
 
   return build_indices;
 }
+
+template <cudf::has_nested HasNested>
+std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::left_semi_join(
+  rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  cudf::scoped_range range{"distinct_hash_join::left_semi_join"};
+  return semi_anti_join(join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+template <cudf::has_nested HasNested>
+std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::left_anti_join(
+  rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  cudf::scoped_range range{"distinct_hash_join::left_anti_join"};
+  return semi_anti_join(join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
+
+template <cudf::has_nested HasNested>
+std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::semi_anti_join(
+  join_kind kind, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  size_type const probe_table_num_rows{this->_probe.num_rows()};
+  auto const keep_matches = kind == join_kind::LEFT_SEMI_JOIN;
+
+  // If no probe row has a match, return empty or all probe rows
+  if (probe_table_num_rows == 0 or (keep_matches and this->_build.num_rows() == 0)) {
+    return std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
+  }
+  auto probe_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(probe_table_num_rows, stream, mr);
+  if (this->_build.num_rows() == 0) {
+    thrust::sequence(rmm::exec_policy_nosync(stream), probe_indices->begin(), probe_indices->end());
+    return probe_indices;
+  }
+
+  auto const probe_row_hasher =
+    cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
+  auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
+  auto const iter           = cudf::detail::make_counting_transform_iterator(
+    0, build_keys_fn<decltype(d_probe_hasher), rhs_index_type>{d_probe_hasher});
+
+  rmm::device_uvector<bool> has_match(probe_table_num_rows, stream);
+  this->_hash_table.contains_async(
+    iter, iter + probe_table_num_rows, has_match.begin(), stream.value());
+
+  auto const probe_rows        = thrust::counting_iterator<size_type>{0};
+  auto const probe_indices_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                                 probe_rows,
+                                                 probe_rows + probe_table_num_rows,
+                                                 has_match.begin(),
+                                                 probe_indices->begin(),
+                                                 is_kept_fn{keep_matches});
+  probe_indices->resize(std::distance(probe_indices->begin(), probe_indices_end), stream);
+  return probe_indices;
+}
 }  // namespace detail
 
 template <>
@@ -288,4 +355,36 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<cudf::has_nes
 {
   return _impl->left_join(stream, mr);
 }
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::YES>::left_semi_join(rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_semi_join(stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::NO>::left_semi_join(rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_semi_join(stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::YES>::left_anti_join(rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_anti_join(stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::NO>::left_anti_join(rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_anti_join(stream, mr);
+}
 }  // namespace cudf
@@ -15,13 +15,22 @@
  */
 #include "join_common_utils.cuh"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/join.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -30,22 +39,75 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cooperative_groups.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_adaptor.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
 #include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 #include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
 namespace cudf {
 namespace detail {
 namespace {
+namespace cg = cooperative_groups;
+
+/**
+ * @brief Device functor returning the hash value and index of the `i`-th probed row
+ *
+ * The probed rows are `rows`, or all rows of the probe table if `rows` is null.
+ */
+template <typename PairFunction>
+struct probe_row_pair_function {
+  PairFunction pair_function;
+  size_type const* rows;
+
+  __device__ __forceinline__ auto operator()(size_type i) const noexcept
+  {
+    return pair_function(rows == nullptr ? i : rows[i]);
+  }
+};
+
+/**
+ * @brief Returns an iterator over the hash values and indices of the probed rows
+ */
+template <typename Hasher>
+auto make_probe_pair_iterator(Hasher const& hash_probe,
+                              hash_value_type empty_key_sentinel,
+                              std::optional<cudf::device_span<size_type const>> probe_rows)
+{
+  auto const pair_func = make_pair_function{hash_probe, empty_key_sentinel};
+  return cudf::detail::make_counting_transform_iterator(
+    0,
+    probe_row_pair_function<decltype(pair_func)>{
+      pair_func, probe_rows.has_value() ? probe_rows->data() : nullptr});
+}
+
 /**
  * @brief Calculates the exact size of the join output produced when
  * joining two tables together.
@@ -64,6 +126,7 @@ namespace {
  * @param has_nulls Flag to denote if build or probe tables have nested nulls
  * @param nulls_equal Flag to denote nulls are equal or not
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param probe_rows Optional rows of `probe_table` to probe, all of its rows if not provided
  *
  * @return The exact size of the output of the join operation
  */
@@ -76,10 +139,12 @@ std::size_t compute_join_output_size(
   join_kind join,
   bool has_nulls,
   cudf::null_equality nulls_equal,
-  rmm::cuda_stream_view stream)
+  rmm::cuda_stream_view stream,
+  std::optional<cudf::device_span<size_type const>> probe_rows = std::nullopt)
 {
   size_type const build_table_num_rows{build_table.num_rows()};
-  size_type const probe_table_num_rows{probe_table.num_rows()};
+  size_type const probe_table_num_rows{
+    probe_rows.has_value() ? static_cast<size_type>(probe_rows->size()) : probe_table.num_rows()};
 
   // If the build table is empty, we know exactly how large the output
   // will be for the different types of joins and can return immediately
@@ -98,11 +163,10 @@ std::size_t compute_join_output_size(
 
   auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
 
-  auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
-  auto const hash_probe         = row_hash.device_hasher(probe_nulls);
-  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  auto const iter               = cudf::detail::make_counting_transform_iterator(
-    0, make_pair_function{hash_probe, empty_key_sentinel});
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = row_hash.device_hasher(probe_nulls);
+  auto const iter =
+    make_probe_pair_iterator(hash_probe, hash_table.get_empty_key_sentinel(), probe_rows);
 
   auto const row_comparator =
     cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
@@ -126,6 +190,90 @@ std::size_t compute_join_output_size(
   }
 }
 
+/**
+ * @brief Probes the `hash_table` built from the build table for tuples in `probe_table`, and
+ * writes the probe and build row indices of the output rows to `probe_output` and `build_output`
+ *
+ * @param probe_table Table of probe side columns to join
+ * @param preprocessed_build shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           the build table
+ * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           probe_table
+ * @param hash_table Hash table built from the build table
+ * @param join The type of join to be performed; a full join writes the output of a left join
+ * @param has_nulls Flag to denote if build or probe tables have nested nulls
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param probe_output Output iterator of the probe row indices
+ * @param build_output Output iterator of the build row indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param probe_rows Optional rows of `probe_table` to probe, all of its rows if not provided
+ *
+ * @return The number of output rows written
+ */
+template <typename ProbeOutputIt, typename BuildOutputIt>
+std::size_t retrieve_join_pairs(
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::detail::multimap_type const& hash_table,
+  join_kind join,
+  bool has_nulls,
+  null_equality compare_nulls,
+  ProbeOutputIt probe_output,
+  BuildOutputIt build_output,
+  rmm::cuda_stream_view stream,
+  std::optional<cudf::device_span<size_type const>> probe_rows)
+{
+  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
+
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = row_hash.device_hasher(probe_nulls);
+  auto const iter =
+    make_probe_pair_iterator(hash_probe, hash_table.get_empty_key_sentinel(), probe_rows);
+
+  cudf::size_type const probe_table_num_rows{
+    probe_rows.has_value() ? static_cast<size_type>(probe_rows->size()) : probe_table.num_rows()};
+
+  auto const out1_zip_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(thrust::make_discard_iterator(), probe_output));
+  auto const out2_zip_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(thrust::make_discard_iterator(), build_output));
+
+  auto const row_comparator =
+    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+  auto const comparator_helper = [&](auto device_comparator) -> std::size_t {
+    pair_equality equality{device_comparator};
+
+    if (join == cudf::detail::join_kind::FULL_JOIN or join == cudf::detail::join_kind::LEFT_JOIN) {
+      [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
+        hash_table.pair_retrieve_outer(iter,
+                                       iter + probe_table_num_rows,
+                                       out1_zip_begin,
+                                       out2_zip_begin,
+                                       equality,
+                                       stream.value());
+      return thrust::distance(out1_zip_begin, out1_zip_end);
+    } else {
+      [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
+        hash_table.pair_retrieve(iter,
+                                 iter + probe_table_num_rows,
+                                 out1_zip_begin,
+                                 out2_zip_begin,
+                                 equality,
+                                 stream.value());
+      return thrust::distance(out1_zip_begin, out1_zip_end);
+    }
+  };
+
+  if (cudf::detail::has_nested_columns(probe_table)) {
+    auto const device_comparator = row_comparator.equal_to<true>(probe_nulls, compare_nulls);
+    return comparator_helper(device_comparator);
+  } else {
+    auto const device_comparator = row_comparator.equal_to<false>(probe_nulls, compare_nulls);
+    return comparator_helper(device_comparator);
+  }
+}
+
 /**
  * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`,
  * and returns the output indices of `build_table` and `probe_table` as a combined table.
@@ -144,6 +292,7 @@ std::size_t compute_join_output_size(
  * @param output_size Optional value which allows users to specify the exact output size
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned vectors
+ * @param probe_rows Optional rows of `probe_table` to probe, all of its rows if not provided
  *
  * @return Join output indices vector pair.
  */
@@ -160,7 +309,8 @@ probe_join_hash_table(
   null_equality compare_nulls,
   std::optional<std::size_t> output_size,
   rmm::cuda_stream_view stream,
-  rmm::device_async_resource_ref mr)
+  rmm::device_async_resource_ref mr,
+  std::optional<cudf::device_span<size_type const>> probe_rows = std::nullopt)
 {
   // Use the output size directly if provided. Otherwise, compute the exact output size
   auto const probe_join_type =
@@ -175,7 +325,8 @@ probe_join_hash_table(
                                                                        probe_join_type,
                                                                        has_nulls,
                                                                        compare_nulls,
-                                                                       stream);
+                                                                       stream,
+                                                                       probe_rows);
 
   // If output size is zero, return immediately
   if (join_size == 0) {
@@ -186,6 +337,68 @@ probe_join_hash_table(
   auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
   auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
 
+  auto const actual_size = retrieve_join_pairs(probe_table,
+                                               preprocessed_build,
+                                               preprocessed_probe,
+                                               hash_table,
+                                               join,
+                                               has_nulls,
+                                               compare_nulls,
+                                               left_indices->begin(),
+                                               right_indices->begin(),
+                                               stream,
+                                               probe_rows);
+  if (join == cudf::detail::join_kind::FULL_JOIN) {
+    left_indices->resize(actual_size, stream);
+    right_indices->resize(actual_size, stream);
+  }
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Probes the `hash_table` built from `build_table` for the tuples of a window of
+ * `probe_table` rows starting at `probe_row_begin`, and returns the inner join output indices of
+ * the window with the end of the window.
+ *
+ * The window is the largest one found whose output has at most `max_output_size` rows; it is
+ * searched for by doubling and then bisecting its size, counting the matches of each candidate.
+ * The search stops early once the output fills half of `max_output_size`. The window has at least
+ * one row, even if the matches of that row alone exceed `max_output_size`.
+ *
+ * @param build_table Table of build side columns to join
+ * @param probe_table Table of probe side columns to join
+ * @param preprocessed_build shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           build_table
+ * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           probe_table
+ * @param hash_table Hash table built from `build_table`
+ * @param has_nulls Flag to denote if build or probe tables have nested nulls
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param probe_row_begin First probe row of the window; must be less than the number of rows of
+ *                        `probe_table`
+ * @param max_output_size Maximum number of output rows of the window
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return Join output indices vector pair of the window, and the first probe row after it
+ */
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+probe_join_hash_table_chunk(
+  cudf::table_view const& build_table,
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::detail::multimap_type const& hash_table,
+  bool has_nulls,
+  null_equality compare_nulls,
+  size_type probe_row_begin,
+  std::size_t max_output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
   auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
 
   auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
@@ -193,52 +406,66 @@ probe_join_hash_table(
   auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
   auto const iter               = cudf::detail::make_counting_transform_iterator(
     0, make_pair_function{hash_probe, empty_key_sentinel});
-
-  cudf::size_type const probe_table_num_rows = probe_table.num_rows();
-
-  auto const out1_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
-  auto const out2_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
+  auto const window_begin = iter + probe_row_begin;
 
   auto const row_comparator =
     cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
   auto const comparator_helper = [&](auto device_comparator) {
     pair_equality equality{device_comparator};
-
-    if (join == cudf::detail::join_kind::FULL_JOIN or join == cudf::detail::join_kind::LEFT_JOIN) {
-      [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
-        hash_table.pair_retrieve_outer(iter,
-                                       iter + probe_table_num_rows,
-                                       out1_zip_begin,
-                                       out2_zip_begin,
-                                       equality,
-                                       stream.value());
-
-      if (join == cudf::detail::join_kind::FULL_JOIN) {
-        auto const actual_size = thrust::distance(out1_zip_begin, out1_zip_end);
-        left_indices->resize(actual_size, stream);
-        right_indices->resize(actual_size, stream);
+    auto const window_output_size = [&](std::int64_t num_rows) {
+      return hash_table.pair_count(window_begin, window_begin + num_rows, equality, stream.value());
+    };
+
+    // Window sizes are 64-bit since `remaining + 1` may not fit in `size_type`
+    std::int64_t const remaining = probe_table.num_rows() - probe_row_begin;
+    std::int64_t fits            = 0;              // largest window size known to fit
+    std::size_t fits_output_size = 0;              // output size of that window
+    std::int64_t misses          = remaining + 1;  // smallest window size known not to fit
+    auto num_rows = std::min<std::int64_t>(remaining, static_cast<std::int64_t>(max_output_size));
+    while (fits + 1 < misses and fits_output_size < max_output_size / 2) {
+      auto const output_size = window_output_size(num_rows);
+      if (output_size <= max_output_size) {
+        fits             = num_rows;
+        fits_output_size = output_size;
+      } else {
+        misses = num_rows;
       }
-    } else {
-      hash_table.pair_retrieve(iter,
-                               iter + probe_table_num_rows,
+      num_rows =
+        misses > remaining ? std::min(2 * num_rows, remaining) : fits + (misses - fits) / 2;
+    }
+    if (fits == 0) {
+      fits             = 1;
+      fits_output_size = window_output_size(fits);
+    }
+
+    auto left_indices =
+      std::make_unique<rmm::device_uvector<size_type>>(fits_output_size, stream, mr);
+    auto right_indices =
+      std::make_unique<rmm::device_uvector<size_type>>(fits_output_size, stream, mr);
+    if (fits_output_size != 0) {
+      auto const out1_zip_begin = thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
+      auto const out2_zip_begin = thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
+      hash_table.pair_retrieve(window_begin,
+                               window_begin + fits,
                                out1_zip_begin,
                                out2_zip_begin,
                                equality,
                                stream.value());
     }
+    return std::tuple(std::move(left_indices),
+                      std::move(right_indices),
+                      static_cast<size_type>(probe_row_begin + fits));
   };
 
   if (cudf::detail::has_nested_columns(probe_table)) {
     auto const device_comparator = row_comparator.equal_to<true>(probe_nulls, compare_nulls);
-    comparator_helper(device_comparator);
+    return comparator_helper(device_comparator);
   } else {
     auto const device_comparator = row_comparator.equal_to<false>(probe_nulls, compare_nulls);
-    comparator_helper(device_comparator);
+    return comparator_helper(device_comparator);
   }
-
-  return std::pair(std::move(left_indices), std::move(right_indices));
 }
 
 /**
@@ -358,6 +585,678 @@ std::size_t get_full_join_size(
   }
   return join_size + left_join_complement_size;
 }
+
+/**
+ * @brief Marks the rows of a probe table that have a match in `hash_table_view`
+ *
+ * Each row is probed by a tile of `DEFAULT_JOIN_CG_SIZE` threads.
+ *
+ * @param hash_table_view Device view of the hash table built from the build table
+ * @param hash_probe Row hasher of the probe table
+ * @param equality Equality functor of probe and build rows
+ * @param num_probe_rows Number of rows of the probe table
+ * @param has_match Output flags, one per probe row
+ */
+template <typename HashProbe, typename Equality>
+CUDF_KERNEL void mark_matched_probe_rows(cudf::detail::multimap_type::device_view hash_table_view,
+                                         HashProbe hash_probe,
+                                         Equality equality,
+                                         size_type num_probe_rows,
+                                         bool* has_match)
+{
+  auto const tile = cg::tiled_partition<DEFAULT_JOIN_CG_SIZE>(cg::this_thread_block());
+  make_pair_function pair_func{hash_probe, hash_table_view.get_empty_key_sentinel()};
+
+  auto const stride = grid_1d::grid_stride() / DEFAULT_JOIN_CG_SIZE;
+  for (auto row = grid_1d::global_thread_id() / DEFAULT_JOIN_CG_SIZE; row < num_probe_rows;
+       row += stride) {
+    auto const count = hash_table_view.pair_count(tile, pair_func(row), equality);
+    auto const found = tile.any(count > 0);
+    if (tile.thread_rank() == 0) { has_match[row] = found; }
+  }
+}
+
+/**
+ * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`, and returns
+ * the indices of the probe rows that have (`LEFT_SEMI_JOIN`) or do not have (`LEFT_ANTI_JOIN`) a
+ * match.
+ *
+ * @param build_table Table of build side columns to join
+ * @param probe_table Table of probe side columns to join
+ * @param preprocessed_build shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           build_table
+ * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           probe_table
+ * @param hash_table Hash table built from `build_table`
+ * @param join The type of join to be performed; one of `LEFT_SEMI_JOIN` and `LEFT_ANTI_JOIN`
+ * @param has_nulls Flag to denote if build or probe tables have nested nulls
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ *
+ * @return The probe row indices, in ascending order
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> probe_semi_anti_join(
+  cudf::table_view const& build_table,
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::detail::multimap_type const& hash_table,
+  join_kind join,
+  bool has_nulls,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const probe_nulls    = cudf::nullate::DYNAMIC{has_nulls};
+  auto const num_probe_rows = probe_table.num_rows();
+
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = row_hash.device_hasher(probe_nulls);
+
+  rmm::device_uvector<bool> has_match(num_probe_rows, stream);
+  auto const row_comparator =
+    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+  auto const comparator_helper = [&](auto device_comparator) {
+    pair_equality equality{device_comparator};
+    auto const num_threads = static_cast<thread_index_type>(num_probe_rows) * DEFAULT_JOIN_CG_SIZE;
+    auto const num_blocks  = static_cast<int>(
+      util::div_rounding_up_safe<thread_index_type>(num_threads, DEFAULT_JOIN_BLOCK_SIZE));
+    mark_matched_probe_rows<<<num_blocks, DEFAULT_JOIN_BLOCK_SIZE, 0, stream.value()>>>(
+      hash_table.get_device_view(), hash_probe, equality, num_probe_rows, has_match.data());
+  };
+
+  if (cudf::detail::has_nested_columns(probe_table)) {
+    auto const device_comparator = row_comparator.equal_to<true>(probe_nulls, compare_nulls);
+    comparator_helper(device_comparator);
+  } else {
+    auto const device_comparator = row_comparator.equal_to<false>(probe_nulls, compare_nulls);
+    comparator_helper(device_comparator);
+  }
+
+  auto const keep_matches = join == join_kind::LEFT_SEMI_JOIN;
+  auto indices = std::make_unique<rmm::device_uvector<size_type>>(num_probe_rows, stream, mr);
+  auto const indices_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_probe_rows),
+                    has_match.begin(),
+                    indices->begin(),
+                    [keep_matches] __device__(bool found) { return found == keep_matches; });
+  indices->resize(thrust::distance(indices->begin(), indices_end), stream);
+  return indices;
+}
+
+// A build key is a heavy hitter if it has at least `heavy_hitter_min_fraction` of the build rows
+// and at least `heavy_hitter_min_rows` rows. Candidate keys are found in an evenly spaced sample of
+// `heavy_hitter_sample_size` build rows, and at most `max_heavy_hitters` of them are kept.
+constexpr size_type heavy_hitter_sample_size  = 4096;
+constexpr double heavy_hitter_min_fraction    = 0.01;
+constexpr size_type heavy_hitter_min_rows     = 1024;
+constexpr std::size_t max_heavy_hitters       = 16;
+constexpr size_type no_heavy_hitter           = -1;
+
+/**
+ * @brief Device functor returning the heavy hitter key equal to a row, or `no_heavy_hitter`
+ *
+ * @tparam Hasher Row hasher of the table of the rows
+ * @tparam Equality Equality functor of a row and a build row
+ */
+template <typename Hasher, typename Equality>
+struct find_heavy_hitter_fn {
+  Hasher hasher;
+  Equality equality;
+  hash_value_type const* key_hashes;  // row hashes of the heavy hitter keys
+  size_type const* key_rows;          // a build row of each heavy hitter key
+  size_type num_keys;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const hash = hasher(row);
+    for (size_type key = 0; key < num_keys; ++key) {
+      if (key_hashes[key] == hash and equality(row, key_rows[key])) { return key; }
+    }
+    return no_heavy_hitter;
+  }
+};
+
+/**
+ * @brief Equality functor of a probe row and a build row
+ */
+template <typename DeviceComparator>
+struct probe_build_equality {
+  DeviceComparator check_row_equality;
+
+  __device__ bool operator()(size_type probe_row, size_type build_row) const
+  {
+    return check_row_equality(cudf::experimental::row::lhs_index_type{probe_row},
+                              cudf::experimental::row::rhs_index_type{build_row});
+  }
+};
+
+/**
+ * @brief Returns the heavy hitter key of each build row, or `no_heavy_hitter`
+ */
+rmm::device_uvector<size_type> find_build_heavy_hitters(
+  cudf::table_view const& build_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  cudf::device_span<hash_value_type const> key_hashes,
+  cudf::device_span<size_type const> key_rows,
+  bool has_nulls,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream)
+{
+  auto const nulls      = cudf::nullate::DYNAMIC{has_nulls};
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_build};
+  auto const hash_build = row_hash.device_hasher(nulls);
+
+  rmm::device_uvector<size_type> keys(build_table.num_rows(), stream);
+  auto const row_comparator =
+    cudf::experimental::row::equality::self_comparator{preprocessed_build};
+  auto const comparator_helper = [&](auto device_comparator) {
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(build_table.num_rows()),
+                      keys.begin(),
+                      find_heavy_hitter_fn<decltype(hash_build), decltype(device_comparator)>{
+                        hash_build,
+                        device_comparator,
+                        key_hashes.data(),
+                        key_rows.data(),
+                        static_cast<size_type>(key_rows.size())});
+  };
+  if (cudf::detail::has_nested_columns(build_table)) {
+    comparator_helper(row_comparator.equal_to<true>(nulls, compare_nulls));
+  } else {
+    comparator_helper(row_comparator.equal_to<false>(nulls, compare_nulls));
+  }
+  return keys;
+}
+
+/**
+ * @brief Returns the heavy hitter key of each probe row, or `no_heavy_hitter`
+ */
+rmm::device_uvector<size_type> find_probe_heavy_hitters(
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::device_span<hash_value_type const> key_hashes,
+  cudf::device_span<size_type const> key_rows,
+  bool has_nulls,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream)
+{
+  auto const nulls      = cudf::nullate::DYNAMIC{has_nulls};
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = row_hash.device_hasher(nulls);
+
+  rmm::device_uvector<size_type> keys(probe_table.num_rows(), stream);
+  auto const row_comparator =
+    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+  auto const comparator_helper = [&](auto device_comparator) {
+    using equality_type = probe_build_equality<decltype(device_comparator)>;
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(probe_table.num_rows()),
+                      keys.begin(),
+                      find_heavy_hitter_fn<decltype(hash_probe), equality_type>{
+                        hash_probe,
+                        equality_type{device_comparator},
+                        key_hashes.data(),
+                        key_rows.data(),
+                        static_cast<size_type>(key_rows.size())});
+  };
+  if (cudf::detail::has_nested_columns(probe_table)) {
+    comparator_helper(row_comparator.equal_to<true>(nulls, compare_nulls));
+  } else {
+    comparator_helper(row_comparator.equal_to<false>(nulls, compare_nulls));
+  }
+  return keys;
+}
+
+/**
+ * @brief Groups the rows that have a heavy hitter key by key
+ *
+ * @param keys The heavy hitter key of each row, or `no_heavy_hitter`
+ * @param num_keys The number of heavy hitter keys
+ *
+ * @return The offsets of the groups of the rows of each key, and the rows grouped by key in
+ * ascending order within each group
+ */
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> group_heavy_hitter_rows(
+  cudf::device_span<size_type const> keys, size_type num_keys, rmm::cuda_stream_view stream)
+{
+  auto const num_rows = static_cast<size_type>(keys.size());
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  rmm::device_uvector<size_type> row_keys(num_rows, stream);
+  auto const zipped_end = thrust::copy_if(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_zip_iterator(thrust::counting_iterator<size_type>(0), keys.begin()),
+    thrust::make_zip_iterator(thrust::counting_iterator<size_type>(num_rows), keys.end()),
+    keys.begin(),
+    thrust::make_zip_iterator(rows.begin(), row_keys.begin()),
+    [] __device__(size_type key) { return key != no_heavy_hitter; });
+  auto const num_heavy_rows = static_cast<std::size_t>(thrust::distance(
+    thrust::make_zip_iterator(rows.begin(), row_keys.begin()), zipped_end));
+  rows.resize(num_heavy_rows, stream);
+  row_keys.resize(num_heavy_rows, stream);
+
+  thrust::stable_sort_by_key(
+    rmm::exec_policy_nosync(stream), row_keys.begin(), row_keys.end(), rows.begin());
+  rmm::device_uvector<size_type> offsets(num_keys + 1, stream);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      row_keys.begin(),
+                      row_keys.end(),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(num_keys + 1),
+                      offsets.begin());
+  return {std::move(offsets), std::move(rows)};
+}
+
+/**
+ * @brief Finds the heavy hitter keys of the build table and groups their build rows by key
+ *
+ * @return The row hashes of the keys, a build row of each key, the offsets of the groups and the
+ * build rows grouped by key. All are empty if the build table has no heavy hitter.
+ */
+std::tuple<rmm::device_uvector<hash_value_type>,
+           rmm::device_uvector<size_type>,
+           rmm::device_uvector<size_type>,
+           rmm::device_uvector<size_type>>
+find_heavy_hitters(
+  cudf::table_view const& build_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  bool has_nulls,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = build_table.num_rows();
+  auto const min_rows = std::max(
+    heavy_hitter_min_rows, static_cast<size_type>(std::ceil(heavy_hitter_min_fraction * num_rows)));
+  auto no_heavy_hitters = [&] {
+    return std::tuple(rmm::device_uvector<hash_value_type>(0, stream),
+                      rmm::device_uvector<size_type>(0, stream),
+                      rmm::device_uvector<size_type>(0, stream),
+                      rmm::device_uvector<size_type>(0, stream));
+  };
+  if (num_rows < min_rows) { return no_heavy_hitters(); }
+
+  // Count the distinct row hashes of an evenly spaced sample of the build rows
+  auto const sample_size = std::min(num_rows, heavy_hitter_sample_size);
+  auto const stride      = num_rows / sample_size;
+  auto const row_hash    = cudf::experimental::row::hash::row_hasher{preprocessed_build};
+  auto const hash_build  = row_hash.device_hasher(cudf::nullate::DYNAMIC{has_nulls});
+  rmm::device_uvector<hash_value_type> sample_hashes(sample_size, stream);
+  rmm::device_uvector<size_type> sample_rows(sample_size, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(sample_size),
+                    thrust::make_zip_iterator(sample_hashes.begin(), sample_rows.begin()),
+                    [hash_build, stride] __device__(size_type i) {
+                      auto const row = i * stride;
+                      return thrust::make_tuple(hash_build(row), row);
+                    });
+  thrust::sort_by_key(rmm::exec_policy_nosync(stream),
+                      sample_hashes.begin(),
+                      sample_hashes.end(),
+                      sample_rows.begin());
+  rmm::device_uvector<hash_value_type> distinct_hashes(sample_size, stream);
+  rmm::device_uvector<size_type> distinct_rows(sample_size, stream);
+  rmm::device_uvector<size_type> distinct_counts(sample_size, stream);
+  auto const num_distinct = static_cast<std::size_t>(thrust::distance(
+    distinct_hashes.begin(),
+    thrust::reduce_by_key(
+      rmm::exec_policy_nosync(stream),
+      sample_hashes.begin(),
+      sample_hashes.end(),
+      thrust::make_zip_iterator(sample_rows.begin(), thrust::constant_iterator<size_type>(1)),
+      distinct_hashes.begin(),
+      thrust::make_zip_iterator(distinct_rows.begin(), distinct_counts.begin()),
+      thrust::equal_to<hash_value_type>{},
+      [] __device__(auto const& lhs, auto const& rhs) {
+        return thrust::make_tuple(thrust::min(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                                  thrust::get<1>(lhs) + thrust::get<1>(rhs));
+      })
+      .first));
+
+  auto const h_hashes = cudf::detail::make_std_vector_async(
+    cudf::device_span<hash_value_type const>{distinct_hashes.data(), num_distinct}, stream);
+  auto const h_rows = cudf::detail::make_std_vector_async(
+    cudf::device_span<size_type const>{distinct_rows.data(), num_distinct}, stream);
+  auto const h_counts = cudf::detail::make_std_vector_sync(
+    cudf::device_span<size_type const>{distinct_counts.data(), num_distinct}, stream);
+
+  // Keep the most frequent sampled keys whose sampled frequency is at least half of the minimum.
+  // The sample only nominates keys: the frequencies of the keys are counted over all build rows.
+  auto const min_sample_count =
+    std::max(2, static_cast<int>(heavy_hitter_min_fraction * sample_size / 2));
+  std::vector<std::size_t> candidates;
+  for (std::size_t i = 0; i < num_distinct; ++i) {
+    if (h_counts[i] >= min_sample_count) { candidates.push_back(i); }
+  }
+  std::sort(candidates.begin(), candidates.end(), [&](auto lhs, auto rhs) {
+    return h_counts[lhs] > h_counts[rhs];
+  });
+  if (candidates.size() > max_heavy_hitters) { candidates.resize(max_heavy_hitters); }
+
+  auto group_candidates = [&](std::vector<std::size_t> const& keys) {
+    std::vector<hash_value_type> key_hashes;
+    std::vector<size_type> key_rows;
+    for (auto const key : keys) {
+      key_hashes.push_back(h_hashes[key]);
+      key_rows.push_back(h_rows[key]);
+    }
+    auto d_key_hashes = cudf::detail::make_device_uvector_async(
+      key_hashes, stream, rmm::mr::get_current_device_resource());
+    auto d_key_rows = cudf::detail::make_device_uvector_async(
+      key_rows, stream, rmm::mr::get_current_device_resource());
+    auto const row_keys = find_build_heavy_hitters(
+      build_table, preprocessed_build, d_key_hashes, d_key_rows, has_nulls, compare_nulls, stream);
+    auto [offsets, rows] =
+      group_heavy_hitter_rows(row_keys, static_cast<size_type>(keys.size()), stream);
+    return std::tuple(
+      std::move(d_key_hashes), std::move(d_key_rows), std::move(offsets), std::move(rows));
+  };
+
+  while (not candidates.empty()) {
+    auto groups = group_candidates(candidates);
+    auto const h_offsets = cudf::detail::make_std_vector_sync(std::get<2>(groups), stream);
+
+    std::vector<std::size_t> heavy_hitters;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+      if (h_offsets[i + 1] - h_offsets[i] >= min_rows) { heavy_hitters.push_back(candidates[i]); }
+    }
+    if (heavy_hitters.size() == candidates.size()) { return groups; }
+    candidates = std::move(heavy_hitters);
+  }
+  return no_heavy_hitters();
+}
+
+/**
+ * @brief Returns the inclusive scan of the numbers of build rows matching the heavy hitter key of
+ * each probe row
+ */
+rmm::device_uvector<std::size_t> heavy_hitter_output_ends(
+  cudf::device_span<size_type const> probe_keys,
+  cudf::device_span<size_type const> heavy_hitter_offsets,
+  rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<std::size_t> output_ends(probe_keys.size(), stream);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy_nosync(stream),
+    probe_keys.begin(),
+    probe_keys.end(),
+    output_ends.begin(),
+    [offsets = heavy_hitter_offsets.data()] __device__(size_type key) -> std::size_t {
+      return key == no_heavy_hitter ? 0 : offsets[key + 1] - offsets[key];
+    },
+    thrust::plus<std::size_t>{});
+  return output_ends;
+}
+
+/**
+ * @brief Returns the output indices of the probe rows that have a heavy hitter key
+ *
+ * Each output row is produced by its own thread: the probe row of an output row is found by a
+ * binary search of `output_ends`, so that the output of a heavy hitter is spread across threads.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+expand_heavy_hitter_matches(cudf::device_span<size_type const> probe_keys,
+                            rmm::device_uvector<std::size_t> const& output_ends,
+                            cudf::device_span<size_type const> heavy_hitter_offsets,
+                            cudf::device_span<size_type const> heavy_hitter_rows,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr)
+{
+  auto const output_size =
+    output_ends.is_empty() ? std::size_t{0} : output_ends.back_element(stream);
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  if (output_size == 0) { return std::pair(std::move(left_indices), std::move(right_indices)); }
+
+  thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                      output_ends.begin(),
+                      output_ends.end(),
+                      thrust::counting_iterator<std::size_t>(0),
+                      thrust::counting_iterator<std::size_t>(output_size),
+                      left_indices->begin());
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<std::size_t>(0),
+                     output_size,
+                     [probe_keys  = probe_keys.data(),
+                      output_ends = output_ends.data(),
+                      offsets     = heavy_hitter_offsets.data(),
+                      rows        = heavy_hitter_rows.data(),
+                      d_left      = left_indices->data(),
+                      d_right     = right_indices->data()] __device__(std::size_t idx) {
+                       auto const row   = d_left[idx];
+                       auto const key   = probe_keys[row];
+                       auto const count = offsets[key + 1] - offsets[key];
+                       auto const rank  = idx - (output_ends[row] - count);
+                       d_right[idx]     = rows[offsets[key] + static_cast<size_type>(rank)];
+                     });
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Returns the probe rows that do not have a heavy hitter key
+ */
+rmm::device_uvector<size_type> non_heavy_hitter_rows(cudf::device_span<size_type const> probe_keys,
+                                                     rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> rows(probe_keys.size(), stream);
+  auto const rows_end =
+    thrust::copy_if(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(probe_keys.size()),
+                    probe_keys.begin(),
+                    rows.begin(),
+                    [] __device__(size_type key) { return key == no_heavy_hitter; });
+  rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+  return rows;
+}
+
+/**
+ * @brief A fixed-width column gathered by the output rows of a join
+ */
+struct gather_column {
+  char const* source;               // data of the gathered column at its offset
+  bitmask_type const* source_mask;  // null mask of the gathered column, or nullptr
+  size_type source_offset;          // offset of the gathered column in `source_mask`
+  char* target;                     // data of the output column
+  bitmask_type* target_mask;        // null mask of the output column, or nullptr
+  int width;                        // size in bytes of an element
+};
+
+/**
+ * @brief Proxy reference of an output row, which writes the gathered rows of the columns on
+ * assignment of a row index
+ */
+struct gather_output_reference {
+  gather_column const* columns;
+  size_type num_columns;
+  std::size_t output_row;
+
+  __device__ gather_output_reference const& operator=(size_type row) const
+  {
+    for (size_type i = 0; i < num_columns; ++i) {
+      auto const& column = columns[i];
+      // The rows without a match are null, as is the output of a null row
+      auto const is_null =
+        row == JoinNoneValue or (column.source_mask != nullptr and
+                                 not bit_is_set(column.source_mask, column.source_offset + row));
+      if (is_null) {
+        clear_bit(column.target_mask, static_cast<size_type>(output_row));
+      } else {
+        memcpy(column.target + output_row * column.width,
+               column.source + static_cast<std::size_t>(row) * column.width,
+               column.width);
+      }
+    }
+    return *this;
+  }
+};
+
+/**
+ * @brief Output iterator of the row indices of one side of a join that writes the gathered rows of
+ * the columns of that side instead of the indices
+ */
+class gather_output_iterator
+  : public thrust::iterator_adaptor<gather_output_iterator,
+                                    thrust::counting_iterator<std::size_t>,
+                                    size_type,
+                                    thrust::use_default,
+                                    thrust::use_default,
+                                    gather_output_reference> {
+ public:
+  __host__ __device__ gather_output_iterator(gather_column const* columns, size_type num_columns)
+    : gather_output_iterator::iterator_adaptor_{thrust::counting_iterator<std::size_t>{0}},
+      _columns{columns},
+      _num_columns{num_columns}
+  {
+  }
+
+ private:
+  friend class thrust::iterator_core_access;
+
+  __host__ __device__ gather_output_reference dereference() const
+  {
+    return gather_output_reference{_columns, _num_columns, *this->base()};
+  }
+
+  gather_column const* _columns;
+  size_type _num_columns;
+};
+
+/**
+ * @brief Allocates the output columns of the rows of `source` gathered by a join and returns the
+ * descriptions of their gather
+ *
+ * @param source The gathered columns
+ * @param output_size The number of output rows
+ * @param nullable Whether the output columns are nullable even if the gathered columns are not
+ */
+std::pair<std::vector<std::unique_ptr<column>>, std::vector<gather_column>> make_gather_columns(
+  cudf::table_view const& source,
+  size_type output_size,
+  bool nullable,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<gather_column> columns;
+  for (auto const& col : source) {
+    auto const has_mask = nullable or col.nullable();
+    outputs.push_back(
+      make_fixed_width_column(col.type(),
+                              output_size,
+                              has_mask ? mask_state::ALL_VALID : mask_state::UNALLOCATED,
+                              stream,
+                              mr));
+    auto const width = static_cast<int>(cudf::size_of(col.type()));
+    auto target      = outputs.back()->mutable_view();
+    auto const source =
+      static_cast<char const*>(col.head()) + static_cast<std::size_t>(col.offset()) * width;
+    columns.push_back(gather_column{source,
+                                    col.null_mask(),
+                                    col.offset(),
+                                    static_cast<char*>(target.head()),
+                                    has_mask ? target.null_mask() : nullptr,
+                                    width});
+  }
+  return {std::move(outputs), std::move(columns)};
+}
+
+/**
+ * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`, and
+ * returns the rows of `probe_columns` and `build_columns` gathered by the output rows of the join
+ *
+ * The gathered rows are written by the probe of the hash table, so that the join indices are not
+ * materialized. All columns of `probe_columns` and `build_columns` must be fixed-width.
+ *
+ * @param build_table Table of build side columns to join
+ * @param probe_table Table of probe side columns to join
+ * @param preprocessed_build shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           build_table
+ * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           probe_table
+ * @param hash_table Hash table built from `build_table`
+ * @param join The type of join to be performed; one of `INNER_JOIN` and `LEFT_JOIN`
+ * @param has_nulls Flag to denote if build or probe tables have nested nulls
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param probe_columns Columns of the probe rows to gather
+ * @param build_columns Columns of the build rows to gather
+ * @param output_size Optional value which allows users to specify the exact output size
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table
+ *
+ * @return The gathered `probe_columns` followed by the gathered `build_columns`
+ */
+std::unique_ptr<cudf::table> probe_join_hash_table_gather(
+  cudf::table_view const& build_table,
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::detail::multimap_type const& hash_table,
+  join_kind join,
+  bool has_nulls,
+  null_equality compare_nulls,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  std::size_t const join_size = output_size ? *output_size
+                                            : compute_join_output_size(build_table,
+                                                                       probe_table,
+                                                                       preprocessed_build,
+                                                                       preprocessed_probe,
+                                                                       hash_table,
+                                                                       join,
+                                                                       has_nulls,
+                                                                       compare_nulls,
+                                                                       stream);
+  CUDF_EXPECTS(join_size <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Join output exceeds the column size limit",
+               std::overflow_error);
+  auto const num_output_rows = static_cast<size_type>(join_size);
+
+  auto [probe_outputs, probe_gather] =
+    make_gather_columns(probe_columns, num_output_rows, false, stream, mr);
+  auto [build_outputs, build_gather] = make_gather_columns(
+    build_columns, num_output_rows, join == join_kind::LEFT_JOIN, stream, mr);
+
+  if (num_output_rows != 0) {
+    auto const d_probe_gather = cudf::detail::make_device_uvector_async(
+      probe_gather, stream, rmm::mr::get_current_device_resource());
+    auto const d_build_gather = cudf::detail::make_device_uvector_async(
+      build_gather, stream, rmm::mr::get_current_device_resource());
+    retrieve_join_pairs(
+      probe_table,
+      preprocessed_build,
+      preprocessed_probe,
+      hash_table,
+      join,
+      has_nulls,
+      compare_nulls,
+      gather_output_iterator{d_probe_gather.data(), static_cast<size_type>(d_probe_gather.size())},
+      gather_output_iterator{d_build_gather.data(), static_cast<size_type>(d_build_gather.size())},
+      stream,
+      std::nullopt);
+  }
+
+  auto outputs = std::move(probe_outputs);
+  std::move(build_outputs.begin(), build_outputs.end(), std::back_inserter(outputs));
+  for (auto& output : outputs) {
+    if (output->nullable()) {
+      output->set_null_count(
+        cudf::detail::null_count(output->view().null_mask(), 0, num_output_rows, stream));
+    }
+  }
+  return std::make_unique<cudf::table>(std::move(outputs));
+}
 }  // namespace
 
 template <typename Hasher>
@@ -375,7 +1274,11 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
                 cudf::detail::cuco_allocator{stream}},
     _build{build},
     _preprocessed_build{
-      cudf::experimental::row::equality::preprocessed_table::create(_build, stream)}
+      cudf::experimental::row::equality::preprocessed_table::create(_build, stream)},
+    _heavy_hitter_hashes{0, stream},
+    _heavy_hitter_keys{0, stream},
+    _heavy_hitter_offsets{0, stream},
+    _heavy_hitter_rows{0, stream}
 {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
@@ -391,6 +1294,12 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
                                       _nulls_equal,
                                       reinterpret_cast<bitmask_type const*>(row_bitmask.data()),
                                       stream);
+
+  // The rows of the keys with many build rows are also grouped by key, so that the matches of the
+  // probe rows of these keys are expanded in parallel instead of by probing long chains of the
+  // hash table. The hash table still has all build rows for the other kinds of joins.
+  std::tie(_heavy_hitter_hashes, _heavy_hitter_keys, _heavy_hitter_offsets, _heavy_hitter_rows) =
+    find_heavy_hitters(_build, _preprocessed_build, _has_nulls, _nulls_equal, stream);
 }
 
 template <typename Hasher>
@@ -405,6 +1314,58 @@ hash_join<Hasher>::inner_join(cudf::table_view const& probe,
   return compute_hash_join(probe, cudf::detail::join_kind::INNER_JOIN, output_size, stream, mr);
 }
 
+template <typename Hasher>
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join<Hasher>::inner_join_chunk(cudf::table_view const& probe,
+                                    size_type probe_row_begin,
+                                    std::size_t max_output_size,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+
+  CUDF_EXPECTS(_build.num_columns() == probe.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
+               "Probe table has nulls while build table was not hashed with null check.");
+
+  CUDF_EXPECTS(probe_row_begin >= 0 and probe_row_begin <= probe.num_rows(),
+               "Probe row cursor is out of bounds",
+               std::out_of_range);
+  CUDF_EXPECTS(max_output_size > 0,
+               "Maximum output size of a chunk must be positive",
+               std::invalid_argument);
+
+  // No probe row has a match if the build table is empty
+  if (_is_empty or probe_row_begin == probe.num_rows()) {
+    return std::tuple(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                      std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                      probe.num_rows());
+  }
+
+  CUDF_EXPECTS(cudf::have_same_types(_build, probe),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+
+  auto const preprocessed_probe =
+    cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  return cudf::detail::probe_join_hash_table_chunk(_build,
+                                                   probe,
+                                                   _preprocessed_build,
+                                                   preprocessed_probe,
+                                                   _hash_table,
+                                                   _has_nulls,
+                                                   _nulls_equal,
+                                                   probe_row_begin,
+                                                   max_output_size,
+                                                   stream,
+                                                   mr);
+}
+
 template <typename Hasher>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -429,6 +1390,44 @@ hash_join<Hasher>::full_join(cudf::table_view const& probe,
   return compute_hash_join(probe, cudf::detail::join_kind::FULL_JOIN, output_size, stream, mr);
 }
 
+template <typename Hasher>
+std::unique_ptr<cudf::table> hash_join<Hasher>::inner_join_and_gather(
+  cudf::table_view const& probe,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return join_and_gather(probe,
+                         cudf::detail::join_kind::INNER_JOIN,
+                         probe_columns,
+                         build_columns,
+                         output_size,
+                         stream,
+                         mr);
+}
+
+template <typename Hasher>
+std::unique_ptr<cudf::table> hash_join<Hasher>::left_join_and_gather(
+  cudf::table_view const& probe,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return join_and_gather(probe,
+                         cudf::detail::join_kind::LEFT_JOIN,
+                         probe_columns,
+                         build_columns,
+                         output_size,
+                         stream,
+                         mr);
+}
+
 template <typename Hasher>
 std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
                                                rmm::cuda_stream_view stream) const
@@ -441,18 +1440,7 @@ std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
   CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
                "Probe table has nulls while build table was not hashed with null check.");
 
-  auto const preprocessed_probe =
-    cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
-
-  return cudf::detail::compute_join_output_size(_build,
-                                                probe,
-                                                _preprocessed_build,
-                                                preprocessed_probe,
-                                                _hash_table,
-                                                cudf::detail::join_kind::INNER_JOIN,
-                                                _has_nulls,
-                                                _nulls_equal,
-                                                stream);
+  return compute_join_size(probe, cudf::detail::join_kind::INNER_JOIN, stream);
 }
 
 template <typename Hasher>
@@ -467,18 +1455,7 @@ std::size_t hash_join<Hasher>::left_join_size(cudf::table_view const& probe,
   CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
                "Probe table has nulls while build table was not hashed with null check.");
 
-  auto const preprocessed_probe =
-    cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
-
-  return cudf::detail::compute_join_output_size(_build,
-                                                probe,
-                                                _preprocessed_build,
-                                                preprocessed_probe,
-                                                _hash_table,
-                                                cudf::detail::join_kind::LEFT_JOIN,
-                                                _has_nulls,
-                                                _nulls_equal,
-                                                stream);
+  return compute_join_size(probe, cudf::detail::join_kind::LEFT_JOIN, stream);
 }
 
 template <typename Hasher>
@@ -508,6 +1485,34 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
                                           mr);
 }
 
+template <typename Hasher>
+std::unique_ptr<join_bloom_filter> hash_join<Hasher>::bloom_filter(
+  double false_positive_rate, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<join_bloom_filter>(_build, false_positive_rate, stream, mr);
+}
+
+template <typename Hasher>
+std::unique_ptr<rmm::device_uvector<size_type>> hash_join<Hasher>::left_semi_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return semi_anti_join(probe, cudf::detail::join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+template <typename Hasher>
+std::unique_ptr<rmm::device_uvector<size_type>> hash_join<Hasher>::left_anti_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return semi_anti_join(probe, cudf::detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
+
 template <typename Hasher>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -529,17 +1534,50 @@ hash_join<Hasher>::probe_join_indices(cudf::table_view const& probe_table,
 
   auto const preprocessed_probe =
     cudf::experimental::row::equality::preprocessed_table::create(probe_table, stream);
-  auto join_indices = cudf::detail::probe_join_hash_table(_build,
-                                                          probe_table,
-                                                          _preprocessed_build,
-                                                          preprocessed_probe,
-                                                          _hash_table,
-                                                          join,
-                                                          _has_nulls,
-                                                          _nulls_equal,
-                                                          output_size,
-                                                          stream,
-                                                          mr);
+  auto join_indices = [&] {
+    if (_heavy_hitter_keys.is_empty()) {
+      return cudf::detail::probe_join_hash_table(_build,
+                                                 probe_table,
+                                                 _preprocessed_build,
+                                                 preprocessed_probe,
+                                                 _hash_table,
+                                                 join,
+                                                 _has_nulls,
+                                                 _nulls_equal,
+                                                 output_size,
+                                                 stream,
+                                                 mr);
+    }
+
+    // The probe rows of heavy hitter keys are matched with the grouped build rows of their key and
+    // only the other probe rows probe the hash table
+    auto const probe_keys  = find_probe_heavy_hitters(probe_table,
+                                                     _preprocessed_build,
+                                                     preprocessed_probe,
+                                                     _heavy_hitter_hashes,
+                                                     _heavy_hitter_keys,
+                                                     _has_nulls,
+                                                     _nulls_equal,
+                                                     stream);
+    auto const light_rows  = non_heavy_hitter_rows(probe_keys, stream);
+    auto const output_ends = heavy_hitter_output_ends(probe_keys, _heavy_hitter_offsets, stream);
+
+    auto light_indices = cudf::detail::probe_join_hash_table(_build,
+                                                             probe_table,
+                                                             _preprocessed_build,
+                                                             preprocessed_probe,
+                                                             _hash_table,
+                                                             join,
+                                                             _has_nulls,
+                                                             _nulls_equal,
+                                                             std::nullopt,
+                                                             stream,
+                                                             mr,
+                                                             light_rows);
+    auto heavy_indices = expand_heavy_hitter_matches(
+      probe_keys, output_ends, _heavy_hitter_offsets, _heavy_hitter_rows, stream, mr);
+    return detail::concatenate_vector_pairs(light_indices, heavy_indices, stream);
+  }();
 
   if (join == cudf::detail::join_kind::FULL_JOIN) {
     auto complement_indices = detail::get_left_join_indices_complement(
@@ -549,6 +1587,48 @@ hash_join<Hasher>::probe_join_indices(cudf::table_view const& probe_table,
   return join_indices;
 }
 
+template <typename Hasher>
+std::size_t hash_join<Hasher>::compute_join_size(cudf::table_view const& probe_table,
+                                                 cudf::detail::join_kind join,
+                                                 rmm::cuda_stream_view stream) const
+{
+  auto const preprocessed_probe =
+    cudf::experimental::row::equality::preprocessed_table::create(probe_table, stream);
+  if (_heavy_hitter_keys.is_empty()) {
+    return cudf::detail::compute_join_output_size(_build,
+                                                  probe_table,
+                                                  _preprocessed_build,
+                                                  preprocessed_probe,
+                                                  _hash_table,
+                                                  join,
+                                                  _has_nulls,
+                                                  _nulls_equal,
+                                                  stream);
+  }
+
+  auto const probe_keys  = find_probe_heavy_hitters(probe_table,
+                                                   _preprocessed_build,
+                                                   preprocessed_probe,
+                                                   _heavy_hitter_hashes,
+                                                   _heavy_hitter_keys,
+                                                   _has_nulls,
+                                                   _nulls_equal,
+                                                   stream);
+  auto const light_rows  = non_heavy_hitter_rows(probe_keys, stream);
+  auto const output_ends = heavy_hitter_output_ends(probe_keys, _heavy_hitter_offsets, stream);
+  auto const light_size  = cudf::detail::compute_join_output_size(_build,
+                                                                 probe_table,
+                                                                 _preprocessed_build,
+                                                                 preprocessed_probe,
+                                                                 _hash_table,
+                                                                 join,
+                                                                 _has_nulls,
+                                                                 _nulls_equal,
+                                                                 stream,
+                                                                 light_rows);
+  return light_size + (output_ends.is_empty() ? std::size_t{0} : output_ends.back_element(stream));
+}
+
 template <typename Hasher>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -577,6 +1657,120 @@ hash_join<Hasher>::compute_hash_join(cudf::table_view const& probe,
 
   return probe_join_indices(probe, join, output_size, stream, mr);
 }
+
+template <typename Hasher>
+std::unique_ptr<cudf::table> hash_join<Hasher>::join_and_gather(
+  cudf::table_view const& probe,
+  cudf::detail::join_kind join,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_EXPECTS(probe_columns.num_columns() == 0 or probe_columns.num_rows() == probe.num_rows(),
+               "Mismatch in number of rows of the probe table and of its gathered columns");
+  CUDF_EXPECTS(build_columns.num_columns() == 0 or build_columns.num_rows() == _build.num_rows(),
+               "Mismatch in number of rows of the build table and of its gathered columns");
+
+  auto const is_fixed_width = [](cudf::table_view const& table) {
+    return std::all_of(
+      table.begin(), table.end(), [](auto const& col) { return cudf::is_fixed_width(col.type()); });
+  };
+
+  // The gathered rows are written by the probe of the hash table if all columns are fixed-width.
+  // Otherwise, and if the probe rows of heavy hitter keys are expanded separately, the join
+  // indices are gathered.
+  if (not _is_empty and not is_trivial_join(probe, _build, join) and
+      _heavy_hitter_keys.is_empty() and is_fixed_width(probe_columns) and
+      is_fixed_width(build_columns)) {
+    CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+    CUDF_EXPECTS(_build.num_columns() == probe.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
+                 "Probe table has nulls while build table was not hashed with null check.");
+    CUDF_EXPECTS(cudf::have_same_types(_build, probe),
+                 "Mismatch in joining column data types",
+                 cudf::data_type_error);
+
+    auto const preprocessed_probe =
+      cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+    return cudf::detail::probe_join_hash_table_gather(_build,
+                                                      probe,
+                                                      _preprocessed_build,
+                                                      preprocessed_probe,
+                                                      _hash_table,
+                                                      join,
+                                                      _has_nulls,
+                                                      _nulls_equal,
+                                                      probe_columns,
+                                                      build_columns,
+                                                      output_size,
+                                                      stream,
+                                                      mr);
+  }
+
+  auto const [probe_indices, build_indices] =
+    compute_hash_join(probe, join, output_size, stream, rmm::mr::get_current_device_resource());
+  auto outputs = cudf::detail::gather(probe_columns,
+                                      cudf::device_span<size_type const>{*probe_indices},
+                                      cudf::out_of_bounds_policy::DONT_CHECK,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                      stream,
+                                      mr)
+                   ->release();
+  auto build_outputs = cudf::detail::gather(build_columns,
+                                            cudf::device_span<size_type const>{*build_indices},
+                                            cudf::out_of_bounds_policy::NULLIFY,
+                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                            stream,
+                                            mr)
+                         ->release();
+  std::move(build_outputs.begin(), build_outputs.end(), std::back_inserter(outputs));
+  return std::make_unique<cudf::table>(std::move(outputs));
+}
+
+template <typename Hasher>
+std::unique_ptr<rmm::device_uvector<size_type>> hash_join<Hasher>::semi_anti_join(
+  cudf::table_view const& probe,
+  cudf::detail::join_kind join,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+
+  CUDF_EXPECTS(_build.num_columns() == probe.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
+               "Probe table has nulls while build table was not hashed with null check.");
+
+  // No probe row has a match if the build table is empty
+  if (_is_empty or probe.num_rows() == 0) {
+    auto const num_indices =
+      join == cudf::detail::join_kind::LEFT_ANTI_JOIN ? probe.num_rows() : size_type{0};
+    auto indices = std::make_unique<rmm::device_uvector<size_type>>(num_indices, stream, mr);
+    thrust::sequence(rmm::exec_policy(stream), indices->begin(), indices->end());
+    return indices;
+  }
+
+  CUDF_EXPECTS(cudf::have_same_types(_build, probe),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+
+  auto const preprocessed_probe =
+    cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  return cudf::detail::probe_semi_anti_join(_build,
+                                            probe,
+                                            _preprocessed_build,
+                                            preprocessed_probe,
+                                            _hash_table,
+                                            join,
+                                            _has_nulls,
+                                            _nulls_equal,
+                                            stream,
+                                            mr);
+}
 }  // namespace detail
 
 hash_join::~hash_join() = default;
@@ -608,6 +1802,18 @@ hash_join::inner_join(cudf::table_view const& probe,
   return _impl->inner_join(probe, output_size, stream, mr);
 }
 
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::inner_join_chunk(cudf::table_view const& probe,
+                            size_type probe_row_begin,
+                            std::size_t max_output_size,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr) const
+{
+  return _impl->inner_join_chunk(probe, probe_row_begin, max_output_size, stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::left_join(cudf::table_view const& probe,
@@ -618,6 +1824,29 @@ hash_join::left_join(cudf::table_view const& probe,
   return _impl->left_join(probe, output_size, stream, mr);
 }
 
+std::unique_ptr<cudf::table> hash_join::inner_join_and_gather(
+  cudf::table_view const& probe,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  return _impl->inner_join_and_gather(
+    probe, probe_columns, build_columns, output_size, stream, mr);
+}
+
+std::unique_ptr<cudf::table> hash_join::left_join_and_gather(
+  cudf::table_view const& probe,
+  cudf::table_view const& probe_columns,
+  cudf::table_view const& build_columns,
+  std::optional<std::size_t> output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_join_and_gather(probe, probe_columns, build_columns, output_size, stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::full_join(cudf::table_view const& probe,
@@ -647,4 +1876,27 @@ std::size_t hash_join::full_join_size(cudf::table_view const& probe,
   return _impl->full_join_size(probe, stream, mr);
 }
 
+std::unique_ptr<join_bloom_filter> hash_join::bloom_filter(double false_positive_rate,
+                                                           rmm::cuda_stream_view stream,
+                                                           rmm::device_async_resource_ref mr) const
+{
+  return _impl->bloom_filter(false_positive_rate, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> hash_join::left_semi_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_semi_join(probe, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> hash_join::left_anti_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_anti_join(probe, stream, mr);
+}
+
 }  // namespace cudf
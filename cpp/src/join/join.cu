@@ -15,16 +15,27 @@
  */
 #include "join_common_utils.hpp"
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/sequence.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/gather.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -113,8 +124,117 @@ full_join(table_view const& left_input,
   return hj_obj.full_join(left, std::nullopt, stream, mr);
 }
 
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_input,
+                       table_view const& right_input,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive", std::invalid_argument);
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  if (num_partitions == 1 or left_input.num_rows() == 0 or right_input.num_rows() == 0) {
+    return inner_join(left_input, right_input, compare_nulls, stream, mr);
+  }
+
+  // Make sure any dictionary columns have matched key sets, so that equal keys hash equally
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input}, stream, rmm::mr::get_current_device_resource());
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  // Partition the keys of both tables by hash, along with the row index of each key, so that rows
+  // with equal keys land in the same partition
+  std::vector<size_type> key_columns(left.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  auto const partition_keys = [&](table_view const& keys) {
+    auto const row_indices = cudf::detail::sequence(keys.num_rows(),
+                                                    numeric_scalar<size_type>(0, true, stream),
+                                                    stream,
+                                                    rmm::mr::get_current_device_resource());
+    std::vector<column_view> columns(keys.begin(), keys.end());
+    columns.push_back(row_indices->view());
+    return cudf::hash_partition(table_view{columns},
+                                key_columns,
+                                num_partitions,
+                                hash_id::HASH_MURMUR3,
+                                DEFAULT_HASH_SEED,
+                                stream,
+                                rmm::mr::get_current_device_resource());
+  };
+  auto const [left_partitioned, left_offsets]   = partition_keys(left);
+  auto const [right_partitioned, right_offsets] = partition_keys(right);
+
+  // Join each pair of partitions; their hash tables are a fraction of the size of a hash table
+  // built on the whole build side
+  struct partition_result {
+    column_view left_row_indices;
+    column_view right_row_indices;
+    std::unique_ptr<rmm::device_uvector<size_type>> left_indices;
+    std::unique_ptr<rmm::device_uvector<size_type>> right_indices;
+  };
+  auto const get_partition =
+    [&](table_view const& partitioned, std::vector<size_type> const& offsets, size_type p) {
+      auto const end = p + 1 < num_partitions ? offsets[p + 1] : partitioned.num_rows();
+      return cudf::slice(partitioned, {offsets[p], end}, stream).front();
+    };
+  std::vector<partition_result> results;
+  std::size_t output_size = 0;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const left_part  = get_partition(left_partitioned->view(), left_offsets, p);
+    auto const right_part = get_partition(right_partitioned->view(), right_offsets, p);
+    if (left_part.num_rows() == 0 or right_part.num_rows() == 0) { continue; }
+
+    auto [left_indices, right_indices] = inner_join(left_part.select(key_columns),
+                                                    right_part.select(key_columns),
+                                                    compare_nulls,
+                                                    stream,
+                                                    rmm::mr::get_current_device_resource());
+    output_size += left_indices->size();
+    results.push_back({left_part.column(left.num_columns()),
+                       right_part.column(right.num_columns()),
+                       std::move(left_indices),
+                       std::move(right_indices)});
+  }
+
+  // Map the indices of the partitions back to the rows of the input tables
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  std::size_t offset = 0;
+  for (auto const& result : results) {
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   result.left_indices->begin(),
+                   result.left_indices->end(),
+                   result.left_row_indices.begin<size_type>(),
+                   left_indices->begin() + offset);
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   result.right_indices->begin(),
+                   result.right_indices->end(),
+                   result.right_row_indices.begin<size_type>(),
+                   right_indices->begin() + offset);
+    offset += result.left_indices->size();
+  }
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
 }  // namespace detail
 
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left,
+                       table_view const& right,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_inner_join(
+    left, right, num_partitions, compare_nulls, cudf::get_default_stream(), mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 inner_join(table_view const& left,
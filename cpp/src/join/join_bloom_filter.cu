@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/atomic>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace cudf {
+namespace {
+
+// The filter is a split block bloom filter: each key sets one bit in each word of a single block,
+// so that a lookup reads one block of 32 bytes
+using bloom_filter_word                       = join_bloom_filter::word_type;
+constexpr int bloom_filter_block_words        = 8;
+constexpr std::size_t bloom_filter_block_bits = bloom_filter_block_words * 32;
+
+/**
+ * @brief Returns the bit set by `hash` in the `i`-th word of its block
+ */
+__device__ inline bloom_filter_word bloom_filter_mask(hash_value_type hash, int i)
+{
+  // Odd constants of the Parquet split block bloom filter
+  constexpr uint32_t salts[bloom_filter_block_words] = {0x47b6137bU,
+                                                         0x44974d91U,
+                                                         0x8824ad5bU,
+                                                         0xa2b7289dU,
+                                                         0x705495c7U,
+                                                         0x2df1424bU,
+                                                         0x9efc4947U,
+                                                         0x5c6bfb31U};
+  return bloom_filter_word{1} << ((hash * salts[i]) >> 27);
+}
+
+/**
+ * @brief Returns the block of `hash`
+ */
+__device__ inline std::size_t bloom_filter_block(hash_value_type hash, std::size_t num_blocks)
+{
+  // Remix the hash so that the block does not depend on the bits selected within the block
+  auto h = hash;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+  return (static_cast<uint64_t>(h) * num_blocks) >> 32;
+}
+
+template <typename Hasher>
+struct insert_fn {
+  Hasher hasher;
+  bloom_filter_word* words;
+  std::size_t num_blocks;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const hash = hasher(row);
+    auto* block     = words + bloom_filter_block(hash, num_blocks) * bloom_filter_block_words;
+    for (int i = 0; i < bloom_filter_block_words; ++i) {
+      cuda::atomic_ref<bloom_filter_word, cuda::thread_scope_device> word{block[i]};
+      word.fetch_or(bloom_filter_mask(hash, i), cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+template <typename Hasher>
+struct contains_fn {
+  Hasher hasher;
+  bloom_filter_word const* words;
+  std::size_t num_blocks;
+
+  __device__ bool operator()(size_type row) const
+  {
+    auto const hash   = hasher(row);
+    auto const* block = words + bloom_filter_block(hash, num_blocks) * bloom_filter_block_words;
+    for (int i = 0; i < bloom_filter_block_words; ++i) {
+      auto const mask = bloom_filter_mask(hash, i);
+      if ((block[i] & mask) != mask) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Returns the number of blocks of a filter of `num_keys` keys with the given false
+ * positive rate
+ */
+std::size_t bloom_filter_num_blocks(size_type num_keys, double false_positive_rate)
+{
+  // Number of bits of a split block bloom filter with eight bits per key
+  auto const num_bits =
+    -bloom_filter_block_words * static_cast<double>(std::max(num_keys, 1)) /
+    std::log(1.0 - std::pow(false_positive_rate, 1.0 / bloom_filter_block_words));
+  return std::max<std::size_t>(
+    1, static_cast<std::size_t>(std::ceil(num_bits / bloom_filter_block_bits)));
+}
+
+}  // namespace
+
+join_bloom_filter::join_bloom_filter(cudf::table_view const& build,
+                                     double false_positive_rate,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  : _num_columns{build.num_columns()}, _words{0, stream, mr}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Bloom filter build table is empty");
+  CUDF_EXPECTS(false_positive_rate > 0.0 and false_positive_rate < 1.0,
+               "False positive rate must be in the range (0, 1)",
+               std::invalid_argument);
+
+  auto const num_blocks = bloom_filter_num_blocks(build.num_rows(), false_positive_rate);
+  _words.resize(num_blocks * bloom_filter_block_words, stream);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    _words.data(), 0, _words.size() * sizeof(bloom_filter_word), stream.value()));
+  if (build.num_rows() == 0) { return; }
+
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(build, stream);
+  auto const hasher =
+    row_hasher.device_hasher(cudf::nullate::DYNAMIC{cudf::has_nested_nulls(build)});
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     build.num_rows(),
+                     insert_fn<decltype(hasher)>{hasher, _words.data(), num_blocks});
+}
+
+std::unique_ptr<column> join_bloom_filter::contains(cudf::table_view const& probe,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_num_columns == probe.num_columns(),
+               "Mismatch in number of columns of the build and probe tables");
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (probe.num_rows() == 0) { return result; }
+
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(probe, stream);
+  auto const hasher =
+    row_hasher.device_hasher(cudf::nullate::DYNAMIC{cudf::has_nested_nulls(probe)});
+  auto const num_blocks = _words.size() / bloom_filter_block_words;
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(probe.num_rows()),
+                    result->mutable_view().begin<bool>(),
+                    contains_fn<decltype(hasher)>{hasher, _words.data(), num_blocks});
+  return result;
+}
+
+}  // namespace cudf
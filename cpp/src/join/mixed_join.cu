@@ -20,6 +20,7 @@
 
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/join.hpp>
@@ -29,6 +30,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -37,120 +39,55 @@
 #include <thrust/fill.h>
 #include <thrust/scan.h>
 
+#include <limits>
+#include <memory>
 #include <optional>
 #include <utility>
 
 namespace cudf {
 namespace detail {
+namespace {
 
-std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
-          std::unique_ptr<rmm::device_uvector<size_type>>>
-mixed_join(
-  table_view const& left_equality,
-  table_view const& right_equality,
+/**
+ * @brief Computes the number of output rows of each row of the probe table of a mixed join whose
+ * hash table and expression are already built
+ *
+ * @param probe The table used for the equality join that probes `hash_table`
+ * @param build The table used for the equality join that `hash_table` is built from
+ * @param preprocessed_build The preprocessed `build` table
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param hash_table The hash table built from `build`
+ * @param parser The parsed expression of the conditional join
+ * @param has_nulls Whether any of the tables or the expression may produce nulls
+ * @param compare_nulls Whether or not null values join to each other or not
+ * @param join_type The type of join; `INNER_JOIN` or `LEFT_JOIN`
+ * @param swap_tables Whether `probe` is the right table
+ * @param matches_per_row_span Output number of matches of each row of `probe`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The output size of the join
+ */
+std::size_t probe_mixed_join_output_size(
+  table_view const& probe,
+  table_view const& build,
+  std::shared_ptr<experimental::row::equality::preprocessed_table> const& preprocessed_build,
   table_view const& left_conditional,
   table_view const& right_conditional,
-  ast::expression const& binary_predicate,
+  mixed_multimap_type const& hash_table,
+  ast::detail::expression_parser const& parser,
+  cudf::nullate::DYNAMIC has_nulls,
   null_equality compare_nulls,
   join_kind join_type,
-  std::optional<std::pair<std::size_t, device_span<size_type const>>> const& output_size_data,
-  rmm::cuda_stream_view stream,
-  rmm::device_async_resource_ref mr)
+  bool swap_tables,
+  cudf::device_span<size_type> matches_per_row_span,
+  rmm::cuda_stream_view stream)
 {
-  CUDF_EXPECTS(left_conditional.num_rows() == left_equality.num_rows(),
-               "The left conditional and equality tables must have the same number of rows.");
-  CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
-               "The right conditional and equality tables must have the same number of rows.");
-
-  CUDF_EXPECTS((join_type != join_kind::LEFT_SEMI_JOIN) && (join_type != join_kind::LEFT_ANTI_JOIN),
-               "Left semi and anti joins should use mixed_join_semi.");
-
-  auto const right_num_rows{right_conditional.num_rows()};
-  auto const left_num_rows{left_conditional.num_rows()};
-  auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
-
-  // The "outer" table is the larger of the two tables. The kernels are
-  // launched with one thread per row of the outer table, which also means that
-  // it is the probe table for the hash
-  auto const outer_num_rows{swap_tables ? right_num_rows : left_num_rows};
-
-  // We can immediately filter out cases where the right table is empty. In
-  // some cases, we return all the rows of the left table with a corresponding
-  // null index for the right table; in others, we return an empty output.
-  if (right_num_rows == 0) {
-    switch (join_type) {
-      // Left and full joins all return all the row indices from
-      // left with a corresponding NULL from the right.
-      case join_kind::LEFT_JOIN:
-      case join_kind::FULL_JOIN:
-        return get_trivial_left_join_indices(
-          left_conditional, stream, rmm::mr::get_current_device_resource());
-      // Inner joins return empty output because no matches can exist.
-      case join_kind::INNER_JOIN:
-        return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
-                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
-      default: CUDF_FAIL("Invalid join kind."); break;
-    }
-  } else if (left_num_rows == 0) {
-    switch (join_type) {
-      // Left and inner joins all return empty sets.
-      case join_kind::LEFT_JOIN:
-      case join_kind::INNER_JOIN:
-        return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
-                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
-      // Full joins need to return the trivial complement.
-      case join_kind::FULL_JOIN: {
-        auto ret_flipped = get_trivial_left_join_indices(
-          right_conditional, stream, rmm::mr::get_current_device_resource());
-        return std::pair(std::move(ret_flipped.second), std::move(ret_flipped.first));
-      }
-      default: CUDF_FAIL("Invalid join kind."); break;
-    }
-  }
-
-  // If evaluating the expression may produce null outputs we create a nullable
-  // output column and follow the null-supporting expression evaluation code
-  // path.
-  auto const has_nulls = cudf::nullate::DYNAMIC{
-    cudf::has_nulls(left_equality) || cudf::has_nulls(right_equality) ||
-    binary_predicate.may_evaluate_null(left_conditional, right_conditional, stream)};
-
-  auto const parser = ast::detail::expression_parser{
-    binary_predicate, left_conditional, right_conditional, has_nulls, stream, mr};
-  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
-               "The expression must produce a boolean output.");
-
-  // TODO: The non-conditional join impls start with a dictionary matching,
-  // figure out what that is and what it's needed for (and if conditional joins
-  // need to do the same).
-  auto& probe     = swap_tables ? right_equality : left_equality;
-  auto& build     = swap_tables ? left_equality : right_equality;
-  auto probe_view = table_device_view::create(probe, stream);
-  auto build_view = table_device_view::create(build, stream);
-
-  // Don't use multimap_type because we want a CG size of 1.
-  mixed_multimap_type hash_table{compute_hash_table_size(build.num_rows()),
-                                 cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
-                                 cuco::empty_value{cudf::detail::JoinNoneValue},
-                                 stream.value(),
-                                 cudf::detail::cuco_allocator{stream}};
-
-  // TODO: To add support for nested columns we will need to flatten in many
-  // places. However, this probably isn't worth adding any time soon since we
-  // won't be able to support AST conditions for those types anyway.
-  auto const row_bitmask =
-    cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
-  auto const preprocessed_build =
-    experimental::row::equality::preprocessed_table::create(build, stream);
-  build_join_hash_table(build,
-                        preprocessed_build,
-                        hash_table,
-                        has_nulls,
-                        compare_nulls,
-                        static_cast<bitmask_type const*>(row_bitmask.data()),
-                        stream);
-  auto hash_table_view = hash_table.get_device_view();
+  auto const outer_num_rows = probe.num_rows();
 
+  auto probe_view             = table_device_view::create(probe, stream);
+  auto build_view             = table_device_view::create(build, stream);
+  auto hash_table_view        = hash_table.get_device_view();
   auto left_conditional_view  = table_device_view::create(left_conditional, stream);
   auto right_conditional_view = table_device_view::create(right_conditional, stream);
 
@@ -158,15 +95,9 @@ mixed_join(
   // whichever table is larger rather than always using the left table.
   detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
-  join_kind const kernel_join_type =
-    join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
 
-  // If the join size data was not provided as an input, compute it here.
-  std::size_t join_size;
-  // Using an optional because we only need to allocate a new vector if one was
-  // not passed as input, and rmm::device_uvector is not default constructible
-  std::optional<rmm::device_uvector<size_type>> matches_per_row{};
-  device_span<size_type const> matches_per_row_span{};
+  // Allocate storage for the counter used to get the size of the join output
+  rmm::device_scalar<std::size_t> size(0, stream);
 
   auto const preprocessed_probe =
     experimental::row::equality::preprocessed_table::create(probe, stream);
@@ -176,66 +107,136 @@ mixed_join(
     cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
   auto const equality_probe = row_comparator.equal_to<false>(has_nulls, compare_nulls);
 
+  // Determine number of output rows without actually building the output to simply
+  // find what the size of the output will be.
+  if (has_nulls) {
+    compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_conditional_view,
+        *right_conditional_view,
+        *probe_view,
+        *build_view,
+        hash_probe,
+        equality_probe,
+        join_type,
+        hash_table_view,
+        parser.device_expression_data,
+        swap_tables,
+        size.data(),
+        matches_per_row_span);
+  } else {
+    compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_conditional_view,
+        *right_conditional_view,
+        *probe_view,
+        *build_view,
+        hash_probe,
+        equality_probe,
+        join_type,
+        hash_table_view,
+        parser.device_expression_data,
+        swap_tables,
+        size.data(),
+        matches_per_row_span);
+  }
+
+  return size.value(stream);
+}
+
+/**
+ * @brief Probes the hash table of a mixed join whose hash table and expression are already built,
+ * and returns the output indices of the left and right tables
+ *
+ * The parameters are those of `probe_mixed_join_output_size`, where `join_type` may also be
+ * `FULL_JOIN`, and:
+ *
+ * @param output_size_data An optional pair of values indicating the exact output size and the
+ * number of matches for each row of `probe`
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`]
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+probe_mixed_join(
+  table_view const& probe,
+  table_view const& build,
+  std::shared_ptr<experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  mixed_multimap_type const& hash_table,
+  ast::detail::expression_parser const& parser,
+  cudf::nullate::DYNAMIC has_nulls,
+  null_equality compare_nulls,
+  join_kind join_type,
+  bool swap_tables,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> const& output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const outer_num_rows = probe.num_rows();
+  join_kind const kernel_join_type =
+    join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
+
+  // If the join size data was not provided as an input, compute it here.
+  std::size_t join_size;
+  // Using an optional because we only need to allocate a new vector if one was
+  // not passed as input, and rmm::device_uvector is not default constructible
+  std::optional<rmm::device_uvector<size_type>> matches_per_row{};
+  device_span<size_type const> matches_per_row_span{};
+
   if (output_size_data.has_value()) {
     join_size            = output_size_data->first;
     matches_per_row_span = output_size_data->second;
   } else {
-    // Allocate storage for the counter used to get the size of the join output
-    rmm::device_scalar<std::size_t> size(0, stream, mr);
-
     matches_per_row =
       rmm::device_uvector<size_type>{static_cast<std::size_t>(outer_num_rows), stream, mr};
-    // Note that the view goes out of scope after this else statement, but the
-    // data owned by matches_per_row stays alive so the data pointer is valid.
-    auto mutable_matches_per_row_span = cudf::device_span<size_type>{
-      matches_per_row->begin(), static_cast<std::size_t>(outer_num_rows)};
     matches_per_row_span = cudf::device_span<size_type const>{
       matches_per_row->begin(), static_cast<std::size_t>(outer_num_rows)};
-    if (has_nulls) {
-      compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_conditional_view,
-          *right_conditional_view,
-          *probe_view,
-          *build_view,
-          hash_probe,
-          equality_probe,
-          kernel_join_type,
-          hash_table_view,
-          parser.device_expression_data,
-          swap_tables,
-          size.data(),
-          mutable_matches_per_row_span);
-    } else {
-      compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_conditional_view,
-          *right_conditional_view,
-          *probe_view,
-          *build_view,
-          hash_probe,
-          equality_probe,
-          kernel_join_type,
-          hash_table_view,
-          parser.device_expression_data,
-          swap_tables,
-          size.data(),
-          mutable_matches_per_row_span);
-    }
-    join_size = size.value(stream);
+
+    join_size = probe_mixed_join_output_size(probe,
+                                             build,
+                                             preprocessed_build,
+                                             left_conditional,
+                                             right_conditional,
+                                             hash_table,
+                                             parser,
+                                             has_nulls,
+                                             compare_nulls,
+                                             kernel_join_type,
+                                             swap_tables,
+                                             *matches_per_row,
+                                             stream);
   }
 
-  // The initial early exit clauses guarantee that we will not reach this point
-  // unless both the left and right tables are non-empty. Under that
-  // constraint, neither left nor full joins can return an empty result since
-  // at minimum we are guaranteed null matches for all non-matching rows. In
-  // all other cases (inner, left semi, and left anti joins) if we reach this
-  // point we can safely return an empty result.
+  // The callers exit early unless both the left and right tables are non-empty.
+  // Under that constraint, neither left nor full joins can return an empty
+  // result since at minimum we are guaranteed null matches for all
+  // non-matching rows. In all other cases (inner, left semi, and left anti
+  // joins) if we reach this point we can safely return an empty result.
   if (join_size == 0) {
     return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
                      std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
   }
 
+  auto probe_view             = table_device_view::create(probe, stream);
+  auto build_view             = table_device_view::create(build, stream);
+  auto hash_table_view        = hash_table.get_device_view();
+  auto left_conditional_view  = table_device_view::create(left_conditional, stream);
+  auto right_conditional_view = table_device_view::create(right_conditional, stream);
+
+  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  auto const preprocessed_probe =
+    experimental::row::equality::preprocessed_table::create(probe, stream);
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = row_hash.device_hasher(has_nulls);
+  auto const row_comparator =
+    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+  auto const equality_probe = row_comparator.equal_to<false>(has_nulls, compare_nulls);
+
   // Given the number of matches per row, we need to compute the offsets for insertion.
   auto join_result_offsets =
     rmm::device_uvector<size_type>{static_cast<std::size_t>(outer_num_rows), stream, mr};
@@ -289,13 +290,148 @@ mixed_join(
   // For full joins, get the indices in the right table that were not joined to
   // by any row in the left table.
   if (join_type == join_kind::FULL_JOIN) {
-    auto complement_indices = detail::get_left_join_indices_complement(
-      join_indices.second, left_num_rows, right_num_rows, stream, mr);
+    auto complement_indices = detail::get_left_join_indices_complement(join_indices.second,
+                                                                       left_conditional.num_rows(),
+                                                                       right_conditional.num_rows(),
+                                                                       stream,
+                                                                       mr);
     join_indices = detail::concatenate_vector_pairs(join_indices, complement_indices, stream);
   }
   return join_indices;
 }
 
+/**
+ * @brief Builds the hash table of a mixed join from the `build` table
+ */
+void build_mixed_join_hash_table(
+  table_view const& build,
+  std::shared_ptr<experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  mixed_multimap_type& hash_table,
+  cudf::nullate::DYNAMIC has_nulls,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream)
+{
+  // TODO: To add support for nested columns we will need to flatten in many
+  // places. However, this probably isn't worth adding any time soon since we
+  // won't be able to support AST conditions for those types anyway.
+  auto const row_bitmask =
+    cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
+  build_join_hash_table(build,
+                        preprocessed_build,
+                        hash_table,
+                        has_nulls,
+                        compare_nulls,
+                        static_cast<bitmask_type const*>(row_bitmask.data()),
+                        stream);
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls,
+  join_kind join_type,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> const& output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(left_conditional.num_rows() == left_equality.num_rows(),
+               "The left conditional and equality tables must have the same number of rows.");
+  CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
+               "The right conditional and equality tables must have the same number of rows.");
+
+  CUDF_EXPECTS((join_type != join_kind::LEFT_SEMI_JOIN) && (join_type != join_kind::LEFT_ANTI_JOIN),
+               "Left semi and anti joins should use mixed_join_semi.");
+
+  auto const right_num_rows{right_conditional.num_rows()};
+  auto const left_num_rows{left_conditional.num_rows()};
+  auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
+
+  // We can immediately filter out cases where the right table is empty. In
+  // some cases, we return all the rows of the left table with a corresponding
+  // null index for the right table; in others, we return an empty output.
+  if (right_num_rows == 0) {
+    switch (join_type) {
+      // Left and full joins all return all the row indices from
+      // left with a corresponding NULL from the right.
+      case join_kind::LEFT_JOIN:
+      case join_kind::FULL_JOIN:
+        return get_trivial_left_join_indices(
+          left_conditional, stream, rmm::mr::get_current_device_resource());
+      // Inner joins return empty output because no matches can exist.
+      case join_kind::INNER_JOIN:
+        return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+      default: CUDF_FAIL("Invalid join kind."); break;
+    }
+  } else if (left_num_rows == 0) {
+    switch (join_type) {
+      // Left and inner joins all return empty sets.
+      case join_kind::LEFT_JOIN:
+      case join_kind::INNER_JOIN:
+        return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+      // Full joins need to return the trivial complement.
+      case join_kind::FULL_JOIN: {
+        auto ret_flipped = get_trivial_left_join_indices(
+          right_conditional, stream, rmm::mr::get_current_device_resource());
+        return std::pair(std::move(ret_flipped.second), std::move(ret_flipped.first));
+      }
+      default: CUDF_FAIL("Invalid join kind."); break;
+    }
+  }
+
+  // If evaluating the expression may produce null outputs we create a nullable
+  // output column and follow the null-supporting expression evaluation code
+  // path.
+  auto const has_nulls = cudf::nullate::DYNAMIC{
+    cudf::has_nulls(left_equality) || cudf::has_nulls(right_equality) ||
+    binary_predicate.may_evaluate_null(left_conditional, right_conditional, stream)};
+
+  auto const parser = ast::detail::expression_parser{
+    binary_predicate, left_conditional, right_conditional, has_nulls, stream, mr};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The expression must produce a boolean output.");
+
+  // TODO: The non-conditional join impls start with a dictionary matching,
+  // figure out what that is and what it's needed for (and if conditional joins
+  // need to do the same).
+  auto& probe = swap_tables ? right_equality : left_equality;
+  auto& build = swap_tables ? left_equality : right_equality;
+
+  // Don't use multimap_type because we want a CG size of 1.
+  mixed_multimap_type hash_table{compute_hash_table_size(build.num_rows()),
+                                 cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                                 cuco::empty_value{cudf::detail::JoinNoneValue},
+                                 stream.value(),
+                                 cudf::detail::cuco_allocator{stream}};
+  auto const preprocessed_build =
+    experimental::row::equality::preprocessed_table::create(build, stream);
+  build_mixed_join_hash_table(
+    build, preprocessed_build, hash_table, has_nulls, compare_nulls, stream);
+
+  return probe_mixed_join(probe,
+                          build,
+                          preprocessed_build,
+                          left_conditional,
+                          right_conditional,
+                          hash_table,
+                          parser,
+                          has_nulls,
+                          compare_nulls,
+                          join_type,
+                          swap_tables,
+                          output_size_data,
+                          stream,
+                          mr);
+}
+
 std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
 compute_mixed_join_output_size(table_view const& left_equality,
                                table_view const& right_equality,
@@ -388,10 +524,8 @@ compute_mixed_join_output_size(table_view const& left_equality,
   // TODO: The non-conditional join impls start with a dictionary matching,
   // figure out what that is and what it's needed for (and if conditional joins
   // need to do the same).
-  auto& probe     = swap_tables ? right_equality : left_equality;
-  auto& build     = swap_tables ? left_equality : right_equality;
-  auto probe_view = table_device_view::create(probe, stream);
-  auto build_view = table_device_view::create(build, stream);
+  auto& probe = swap_tables ? right_equality : left_equality;
+  auto& build = swap_tables ? left_equality : right_equality;
 
   // Don't use multimap_type because we want a CG size of 1.
   mixed_multimap_type hash_table{compute_hash_table_size(build.num_rows()),
@@ -399,78 +533,179 @@ compute_mixed_join_output_size(table_view const& left_equality,
                                  cuco::empty_value{cudf::detail::JoinNoneValue},
                                  stream.value(),
                                  cudf::detail::cuco_allocator{stream}};
-
-  // TODO: To add support for nested columns we will need to flatten in many
-  // places. However, this probably isn't worth adding any time soon since we
-  // won't be able to support AST conditions for those types anyway.
-  auto const row_bitmask =
-    cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
   auto const preprocessed_build =
     experimental::row::equality::preprocessed_table::create(build, stream);
-  build_join_hash_table(build,
-                        preprocessed_build,
-                        hash_table,
-                        has_nulls,
-                        compare_nulls,
-                        static_cast<bitmask_type const*>(row_bitmask.data()),
-                        stream);
-  auto hash_table_view = hash_table.get_device_view();
+  build_mixed_join_hash_table(
+    build, preprocessed_build, hash_table, has_nulls, compare_nulls, stream);
+
+  auto const size = probe_mixed_join_output_size(probe,
+                                                 build,
+                                                 preprocessed_build,
+                                                 left_conditional,
+                                                 right_conditional,
+                                                 hash_table,
+                                                 parser,
+                                                 has_nulls,
+                                                 compare_nulls,
+                                                 join_type,
+                                                 swap_tables,
+                                                 matches_per_row_span,
+                                                 stream);
+  return {size, std::move(matches_per_row)};
+}
 
-  auto left_conditional_view  = table_device_view::create(left_conditional, stream);
-  auto right_conditional_view = table_device_view::create(right_conditional, stream);
+/**
+ * @brief Implementation of `cudf::mixed_join`
+ *
+ * The expression is parsed, and the tables are probed, for inputs that may have nulls, so that
+ * the same parsed expression serves probe tables with and without nulls.
+ */
+class mixed_join_impl {
+ public:
+  mixed_join_impl(table_view const& right_equality,
+                  table_view const& right_conditional,
+                  table_view const& left_conditional,
+                  ast::expression const& binary_predicate,
+                  null_equality compare_nulls,
+                  rmm::cuda_stream_view stream)
+    : _compare_nulls{compare_nulls},
+      _right_equality{right_equality},
+      _right_conditional{right_conditional},
+      _left_conditional_schema{cudf::empty_like(left_conditional)},
+      _preprocessed_build{
+        experimental::row::equality::preprocessed_table::create(_right_equality, stream)},
+      _hash_table{compute_hash_table_size(right_equality.num_rows()),
+                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                  cuco::empty_value{cudf::detail::JoinNoneValue},
+                  stream.value(),
+                  cudf::detail::cuco_allocator{stream}}
+  {
+    CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
+                 "The right conditional and equality tables must have the same number of rows.");
+
+    // Only the column types of the left conditional table are needed to parse the expression
+    _parser = std::make_unique<ast::detail::expression_parser>(
+      binary_predicate,
+      _left_conditional_schema->view(),
+      _right_conditional,
+      true,
+      stream,
+      rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(_parser->output_type().id() == type_id::BOOL8,
+                 "The expression must produce a boolean output.");
+
+    if (_right_equality.num_rows() == 0) { return; }
+    build_mixed_join_hash_table(_right_equality,
+                                _preprocessed_build,
+                                _hash_table,
+                                cudf::nullate::DYNAMIC{true},
+                                _compare_nulls,
+                                stream);
+  }
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  detail::grid_1d const config(outer_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
-  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  join(table_view const& left_equality,
+       table_view const& left_conditional,
+       join_kind join_type,
+       std::optional<std::pair<std::size_t, device_span<size_type const>>> const& output_size_data,
+       rmm::cuda_stream_view stream,
+       rmm::device_async_resource_ref mr) const
+  {
+    check_probe(left_equality, left_conditional);
+
+    // The trivial cases are those of `detail::mixed_join`
+    if (_right_equality.num_rows() == 0) {
+      if (join_type == join_kind::INNER_JOIN) {
+        return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+      }
+      return get_trivial_left_join_indices(
+        left_conditional, stream, rmm::mr::get_current_device_resource());
+    } else if (left_equality.num_rows() == 0) {
+      if (join_type == join_kind::FULL_JOIN) {
+        auto ret_flipped = get_trivial_left_join_indices(
+          _right_conditional, stream, rmm::mr::get_current_device_resource());
+        return std::pair(std::move(ret_flipped.second), std::move(ret_flipped.first));
+      }
+      return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                       std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+    }
 
-  // Allocate storage for the counter used to get the size of the join output
-  rmm::device_scalar<std::size_t> size(0, stream, mr);
+    return probe_mixed_join(left_equality,
+                            _right_equality,
+                            _preprocessed_build,
+                            left_conditional,
+                            _right_conditional,
+                            _hash_table,
+                            *_parser,
+                            cudf::nullate::DYNAMIC{true},
+                            _compare_nulls,
+                            join_type,
+                            false,
+                            output_size_data,
+                            stream,
+                            mr);
+  }
 
-  auto const preprocessed_probe =
-    experimental::row::equality::preprocessed_table::create(probe, stream);
-  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
-  auto const hash_probe = row_hash.device_hasher(has_nulls);
-  auto const row_comparator =
-    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
-  auto const equality_probe = row_comparator.equal_to<false>(has_nulls, compare_nulls);
+  std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>> join_size(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    join_kind join_type,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const
+  {
+    check_probe(left_equality, left_conditional);
+
+    auto const left_num_rows = left_equality.num_rows();
+    auto matches_per_row     = std::make_unique<rmm::device_uvector<size_type>>(
+      static_cast<std::size_t>(left_num_rows), stream, mr);
+    if (_right_equality.num_rows() == 0 or left_num_rows == 0) {
+      auto const num_matches = join_type == join_kind::LEFT_JOIN ? 1 : 0;
+      thrust::fill(
+        rmm::exec_policy(stream), matches_per_row->begin(), matches_per_row->end(), num_matches);
+      return {static_cast<std::size_t>(num_matches) * left_num_rows, std::move(matches_per_row)};
+    }
 
-  // Determine number of output rows without actually building the output to simply
-  // find what the size of the output will be.
-  if (has_nulls) {
-    compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_conditional_view,
-        *right_conditional_view,
-        *probe_view,
-        *build_view,
-        hash_probe,
-        equality_probe,
-        join_type,
-        hash_table_view,
-        parser.device_expression_data,
-        swap_tables,
-        size.data(),
-        matches_per_row_span);
-  } else {
-    compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_conditional_view,
-        *right_conditional_view,
-        *probe_view,
-        *build_view,
-        hash_probe,
-        equality_probe,
-        join_type,
-        hash_table_view,
-        parser.device_expression_data,
-        swap_tables,
-        size.data(),
-        matches_per_row_span);
+    auto const size = probe_mixed_join_output_size(left_equality,
+                                                   _right_equality,
+                                                   _preprocessed_build,
+                                                   left_conditional,
+                                                   _right_conditional,
+                                                   _hash_table,
+                                                   *_parser,
+                                                   cudf::nullate::DYNAMIC{true},
+                                                   _compare_nulls,
+                                                   join_type,
+                                                   false,
+                                                   *matches_per_row,
+                                                   stream);
+    return {size, std::move(matches_per_row)};
   }
 
-  return {size.value(stream), std::move(matches_per_row)};
-}
+ private:
+  void check_probe(table_view const& left_equality, table_view const& left_conditional) const
+  {
+    CUDF_EXPECTS(left_conditional.num_rows() == left_equality.num_rows(),
+                 "The left conditional and equality tables must have the same number of rows.");
+    CUDF_EXPECTS(left_equality.num_columns() == _right_equality.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(cudf::have_same_types(left_equality, _right_equality),
+                 "Mismatch in joining column data types",
+                 cudf::data_type_error);
+    CUDF_EXPECTS(cudf::have_same_types(left_conditional, _left_conditional_schema->view()),
+                 "Mismatch in column data types of the left conditional table",
+                 cudf::data_type_error);
+  }
+
+  null_equality _compare_nulls;
+  table_view _right_equality;
+  table_view _right_conditional;
+  std::unique_ptr<table> _left_conditional_schema;  // empty table of the left conditional types
+  std::shared_ptr<experimental::row::equality::preprocessed_table> _preprocessed_build;
+  mixed_multimap_type _hash_table;
+  std::unique_ptr<ast::detail::expression_parser> _parser;
+};
 
 }  // namespace detail
 
@@ -591,4 +826,81 @@ mixed_full_join(
                             mr);
 }
 
+mixed_join::~mixed_join() = default;
+
+mixed_join::mixed_join(table_view const& right_equality,
+                       table_view const& right_conditional,
+                       table_view const& left_conditional,
+                       ast::expression const& binary_predicate,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl_type const>(
+      right_equality, right_conditional, left_conditional, binary_predicate, compare_nulls, stream)}
+{
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::inner_join(
+  table_view const& left_equality,
+  table_view const& left_conditional,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> const output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->join(
+    left_equality, left_conditional, detail::join_kind::INNER_JOIN, output_size_data, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::left_join(
+  table_view const& left_equality,
+  table_view const& left_conditional,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> const output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->join(
+    left_equality, left_conditional, detail::join_kind::LEFT_JOIN, output_size_data, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::full_join(
+  table_view const& left_equality,
+  table_view const& left_conditional,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> const output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->join(
+    left_equality, left_conditional, detail::join_kind::FULL_JOIN, output_size_data, stream, mr);
+}
+
+std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::inner_join_size(table_view const& left_equality,
+                            table_view const& left_conditional,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->join_size(
+    left_equality, left_conditional, detail::join_kind::INNER_JOIN, stream, mr);
+}
+
+std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::left_join_size(table_view const& left_equality,
+                           table_view const& left_conditional,
+                           rmm::cuda_stream_view stream,
+                           rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->join_size(
+    left_equality, left_conditional, detail::join_kind::LEFT_JOIN, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the number of rows of the right table that match a row of the left table
+ *
+ * The matches of left row `i` are the right rows in `[lower[i], upper[i])`, unless the left row
+ * has a null key that does not match anything.
+ */
+struct match_count_fn {
+  size_type const* lower;
+  size_type const* upper;
+  bitmask_type const* row_bitmask;  // valid left rows, or nullptr if all rows may match
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row)) { return 0; }
+    return upper[row] - lower[row];
+  }
+};
+
+/**
+ * @brief The ranges of rows of a sorted right table that match the rows of a sorted left table
+ */
+struct matching_rows {
+  std::unique_ptr<column> lower;   // first matching right row of each left row
+  std::unique_ptr<column> upper;   // one past the last matching right row of each left row
+  rmm::device_buffer row_bitmask;  // valid left rows if nulls are unequal, otherwise empty
+
+  [[nodiscard]] match_count_fn match_count() const
+  {
+    return match_count_fn{lower->view().data<size_type>(),
+                          upper->view().data<size_type>(),
+                          row_bitmask.is_empty()
+                            ? nullptr
+                            : static_cast<bitmask_type const*>(row_bitmask.data())};
+  }
+};
+
+/**
+ * @brief Finds the rows of `right_keys` that match each row of `left_keys` by binary searches of
+ * the sorted `right_keys`
+ */
+matching_rows find_matching_rows(table_view const& left_keys,
+                                 table_view const& right_keys,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 null_equality compare_nulls,
+                                 bool check_sorted,
+                                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(cudf::have_same_types(left_keys, right_keys),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+  if (check_sorted) {
+    CUDF_EXPECTS(cudf::is_sorted(left_keys, column_order, null_precedence, stream) and
+                   cudf::is_sorted(right_keys, column_order, null_precedence, stream),
+                 "Sort-merge join inputs are not sorted on their keys",
+                 std::invalid_argument);
+  }
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto lower = cudf::detail::lower_bound(
+    right_keys, left_keys, column_order, null_precedence, stream, temp_mr);
+  auto upper = cudf::detail::upper_bound(
+    right_keys, left_keys, column_order, null_precedence, stream, temp_mr);
+
+  // Null keys compare equal to each other in the sorted order, so they are excluded separately
+  auto row_bitmask = rmm::device_buffer{0, stream, temp_mr};
+  if (compare_nulls == null_equality::UNEQUAL and cudf::has_nulls(left_keys)) {
+    row_bitmask = cudf::detail::bitmask_and(left_keys, stream, temp_mr).first;
+  }
+  return matching_rows{std::move(lower), std::move(upper), std::move(row_bitmask)};
+}
+
+/**
+ * @brief Expands the matching ranges into pairs of left and right row indices
+ *
+ * The output rows of each left row are found by a binary search of the output offsets of the left
+ * rows, so the work of the expansion is balanced however uneven the numbers of matches are.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+expand_matching_rows(matching_rows const& matches,
+                     size_type left_num_rows,
+                     join_kind join,
+                     rmm::cuda_stream_view stream,
+                     rmm::device_async_resource_ref mr)
+{
+  auto const match_count = matches.match_count();
+  auto const is_left     = join == join_kind::LEFT_JOIN;
+
+  // A left join outputs one row with no match for each left row that has no match
+  auto const output_count = [match_count, is_left] __device__(size_type row) -> std::size_t {
+    auto const count = match_count(row);
+    return is_left and count == 0 ? 1 : count;
+  };
+  rmm::device_uvector<std::size_t> output_ends(left_num_rows, stream);
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::counting_iterator<size_type>(0),
+                                   thrust::counting_iterator<size_type>(left_num_rows),
+                                   output_ends.begin(),
+                                   output_count,
+                                   thrust::plus<std::size_t>{});
+  auto const output_size = left_num_rows == 0 ? std::size_t{0} : output_ends.back_element(stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  if (output_size == 0) { return std::pair(std::move(left_indices), std::move(right_indices)); }
+
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      output_ends.begin(),
+                      output_ends.end(),
+                      thrust::counting_iterator<std::size_t>(0),
+                      thrust::counting_iterator<std::size_t>(output_size),
+                      left_indices->begin());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::counting_iterator<std::size_t>(0),
+                     output_size,
+                     [match_count,
+                      output_count,
+                      output_ends = output_ends.data(),
+                      d_left      = left_indices->data(),
+                      d_right     = right_indices->data()] __device__(std::size_t idx) {
+                       auto const row  = d_left[idx];
+                       auto const rank = idx - (output_ends[row] - output_count(row));
+                       d_right[idx]    = match_count(row) == 0
+                                           ? JoinNoneValue
+                                           : match_count.lower[row] + static_cast<size_type>(rank);
+                     });
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_join(table_view const& left_keys,
+                table_view const& right_keys,
+                join_kind join,
+                std::vector<order> const& column_order,
+                std::vector<null_order> const& null_precedence,
+                null_equality compare_nulls,
+                bool check_sorted,
+                rmm::cuda_stream_view stream,
+                rmm::device_async_resource_ref mr)
+{
+  auto const matches = find_matching_rows(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, check_sorted, stream);
+  return expand_matching_rows(matches, left_keys.num_rows(), join, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> sort_merge_left_semi_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  bool check_sorted,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const matches = find_matching_rows(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, check_sorted, stream);
+
+  auto const left_num_rows = left_keys.num_rows();
+  auto indices = std::make_unique<rmm::device_uvector<size_type>>(left_num_rows, stream, mr);
+  auto const indices_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(left_num_rows),
+                    indices->begin(),
+                    [match_count = matches.match_count()] __device__(size_type row) {
+                      return match_count(row) > 0;
+                    });
+  indices->resize(thrust::distance(indices->begin(), indices_end), stream);
+  return indices;
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      bool check_sorted,
+                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join(left_keys,
+                                 right_keys,
+                                 detail::join_kind::INNER_JOIN,
+                                 column_order,
+                                 null_precedence,
+                                 compare_nulls,
+                                 check_sorted,
+                                 cudf::get_default_stream(),
+                                 mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     bool check_sorted,
+                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join(left_keys,
+                                 right_keys,
+                                 detail::join_kind::LEFT_JOIN,
+                                 column_order,
+                                 null_precedence,
+                                 compare_nulls,
+                                 check_sorted,
+                                 cudf::get_default_stream(),
+                                 mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> sort_merge_left_semi_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  bool check_sorted,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_left_semi_join(left_keys,
+                                           right_keys,
+                                           column_order,
+                                           null_precedence,
+                                           compare_nulls,
+                                           check_sorted,
+                                           cudf::get_default_stream(),
+                                           mr);
+}
+
+}  // namespace cudf
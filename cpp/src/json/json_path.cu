@@ -34,6 +34,7 @@
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
@@ -44,6 +45,9 @@
 #include <thrust/scan.h>
 #include <thrust/tuple.h>
 
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -900,160 +904,204 @@ __device__ thrust::pair<parse_result, json_output> get_json_object_single(
 }
 
 /**
- * @brief Kernel for running the JSONPath query.
+ * @brief Kernel for running a set of JSONPath queries.
  *
  * This kernel operates in a 2-pass way.  On the first pass, it computes
  * output sizes.  On the second pass it fills in the provided output buffers
  * (chars and validity)
  *
+ * Each thread applies every query to its row before moving to the next row
+ * so a document is read from memory once for all the queries.
+ *
  * @param col Device view of the incoming string
- * @param commands JSONPath command buffer
- * @param output_offsets Buffer used to store the string offsets for the results of the query
- * @param out_buf Buffer used to store the results of the query
- * @param out_validity Output validity buffer
- * @param out_valid_count Output count of # of valid bits
+ * @param commands JSONPath command buffer for each query or nullptr for an empty query
+ * @param num_paths Number of queries
+ * @param d_sizes Output sizes for the results of each query stored in query-major order
+ * @param output_offsets String offsets for the results of each query
+ * @param out_bufs Buffers used to store the results of each query
+ * @param out_validity Output validity buffer for each query
  * @param options Options controlling behavior
  */
 template <int block_size>
 __launch_bounds__(block_size) CUDF_KERNEL
   void get_json_object_kernel(column_device_view col,
-                              path_operator const* const commands,
+                              path_operator const* const* commands,
+                              size_type num_paths,
                               size_type* d_sizes,
-                              cudf::detail::input_offsetalator output_offsets,
-                              thrust::optional<char*> out_buf,
-                              thrust::optional<bitmask_type*> out_validity,
-                              thrust::optional<size_type*> out_valid_count,
+                              cudf::detail::input_offsetalator const* output_offsets,
+                              thrust::optional<char* const*> out_bufs,
+                              thrust::optional<bitmask_type* const*> out_validity,
                               get_json_object_options options)
 {
   auto tid          = cudf::detail::grid_1d::global_thread_id();
   auto const stride = cudf::thread_index_type{blockDim.x} * cudf::thread_index_type{gridDim.x};
 
-  size_type warp_valid_count{0};
-
   auto active_threads = __ballot_sync(0xffff'ffffu, tid < col.size());
   while (tid < col.size()) {
-    bool is_valid         = false;
     string_view const str = col.element<string_view>(tid);
-    size_type output_size = 0;
-    if (str.size_bytes() > 0) {
-      char* dst = out_buf.has_value() ? out_buf.value() + output_offsets[tid] : nullptr;
-      size_t const dst_size =
-        out_buf.has_value() ? output_offsets[tid + 1] - output_offsets[tid] : 0;
-
-      parse_result result;
-      json_output out;
-      thrust::tie(result, out) =
-        get_json_object_single(str.data(), str.size_bytes(), commands, dst, dst_size, options);
-      output_size = out.output_len.value_or(0);
-      if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
-    }
+    for (size_type path_idx = 0; path_idx < num_paths; ++path_idx) {
+      bool is_valid         = false;
+      size_type output_size = 0;
+      if (str.size_bytes() > 0 && commands[path_idx] != nullptr) {
+        char* dst       = nullptr;
+        size_t dst_size = 0;
+        if (out_bufs.has_value()) {
+          auto const d_offsets = output_offsets[path_idx];
+          dst                  = out_bufs.value()[path_idx] + d_offsets[tid];
+          dst_size             = d_offsets[tid + 1] - d_offsets[tid];
+        }
 
-    // filled in only during the precompute step. during the compute step, the offsets
-    // are fed back in so we do -not- want to write them out
-    if (!out_buf.has_value()) { d_sizes[tid] = output_size; }
-
-    // validity filled in only during the output step
-    if (out_validity.has_value()) {
-      uint32_t mask = __ballot_sync(active_threads, is_valid);
-      // 0th lane of the warp writes the validity
-      if (!(tid % cudf::detail::warp_size)) {
-        out_validity.value()[cudf::word_index(tid)] = mask;
-        warp_valid_count += __popc(mask);
+        parse_result result;
+        json_output out;
+        thrust::tie(result, out) = get_json_object_single(
+          str.data(), str.size_bytes(), commands[path_idx], dst, dst_size, options);
+        output_size = out.output_len.value_or(0);
+        if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+      }
+
+      // filled in only during the precompute step. during the compute step, the offsets
+      // are fed back in so we do -not- want to write them out
+      if (!out_bufs.has_value()) {
+        d_sizes[static_cast<int64_t>(path_idx) * col.size() + tid] = output_size;
+      }
+
+      // validity filled in only during the output step
+      if (out_validity.has_value()) {
+        uint32_t mask = __ballot_sync(active_threads, is_valid);
+        // 0th lane of the warp writes the validity
+        if (!(tid % cudf::detail::warp_size)) {
+          out_validity.value()[path_idx][cudf::word_index(tid)] = mask;
+        }
       }
     }
 
     tid += stride;
     active_threads = __ballot_sync(active_threads, tid < col.size());
   }
-
-  // sum the valid counts across the whole block
-  if (out_valid_count) {
-    size_type block_valid_count =
-      cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
-    if (threadIdx.x == 0) { atomicAdd(out_valid_count.value(), block_valid_count); }
-  }
 }
 
-std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& col,
-                                              cudf::string_scalar const& json_path,
-                                              get_json_object_options options,
-                                              rmm::cuda_stream_view stream,
-                                              rmm::device_async_resource_ref mr)
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
 {
-  // preprocess the json_path into a command buffer
-  auto preprocess = build_command_buffer(json_path, stream);
-  CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
-               "Encountered JSONPath string that is too complex");
-
-  if (col.is_empty()) return make_empty_column(type_id::STRING);
-
-  // if the query is empty, return a string column containing all nulls
-  if (!std::get<0>(preprocess).has_value()) {
-    return std::make_unique<column>(
-      data_type{type_id::STRING},
-      col.size(),
-      rmm::device_buffer{0, stream, mr},  // no data
-      cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr),
-      col.size());  // null count
+  auto const num_paths = static_cast<size_type>(json_paths.size());
+
+  // preprocess each json_path into a command buffer
+  std::vector<rmm::device_uvector<path_operator>> command_buffers;
+  std::vector<path_operator const*> h_commands;
+  for (auto const& json_path : json_paths) {
+    auto preprocess = build_command_buffer(json_path, stream);
+    CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    // an empty query produces a column of all nulls
+    if (!std::get<0>(preprocess).has_value()) {
+      h_commands.push_back(nullptr);
+      continue;
+    }
+    command_buffers.emplace_back(std::move(std::get<0>(preprocess).value()));
+    h_commands.push_back(command_buffers.back().data());
+  }
+
+  std::vector<std::unique_ptr<cudf::column>> results;
+  if (col.is_empty()) {
+    for (size_type idx = 0; idx < num_paths; ++idx) {
+      results.emplace_back(make_empty_column(type_id::STRING));
+    }
+    return results;
   }
+  if (num_paths == 0) { return results; }
+
+  auto const d_commands = cudf::detail::make_device_uvector_async(
+    h_commands, stream, rmm::mr::get_current_device_resource());
 
   // compute output sizes
-  auto sizes =
-    rmm::device_uvector<size_type>(col.size(), stream, rmm::mr::get_current_device_resource());
-  auto d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(col.offsets());
+  auto sizes = rmm::device_uvector<size_type>(static_cast<int64_t>(num_paths) * col.size(),
+                                              stream,
+                                              rmm::mr::get_current_device_resource());
 
   constexpr int block_size = 512;
   cudf::detail::grid_1d const grid{col.size(), block_size};
   auto cdv = column_device_view::create(col.parent(), stream);
-  // preprocess sizes (returned in the offsets buffer)
+  // preprocess sizes
   get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      thrust::nullopt,
-      thrust::nullopt,
-      thrust::nullopt,
-      options);
-
-  // convert sizes to offsets
-  auto [offsets, output_size] =
-    cudf::strings::detail::make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
-  d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(offsets->view());
-
-  // allocate output string column
-  rmm::device_uvector<char> chars(output_size, stream, mr);
-
-  // potential optimization : if we know that all outputs are valid, we could skip creating
-  // the validity mask altogether
-  rmm::device_buffer validity =
-    cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr);
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(*cdv,
+                                                                         d_commands.data(),
+                                                                         num_paths,
+                                                                         sizes.data(),
+                                                                         nullptr,
+                                                                         thrust::nullopt,
+                                                                         thrust::nullopt,
+                                                                         options);
+
+  // convert sizes to offsets and allocate the output buffers for each query
+  std::vector<std::unique_ptr<column>> offsets;
+  std::vector<rmm::device_uvector<char>> chars;
+  std::vector<rmm::device_buffer> validity;
+  std::vector<cudf::detail::input_offsetalator> h_offsets;
+  std::vector<char*> h_chars;
+  std::vector<bitmask_type*> h_validity;
+  for (size_type idx = 0; idx < num_paths; ++idx) {
+    auto const path_sizes = sizes.begin() + static_cast<int64_t>(idx) * col.size();
+    auto [path_offsets, output_size] = cudf::strings::detail::make_offsets_child_column(
+      path_sizes, path_sizes + col.size(), stream, mr);
+    h_offsets.push_back(
+      cudf::detail::offsetalator_factory::make_input_iterator(path_offsets->view()));
+    offsets.emplace_back(std::move(path_offsets));
+    chars.emplace_back(output_size, stream, mr);
+    h_chars.push_back(chars.back().data());
+    // potential optimization : if we know that all outputs are valid, we could skip creating
+    // the validity mask altogether
+    validity.emplace_back(
+      cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+    h_validity.push_back(static_cast<bitmask_type*>(validity.back().data()));
+  }
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    h_offsets, stream, rmm::mr::get_current_device_resource());
+  auto const d_chars = cudf::detail::make_device_uvector_async(
+    h_chars, stream, rmm::mr::get_current_device_resource());
+  auto const d_validity = cudf::detail::make_device_uvector_async(
+    h_validity, stream, rmm::mr::get_current_device_resource());
 
   // compute results
-  rmm::device_scalar<size_type> d_valid_count{0, stream};
-
   get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      chars.data(),
-      static_cast<bitmask_type*>(validity.data()),
-      d_valid_count.data(),
-      options);
-
-  auto result = make_strings_column(col.size(),
-                                    std::move(offsets),
-                                    chars.release(),
-                                    col.size() - d_valid_count.value(stream),
-                                    std::move(validity));
-  // unmatched array query may result in unsanitized '[' value in the result
-  if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
-    result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(*cdv,
+                                                                         d_commands.data(),
+                                                                         num_paths,
+                                                                         sizes.data(),
+                                                                         d_offsets.data(),
+                                                                         d_chars.data(),
+                                                                         d_validity.data(),
+                                                                         options);
+
+  for (size_type idx = 0; idx < num_paths; ++idx) {
+    auto const null_count = cudf::detail::null_count(h_validity[idx], 0, col.size(), stream);
+
+    auto result = make_strings_column(col.size(),
+                                      std::move(offsets[idx]),
+                                      chars[idx].release(),
+                                      null_count,
+                                      std::move(validity[idx]));
+    // unmatched array query may result in unsanitized '[' value in the result
+    if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
+      result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+    }
+    results.emplace_back(std::move(result));
   }
-  return result;
+  return results;
+}
+
+std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& col,
+                                              cudf::string_scalar const& json_path,
+                                              get_json_object_options options,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  auto results = get_json_objects(
+    col, host_span<cudf::string_scalar const>(&json_path, 1), options, stream, mr);
+  return std::move(results.front());
 }
 
 }  // namespace
@@ -1069,4 +1117,20 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, stream, mr);
 }
 
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<cudf::string_scalar> paths;
+  paths.reserve(json_paths.size());
+  for (auto const& json_path : json_paths) {
+    paths.emplace_back(json_path, true, stream);
+  }
+  return detail::get_json_objects(col, paths, options, stream, mr);
+}
+
 }  // namespace cudf
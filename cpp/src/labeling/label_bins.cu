@@ -19,6 +19,9 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
@@ -42,7 +45,10 @@
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <stdexcept>
 
 namespace cudf {
 namespace detail {
@@ -156,6 +162,137 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return output;
 }
 
+/// Largest number of bins counted in shared memory by each block of `bin_counts_kernel`
+constexpr size_type max_shared_memory_bins = 8192;
+
+/**
+ * @brief Counts the valid elements of `input` in each bin returned by `bin_fn`
+ *
+ * Unless there are too many bins, each block counts its elements in shared memory before adding
+ * its counts to `counts`, so most atomic additions stay within the block.
+ *
+ * @param bin_fn Returns the bin of an element, or `NULL_VALUE` if it belongs to no bin
+ * @param shared_counts Whether the blocks count their elements in shared memory
+ * @param counts Number of elements in each bin, zeroed before the launch
+ */
+template <typename T, typename BinFn>
+CUDF_KERNEL void bin_counts_kernel(column_device_view input,
+                                   BinFn bin_fn,
+                                   size_type num_bins,
+                                   bool shared_counts,
+                                   int64_t* counts)
+{
+  extern __shared__ size_type block_counts[];
+  if (shared_counts) {
+    for (auto idx = static_cast<size_type>(threadIdx.x); idx < num_bins; idx += blockDim.x) {
+      block_counts[idx] = 0;
+    }
+    __syncthreads();
+  }
+
+  auto const stride = grid_1d::grid_stride();
+  for (auto idx = grid_1d::global_thread_id(); idx < input.size(); idx += stride) {
+    if (input.is_null(idx)) { continue; }
+    auto const bin = bin_fn(input.element<T>(idx));
+    if (bin == NULL_VALUE) { continue; }
+    if (shared_counts) {
+      atomicAdd(block_counts + bin, 1);
+    } else {
+      cudf::detail::atomic_add(counts + bin, int64_t{1});
+    }
+  }
+  if (not shared_counts) { return; }
+  __syncthreads();
+
+  for (auto idx = static_cast<size_type>(threadIdx.x); idx < num_bins; idx += blockDim.x) {
+    if (block_counts[idx] != 0) {
+      cudf::detail::atomic_add(counts + idx, static_cast<int64_t>(block_counts[idx]));
+    }
+  }
+}
+
+/**
+ * @brief Counts the valid elements of `input` in each of `num_bins` bins
+ */
+template <typename T, typename BinFn>
+std::unique_ptr<column> count_bins(column_view const& input,
+                                   BinFn bin_fn,
+                                   size_type num_bins,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), num_bins, mask_state::UNALLOCATED, stream, mr);
+  auto const counts = output->mutable_view().data<int64_t>();
+  CUDF_CUDA_TRY(cudaMemsetAsync(counts, 0, num_bins * sizeof(int64_t), stream.value()));
+  if (input.is_empty() || num_bins == 0) { return output; }
+
+  auto const input_device_view = column_device_view::create(input, stream);
+
+  auto constexpr block_size          = 256;
+  auto constexpr elements_per_thread = 16;
+  grid_1d const grid{input.size(), block_size, elements_per_thread};
+  auto const shared_counts = num_bins <= max_shared_memory_bins;
+  auto const shared_bytes  = shared_counts ? num_bins * sizeof(size_type) : std::size_t{0};
+  bin_counts_kernel<T>
+    <<<grid.num_blocks, grid.num_threads_per_block, shared_bytes, stream.value()>>>(
+      *input_device_view, bin_fn, num_bins, shared_counts, counts);
+  CUDF_CHECK_CUDA(stream.value());
+  return output;
+}
+
+/**
+ * @brief Functor returning the bin of a value among the bins defined by their edges
+ */
+template <typename T, typename Finder>
+struct edges_bin_fn {
+  Finder finder;
+
+  __device__ size_type operator()(T value) const { return finder(thrust::make_pair(value, true)); }
+};
+
+/**
+ * @brief Functor returning the bin of a value among bins of equal width
+ *
+ * NaN values and values outside of `[lower, upper]` belong to no bin.
+ */
+template <typename T>
+struct uniform_bin_fn {
+  double lower;
+  double upper;
+  double bins_per_unit;  ///< number of bins divided by `upper - lower`
+  size_type num_bins;
+
+  __device__ size_type operator()(T value) const
+  {
+    auto const v = static_cast<double>(value);
+    if (not(v >= lower && v <= upper)) { return NULL_VALUE; }
+    // the last bin includes `upper`, and rounding may place values just below it past the end
+    auto const bin = static_cast<size_type>((v - lower) * bins_per_unit);
+    return bin < num_bins ? bin : num_bins - 1;
+  }
+};
+
+// Count the elements of the input in the bins defined by left_edges and right_edges.
+template <typename T, typename LeftComparator, typename RightComparator>
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   column_view const& right_edges,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto left_edges_device_view  = column_device_view::create(left_edges, stream);
+  auto right_edges_device_view = column_device_view::create(right_edges, stream);
+
+  using RandomAccessIterator = decltype(left_edges_device_view->begin<T>());
+  using Finder               = bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>;
+
+  auto const finder = Finder(left_edges_device_view->begin<T>(),
+                             left_edges_device_view->end<T>(),
+                             right_edges_device_view->begin<T>());
+  return count_bins<T>(input, edges_bin_fn<T, Finder>{finder}, left_edges.size(), stream, mr);
+}
+
 template <typename T>
 constexpr auto is_supported_bin_type()
 {
@@ -197,6 +334,62 @@ struct bin_type_dispatcher {
   }
 };
 
+struct bin_counts_dispatcher {
+  template <typename T, typename... Args>
+  std::enable_if_t<not detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("Type not supported for cudf::bin_counts", cudf::data_type_error);
+  }
+
+  template <typename T>
+  std::enable_if_t<detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    column_view const& left_edges,
+    inclusive left_inclusive,
+    column_view const& right_edges,
+    inclusive right_inclusive,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr)
+  {
+    if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::YES))
+      return bin_counts<T, thrust::less_equal<T>, thrust::less_equal<T>>(
+        input, left_edges, right_edges, stream, mr);
+    if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::NO))
+      return bin_counts<T, thrust::less_equal<T>, thrust::less<T>>(
+        input, left_edges, right_edges, stream, mr);
+    if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::YES))
+      return bin_counts<T, thrust::less<T>, thrust::less_equal<T>>(
+        input, left_edges, right_edges, stream, mr);
+    if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::NO))
+      return bin_counts<T, thrust::less<T>, thrust::less<T>>(
+        input, left_edges, right_edges, stream, mr);
+
+    CUDF_FAIL("Undefined inclusive setting.");
+  }
+};
+
+struct uniform_bin_counts_dispatcher {
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_numeric<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Uniform bins require a numeric input column", cudf::data_type_error);
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_numeric<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    double lower,
+    double upper,
+    size_type num_bins,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr)
+  {
+    auto const bin_fn = uniform_bin_fn<T>{lower, upper, num_bins / (upper - lower), num_bins};
+    return count_bins<T>(input, bin_fn, num_bins, stream, mr);
+  }
+};
+
 }  // anonymous namespace
 
 /// Bin the input by the edges in left_edges and right_edges.
@@ -232,6 +425,58 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                                 mr);
 }
 
+/// Count the elements of the input in the bins defined by left_edges and right_edges.
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   inclusive left_inclusive,
+                                   column_view const& right_edges,
+                                   inclusive right_inclusive,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    cudf::have_same_types(input, left_edges) && cudf::have_same_types(input, right_edges),
+    "The input and edge columns must have the same types.",
+    cudf::data_type_error);
+  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
+               "The left and right edge columns must be of the same length.");
+  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
+               "The left and right edge columns cannot contain nulls.");
+
+  return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                detail::bin_counts_dispatcher{},
+                                                input,
+                                                left_edges,
+                                                left_inclusive,
+                                                right_edges,
+                                                right_inclusive,
+                                                stream,
+                                                mr);
+}
+
+/// Count the elements of the input in bins of equal width spanning [lower, upper].
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   double lower,
+                                   double upper,
+                                   size_type num_bins,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(num_bins > 0, "The number of bins must be positive.", std::invalid_argument);
+  CUDF_EXPECTS(std::isfinite(lower) && std::isfinite(upper) && lower < upper,
+               "The bin range must be finite and non-empty.",
+               std::invalid_argument);
+
+  return type_dispatcher(input.type(),
+                         detail::uniform_bin_counts_dispatcher{},
+                         input,
+                         lower,
+                         upper,
+                         num_bins,
+                         stream,
+                         mr);
+}
+
 }  // namespace detail
 
 /// Bin the input by the edges in left_edges and right_edges.
@@ -247,4 +492,30 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return detail::label_bins(
     input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
 }
+
+/// Count the elements of the input in the bins defined by left_edges and right_edges.
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   inclusive left_inclusive,
+                                   column_view const& right_edges,
+                                   inclusive right_inclusive,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bin_counts(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
+}
+
+/// Count the elements of the input in bins of equal width spanning [lower, upper].
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   double lower,
+                                   double upper,
+                                   size_type num_bins,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bin_counts(input, lower, upper, num_bins, stream, mr);
+}
 }  // namespace cudf
@@ -14,10 +14,16 @@
  * limitations under the License.
  */
 
+#include "utilities.hpp"
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/lists/detail/contains.hpp>
 #include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/lists/list_device_view.cuh>
@@ -27,6 +33,8 @@
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -34,8 +42,11 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <cuda/std/type_traits>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/find.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
 #include <thrust/logical.h>
@@ -44,6 +55,8 @@
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
 
 namespace cudf::lists {
@@ -269,6 +282,194 @@ std::unique_ptr<column> to_contains(std::unique_ptr<column>&& key_positions,
 
   return result;
 }
+
+/**
+ * @brief A sentinel value marking the empty slots of the hash table of a `hashed_lists`.
+ */
+auto constexpr EMPTY_SLOT = size_type{-1};
+
+/**
+ * @brief Return the number of slots of the hash table of a `hashed_lists` holding the given
+ * number of elements.
+ */
+size_type hashed_lists_capacity(size_type num_elements)
+{
+  return std::max(size_type{1}, static_cast<size_type>(compute_hash_table_size(num_elements)));
+}
+
+/**
+ * @brief Hash an element of a `hashed_lists` together with the list holding it.
+ */
+template <typename Element>
+__device__ hash_value_type hash_list_element(size_type row, Element const& value)
+{
+  using cudf::hashing::detail::MurmurHash3_x86_32;
+  return cudf::hashing::detail::hash_combine(MurmurHash3_x86_32<size_type>{}(row),
+                                             MurmurHash3_x86_32<Element>{}(value));
+}
+
+/**
+ * @brief Compare elements of a `hashed_lists` the same way `index_of` does, with NaNs equal.
+ */
+template <typename Element>
+__device__ bool list_elements_equal(Element const& lhs, Element const& rhs)
+{
+  if constexpr (cuda::std::is_floating_point_v<Element>) {
+    if (isnan(lhs) && isnan(rhs)) { return true; }
+  }
+  return lhs == rhs;
+}
+
+/**
+ * @brief Functor inserting each non-null list element into the hash table of a `hashed_lists`.
+ *
+ * Equal elements of the same list share one slot, which records the first and last positions of
+ * the element in its list.
+ */
+template <typename Element>
+struct insert_list_element_fn {
+  column_device_view const child;
+  size_type const* labels;
+  size_type const* offsets;
+  size_type* elements;
+  size_type* rows;
+  size_type* first;
+  size_type* last;
+  size_type const capacity;
+
+  __device__ void operator()(size_type const idx) const
+  {
+    if (child.is_null(idx)) { return; }
+
+    auto const row      = labels[idx];
+    auto const value    = child.element<Element>(idx);
+    auto const position = idx - (offsets[row] - offsets[0]);
+    auto slot           = static_cast<size_type>(hash_list_element(row, value) % capacity);
+    while (true) {
+      auto element = atomicCAS(elements + slot, EMPTY_SLOT, idx);
+      if (element == EMPTY_SLOT) {
+        rows[slot] = row;
+        element    = idx;
+      }
+      if (labels[element] == row &&
+          list_elements_equal(child.element<Element>(element), value)) {
+        cudf::detail::atomic_min(first + slot, position);
+        cudf::detail::atomic_max(last + slot, position);
+        return;
+      }
+      slot = (slot + 1) % capacity;
+    }
+  }
+};
+
+/**
+ * @brief Functor looking up the position of each search key in the hash table of a
+ * `hashed_lists`.
+ */
+template <typename Element>
+struct lookup_list_element_fn {
+  column_device_view const lists;
+  column_device_view const child;
+  column_device_view const search_keys;
+  size_type const* elements;
+  size_type const* rows;
+  size_type const* positions;
+  size_type const capacity;
+
+  __device__ size_type operator()(size_type const row) const
+  {
+    // A null list or null key will result in a null output row.
+    if (lists.is_null(row) || search_keys.is_null(row)) { return NULL_SENTINEL; }
+
+    auto const key = search_keys.element<Element>(row);
+    auto slot      = static_cast<size_type>(hash_list_element(row, key) % capacity);
+    while (true) {
+      auto const element = elements[slot];
+      if (element == EMPTY_SLOT) { return NOT_FOUND_SENTINEL; }
+      if (rows[slot] == row && list_elements_equal(child.element<Element>(element), key)) {
+        return positions[slot];
+      }
+      slot = (slot + 1) % capacity;
+    }
+  }
+};
+
+/**
+ * @brief Dispatch functor building the hash table of a `hashed_lists`.
+ */
+struct build_hashed_lists_fn {
+  template <typename Element, CUDF_ENABLE_IF(is_supported_non_nested_type<Element>())>
+  void operator()(column_view const& child,
+                  column_view const& labels,
+                  size_type const* offsets,
+                  device_span<size_type> elements,
+                  device_span<size_type> rows,
+                  device_span<size_type> first,
+                  device_span<size_type> last,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_child = column_device_view::create(child, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       child.size(),
+                       insert_list_element_fn<Element>{*d_child,
+                                                       labels.begin<size_type>(),
+                                                       offsets,
+                                                       elements.data(),
+                                                       rows.data(),
+                                                       first.data(),
+                                                       last.data(),
+                                                       static_cast<size_type>(elements.size())});
+  }
+
+  template <typename Element,
+            typename... Args,
+            CUDF_ENABLE_IF(not is_supported_non_nested_type<Element>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type in `hashed_lists`.", cudf::data_type_error);
+  }
+};
+
+/**
+ * @brief Dispatch functor looking up search keys in the hash table of a `hashed_lists`.
+ */
+struct lookup_hashed_lists_fn {
+  template <typename Element, CUDF_ENABLE_IF(is_supported_non_nested_type<Element>())>
+  void operator()(column_view const& lists,
+                  column_view const& child,
+                  column_view const& search_keys,
+                  device_span<size_type const> elements,
+                  device_span<size_type const> rows,
+                  device_span<size_type const> positions,
+                  size_type* output,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_lists       = column_device_view::create(lists, stream);
+    auto const d_child       = column_device_view::create(child, stream);
+    auto const d_search_keys = column_device_view::create(search_keys, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(lists.size()),
+                      output,
+                      lookup_list_element_fn<Element>{*d_lists,
+                                                      *d_child,
+                                                      *d_search_keys,
+                                                      elements.data(),
+                                                      rows.data(),
+                                                      positions.data(),
+                                                      static_cast<size_type>(elements.size())});
+  }
+
+  template <typename Element,
+            typename... Args,
+            CUDF_ENABLE_IF(not is_supported_non_nested_type<Element>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type in `hashed_lists`.", cudf::data_type_error);
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -415,4 +616,100 @@ std::unique_ptr<column> index_of(lists_column_view const& lists,
   return detail::index_of(lists, search_keys, find_option, stream, mr);
 }
 
+hashed_lists::hashed_lists(lists_column_view const& lists,
+                           rmm::cuda_stream_view stream,
+                           rmm::device_async_resource_ref mr)
+  : _lists{lists.parent()},
+    _child{lists.get_sliced_child(stream)},
+    _elements{static_cast<std::size_t>(hashed_lists_capacity(_child.size())), stream, mr},
+    _rows{_elements.size(), stream, mr},
+    _first{_elements.size(), stream, mr},
+    _last{_elements.size(), stream, mr}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(cudf::is_fixed_width(_child.type()) || _child.type().id() == type_id::STRING,
+               "Only lists of fixed-width or string elements are supported in `hashed_lists`.",
+               cudf::data_type_error);
+
+  thrust::fill(rmm::exec_policy(stream), _elements.begin(), _elements.end(), EMPTY_SLOT);
+  // The positions of each slot are reduced from these values by the elements it holds.
+  thrust::fill(rmm::exec_policy(stream),
+               _first.begin(),
+               _first.end(),
+               std::numeric_limits<size_type>::max());
+  thrust::fill(rmm::exec_policy(stream), _last.begin(), _last.end(), size_type{-1});
+  if (_child.size() == 0) { return; }
+
+  auto const labels = detail::generate_labels(
+    lists, _child.size(), stream, rmm::mr::get_current_device_resource());
+  cudf::type_dispatcher<dispatch_storage_type>(_child.type(),
+                                               build_hashed_lists_fn{},
+                                               _child,
+                                               labels->view(),
+                                               lists.offsets_begin(),
+                                               device_span<size_type>{_elements},
+                                               device_span<size_type>{_rows},
+                                               device_span<size_type>{_first},
+                                               device_span<size_type>{_last},
+                                               stream);
+}
+
+hashed_lists::~hashed_lists() = default;
+
+std::unique_ptr<column> hashed_lists::contains(column_view const& search_keys,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto key_indices = index_of(search_keys,
+                              duplicate_find_option::FIND_FIRST,
+                              stream,
+                              rmm::mr::get_current_device_resource());
+  return to_contains(std::move(key_indices), stream, mr);
+}
+
+std::unique_ptr<column> hashed_lists::index_of(column_view const& search_keys,
+                                               duplicate_find_option find_option,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(search_keys.size() == _lists.size(),
+               "Number of search keys must match list column size.");
+  CUDF_EXPECTS(cudf::have_same_types(_child, search_keys),
+               "Type/Scale of search key does not match list column element type.",
+               cudf::data_type_error);
+
+  auto const num_rows = _lists.size();
+  auto out_positions  = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return out_positions; }
+
+  auto const output_it = out_positions->mutable_view().template begin<size_type>();
+  auto const positions = find_option == duplicate_find_option::FIND_FIRST
+                           ? device_span<size_type const>{_first}
+                           : device_span<size_type const>{_last};
+  cudf::type_dispatcher<dispatch_storage_type>(_child.type(),
+                                               lookup_hashed_lists_fn{},
+                                               _lists,
+                                               _child,
+                                               search_keys,
+                                               device_span<size_type const>{_elements},
+                                               device_span<size_type const>{_rows},
+                                               positions,
+                                               output_it,
+                                               stream);
+
+  if (search_keys.has_nulls() || _lists.has_nulls()) {
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      output_it,
+      output_it + num_rows,
+      [] __device__(auto const idx) { return idx != NULL_SENTINEL; },
+      stream,
+      mr);
+    out_positions->set_null_mask(std::move(null_mask), null_count);
+  }
+  return out_positions;
+}
+
 }  // namespace cudf::lists
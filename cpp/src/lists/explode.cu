@@ -29,19 +29,15 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
-#include <thrust/advance.h>
 #include <thrust/binary_search.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
-#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
-#include <thrust/optional.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 
 #include <memory>
-#include <type_traits>
 
 namespace cudf {
 namespace detail {
@@ -52,57 +48,166 @@ constexpr size_type InvalidIndex = -1;
 
 namespace {
 
-std::unique_ptr<table> build_table(
-  table_view const& input_table,
-  size_type const explode_column_idx,
-  column_view const& sliced_child,
-  cudf::device_span<size_type const> gather_map,
-  thrust::optional<cudf::device_span<size_type const>> explode_col_gather_map,
-  thrust::optional<rmm::device_uvector<size_type>> position_array,
-  rmm::cuda_stream_view stream,
-  rmm::device_async_resource_ref mr)
+/**
+ * @brief Functor mapping each exploded row to the input row it comes from.
+ *
+ * The exploded rows of input row `i` are [`offsets[i]`, `offsets[i + 1]`), so the input row of
+ * an exploded row is found by a binary search over the offsets of the input rows instead of
+ * being read from a gather map holding one entry per exploded row.
+ */
+template <typename OffsetsIterator>
+struct exploded_row_fn {
+  OffsetsIterator offsets;  ///< `num_rows + 1` offsets of the exploded rows of each input row
+  size_type num_rows;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return static_cast<size_type>(thrust::distance(
+      offsets + 1, thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_rows + 1, idx)));
+  }
+};
+
+/**
+ * @brief Functor returning the position of each exploded row within its list.
+ */
+template <typename OffsetsIterator>
+struct exploded_position_fn {
+  exploded_row_fn<OffsetsIterator> row_fn;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return idx - row_fn.offsets[row_fn(idx)];
+  }
+};
+
+/**
+ * @brief Functor returning the element of the sliced child of the explode column held by each
+ * exploded row, or `InvalidIndex` for the rows of null or empty lists.
+ */
+template <typename OffsetsIterator>
+struct exploded_element_fn {
+  exploded_row_fn<OffsetsIterator> row_fn;
+  size_type const* list_offsets;  ///< offsets of the explode column
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    auto const row        = row_fn(idx);
+    auto const list_begin = list_offsets[row] - list_offsets[0];
+    if (list_offsets[row + 1] == list_offsets[row]) { return InvalidIndex; }
+    return list_begin + (idx - row_fn.offsets[row]);
+  }
+};
+
+/**
+ * @brief Functor returning the offsets of the exploded rows of each input row of `explode`.
+ */
+struct explode_offsets_fn {
+  size_type const* list_offsets;  ///< offsets of the explode column
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return list_offsets[idx] - list_offsets[0];
+  }
+};
+
+/**
+ * @brief Functor returning the offsets of the exploded rows of each input row of
+ * `explode_outer`, where each null or empty list still produces one row.
+ */
+struct explode_outer_offsets_fn {
+  size_type const* list_offsets;          ///< offsets of the explode column
+  size_type const* null_or_empty_offset;  ///< inclusive count of null or empty lists
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return (list_offsets[idx] - list_offsets[0]) + (idx == 0 ? 0 : null_or_empty_offset[idx - 1]);
+  }
+};
+
+template <typename OffsetsFn>
+auto make_exploded_row_fn(OffsetsFn offsets_fn, size_type num_rows)
+{
+  auto const offsets =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(0), offsets_fn);
+  return exploded_row_fn<decltype(offsets)>{offsets, num_rows};
+}
+
+/**
+ * @brief Build the exploded table.
+ *
+ * @param input_table The table to explode
+ * @param explode_column_idx The column of lists to explode
+ * @param sliced_child The sliced child of the explode column
+ * @param row_fn Maps each exploded row to its input row
+ * @param num_exploded_rows The number of exploded rows
+ * @param is_outer Whether each null or empty list produces a row
+ * @param include_position Whether to add the position of each exploded row within its list
+ */
+template <typename OffsetsIterator>
+std::unique_ptr<table> build_table(table_view const& input_table,
+                                   size_type const explode_column_idx,
+                                   column_view const& sliced_child,
+                                   exploded_row_fn<OffsetsIterator> row_fn,
+                                   size_type num_exploded_rows,
+                                   bool is_outer,
+                                   bool include_position,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
 {
   auto select_iter = thrust::make_transform_iterator(
     thrust::make_counting_iterator(0),
     [explode_column_idx](size_type i) { return i >= explode_column_idx ? i + 1 : i; });
 
+  // The gather map is computed as the columns are gathered rather than materialized.
+  auto const gather_map =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(0), row_fn);
   auto gathered_table =
     detail::gather(input_table.select(select_iter, select_iter + input_table.num_columns() - 1),
-                   gather_map.begin(),
-                   gather_map.end(),
+                   gather_map,
+                   gather_map + num_exploded_rows,
                    cudf::out_of_bounds_policy::DONT_CHECK,
                    stream,
                    mr);
 
   std::vector<std::unique_ptr<column>> columns = gathered_table->release();
 
+  auto const list_offsets =
+    lists_column_view{input_table.column(explode_column_idx)}.offsets_begin();
+  auto const explode_col_gather_map = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), exploded_element_fn<OffsetsIterator>{row_fn, list_offsets});
+
   columns.insert(columns.begin() + explode_column_idx,
-                 explode_col_gather_map
-                   ? std::move(detail::gather(table_view({sliced_child}),
-                                              explode_col_gather_map->begin(),
-                                              explode_col_gather_map->end(),
-                                              cudf::out_of_bounds_policy::NULLIFY,
-                                              stream,
-                                              mr)
-                                 ->release()[0])
-                   : std::make_unique<column>(sliced_child, stream, mr));
-
-  if (position_array) {
-    size_type position_size = position_array->size();
+                 is_outer ? std::move(detail::gather(table_view({sliced_child}),
+                                                     explode_col_gather_map,
+                                                     explode_col_gather_map + num_exploded_rows,
+                                                     cudf::out_of_bounds_policy::NULLIFY,
+                                                     stream,
+                                                     mr)
+                                        ->release()[0])
+                          : std::make_unique<column>(sliced_child, stream, mr));
+
+  if (include_position) {
+    rmm::device_uvector<size_type> position_array(num_exploded_rows, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_exploded_rows),
+                      position_array.begin(),
+                      exploded_position_fn<OffsetsIterator>{row_fn});
+
     // build the null mask for position based on invalid entries in gather map
-    auto nullmask = explode_col_gather_map ? valid_if(
-                                               explode_col_gather_map->begin(),
-                                               explode_col_gather_map->end(),
-                                               [] __device__(auto i) { return i != InvalidIndex; },
-                                               stream,
-                                               mr)
-                                           : std::pair<rmm::device_buffer, size_type>{
-                                               rmm::device_buffer(0, stream), size_type{0}};
+    auto nullmask = is_outer ? valid_if(
+                                 explode_col_gather_map,
+                                 explode_col_gather_map + num_exploded_rows,
+                                 [] __device__(auto i) { return i != InvalidIndex; },
+                                 stream,
+                                 mr)
+                             : std::pair<rmm::device_buffer, size_type>{
+                                 rmm::device_buffer(0, stream), size_type{0}};
 
     columns.insert(columns.begin() + explode_column_idx,
                    std::make_unique<column>(data_type(type_to_id<size_type>()),
-                                            position_size,
-                                            position_array->release(),
+                                            num_exploded_rows,
+                                            position_array.release(),
                                             std::move(nullmask.first),
                                             nullmask.second));
   }
@@ -118,33 +223,18 @@ std::unique_ptr<table> explode(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
   // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
-  auto counting_iter = thrust::make_counting_iterator(0);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::lower_bound(rmm::exec_policy(stream),
-                      offsets_minus_one,
-                      offsets_minus_one + explode_col.size(),
-                      counting_iter,
-                      counting_iter + gather_map.size(),
-                      gather_map.begin());
+  auto const row_fn =
+    make_exploded_row_fn(explode_offsets_fn{explode_col.offsets_begin()}, explode_col.size());
 
   return build_table(input_table,
                      explode_column_idx,
                      sliced_child,
-                     gather_map,
-                     thrust::nullopt,
-                     thrust::nullopt,
+                     row_fn,
+                     sliced_child.size(),
+                     false,
+                     false,
                      stream,
                      mr);
 }
@@ -156,45 +246,18 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
   // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    offsets + 1, cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
-  auto counting_iter = thrust::make_counting_iterator(0);
-
-  rmm::device_uvector<size_type> pos(sliced_child.size(), stream, mr);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::transform(
-    rmm::exec_policy(stream),
-    counting_iter,
-    counting_iter + gather_map.size(),
-    gather_map.begin(),
-    cuda::proclaim_return_type<size_type>([position_array = pos.data(),
-                                           offsets_minus_one,
-                                           offsets,
-                                           offset_size =
-                                             explode_col.size()] __device__(auto idx) -> size_type {
-      auto lb_idx = thrust::distance(
-        offsets_minus_one,
-        thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
-      position_array[idx] = idx - (offsets[lb_idx] - offsets[0]);
-      return lb_idx;
-    }));
+  auto const row_fn =
+    make_exploded_row_fn(explode_offsets_fn{explode_col.offsets_begin()}, explode_col.size());
 
   return build_table(input_table,
                      explode_column_idx,
                      sliced_child,
-                     gather_map,
-                     thrust::nullopt,
-                     std::move(pos),
+                     row_fn,
+                     sliced_child.size(),
+                     false,
+                     true,
                      stream,
                      mr);
 }
@@ -206,9 +269,8 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
                                      rmm::device_async_resource_ref mr)
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child  = explode_col.get_sliced_child(stream);
-  auto counting_iter = thrust::make_counting_iterator(0);
-  auto offsets       = explode_col.offsets_begin();
+  auto sliced_child = explode_col.get_sliced_child(stream);
+  auto offsets      = explode_col.offsets_begin();
 
   // number of nulls or empty lists found so far in the explode column
   rmm::device_uvector<size_type> null_or_empty_offset(explode_col.size(), stream);
@@ -233,68 +295,19 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
                             : explode(input_table, explode_column_idx, stream, mr);
   }
 
-  auto gather_map_size = sliced_child.size() + null_or_empty_count;
-
-  rmm::device_uvector<size_type> gather_map(gather_map_size, stream);
-  rmm::device_uvector<size_type> explode_col_gather_map(gather_map_size, stream);
-  rmm::device_uvector<size_type> pos(include_position ? gather_map_size : 0, stream, mr);
-
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
-
-  auto fill_gather_maps = [offsets_minus_one,
-                           gather_map_p             = gather_map.begin(),
-                           explode_col_gather_map_p = explode_col_gather_map.begin(),
-                           position_array           = pos.begin(),
-                           sliced_child_size        = sliced_child.size(),
-                           null_or_empty_offset_p   = null_or_empty_offset.begin(),
-                           include_position,
-                           offsets,
-                           null_or_empty,
-                           offset_size = explode_col.offsets().size() - 1] __device__(auto idx) {
-    if (idx < sliced_child_size) {
-      auto lb_idx =
-        thrust::distance(offsets_minus_one,
-                         thrust::lower_bound(
-                           thrust::seq, offsets_minus_one, offsets_minus_one + (offset_size), idx));
-      auto index_to_write                      = null_or_empty_offset_p[lb_idx] + idx;
-      gather_map_p[index_to_write]             = lb_idx;
-      explode_col_gather_map_p[index_to_write] = idx;
-      if (include_position) {
-        position_array[index_to_write] = idx - (offsets[lb_idx] - offsets[0]);
-      }
-    }
-    if (null_or_empty[idx]) {
-      auto invalid_index          = null_or_empty_offset_p[idx] == 0
-                                      ? offsets[idx]
-                                      : offsets[idx] + null_or_empty_offset_p[idx] - 1;
-      gather_map_p[invalid_index] = idx;
-
-      explode_col_gather_map_p[invalid_index] = InvalidIndex;
-      if (include_position) { position_array[invalid_index] = 0; }
-    }
-  };
-
-  // we need to do this loop at least explode_col times or we may not properly fill in null and
-  // empty entries.
-  auto loop_count = std::max(sliced_child.size(), explode_col.size());
-
-  // Fill in gather map with all the child column's entries
-  thrust::for_each(
-    rmm::exec_policy(stream), counting_iter, counting_iter + loop_count, fill_gather_maps);
-
-  return build_table(
-    input_table,
-    explode_column_idx,
-    sliced_child,
-    gather_map,
-    explode_col_gather_map,
-    include_position ? std::move(pos) : thrust::optional<rmm::device_uvector<size_type>>{},
-    stream,
-    mr);
+  // Each null or empty list produces one row, whose explode column element is null.
+  auto const row_fn = make_exploded_row_fn(
+    explode_outer_offsets_fn{offsets, null_or_empty_offset.data()}, explode_col.size());
+
+  return build_table(input_table,
+                     explode_column_idx,
+                     sliced_child,
+                     row_fn,
+                     sliced_child.size() + null_or_empty_count,
+                     true,
+                     include_position,
+                     stream,
+                     mr);
 }
 
 }  // namespace detail
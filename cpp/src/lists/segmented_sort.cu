@@ -14,21 +14,29 @@
  * limitations under the License.
  */
 
+#include "utilities.hpp"
+
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/lists/sorting.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/util_ptx.cuh>
 #include <thrust/transform.h>
 
 namespace cudf {
@@ -58,6 +66,174 @@ std::unique_ptr<column> build_output_offsets(lists_column_view const& input,
   return output_offset;
 }
 
+static_assert(short_list_max_size == cudf::detail::warp_size,
+              "Short lists are sorted with one element per lane of a warp");
+
+/**
+ * @brief An element of a short list held by one lane of the warp sorting the list
+ */
+template <typename T>
+struct short_list_key {
+  T value;
+  bool is_valid;
+  size_type index;  ///< position in the list, or past its end for the padding lanes
+};
+
+/**
+ * @brief Orders the elements of a short list as the segmented sort does
+ *
+ * Equivalent elements keep their order in the list so the sort is stable.
+ */
+template <typename T>
+struct short_list_less {
+  size_type size;
+  order column_order;
+  null_order null_precedence;
+
+  __device__ bool operator()(short_list_key<T> const& lhs, short_list_key<T> const& rhs) const
+  {
+    // the padding lanes sort after the elements of the list
+    if (lhs.index >= size || rhs.index >= size) { return lhs.index < rhs.index; }
+
+    auto const state = (!lhs.is_valid || !rhs.is_valid)
+                         ? null_compare(!lhs.is_valid, !rhs.is_valid, null_precedence)
+                         : relational_compare(lhs.value, rhs.value);
+    if (state == weak_ordering::EQUIVALENT) { return lhs.index < rhs.index; }
+    return state ==
+           (column_order == order::ASCENDING ? weak_ordering::LESS : weak_ordering::GREATER);
+  }
+};
+
+/**
+ * @brief Sorts each list of at most `warp_size` elements with a bitonic sorting network
+ * in the registers of one warp
+ *
+ * @param input The sliced child column of the lists
+ * @param offsets The normalized offsets of the lists
+ * @param num_lists The number of lists
+ * @param column_order The order of the sorted elements
+ * @param null_precedence The order of the null elements
+ * @param output The sorted child column
+ */
+template <typename T>
+CUDF_KERNEL void sort_short_lists_kernel(column_device_view input,
+                                         size_type const* offsets,
+                                         size_type num_lists,
+                                         order column_order,
+                                         null_order null_precedence,
+                                         mutable_column_device_view output)
+{
+  auto constexpr warp_size = cudf::detail::warp_size;
+  auto const tid           = cudf::detail::grid_1d::global_thread_id();
+  auto const list          = static_cast<size_type>(tid / warp_size);
+  auto const lane          = static_cast<size_type>(tid % warp_size);
+  // every lane of a warp sorts the same list, so whole warps return together
+  if (list >= num_lists) { return; }
+
+  auto const begin = offsets[list];
+  auto const size  = offsets[list + 1] - begin;
+  auto const less  = short_list_less<T>{size, column_order, null_precedence};
+
+  auto key = short_list_key<T>{T{}, false, lane};
+  if (lane < size) {
+    key.is_valid = input.is_valid(begin + lane);
+    if (key.is_valid) { key.value = input.element<T>(begin + lane); }
+  }
+
+  for (size_type k = 2; k <= warp_size; k <<= 1) {
+    for (size_type j = k / 2; j > 0; j >>= 1) {
+      auto const other = cub::ShuffleIndex<warp_size>(key, lane ^ j, 0xffff'ffffu);
+      // the lower lane of each pair keeps the smaller key in ascending runs of the network
+      auto const keep_smaller = ((lane & j) == 0) == ((lane & k) == 0);
+      if (less(other, key) == keep_smaller) { key = other; }
+    }
+  }
+
+  if (lane < size) {
+    output.element<T>(begin + lane) = key.value;
+    if (output.nullable()) {
+      key.is_valid ? output.set_valid(begin + lane) : output.set_null(begin + lane);
+    }
+  }
+}
+
+/**
+ * @brief Sorts the child of a lists column whose lists all have at most
+ * `short_list_max_size` elements, one warp per list
+ */
+struct sort_short_lists_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  std::unique_ptr<column> operator()(column_view const& child,
+                                     column_view const& offsets,
+                                     order column_order,
+                                     null_order null_precedence,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto output = make_fixed_width_column(
+      child.type(),
+      child.size(),
+      child.has_nulls() ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+      stream,
+      mr);
+    auto const num_lists = offsets.size() - 1;
+    if (num_lists > 0 && child.size() > 0) {
+      auto const d_input  = column_device_view::create(child, stream);
+      auto const d_output = mutable_column_device_view::create(output->mutable_view(), stream);
+      auto constexpr block_size = 256;
+      cudf::detail::grid_1d const grid{
+        static_cast<thread_index_type>(num_lists) * cudf::detail::warp_size, block_size};
+      auto const d_offsets = offsets.begin<size_type>();
+      sort_short_lists_kernel<T>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          *d_input, d_offsets, num_lists, column_order, null_precedence, *d_output);
+    }
+    output->set_null_count(child.null_count());
+    return output;
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  std::unique_ptr<column> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Only lists of fixed-width elements are sorted in registers");
+  }
+};
+
+/**
+ * @brief Returns true if the lists are sorted with `sort_short_lists_fn`
+ *
+ * Sorting networks in registers avoid the temporary storage of the segmented sort, which
+ * dominates the cost of sorting many short lists.
+ */
+bool use_short_lists_sort(lists_column_view const& input, rmm::cuda_stream_view stream)
+{
+  auto const child_type = input.child().type();
+  return cudf::is_fixed_width(child_type) && max_list_size(input, stream) <= short_list_max_size;
+}
+
+/**
+ * @brief Stable sort of the elements of each short list
+ *
+ * @param child The sliced child column of the lists
+ * @param offsets The normalized offsets of the lists
+ */
+std::unique_ptr<column> sort_short_lists(column_view const& child,
+                                         column_view const& offsets,
+                                         order column_order,
+                                         null_order null_precedence,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  return cudf::type_dispatcher<dispatch_storage_type>(child.type(),
+                                                      sort_short_lists_fn{},
+                                                      child,
+                                                      offsets,
+                                                      column_order,
+                                                      null_precedence,
+                                                      stream,
+                                                      mr);
+}
+
 }  // namespace
 
 std::unique_ptr<column> sort_lists(lists_column_view const& input,
@@ -71,6 +247,18 @@ std::unique_ptr<column> sort_lists(lists_column_view const& input,
   auto output_offset = build_output_offsets(input, stream, mr);
   auto const child   = input.get_sliced_child(stream);
 
+  if (use_short_lists_sort(input, stream)) {
+    auto sorted_child =
+      sort_short_lists(child, output_offset->view(), column_order, null_precedence, stream, mr);
+    return make_lists_column(input.size(),
+                             std::move(output_offset),
+                             std::move(sorted_child),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                             stream,
+                             mr);
+  }
+
   auto const sorted_child_table = cudf::detail::segmented_sort_by_key(table_view{{child}},
                                                                       table_view{{child}},
                                                                       output_offset->view(),
@@ -99,6 +287,18 @@ std::unique_ptr<column> stable_sort_lists(lists_column_view const& input,
   auto output_offset = build_output_offsets(input, stream, mr);
   auto const child   = input.get_sliced_child(stream);
 
+  if (use_short_lists_sort(input, stream)) {
+    auto sorted_child =
+      sort_short_lists(child, output_offset->view(), column_order, null_precedence, stream, mr);
+    return make_lists_column(input.size(),
+                             std::move(output_offset),
+                             std::move(sorted_child),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                             stream,
+                             mr);
+  }
+
   auto const sorted_child_table = cudf::detail::stable_segmented_sort_by_key(table_view{{child}},
                                                                              table_view{{child}},
                                                                              output_offset->view(),
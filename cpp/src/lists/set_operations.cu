@@ -16,6 +16,7 @@
 
 #include "utilities.hpp"
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if.cuh>
@@ -26,17 +27,22 @@
 #include <cudf/lists/detail/combine.hpp>
 #include <cudf/lists/detail/set_operations.hpp>
 #include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/std/type_traits>
 #include <thrust/distance.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/reduce.h>
 #include <thrust/scatter.h>
+#include <thrust/transform.h>
 #include <thrust/uninitialized_fill.h>
 
 namespace cudf::lists {
@@ -56,6 +62,208 @@ void check_compatibility(lists_column_view const& lhs, lists_column_view const&
                "The input lists columns must have children having the same type structure");
 }
 
+/**
+ * @brief Returns true if the set operations compare the elements of each pair of lists directly
+ *
+ * Comparing the few elements of short lists directly avoids building the hash tables of the
+ * general algorithms.
+ */
+bool use_direct_comparison(lists_column_view const& lhs,
+                           lists_column_view const& rhs,
+                           rmm::cuda_stream_view stream)
+{
+  return cudf::is_fixed_width(lhs.child().type()) &&
+         max_list_size(lhs, stream) <= short_list_max_size &&
+         max_list_size(rhs, stream) <= short_list_max_size;
+}
+
+/**
+ * @brief Compares elements of the child columns of lists with the given null and NaN equality
+ */
+template <typename T>
+struct list_element_equal {
+  null_equality nulls_equal;
+  nan_equality nans_equal;
+
+  __device__ bool operator()(column_device_view const& lhs,
+                             size_type lhs_idx,
+                             column_device_view const& rhs,
+                             size_type rhs_idx) const
+  {
+    auto const lhs_is_valid = lhs.is_valid(lhs_idx);
+    auto const rhs_is_valid = rhs.is_valid(rhs_idx);
+    if (!lhs_is_valid || !rhs_is_valid) {
+      return !lhs_is_valid && !rhs_is_valid && nulls_equal == null_equality::EQUAL;
+    }
+
+    auto const lhs_value = lhs.element<T>(lhs_idx);
+    auto const rhs_value = rhs.element<T>(rhs_idx);
+    if constexpr (cuda::std::is_floating_point_v<T>) {
+      if (isnan(lhs_value) && isnan(rhs_value)) { return nans_equal == nan_equality::ALL_EQUAL; }
+    }
+    return lhs_value == rhs_value;
+  }
+
+  /**
+   * @brief Returns true if element `idx` of `values` equals an element of `list` in the range
+   * [`begin`, `end`)
+   */
+  __device__ bool contains(column_device_view const& list,
+                           size_type begin,
+                           size_type end,
+                           column_device_view const& values,
+                           size_type idx) const
+  {
+    for (auto i = begin; i < end; ++i) {
+      if ((*this)(list, i, values, idx)) { return true; }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Checks if each pair of short lists has an element in common
+ */
+template <typename T>
+struct short_lists_overlap_fn {
+  column_device_view lhs;
+  column_device_view rhs;
+  size_type const* lhs_offsets;
+  size_type const* rhs_offsets;
+  list_element_equal<T> equal;
+
+  __device__ bool operator()(size_type row) const
+  {
+    for (auto i = rhs_offsets[row]; i < rhs_offsets[row + 1]; ++i) {
+      if (equal.contains(lhs, lhs_offsets[row], lhs_offsets[row + 1], rhs, i)) { return true; }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Selects the elements of short lists which are (or are not) contained in the
+ * corresponding lists of `others`, keeping only the first of equal elements of each list
+ */
+template <typename T>
+struct short_lists_filter_fn {
+  column_device_view keys;
+  column_device_view others;
+  size_type const* keys_offsets;
+  size_type const* others_offsets;
+  size_type const* labels;  ///< list of each element of the sliced child of `keys`
+  bool keep_contained;
+  list_element_equal<T> equal;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    auto const row     = labels[idx];
+    auto const element = keys_offsets[0] + idx;
+    if (equal.contains(keys, keys_offsets[row], element, keys, element)) { return false; }
+    return equal.contains(others, others_offsets[row], others_offsets[row + 1], keys, element) ==
+           keep_contained;
+  }
+};
+
+struct short_lists_overlap_dispatch {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void operator()(lists_column_view const& lhs,
+                  lists_column_view const& rhs,
+                  null_equality nulls_equal,
+                  nan_equality nans_equal,
+                  bool* results,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_lhs = column_device_view::create(lhs.child(), stream);
+    auto const d_rhs = column_device_view::create(rhs.child(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(lhs.size()),
+                      results,
+                      short_lists_overlap_fn<T>{*d_lhs,
+                                                *d_rhs,
+                                                lhs.offsets_begin(),
+                                                rhs.offsets_begin(),
+                                                list_element_equal<T>{nulls_equal, nans_equal}});
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Only lists of fixed-width elements are compared directly");
+  }
+};
+
+struct short_lists_filter_dispatch {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  rmm::device_uvector<bool> operator()(lists_column_view const& keys,
+                                       lists_column_view const& others,
+                                       column_view const& labels,
+                                       bool keep_contained,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::cuda_stream_view stream) const
+  {
+    auto const d_keys   = column_device_view::create(keys.child(), stream);
+    auto const d_others = column_device_view::create(others.child(), stream);
+    auto selected       = rmm::device_uvector<bool>(labels.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(labels.size()),
+                      selected.begin(),
+                      short_lists_filter_fn<T>{*d_keys,
+                                               *d_others,
+                                               keys.offsets_begin(),
+                                               others.offsets_begin(),
+                                               labels.begin<size_type>(),
+                                               keep_contained,
+                                               list_element_equal<T>{nulls_equal, nans_equal}});
+    return selected;
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  rmm::device_uvector<bool> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Only lists of fixed-width elements are compared directly");
+  }
+};
+
+/**
+ * @brief Extracts the distinct elements of the short lists of `keys` which are (or are not)
+ * contained in the corresponding lists of `others`
+ *
+ * @param keys_table The table {keys_labels, keys_child} of the sliced child of `keys`
+ * @param keys The lists whose elements are extracted
+ * @param others The lists searched for the elements of `keys`
+ * @param keep_contained Whether the elements contained in `others` are extracted, rather than
+ *        those not contained in `others`
+ * @return The extracted rows of `keys_table`, in their input order
+ */
+std::unique_ptr<table> filter_short_lists(table_view const& keys_table,
+                                          lists_column_view const& keys,
+                                          lists_column_view const& others,
+                                          bool keep_contained,
+                                          null_equality nulls_equal,
+                                          nan_equality nans_equal,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto const selected = cudf::type_dispatcher<dispatch_storage_type>(keys.child().type(),
+                                                                     short_lists_filter_dispatch{},
+                                                                     keys,
+                                                                     others,
+                                                                     keys_table.column(0),
+                                                                     keep_contained,
+                                                                     nulls_equal,
+                                                                     nans_equal,
+                                                                     stream);
+  return cudf::detail::copy_if(
+    keys_table,
+    [selected = selected.begin()] __device__(auto const idx) { return selected[idx]; },
+    stream,
+    mr);
+}
+
 }  // namespace
 
 std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
@@ -67,6 +275,24 @@ std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
 {
   check_compatibility(lhs, rhs);
 
+  if (use_direct_comparison(lhs, rhs, stream)) {
+    auto [null_mask, null_count] =
+      cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
+    auto result = make_numeric_column(
+      data_type{type_to_id<bool>()}, lhs.size(), std::move(null_mask), null_count, stream, mr);
+    cudf::type_dispatcher<dispatch_storage_type>(lhs.child().type(),
+                                                 short_lists_overlap_dispatch{},
+                                                 lhs,
+                                                 rhs,
+                                                 nulls_equal,
+                                                 nans_equal,
+                                                 result->mutable_view().begin<bool>(),
+                                                 stream);
+    // Reset null count, which was invalidated when calling to `mutable_view()`.
+    result->set_null_count(null_count);
+    return result;
+  }
+
   // Algorithm:
   // - Generate labels for lhs and rhs child elements.
   // - Check existence for rows of the table {rhs_labels, rhs_child} in the table
@@ -143,33 +369,45 @@ std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
   //   {lhs_labels, lhs_child}.
   // - Extract rows of the rhs table using the existence results computed in the previous step.
   // - Remove duplicate rows, and build the output lists.
+  // Short lists are instead compared directly with each other and themselves, which extracts
+  // the distinct rows of the rhs table in one step.
 
   auto const lhs_child = lhs.get_sliced_child(stream);
   auto const rhs_child = rhs.get_sliced_child(stream);
-  auto const lhs_labels =
-    generate_labels(lhs, lhs_child.size(), stream, rmm::mr::get_current_device_resource());
   auto const rhs_labels =
     generate_labels(rhs, rhs_child.size(), stream, rmm::mr::get_current_device_resource());
-  auto const lhs_table = table_view{{lhs_labels->view(), lhs_child}};
   auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
 
-  auto const contained = cudf::detail::contains(
-    lhs_table, rhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
-
-  auto const intersect_table = cudf::detail::copy_if(
-    rhs_table,
-    [contained = contained.begin()] __device__(auto const idx) { return contained[idx]; },
-    stream,
-    rmm::mr::get_current_device_resource());
-
-  // A stable algorithm is required to ensure that list labels remain contiguous.
-  auto out_table = cudf::detail::stable_distinct(intersect_table->view(),
-                                                 {0, 1},  // indices of key columns
-                                                 duplicate_keep_option::KEEP_ANY,
-                                                 nulls_equal,
-                                                 nans_equal,
-                                                 stream,
-                                                 mr);
+  std::unique_ptr<table> out_table;
+  if (use_direct_comparison(lhs, rhs, stream)) {
+    out_table = filter_short_lists(rhs_table, rhs, lhs, true, nulls_equal, nans_equal, stream, mr);
+  } else {
+    auto const lhs_labels =
+      generate_labels(lhs, lhs_child.size(), stream, rmm::mr::get_current_device_resource());
+    auto const lhs_table = table_view{{lhs_labels->view(), lhs_child}};
+
+    auto const contained = cudf::detail::contains(lhs_table,
+                                                  rhs_table,
+                                                  nulls_equal,
+                                                  nans_equal,
+                                                  stream,
+                                                  rmm::mr::get_current_device_resource());
+
+    auto const intersect_table = cudf::detail::copy_if(
+      rhs_table,
+      [contained = contained.begin()] __device__(auto const idx) { return contained[idx]; },
+      stream,
+      rmm::mr::get_current_device_resource());
+
+    // A stable algorithm is required to ensure that list labels remain contiguous.
+    out_table = cudf::detail::stable_distinct(intersect_table->view(),
+                                              {0, 1},  // indices of key columns
+                                              duplicate_keep_option::KEEP_ANY,
+                                              nulls_equal,
+                                              nans_equal,
+                                              stream,
+                                              mr);
+  }
 
   auto const num_rows = lhs.size();
   auto out_offsets    = reconstruct_offsets(out_table->get_column(0).view(), num_rows, stream, mr);
@@ -226,33 +464,45 @@ std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
   // - Invert the existence results computed in the previous step, resulting in difference results.
   // - Extract rows of the lhs table using that difference results.
   // - Remove duplicate rows, and build the output lists.
+  // Short lists are instead compared directly with each other and themselves, which extracts
+  // the distinct rows of the lhs table in one step.
 
   auto const lhs_child = lhs.get_sliced_child(stream);
   auto const rhs_child = rhs.get_sliced_child(stream);
   auto const lhs_labels =
     generate_labels(lhs, lhs_child.size(), stream, rmm::mr::get_current_device_resource());
-  auto const rhs_labels =
-    generate_labels(rhs, rhs_child.size(), stream, rmm::mr::get_current_device_resource());
   auto const lhs_table = table_view{{lhs_labels->view(), lhs_child}};
-  auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
 
-  auto const contained = cudf::detail::contains(
-    rhs_table, lhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
-
-  auto const difference_table = cudf::detail::copy_if(
-    lhs_table,
-    [contained = contained.begin()] __device__(auto const idx) { return !contained[idx]; },
-    stream,
-    rmm::mr::get_current_device_resource());
-
-  // A stable algorithm is required to ensure that list labels remain contiguous.
-  auto out_table = cudf::detail::stable_distinct(difference_table->view(),
-                                                 {0, 1},  // indices of key columns
-                                                 duplicate_keep_option::KEEP_ANY,
-                                                 nulls_equal,
-                                                 nans_equal,
-                                                 stream,
-                                                 mr);
+  std::unique_ptr<table> out_table;
+  if (use_direct_comparison(lhs, rhs, stream)) {
+    out_table = filter_short_lists(lhs_table, lhs, rhs, false, nulls_equal, nans_equal, stream, mr);
+  } else {
+    auto const rhs_labels =
+      generate_labels(rhs, rhs_child.size(), stream, rmm::mr::get_current_device_resource());
+    auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
+
+    auto const contained = cudf::detail::contains(rhs_table,
+                                                  lhs_table,
+                                                  nulls_equal,
+                                                  nans_equal,
+                                                  stream,
+                                                  rmm::mr::get_current_device_resource());
+
+    auto const difference_table = cudf::detail::copy_if(
+      lhs_table,
+      [contained = contained.begin()] __device__(auto const idx) { return !contained[idx]; },
+      stream,
+      rmm::mr::get_current_device_resource());
+
+    // A stable algorithm is required to ensure that list labels remain contiguous.
+    out_table = cudf::detail::stable_distinct(difference_table->view(),
+                                              {0, 1},  // indices of key columns
+                                              duplicate_keep_option::KEEP_ANY,
+                                              nulls_equal,
+                                              nans_equal,
+                                              stream,
+                                              mr);
+  }
 
   auto const num_rows = lhs.size();
   auto out_offsets    = reconstruct_offsets(out_table->get_column(0).view(), num_rows, stream, mr);
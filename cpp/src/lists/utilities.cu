@@ -18,10 +18,15 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/labeling/label_segments.cuh>
 
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+
 namespace cudf::lists::detail {
 
 std::unique_ptr<column> generate_labels(lists_column_view const& input,
@@ -78,4 +83,19 @@ std::unique_ptr<column> get_normalized_offsets(lists_column_view const& input,
   return out_offsets;
 }
 
+size_type max_list_size(lists_column_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.is_empty()) { return 0; }
+
+  auto const sizes = cudf::detail::make_counting_transform_iterator(
+    0, [d_offsets = input.offsets_begin()] __device__(size_type idx) {
+      return d_offsets[idx + 1] - d_offsets[idx];
+    });
+  return thrust::reduce(rmm::exec_policy(stream),
+                        sizes,
+                        sizes + input.size(),
+                        size_type{0},
+                        thrust::maximum<size_type>{});
+}
+
 }  // namespace cudf::lists::detail
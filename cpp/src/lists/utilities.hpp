@@ -25,6 +25,9 @@
 
 namespace cudf::lists::detail {
 
+/// Largest list size for which list operations compare the elements of each list directly
+constexpr size_type short_list_max_size = 32;
+
 /**
  * @brief Generate list labels for elements in the child column of the input lists column.
  *
@@ -65,4 +68,13 @@ std::unique_ptr<column> get_normalized_offsets(lists_column_view const& input,
                                                rmm::cuda_stream_view stream,
                                                rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Return the number of elements of the largest list of the input lists column.
+ *
+ * @param input The input lists column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The largest list size, or 0 if the input is empty
+ */
+size_type max_list_size(lists_column_view const& input, rmm::cuda_stream_view stream);
+
 }  // namespace cudf::lists::detail
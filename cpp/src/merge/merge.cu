@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
@@ -51,6 +52,8 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <queue>
@@ -581,6 +584,96 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Merges the rows at `indices` of the sorted runs given by `run_offsets`
+ *
+ * Adjacent runs are merged pairwise until one run is left. Only the indices are moved by each
+ * round and a row of an earlier run comes before an equal row of a later run.
+ *
+ * @param indices Row indices holding each run in order; replaced by the merged rows
+ * @param run_offsets Offset of each run in `indices` followed by the size of `indices`
+ * @param less Device comparator of two row indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename Comparator>
+void merge_sorted_runs(rmm::device_uvector<size_type>& indices,
+                       std::vector<size_type> run_offsets,
+                       Comparator const& less,
+                       rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> merged(indices.size(), stream);
+  while (run_offsets.size() > 2) {
+    std::vector<size_type> merged_offsets{0};
+    for (std::size_t run = 0; run + 1 < run_offsets.size(); run += 2) {
+      auto const first  = indices.begin() + run_offsets[run];
+      auto const middle = indices.begin() + run_offsets[run + 1];
+      auto const last =
+        run + 2 < run_offsets.size() ? indices.begin() + run_offsets[run + 2] : middle;
+      thrust::merge(rmm::exec_policy_nosync(stream),
+                    first,
+                    middle,
+                    middle,
+                    last,
+                    merged.begin() + run_offsets[run],
+                    less);
+      merged_offsets.push_back(static_cast<size_type>(std::distance(indices.begin(), last)));
+    }
+    std::swap(indices, merged);
+    run_offsets = std::move(merged_offsets);
+  }
+}
+
+/**
+ * @brief Merges several sorted tables in one pass over their columns
+ *
+ * Merging the tables two at a time copies every column once per round of merges. Here the
+ * tables are concatenated and the sorted run of row indices of each table is merged with the
+ * others, so the columns are copied only by the concatenation and by one final gather.
+ */
+table_ptr_type merge_many(std::vector<table_view> const& tables,
+                          std::vector<cudf::size_type> const& key_cols,
+                          std::vector<cudf::order> const& column_order,
+                          std::vector<cudf::null_order> const& null_precedence,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr)
+{
+  auto const concatenated =
+    cudf::detail::concatenate(tables, stream, rmm::mr::get_current_device_resource());
+  auto const keys = concatenated->view().select(key_cols);
+
+  std::vector<size_type> run_offsets{0};
+  for (auto const& table : tables) {
+    run_offsets.push_back(run_offsets.back() + table.num_rows());
+  }
+
+  rmm::device_uvector<size_type> indices(concatenated->num_rows(), stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), indices.begin(), indices.end());
+
+  auto const comparator = cudf::experimental::row::lexicographic::self_comparator(
+    keys, column_order, null_precedence, stream);
+  auto const has_nulls = nullate::DYNAMIC{has_nested_nulls(keys)};
+  if (cudf::detail::has_nested_columns(keys)) {
+    merge_sorted_runs(indices, run_offsets, comparator.less<true>(has_nulls), stream);
+  } else {
+    merge_sorted_runs(indices, run_offsets, comparator.less<false>(has_nulls), stream);
+  }
+
+  return cudf::detail::gather(concatenated->view(),
+                              indices.begin(),
+                              indices.end(),
+                              out_of_bounds_policy::DONT_CHECK,
+                              stream,
+                              mr);
+}
+
+/// Returns true if any column of `table` is a dictionary column
+bool has_dictionary_columns(table_view const& table)
+{
+  return std::any_of(table.begin(), table.end(), [](auto const& col) {
+    return col.type().id() == type_id::DICTIONARY32;
+  });
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -663,6 +756,16 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // No inputs have rows, return a table with same columns as the first one
   if (merge_queue.empty()) { return empty_like(first_table); }
 
+  // Merge more than two tables at once, except dictionaries whose keys were matched above
+  if (merge_queue.size() > 2 and not has_dictionary_columns(first_table)) {
+    std::vector<table_view> non_empty_tables;
+    std::copy_if(merge_tables.begin(),
+                 merge_tables.end(),
+                 std::back_inserter(non_empty_tables),
+                 [](auto const& table) { return table.num_rows() > 0; });
+    return merge_many(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
+  }
+
   // Pick the two smallest tables and merge them
   // Until there is only one table left in the queue
   while (merge_queue.size() > 1) {
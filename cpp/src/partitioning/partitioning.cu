@@ -16,16 +16,19 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/contiguous_split.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -37,8 +40,13 @@
 #include <cub/device/device_histogram.cuh>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -50,6 +58,10 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 // Launch configuration for fallback hash partition
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
+// Minimum average number of rows per partition counted by each block of the fallback hash
+// partition. With many partitions, the per-block partition sizes are otherwise larger than the
+// table itself.
+constexpr size_type FALLBACK_ROWS_PER_PARTITION = 8;
 
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
@@ -434,33 +446,28 @@ struct copy_block_partitions_dispatcher {
   }
 
   template <typename DataType, CUDF_ENABLE_IF(not is_copy_block_supported<DataType>())>
-  std::unique_ptr<column> operator()(column_view const& input,
-                                     size_type const num_partitions,
-                                     size_type const* row_partition_numbers,
-                                     size_type const* row_partition_offset,
-                                     size_type const* block_partition_sizes,
-                                     size_type const* scanned_block_partition_sizes,
-                                     size_type grid_size,
-                                     rmm::cuda_stream_view stream,
-                                     rmm::device_async_resource_ref mr)
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref)
   {
-    // Use move_to_output_buffer to create an equivalent gather map
-    auto gather_map = compute_gather_map(input.size(),
-                                         num_partitions,
-                                         row_partition_numbers,
-                                         row_partition_offset,
-                                         block_partition_sizes,
-                                         scanned_block_partition_sizes,
-                                         grid_size,
-                                         stream);
-
-    auto gather_table = cudf::detail::gather(cudf::table_view({input}),
-                                             gather_map,
-                                             out_of_bounds_policy::DONT_CHECK,
-                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                             stream,
-                                             mr);
-    return std::move(gather_table->release().front());
+    CUDF_FAIL("Unsupported type for copy_block_partitions");
+  }
+};
+
+/**
+ * @brief Returns true if the column type is copied by copy_block_partitions
+ */
+struct is_copy_block_supported_fn {
+  template <typename DataType>
+  constexpr bool operator()() const
+  {
+    return copy_block_partitions_dispatcher::is_copy_block_supported<DataType>();
   }
 };
 
@@ -480,7 +487,12 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
   auto const rows_per_thread =
     use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  // The kernels stride over the rows, so the fallback can use fewer blocks than rows_per_thread
+  // implies to keep the grid_size * num_partitions block partition sizes small
+  auto const rows_per_block =
+    use_optimization ? block_size * rows_per_thread
+                     : std::max(block_size * rows_per_thread,
+                                num_partitions * FALLBACK_ROWS_PER_PARTITION);
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -580,35 +592,67 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   if (use_optimization) {
     std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
 
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
-      return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                          copy_block_partitions_dispatcher{},
-                                                          col,
-                                                          num_partitions,
-                                                          row_partition_numbers.data(),
-                                                          row_partition_offset.data(),
-                                                          block_partition_sizes.data(),
-                                                          scanned_block_partition_sizes.data(),
-                                                          grid_size,
-                                                          stream,
-                                                          mr);
-    });
+    // The gather map is only computed, once, if some columns or null masks need to be gathered
+    std::optional<rmm::device_uvector<size_type>> gather_map;
+    auto const get_gather_map = [&]() -> rmm::device_uvector<size_type> const& {
+      if (not gather_map.has_value()) {
+        gather_map = compute_gather_map(num_rows,
+                                        num_partitions,
+                                        row_partition_numbers.data(),
+                                        row_partition_offset.data(),
+                                        block_partition_sizes.data(),
+                                        scanned_block_partition_sizes.data(),
+                                        grid_size,
+                                        stream);
+      }
+      return *gather_map;
+    };
+
+    // Copy fixed-width columns to output by partition per column
+    std::vector<size_type> gathered_indices;
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const& col = input.column(i);
+      if (not cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                           is_copy_block_supported_fn{})) {
+        gathered_indices.push_back(i);
+        continue;
+      }
+      output_cols[i] =
+        cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                     copy_block_partitions_dispatcher{},
+                                                     col,
+                                                     num_partitions,
+                                                     row_partition_numbers.data(),
+                                                     row_partition_offset.data(),
+                                                     block_partition_sizes.data(),
+                                                     scanned_block_partition_sizes.data(),
+                                                     grid_size,
+                                                     stream,
+                                                     mr);
+    }
 
-    if (has_nested_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers.data(),
-                                           row_partition_offset.data(),
-                                           block_partition_sizes.data(),
-                                           scanned_block_partition_sizes.data(),
-                                           grid_size,
-                                           stream);
+    // Gather the string and nested columns together, in a single pass over the table
+    if (not gathered_indices.empty()) {
+      auto gathered = cudf::detail::gather(input.select(gathered_indices),
+                                           get_gather_map(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           mr)
+                        ->release();
+      for (std::size_t i = 0; i < gathered_indices.size(); ++i) {
+        output_cols[gathered_indices[i]] = std::move(gathered[i]);
+      }
+    }
 
+    if (has_nested_nulls(input)) {
       // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
+      detail::gather_bitmask(input,
+                             get_gather_map().begin(),
+                             output_cols,
+                             detail::gather_bitmask_op::DONT_CHECK,
+                             stream,
+                             mr);
     }
 
     stream.synchronize();  // Async D2H copy must finish before returning host vec
@@ -624,8 +668,20 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                                    stream.value()>>>(
       row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
 
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(input, row_partition_numbers, input, stream, mr);
+    // Invert the scatter map into a gather map, so that all columns, including strings and
+    // nested columns, are materialized by a single gather of the table
+    rmm::device_uvector<size_type> gather_map(num_rows, stream);
+    thrust::scatter(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    row_partition_numbers.begin(),
+                    gather_map.begin());
+    auto output = cudf::detail::gather(input,
+                                       gather_map,
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
 
     stream.synchronize();  // Async D2H copy must finish before returning host vec
     return std::pair(std::move(output), std::move(partition_offsets));
@@ -800,6 +856,30 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& split_points,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const keys = input.select(key_columns);
+  CUDF_EXPECTS(keys.num_columns() == split_points.num_columns(),
+               "Mismatch between number of key columns and split point columns.",
+               std::invalid_argument);
+
+  // the search result is the partition map: the number of split points below each row
+  auto const partition_map = detail::lower_bound(split_points,
+                                                 keys,
+                                                 column_order,
+                                                 null_precedence,
+                                                 stream,
+                                                 rmm::mr::get_current_device_resource());
+  return partition(input, partition_map->view(), split_points.num_rows() + 1, stream, mr);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -829,6 +909,47 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.", std::invalid_argument);
+
+  // The partitioned table only lives until it has been copied into the packed buffers, so it
+  // comes from the default resource instead of `mr`
+  auto [partitioned, offsets] = cudf::hash_partition(input,
+                                                     columns_to_hash,
+                                                     num_partitions,
+                                                     hash_function,
+                                                     seed,
+                                                     stream,
+                                                     rmm::mr::get_current_device_resource());
+
+  // `offsets` holds the start row of every partition; the first one is always 0
+  auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+  return detail::contiguous_split(partitioned->view(), splits, stream, mr);
+}
+
+// Partition based on sorted split points
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& split_points,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, key_columns, split_points, column_order, null_precedence, stream, mr);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
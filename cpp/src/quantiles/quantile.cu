@@ -15,6 +15,7 @@
  */
 
 #include "quantiles/quantiles_util.hpp"
+#include "quantiles/radix_select.cuh"
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
@@ -187,6 +188,91 @@ std::unique_ptr<column> quantile(column_view const& input,
   }
 }
 
+template <bool exact>
+struct quantile_by_selection_functor {
+  std::vector<double> const& q;
+  interpolation interp;
+  rmm::cuda_stream_view stream;
+  rmm::device_async_resource_ref mr;
+
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic_v<T> and not cudf::is_fixed_point<T>(),
+                   std::unique_ptr<column>>
+  operator()(column_view const&)
+  {
+    CUDF_FAIL("quantile does not support non-numeric types");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T> or cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& input)
+  {
+    using StorageType   = cudf::device_storage_type_t<T>;
+    using ExactResult   = std::conditional_t<exact and not cudf::is_fixed_point<T>(), double, T>;
+    using StorageResult = cudf::device_storage_type_t<ExactResult>;
+
+    auto const type =
+      is_fixed_point(input.type()) ? input.type() : data_type{type_to_id<StorageResult>()};
+    auto output = make_fixed_width_column(type, q.size(), mask_state::UNALLOCATED, stream, mr);
+
+    if (output->size() == 0) { return output; }
+
+    // nulls are not selected so the quantiles are those of the valid values
+    auto const size = input.size() - input.null_count();
+    if (size == 0) {
+      auto mask = cudf::detail::create_null_mask(output->size(), mask_state::ALL_NULL, stream, mr);
+      output->set_null_mask(std::move(mask), output->size());
+      return output;
+    }
+
+    // the sorted positions of the values needed for each quantile
+    auto const num_slots = ranks_per_quantile(interp);
+    std::vector<size_type> ranks(q.size() * num_slots);
+    for (std::size_t idx = 0; idx < ranks.size(); ++idx) {
+      ranks[idx] = quantile_rank(size, q[idx / num_slots], interp, idx % num_slots);
+    }
+
+    auto d_input = column_device_view::create(input, stream);
+    auto keys    = radix_select<StorageType>(*d_input, ranks, stream);
+
+    auto q_device =
+      cudf::detail::make_device_uvector_async(q, stream, rmm::mr::get_current_device_resource());
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(output->size()),
+      output->mutable_view().template begin<StorageResult>(),
+      cuda::proclaim_return_type<StorageResult>(
+        [keys = keys.data(), q = q_device.data(), size, num_slots, interp = interp] __device__(
+          size_type idx) {
+          auto const slots            = keys + idx * num_slots;
+          StorageType const values[2] = {from_radix_key<StorageType>(slots[0]),
+                                         from_radix_key<StorageType>(slots[num_slots - 1])};
+          return select_quantile_from_ranks<StorageResult>(values, size, q[idx], interp);
+        }));
+
+    return output;
+  }
+};
+
+std::unique_ptr<column> quantile_by_selection(column_view const& input,
+                                              std::vector<double> const& q,
+                                              interpolation interp,
+                                              bool exact,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(!cudf::is_dictionary(input.type()),
+               "quantile_by_selection does not support dictionary columns",
+               cudf::data_type_error);
+  if (exact) {
+    return type_dispatcher(
+      input.type(), quantile_by_selection_functor<true>{q, interp, stream, mr}, input);
+  }
+  return type_dispatcher(
+    input.type(), quantile_by_selection_functor<false>{q, interp, stream, mr}, input);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> quantile(column_view const& input,
@@ -200,4 +286,14 @@ std::unique_ptr<column> quantile(column_view const& input,
   return detail::quantile(input, q, interp, ordered_indices, exact, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<column> quantile_by_selection(column_view const& input,
+                                              std::vector<double> const& q,
+                                              interpolation interp,
+                                              bool exact,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantile_by_selection(input, q, interp, exact, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
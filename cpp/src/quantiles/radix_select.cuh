@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "quantiles/quantiles_util.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/// Number of key bits selected by each pass of a radix select
+constexpr int radix_select_digit_bits = 8;
+
+/// Number of buckets in the histogram built by each pass of a radix select
+constexpr int radix_select_buckets = 1 << radix_select_digit_bits;
+
+/// Largest number of ranks whose histograms are built in the same pass over the values
+constexpr size_type radix_select_ranks_per_pass = 16;
+
+/// Unsigned integer type holding the radix key of a value of `Size` bytes
+template <std::size_t Size>
+struct radix_key_type;
+template <>
+struct radix_key_type<1> {
+  using type = uint8_t;
+};
+template <>
+struct radix_key_type<2> {
+  using type = uint16_t;
+};
+template <>
+struct radix_key_type<4> {
+  using type = uint32_t;
+};
+template <>
+struct radix_key_type<8> {
+  using type = uint64_t;
+};
+template <>
+struct radix_key_type<16> {
+  using type = __uint128_t;
+};
+
+template <typename T>
+using radix_key_t = typename radix_key_type<sizeof(T)>::type;
+
+/**
+ * @brief Maps a value to an unsigned key whose order is the ascending order of the values
+ *
+ * All NaNs map to the same key which is greater than that of any other value, matching
+ * the order used when sorting.
+ */
+template <typename T>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  using Key           = radix_key_t<T>;
+  auto constexpr sign = static_cast<Key>(Key{1} << (sizeof(Key) * 8 - 1));
+  if constexpr (cuda::std::is_floating_point_v<T>) {
+    if (isnan(value)) { value = cuda::std::numeric_limits<T>::quiet_NaN(); }
+    Key bits;
+    memcpy(&bits, &value, sizeof(T));
+    return (bits & sign) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign);
+  } else if constexpr (cuda::std::is_signed_v<T>) {
+    return static_cast<Key>(static_cast<Key>(value) ^ sign);
+  } else {
+    return static_cast<Key>(value);
+  }
+}
+
+/**
+ * @brief Inverse of `to_radix_key`
+ */
+template <typename T>
+__device__ inline T from_radix_key(radix_key_t<T> key)
+{
+  using Key           = radix_key_t<T>;
+  auto constexpr sign = static_cast<Key>(Key{1} << (sizeof(Key) * 8 - 1));
+  if constexpr (cuda::std::is_floating_point_v<T>) {
+    Key const bits = (key & sign) ? static_cast<Key>(key ^ sign) : static_cast<Key>(~key);
+    T value;
+    memcpy(&value, &bits, sizeof(T));
+    return value;
+  } else if constexpr (cuda::std::is_signed_v<T>) {
+    return static_cast<T>(static_cast<Key>(key ^ sign));
+  } else {
+    return static_cast<T>(key);
+  }
+}
+
+/**
+ * @brief Returns the digit of `key` selected by the pass starting at bit `shift`
+ */
+template <typename Key>
+__device__ inline int radix_digit(Key key, int shift)
+{
+  return static_cast<int>((key >> shift) & (radix_select_buckets - 1));
+}
+
+/**
+ * @brief Returns true if `key` has the bits of `prefix` selected by the passes before the
+ * pass starting at bit `shift`
+ */
+template <typename Key>
+__device__ inline bool matches_radix_prefix(Key key, Key prefix, int shift)
+{
+  auto const high = shift + radix_select_digit_bits;
+  return high >= static_cast<int>(sizeof(Key) * 8) || (key >> high) == (prefix >> high);
+}
+
+/**
+ * @brief Appends the digit holding the key of position `rank` to `prefix`
+ *
+ * @param histogram Number of keys matching `prefix` with each digit
+ * @param shift First bit of the digit
+ * @param prefix Bits of the key selected so far
+ * @param rank Position of the key among the keys matching `prefix`; updated to its position
+ *        among the keys matching the new prefix
+ */
+template <typename Key>
+__device__ inline void select_radix_digit(size_type const* histogram,
+                                          int shift,
+                                          Key& prefix,
+                                          size_type& rank)
+{
+  for (int digit = 0; digit < radix_select_buckets; ++digit) {
+    if (rank < histogram[digit]) {
+      prefix = static_cast<Key>(prefix | (static_cast<Key>(digit) << shift));
+      return;
+    }
+    rank -= histogram[digit];
+  }
+}
+
+/**
+ * @brief Returns the number of ranks selected to compute each quantile
+ */
+CUDF_HOST_DEVICE inline size_type ranks_per_quantile(interpolation interp)
+{
+  return interp == interpolation::LINEAR || interp == interpolation::MIDPOINT ? 2 : 1;
+}
+
+/**
+ * @brief Returns the sorted position of the `slot`-th value used to compute quantile `q`
+ * of `size` values
+ */
+CUDF_HOST_DEVICE inline size_type quantile_rank(size_type size,
+                                                double q,
+                                                interpolation interp,
+                                                size_type slot)
+{
+  quantile_index const idx(size, q);
+  switch (interp) {
+    case interpolation::HIGHER: return idx.higher;
+    case interpolation::NEAREST: return idx.nearest;
+    case interpolation::LOWER: return idx.lower;
+    default: return slot == 0 ? idx.lower : idx.higher;
+  }
+}
+
+/**
+ * @brief Stands in for the sorted values when computing a quantile from the selected values
+ *
+ * Only the sorted positions read by `select_quantile_data` are ever requested.
+ */
+template <typename T>
+struct selected_quantile_values_fn {
+  size_type lower;  ///< sorted position of `lower_value`
+  T lower_value;
+  T higher_value;
+
+  __device__ T operator()(size_type idx) const { return idx == lower ? lower_value : higher_value; }
+};
+
+/**
+ * @brief Computes quantile `q` of `size` values from the values selected for its ranks
+ *
+ * @param selected The values at the `ranks_per_quantile(interp)` ranks of `q`
+ */
+template <typename Result, typename T>
+__device__ inline Result select_quantile_from_ranks(T const* selected,
+                                                    size_type size,
+                                                    double q,
+                                                    interpolation interp)
+{
+  auto const higher = selected[ranks_per_quantile(interp) - 1];
+  auto const values = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    selected_quantile_values_fn<T>{quantile_rank(size, q, interp, 0), selected[0], higher});
+  return select_quantile_data<Result>(values, size, q, interp);
+}
+
+/**
+ * @brief Builds the histograms of the keys of the valid values of `input` which match the
+ * prefix of each rank
+ *
+ * Each block accumulates its histograms in shared memory before adding them to `histograms`.
+ */
+template <typename T>
+CUDF_KERNEL void radix_select_histogram_kernel(column_device_view input,
+                                               radix_key_t<T> const* prefixes,
+                                               size_type num_ranks,
+                                               int shift,
+                                               size_type* histograms)
+{
+  extern __shared__ size_type block_histograms[];
+  auto const num_buckets = num_ranks * radix_select_buckets;
+  for (auto idx = static_cast<size_type>(threadIdx.x); idx < num_buckets; idx += blockDim.x) {
+    block_histograms[idx] = 0;
+  }
+  __syncthreads();
+
+  auto const stride = grid_1d::grid_stride();
+  for (auto idx = grid_1d::global_thread_id(); idx < input.size(); idx += stride) {
+    if (input.is_null(idx)) { continue; }
+    auto const key   = to_radix_key(input.element<T>(idx));
+    auto const digit = radix_digit(key, shift);
+    for (size_type rank = 0; rank < num_ranks; ++rank) {
+      if (matches_radix_prefix(key, prefixes[rank], shift)) {
+        atomicAdd(block_histograms + rank * radix_select_buckets + digit, 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (auto idx = static_cast<size_type>(threadIdx.x); idx < num_buckets; idx += blockDim.x) {
+    if (block_histograms[idx] != 0) { atomicAdd(histograms + idx, block_histograms[idx]); }
+  }
+}
+
+/**
+ * @brief Appends the selected digit of each rank to its prefix
+ */
+template <typename Key>
+struct select_radix_digit_fn {
+  size_type const* histograms;
+  int shift;
+  Key* prefixes;
+  size_type* ranks;
+
+  __device__ void operator()(size_type idx) const
+  {
+    select_radix_digit(histograms + idx * radix_select_buckets, shift, prefixes[idx], ranks[idx]);
+  }
+};
+
+/**
+ * @brief Returns the radix keys of the values at the given sorted positions among the valid
+ * values of `input`, without sorting `input`
+ *
+ * Each pass over `input` selects the next `radix_select_digit_bits` bits of the keys of up to
+ * `radix_select_ranks_per_pass` ranks, so `sizeof(T)` passes select the keys of those ranks.
+ *
+ * @param input The values to select from
+ * @param ranks Sorted positions of the values to select; each must be less than the number of
+ *        valid values of `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The radix key of the value at each position of `ranks`
+ */
+template <typename T>
+rmm::device_uvector<radix_key_t<T>> radix_select(column_device_view const& input,
+                                                 std::vector<size_type> const& ranks,
+                                                 rmm::cuda_stream_view stream)
+{
+  using Key            = radix_key_t<T>;
+  auto const num_ranks = static_cast<size_type>(ranks.size());
+
+  auto d_ranks = cudf::detail::make_device_uvector_async(
+    ranks, stream, rmm::mr::get_current_device_resource());
+  auto prefixes = rmm::device_uvector<Key>(num_ranks, stream);
+  thrust::fill(rmm::exec_policy_nosync(stream), prefixes.begin(), prefixes.end(), Key{0});
+  if (num_ranks == 0 || input.size() == 0) { return prefixes; }
+
+  auto const max_ranks = std::min(num_ranks, radix_select_ranks_per_pass);
+  auto histograms      = rmm::device_uvector<size_type>(max_ranks * radix_select_buckets, stream);
+
+  auto constexpr block_size          = 256;
+  auto constexpr elements_per_thread = 16;
+  grid_1d const grid{input.size(), block_size, elements_per_thread};
+
+  for (size_type first = 0; first < num_ranks; first += radix_select_ranks_per_pass) {
+    auto const batch_ranks      = std::min(num_ranks - first, radix_select_ranks_per_pass);
+    auto const histograms_bytes = batch_ranks * radix_select_buckets * sizeof(size_type);
+    auto constexpr first_shift  = static_cast<int>(sizeof(Key) * 8) - radix_select_digit_bits;
+    for (int shift = first_shift; shift >= 0; shift -= radix_select_digit_bits) {
+      CUDF_CUDA_TRY(cudaMemsetAsync(histograms.data(), 0, histograms_bytes, stream.value()));
+      radix_select_histogram_kernel<T>
+        <<<grid.num_blocks, grid.num_threads_per_block, histograms_bytes, stream.value()>>>(
+          input, prefixes.data() + first, batch_ranks, shift, histograms.data());
+      thrust::for_each_n(
+        rmm::exec_policy_nosync(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        batch_ranks,
+        select_radix_digit_fn<Key>{
+          histograms.data(), shift, prefixes.data() + first, d_ranks.data() + first});
+    }
+  }
+  return prefixes;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -25,6 +25,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/lists_column_view.hpp>
@@ -55,6 +56,8 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <stdexcept>
+
 namespace cudf {
 namespace tdigest {
 namespace detail {
@@ -1209,13 +1212,19 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
 
 }  // anonymous namespace
 
-std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
-                                       int max_centroids,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::device_async_resource_ref mr)
-{
-  if (col.size() == 0) { return cudf::tdigest::detail::make_empty_tdigest_scalar(stream, mr); }
+namespace {
+
+// inputs with more rows than this are reduced through sorted buffers instead of a full sort
+constexpr size_type buffered_reduce_threshold = 1 << 24;
 
+// number of rows in each buffer of the buffered reduction
+constexpr size_type reduce_buffer_size = 1 << 16;
+
+std::unique_ptr<scalar> sorted_reduce_tdigest(column_view const& col,
+                                              int max_centroids,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
   // since this isn't coming out of a groupby, we need to sort the inputs in ascending
   // order with nulls at the end.
   table_view t({col});
@@ -1227,6 +1236,89 @@ std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
     col.type(), typed_reduce_tdigest{}, sorted->get_column(0), delta, stream, mr);
 }
 
+}  // anonymous namespace
+
+std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  if (col.size() == 0) { return cudf::tdigest::detail::make_empty_tdigest_scalar(stream, mr); }
+
+  if (col.size() > buffered_reduce_threshold) {
+    return reduce_tdigest_buffered(col, max_centroids, reduce_buffer_size, stream, mr);
+  }
+  return sorted_reduce_tdigest(col, max_centroids, stream, mr);
+}
+
+std::unique_ptr<scalar> reduce_tdigest_buffered(column_view const& col,
+                                                int max_centroids,
+                                                size_type buffer_size,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(buffer_size > 0, "The buffer size must be positive", std::invalid_argument);
+  if (col.size() == 0) { return cudf::tdigest::detail::make_empty_tdigest_scalar(stream, mr); }
+
+  // nulls do not contribute to the digest so the buffers only hold the valid rows
+  auto const valid_rows =
+    col.has_nulls() ? cudf::detail::drop_nulls(
+                        table_view{{col}}, {0}, 1, stream, rmm::mr::get_current_device_resource())
+                    : nullptr;
+  auto const input    = valid_rows ? valid_rows->get_column(0).view() : col;
+  auto const num_rows = input.size();
+  if (num_rows <= buffer_size) { return sorted_reduce_tdigest(col, max_centroids, stream, mr); }
+
+  // split the rows into buffers which are sorted independently of each other
+  auto const num_buffers =
+    static_cast<size_type>((static_cast<int64_t>(num_rows) + buffer_size - 1) / buffer_size);
+  auto buffer_offsets = rmm::device_uvector<size_type>(num_buffers + 1, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_buffers + 1),
+                    buffer_offsets.begin(),
+                    cuda::proclaim_return_type<size_type>(
+                      [num_rows, buffer_size] __device__(size_type idx) {
+                        return static_cast<size_type>(
+                          min(static_cast<int64_t>(idx) * buffer_size, int64_t{num_rows}));
+                      }));
+  auto buffer_labels = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_rows),
+                    buffer_labels.begin(),
+                    cuda::proclaim_return_type<size_type>(
+                      [buffer_size] __device__(size_type idx) { return idx / buffer_size; }));
+  auto buffer_sizes = rmm::device_uvector<size_type>(num_buffers, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    buffer_offsets.begin() + 1,
+                    buffer_offsets.end(),
+                    buffer_offsets.begin(),
+                    buffer_sizes.begin(),
+                    thrust::minus<size_type>{});
+
+  auto const offsets_view = column_view(
+    data_type{type_id::INT32}, num_buffers + 1, buffer_offsets.data(), nullptr, 0);
+  auto const sorted = cudf::detail::segmented_sort_by_key(table_view{{input}},
+                                                          table_view{{input}},
+                                                          offsets_view,
+                                                          {order::ASCENDING},
+                                                          {null_order::AFTER},
+                                                          stream,
+                                                          rmm::mr::get_current_device_resource());
+
+  // compress each buffer into its own digest and merge those into the result
+  auto const buffer_digests = group_tdigest(sorted->get_column(0).view(),
+                                            buffer_offsets,
+                                            buffer_labels,
+                                            buffer_sizes,
+                                            num_buffers,
+                                            max_centroids,
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+  return reduce_merge_tdigest(buffer_digests->view(), max_centroids, stream, mr);
+}
+
 struct group_offsets_fn {
   size_type const size;
   CUDF_HOST_DEVICE size_type operator()(size_type i) const { return i == 0 ? 0 : size; }
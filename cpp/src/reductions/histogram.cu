@@ -220,6 +220,7 @@ compute_row_frequencies(table_view const& input,
     reduce_func_builder<histogram_count_type>{
       partial_counts ? partial_counts.value().begin<histogram_count_type>() : nullptr},
     histogram_count_type{0},
+    nullptr,
     stream,
     rmm::mr::get_current_device_resource());
 
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
+#include <cudf/reduction/detail/reduction_functions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/atomic>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/tabulate.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace cudf::reduction::detail {
+
+namespace {
+
+// Seed of the 64-bit xxhash of the values. Sketches are only mergeable if they use the same seed.
+constexpr uint64_t hllpp_hash_seed = 0;
+
+void expects_valid_precision(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HyperLogLog precision must be in the range [4, 18]",
+               std::invalid_argument);
+}
+
+/**
+ * @brief Raises the INT8 register at `index` to `rank` if it is lower
+ *
+ * There is no atomic max of single bytes, so the 4-byte word holding the register is updated by
+ * compare-and-swap. The register buffer must be 4-byte aligned.
+ */
+__device__ void atomic_max_register(int8_t* registers, int64_t index, int8_t rank)
+{
+  // Registers only grow, so a stale read that is already high enough is final
+  if (registers[index] >= rank) { return; }
+  auto const word  = reinterpret_cast<uint32_t*>(registers + (index & ~int64_t{3}));
+  auto const shift = static_cast<uint32_t>(index & 3) * 8;
+  cuda::atomic_ref<uint32_t, cuda::thread_scope_device> ref{*word};
+  auto old = ref.load(cuda::std::memory_order_relaxed);
+  while (static_cast<int8_t>((old >> shift) & 0xffu) < rank) {
+    auto const desired =
+      (old & ~(0xffu << shift)) | (static_cast<uint32_t>(static_cast<uint8_t>(rank)) << shift);
+    if (ref.compare_exchange_weak(old, desired, cuda::std::memory_order_relaxed)) { return; }
+  }
+}
+
+/**
+ * @brief Raises the register of the hash of each non-null value to the rank of the hash
+ *
+ * The first `precision` bits of the hash select the register of the value's group, and the rank
+ * is 1 + the number of leading zeros of the remaining `64 - precision` bits.
+ */
+struct update_registers_fn {
+  uint64_t const* hashes;
+  bitmask_type const* null_mask;  ///< Null mask of the values, or nullptr if there are no nulls
+  size_type offset;               ///< Offset of the values in `null_mask`
+  size_type const* group_labels;  ///< Group of each value, or nullptr if all are in group 0
+  int precision;
+  int8_t* registers;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (null_mask != nullptr and not cudf::bit_is_set(null_mask, row + offset)) { return; }
+    auto const hash  = hashes[row];
+    auto const rest  = hash << precision;
+    auto const rank  = rest == 0 ? 64 - precision + 1 : __clzll(rest) + 1;
+    auto const group = group_labels == nullptr ? 0 : group_labels[row];
+    auto const index =
+      (static_cast<int64_t>(group) << precision) + static_cast<int64_t>(hash >> (64 - precision));
+    atomic_max_register(registers, index, static_cast<int8_t>(rank));
+  }
+};
+
+/**
+ * @brief Raises each register of each group to the maximum of that register over its sketches
+ */
+struct merge_registers_fn {
+  bitmask_type const* null_mask;  ///< Null mask of the sketches, or nullptr if there are no nulls
+  size_type offset;               ///< Offset of the sketches in `null_mask`
+  size_type const* list_offsets;
+  int8_t const* input;
+  size_type const* group_labels;  ///< Group of each sketch, or nullptr if all are in group 0
+  int precision;
+  int8_t* registers;
+
+  __device__ void operator()(int64_t idx) const
+  {
+    auto const row = static_cast<size_type>(idx >> precision);
+    if (null_mask != nullptr and not cudf::bit_is_set(null_mask, row + offset)) { return; }
+    auto const reg   = idx & ((int64_t{1} << precision) - 1);
+    auto const value = input[list_offsets[row] + reg];
+    if (value == 0) { return; }
+    auto const group = group_labels == nullptr ? 0 : group_labels[row];
+    atomic_max_register(registers, (static_cast<int64_t>(group) << precision) + reg, value);
+  }
+};
+
+/**
+ * @brief Returns a lists column of `num_groups` sketches with all registers zero
+ */
+std::unique_ptr<column> make_zeroed_sketches(size_type num_groups,
+                                             int precision,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  auto const num_registers = size_type{1} << precision;
+  CUDF_EXPECTS(num_groups <= std::numeric_limits<size_type>::max() / num_registers,
+               "Size of the HyperLogLog sketches exceeds the column size limit",
+               std::overflow_error);
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   offsets->mutable_view().begin<size_type>(),
+                   offsets->mutable_view().end<size_type>(),
+                   [num_registers] __device__(size_type i) { return i * num_registers; });
+
+  auto registers = make_numeric_column(
+    data_type{type_id::INT8}, num_groups * num_registers, mask_state::UNALLOCATED, stream, mr);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    registers->mutable_view().data<int8_t>(), 0, registers->size(), stream.value()));
+
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(registers), 0, rmm::device_buffer{}, stream, mr);
+}
+
+/**
+ * @brief Returns true if every non-null sketch has `2^precision` INT8 registers
+ */
+bool has_valid_sketches(lists_column_view const& sketches,
+                        int precision,
+                        rmm::cuda_stream_view stream)
+{
+  if (sketches.child().type().id() != type_id::INT8) { return false; }
+  auto const null_mask     = sketches.null_mask();
+  auto const offset        = sketches.offset();
+  auto const list_offsets  = sketches.offsets_begin();
+  auto const num_registers = size_type{1} << precision;
+  return thrust::all_of(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(sketches.size()),
+    [null_mask, offset, list_offsets, num_registers] __device__(size_type row) {
+      return (null_mask != nullptr and not cudf::bit_is_set(null_mask, row + offset)) or
+             list_offsets[row + 1] - list_offsets[row] == num_registers;
+    });
+}
+
+/**
+ * @brief Returns `sigma(x)` of Ertl's estimator, the correction for the zero registers
+ */
+__device__ double hllpp_sigma(double x)
+{
+  if (x == 1.0) { return std::numeric_limits<double>::infinity(); }
+  double y = 1.0;
+  double z = x;
+  double z_prev;
+  do {
+    x *= x;
+    z_prev = z;
+    z += x * y;
+    y += y;
+  } while (z != z_prev);
+  return z;
+}
+
+/**
+ * @brief Returns `tau(x)` of Ertl's estimator, the correction for the saturated registers
+ */
+__device__ double hllpp_tau(double x)
+{
+  if (x == 0.0 or x == 1.0) { return 0.0; }
+  double y = 1.0;
+  double z = 1.0 - x;
+  double z_prev;
+  do {
+    x      = sqrt(x);
+    z_prev = z;
+    y *= 0.5;
+    z -= (1.0 - x) * (1.0 - x) * y;
+  } while (z != z_prev);
+  return z / 3.0;
+}
+
+/**
+ * @brief Estimates the distinct count of each sketch from the histogram of its register values
+ *
+ * This is the improved raw estimator of Ertl, "New cardinality estimation algorithms for
+ * HyperLogLog sketches" (2017), which is accurate for small and large cardinalities alike.
+ */
+struct estimate_fn {
+  bitmask_type const* null_mask;
+  size_type offset;
+  size_type const* list_offsets;
+  int8_t const* registers;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    if (null_mask != nullptr and not cudf::bit_is_set(null_mask, row + offset)) { return 0; }
+    auto const begin         = list_offsets[row];
+    auto const num_registers = list_offsets[row + 1] - begin;
+    auto const precision     = 31 - __clz(num_registers);
+    auto const q             = 64 - precision;
+
+    // Register values are in [0, q + 1]
+    size_type counts[64 - 4 + 2] = {0};
+    for (size_type i = 0; i < num_registers; ++i) {
+      counts[min(max(static_cast<int>(registers[begin + i]), 0), q + 1)]++;
+    }
+
+    auto const m = static_cast<double>(num_registers);
+    double z     = m * hllpp_tau(1.0 - counts[q + 1] / m);
+    for (int k = q; k >= 1; --k) {
+      z = 0.5 * (z + counts[k]);
+    }
+    z += m * hllpp_sigma(counts[0] / m);
+    auto constexpr alpha_inf = 0.7213475204444817;  // 1 / (2 ln 2)
+    return llround(alpha_inf * m * m / z);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_hllpp(column_view const& values,
+                                    device_span<size_type const> group_labels,
+                                    size_type num_groups,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  expects_valid_precision(precision);
+  CUDF_EXPECTS(not cudf::is_nested(values.type()),
+               "HLLPP aggregation does not support nested types",
+               std::invalid_argument);
+  CUDF_EXPECTS(group_labels.empty() or group_labels.size() == static_cast<size_t>(values.size()),
+               "Size of values column should be the same as that of group labels.",
+               std::invalid_argument);
+
+  auto sketches = make_zeroed_sketches(num_groups, precision, stream, mr);
+  if (values.size() == values.null_count()) { return sketches; }
+
+  auto const hashes = cudf::hashing::detail::xxhash_64(
+    table_view{{values}}, hllpp_hash_seed, stream, rmm::mr::get_current_device_resource());
+  auto registers =
+    sketches->mutable_view().child(lists_column_view::child_column_index).data<int8_t>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    values.size(),
+    update_registers_fn{hashes->view().data<uint64_t>(),
+                        values.nullable() ? values.null_mask() : nullptr,
+                        values.offset(),
+                        group_labels.empty() ? nullptr : group_labels.data(),
+                        precision,
+                        registers});
+  return sketches;
+}
+
+std::unique_ptr<column> group_merge_hllpp(column_view const& sketches,
+                                          device_span<size_type const> group_labels,
+                                          size_type num_groups,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  expects_valid_precision(precision);
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST,
+               "The input of MERGE_HLLPP aggregation must be a lists column.",
+               std::invalid_argument);
+  CUDF_EXPECTS(group_labels.empty() or group_labels.size() == static_cast<size_t>(sketches.size()),
+               "Size of sketches column should be the same as that of group labels.",
+               std::invalid_argument);
+  auto const input = lists_column_view{sketches};
+  CUDF_EXPECTS(has_valid_sketches(input, precision, stream),
+               "The input of MERGE_HLLPP aggregation must be sketches of the given precision.",
+               std::invalid_argument);
+
+  auto output = make_zeroed_sketches(num_groups, precision, stream, mr);
+  if (sketches.size() == sketches.null_count()) { return output; }
+
+  auto registers =
+    output->mutable_view().child(lists_column_view::child_column_index).data<int8_t>();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<int64_t>(0),
+                     static_cast<int64_t>(sketches.size()) << precision,
+                     merge_registers_fn{sketches.nullable() ? sketches.null_mask() : nullptr,
+                                        sketches.offset(),
+                                        input.offsets_begin(),
+                                        input.child().data<int8_t>(),
+                                        group_labels.empty() ? nullptr : group_labels.data(),
+                                        precision,
+                                        registers});
+  return output;
+}
+
+namespace {
+
+std::unique_ptr<scalar> make_sketch_scalar(std::unique_ptr<column>&& sketches,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto contents = sketches->release();
+  return std::make_unique<list_scalar>(
+    std::move(*contents.children[lists_column_view::child_column_index]), true, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<scalar> hllpp(column_view const& input,
+                              int precision,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  return make_sketch_scalar(group_hllpp(input, {}, 1, precision, stream, mr), stream, mr);
+}
+
+std::unique_ptr<scalar> merge_hllpp(column_view const& input,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  return make_sketch_scalar(group_merge_hllpp(input, {}, 1, precision, stream, mr), stream, mr);
+}
+
+}  // namespace cudf::reduction::detail
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<column> estimate_distinct_count(lists_column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(sketches.child().type().id() == type_id::INT8,
+               "HyperLogLog sketches must be lists of INT8 registers",
+               std::invalid_argument);
+  auto const null_mask    = sketches.null_mask();
+  auto const offset       = sketches.offset();
+  auto const list_offsets = sketches.offsets_begin();
+  CUDF_EXPECTS(
+    thrust::all_of(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(sketches.size()),
+                   [null_mask, offset, list_offsets] __device__(size_type row) {
+                     if (null_mask != nullptr and not cudf::bit_is_set(null_mask, row + offset)) {
+                       return true;
+                     }
+                     auto const size = list_offsets[row + 1] - list_offsets[row];
+                     return size >= (1 << 4) and size <= (1 << 18) and (size & (size - 1)) == 0;
+                   }),
+    "HyperLogLog sketches must have 2^precision registers for a precision in [4, 18]",
+    std::invalid_argument);
+
+  auto result = make_numeric_column(data_type{type_to_id<int64_t>()},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches.parent(), stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   result->mutable_view().begin<int64_t>(),
+                   result->mutable_view().end<int64_t>(),
+                   reduction::detail::estimate_fn{
+                     null_mask, offset, list_offsets, sketches.child().data<int8_t>()});
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> estimate_distinct_count(lists_column_view const& sketches,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_distinct_count(sketches, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
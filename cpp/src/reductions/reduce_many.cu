@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+/**
+ * @brief Partial results of all the aggregations computed by the fused reduction
+ *
+ * The sums are accumulated in the same types as the individual reductions use so the
+ * fused results match those of `reduce`.
+ *
+ * @tparam T Type of the input elements
+ */
+template <typename T>
+struct fused_moments {
+  using SumType = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+
+  SumType sum;                   ///< sum as computed by SUM
+  SumType sum_of_squares;        ///< sum of squares as computed by SUM_OF_SQUARES
+  double double_sum;             ///< sum as computed by MEAN, VARIANCE and STD
+  double double_sum_of_squares;  ///< sum of squares as computed by VARIANCE and STD
+  T min;                         ///< minimum as computed by MIN
+  T max;                         ///< maximum as computed by MAX
+
+  CUDF_HOST_DEVICE static fused_moments identity()
+  {
+    return fused_moments{
+      0, 0, 0.0, 0.0, cudf::DeviceMin::identity<T>(), cudf::DeviceMax::identity<T>()};
+  }
+};
+
+/**
+ * @brief Converts an input element, or a null element, into its fused partial results
+ */
+template <typename T>
+struct make_fused_moments_fn {
+  using SumType = typename fused_moments<T>::SumType;
+
+  __device__ fused_moments<T> operator()(T value) const
+  {
+    auto const sum    = static_cast<SumType>(value);
+    auto const dvalue = static_cast<double>(value);
+    return fused_moments<T>{sum, sum * sum, dvalue, dvalue * dvalue, value, value};
+  }
+
+  __device__ fused_moments<T> operator()(thrust::pair<T, bool> const& element) const
+  {
+    return element.second ? (*this)(element.first) : fused_moments<T>::identity();
+  }
+};
+
+/**
+ * @brief Combines two fused partial results
+ */
+template <typename T>
+struct combine_fused_moments_fn {
+  __device__ fused_moments<T> operator()(fused_moments<T> const& lhs,
+                                         fused_moments<T> const& rhs) const
+  {
+    return fused_moments<T>{lhs.sum + rhs.sum,
+                            lhs.sum_of_squares + rhs.sum_of_squares,
+                            lhs.double_sum + rhs.double_sum,
+                            lhs.double_sum_of_squares + rhs.double_sum_of_squares,
+                            cudf::DeviceMin{}(lhs.min, rhs.min),
+                            cudf::DeviceMax{}(lhs.max, rhs.max)};
+  }
+};
+
+/**
+ * @brief Creates a valid numeric scalar of the dispatched type holding `value`
+ */
+template <typename Source>
+struct make_numeric_scalar_fn {
+  template <typename Target, std::enable_if_t<cudf::is_numeric<Target>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source value,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    return std::make_unique<numeric_scalar<Target>>(
+      static_cast<Target>(value), true, stream, mr);
+  }
+
+  template <typename Target, std::enable_if_t<not cudf::is_numeric<Target>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref)
+  {
+    CUDF_FAIL("input data type is not convertible to output data type");
+  }
+};
+
+/**
+ * @brief Computes all the fusable aggregations of a column with a single reduction
+ *
+ * Entries of `results` for aggregations that cannot be fused are left empty.
+ */
+struct fused_reduction_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+  }
+
+  /**
+   * @brief Returns true if the fused result of `kind` matches the one of `reduce`
+   */
+  template <typename T>
+  static bool can_fuse(aggregation::Kind kind, data_type output_dtype)
+  {
+    switch (kind) {
+      // integer sums wrap around the same way in any integer type; floating-point
+      // sums only match if `reduce` also accumulates them as doubles
+      case aggregation::SUM:
+      case aggregation::SUM_OF_SQUARES:
+        return cudf::is_numeric(output_dtype) &&
+               (std::is_integral_v<T> || std::is_same_v<T, double> ||
+                output_dtype.id() != type_to_id<T>());
+      case aggregation::MIN:
+      case aggregation::MAX: return output_dtype.id() == type_to_id<T>();
+      case aggregation::MEAN:
+      case aggregation::VARIANCE:
+      case aggregation::STD: return output_dtype.id() == type_id::FLOAT64;
+      default: return false;
+    }
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(column_view const& col,
+                  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                  host_span<data_type const> output_dtypes,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+  {
+    std::vector<std::size_t> fused;
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      if (can_fuse<T>(aggs[idx]->kind, output_dtypes[idx])) { fused.push_back(idx); }
+    }
+    if (fused.empty()) { return; }
+
+    auto const d_col = column_device_view::create(col, stream);
+    auto const moments =
+      col.has_nulls()
+        ? thrust::reduce(rmm::exec_policy(stream),
+                         thrust::make_transform_iterator(d_col->pair_begin<T, true>(),
+                                                         make_fused_moments_fn<T>{}),
+                         thrust::make_transform_iterator(d_col->pair_end<T, true>(),
+                                                         make_fused_moments_fn<T>{}),
+                         fused_moments<T>::identity(),
+                         combine_fused_moments_fn<T>{})
+        : thrust::reduce(
+            rmm::exec_policy(stream),
+            thrust::make_transform_iterator(d_col->begin<T>(), make_fused_moments_fn<T>{}),
+            thrust::make_transform_iterator(d_col->end<T>(), make_fused_moments_fn<T>{}),
+            fused_moments<T>::identity(),
+            combine_fused_moments_fn<T>{});
+
+    using SumType          = typename fused_moments<T>::SumType;
+    auto const valid_count = col.size() - col.null_count();
+    // same arithmetic as `op::variance::intermediate::compute_result`
+    auto const variance = [&](size_type ddof) {
+      double const mean   = moments.double_sum / valid_count;
+      size_type const div = valid_count - ddof;
+      return moments.double_sum_of_squares / div - ((mean * mean) * valid_count) / div;
+    };
+
+    for (auto const idx : fused) {
+      auto const& agg = *aggs[idx];
+      auto& result    = results[idx];
+      switch (agg.kind) {
+        case aggregation::SUM:
+          result = type_dispatcher(
+            output_dtypes[idx], make_numeric_scalar_fn<SumType>{}, moments.sum, stream, mr);
+          break;
+        case aggregation::SUM_OF_SQUARES:
+          result = type_dispatcher(output_dtypes[idx],
+                                   make_numeric_scalar_fn<SumType>{},
+                                   moments.sum_of_squares,
+                                   stream,
+                                   mr);
+          break;
+        case aggregation::MIN:
+          result = std::make_unique<numeric_scalar<T>>(moments.min, true, stream, mr);
+          break;
+        case aggregation::MAX:
+          result = std::make_unique<numeric_scalar<T>>(moments.max, true, stream, mr);
+          break;
+        case aggregation::MEAN:
+          result = std::make_unique<numeric_scalar<double>>(
+            moments.double_sum / valid_count, true, stream, mr);
+          break;
+        case aggregation::VARIANCE: {
+          auto const ddof = static_cast<cudf::detail::var_aggregation const&>(agg)._ddof;
+          result          = std::make_unique<numeric_scalar<double>>(
+            variance(ddof), true, stream, mr);
+          break;
+        }
+        case aggregation::STD: {
+          auto const ddof = static_cast<cudf::detail::std_aggregation const&>(agg)._ddof;
+          result          = std::make_unique<numeric_scalar<double>>(
+            std::sqrt(variance(ddof)), true, stream, mr);
+          break;
+        }
+        default: CUDF_FAIL("Unexpected fused reduction");
+      }
+    }
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  host_span<std::unique_ptr<reduce_aggregation> const>,
+                  host_span<data_type const>,
+                  std::vector<std::unique_ptr<scalar>>&,
+                  rmm::cuda_stream_view,
+                  rmm::device_async_resource_ref)
+  {
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce_many(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Each aggregation requires an output type",
+               std::invalid_argument);
+  CUDF_EXPECTS(std::all_of(aggs.begin(), aggs.end(), [](auto const& agg) { return agg; }),
+               "Aggregations must not be null",
+               std::invalid_argument);
+
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  // empty and all-null columns only produce default scalars which `reduce` makes without
+  // reading the column
+  if (col.size() > col.null_count()) {
+    type_dispatcher(
+      col.type(), fused_reduction_fn{}, col, aggs, output_dtypes, results, stream, mr);
+  }
+  for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+    if (!results[idx]) {
+      results[idx] = reduce(col, *aggs[idx], output_dtypes[idx], std::nullopt, stream, mr);
+    }
+  }
+  return results;
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_many(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  std::vector<std::vector<std::unique_ptr<scalar>>> results;
+  results.reserve(input.num_columns());
+  for (auto const& col : input) {
+    std::vector<data_type> output_dtypes;
+    output_dtypes.reserve(aggs.size());
+    for (auto const& agg : aggs) {
+      CUDF_EXPECTS(agg != nullptr, "Aggregations must not be null", std::invalid_argument);
+      output_dtypes.push_back(cudf::detail::target_type(col.type(), agg->kind));
+    }
+    results.push_back(reduce_many(col, aggs, output_dtypes, stream, mr));
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace reduction
+
+std::vector<std::unique_ptr<scalar>> reduce_many(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce_many(col, aggs, output_dtypes, stream, mr);
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_many(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce_many(input, aggs, stream, mr);
+}
+
+}  // namespace cudf
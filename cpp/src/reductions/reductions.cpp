@@ -144,6 +144,14 @@ struct reduce_dispatch_functor {
         auto td_agg = static_cast<cudf::detail::merge_tdigest_aggregation const&>(agg);
         return tdigest::detail::reduce_merge_tdigest(col, td_agg.max_centroids, stream, mr);
       }
+      case aggregation::HLLPP: {
+        auto const& hllpp_agg = static_cast<cudf::detail::hllpp_aggregation const&>(agg);
+        return hllpp(col, hllpp_agg.precision, stream, mr);
+      }
+      case aggregation::MERGE_HLLPP: {
+        auto const& hllpp_agg = static_cast<cudf::detail::merge_hllpp_aggregation const&>(agg);
+        return merge_hllpp(col, hllpp_agg.precision, stream, mr);
+      }
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -166,8 +174,10 @@ std::unique_ptr<scalar> reduce(column_view const& col,
       "Initial value is only supported for SUM, PRODUCT, MIN, MAX, ANY, and ALL aggregation types");
   }
 
-  // Returns default scalar if input column is empty or all null
-  if (col.size() <= col.null_count()) {
+  // Returns default scalar if input column is empty or all null.
+  // The sketch of no values is a valid sketch with all registers zero.
+  if (col.size() <= col.null_count() && agg.kind != aggregation::HLLPP &&
+      agg.kind != aggregation::MERGE_HLLPP) {
     if (agg.kind == aggregation::TDIGEST || agg.kind == aggregation::MERGE_TDIGEST) {
       return tdigest::detail::make_empty_tdigest_scalar(stream, mr);
     }
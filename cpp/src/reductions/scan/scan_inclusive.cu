@@ -22,7 +22,6 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
-#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/cast_functor.cuh>
 #include <cudf/reduction.hpp>
 #include <cudf/strings/detail/scan.hpp>
@@ -109,11 +108,11 @@ struct scan_functor<Op, cudf::string_view> {
 template <typename Op>
 struct scan_functor<Op, cudf::struct_view> {
   static std::unique_ptr<column> invoke(column_view const& input,
-                                        bitmask_type const*,
+                                        bitmask_type const* mask,
                                         rmm::cuda_stream_view stream,
                                         rmm::device_async_resource_ref mr)
   {
-    return cudf::structs::detail::scan_inclusive<Op>(input, stream, mr);
+    return cudf::structs::detail::scan_inclusive<Op>(input, mask, stream, mr);
   }
 };
 
@@ -184,27 +183,6 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
     input, agg, static_cast<bitmask_type*>(mask.data()), stream, mr);
   output->set_null_mask(std::move(mask), null_count);
 
-  // If the input is a structs column, we also need to push down nulls from the parent output column
-  // into the children columns.
-  if (input.type().id() == type_id::STRUCT && output->has_nulls()) {
-    auto const num_rows   = output->size();
-    auto const null_count = output->null_count();
-    auto content          = output->release();
-
-    // Build new children columns.
-    auto const null_mask = reinterpret_cast<bitmask_type const*>(content.null_mask->data());
-    std::for_each(content.children.begin(),
-                  content.children.end(),
-                  [null_mask, null_count, stream, mr](auto& child) {
-                    child = structs::detail::superimpose_nulls(
-                      null_mask, null_count, std::move(child), stream, mr);
-                  });
-
-    // Replace the children columns.
-    output = cudf::make_structs_column(
-      num_rows, std::move(content.children), null_count, std::move(*content.null_mask), stream, mr);
-  }
-
   return output;
 }
 }  // namespace detail
@@ -43,8 +43,10 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
@@ -247,6 +249,49 @@ struct replace_nulls_scalar_kernel_forwarder {
   }
 };
 
+/**
+ * @brief Writes the replacement value into the null elements of a column
+ */
+template <typename T>
+struct replace_null_elements_fn {
+  cudf::column_device_view input;
+  T* data;
+  T const* replacement;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (input.is_null_nocheck(idx)) { data[idx] = *replacement; }
+  }
+};
+
+/**
+ * @brief Replaces the null elements of a fixed-width column in place
+ */
+struct replace_nulls_scalar_in_place_fn {
+  template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
+  void operator()(cudf::mutable_column_view& input,
+                  cudf::scalar const& replacement,
+                  rmm::cuda_stream_view stream)
+  {
+    using ScalarType = cudf::scalar_type_t<col_type>;
+    auto& s1         = static_cast<ScalarType const&>(replacement);
+    auto device_in   = cudf::column_device_view::create(input, stream);
+
+    // only the null elements are written, so the valid elements are neither read nor written
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      input.size(),
+      replace_null_elements_fn<col_type>{*device_in, input.data<col_type>(), s1.data()});
+  }
+
+  template <typename col_type, typename... Args>
+  std::enable_if_t<not cudf::is_fixed_width<col_type>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("No in-place specialization exists for the given type.");
+  }
+};
+
 template <>
 std::unique_ptr<cudf::column> replace_nulls_scalar_kernel_forwarder::operator()<cudf::string_view>(
   cudf::column_view const& input,
@@ -346,6 +391,25 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
     input.type(), replace_nulls_scalar_kernel_forwarder{}, input, replacement, stream, mr);
 }
 
+std::unique_ptr<cudf::column> replace_nulls(std::unique_ptr<cudf::column>&& input,
+                                            cudf::scalar const& replacement,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  if (!input->has_nulls() || !replacement.is_valid(stream)) { return std::move(input); }
+  if (!cudf::is_fixed_width(input->type())) {
+    return replace_nulls(input->view(), replacement, stream, mr);
+  }
+  CUDF_EXPECTS(
+    cudf::have_same_types(input->view(), replacement), "Data type mismatch", cudf::data_type_error);
+
+  auto view = input->mutable_view();
+  cudf::type_dispatcher<dispatch_storage_type>(
+    input->type(), replace_nulls_scalar_in_place_fn{}, view, replacement, stream);
+  input->set_null_mask(rmm::device_buffer{}, 0);
+  return std::move(input);
+}
+
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
                                             cudf::replace_policy const& replace_policy,
                                             rmm::cuda_stream_view stream,
@@ -377,6 +441,15 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   return detail::replace_nulls(input, replacement, stream, mr);
 }
 
+std::unique_ptr<cudf::column> replace_nulls(std::unique_ptr<cudf::column>&& input,
+                                            cudf::scalar const& replacement,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_nulls(std::move(input), replacement, stream, mr);
+}
+
 std::unique_ptr<cudf::column> replace_nulls(column_view const& input,
                                             replace_policy const& replace_policy,
                                             rmm::cuda_stream_view stream,
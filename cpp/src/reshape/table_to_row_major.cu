@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Number of rows and of columns of the tiles written through shared memory
+constexpr int row_major_tile_dim = 32;
+
+/// Number of thread rows of a block; each thread writes `row_major_tile_dim / this` elements
+constexpr int row_major_block_rows = 8;
+
+/// Largest number of tiles along the columns of a single kernel launch
+constexpr size_type max_column_tiles_per_launch = 65535;
+
+/**
+ * @brief Reads an element of a numeric column cast to `Out`
+ */
+template <typename Out>
+struct cast_element_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  __device__ Out operator()(column_device_view const& col, size_type row) const
+  {
+    return static_cast<Out>(col.element<T>(row));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_numeric<T>())>
+  __device__ Out operator()(column_device_view const&, size_type) const
+  {
+    CUDF_UNREACHABLE("Only numeric columns can be written to a row-major matrix");
+  }
+};
+
+/**
+ * @brief Writes the tiles of `row_major_tile_dim` rows and columns of the row-major output
+ *
+ * Each warp reads consecutive rows of one input column into shared memory, casting them and
+ * replacing nulls on the way, and then writes consecutive columns of one output row from it,
+ * so both the reads and the writes are coalesced. The type of a column is dispatched once
+ * per warp since all the lanes of a warp read the same column.
+ *
+ * @param input The numeric columns to write
+ * @param null_fill Device value written for null elements
+ * @param first_column First column of the tiles written by this launch
+ * @param output The `input.num_rows()` x `input.num_columns()` row-major output
+ */
+template <typename Out>
+CUDF_KERNEL void table_to_row_major_kernel(table_device_view input,
+                                           Out const* null_fill,
+                                           size_type first_column,
+                                           Out* output)
+{
+  __shared__ Out tile[row_major_tile_dim][row_major_tile_dim + 1];
+
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+
+  auto const row_begin = static_cast<size_type>(blockIdx.x) * row_major_tile_dim;
+  auto const col_begin = first_column + static_cast<size_type>(blockIdx.y) * row_major_tile_dim;
+  auto const lane      = static_cast<int>(threadIdx.x);
+
+  auto const row = row_begin + lane;
+  for (auto i = static_cast<int>(threadIdx.y); i < row_major_tile_dim; i += row_major_block_rows) {
+    auto const col = col_begin + i;
+    if (col < num_columns and row < num_rows) {
+      auto const& column = input.column(col);
+      tile[i][lane]      = column.is_null(row)
+                             ? *null_fill
+                             : type_dispatcher(column.type(), cast_element_fn<Out>{}, column, row);
+    }
+  }
+  __syncthreads();
+
+  auto const col = col_begin + lane;
+  for (auto i = static_cast<int>(threadIdx.y); i < row_major_tile_dim; i += row_major_block_rows) {
+    auto const out_row = row_begin + i;
+    if (col < num_columns and out_row < num_rows) {
+      output[static_cast<std::size_t>(out_row) * num_columns + col] = tile[lane][i];
+    }
+  }
+}
+
+/**
+ * @brief Type dispatched functor writing a table to a row-major matrix of the dispatched type
+ */
+struct table_to_row_major_fn {
+  template <typename Out, CUDF_ENABLE_IF(cudf::is_numeric<Out>())>
+  void operator()(table_view const& input,
+                  scalar const& null_fill,
+                  std::byte* output,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_input     = table_device_view::create(input, stream);
+    auto const d_null_fill = static_cast<numeric_scalar<Out> const&>(null_fill).data();
+    auto const d_output    = reinterpret_cast<Out*>(output);
+
+    auto const row_tiles    = util::div_rounding_up_safe(input.num_rows(), row_major_tile_dim);
+    auto const column_tiles = util::div_rounding_up_safe(input.num_columns(), row_major_tile_dim);
+    dim3 const block(row_major_tile_dim, row_major_block_rows);
+    // very wide tables are written over several launches of at most the maximum grid height
+    for (size_type first_tile = 0; first_tile < column_tiles;
+         first_tile += max_column_tiles_per_launch) {
+      auto const launch_tiles = std::min(column_tiles - first_tile, max_column_tiles_per_launch);
+      dim3 const grid(row_tiles, launch_tiles);
+      table_to_row_major_kernel<Out><<<grid, block, 0, stream.value()>>>(
+        *d_input, d_null_fill, first_tile * row_major_tile_dim, d_output);
+    }
+    CUDF_CHECK_CUDA(stream.value());
+  }
+
+  template <typename Out, typename... Args, CUDF_ENABLE_IF(not cudf::is_numeric<Out>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Output type of a row-major matrix must be numeric", cudf::data_type_error);
+  }
+};
+
+}  // namespace
+
+void table_to_row_major(table_view const& input,
+                        data_type output_type,
+                        scalar const& null_fill,
+                        device_span<std::byte> output,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(cudf::is_numeric(output_type),
+               "Output type of a row-major matrix must be numeric",
+               cudf::data_type_error);
+  CUDF_EXPECTS(null_fill.type() == output_type,
+               "null_fill must have the output type",
+               cudf::data_type_error);
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](column_view const& col) { return cudf::is_numeric(col.type()); }),
+               "Only numeric columns can be written to a row-major matrix",
+               cudf::data_type_error);
+
+  auto const num_elements = static_cast<std::size_t>(input.num_rows()) * input.num_columns();
+  CUDF_EXPECTS(output.size() >= num_elements * size_of(output_type),
+               "Output buffer is too small for the row-major matrix",
+               std::invalid_argument);
+  if (num_elements == 0) { return; }
+  CUDF_EXPECTS(not has_nulls(input) or null_fill.is_valid(stream),
+               "null_fill must be valid when the input has nulls",
+               std::invalid_argument);
+
+  type_dispatcher(output_type, table_to_row_major_fn{}, input, null_fill, output.data(), stream);
+}
+
+}  // namespace detail
+
+void table_to_row_major(table_view const& input,
+                        data_type output_type,
+                        scalar const& null_fill,
+                        device_span<std::byte> output,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::table_to_row_major(input, output_type, null_fill, output, stream);
+}
+
+}  // namespace cudf
@@ -25,6 +25,7 @@
 #include "rolling.hpp"
 #include "rolling_collect_list.cuh"
 #include "rolling_jit.hpp"
+#include "rolling_large_window.cuh"
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column_device_view.cuh>
@@ -70,12 +71,17 @@ namespace detail {
 
 /// Helper function to materialize preceding/following offsets.
 template <typename Calculator>
-std::unique_ptr<column> expand_to_column(Calculator const& calc,
-                                         size_type const& num_rows,
-                                         rmm::cuda_stream_view stream)
+std::unique_ptr<column> expand_to_column(
+  Calculator const& calc,
+  size_type const& num_rows,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource())
 {
-  auto window_column = cudf::make_numeric_column(
-    cudf::data_type{type_to_id<size_type>()}, num_rows, cudf::mask_state::UNALLOCATED, stream);
+  auto window_column = cudf::make_numeric_column(cudf::data_type{type_to_id<size_type>()},
+                                                 num_rows,
+                                                 cudf::mask_state::UNALLOCATED,
+                                                 stream,
+                                                 mr);
 
   auto begin = cudf::detail::make_counting_transform_iterator(0, calc);
 
@@ -1147,6 +1153,33 @@ struct rolling_window_launcher {
       auto const device_op =
         create_rolling_operator<InputType, op>{}(min_periods, comp_generator.binop());
       return do_rolling(device_op);
+    } else if constexpr (is_prefix_sum_window_supported<InputType, op>() ||
+                         is_sparse_table_window_supported<InputType, op>()) {
+      // large windows are aggregated in constant time per row from precomputed tables
+      auto const window_size =
+        max_window_size(preceding_window_begin, following_window_begin, input.size(), stream);
+      if (window_size < large_window_threshold) {
+        return do_rolling(create_rolling_operator<InputType, op>{}(min_periods, agg));
+      }
+
+      auto const d_input      = column_device_view::create(input, stream);
+      auto const valid_counts = input.has_nulls()
+                                  ? make_valid_counts(*d_input, stream)
+                                  : rmm::device_uvector<size_type>(0, stream);
+      if constexpr (op == aggregation::COUNT_VALID) {
+        return do_rolling(
+          DeviceRollingPrefixSum<InputType, op>{min_periods, nullptr, valid_counts.data()});
+      } else if constexpr (is_prefix_sum_window_supported<InputType, op>()) {
+        auto const sums = make_prefix_sums<InputType>(*d_input, stream);
+        return do_rolling(DeviceRollingPrefixSum<InputType, op>{
+          min_periods, sums.data(), valid_counts.data()});
+      } else {
+        using OutType    = device_storage_type_t<target_type_t<InputType, op>>;
+        auto const table = make_sparse_table<InputType, OutType, op>(
+          *d_input, sparse_table_levels(window_size), stream);
+        return do_rolling(DeviceRollingSparseMinMax<OutType, op>{
+          min_periods, table.data(), valid_counts.data(), input.size()});
+      }
     } else {  // all the remaining rolling operations
       auto const device_op = create_rolling_operator<InputType, op>{}(min_periods, agg);
       return do_rolling(device_op);
@@ -1281,10 +1314,9 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                    preceding_window_str.c_str(),
                    following_window_str.c_str());
 
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+  cudf::jit::get_kernel(
+    *rolling_jit_kernel_cu_jit, kernel_name, "rolling/jit/operation-udf.hpp", cuda_source)
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rolling.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Smallest window size (in rows) for which the large window operators are used
+ *
+ * Below this size, aggregating each window directly is cheaper than building the
+ * prefix sums or the sparse table.
+ */
+constexpr size_type large_window_threshold = 64;
+
+/**
+ * @brief Returns true if the aggregation can be computed from prefix sums of the input
+ *
+ * Only integral sums are computed this way since subtracting floating-point prefix sums
+ * loses precision. MEAN is limited to inputs of up to 32 bits so that the window sums
+ * cannot overflow and match the floating-point sum of the direct computation.
+ */
+template <typename InputType, aggregation::Kind op>
+constexpr bool is_prefix_sum_window_supported()
+{
+  if constexpr (!cudf::is_integral_not_bool<InputType>()) {
+    return op == aggregation::COUNT_VALID;
+  } else {
+    return op == aggregation::SUM || op == aggregation::COUNT_VALID ||
+           (op == aggregation::MEAN && sizeof(InputType) <= sizeof(int32_t));
+  }
+}
+
+/**
+ * @brief Returns true if the aggregation can be computed from a sparse table of the input
+ */
+template <typename InputType, aggregation::Kind op>
+constexpr bool is_sparse_table_window_supported()
+{
+  return (op == aggregation::MIN || op == aggregation::MAX) && cudf::is_numeric<InputType>();
+}
+
+/**
+ * @brief Computes the number of rows in the window of each row
+ *
+ * The bounds are clamped the same way as in the `gpu_rolling` kernel.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct window_size_fn {
+  PrecedingWindowIterator preceding_window_begin;
+  FollowingWindowIterator following_window_begin;
+  size_type num_rows;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    int64_t const preceding_window = preceding_window_begin[idx];
+    int64_t const following_window = following_window_begin[idx];
+    auto const start =
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, idx - preceding_window + 1));
+    auto const end =
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, idx + following_window + 1));
+    return static_cast<size_type>(max(start, end) - min(start, end));
+  }
+};
+
+/**
+ * @brief Returns the largest number of rows in any window
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+size_type max_window_size(PrecedingWindowIterator preceding_window_begin,
+                          FollowingWindowIterator following_window_begin,
+                          size_type num_rows,
+                          rmm::cuda_stream_view stream)
+{
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    window_size_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+      preceding_window_begin, following_window_begin, num_rows},
+    size_type{0},
+    thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Builds the running number of valid rows of `input` with a leading zero
+ *
+ * The number of valid rows in `[start, end)` is `counts[end] - counts[start]`.
+ */
+inline rmm::device_uvector<size_type> make_valid_counts(column_device_view const& input,
+                                                        rmm::cuda_stream_view stream)
+{
+  auto counts = rmm::device_uvector<size_type>(input.size() + 1, stream);
+  counts.set_element_to_zero_async(0, stream);
+  auto const is_valid = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<size_type>([input] __device__(size_type idx) {
+      return static_cast<size_type>(input.is_valid(idx));
+    }));
+  thrust::inclusive_scan(
+    rmm::exec_policy_nosync(stream), is_valid, is_valid + input.size(), counts.begin() + 1);
+  return counts;
+}
+
+/**
+ * @brief Builds the running sums of `input` with a leading zero; null rows add nothing
+ *
+ * The sums are unsigned so that overflowing the running sum wraps around and the
+ * difference of two sums is still the sum of the rows in between.
+ */
+template <typename InputType>
+rmm::device_uvector<uint64_t> make_prefix_sums(column_device_view const& input,
+                                               rmm::cuda_stream_view stream)
+{
+  auto sums = rmm::device_uvector<uint64_t>(input.size() + 1, stream);
+  sums.set_element_to_zero_async(0, stream);
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<uint64_t>([input] __device__(size_type idx) {
+      return input.is_valid(idx) ? static_cast<uint64_t>(input.element<InputType>(idx))
+                                 : uint64_t{0};
+    }));
+  thrust::inclusive_scan(
+    rmm::exec_policy_nosync(stream), values, values + input.size(), sums.begin() + 1);
+  return sums;
+}
+
+/**
+ * @brief Builds a sparse table of `input` for the MIN or MAX aggregation
+ *
+ * Level `k` holds the aggregate of the `2^k` rows starting at each row so any window is
+ * covered by two overlapping entries of a single level. Null rows hold the identity
+ * of the aggregation.
+ *
+ * @param input The input column
+ * @param num_levels Number of levels in the table; `2^(num_levels-1)` must not exceed
+ *        the largest window size
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The levels of the table, each with one entry per row
+ */
+template <typename InputType, typename OutputType, aggregation::Kind op>
+rmm::device_uvector<OutputType> make_sparse_table(column_device_view const& input,
+                                                  size_type num_levels,
+                                                  rmm::cuda_stream_view stream)
+{
+  using AggOp         = typename corresponding_operator<op>::type;
+  auto const num_rows = input.size();
+  auto table = rmm::device_uvector<OutputType>(static_cast<std::size_t>(num_rows) * num_levels,
+                                               stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_rows),
+                    table.begin(),
+                    cuda::proclaim_return_type<OutputType>([input] __device__(size_type idx) {
+                      return input.is_valid(idx)
+                               ? static_cast<OutputType>(
+                                   input.element<device_storage_type_t<InputType>>(idx))
+                               : AggOp::template identity<OutputType>();
+                    }));
+  for (size_type level = 1; level < num_levels; ++level) {
+    auto const prev = table.data() + static_cast<std::size_t>(level - 1) * num_rows;
+    auto const half = size_type{1} << (level - 1);
+    // entries extending past the last row are never read by a window
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(num_rows),
+                      prev + num_rows,
+                      cuda::proclaim_return_type<OutputType>(
+                        [prev, half, num_rows] __device__(size_type idx) {
+                          return idx < num_rows - half ? AggOp{}(prev[idx], prev[idx + half])
+                                                       : prev[idx];
+                        }));
+  }
+  return table;
+}
+
+/**
+ * @brief Returns the number of sparse table levels needed for windows of up to `window_size`
+ */
+inline size_type sparse_table_levels(size_type window_size)
+{
+  size_type levels = 1;
+  while ((int64_t{1} << levels) <= window_size) {
+    ++levels;
+  }
+  return levels;
+}
+
+/**
+ * @brief Operator for applying a SUM, MEAN or COUNT_VALID rolling aggregation on a single
+ * window in constant time using prefix sums.
+ */
+template <typename InputType, aggregation::Kind op>
+struct DeviceRollingPrefixSum {
+  size_type min_periods;
+  uint64_t const* sums;            ///< prefix sums of the input; unused for COUNT_VALID
+  size_type const* valid_counts;  ///< prefix counts of valid rows; only used with nulls
+
+  template <typename OutputType, bool has_nulls>
+  bool __device__ operator()(column_device_view const&,
+                             column_device_view const&,
+                             mutable_column_device_view& output,
+                             size_type start_index,
+                             size_type end_index,
+                             size_type current_index) const
+  {
+    size_type const count =
+      has_nulls ? valid_counts[end_index] - valid_counts[start_index] : end_index - start_index;
+
+    if constexpr (op == aggregation::COUNT_VALID) {
+      bool const output_is_valid = ((end_index - start_index) >= min_periods);
+      if (output_is_valid) { output.element<OutputType>(current_index) = count; }
+      return output_is_valid;
+    } else {
+      // the difference is exact even if the running sum wrapped around
+      using SumType  = std::conditional_t<std::is_signed_v<InputType>, int64_t, uint64_t>;
+      auto const sum = static_cast<SumType>(sums[end_index] - sums[start_index]);
+      OutputType val = static_cast<OutputType>(sum);
+      cudf::detail::rolling_store_output_functor<OutputType, op == aggregation::MEAN>{}(
+        output.element<OutputType>(current_index), val, count);
+      return count >= min_periods;
+    }
+  }
+};
+
+/**
+ * @brief Operator for applying a MIN or MAX rolling aggregation on a single window in
+ * constant time using a sparse table built by `make_sparse_table`.
+ */
+template <typename TableType, aggregation::Kind op>
+struct DeviceRollingSparseMinMax {
+  size_type min_periods;
+  TableType const* table;         ///< levels of the sparse table
+  size_type const* valid_counts;  ///< prefix counts of valid rows; only used with nulls
+  size_type num_rows;             ///< number of entries in each level
+
+  template <typename OutputType, bool has_nulls>
+  bool __device__ operator()(column_device_view const&,
+                             column_device_view const&,
+                             mutable_column_device_view& output,
+                             size_type start_index,
+                             size_type end_index,
+                             size_type current_index) const
+  {
+    using AggOp = typename corresponding_operator<op>::type;
+
+    auto const size = end_index - start_index;
+    size_type const count =
+      has_nulls ? valid_counts[end_index] - valid_counts[start_index] : size;
+
+    OutputType val = AggOp::template identity<OutputType>();
+    if (size > 0) {
+      // the two entries of the largest level fitting in the window cover it
+      auto const level = 31 - __clz(size);
+      auto const rows  = table + static_cast<int64_t>(level) * num_rows;
+      val              = AggOp{}(rows[start_index], rows[end_index - (size_type{1} << level)]);
+    }
+
+    cudf::detail::rolling_store_output_functor<OutputType, false>{}(
+      output.element<OutputType>(current_index), val, count);
+    return count >= min_periods;
+  }
+};
+
+}  // namespace detail
+}  // namespace cudf
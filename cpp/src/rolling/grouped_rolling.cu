@@ -25,9 +25,11 @@
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -39,6 +41,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/partition.h>
 
+#include <algorithm>
+
 namespace cudf {
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
@@ -427,21 +431,21 @@ std::tuple<size_type, size_type> get_null_bounds_for_orderby_column(
                            : std::make_tuple(num_rows - num_nulls, num_rows);
 }
 
+/// Preceding and following window sizes of each row, as computed from range window bounds.
+using window_columns = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
 /// Range window computation, with
 ///   1. no grouping keys specified
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::device_async_resource_ref mr)
+window_columns range_window_ASC(column_view const& orderby_column,
+                                T preceding_window,
+                                bool preceding_window_is_unbounded,
+                                T following_window,
+                                bool following_window_is_unbounded,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -480,13 +484,13 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -516,11 +520,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -605,18 +608,15 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
 
 // Range window computation, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::device_async_resource_ref mr)
+window_columns range_window_ASC(column_view const& orderby_column,
+                                rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                rmm::device_uvector<cudf::size_type> const& group_labels,
+                                T preceding_window,
+                                bool preceding_window_is_unbounded,
+                                T following_window,
+                                bool following_window_is_unbounded,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -662,8 +662,8 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -677,7 +677,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
       auto const group_start = d_group_offsets[group_label];
       auto const group_end =
         d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
-                                           // is capped with `input.size()`.
+                                           // is capped with `orderby_column.size()`.
       auto const nulls_begin = d_nulls_begin[group_label];
       auto const nulls_end   = d_nulls_end[group_label];
 
@@ -709,11 +709,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 /// Range window computation, with
@@ -721,16 +720,13 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
+window_columns range_window_DESC(column_view const& orderby_column,
+                                 T preceding_window,
+                                 bool preceding_window_is_unbounded,
+                                 T following_window,
+                                 bool following_window_is_unbounded,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -769,13 +765,13 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -805,27 +801,23 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Range window computation, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
+window_columns range_window_DESC(column_view const& orderby_column,
+                                 rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                 rmm::device_uvector<cudf::size_type> const& group_labels,
+                                 T preceding_window,
+                                 bool preceding_window_is_unbounded,
+                                 T following_window,
+                                 bool following_window_is_unbounded,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -870,8 +862,8 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -914,28 +906,20 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+window_columns grouped_range_rolling_window_impl(
   column_view const& orderby_column,
   cudf::order const& order_of_orderby_column,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
 {
@@ -956,49 +940,37 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   }();
 
   if (order_of_orderby_column == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr);
   }
@@ -1006,37 +978,29 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
 
 struct dispatch_grouped_range_rolling_window {
   template <typename OrderByColumnType, typename... Args>
-  std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
+  std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(), window_columns>
   operator()(Args&&...) const
   {
     CUDF_FAIL("Unsupported OrderBy column type.");
   }
 
   template <typename OrderByColumnType>
-  std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
-  operator()(column_view const& input,
-             column_view const& orderby_column,
+  std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(), window_columns>
+  operator()(column_view const& orderby_column,
              cudf::order const& order_of_orderby_column,
              rmm::device_uvector<cudf::size_type> const& group_offsets,
              rmm::device_uvector<cudf::size_type> const& group_labels,
              range_window_bounds const& preceding_window,
              range_window_bounds const& following_window,
-             size_type min_periods,
-             rolling_aggregation const& aggr,
              rmm::cuda_stream_view stream,
              rmm::device_async_resource_ref mr) const
   {
-    return grouped_range_rolling_window_impl<OrderByColumnType>(input,
-                                                                orderby_column,
+    return grouped_range_rolling_window_impl<OrderByColumnType>(orderby_column,
                                                                 order_of_orderby_column,
                                                                 group_offsets,
                                                                 group_labels,
                                                                 preceding_window,
                                                                 following_window,
-                                                                min_periods,
-                                                                aggr,
                                                                 stream,
                                                                 mr);
   }
@@ -1108,10 +1072,67 @@ range_window_bounds to_range_bounds(cudf::window_bounds const& days_bounds,
            : cudf::type_dispatcher(timestamp_type, to_duration_bounds{}, days_bounds.value());
 }
 
+/**
+ * @brief Returns false for the UDF aggregations, which are not supported over grouped windows
+ * in descending order.
+ */
+bool is_supported_range_aggregation(table_view const& group_keys,
+                                    cudf::order const& order,
+                                    rolling_aggregation const& aggr)
+{
+  auto const is_udf = aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX;
+  return !is_udf || group_keys.num_columns() == 0 || order == cudf::order::ASCENDING;
+}
+
 }  // namespace
 
 namespace detail {
 
+/**
+ * @copydoc std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_range_windows(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               rmm::device_async_resource_ref mr);
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_range_windows(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == orderby_column.size()),
+               "Size mismatch between group_keys and order-by column.");
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  return cudf::type_dispatcher(orderby_column.type(),
+                               dispatch_grouped_range_rolling_window{},
+                               orderby_column,
+                               order,
+                               group_offsets,
+                               group_labels,
+                               preceding,
+                               following,
+                               stream,
+                               mr);
+}
+
 /**
  * @copydoc  std::unique_ptr<column> grouped_range_rolling_window(
  *               table_view const& group_keys,
@@ -1152,31 +1173,97 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
     return optimized_unbounded_window(group_keys, input, aggr, stream, mr);
   }
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  CUDF_EXPECTS(is_supported_range_aggregation(group_keys, order, aggr),
+               "Ranged rolling window does NOT (yet) support UDF.");
 
-  index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
-    group_offsets = index_vector(helper.group_offsets(stream), stream);
-    group_labels  = index_vector(helper.group_labels(stream), stream);
+  auto const [preceding_column, following_column] =
+    make_range_windows(group_keys,
+                       order_by_column,
+                       order,
+                       preceding,
+                       following,
+                       stream,
+                       rmm::mr::get_current_device_resource());
+
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+}
+
+/**
+ * @copydoc std::unique_ptr<table> grouped_range_rolling_window(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               host_span<rolling_request const> requests,
+ *               rmm::device_async_resource_ref mr);
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> grouped_range_rolling_window(table_view const& group_keys,
+                                                    column_view const& order_by_column,
+                                                    cudf::order const& order,
+                                                    range_window_bounds const& preceding,
+                                                    range_window_bounds const& following,
+                                                    host_span<rolling_request const> requests,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == order_by_column.size()),
+               "Size mismatch between group_keys and order-by column.");
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(request.values.size() == order_by_column.size(),
+                 "Size mismatch between request values and order-by column.");
+    CUDF_EXPECTS(request.aggregation != nullptr, "Each request must have an aggregation.");
+    CUDF_EXPECTS((request.min_periods > 0), "min_periods must be positive");
+    CUDF_EXPECTS(is_supported_range_aggregation(group_keys, order, *request.aggregation),
+                 "Ranged rolling window does NOT (yet) support UDF.");
   }
 
-  return cudf::type_dispatcher(order_by_column.type(),
-                               dispatch_grouped_range_rolling_window{},
-                               input,
-                               order_by_column,
-                               order,
-                               group_offsets,
-                               group_labels,
-                               preceding,
-                               following,
-                               min_periods,
-                               aggr,
-                               stream,
-                               mr);
+  auto const is_optimized = [&](rolling_request const& request) {
+    return can_optimize_unbounded_window(preceding.is_unbounded(),
+                                         following.is_unbounded(),
+                                         request.min_periods,
+                                         *request.aggregation);
+  };
+
+  // the windows are computed once and shared by all the requests that need them
+  auto const windows =
+    order_by_column.is_empty() || std::all_of(requests.begin(), requests.end(), is_optimized)
+      ? window_columns{}
+      : make_range_windows(group_keys,
+                           order_by_column,
+                           order,
+                           preceding,
+                           following,
+                           stream,
+                           rmm::mr::get_current_device_resource());
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(requests.size());
+  for (auto const& request : requests) {
+    auto const& aggr = *request.aggregation;
+    if (request.values.is_empty()) {
+      results.push_back(cudf::detail::empty_output_for_rolling_aggregation(request.values, aggr));
+    } else if (is_optimized(request)) {
+      results.push_back(optimized_unbounded_window(group_keys, request.values, aggr, stream, mr));
+    } else {
+      results.push_back(cudf::detail::rolling_window(request.values,
+                                                     windows.first->view(),
+                                                     windows.second->view(),
+                                                     request.min_periods,
+                                                     aggr,
+                                                     stream,
+                                                     mr));
+    }
+  }
+  return std::make_unique<table>(std::move(results));
 }
 
+
 }  // namespace detail
 
 /**
@@ -1292,4 +1379,55 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
                                               mr);
 }
 
+/**
+ * @copydoc std::unique_ptr<table> grouped_range_rolling_window(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               host_span<rolling_request const> requests,
+ *               rmm::device_async_resource_ref mr);
+ */
+std::unique_ptr<table> grouped_range_rolling_window(table_view const& group_keys,
+                                                    column_view const& orderby_column,
+                                                    cudf::order const& order,
+                                                    range_window_bounds const& preceding,
+                                                    range_window_bounds const& following,
+                                                    host_span<rolling_request const> requests,
+                                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::grouped_range_rolling_window(group_keys,
+                                              orderby_column,
+                                              order,
+                                              preceding,
+                                              following,
+                                              requests,
+                                              cudf::get_default_stream(),
+                                              mr);
+}
+
+/**
+ * @copydoc std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_range_windows(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               rmm::device_async_resource_ref mr);
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_range_windows(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_range_windows(
+    group_keys, orderby_column, order, preceding, following, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
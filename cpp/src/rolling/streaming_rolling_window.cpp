@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail/rolling.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+
+streaming_rolling_window::streaming_rolling_window(size_type preceding_window,
+                                                   size_type following_window,
+                                                   size_type min_periods,
+                                                   std::unique_ptr<rolling_aggregation>&& agg)
+  : _preceding_window{preceding_window},
+    _following_window{following_window},
+    _min_periods{min_periods},
+    _agg{std::move(agg)}
+{
+  CUDF_EXPECTS(_preceding_window > 0,
+               "The preceding window must include the current row",
+               std::invalid_argument);
+  CUDF_EXPECTS(
+    _following_window >= 0, "The following window must not be negative", std::invalid_argument);
+  CUDF_EXPECTS(_agg != nullptr, "An aggregation is required", std::invalid_argument);
+  CUDF_EXPECTS(_agg->kind != aggregation::LEAD && _agg->kind != aggregation::LAG,
+               "LEAD and LAG are not supported by streaming rolling windows",
+               std::invalid_argument);
+}
+
+streaming_rolling_window::~streaming_rolling_window() = default;
+
+std::unique_ptr<column> streaming_rolling_window::update(column_view const& batch,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!_finished, "No batch may be appended after finish");
+
+  if (_rows == nullptr) {
+    _rows = std::make_unique<column>(batch, stream, rmm::mr::get_current_device_resource());
+  } else {
+    CUDF_EXPECTS(cudf::have_same_types(_rows->view(), batch),
+                 "The batch type differs from that of previous batches",
+                 cudf::data_type_error);
+    _rows = cudf::detail::concatenate(std::vector<column_view>{_rows->view(), batch},
+                                      stream,
+                                      rmm::mr::get_current_device_resource());
+  }
+  return compute(false, stream, mr);
+}
+
+std::unique_ptr<column> streaming_rolling_window::finish(rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_rows != nullptr, "No batch has been appended to the streaming rolling window");
+  CUDF_EXPECTS(!_finished, "The streaming rolling window is already finished");
+
+  auto result = compute(true, stream, mr);
+  _finished   = true;
+  _rows.reset();
+  return result;
+}
+
+std::unique_ptr<column> streaming_rolling_window::compute(bool is_last,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr)
+{
+  auto const rows     = _rows->view();
+  auto const num_rows = rows.size();
+
+  // the rows from `begin` to `end` have complete windows and are returned;
+  // the rows before `begin` are only kept for the preceding windows of later rows
+  auto const begin = _returned_rows;
+  auto const end   = is_last ? num_rows : std::max(begin, num_rows - _following_window);
+
+  auto const defaults =
+    cudf::is_dictionary(rows.type()) ? dictionary_column_view(rows).indices() : rows;
+  auto const is_whole = begin == 0 && end == num_rows;
+  auto const output_mr =
+    is_whole ? mr : rmm::device_async_resource_ref{rmm::mr::get_current_device_resource()};
+
+  auto results = detail::rolling_window(rows,
+                                        empty_like(defaults)->view(),
+                                        _preceding_window,
+                                        _following_window,
+                                        _min_periods,
+                                        *_agg,
+                                        stream,
+                                        output_mr);
+  if (!is_whole) {
+    results = std::make_unique<column>(
+      cudf::detail::slice(results->view(), begin, end, stream), stream, mr);
+  }
+
+  // keep the returned rows still inside the preceding window of the first row not returned
+  auto const keep_begin = std::max(0, end - (_preceding_window - 1));
+  if (keep_begin > 0) {
+    _rows = std::make_unique<column>(cudf::detail::slice(rows, keep_begin, num_rows, stream),
+                                     stream,
+                                     rmm::mr::get_current_device_resource());
+  }
+  _returned_rows = end - keep_begin;
+  return results;
+}
+
+}  // namespace cudf
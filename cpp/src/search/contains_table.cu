@@ -16,9 +16,12 @@
 
 #include "join/join_common_utils.cuh"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/search.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -26,12 +29,18 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuco/static_set.cuh>
 #include <cuda/functional>
+#include <thrust/fill.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <type_traits>
 
 namespace cudf::detail {
@@ -182,6 +191,103 @@ void dispatch_nan_comparator(
   }
 }
 
+/**
+ * @brief Invokes `func` with the device row equality of `comparator` for the given null and NaN
+ * equalities
+ *
+ * @tparam HasNested Flag indicating whether there are nested columns in the compared tables
+ */
+template <bool HasNested, typename Comparator, typename Func>
+void dispatch_row_equality(Comparator const& comparator,
+                           bool has_nulls,
+                           null_equality compare_nulls,
+                           nan_equality compare_nans,
+                           Func&& func)
+{
+  if (compare_nans == nan_equality::ALL_EQUAL) {
+    func(comparator.template equal_to<HasNested>(
+      nullate::DYNAMIC{has_nulls},
+      compare_nulls,
+      cudf::experimental::row::equality::nan_equal_physical_equality_comparator{}));
+  } else {
+    func(comparator.template equal_to<HasNested>(
+      nullate::DYNAMIC{has_nulls},
+      compare_nulls,
+      cudf::experimental::row::equality::physical_equality_comparator{}));
+  }
+}
+
+/**
+ * @brief Hashes the row whose index is stored as a key of a `semi_map_type`
+ */
+template <typename Hasher>
+struct row_index_hasher {
+  row_index_hasher(Hasher const& hasher) : _hasher{hasher} {}
+
+  __device__ hash_value_type operator()(hash_value_type row_index) const noexcept
+  {
+    return _hasher(static_cast<size_type>(row_index));
+  }
+
+ private:
+  Hasher const _hasher;
+};
+
+/**
+ * @brief Compares two haystack rows whose indices are stored as keys of a `semi_map_type`
+ */
+template <typename Equal>
+struct haystack_row_equal {
+  Equal equal;
+
+  __device__ bool operator()(hash_value_type lhs, hash_value_type rhs) const noexcept
+  {
+    return equal(static_cast<size_type>(lhs), static_cast<size_type>(rhs));
+  }
+};
+
+/**
+ * @brief Compares the haystack row stored in a `semi_map_type` with a needle row
+ *
+ * The map passes the stored key first and the probed key second.
+ */
+template <typename Equal>
+struct haystack_needle_equal {
+  Equal equal;
+
+  __device__ bool operator()(hash_value_type haystack_index,
+                             hash_value_type needle_index) const noexcept
+  {
+    return equal(lhs_index_type{static_cast<size_type>(haystack_index)},
+                 rhs_index_type{static_cast<size_type>(needle_index)});
+  }
+};
+
+/**
+ * @brief Tells whether each needle row is in the haystack set
+ */
+template <typename IndexHasher, typename Equal>
+struct haystack_set_contains_fn {
+  semi_map_type::device_view set;
+  IndexHasher hash;
+  haystack_needle_equal<Equal> equal;
+
+  __device__ bool operator()(size_type needle_index) const noexcept
+  {
+    return set.contains(static_cast<hash_value_type>(needle_index), hash, equal);
+  }
+};
+
+/**
+ * @brief Makes the key and value inserted into a `semi_map_type` for a haystack row
+ */
+struct make_haystack_pair_fn {
+  __device__ pair_type operator()(size_type row_index) const noexcept
+  {
+    return cuco::make_pair(static_cast<hash_value_type>(row_index), row_index);
+  }
+};
+
 }  // namespace
 
 rmm::device_uvector<bool> contains(table_view const& haystack,
@@ -292,4 +398,159 @@ rmm::device_uvector<bool> contains(table_view const& haystack,
   return contained;
 }
 
+/**
+ * @brief Implementation of `cudf::haystack_set`
+ *
+ * Unlike the set built by `contains()`, whose row comparators are fixed when it is built, the
+ * map stores haystack row indices and is given the hasher and comparator of each new needles
+ * table when probed.
+ */
+class haystack_set {
+ public:
+  haystack_set(table_view const& haystack,
+               null_equality compare_nulls,
+               nan_equality compare_nans,
+               rmm::cuda_stream_view stream)
+    : _haystack{haystack},
+      _compare_nulls{compare_nulls},
+      _compare_nans{compare_nans},
+      _haystack_has_nulls{has_nested_nulls(haystack)},
+      _has_nested_columns{cudf::detail::has_nested_columns(haystack)},
+      _preprocessed_haystack{
+        cudf::experimental::row::equality::preprocessed_table::create(haystack, stream)},
+      _set{compute_hash_table_size(std::max(haystack.num_rows(), size_type{1})),
+           cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+           cuco::empty_value{cudf::detail::JoinNoneValue},
+           cudf::detail::cuco_allocator{stream},
+           stream.value()}
+  {
+    if (_has_nested_columns) {
+      build<true>(stream);
+    } else {
+      build<false>(stream);
+    }
+  }
+
+  void contains(table_view const& needles,
+                device_span<bool> output,
+                rmm::cuda_stream_view stream) const
+  {
+    CUDF_EXPECTS(needles.num_columns() == _haystack.num_columns(),
+                 "Mismatch between number of columns in haystack and needles.",
+                 std::invalid_argument);
+    CUDF_EXPECTS(cudf::have_same_types(_haystack, needles),
+                 "Mismatch between column types in haystack and needles.",
+                 cudf::data_type_error);
+    if (needles.num_rows() == 0) { return; }
+    if (_haystack.num_rows() == 0) {
+      thrust::fill(rmm::exec_policy_nosync(stream), output.begin(), output.end(), false);
+      return;
+    }
+
+    if (_has_nested_columns) {
+      probe<true>(needles, output, stream);
+    } else {
+      probe<false>(needles, output, stream);
+    }
+  }
+
+ private:
+  template <bool HasNested>
+  void build(rmm::cuda_stream_view stream)
+  {
+    auto const hasher = cudf::experimental::row::hash::row_hasher(_preprocessed_haystack);
+    auto const d_hasher =
+      row_index_hasher{hasher.device_hasher(nullate::DYNAMIC{_haystack_has_nulls})};
+    auto const self_equal =
+      cudf::experimental::row::equality::self_comparator(_preprocessed_haystack);
+    auto const pairs =
+      cudf::detail::make_counting_transform_iterator(size_type{0}, make_haystack_pair_fn{});
+    auto const num_rows = _haystack.num_rows();
+
+    dispatch_row_equality<HasNested>(
+      self_equal, _haystack_has_nulls, _compare_nulls, _compare_nans, [&](auto const& d_equal) {
+        auto const equal = haystack_row_equal<std::decay_t<decltype(d_equal)>>{d_equal};
+        // Null rows never match when nulls compare unequal, so they are not inserted
+        if (_haystack_has_nulls && _compare_nulls == null_equality::UNEQUAL) {
+          auto const bitmask_buffer_and_ptr = build_row_bitmask(_haystack, stream);
+          _set.insert_if(pairs,
+                         pairs + num_rows,
+                         thrust::counting_iterator<size_type>(0),  // stencil
+                         row_is_valid{bitmask_buffer_and_ptr.second},
+                         d_hasher,
+                         equal,
+                         stream.value());
+        } else {
+          _set.insert(pairs, pairs + num_rows, d_hasher, equal, stream.value());
+        }
+      });
+  }
+
+  template <bool HasNested>
+  void probe(table_view const& needles,
+             device_span<bool> output,
+             rmm::cuda_stream_view stream) const
+  {
+    auto const needles_has_nulls = has_nested_nulls(needles);
+    auto const preprocessed_needles =
+      cudf::experimental::row::equality::preprocessed_table::create(needles, stream);
+    auto const hasher = cudf::experimental::row::hash::row_hasher(preprocessed_needles);
+    auto const d_hasher =
+      row_index_hasher{hasher.device_hasher(nullate::DYNAMIC{needles_has_nulls})};
+    auto const two_table_equal = cudf::experimental::row::equality::two_table_comparator(
+      _preprocessed_haystack, preprocessed_needles);
+    using hasher_type = std::decay_t<decltype(d_hasher)>;
+
+    dispatch_row_equality<HasNested>(
+      two_table_equal,
+      _haystack_has_nulls || needles_has_nulls,
+      _compare_nulls,
+      _compare_nans,
+      [&](auto const& d_equal) {
+        using contains_fn = haystack_set_contains_fn<hasher_type, std::decay_t<decltype(d_equal)>>;
+        thrust::transform(rmm::exec_policy_nosync(stream),
+                          thrust::counting_iterator<size_type>(0),
+                          thrust::counting_iterator<size_type>(needles.num_rows()),
+                          output.begin(),
+                          contains_fn{_set.get_device_view(), d_hasher, {d_equal}});
+      });
+  }
+
+  table_view const _haystack;
+  null_equality const _compare_nulls;
+  nan_equality const _compare_nans;
+  bool const _haystack_has_nulls;
+  bool const _has_nested_columns;
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const
+    _preprocessed_haystack;
+  semi_map_type _set;  ///< keys are the indices of the haystack rows
+};
+
 }  // namespace cudf::detail
+
+namespace cudf {
+
+haystack_set::~haystack_set() = default;
+
+haystack_set::haystack_set(table_view const& haystack,
+                           null_equality compare_nulls,
+                           nan_equality compare_nans,
+                           rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<detail::haystack_set const>(
+      haystack, compare_nulls, compare_nans, stream)}
+{
+}
+
+std::unique_ptr<column> haystack_set::contains(table_view const& needles,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, needles.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  _impl->contains(
+    needles, device_span<bool>{result->mutable_view().data<bool>(), needles.num_rows()}, stream);
+  return result;
+}
+
+}  // namespace cudf
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -28,6 +29,11 @@
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -115,6 +121,106 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
   }
   return result;
 }
+
+/**
+ * @brief Finds the insertion point of one needle in the haystack of its pair
+ *
+ * The haystacks and the needles of all pairs are concatenated, and `haystack_offsets` and
+ * `needle_offsets` give the rows of each pair.
+ */
+template <typename Comparator>
+struct batched_search_fn {
+  size_type const* haystack_offsets;
+  size_type const* needle_offsets;
+  size_type num_pairs;
+  size_type* const* results;
+  bool find_first;
+  Comparator comparator;
+
+  __device__ void operator()(size_type idx) const
+  {
+    // the pair of a needle is the last one starting at or before it, skipping empty pairs
+    auto const next_pair =
+      thrust::upper_bound(thrust::seq, needle_offsets, needle_offsets + num_pairs + 1, idx);
+    auto const pair = static_cast<size_type>(thrust::distance(needle_offsets, next_pair)) - 1;
+    auto const first  = cudf::experimental::row::lhs_iterator(haystack_offsets[pair]);
+    auto const last   = cudf::experimental::row::lhs_iterator(haystack_offsets[pair + 1]);
+    auto const needle = cudf::experimental::row::rhs_index_type{idx};
+    auto const found  = find_first
+                          ? thrust::lower_bound(thrust::seq, first, last, needle, comparator)
+                          : thrust::upper_bound(thrust::seq, first, last, needle, comparator);
+    results[pair][idx - needle_offsets[pair]] =
+      static_cast<size_type>(thrust::distance(first, found));
+  }
+};
+
+std::vector<std::unique_ptr<column>> batched_search_ordered(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  bool find_first,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(haystacks.size() == needles.size(),
+               "Mismatch between number of haystacks and needles.",
+               std::invalid_argument);
+  if (haystacks.empty()) { return {}; }
+
+  std::vector<size_type> haystack_offsets{0};
+  std::vector<size_type> needle_offsets{0};
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<size_type*> result_ptrs;
+  for (std::size_t idx = 0; idx < haystacks.size(); ++idx) {
+    haystack_offsets.push_back(haystack_offsets.back() + haystacks[idx].num_rows());
+    needle_offsets.push_back(needle_offsets.back() + needles[idx].num_rows());
+    results.push_back(make_numeric_column(data_type{type_to_id<size_type>()},
+                                          needles[idx].num_rows(),
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          mr));
+    result_ptrs.push_back(results.back()->mutable_view().data<size_type>());
+  }
+  auto const num_needles = needle_offsets.back();
+  if (num_needles == 0) { return results; }
+
+  auto const temp_mr            = rmm::mr::get_current_device_resource();
+  auto const all_haystacks      = cudf::detail::concatenate(haystacks, stream, temp_mr);
+  auto const all_needles        = cudf::detail::concatenate(needles, stream, temp_mr);
+  auto const d_haystack_offsets = make_device_uvector_async(haystack_offsets, stream, temp_mr);
+  auto const d_needle_offsets   = make_device_uvector_async(needle_offsets, stream, temp_mr);
+  auto const d_result_ptrs      = make_device_uvector_async(result_ptrs, stream, temp_mr);
+
+  auto const matched = dictionary::detail::match_dictionaries(
+    {all_haystacks->view(), all_needles->view()}, stream, temp_mr);
+  auto const& matched_haystack = matched.second.front();
+  auto const& matched_needles  = matched.second.back();
+
+  auto const comparator = cudf::experimental::row::lexicographic::two_table_comparator(
+    matched_haystack, matched_needles, column_order, null_precedence, stream);
+  auto const has_nulls = has_nested_nulls(matched_haystack) or has_nested_nulls(matched_needles);
+
+  auto const search = [&](auto const& d_comparator) {
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_needles,
+                       batched_search_fn<std::decay_t<decltype(d_comparator)>>{
+                         d_haystack_offsets.data(),
+                         d_needle_offsets.data(),
+                         static_cast<size_type>(haystacks.size()),
+                         d_result_ptrs.data(),
+                         find_first,
+                         d_comparator});
+  };
+  if (cudf::detail::has_nested_columns(matched_haystack) ||
+      cudf::detail::has_nested_columns(matched_needles)) {
+    search(comparator.less<true>(nullate::DYNAMIC{has_nulls}));
+  } else {
+    search(comparator.less<false>(nullate::DYNAMIC{has_nulls}));
+  }
+  return results;
+}
 }  // namespace
 
 std::unique_ptr<column> lower_bound(table_view const& haystack,
@@ -137,6 +243,30 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
   return search_ordered(haystack, needles, false, column_order, null_precedence, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_search_ordered(
+    haystacks, needles, true, column_order, null_precedence, stream, mr);
+}
+
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_search_ordered(
+    haystacks, needles, false, column_order, null_precedence, stream, mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -163,4 +293,30 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
   return detail::upper_bound(haystack, needles, column_order, null_precedence, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_lower_bound(
+    haystacks, needles, column_order, null_precedence, stream, mr);
+}
+
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  host_span<table_view const> haystacks,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_upper_bound(
+    haystacks, needles, column_order, null_precedence, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/// Searches performed by a `sorted_index`
+enum class search_kind { LOWER_BOUND, UPPER_BOUND, CONTAINS };
+
+namespace {
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+using cudf::experimental::row::lexicographic::preprocessed_table;
+using cudf::experimental::row::lexicographic::two_table_comparator;
+
+/**
+ * @brief Returns true if `col` or any of its descendants is a list or a dictionary column
+ */
+bool has_lists_or_dictionaries(column_view const& col)
+{
+  return col.type().id() == type_id::LIST or col.type().id() == type_id::DICTIONARY32 or
+         std::any_of(col.child_begin(), col.child_end(), has_lists_or_dictionaries);
+}
+
+/**
+ * @brief Returns true if the needle with the given insertion point equals the key there
+ *
+ * The key at the lower bound of a needle is not less than the needle, so the two are equal
+ * unless the needle is less than that key.
+ */
+template <typename Comparator>
+struct found_at_lower_bound_fn {
+  size_type num_keys;
+  Comparator less;
+
+  __device__ bool operator()(size_type needle, size_type lower_bound) const
+  {
+    return lower_bound < num_keys and
+           not less(rhs_index_type{needle}, lhs_index_type{lower_bound});
+  }
+};
+
+template <typename Comparator>
+std::unique_ptr<column> search_keys(Comparator const& less,
+                                    size_type num_keys,
+                                    size_type num_needles,
+                                    search_kind kind,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto const keys_it    = cudf::experimental::row::lhs_iterator(0);
+  auto const needles_it = cudf::experimental::row::rhs_iterator(0);
+
+  if (kind == search_kind::UPPER_BOUND) {
+    auto result = make_numeric_column(
+      data_type{type_to_id<size_type>()}, num_needles, mask_state::UNALLOCATED, stream, mr);
+    thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                        keys_it,
+                        keys_it + num_keys,
+                        needles_it,
+                        needles_it + num_needles,
+                        result->mutable_view().data<size_type>(),
+                        less);
+    return result;
+  }
+
+  auto const bounds_mr = kind == search_kind::LOWER_BOUND
+                           ? mr
+                           : rmm::device_async_resource_ref{rmm::mr::get_current_device_resource()};
+  auto bounds = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_needles, mask_state::UNALLOCATED, stream, bounds_mr);
+  auto const d_bounds = bounds->mutable_view().data<size_type>();
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      keys_it,
+                      keys_it + num_keys,
+                      needles_it,
+                      needles_it + num_needles,
+                      d_bounds,
+                      less);
+  if (kind == search_kind::LOWER_BOUND) { return bounds; }
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, num_needles, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_needles),
+                    d_bounds,
+                    result->mutable_view().data<bool>(),
+                    found_at_lower_bound_fn<Comparator>{num_keys, less});
+  return result;
+}
+
+template <typename TwoTableComparator>
+std::unique_ptr<column> search_keys(TwoTableComparator const& comparator,
+                                    bool has_nested_columns,
+                                    bool has_nulls,
+                                    size_type num_keys,
+                                    size_type num_needles,
+                                    search_kind kind,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  if (has_nested_columns) {
+    return search_keys(comparator.template less<true>(nullate::DYNAMIC{has_nulls}),
+                       num_keys,
+                       num_needles,
+                       kind,
+                       stream,
+                       mr);
+  }
+  return search_keys(comparator.template less<false>(nullate::DYNAMIC{has_nulls}),
+                     num_keys,
+                     num_needles,
+                     kind,
+                     stream,
+                     mr);
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation of `cudf::sorted_index`
+ */
+class sorted_index {
+ public:
+  sorted_index(table_view const& keys,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream)
+    : _keys{keys},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _keys_have_nulls{has_nested_nulls(keys)}
+  {
+    CUDF_EXPECTS(column_order.empty() or
+                   static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.",
+                 std::invalid_argument);
+    CUDF_EXPECTS(null_precedence.empty() or
+                   static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null precedence.",
+                 std::invalid_argument);
+
+    // keys holding lists or dictionaries must be preprocessed with the needles of each search
+    if (std::none_of(keys.begin(), keys.end(), has_lists_or_dictionaries)) {
+      _preprocessed_keys =
+        preprocessed_table::create(keys, _column_order, _null_precedence, stream);
+    }
+  }
+
+  std::unique_ptr<column> search(table_view const& needles,
+                                 search_kind kind,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr) const
+  {
+    CUDF_EXPECTS(needles.num_columns() == _keys.num_columns(),
+                 "Mismatch between number of columns in keys and needles.",
+                 std::invalid_argument);
+    CUDF_EXPECTS(cudf::have_same_types(_keys, needles),
+                 "Mismatch between column types in keys and needles.",
+                 cudf::data_type_error);
+
+    auto const num_keys    = _keys.num_rows();
+    auto const num_needles = needles.num_rows();
+    auto const has_nulls   = _keys_have_nulls or has_nested_nulls(needles);
+    auto const has_nested =
+      cudf::detail::has_nested_columns(_keys) or cudf::detail::has_nested_columns(needles);
+
+    if (_preprocessed_keys) {
+      auto const comparator = two_table_comparator(
+        _preprocessed_keys,
+        preprocessed_table::create(needles, _column_order, _null_precedence, stream));
+      return search_keys(
+        comparator, has_nested, has_nulls, num_keys, num_needles, kind, stream, mr);
+    }
+
+    auto const matched = dictionary::detail::match_dictionaries(
+      {_keys, needles}, stream, rmm::mr::get_current_device_resource());
+    auto const comparator = two_table_comparator(
+      matched.second.front(), matched.second.back(), _column_order, _null_precedence, stream);
+    return search_keys(comparator, has_nested, has_nulls, num_keys, num_needles, kind, stream, mr);
+  }
+
+ private:
+  table_view const _keys;
+  std::vector<order> const _column_order;
+  std::vector<null_order> const _null_precedence;
+  bool const _keys_have_nulls;
+  std::shared_ptr<preprocessed_table> _preprocessed_keys;  ///< Null if searches preprocess keys
+};
+
+}  // namespace detail
+
+sorted_index::~sorted_index() = default;
+
+sorted_index::sorted_index(table_view const& keys,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<detail::sorted_index const>(keys, column_order, null_precedence, stream)}
+{
+}
+
+std::unique_ptr<column> sorted_index::lower_bound(table_view const& needles,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(needles, detail::search_kind::LOWER_BOUND, stream, mr);
+}
+
+std::unique_ptr<column> sorted_index::upper_bound(table_view const& needles,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(needles, detail::search_kind::UPPER_BOUND, stream, mr);
+}
+
+std::unique_ptr<column> sorted_index::contains(table_view const& needles,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(needles, detail::search_kind::CONTAINS, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/host_spill.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/merge.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/// Size of the pieces of the runs, as a fraction of the device memory budget
+constexpr std::size_t pieces_per_budget = 64;
+/// Device memory used to merge a piece of each run, as a multiple of the size of the pieces
+constexpr std::size_t merge_bytes_per_piece_byte = 4;
+
+/**
+ * @brief The sorted rows of a run, spilled to host memory in pieces of consecutive rows
+ */
+struct sorted_run {
+  std::vector<cudf::detail::host_spilled_table> pieces;
+  std::size_t piece   = 0;  ///< Piece of the next row to merge
+  size_type piece_row = 0;  ///< Row in the piece of the next row to merge
+
+  [[nodiscard]] bool is_merged() const { return piece == pieces.size(); }
+};
+
+}  // namespace
+
+struct external_sorter::impl {
+  std::vector<size_type> key_columns;
+  std::vector<order> column_order;
+  std::vector<null_order> null_precedence;
+  std::size_t device_memory_budget;
+  std::vector<sorted_run> runs;
+  bool merging = false;
+
+  /**
+   * @brief Spills the sorted rows of `sorted` as a new run, in pieces of a fraction of the budget
+   */
+  void spill_run(table_view const& sorted, sorted_run& run, rmm::cuda_stream_view stream) const
+  {
+    auto const num_rows = sorted.num_rows();
+    if (num_rows == 0) { return; }
+    auto const bytes = std::max<std::size_t>(cudf::detail::table_size_bytes(sorted, stream), 1);
+    auto const piece_bytes    = device_memory_budget / pieces_per_budget;
+    auto const rows_per_piece = static_cast<size_type>(std::clamp<std::size_t>(
+      static_cast<std::size_t>(num_rows) * piece_bytes / bytes, 1, num_rows));
+    for (size_type begin = 0; begin < num_rows;) {
+      auto const end = begin + std::min(rows_per_piece, num_rows - begin);
+      run.pieces.push_back(cudf::detail::spill_to_host(
+        cudf::detail::slice(sorted, {begin, end}, stream).front(), stream));
+      begin = end;
+    }
+  }
+
+  /**
+   * @brief Merges the rows of `merged_runs` that are known to precede all their unmerged rows
+   *
+   * The current piece of each run is loaded. The rows of the pieces up to the smallest last row
+   * of the pieces of the runs that have more pieces, which includes a whole piece, precede the
+   * rows of all the following pieces, so that they are merged and returned.
+   *
+   * @return The merged rows, or nullptr if all the rows of the runs are merged
+   */
+  std::unique_ptr<table> merge_step(std::vector<sorted_run*> const& merged_runs,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr) const
+  {
+    auto const temp_mr = rmm::mr::get_current_device_resource();
+    std::vector<sorted_run*> active_runs;
+    std::vector<std::unique_ptr<table>> pieces;
+    std::vector<table_view> piece_views;
+    for (auto run : merged_runs) {
+      if (run->is_merged()) { continue; }
+      active_runs.push_back(run);
+      auto const& piece = run->pieces[run->piece];
+      pieces.push_back(cudf::detail::unspill_from_host({&piece, 1}, stream, temp_mr));
+      piece_views.push_back(cudf::detail::slice(
+        pieces.back()->view(), {run->piece_row, piece.num_rows}, stream).front());
+    }
+    if (active_runs.empty()) { return nullptr; }
+
+    // The last key of the pieces of the runs with more pieces, of which the smallest bounds the
+    // rows that can be merged
+    std::vector<table_view> last_keys;
+    for (std::size_t i = 0; i < active_runs.size(); ++i) {
+      if (active_runs[i]->piece + 1 == active_runs[i]->pieces.size()) { continue; }
+      auto const num_rows = piece_views[i].num_rows();
+      last_keys.push_back(cudf::detail::slice(piece_views[i].select(key_columns),
+                                              {num_rows - 1, num_rows},
+                                              stream)
+                            .front());
+    }
+
+    std::vector<size_type> merged_rows;
+    std::transform(piece_views.begin(),
+                   piece_views.end(),
+                   std::back_inserter(merged_rows),
+                   [](auto const& view) { return view.num_rows(); });
+    if (not last_keys.empty()) {
+      auto const keys  = cudf::detail::concatenate(last_keys, stream, temp_mr);
+      auto const order = cudf::detail::sorted_order(
+        keys->view(), column_order, null_precedence, stream, temp_mr);
+      auto const first    = cudf::detail::slice(order->view(), {0, 1}, stream).front();
+      auto const smallest = cudf::detail::gather(keys->view(),
+                                                 first,
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 temp_mr);
+      for (std::size_t i = 0; i < piece_views.size(); ++i) {
+        auto const bound = cudf::detail::upper_bound(piece_views[i].select(key_columns),
+                                                     smallest->view(),
+                                                     column_order,
+                                                     null_precedence,
+                                                     stream,
+                                                     temp_mr);
+        merged_rows[i] = cudf::detail::make_std_vector_sync(
+                           device_span<size_type const>{bound->view().data<size_type>(), 1}, stream)
+                           .front();
+      }
+    }
+
+    std::vector<table_view> merged_views;
+    for (std::size_t i = 0; i < active_runs.size(); ++i) {
+      auto run = active_runs[i];
+      if (merged_rows[i] > 0) {
+        merged_views.push_back(
+          cudf::detail::slice(piece_views[i], {0, merged_rows[i]}, stream).front());
+      }
+      run->piece_row += merged_rows[i];
+      if (run->piece_row == run->pieces[run->piece].num_rows) {
+        run->pieces[run->piece] = {};
+        ++run->piece;
+        run->piece_row = 0;
+      }
+    }
+    return cudf::detail::merge(
+      merged_views, key_columns, column_order, null_precedence, stream, mr);
+  }
+
+  /**
+   * @brief Merges groups of runs into longer runs until all the runs can be merged at once
+   */
+  void reduce_runs(rmm::cuda_stream_view stream)
+  {
+    auto const max_merged_runs = std::max<std::size_t>(
+      2, pieces_per_budget / merge_bytes_per_piece_byte);
+    while (runs.size() > max_merged_runs) {
+      std::vector<sorted_run> next_runs;
+      for (auto begin = runs.begin(); begin < runs.end();
+           begin += std::min<std::ptrdiff_t>(max_merged_runs, runs.end() - begin)) {
+        auto const end = begin + std::min<std::ptrdiff_t>(max_merged_runs, runs.end() - begin);
+        std::vector<sorted_run*> merged_runs;
+        std::transform(begin, end, std::back_inserter(merged_runs), [](auto& run) { return &run; });
+
+        next_runs.emplace_back();
+        while (auto const merged =
+                 merge_step(merged_runs, stream, rmm::mr::get_current_device_resource())) {
+          spill_run(merged->view(), next_runs.back(), stream);
+        }
+      }
+      runs = std::move(next_runs);
+    }
+  }
+};
+
+external_sorter::~external_sorter() = default;
+
+external_sorter::external_sorter(std::vector<size_type> key_columns,
+                                 std::vector<order> column_order,
+                                 std::vector<null_order> null_precedence,
+                                 std::size_t device_memory_budget)
+  : _impl{std::make_unique<impl>()}
+{
+  CUDF_EXPECTS(device_memory_budget > 0,
+               "The device memory budget must be positive",
+               std::invalid_argument);
+  _impl->key_columns          = std::move(key_columns);
+  _impl->column_order         = std::move(column_order);
+  _impl->null_precedence      = std::move(null_precedence);
+  _impl->device_memory_budget = device_memory_budget;
+}
+
+void external_sorter::add(table_view const& input, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _impl->merging, "Tables cannot be added once the merge has started");
+  if (input.num_rows() == 0) { return; }
+  auto const sorted = cudf::detail::sort_by_key(input,
+                                                input.select(_impl->key_columns),
+                                                _impl->column_order,
+                                                _impl->null_precedence,
+                                                stream,
+                                                rmm::mr::get_current_device_resource());
+  _impl->runs.emplace_back();
+  _impl->spill_run(sorted->view(), _impl->runs.back(), stream);
+}
+
+std::unique_ptr<table> external_sorter::next(rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  if (not _impl->merging) {
+    _impl->merging = true;
+    _impl->reduce_runs(stream);
+  }
+  std::vector<sorted_run*> runs;
+  std::transform(_impl->runs.begin(),
+                 _impl->runs.end(),
+                 std::back_inserter(runs),
+                 [](auto& run) { return &run; });
+  return _impl->merge_step(runs, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radix_sort.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/std/limits>
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Maximum number of columns sorted by the radix sort, which sorts each column in turn
+constexpr size_type radix_sort_max_columns = 4;
+
+/// Number of the first bytes of a string in its radix sort key
+constexpr size_type string_prefix_bytes = sizeof(uint64_t);
+
+template <typename T>
+constexpr bool is_radix_sortable_type()
+{
+  return (cudf::is_numeric<T>() or cudf::is_chrono<T>()) and sizeof(T) <= sizeof(uint64_t);
+}
+
+/**
+ * @brief Returns the unsigned key of a signed or unsigned integer with the same order
+ */
+template <typename T>
+__device__ uint64_t integer_key(T value)
+{
+  if constexpr (std::is_signed_v<T>) {
+    // Flipping the sign bit orders the negative values before the positive values
+    return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t{1} << 63);
+  } else {
+    return static_cast<uint64_t>(value);
+  }
+}
+
+/**
+ * @brief Returns the unsigned key of a floating-point value with the same order
+ *
+ * `-0.0` and `0.0` have the same key, and all `NaN`s have the greatest key.
+ */
+__device__ uint64_t floating_point_key(double value)
+{
+  if (value != value) { return cuda::std::numeric_limits<uint64_t>::max(); }
+  if (value == 0.0) { value = 0.0; }
+  auto const bits = static_cast<uint64_t>(__double_as_longlong(value));
+  // Negative values are ordered in reverse, before the positive values
+  return (bits >> 63) ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+/**
+ * @brief Returns the radix sort key of the row at each sorted position, or of each row if there
+ * are no `indices`
+ *
+ * The keys of descending columns are complemented. Null rows have the same key, which is ignored
+ * by the sort of the null keys.
+ */
+template <typename T>
+struct radix_key_fn {
+  column_device_view d_column;
+  size_type const* indices;
+  bool descending;
+
+  __device__ uint64_t operator()(size_type i) const
+  {
+    auto const row = indices == nullptr ? i : indices[i];
+    if (d_column.is_null(row)) { return 0; }
+    auto const value = d_column.element<T>(row);
+    auto const key   = [&] {
+      if constexpr (cudf::is_timestamp<T>()) {
+        return integer_key(value.time_since_epoch().count());
+      } else if constexpr (cudf::is_duration<T>()) {
+        return integer_key(value.count());
+      } else if constexpr (cudf::is_floating_point<T>()) {
+        return floating_point_key(static_cast<double>(value));
+      } else {
+        return integer_key(value);
+      }
+    }();
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Returns the radix sort key of the null rows of the row at each sorted position
+ */
+struct null_key_fn {
+  column_device_view d_column;
+  size_type const* indices;
+  bool nulls_first;
+
+  __device__ uint8_t operator()(size_type i) const
+  {
+    return d_column.is_null(indices[i]) != nulls_first;
+  }
+};
+
+/**
+ * @brief Returns the radix sort key of the first bytes of the string of the row at each sorted
+ * position
+ *
+ * The bytes are read as a big-endian integer, so that the keys are ordered like the prefixes.
+ * Strings shorter than the prefix are padded with zeros.
+ */
+struct string_prefix_key_fn {
+  column_device_view d_column;
+  size_type const* indices;
+  bool descending;
+
+  __device__ uint64_t operator()(size_type i) const
+  {
+    auto const row = indices[i];
+    if (d_column.is_null(row)) { return 0; }
+    auto const str   = d_column.element<string_view>(row);
+    auto const bytes = reinterpret_cast<uint8_t const*>(str.data());
+    auto const size  = str.size_bytes();
+    uint64_t key     = 0;
+    for (size_type b = 0; b < string_prefix_bytes; ++b) {
+      key = (key << 8) | (b < size ? bytes[b] : 0);
+    }
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Returns 1 for the sorted positions that start a run of equal prefix keys
+ */
+struct prefix_run_start_fn {
+  column_device_view d_column;
+  size_type const* indices;
+  uint64_t const* keys;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    if (i == 0) { return 1; }
+    return keys[i] != keys[i - 1] or
+           d_column.is_null(indices[i]) != d_column.is_null(indices[i - 1]);
+  }
+};
+
+/**
+ * @brief Returns whether the sorted position is in a run of equal prefixes of valid strings
+ *
+ * The null rows are all equal, so only the runs of valid strings are sorted again.
+ */
+struct is_tied_prefix_fn {
+  column_device_view d_column;
+  size_type const* indices;
+  size_type const* runs;
+  size_type num_rows;
+
+  __device__ bool operator()(size_type i) const
+  {
+    if (d_column.is_null(indices[i])) { return false; }
+    return (i > 0 and runs[i - 1] == runs[i]) or (i + 1 < num_rows and runs[i + 1] == runs[i]);
+  }
+};
+
+/**
+ * @brief Compares the tied rows by their run, and by their full strings within a run
+ */
+struct tied_strings_comparator {
+  column_device_view d_column;
+  size_type const* runs;
+  size_type const* rows;
+  bool descending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (runs[lhs] != runs[rhs]) { return runs[lhs] < runs[rhs]; }
+    auto const result = d_column.element<string_view>(rows[lhs])
+                          .compare(d_column.element<string_view>(rows[rhs]));
+    return descending ? result > 0 : result < 0;
+  }
+};
+
+struct radix_sortable_fn {
+  template <typename T>
+  bool operator()() const
+  {
+    return is_radix_sortable_type<T>();
+  }
+};
+
+struct radix_keys_fn {
+  template <typename T, CUDF_ENABLE_IF(is_radix_sortable_type<T>())>
+  void operator()(column_device_view const& d_column,
+                  size_type const* indices,
+                  bool descending,
+                  uint64_t* keys,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(d_column.size()),
+                      keys,
+                      radix_key_fn<T>{d_column, indices, descending});
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_radix_sortable_type<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported radix sort column type");
+  }
+};
+
+}  // namespace
+
+bool is_radix_sortable(table_view const& input)
+{
+  return input.num_columns() <= radix_sort_max_columns and
+         std::all_of(input.begin(), input.end(), [](column_view const& col) {
+           return cudf::type_dispatcher<dispatch_storage_type>(col.type(), radix_sortable_fn{});
+         });
+}
+
+void compute_radix_keys(column_view const& input,
+                        size_type const* indices,
+                        bool descending,
+                        uint64_t* keys,
+                        rmm::cuda_stream_view stream)
+{
+  auto const d_column = column_device_view::create(input, stream);
+  cudf::type_dispatcher<dispatch_storage_type>(
+    input.type(), radix_keys_fn{}, *d_column, indices, descending, keys, stream);
+}
+
+void radix_sorted_order(table_view const& input,
+                        std::vector<order> const& column_order,
+                        std::vector<null_order> const& null_precedence,
+                        mutable_column_view& indices,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.num_rows();
+  rmm::device_uvector<uint64_t> keys(num_rows, stream);
+  rmm::device_uvector<uint8_t> null_keys(input.has_nulls() ? num_rows : 0, stream);
+
+  // The sorts are stable, so that the last sort by a column keeps the order of the following
+  // columns among its equal keys
+  for (auto i = input.num_columns() - 1; i >= 0; --i) {
+    auto const col        = input.column(i);
+    auto const d_column   = column_device_view::create(col, stream);
+    auto const descending = not column_order.empty() and column_order[i] == order::DESCENDING;
+    compute_radix_keys(col, indices.begin<size_type>(), descending, keys.data(), stream);
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream), keys.begin(), keys.end(), indices.begin<size_type>());
+
+    if (col.has_nulls()) {
+      // Descending columns reverse the null precedence, like the row comparator
+      auto const nulls_before =
+        null_precedence.empty() or null_precedence[i] == null_order::BEFORE;
+      auto const nulls_first = nulls_before != descending;
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_rows),
+                        null_keys.begin(),
+                        null_key_fn{*d_column, indices.begin<size_type>(), nulls_first});
+      thrust::stable_sort_by_key(
+        rmm::exec_policy(stream), null_keys.begin(), null_keys.end(), indices.begin<size_type>());
+    }
+  }
+}
+
+void string_prefix_sorted_order(column_view const& input,
+                                mutable_column_view& indices,
+                                bool ascending,
+                                null_order null_precedence,
+                                rmm::cuda_stream_view stream)
+{
+  auto const num_rows   = input.size();
+  auto const d_column   = column_device_view::create(input, stream);
+  auto const descending = not ascending;
+  auto const d_indices  = indices.begin<size_type>();
+  auto const rows       = thrust::make_counting_iterator<size_type>(0);
+
+  rmm::device_uvector<uint64_t> keys(num_rows, stream);
+  auto const compute_keys = [&] {
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      keys.begin(),
+                      string_prefix_key_fn{*d_column, d_indices, descending});
+  };
+  compute_keys();
+  thrust::stable_sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), d_indices);
+
+  if (input.has_nulls()) {
+    // Descending order reverses the null precedence, like the row comparator
+    auto const nulls_first = (null_precedence == null_order::BEFORE) != descending;
+    rmm::device_uvector<uint8_t> null_keys(num_rows, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      null_keys.begin(),
+                      null_key_fn{*d_column, d_indices, nulls_first});
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream), null_keys.begin(), null_keys.end(), d_indices);
+    // The prefix keys in the new sorted order
+    compute_keys();
+  }
+
+  // Number the runs of equal prefixes and find the positions of the runs of more than one string
+  rmm::device_uvector<size_type> runs(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    rows,
+                    rows + num_rows,
+                    runs.begin(),
+                    prefix_run_start_fn{*d_column, d_indices, keys.data()});
+  thrust::inclusive_scan(rmm::exec_policy(stream), runs.begin(), runs.end(), runs.begin());
+
+  rmm::device_uvector<size_type> tied_positions(num_rows, stream);
+  auto const tied_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    rows,
+                    rows + num_rows,
+                    tied_positions.begin(),
+                    is_tied_prefix_fn{*d_column, d_indices, runs.data(), num_rows});
+  auto const num_tied = static_cast<size_type>(thrust::distance(tied_positions.begin(), tied_end));
+  if (num_tied == 0) { return; }
+
+  // The tied positions of a run are adjacent, so sorting the tied rows by their run and their
+  // strings gives the rows of the tied positions in sorted order
+  rmm::device_uvector<size_type> tied_rows(num_tied, stream);
+  rmm::device_uvector<size_type> tied_runs(num_tied, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 tied_positions.begin(),
+                 tied_positions.begin() + num_tied,
+                 d_indices,
+                 tied_rows.begin());
+  thrust::gather(rmm::exec_policy(stream),
+                 tied_positions.begin(),
+                 tied_positions.begin() + num_tied,
+                 runs.begin(),
+                 tied_runs.begin());
+
+  rmm::device_uvector<size_type> tied_order(num_tied, stream);
+  thrust::sequence(rmm::exec_policy(stream), tied_order.begin(), tied_order.end());
+  thrust::stable_sort(
+    rmm::exec_policy(stream),
+    tied_order.begin(),
+    tied_order.end(),
+    tied_strings_comparator{*d_column, tied_runs.data(), tied_rows.data(), descending});
+
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.begin()),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.end()),
+                  tied_positions.begin(),
+                  d_indices);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether the sorted order of `input` can be computed by radix sorting the
+ * normalized keys of its columns
+ *
+ * The columns must be non-nested fixed-width columns of at most 64 bits.
+ *
+ * @param input Table to sort
+ * @return true if `radix_sorted_order` can sort `input`
+ */
+bool is_radix_sortable(table_view const& input);
+
+/**
+ * @brief Writes the unsigned keys of the rows of a fixed-width column, whose order is the order
+ * of the rows
+ *
+ * The keys of a descending order are complemented. Null rows all have the same key.
+ *
+ * Precondition: `is_radix_sortable` returned true for a table of `input`.
+ *
+ * @param input Column of the keys
+ * @param indices Rows of the keys, or nullptr for the rows of `input` in order
+ * @param descending True if the keys are in descending order
+ * @param keys Output keys, one for each row of `input` or of `indices`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compute_radix_keys(column_view const& input,
+                        size_type const* indices,
+                        bool descending,
+                        uint64_t* keys,
+                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Sorts the indices of the rows of `input` by radix sorting normalized keys
+ *
+ * Each column is mapped to unsigned 64-bit keys whose order matches the order of the column,
+ * including its `column_order`, with a separate key for the null rows of a nullable column.
+ * Stable radix sorts of these keys, from the last column to the first, give the lexicographic
+ * order of the rows. The sort is stable and treats all `NaN`s as equal, like the row comparator.
+ *
+ * Precondition: `is_radix_sortable(input)` returned true.
+ *
+ * @param input Table to sort
+ * @param column_order The desired order of each column, or empty for ascending order
+ * @param null_precedence How the nulls of each column are ordered, or empty for null_order::BEFORE
+ * @param indices Indices of the input rows to sort, sorted in place
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void radix_sorted_order(table_view const& input,
+                        std::vector<order> const& column_order,
+                        std::vector<null_order> const& null_precedence,
+                        mutable_column_view& indices,
+                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Sorts the indices of the rows of the strings column `input` by radix sorting the first
+ * bytes of the strings
+ *
+ * The strings are radix sorted by their first 8 bytes, and only the rows of the runs of equal
+ * prefixes are then sorted by comparing the full strings. The sort is stable.
+ *
+ * @param input Strings column to sort
+ * @param indices Indices of the input rows to sort, sorted in place
+ * @param ascending True if sort order is ascending
+ * @param null_precedence How null rows are to be ordered
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void string_prefix_sorted_order(column_view const& input,
+                                mutable_column_view& indices,
+                                bool ascending,
+                                null_order null_precedence,
+                                rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
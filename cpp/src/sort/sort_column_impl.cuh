@@ -17,6 +17,7 @@
 #pragma once
 
 #include "common_sort_impl.cuh"
+#include "radix_sort.hpp"
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
@@ -30,6 +31,8 @@
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace detail {
 
@@ -184,7 +187,10 @@ struct column_sorted_order_fn {
                   null_order null_precedence,
                   rmm::cuda_stream_view stream)
   {
-    if constexpr (is_faster_sort_supported<T>()) {
+    if constexpr (std::is_same_v<T, string_view>) {
+      // Strings are radix sorted by their prefixes, the full strings only break prefix ties
+      string_prefix_sorted_order(input, indices, ascending, null_precedence, stream);
+    } else if constexpr (is_faster_sort_supported<T>()) {
       if (input.has_nulls()) {
         sorted_order<T>(input, indices, ascending, null_precedence, stream);
       } else {
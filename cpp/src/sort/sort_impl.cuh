@@ -17,9 +17,11 @@
 #pragma once
 
 #include "common_sort_impl.cuh"
+#include "radix_sort.hpp"
 #include "sort_column_impl.cuh"
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -58,7 +60,10 @@ std::unique_ptr<column> sorted_order(table_view input,
 
   // fast-path for single column sort
   if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
-    auto const single_col = input.column(0);
+    // The keys of a dictionary are sorted, so its indices sort in the order of its values
+    auto const single_col = input.column(0).type().id() == type_id::DICTIONARY32
+                              ? dictionary_column_view(input.column(0)).get_indices_annotated()
+                              : input.column(0);
     auto const col_order  = column_order.empty() ? order::ASCENDING : column_order.front();
     auto const null_prec  = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
     return sorted_order<method>(single_col, col_order, null_prec, stream, mr);
@@ -72,6 +77,12 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    0);
 
+  // Fixed-width keys are radix sorted column by column instead of merge sorted by row
+  if (is_radix_sortable(input)) {
+    radix_sorted_order(input, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+
   auto const do_sort = [&](auto const comparator) {
     // Compiling `thrust::*sort*` APIs is expensive.
     // Thus, we should optimize that by using constexpr condition to only compile what we need.
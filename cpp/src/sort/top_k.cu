@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radix_sort.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/lists/detail/lists_column_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Number of the bits of the keys selected by each pass of the radix select
+constexpr int radix_bits = 8;
+constexpr int radix_bins = 1 << radix_bits;
+
+constexpr size_type histogram_block_size      = 256;
+constexpr size_type histogram_rows_per_thread = 16;
+
+/**
+ * @brief Counts the valid rows whose keys have the bits of `prefix`, by their next digit
+ *
+ * @param d_column Rows of the keys
+ * @param keys Radix sort keys of the rows
+ * @param prefix The digits of the keys already selected
+ * @param prefix_mask The bits of the digits of `prefix`
+ * @param shift Position of the counted digit
+ * @param histogram Number of the rows of each value of the counted digit
+ */
+CUDF_KERNEL void radix_histogram_kernel(column_device_view d_column,
+                                        uint64_t const* __restrict__ keys,
+                                        uint64_t prefix,
+                                        uint64_t prefix_mask,
+                                        int shift,
+                                        size_type* __restrict__ histogram)
+{
+  __shared__ size_type block_histogram[radix_bins];
+  for (auto bin = threadIdx.x; bin < radix_bins; bin += blockDim.x) {
+    block_histogram[bin] = 0;
+  }
+  __syncthreads();
+
+  auto tid          = cudf::detail::grid_1d::global_thread_id();
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  while (tid < d_column.size()) {
+    auto const row = static_cast<size_type>(tid);
+    auto const key = keys[row];
+    if (d_column.is_valid(row) and (key & prefix_mask) == prefix) {
+      atomicAdd(&block_histogram[(key >> shift) & (radix_bins - 1)], 1);
+    }
+    tid += stride;
+  }
+  __syncthreads();
+
+  for (auto bin = threadIdx.x; bin < radix_bins; bin += blockDim.x) {
+    if (block_histogram[bin] != 0) { atomicAdd(&histogram[bin], block_histogram[bin]); }
+  }
+}
+
+/**
+ * @brief Returns whether a row is valid and its key is less than a key, or equal to it if `equal`
+ */
+template <bool equal>
+struct is_selected_key_fn {
+  column_device_view d_column;
+  uint64_t const* keys;
+  uint64_t key;
+
+  __device__ bool operator()(size_type row) const
+  {
+    if (not d_column.is_valid(row)) { return false; }
+    return equal ? keys[row] == key : keys[row] < key;
+  }
+};
+
+/**
+ * @brief Returns whether a row is null
+ */
+struct is_null_row_fn {
+  column_device_view d_column;
+
+  __device__ bool operator()(size_type row) const { return d_column.is_null(row); }
+};
+
+/**
+ * @brief Writes the `k` valid rows of `input` with the smallest keys to `output`, in sorted order
+ *
+ * The k-th smallest key is found one digit at a time from the histograms of the digits of the
+ * keys with the digits already found. The rows with smaller keys and the first rows with the k-th
+ * key are then the selected rows, so that the ties are in the order of a stable sort.
+ */
+void radix_select(column_view const& input,
+                  rmm::device_uvector<uint64_t> const& keys,
+                  size_type k,
+                  size_type* output,
+                  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.size();
+  auto const d_column = column_device_view::create(input, stream);
+  auto const grid =
+    cudf::detail::grid_1d{num_rows, histogram_block_size, histogram_rows_per_thread};
+
+  rmm::device_uvector<size_type> histogram(radix_bins, stream);
+  uint64_t prefix      = 0;
+  uint64_t prefix_mask = 0;
+  auto remaining       = k;
+  auto num_equal       = size_type{0};
+  for (auto shift = 64 - radix_bits; shift >= 0; shift -= radix_bits) {
+    CUDF_CUDA_TRY(
+      cudaMemsetAsync(histogram.data(), 0, histogram.size() * sizeof(size_type), stream.value()));
+    radix_histogram_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_column, keys.data(), prefix, prefix_mask, shift, histogram.data());
+    auto const h_histogram = cudf::detail::make_std_vector_sync(histogram, stream);
+
+    auto bin = 0;
+    while (h_histogram[bin] < remaining) {
+      remaining -= h_histogram[bin];
+      ++bin;
+    }
+    num_equal = h_histogram[bin];
+    prefix |= static_cast<uint64_t>(bin) << shift;
+    prefix_mask |= static_cast<uint64_t>(radix_bins - 1) << shift;
+  }
+
+  // `prefix` is now the k-th smallest key, and `remaining` rows with this key are selected
+  auto const rows     = thrust::make_counting_iterator<size_type>(0);
+  auto const less_end = thrust::copy_if(rmm::exec_policy(stream),
+                                        rows,
+                                        rows + num_rows,
+                                        output,
+                                        is_selected_key_fn<false>{*d_column, keys.data(), prefix});
+  rmm::device_uvector<size_type> equal_rows(num_equal, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  rows,
+                  rows + num_rows,
+                  equal_rows.begin(),
+                  is_selected_key_fn<true>{*d_column, keys.data(), prefix});
+  thrust::copy(
+    rmm::exec_policy(stream), equal_rows.begin(), equal_rows.begin() + remaining, less_end);
+
+  // The selected rows are in row order, so a stable sort of their keys keeps the ties in order
+  rmm::device_uvector<uint64_t> selected_keys(k, stream);
+  thrust::gather(rmm::exec_policy(stream), output, output + k, keys.begin(), selected_keys.begin());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), selected_keys.begin(), selected_keys.end(), output);
+}
+
+/**
+ * @brief Returns the top `k` rows of a single fixed-width column selected by the radix select
+ */
+std::unique_ptr<column> radix_top_k(column_view const& input,
+                                    size_type k,
+                                    order column_order,
+                                    null_order null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto const num_rows   = input.size();
+  auto const descending = column_order == order::DESCENDING;
+  rmm::device_uvector<uint64_t> keys(num_rows, stream);
+  compute_radix_keys(input, nullptr, descending, keys.data(), stream);
+
+  // Descending order reverses the null precedence, like the row comparator
+  auto const nulls_first = (null_precedence == null_order::BEFORE) != descending;
+  auto const num_nulls   = input.null_count();
+  auto const num_valid_k =
+    nulls_first ? k - std::min(k, num_nulls) : std::min(k, num_rows - num_nulls);
+  auto const num_null_k = k - num_valid_k;
+
+  auto result = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+  auto const d_result     = result->mutable_view().begin<size_type>();
+  auto const valid_output = nulls_first ? d_result + num_null_k : d_result;
+  if (num_valid_k > 0) { radix_select(input, keys, num_valid_k, valid_output, stream); }
+
+  if (num_null_k > 0) {
+    // The nulls are all equal, so the first null rows are selected
+    auto const d_column = column_device_view::create(input, stream);
+    auto const rows     = thrust::make_counting_iterator<size_type>(0);
+    rmm::device_uvector<size_type> null_rows(num_nulls, stream);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    rows,
+                    rows + num_rows,
+                    null_rows.begin(),
+                    is_null_row_fn{*d_column});
+    thrust::copy(rmm::exec_policy(stream),
+                 null_rows.begin(),
+                 null_rows.begin() + num_null_k,
+                 nulls_first ? d_result : d_result + num_valid_k);
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the sorted position of the top rows of each segment
+ */
+struct segmented_top_k_fn {
+  size_type const* sorted_indices;
+  size_type const* segment_offsets;
+  size_type const* result_offsets;
+  size_type const* labels;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const segment = labels[i];
+    return sorted_indices[segment_offsets[segment] + i - result_offsets[segment]];
+  }
+};
+
+/**
+ * @brief Returns the number of the top rows of each segment
+ */
+struct segment_top_k_size_fn {
+  size_type const* segment_offsets;
+  size_type k;
+
+  __device__ size_type operator()(size_type segment) const
+  {
+    auto const size = segment_offsets[segment + 1] - segment_offsets[segment];
+    return size < k ? size : k;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must be non-negative", std::invalid_argument);
+  k = std::min(k, keys.num_rows());
+
+  if (keys.num_columns() == 1 and k > 0 and k < keys.num_rows() and is_radix_sortable(keys)) {
+    auto const col_order = column_order.empty() ? order::ASCENDING : column_order.front();
+    auto const null_prec = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+    return radix_top_k(keys.column(0), k, col_order, null_prec, stream, mr);
+  }
+
+  // The other keys are sorted, and only the first rows of the sorted order are kept
+  auto const sorted = cudf::detail::stable_sorted_order(
+    keys, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  return std::make_unique<column>(
+    cudf::detail::slice(sorted->view(), {0, k}, stream).front(), stream, mr);
+}
+
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must be non-negative", std::invalid_argument);
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment offsets should be size_type");
+  auto const num_segments = std::max(segment_offsets.size() - 1, 0);
+  if (num_segments == 0) {
+    return cudf::lists::detail::make_empty_lists_column(
+      data_type(type_to_id<size_type>()), stream, mr);
+  }
+
+  // The segments are sorted by the segmented radix sort, which sorts each segment in shared
+  // memory, then the first rows of each segment are kept
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const sorted  = cudf::detail::stable_segmented_sorted_order(
+    keys, segment_offsets, column_order, null_precedence, stream, temp_mr);
+  auto const d_segment_offsets = segment_offsets.begin<size_type>();
+
+  auto const sizes = cudf::detail::make_counting_transform_iterator(
+    0, segment_top_k_size_fn{d_segment_offsets, k});
+  auto [offsets, num_indices] =
+    cudf::detail::make_offsets_child_column(sizes, sizes + num_segments, stream, mr);
+  auto const d_offsets = offsets->view().begin<size_type>();
+
+  rmm::device_uvector<size_type> labels(num_indices, stream);
+  cudf::detail::label_segments(
+    d_offsets, d_offsets + num_segments + 1, labels.begin(), labels.end(), stream);
+
+  auto indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_indices, mask_state::UNALLOCATED, stream, mr);
+  auto const d_sorted = sorted->view().begin<size_type>();
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_indices),
+                    indices->mutable_view().begin<size_type>(),
+                    segmented_top_k_fn{d_sorted, d_segment_offsets, d_offsets, labels.data()});
+
+  return make_lists_column(
+    num_segments, std::move(offsets), std::move(indices), 0, rmm::device_buffer{}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_top_k(
+    keys, segment_offsets, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
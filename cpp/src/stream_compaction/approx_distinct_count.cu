@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda/atomic>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Updates the HyperLogLog register of the hash of each row with the rank of the hash
+ *
+ * The first `precision` bits of the hash select the register, and the rank is the position of the
+ * first set bit of the remaining bits. Each register holds the maximum rank of its rows.
+ */
+template <typename Hasher>
+struct update_registers_fn {
+  Hasher d_hash;
+  bitmask_type const* row_bitmask;  ///< Rows to count, or nullptr to count all rows
+  int32_t precision;
+  int32_t* registers;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row)) { return; }
+    auto const hash = static_cast<uint32_t>(d_hash(row));
+    auto const rest = hash << precision;
+    auto const rank = rest == 0 ? 32 - precision + 1 : __clz(rest) + 1;
+    auto& reg       = registers[hash >> (32 - precision)];
+    // Most rows do not raise their register, so the atomic update is skipped for them
+    if (rank > reg) {
+      cuda::atomic_ref<int32_t, cuda::thread_scope_device> ref{reg};
+      ref.fetch_max(rank, cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+/**
+ * @brief Returns the HyperLogLog estimate of the number of distinct hashes of `registers`
+ *
+ * The raw estimate is corrected by linear counting for small cardinalities and for the
+ * collisions of the 32-bit hashes for large cardinalities.
+ */
+double estimate_cardinality(std::vector<int32_t> const& registers)
+{
+  auto const m     = static_cast<double>(registers.size());
+  auto const alpha = registers.size() == 16   ? 0.673
+                     : registers.size() == 32 ? 0.697
+                     : registers.size() == 64 ? 0.709
+                                              : 0.7213 / (1.0 + 1.079 / m);
+
+  double sum          = 0;
+  int64_t empty_count = 0;
+  for (auto const reg : registers) {
+    sum += std::ldexp(1.0, -reg);
+    empty_count += reg == 0;
+  }
+  auto const estimate = alpha * m * m / sum;
+
+  auto constexpr hash_space = 4294967296.0;  // 2^32
+  if (estimate <= 2.5 * m and empty_count > 0) {
+    return m * std::log(m / static_cast<double>(empty_count));
+  }
+  if (estimate > hash_space / 30.0) {
+    return -hash_space * std::log1p(-std::min(estimate / hash_space, 1.0 - 1e-9));
+  }
+  return estimate;
+}
+
+}  // namespace
+
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision,
+                                      null_policy null_handling,
+                                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HyperLogLog precision must be in the range [4, 18]",
+               std::invalid_argument);
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) { return 0; }
+
+  auto const has_nulls  = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
+  auto const d_hash     = row_hasher.device_hasher(has_nulls);
+
+  // Rows with a null are skipped when nulls are excluded
+  auto const skip_nulls = null_handling == null_policy::EXCLUDE and has_nulls;
+  auto const row_bitmask =
+    skip_nulls ? cudf::detail::bitmask_and(input, stream, rmm::mr::get_current_device_resource())
+                   .first
+               : rmm::device_buffer{};
+
+  auto registers = cudf::detail::make_zeroed_device_uvector_async<int32_t>(
+    size_type{1} << precision, stream, rmm::mr::get_current_device_resource());
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    update_registers_fn<decltype(d_hash)>{d_hash,
+                                          static_cast<bitmask_type const*>(row_bitmask.data()),
+                                          precision,
+                                          registers.data()});
+
+  auto const estimate = estimate_cardinality(cudf::detail::make_std_vector_sync(registers, stream));
+  return static_cast<size_type>(std::min(std::llround(estimate), static_cast<long long>(num_rows)));
+}
+
+}  // namespace detail
+
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision,
+                                      null_policy null_handling)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(
+    input, precision, null_handling, cudf::get_default_stream());
+}
+
+}  // namespace cudf
@@ -21,6 +21,8 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/hashing/detail/cached_row_hasher.cuh>
+#include <cudf/strings/detail/string_prefix.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -41,6 +43,7 @@ namespace cudf {
 namespace detail {
 
 rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                hash_value_type const* row_hashes,
                                                 duplicate_keep_option keep,
                                                 null_equality nulls_equal,
                                                 nan_equality nans_equal,
@@ -63,7 +66,8 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
   auto const has_nested_columns = cudf::detail::has_nested_columns(input);
 
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
-  auto const key_hasher = row_hasher.device_hasher(has_nulls);
+  auto const key_hasher =
+    cudf::hashing::detail::make_cached_row_hasher(row_hasher.device_hasher(has_nulls), row_hashes);
 
   auto const row_comp = cudf::experimental::row::equality::self_comparator(preprocessed_input);
 
@@ -72,10 +76,23 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
     cuda::proclaim_return_type<cuco::pair<size_type, size_type>>(
       [] __device__(size_type const i) { return cuco::make_pair(i, i); }));
 
+  // a single strings column is compared by the inline prefixes of its strings first
+  auto const is_strings =
+    input.num_columns() == 1 and input.column(0).type().id() == type_id::STRING;
+  auto const prefixes =
+    is_strings ? cudf::strings::detail::make_string_prefixes(
+                   input.column(0), stream, rmm::mr::get_current_device_resource())
+               : rmm::device_uvector<cudf::strings::detail::string_prefix>(0, stream);
+
   auto const insert_keys = [&](auto const value_comp) {
     if (has_nested_columns) {
       auto const key_equal = row_comp.equal_to<true>(has_nulls, nulls_equal, value_comp);
       map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
+    } else if (is_strings) {
+      auto const row_equal = row_comp.equal_to<false>(has_nulls, nulls_equal, value_comp);
+      auto const key_equal = cudf::strings::detail::string_prefix_equal_fn<decltype(row_equal)>{
+        prefixes.data(), row_equal};
+      map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
     } else {
       auto const key_equal = row_comp.equal_to<false>(has_nulls, nulls_equal, value_comp);
       map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
@@ -108,6 +125,7 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
                                                keep,
                                                nulls_equal,
                                                nans_equal,
+                                               row_hashes,
                                                stream,
                                                rmm::mr::get_current_device_resource());
 
@@ -140,8 +158,19 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
   return output_indices;
 }
 
+rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                nan_equality nans_equal,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  return distinct_indices(input, nullptr, keep, nulls_equal, nans_equal, stream, mr);
+}
+
 std::unique_ptr<table> distinct(table_view const& input,
                                 std::vector<size_type> const& keys,
+                                hash_value_type const* key_hashes,
                                 duplicate_keep_option keep,
                                 null_equality nulls_equal,
                                 nan_equality nans_equal,
@@ -153,6 +182,7 @@ std::unique_ptr<table> distinct(table_view const& input,
   }
 
   auto const gather_map = detail::distinct_indices(input.select(keys),
+                                                   key_hashes,
                                                    keep,
                                                    nulls_equal,
                                                    nans_equal,
@@ -166,6 +196,17 @@ std::unique_ptr<table> distinct(table_view const& input,
                         mr);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  return distinct(input, keys, nullptr, keep, nulls_equal, nans_equal, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> distinct(table_view const& input,
@@ -192,4 +233,39 @@ std::unique_ptr<column> distinct_indices(table_view const& input,
   return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                column_view const& key_hashes,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  hashing::detail::expects_row_hashes(key_hashes, input.num_rows());
+  return detail::distinct(input,
+                          keys,
+                          key_hashes.begin<hash_value_type>(),
+                          keep,
+                          nulls_equal,
+                          nans_equal,
+                          cudf::get_default_stream(),
+                          mr);
+}
+
+std::unique_ptr<column> distinct_indices(table_view const& input,
+                                         column_view const& row_hashes,
+                                         duplicate_keep_option keep,
+                                         null_equality nulls_equal,
+                                         nan_equality nans_equal,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  hashing::detail::expects_row_hashes(row_hashes, input.num_rows());
+  auto indices = detail::distinct_indices(
+    input, row_hashes.begin<hash_value_type>(), keep, nulls_equal, nans_equal, stream, mr);
+  return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
+}
+
 }  // namespace cudf
@@ -26,6 +26,7 @@
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/strings/detail/string_prefix.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -176,6 +177,13 @@ cudf::size_type distinct_count(table_view const& keys,
   if (cudf::detail::has_nested_columns(keys)) {
     auto const row_equal = row_comp.equal_to<true>(has_nulls, nulls_equal);
     return comparator_helper(row_equal);
+  } else if (keys.num_columns() == 1 and keys.column(0).type().id() == type_id::STRING) {
+    // a single strings column is compared by the inline prefixes of its strings first
+    auto const prefixes = cudf::strings::detail::make_string_prefixes(
+      keys.column(0), stream, rmm::mr::get_current_device_resource());
+    auto const row_equal = row_comp.equal_to<false>(has_nulls, nulls_equal);
+    return comparator_helper(cudf::strings::detail::string_prefix_equal_fn<decltype(row_equal)>{
+      prefixes.data(), row_equal});
   } else {
     auto const row_equal = row_comp.equal_to<false>(has_nulls, nulls_equal);
     return comparator_helper(row_equal);
@@ -89,6 +89,7 @@ rmm::device_uvector<size_type> reduce_by_row(
   duplicate_keep_option keep,
   null_equality nulls_equal,
   nan_equality nans_equal,
+  hash_value_type const* row_hashes,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
 {
@@ -104,6 +105,7 @@ rmm::device_uvector<size_type> reduce_by_row(
                             nans_equal,
                             reduce_func_builder{keep},
                             reduction_init_value(keep),
+                            row_hashes,
                             stream,
                             mr);
 }
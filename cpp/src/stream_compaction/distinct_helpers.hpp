@@ -16,6 +16,7 @@
 
 #include "stream_compaction_common.hpp"
 
+#include <cudf/hashing.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
@@ -69,6 +70,8 @@ auto constexpr reduction_init_value(duplicate_keep_option keep)
  * @param nulls_equal Flag to specify whether null elements should be considered as equal
  * @param nans_equal Flag to specify whether NaN values in floating point column should be
  *        considered equal.
+ * @param row_hashes Precomputed hash value of each input row used to build `map`, or
+ *        nullptr to hash the rows
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned vector
  * @return A device_uvector containing the reduction results
@@ -82,6 +85,7 @@ rmm::device_uvector<size_type> reduce_by_row(
   duplicate_keep_option keep,
   null_equality nulls_equal,
   nan_equality nans_equal,
+  hash_value_type const* row_hashes,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr);
 
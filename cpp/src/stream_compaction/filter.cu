@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/expression_evaluator.cuh>
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/atomic>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Kernel evaluating a boolean expression on each row into a bitmask of the passing rows.
+ *
+ * Each warp evaluates 32 consecutive rows and writes their results as one bitmask word, so the
+ * predicate is stored in 1 bit per row instead of a BOOL8 column and its null mask. Rows that
+ * are not in `selected` are not evaluated.
+ *
+ * @tparam max_block_size The size of the thread block, used to set launch bounds
+ * @tparam has_nulls Whether or not the expression may evaluate to null
+ *
+ * @param table The table device view used for evaluation
+ * @param device_expression_data Container of device data required to evaluate the expression
+ * @param selected Bitmask of the rows to evaluate, or nullptr to evaluate all rows
+ * @param passed Output bitmask with a set bit for each row evaluating to a non-null `true`
+ * @param num_passed Output count of the set bits of `passed`, zero-initialized
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) CUDF_KERNEL
+  void evaluate_predicate_kernel(table_device_view const table,
+                                 ast::detail::expression_device_view device_expression_data,
+                                 bitmask_type const* selected,
+                                 bitmask_type* passed,
+                                 size_type* num_passed)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+  auto const start_idx = cudf::detail::grid_1d::global_thread_id();
+  auto const stride    = cudf::detail::grid_1d::grid_stride();
+  auto const num_rows  = table.num_rows();
+  auto evaluator =
+    cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+
+  size_type count = 0;
+  // Block sizes and strides are multiples of the warp size, so every lane of a warp stays in the
+  // loop for the same word of `passed`
+  for (thread_index_type row_index = start_idx; row_index - (row_index % warp_size) < num_rows;
+       row_index += stride) {
+    bool is_passed = false;
+    if (row_index < num_rows and (selected == nullptr or bit_is_set(selected, row_index))) {
+      auto output_dest = ast::detail::value_expression_result<bool, has_nulls>();
+      evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
+      is_passed = output_dest.is_valid() && output_dest.value();
+    }
+    auto const word = __ballot_sync(0xffff'ffffu, is_passed);
+    if (row_index % warp_size == 0) {
+      passed[word_index(row_index)] = word;
+      count += __popc(word);
+    }
+  }
+  if (count > 0) {
+    cuda::atomic_ref<size_type, cuda::thread_scope_device> ref{*num_passed};
+    ref.fetch_add(count, cuda::std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief The copy_if filter selecting the rows with a set bit in a bitmask
+ */
+struct bitmask_filter {
+  bitmask_type const* passed;
+
+  __device__ inline bool operator()(size_type i) const { return bit_is_set(passed, i); }
+};
+
+/**
+ * @brief Evaluates `predicate` on the rows of `input` in `selected` (all rows if nullptr)
+ */
+selection_vector evaluate_predicate(table_view const& input,
+                                    ast::expression const& predicate,
+                                    bitmask_type const* selected,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto const has_nulls = predicate.may_evaluate_null(input, stream);
+  auto const parser    = ast::detail::expression_parser{
+    predicate, input, has_nulls, stream, rmm::mr::get_current_device_resource()};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The predicate expression must produce a boolean output.");
+
+  auto passed = rmm::device_buffer(bitmask_allocation_size_bytes(input.num_rows()), stream, mr);
+  if (input.num_rows() == 0) { return selection_vector{std::move(passed), 0, 0}; }
+
+  // Configure kernel parameters as for compute_column
+  auto const& device_expression_data = parser.device_expression_data;
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const block_size =
+    parser.shmem_per_thread != 0
+      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread)
+      : MAX_BLOCK_SIZE;
+  // Whole warps are needed to write whole bitmask words
+  auto const warp_block_size = std::max(warp_size, block_size - block_size % warp_size);
+  auto const config          = cudf::detail::grid_1d{input.num_rows(), warp_block_size};
+  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  rmm::device_scalar<size_type> num_passed{0, stream};
+  auto table_device   = table_device_view::create(input, stream);
+  auto const d_passed = static_cast<bitmask_type*>(passed.data());
+  if (has_nulls) {
+    evaluate_predicate_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, selected, d_passed, num_passed.data());
+  } else {
+    evaluate_predicate_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, selected, d_passed, num_passed.data());
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  return selection_vector{std::move(passed), input.num_rows(), num_passed.value(stream)};
+}
+
+/**
+ * @brief Selects the rows in `selected` (all rows if nullptr) where `boolean_mask` is true
+ */
+selection_vector select_by_mask(column_view const& boolean_mask,
+                                bitmask_type const* selected,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+
+  auto const d_mask       = column_device_view::create(boolean_mask, stream);
+  auto [mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(boolean_mask.size()),
+    [d_mask = *d_mask, selected] __device__(size_type i) {
+      return (selected == nullptr or bit_is_set(selected, i)) and d_mask.is_valid(i) and
+             d_mask.element<bool>(i);
+    },
+    stream,
+    mr);
+  return selection_vector{std::move(mask), boolean_mask.size(), boolean_mask.size() - null_count};
+}
+
+}  // namespace
+
+selection_vector make_selection(column_view const& boolean_mask,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  return select_by_mask(boolean_mask, nullptr, stream, mr);
+}
+
+selection_vector make_selection(table_view const& input,
+                                ast::expression const& predicate,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  return evaluate_predicate(input, predicate, nullptr, stream, mr);
+}
+
+selection_vector refine_selection(selection_vector const& selection,
+                                  column_view const& boolean_mask,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(boolean_mask.size() == selection.size, "Column size mismatch");
+  return select_by_mask(
+    boolean_mask, static_cast<bitmask_type const*>(selection.mask.data()), stream, mr);
+}
+
+selection_vector refine_selection(selection_vector const& selection,
+                                  table_view const& input,
+                                  ast::expression const& predicate,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(input.num_rows() == selection.size, "Column size mismatch");
+  return evaluate_predicate(
+    input, predicate, static_cast<bitmask_type const*>(selection.mask.data()), stream, mr);
+}
+
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection_vector const& selection,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(input.num_rows() == selection.size, "Column size mismatch");
+  if (selection.num_selected == 0) { return empty_like(input); }
+  if (selection.num_selected == selection.size) {
+    return std::make_unique<table>(input, stream, mr);
+  }
+  return detail::copy_if(
+    input, bitmask_filter{static_cast<bitmask_type const*>(selection.mask.data())}, stream, mr);
+}
+
+std::unique_ptr<column> selection_to_indices(selection_vector const& selection,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  auto indices = make_numeric_column(data_type{type_to_id<size_type>()},
+                                     selection.num_selected,
+                                     mask_state::UNALLOCATED,
+                                     stream,
+                                     mr);
+  if (selection.num_selected == 0) { return indices; }
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(selection.size),
+                  indices->mutable_view().begin<size_type>(),
+                  bitmask_filter{static_cast<bitmask_type const*>(selection.mask.data())});
+  return indices;
+}
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  auto const selection =
+    evaluate_predicate(input, predicate, nullptr, stream, rmm::mr::get_current_device_resource());
+  return apply_selection(input, selection, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(input, predicate, cudf::get_default_stream(), mr);
+}
+
+selection_vector make_selection(column_view const& boolean_mask,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection(boolean_mask, cudf::get_default_stream(), mr);
+}
+
+selection_vector make_selection(table_view const& input,
+                                ast::expression const& predicate,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection(input, predicate, cudf::get_default_stream(), mr);
+}
+
+selection_vector refine_selection(selection_vector const& selection,
+                                  column_view const& boolean_mask,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::refine_selection(selection, boolean_mask, cudf::get_default_stream(), mr);
+}
+
+selection_vector refine_selection(selection_vector const& selection,
+                                  table_view const& input,
+                                  ast::expression const& predicate,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::refine_selection(selection, input, predicate, cudf::get_default_stream(), mr);
+}
+
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection_vector const& selection,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_selection(input, selection, cudf::get_default_stream(), mr);
+}
+
+std::unique_ptr<column> selection_to_indices(selection_vector const& selection,
+                                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::selection_to_indices(selection, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -36,13 +37,24 @@ namespace strings {
 namespace detail {
 
 namespace {
+
+/**
+ * @brief Threshold to decide on using a warp per string for contains_re
+ *
+ * Strings with at least this many bytes on average are searched by a full warp.
+ */
+constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 256;
+
 /**
  * @brief This functor handles both contains_re and match_re to regex-match a pattern
  * to each string in a column.
+ *
+ * The DFA is used when available and the NFA evaluates any string the DFA cannot.
  */
 struct contains_fn {
   column_device_view const d_strings;
   bool const beginning_only;
+  redfa_device const d_dfa;
 
   __device__ bool operator()(size_type const idx,
                              reprog_device const prog,
@@ -51,12 +63,45 @@ struct contains_fn {
     if (d_strings.is_null(idx)) return false;
     auto const d_str = d_strings.element<string_view>(idx);
 
+    if (d_dfa.is_valid()) {
+      auto const result = d_dfa.is_match(d_str);
+      if (result.has_value()) { return result.value(); }
+    }
+
     size_type end = beginning_only ? 1    // match only the beginning of the string;
                                    : -1;  // match anywhere in the string
     return prog.find(thread_idx, d_str, d_str.begin(), end).has_value();
   }
 };
 
+/**
+ * @brief This functor searches a string for contains_re using a full warp
+ *
+ * Each lane only starts matches within its own contiguous range of character positions.
+ * A match may extend past the end of the range.
+ */
+struct contains_warp_fn {
+  column_device_view const d_strings;
+
+  __device__ bool operator()(size_type const idx,
+                             reprog_device const prog,
+                             int32_t const thread_idx,
+                             int32_t const lane_idx)
+  {
+    if (d_strings.is_null(idx)) { return false; }
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const length = d_str.length();
+    auto const chunk  = cudf::util::div_rounding_up_safe(length, cudf::detail::warp_size);
+
+    auto const begin = lane_idx * chunk;
+    // lane 0 always runs so an empty string can match an empty pattern
+    if (begin >= length && lane_idx > 0) { return false; }
+    // the last range includes the position past the end of the string
+    auto const end = (begin + chunk) >= length ? -1 : begin + chunk;
+    return prog.find(thread_idx, d_str, d_str.begin() + begin, end).has_value();
+  }
+};
+
 std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                       regex_program const& prog,
                                       bool const beginning_only,
@@ -72,12 +117,24 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
   if (input.is_empty()) { return results; }
 
   auto d_prog = regex_device_builder::create_prog_device(prog, stream);
+  auto d_dfa  = regex_device_builder::create_dfa_device(prog, beginning_only, stream);
 
   auto d_results       = results->mutable_view().data<bool>();
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
-  launch_transform_kernel(
-    contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
+  // long strings are searched a warp at a time unless the DFA can scan them
+  auto const valid_count = input.size() - input.null_count();
+  if (!beginning_only && !d_dfa && (valid_count > 0) &&
+      ((input.chars_size(stream) / valid_count) >= AVG_CHAR_BYTES_THRESHOLD)) {
+    launch_warp_any_kernel(contains_warp_fn{*d_strings}, *d_prog, d_results, input.size(), stream);
+  } else {
+    launch_transform_kernel(
+      contains_fn{*d_strings, beginning_only, d_dfa ? *d_dfa : redfa_device{}},
+      *d_prog,
+      d_results,
+      input.size(),
+      stream);
+  }
 
   results->set_null_count(input.null_count());
 
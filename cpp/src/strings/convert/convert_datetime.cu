@@ -46,6 +46,7 @@
 
 #include <map>
 #include <numeric>
+#include <string_view>
 #include <vector>
 
 namespace cudf {
@@ -169,6 +170,51 @@ struct format_compiler {
   [[nodiscard]] int8_t subsecond_precision() const { return specifiers.at('f'); }
 };
 
+/**
+ * @brief Fixed positions of the fields of an ISO-8601 timestamp format
+ *
+ * Formats like `%Y-%m-%dT%H:%M:%S.%3fZ` place every field at a fixed position so
+ * strings with exactly the expected size can be parsed without walking the format items.
+ */
+struct iso_layout {
+  size_type size{};           ///< bytes of a fixed-width string or 0 if not ISO-8601
+  bool has_time{};            ///< true if the hour, minute, and second follow the date
+  int8_t subsecond_digits{};  ///< digits following the seconds or 0 if none
+
+  /**
+   * @brief Returns the layout of the given format or an empty layout if the format
+   * is not one of the supported ISO-8601 variants
+   *
+   * The supported formats are `%Y-%m-%d` optionally followed by `T` or space and
+   * `%H:%M:%S`, then optionally by `.%f` or `.%<n>f`, and then optionally by `Z`.
+   */
+  static iso_layout from_format(std::string_view format)
+  {
+    auto const consume = [&format](std::string_view prefix) {
+      if (format.substr(0, prefix.size()) != prefix) { return false; }
+      format.remove_prefix(prefix.size());
+      return true;
+    };
+
+    iso_layout layout{10};
+    if (!consume("%Y-%m-%d")) { return {}; }
+    if (format.empty()) { return layout; }
+    if (!consume("T%H:%M:%S") && !consume(" %H:%M:%S")) { return {}; }
+    layout.has_time = true;
+    layout.size     = 19;
+    if (consume(".%f")) {
+      layout.subsecond_digits = 6;
+    } else if (format.size() >= 4 && consume(".%") && format[0] >= '1' && format[0] <= '9' &&
+               format[1] == 'f') {
+      layout.subsecond_digits = static_cast<int8_t>(format[0] - '0');
+      format.remove_prefix(2);
+    }
+    if (layout.subsecond_digits > 0) { layout.size += 1 + layout.subsecond_digits; }
+    if (consume("Z")) { ++layout.size; }
+    return format.empty() ? layout : iso_layout{};
+  }
+};
+
 /**
  * @brief Specialized function to return the integer value reading up to the specified
  * bytes or until an invalid character is encountered.
@@ -198,6 +244,7 @@ struct parse_datetime {
   column_device_view const d_strings;
   device_span<format_item const> const d_format_items;
   int8_t const subsecond_precision;
+  iso_layout const layout;
 
   /**
    * @brief Return power of ten value given an exponent.
@@ -346,6 +393,43 @@ struct parse_datetime {
     return timeparts;
   }
 
+  /**
+   * @brief Parses a string matching the size of `layout` by reading each field at its position
+   *
+   * @return The components or empty if a field contains a non-digit character
+   */
+  [[nodiscard]] __device__ thrust::optional<timestamp_components> parse_iso_parts(
+    string_view const& d_string) const
+  {
+    auto const ptr = d_string.data();
+    bool is_valid  = true;
+
+    auto const digits_at = [ptr, &is_valid](size_type pos, size_type count) {
+      int32_t value = 0;
+      for (auto idx = pos; idx < pos + count; ++idx) {
+        auto const digit = static_cast<int32_t>(ptr[idx] - '0');
+        is_valid         = is_valid && (digit >= 0) && (digit <= 9);
+        value            = (value * 10) + digit;
+      }
+      return value;
+    };
+
+    timestamp_components timeparts = {1970, 1, 1, 0};  // init to epoch time
+    timeparts.year                 = static_cast<int16_t>(digits_at(0, 4));
+    timeparts.month                = static_cast<int8_t>(digits_at(5, 2));
+    timeparts.day                  = static_cast<int8_t>(digits_at(8, 2));
+    if (layout.has_time) {
+      timeparts.hour   = static_cast<int8_t>(digits_at(11, 2));
+      timeparts.minute = static_cast<int8_t>(digits_at(14, 2));
+      timeparts.second = static_cast<int8_t>(digits_at(17, 2));
+      if (layout.subsecond_digits > 0) {
+        timeparts.subsecond = digits_at(20, layout.subsecond_digits);
+      }
+    }
+    if (!is_valid) { return thrust::nullopt; }
+    return timeparts;
+  }
+
   [[nodiscard]] __device__ int64_t timestamp_from_parts(timestamp_components const& timeparts) const
   {
     // Reference: https://howardhinnant.github.io/date/date.html#Reference
@@ -396,7 +480,14 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return epoch_time;
 
-    auto const timeparts = parse_into_parts(d_str);
+    // strings of the fixed-width size are parsed directly; all others walk the format items
+    auto const timeparts = [&] {
+      if (d_str.size_bytes() == layout.size) {
+        auto const iso_parts = parse_iso_parts(d_str);
+        if (iso_parts.has_value()) { return iso_parts.value(); }
+      }
+      return parse_into_parts(d_str);
+    }();
 
     return T{T::duration(timestamp_from_parts(timeparts))};
   }
@@ -413,7 +504,10 @@ struct dispatch_to_timestamps_fn {
                   rmm::cuda_stream_view stream) const
   {
     format_compiler compiler(format, stream);
-    parse_datetime<T> pfn{d_strings, compiler.format_items(), compiler.subsecond_precision()};
+    parse_datetime<T> pfn{d_strings,
+                          compiler.format_items(),
+                          compiler.subsecond_precision(),
+                          iso_layout::from_format(format)};
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "strings/convert/shortest_float.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
@@ -351,15 +353,119 @@ struct ftos_converter {
   }
 };
 
+/**
+ * @brief Converts float values into the shortest strings that convert back to the same values
+ *
+ * Values whose leading digit is between 1e-4 and 1e9 use positional notation and all others
+ * use scientific notation. Like `ftos_converter`, the output always has a decimal point
+ * followed by at least one digit and the exponent has at least 2 digits.
+ */
+struct shortest_ftos_converter {
+  // sign, 17 digits, "0." and 3 zeros or ".e-308" fit in this many bytes
+  static constexpr int max_size = 32;
+
+  /**
+   * @brief Writes the string for `value` into `output`
+   *
+   * @param value Float value to convert
+   * @param output Memory to write output characters or nullptr to only compute the size
+   * @return Number of bytes required
+   */
+  template <typename FloatType>
+  __device__ int float_to_string(FloatType value, char* output) const
+  {
+    char buffer[max_size];
+    char* ptr = buffer;
+    if (std::isnan(value)) {
+      memcpy(ptr, "NaN", 3);
+      ptr += 3;
+    } else {
+      if (signbit(value)) {  // handles -0.0 too
+        *ptr++ = '-';
+        value  = -value;
+      }
+      if (std::isinf(value)) {
+        memcpy(ptr, "Inf", 3);
+        ptr += 3;
+      } else if (value == 0) {
+        memcpy(ptr, "0.0", 3);
+        ptr += 3;
+      } else {
+        ptr = decimal_to_string(ryu::shortest_decimal(value), ptr);
+      }
+    }
+    auto const bytes = static_cast<int>(ptr - buffer);
+    if (output != nullptr) { memcpy(output, buffer, bytes); }
+    return bytes;
+  }
+
+ private:
+  __device__ char* decimal_to_string(ryu::decimal_value value, char* ptr) const
+  {
+    char digits[20];
+    int count = 0;
+    for (auto d = value.digits; d > 0; d /= 10) {
+      digits[count++] = static_cast<char>('0' + (d % 10));  // reversed: 12345 -> 54321
+    }
+    auto const digit_at = [&](int idx) { return idx < count ? digits[count - 1 - idx] : '0'; };
+    // power of 10 of the leading digit
+    auto const exp10 = count - 1 + value.exponent;
+
+    if (exp10 >= -4 && exp10 < 9) {
+      if (exp10 < 0) {
+        *ptr++ = '0';
+        *ptr++ = '.';
+        for (int idx = exp10 + 1; idx < 0; ++idx) {
+          *ptr++ = '0';
+        }
+        for (int idx = 0; idx < count; ++idx) {
+          *ptr++ = digit_at(idx);
+        }
+        return ptr;
+      }
+      for (int idx = 0; idx <= exp10; ++idx) {
+        *ptr++ = digit_at(idx);
+      }
+      *ptr++ = '.';
+      if (count <= exp10 + 1) {
+        *ptr++ = '0';
+        return ptr;
+      }
+      for (int idx = exp10 + 1; idx < count; ++idx) {
+        *ptr++ = digit_at(idx);
+      }
+      return ptr;
+    }
+
+    *ptr++ = digit_at(0);
+    *ptr++ = '.';
+    if (count == 1) { *ptr++ = '0'; }
+    for (int idx = 1; idx < count; ++idx) {
+      *ptr++ = digit_at(idx);
+    }
+    *ptr++         = 'e';
+    *ptr++         = exp10 < 0 ? '-' : '+';
+    auto const exp = exp10 < 0 ? -exp10 : exp10;
+    if (exp >= 100) { *ptr++ = static_cast<char>('0' + exp / 100); }
+    *ptr++ = static_cast<char>('0' + (exp / 10) % 10);
+    *ptr++ = static_cast<char>('0' + exp % 10);
+    return ptr;
+  }
+};
+
 template <typename FloatType>
 struct from_floats_fn {
   column_device_view d_floats;
-  size_type* d_sizes;
-  char* d_chars;
+  bool shortest;
+  size_type* d_sizes{};
+  char* d_chars{};
   cudf::detail::input_offsetalator d_offsets;
 
   __device__ size_type compute_output_size(FloatType value)
   {
+    if (shortest) {
+      return static_cast<size_type>(shortest_ftos_converter{}.float_to_string(value, nullptr));
+    }
     ftos_converter fts;
     return static_cast<size_type>(fts.compute_ftos_size(static_cast<double>(value)));
   }
@@ -367,6 +473,10 @@ struct from_floats_fn {
   __device__ void float_to_string(size_type idx)
   {
     FloatType value = d_floats.element<FloatType>(idx);
+    if (shortest) {
+      shortest_ftos_converter{}.float_to_string(value, d_chars + d_offsets[idx]);
+      return;
+    }
     ftos_converter fts;
     fts.float_to_string(static_cast<double>(value), d_chars + d_offsets[idx]);
   }
@@ -393,6 +503,7 @@ struct from_floats_fn {
 struct dispatch_from_floats_fn {
   template <typename FloatType, std::enable_if_t<std::is_floating_point_v<FloatType>>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& floats,
+                                     bool shortest,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr) const
   {
@@ -403,8 +514,8 @@ struct dispatch_from_floats_fn {
     // copy the null mask
     rmm::device_buffer null_mask = cudf::detail::copy_bitmask(floats, stream, mr);
 
-    auto [offsets, chars] =
-      make_strings_children(from_floats_fn<FloatType>{d_column}, strings_count, stream, mr);
+    auto [offsets, chars] = make_strings_children(
+      from_floats_fn<FloatType>{d_column, shortest}, strings_count, stream, mr);
 
     return make_strings_column(strings_count,
                                std::move(offsets),
@@ -416,6 +527,7 @@ struct dispatch_from_floats_fn {
   // non-float types throw an exception
   template <typename T, std::enable_if_t<not std::is_floating_point_v<T>>* = nullptr>
   std::unique_ptr<column> operator()(column_view const&,
+                                     bool,
                                      rmm::cuda_stream_view,
                                      rmm::device_async_resource_ref) const
   {
@@ -433,7 +545,17 @@ std::unique_ptr<column> from_floats(column_view const& floats,
   size_type strings_count = floats.size();
   if (strings_count == 0) return make_empty_column(type_id::STRING);
 
-  return type_dispatcher(floats.type(), dispatch_from_floats_fn{}, floats, stream, mr);
+  return type_dispatcher(floats.type(), dispatch_from_floats_fn{}, floats, false, stream, mr);
+}
+
+std::unique_ptr<column> from_floats_shortest(column_view const& floats,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  size_type strings_count = floats.size();
+  if (strings_count == 0) return make_empty_column(type_id::STRING);
+
+  return type_dispatcher(floats.type(), dispatch_from_floats_fn{}, floats, true, stream, mr);
 }
 
 }  // namespace detail
@@ -447,6 +569,14 @@ std::unique_ptr<column> from_floats(column_view const& floats,
   return detail::from_floats(floats, stream, mr);
 }
 
+std::unique_ptr<column> from_floats_shortest(column_view const& floats,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_floats_shortest(floats, stream, mr);
+}
+
 namespace detail {
 std::unique_ptr<column> is_float(strings_column_view const& input,
                                  rmm::cuda_stream_view stream,
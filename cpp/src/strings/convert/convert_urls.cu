@@ -20,6 +20,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/convert/convert_urls.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
@@ -34,6 +35,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/functional>
 
 namespace cudf {
 namespace strings {
@@ -81,7 +83,7 @@ struct url_encoder_fn {
   __device__ void operator()(size_type idx)
   {
     if (d_strings.is_null(idx)) {
-      if (!d_chars) { d_sizes[idx] = 0; }
+      d_sizes[idx] = 0;
       return;
     }
 
@@ -118,7 +120,7 @@ struct url_encoder_fn {
         }
       }
     }
-    if (!d_chars) { d_sizes[idx] = nbytes; }
+    d_sizes[idx] = nbytes;
   }
 };
 
@@ -133,8 +135,13 @@ std::unique_ptr<column> url_encode(strings_column_view const& input,
 
   auto d_column = column_device_view::create(input.parent(), stream);
 
+  // each byte is encoded into at most 3 bytes so the output can be written in a single pass
+  auto const bounds = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<size_type>([d_strings = *d_column] __device__(size_type idx) {
+      return d_strings.is_null(idx) ? 0 : d_strings.element<string_view>(idx).size_bytes() * 3;
+    }));
   auto [offsets_column, chars] =
-    make_strings_children(url_encoder_fn{*d_column}, input.size(), stream, mr);
+    make_strings_children_bounded(url_encoder_fn{*d_column}, bounds, input.size(), stream, mr);
 
   return make_strings_column(input.size(),
                              std::move(offsets_column),
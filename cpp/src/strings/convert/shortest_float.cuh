@@ -0,0 +1,916 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @file shortest_float.cuh
+ * @brief Shortest round-trip decimal representation of floating-point values
+ *
+ * This is the Ryu algorithm (Ulf Adams, PLDI 2018). The shortest decimal in the
+ * rounding interval of a binary value is found with 128-bit multiplications by
+ * precomputed powers of 5, so no arbitrary-precision arithmetic is needed.
+ *
+ * The same core is used for float and double values. Only the width of the
+ * rounding interval depends on the type.
+ */
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace ryu {
+
+constexpr int32_t pow5_inv_bitcount   = 125;
+constexpr int32_t pow5_bitcount       = 125;
+constexpr int32_t pow5_inv_table_size = 342;
+constexpr int32_t pow5_table_size     = 326;
+
+// 2^(bit_length(5^i) - 1 + 125) / 5^i + 1 stored as {low, high} 64-bit words
+__device__ uint64_t const pow5_inv_split[pow5_inv_table_size][2] = {
+  {0x0000000000000001UL, 0x2000000000000000UL},
+  {0x999999999999999aUL, 0x1999999999999999UL},
+  {0x47ae147ae147ae15UL, 0x147ae147ae147ae1UL},
+  {0x6c8b4395810624deUL, 0x10624dd2f1a9fbe7UL},
+  {0x7a786c226809d496UL, 0x1a36e2eb1c432ca5UL},
+  {0x61f9f01b866e43abUL, 0x14f8b588e368f084UL},
+  {0xb4c7f34938583622UL, 0x10c6f7a0b5ed8d36UL},
+  {0x87a6520ec08d236aUL, 0x1ad7f29abcaf4857UL},
+  {0x9fb841a566d74f88UL, 0x15798ee2308c39dfUL},
+  {0xe62d01511f12a607UL, 0x112e0be826d694b2UL},
+  {0xd6ae6881cb5109a4UL, 0x1b7cdfd9d7bdbab7UL},
+  {0xdef1ed34a2a73aeaUL, 0x15fd7fe17964955fUL},
+  {0x7f27f0f6e885c8bbUL, 0x119799812dea1119UL},
+  {0x650cb4be40d60df8UL, 0x1c25c268497681c2UL},
+  {0xea70909833de7193UL, 0x16849b86a12b9b01UL},
+  {0x21f3a6e0297ec143UL, 0x1203af9ee756159bUL},
+  {0x6985d7cd0f313537UL, 0x1cd2b297d889bc2bUL},
+  {0x2137dfd73f5a90f9UL, 0x170ef54646d49689UL},
+  {0xe75fe645cc4873faUL, 0x12725dd1d243aba0UL},
+  {0xa5663d3c7a0d865dUL, 0x1d83c94fb6d2ac34UL},
+  {0x511e976394d79eb1UL, 0x179ca10c9242235dUL},
+  {0xda7edf82dd794bc1UL, 0x12e3b40a0e9b4f7dUL},
+  {0x2a6498d1625bac68UL, 0x1e392010175ee596UL},
+  {0xeeb6e0a781e2f053UL, 0x182db34012b25144UL},
+  {0x58924d52ce4f26a9UL, 0x1357c299a88ea76aUL},
+  {0x27507bb7b07ea441UL, 0x1ef2d0f5da7dd8aaUL},
+  {0x52a6c95fc0655034UL, 0x18c240c4aecb13bbUL},
+  {0x0eebd44c99eaa690UL, 0x13ce9a36f23c0fc9UL},
+  {0xb17953adc3110a80UL, 0x1fb0f6be50601941UL},
+  {0xc12ddc8b02740867UL, 0x195a5efea6b34767UL},
+  {0x3424b06f3529a052UL, 0x14484bfeebc29f86UL},
+  {0x901d59f290ee19dbUL, 0x1039d66589687f9eUL},
+  {0x4cfbc31db4b0295fUL, 0x19f623d5a8a73297UL},
+  {0x3d9635b15d59bab2UL, 0x14c4e977ba1f5bacUL},
+  {0x97ab5e277de16228UL, 0x109d8792fb4c4956UL},
+  {0xf2abc9d8c9689d0dUL, 0x1a95a5b7f87a0ef0UL},
+  {0x5bbca17a3aba173eUL, 0x154484932d2e725aUL},
+  {0xafca1ac82efb45cbUL, 0x11039d428a8b8eaeUL},
+  {0xb2dcf7a6b1920945UL, 0x1b38fb9daa78e44aUL},
+  {0xf57d92ebc141a104UL, 0x15c72fb1552d836eUL},
+  {0xc46475896767b403UL, 0x116c262777579c58UL},
+  {0x6d6d88dbd8a5ecd2UL, 0x1be03d0bf225c6f4UL},
+  {0x8abe071646eb23dbUL, 0x164cfda3281e38c3UL},
+  {0x6efe6c11d255b649UL, 0x11d7314f534b609cUL},
+  {0xb197134fb6ef8a0eUL, 0x1c8b821885456760UL},
+  {0x27ac0f72f8bfa1a5UL, 0x16d601ad376ab91aUL},
+  {0xb95672c260994e1eUL, 0x1244ce242c5560e1UL},
+  {0xf5571e03cdc21695UL, 0x1d3ae36d13bbce35UL},
+  {0x2aac18030b01ababUL, 0x17624f8a762fd82bUL},
+  {0xbbbce0026f348956UL, 0x12b50c6ec4f31355UL},
+  {0x92c7ccd0b1eda889UL, 0x1dee7a4ad4b81eefUL},
+  {0xdbd30a408e57ba07UL, 0x17f1fb6f10934bf2UL},
+  {0x7ca8d50071dfc806UL, 0x1327fc58da0f6ff5UL},
+  {0xfaa7bb33e9660cd6UL, 0x1ea6608e29b24cbbUL},
+  {0x9552fc298784d711UL, 0x18851a0b548ea3c9UL},
+  {0xaaa8c9bad2d0ac0eUL, 0x139dae6f76d88307UL},
+  {0xdddadc5e1e1aace3UL, 0x1f62b0b257c0d1a5UL},
+  {0x7e48b04b4b488a4fUL, 0x191bc08eac9a4151UL},
+  {0xcb6d59d5d5d3a1d9UL, 0x141633a556e1cddaUL},
+  {0x3c577b1177dc817bUL, 0x1011c2eaabe7d7e2UL},
+  {0xc6f25e825960cf2aUL, 0x19b604aaaca62636UL},
+  {0x6bf518684780a5bbUL, 0x14919d5556eb51c5UL},
+  {0x232a79ed06008496UL, 0x10747ddddf22a7d1UL},
+  {0xd1dd8fe1a3340756UL, 0x1a53fc9631d10c81UL},
+  {0xa7e4731ae8f66c45UL, 0x150ffd44f4a73d34UL},
+  {0x531d28e253f8569eUL, 0x10d9976a5d52975dUL},
+  {0xeb61db03b98d5762UL, 0x1af5bf109550f22eUL},
+  {0xbc4e48cfc7a445e8UL, 0x159165a6ddda5b58UL},
+  {0x6371d3d96c836b20UL, 0x11411e1f17e1e2adUL},
+  {0x9f1c8628ad9f11cdUL, 0x1b9b6364f3030448UL},
+  {0xe5b06b53be18db0bUL, 0x1615e91d8f359d06UL},
+  {0xeaf3890fcb4715a2UL, 0x11ab20e472914a6bUL},
+  {0x44b8db4c7871bc37UL, 0x1c45016d841baa46UL},
+  {0x03c715d6c6c1635fUL, 0x169d9abe03495505UL},
+  {0x3638de456bcde919UL, 0x1217aefe69077737UL},
+  {0x56c163a2461641c1UL, 0x1cf2b1970e725858UL},
+  {0xdf011c81d1ab67ceUL, 0x17288e1271f51379UL},
+  {0x7f3416ce4155eca5UL, 0x1286d80ec190dc61UL},
+  {0x6520247d3556476eUL, 0x1da48ce468e7c702UL},
+  {0xea801d30f7783925UL, 0x17b6d71d20b96c01UL},
+  {0xbb99b0f3f92cfa84UL, 0x12f8ac174d612334UL},
+  {0x5f5c4e532847f739UL, 0x1e5aacf215683854UL},
+  {0x7f7d0b75b9d32c2eUL, 0x18488a5b44536043UL},
+  {0x9930d5f7c7dc2358UL, 0x136d3b7c36a919cfUL},
+  {0x8eb4898c72f9d226UL, 0x1f152bf9f10e8fb2UL},
+  {0x722a07a38f2e41b8UL, 0x18ddbcc7f40ba628UL},
+  {0xc1bb394fa5be9afaUL, 0x13e497065cd61e86UL},
+  {0x9c5ec2190930f7f6UL, 0x1fd424d6faf030d7UL},
+  {0x49e56814075a5ff8UL, 0x197683df2f268d79UL},
+  {0x6e51201005e1e660UL, 0x145ecfe5bf520ac7UL},
+  {0xf1da800cd181851aUL, 0x104bd984990e6f05UL},
+  {0x4fc400148268d4f5UL, 0x1a12f5a0f4e3e4d6UL},
+  {0xd96999aa01ed772bUL, 0x14dbf7b3f71cb711UL},
+  {0xadee1488018ac5bcUL, 0x10aff95cc5b09274UL},
+  {0x497ceda668de092cUL, 0x1ab328946f80ea54UL},
+  {0x3aca57b853e4d424UL, 0x155c2076bf9a5510UL},
+  {0x623b7960431d7683UL, 0x1116805effaeaa73UL},
+  {0x9d2bf566d1c8bd9eUL, 0x1b5733cb32b110b8UL},
+  {0x7dbcc452416d647fUL, 0x15df5ca28ef40d60UL},
+  {0xcafd69db678ab6ccUL, 0x117f7d4ed8c33de6UL},
+  {0xab2f0fc572778adfUL, 0x1bff2ee48e052fd7UL},
+  {0x88f273045b92d580UL, 0x1665bf1d3e6a8cacUL},
+  {0xd3f528d049424466UL, 0x11eaff4a98553d56UL},
+  {0xb988414d4203a0a3UL, 0x1cab3210f3bb9557UL},
+  {0x6139cdd76802e6e9UL, 0x16ef5b40c2fc7779UL},
+  {0xe761717920025254UL, 0x125915cd68c9f92dUL},
+  {0xa568b58e999d5086UL, 0x1d5b561574765b7cUL},
+  {0x5120913ee14aa6d2UL, 0x177c44ddf6c515fdUL},
+  {0xa74d40ff1aa21f0eUL, 0x12c9d0b1923744caUL},
+  {0x0baece64f769cb4aUL, 0x1e0fb44f50586e11UL},
+  {0x3c8bd850c5ee3c3bUL, 0x180c903f7379f1a7UL},
+  {0xca0979da37f1c9c9UL, 0x133d4032c2c7f485UL},
+  {0xa9a8c2f6bfe942dbUL, 0x1ec866b79e0cba6fUL},
+  {0x2153cf2bccba9be3UL, 0x18a0522c7e709526UL},
+  {0x1aa9728970954982UL, 0x13b374f06526ddb8UL},
+  {0xf775840f1a88759dUL, 0x1f8587e7083e2f8cUL},
+  {0x5f9136727ba05e17UL, 0x19379fec0698260aUL},
+  {0x1940f85b9619e4dfUL, 0x142c7ff0054684d5UL},
+  {0xe100c6afab47ea4cUL, 0x1023998cd1053710UL},
+  {0xce67a44c453fdd47UL, 0x19d28f47b4d524e7UL},
+  {0xd852e9d69dccb106UL, 0x14a8729fc3ddb71fUL},
+  {0x79dbee454b0a2738UL, 0x1086c219697e2c19UL},
+  {0x295fe3a211a9d859UL, 0x1a71368f0f30468fUL},
+  {0xbab31c81a7bb137aUL, 0x15275ed8d8f36ba5UL},
+  {0x6228e39aec95a92fUL, 0x10ec4be0ad8f8951UL},
+  {0x9d0e38f7e0ef7517UL, 0x1b13ac9aaf4c0ee8UL},
+  {0xb0d82d931a592a79UL, 0x15a956e225d67253UL},
+  {0x8d79be0f4847552eUL, 0x11544581b7dec1dcUL},
+  {0x158f967eda0bbb7cUL, 0x1bba08cf8c979c94UL},
+  {0x77a611ff14d62f97UL, 0x162e6d72d6dfb076UL},
+  {0xf951a7ff43de8c79UL, 0x11bebdf578b2f391UL},
+  {0xc21c3ffed2fdad8eUL, 0x1c6463225ab7ec1cUL},
+  {0x01b0333242648ad8UL, 0x16b6b5b5155ff017UL},
+  {0x0159c28e9b83a246UL, 0x122bc490dde659acUL},
+  {0xcef604175f3903a3UL, 0x1d12d41afca3c2acUL},
+  {0x725e69ac4c2d9c83UL, 0x17424348ca1c9bbdUL},
+  {0xf5185489d68ae39cUL, 0x129b69070816e2fdUL},
+  {0xee8d540fbdab05c6UL, 0x1dc574d80cf16b2fUL},
+  {0xbed77672fe226b05UL, 0x17d12a4670c1228cUL},
+  {0xff12c528cb4ebc04UL, 0x130dbb6b8d674ed6UL},
+  {0xcb513b74787df9a0UL, 0x1e7c5f127bd87e24UL},
+  {0x090dc929f9fe614dUL, 0x18637f41fcad31b7UL},
+  {0xa0d7d42194cb810aUL, 0x1382cc34ca2427c5UL},
+  {0x67bfb9cf5478ce77UL, 0x1f37ad21436d0c6fUL},
+  {0x1fcc94a5dd2d71f9UL, 0x18f9574dcf8a7059UL},
+  {0x7fd6dd517dbdf4c7UL, 0x13faac3e3fa1f37aUL},
+  {0xffbe2ee8c92fee0bUL, 0x1ff779fd329cb8c3UL},
+  {0x6631bf20a0f324d6UL, 0x1992c7fdc216fa36UL},
+  {0xb827cc1a1a5c1d78UL, 0x14756ccb01abfb5eUL},
+  {0x935309ae7b7ce460UL, 0x105df0a267bcc918UL},
+  {0x1eeb42b0c594a099UL, 0x1a2fe76a3f9474f4UL},
+  {0xe58902270476e6e1UL, 0x14f31f8832dd2a5cUL},
+  {0xb7a0ce859d2bebe7UL, 0x10c27fa028b0eeb0UL},
+  {0x59014a6f61dfdfd8UL, 0x1ad0cc33744e4ab4UL},
+  {0xe0cdd525e7e64cadUL, 0x1573d68f903ea229UL},
+  {0x4d7177518651d6f1UL, 0x11297872d9cbb4eeUL},
+  {0x7be8bee8d6e957e8UL, 0x1b758d848fac54b0UL},
+  {0xfcba3253df211320UL, 0x15f7a46a0c89dd59UL},
+  {0x63c8284318e74280UL, 0x1192e9ee706e4aaeUL},
+  {0x060d0d3827d86a66UL, 0x1c1e43171a4a1117UL},
+  {0x6b3da42cecad21ebUL, 0x167e9c127b6e7412UL},
+  {0x88fe1cf0bd574e56UL, 0x11fee341fc585cdbUL},
+  {0x419694b462254a23UL, 0x1ccb0536608d615fUL},
+  {0x67abaa29e81dd4e9UL, 0x1708d0f84d3de77fUL},
+  {0xb95621bb2017dd87UL, 0x126d73f9d764b932UL},
+  {0xc223692b668c95a5UL, 0x1d7becc2f23ac1eaUL},
+  {0xce82ba891ed6de1dUL, 0x179657025b6234bbUL},
+  {0xa53562074bdf1818UL, 0x12deac01e2b4f6fcUL},
+  {0x3b889cd87964f359UL, 0x1e3113363787f194UL},
+  {0xfc6d4a46c783f5e1UL, 0x18274291c6065adcUL},
+  {0x30576e9f06032b1aUL, 0x13529ba7d19eaf17UL},
+  {0x1a257dcb3cd1de90UL, 0x1eea92a61c311825UL},
+  {0x481dfe3c30a7e540UL, 0x18bba884e35a79b7UL},
+  {0xd34b31c9c0865100UL, 0x13c9539d82aec7c5UL},
+  {0x5211e942cda3b4cdUL, 0x1fa885c8d117a609UL},
+  {0x74db21023e1c90a4UL, 0x19539e3a40dfb807UL},
+  {0xf715b401cb4a0d50UL, 0x1442e4fb67196005UL},
+  {0xf8de299b09080aa7UL, 0x103583fc527ab337UL},
+  {0x8e304291a80cddd7UL, 0x19ef3993b72ab859UL},
+  {0x3e8d020e200a4b13UL, 0x14bf6142f8eef9e1UL},
+  {0x653d9b3e80083c0fUL, 0x10991a9bfa58c7e7UL},
+  {0x6ec8f864000d2ce4UL, 0x1a8e90f9908e0ca5UL},
+  {0x8bd3f9e999a423eaUL, 0x153eda614071a3b7UL},
+  {0x3ca994bae1501cbbUL, 0x10ff151a99f482f9UL},
+  {0xc775bac49bb3612bUL, 0x1b31bb5dc320d18eUL},
+  {0xd2c4956a16291a89UL, 0x15c162b168e70e0bUL},
+  {0xdbd0778811ba7ba1UL, 0x11678227871f3e6fUL},
+  {0x2c80bf401c5d929bUL, 0x1bd8d03f3e9863e6UL},
+  {0xbd33cc3349e47549UL, 0x16470cff6546b651UL},
+  {0xca8fd68f6e505dd4UL, 0x11d270cc51055ea7UL},
+  {0x4419574be3b3c953UL, 0x1c83e7ad4e6efdd9UL},
+  {0x0347790982f63aa9UL, 0x16cfec8aa52597e1UL},
+  {0xcf6c60d468c4fbbaUL, 0x123ff06eea847980UL},
+  {0xe57a34870e07f92aUL, 0x1d331a4b10d3f59aUL},
+  {0x512e906c0b399422UL, 0x175c1508da432ae2UL},
+  {0xda8ba6bcd5c7a9b5UL, 0x12b010d3e1cf5581UL},
+  {0x90df712e22d90f87UL, 0x1de6815302e5559cUL},
+  {0xda4c5a8b4f140c6cUL, 0x17eb9aa8cf1dde16UL},
+  {0xaea37ba2a5a9a38aUL, 0x1322e220a5b17e78UL},
+  {0x7dd25f6aa2a905a9UL, 0x1e9e369aa2b59727UL},
+  {0x97db7f888220d154UL, 0x187e92154ef7ac1fUL},
+  {0x797c6606ce80a777UL, 0x139874ddd8c6234cUL},
+  {0x8f2d700ae4010bf1UL, 0x1f5a549627a36badUL},
+  {0x0c2459a25000d65aUL, 0x191510781fb5efbeUL},
+  {0x701d1481d99a4515UL, 0x1410d9f9b2f7f2feUL},
+  {0xc017439b147b6a77UL, 0x100d7b2e28c65bfeUL},
+  {0xccf205c4ed9243f2UL, 0x19af2b7d0e0a2ccaUL},
+  {0x0a5b37d0be0e9cc2UL, 0x148c22ca71a1bd6fUL},
+  {0x0848f973cb3ee3ceUL, 0x10701bd527b4978cUL},
+  {0xda0e5bec78649fb0UL, 0x1a4cf9550c5425acUL},
+  {0x7b3eaff060507fc0UL, 0x150a6110d6a9b7bdUL},
+  {0x95cbbff380406633UL, 0x10d51a73deee2c97UL},
+  {0xefac665266cd7052UL, 0x1aee90b964b04758UL},
+  {0x2623850eb8a459dbUL, 0x158ba6fab6f36c47UL},
+  {0x1e82d0d893b6ae49UL, 0x113c85955f29236cUL},
+  {0xfd9e1af41f8ab075UL, 0x1b9408eefea838acUL},
+  {0x97b1af29b2d559f7UL, 0x16100725988693bdUL},
+  {0xac8e25baf5777b2cUL, 0x11a66c1e139edc97UL},
+  {0x7a7d092b2258c513UL, 0x1c3d79c9b8fe2dbfUL},
+  {0x61fda0ef4ead6a76UL, 0x169794a160cb57ccUL},
+  {0xe7fe1a590bbdeec5UL, 0x1212dd4de7091309UL},
+  {0xa6635d5b45fcb13aUL, 0x1ceafbafd80e84dcUL},
+  {0x851c4aaf6b308dc8UL, 0x172262f3133ed0b0UL},
+  {0xd0e36ef2bc26d7d4UL, 0x1281e8c275cbda26UL},
+  {0xb49f17eac6a48c86UL, 0x1d9ca79d894629d7UL},
+  {0x2a18dfef0550706bUL, 0x17b08617a104ee46UL},
+  {0x54e0b3259dd9f389UL, 0x12f39e794d9d8b6bUL},
+  {0x87cdeb6f62f65274UL, 0x1e5297287c2f4578UL},
+  {0xd30b22bf825ea85dUL, 0x18421286c9bf6ac6UL},
+  {0x0f3c1bcc684bb9e4UL, 0x13680ed23aff889fUL},
+  {0x18602c7a4079296dUL, 0x1f0ce4839198da98UL},
+  {0x46b356c833942124UL, 0x18d71d360e13e213UL},
+  {0x388f78a029434db6UL, 0x13df4a91a4dcb4dcUL},
+  {0x5a7f2766a86baf8aUL, 0x1fcbaa82a1612160UL},
+  {0x153285ebb9efbfa2UL, 0x196fbb9bb44db44dUL},
+  {0xaa8ed189618c994eUL, 0x145962e2f6a4903dUL},
+  {0xeed8a7a11ad6e10cUL, 0x1047824f2bb6d9caUL},
+  {0x7e27729b5e249b45UL, 0x1a0c03b1df8af611UL},
+  {0xfe85f549181d4904UL, 0x14d6695b193bf80dUL},
+  {0xcb9e5dd4134aa0d0UL, 0x10ab877c142ff9a4UL},
+  {0xdf63c9535211014dUL, 0x1aac0bf9b9e65c3aUL},
+  {0x191ca10f74da6771UL, 0x15566ffafb1eb02fUL},
+  {0xadb080d92a4852c1UL, 0x1111f32f2f4bc025UL},
+  {0x15e7348eaa0d5134UL, 0x1b4feb7eb212cd09UL},
+  {0xab1f5d3eee710dc4UL, 0x15d98932280f0a6dUL},
+  {0xbc1917658b8da49dUL, 0x117ad428200c0857UL},
+  {0x2cf4f23c127c3a94UL, 0x1bf7b9d9cce00d59UL},
+  {0xf0c3f4fcdb969543UL, 0x165fc7e170b33de0UL},
+  {0x5a365d9716121103UL, 0x11e6398126f5cb1aUL},
+  {0x9056fc24f01ce804UL, 0x1ca38f350b22de90UL},
+  {0xd9df301d8ce3ecd0UL, 0x16e93f5da2824ba6UL},
+  {0xe17f59b13d8323daUL, 0x125432b14ecea2ebUL},
+  {0x68cbc2b52f38395cUL, 0x1d53844ee47dd179UL},
+  {0x53d6355dbf602de3UL, 0x177603725064a794UL},
+  {0xa9782ab165e68b1cUL, 0x12c4cf8ea6b6ec76UL},
+  {0x0f26aab56fd744faUL, 0x1e07b27dd78b13f1UL},
+  {0x3f52222abfdf6a62UL, 0x18062864ac6f4327UL},
+  {0x65db4e88997f884eUL, 0x1338205089f29c1fUL},
+  {0x6fc54a7428cc0d4aUL, 0x1ec033b40fea9365UL},
+  {0x596aa1f68709a43bUL, 0x1899c2f673220f84UL},
+  {0xadeee7f86c07b696UL, 0x13ae3591f5b4d936UL},
+  {0x497e3ff3e00c5756UL, 0x1f7d228322baf524UL},
+  {0xd464fff64cd6ac45UL, 0x1930e868e89590e9UL},
+  {0x4383fff83d7889d1UL, 0x14272053ed4473eeUL},
+  {0xcf9cccc69793a174UL, 0x101f4d0ff1038ff1UL},
+  {0x7f6147a425b90252UL, 0x19cbae7fe805b31cUL},
+  {0xcc4dd2e9b7c7350fUL, 0x14a2f1ffecd15c16UL},
+  {0x3d0b0f215fd290d9UL, 0x10825b3323dab012UL},
+  {0x61ab4b689950e7c1UL, 0x1a6a2b85062ab350UL},
+  {0x4e22a2ba1440b967UL, 0x1521bc6a6b555c40UL},
+  {0x0b4ee894dd009453UL, 0x10e7c9eebc4449cdUL},
+  {0x1217da87c800ed51UL, 0x1b0c764ac6d3a948UL},
+  {0xdb46486ca000bddaUL, 0x15a391d56bdc876cUL},
+  {0x490506bd4ccd64afUL, 0x114fa7ddefe39f8aUL},
+  {0xa8080ac87ae23ab1UL, 0x1bb2a62fe638ff43UL},
+  {0x5339a239fbe82ef4UL, 0x162884f31e93ff69UL},
+  {0x75c7b4fb2fecf25dUL, 0x11ba03f5b20fff87UL},
+  {0x22d92191e647ea2eUL, 0x1c5cd322b67fff3fUL},
+  {0xb57a8141850654f2UL, 0x16b0a8e891ffff65UL},
+  {0xc4620101373843f5UL, 0x1226ed86db3332b7UL},
+  {0x3a366801f1f39feeUL, 0x1d0b15a491eb8459UL},
+  {0xfb5eb99b27f6198bUL, 0x173c115074bc69e0UL},
+  {0x2f7efae2865e7ad6UL, 0x129674405d6387e7UL},
+  {0xe597f7d0d6fd9156UL, 0x1dbd86cd6238d971UL},
+  {0x8479930d78cadaabUL, 0x17cad23de82d7ac1UL},
+  {0xd06142712d6f1556UL, 0x1308a831868ac89aUL},
+  {0x4d686a4eaf182222UL, 0x1e74404f3daada91UL},
+  {0xa453883ef279b4e8UL, 0x185d003f6488aedaUL},
+  {0xe9dc6cff28615d87UL, 0x137d99cc506d58aeUL},
+  {0xa960ae650d6895a4UL, 0x1f2f5c7a1a488de4UL},
+  {0xbab3beb73ded4483UL, 0x18f2b061aea07183UL},
+  {0x2ef6322c318a9d36UL, 0x13f559e7bee6c136UL},
+  {0xe4bd1d13827761f0UL, 0x1feef63f97d79b89UL},
+  {0x83ca7da9352c4e5aUL, 0x198bf832dfdfafa1UL},
+  {0x9ca1fe20f756a515UL, 0x146ff9c24cb2f2e7UL},
+  {0x4a1b31b3f9121daaUL, 0x1059949b708f28b9UL},
+  {0x435eb5ecc1b695ddUL, 0x1a28edc580e50df5UL},
+  {0x35e55e57015ede4aUL, 0x14ed8b04671da4c4UL},
+  {0xc4b77eac0118b1d5UL, 0x10be08d0527e1d69UL},
+  {0xa12597799b5ab622UL, 0x1ac9a7b3b7302f0fUL},
+  {0x4db7ac6149155e81UL, 0x156e1fc2f8f358d9UL},
+  {0xd7c6238107444b9bUL, 0x1124e63593f5e0adUL},
+  {0x593d059b3ed3ac2bUL, 0x1b6e3d2286563449UL},
+  {0xe0fd9e15cbdc89bcUL, 0x15f1ca820511c36dUL},
+  {0xb3fe18116fe3a163UL, 0x118e3b9b37416924UL},
+  {0x866359b57fd29bd1UL, 0x1c16c5c525357507UL},
+  {0xd1e91491330ee30eUL, 0x16789e3750f790d2UL},
+  {0x74ba76da8f3f1c0bUL, 0x11fa182c40c60d75UL},
+  {0xedf72490e531c678UL, 0x1cc359e067a348bbUL},
+  {0x8b2c1d40b75b052dUL, 0x1702ae4d1fb5d3c9UL},
+  {0x6f567dcd5f7c0424UL, 0x12688b70e62b0fd4UL},
+  {0x7ef0c94898c66d06UL, 0x1d74124e3d11b2edUL},
+  {0x98c0a106e09ebd9fUL, 0x17900ea4fda7c257UL},
+  {0x470080d24d4bcae6UL, 0x12d9a550caec9b79UL},
+  {0xd800ce1d487944a2UL, 0x1e29088144adc58eUL},
+  {0x1333d8176d2dd082UL, 0x1820d39a9d57d13fUL},
+  {0xa8f646792424a6ceUL, 0x134d76154aaca765UL},
+  {0x74bd3d8ea03aa47dUL, 0x1ee25688777aa56fUL},
+  {0x5d64313ee6955064UL, 0x18b51206c5fbb78cUL},
+  {0x4ab68dcbebaaa6b7UL, 0x13c40e6bd1962c70UL},
+  {0x1124161312aaa457UL, 0x1fa01712e8f0471aUL},
+  {0xda8344dc0eeee9dfUL, 0x194cdf4253f36c14UL},
+  {0xe2029d7cd8bf2180UL, 0x143d7f6843292343UL},
+  {0x4e687dfd7a328133UL, 0x103132b9cf541c36UL},
+  {0x4a40c9959050ceb8UL, 0x19e851294bb9c6bdUL},
+  {0x0833d477a6a70bc6UL, 0x14b9da876fc7d231UL},
+  {0xa02976c61eec096bUL, 0x1094aed2bfd30e8dUL},
+  {0x004257a364acdbdfUL, 0x1a877e1dffb81749UL},
+  {0xcd01dfb5ea23e319UL, 0x153931b1996012a0UL},
+  {0x70ce4c91881cb5aeUL, 0x10fa8e27ade6754dUL},
+  {0x1ae3adb5a69455e2UL, 0x1b2a7d0c4970bbafUL},
+  {0x7be957c4854377e8UL, 0x15bb973d078d62f2UL},
+  {0xc987796a0435f987UL, 0x1162df64060ab58eUL},
+  {0x75a58f1006bcc271UL, 0x1bd1656cd67788e4UL},
+  {0xf7b7a5a66bca3527UL, 0x16411df0ab92d3e9UL},
+  {0x5fc61e1ebca1c41fUL, 0x11cdb18d560f0feeUL},
+  {0xffa363646102d365UL, 0x1c7c4f4889b1b316UL},
+  {0x32e91c504d9bdc51UL, 0x16c9d906d48e28dfUL},
+  {0x8f20e37371497d0eUL, 0x123b140576d820b2UL},
+  {0x7e9b0585820f2e7cUL, 0x1d2b533bf159cdeaUL},
+  {0xcbaf379e01a5becaUL, 0x1755dc2ff447d7eeUL},
+  {0x0958f94b348498a1UL, 0x12ab168cc36cacbfUL}};
+
+// 5^i normalized to 125 bits stored as {low, high} 64-bit words
+__device__ uint64_t const pow5_split[pow5_table_size][2] = {
+  {0x0000000000000000UL, 0x1000000000000000UL},
+  {0x0000000000000000UL, 0x1400000000000000UL},
+  {0x0000000000000000UL, 0x1900000000000000UL},
+  {0x0000000000000000UL, 0x1f40000000000000UL},
+  {0x0000000000000000UL, 0x1388000000000000UL},
+  {0x0000000000000000UL, 0x186a000000000000UL},
+  {0x0000000000000000UL, 0x1e84800000000000UL},
+  {0x0000000000000000UL, 0x1312d00000000000UL},
+  {0x0000000000000000UL, 0x17d7840000000000UL},
+  {0x0000000000000000UL, 0x1dcd650000000000UL},
+  {0x0000000000000000UL, 0x12a05f2000000000UL},
+  {0x0000000000000000UL, 0x174876e800000000UL},
+  {0x0000000000000000UL, 0x1d1a94a200000000UL},
+  {0x0000000000000000UL, 0x12309ce540000000UL},
+  {0x0000000000000000UL, 0x16bcc41e90000000UL},
+  {0x0000000000000000UL, 0x1c6bf52634000000UL},
+  {0x0000000000000000UL, 0x11c37937e0800000UL},
+  {0x0000000000000000UL, 0x16345785d8a00000UL},
+  {0x0000000000000000UL, 0x1bc16d674ec80000UL},
+  {0x0000000000000000UL, 0x1158e460913d0000UL},
+  {0x0000000000000000UL, 0x15af1d78b58c4000UL},
+  {0x0000000000000000UL, 0x1b1ae4d6e2ef5000UL},
+  {0x0000000000000000UL, 0x10f0cf064dd59200UL},
+  {0x0000000000000000UL, 0x152d02c7e14af680UL},
+  {0x0000000000000000UL, 0x1a784379d99db420UL},
+  {0x0000000000000000UL, 0x108b2a2c28029094UL},
+  {0x0000000000000000UL, 0x14adf4b7320334b9UL},
+  {0x4000000000000000UL, 0x19d971e4fe8401e7UL},
+  {0x8800000000000000UL, 0x1027e72f1f128130UL},
+  {0xaa00000000000000UL, 0x1431e0fae6d7217cUL},
+  {0xd480000000000000UL, 0x193e5939a08ce9dbUL},
+  {0xc9a0000000000000UL, 0x1f8def8808b02452UL},
+  {0xbe04000000000000UL, 0x13b8b5b5056e16b3UL},
+  {0xad85000000000000UL, 0x18a6e32246c99c60UL},
+  {0xd8e6400000000000UL, 0x1ed09bead87c0378UL},
+  {0x878fe80000000000UL, 0x13426172c74d822bUL},
+  {0x6973e20000000000UL, 0x1812f9cf7920e2b6UL},
+  {0x03d0da8000000000UL, 0x1e17b84357691b64UL},
+  {0x8262889000000000UL, 0x12ced32a16a1b11eUL},
+  {0x22fb2ab400000000UL, 0x178287f49c4a1d66UL},
+  {0xabb9f56100000000UL, 0x1d6329f1c35ca4bfUL},
+  {0xcb54395ca0000000UL, 0x125dfa371a19e6f7UL},
+  {0xbe2947b3c8000000UL, 0x16f578c4e0a060b5UL},
+  {0x2db399a0ba000000UL, 0x1cb2d6f618c878e3UL},
+  {0xfc90400474400000UL, 0x11efc659cf7d4b8dUL},
+  {0x7bb4500591500000UL, 0x166bb7f0435c9e71UL},
+  {0xdaa16406f5a40000UL, 0x1c06a5ec5433c60dUL},
+  {0xa8a4de8459868000UL, 0x118427b3b4a05bc8UL},
+  {0xd2ce16256fe82000UL, 0x15e531a0a1c872baUL},
+  {0x87819baecbe22800UL, 0x1b5e7e08ca3a8f69UL},
+  {0xf4b1014d3f6d5900UL, 0x111b0ec57e6499a1UL},
+  {0x71dd41a08f48af40UL, 0x1561d276ddfdc00aUL},
+  {0x0e549208b31adb10UL, 0x1aba4714957d300dUL},
+  {0x28f4db456ff0c8eaUL, 0x10b46c6cdd6e3e08UL},
+  {0x33321216cbecfb24UL, 0x14e1878814c9cd8aUL},
+  {0xbffe969c7ee839edUL, 0x1a19e96a19fc40ecUL},
+  {0xf7ff1e21cf512434UL, 0x105031e2503da893UL},
+  {0xf5fee5aa43256d41UL, 0x14643e5ae44d12b8UL},
+  {0x337e9f14d3eec892UL, 0x197d4df19d605767UL},
+  {0x005e46da08ea7ab6UL, 0x1fdca16e04b86d41UL},
+  {0xa03aec4845928cb2UL, 0x13e9e4e4c2f34448UL},
+  {0xc849a75a56f72fdeUL, 0x18e45e1df3b0155aUL},
+  {0x7a5c1130ecb4fbd6UL, 0x1f1d75a5709c1ab1UL},
+  {0xec798abe93f11d65UL, 0x13726987666190aeUL},
+  {0xa797ed6e38ed64bfUL, 0x184f03e93ff9f4daUL},
+  {0x517de8c9c728bdefUL, 0x1e62c4e38ff87211UL},
+  {0xd2eeb17e1c7976b5UL, 0x12fdbb0e39fb474aUL},
+  {0x87aa5ddda397d462UL, 0x17bd29d1c87a191dUL},
+  {0xe994f5550c7dc97bUL, 0x1dac74463a989f64UL},
+  {0x11fd195527ce9dedUL, 0x128bc8abe49f639fUL},
+  {0xd67c5faa71c24568UL, 0x172ebad6ddc73c86UL},
+  {0x8c1b77950e32d6c2UL, 0x1cfa698c95390ba8UL},
+  {0x57912abd28dfc639UL, 0x121c81f7dd43a749UL},
+  {0xad75756c7317b7c8UL, 0x16a3a275d494911bUL},
+  {0x98d2d2c78fdda5baUL, 0x1c4c8b1349b9b562UL},
+  {0x9f83c3bcb9ea8794UL, 0x11afd6ec0e14115dUL},
+  {0x0764b4abe8652979UL, 0x161bcca7119915b5UL},
+  {0x493de1d6e27e73d7UL, 0x1ba2bfd0d5ff5b22UL},
+  {0x6dc6ad264d8f0866UL, 0x1145b7e285bf98f5UL},
+  {0xc938586fe0f2ca80UL, 0x159725db272f7f32UL},
+  {0x7b866e8bd92f7d20UL, 0x1afcef51f0fb5effUL},
+  {0xad34051767bdae34UL, 0x10de1593369d1b5fUL},
+  {0x9881065d41ad19c1UL, 0x15159af804446237UL},
+  {0x7ea147f492186032UL, 0x1a5b01b605557ac5UL},
+  {0x6f24ccf8db4f3c1fUL, 0x1078e111c3556cbbUL},
+  {0x4aee003712230b27UL, 0x14971956342ac7eaUL},
+  {0xdda98044d6abcdf0UL, 0x19bcdfabc13579e4UL},
+  {0x0a89f02b062b60b6UL, 0x10160bcb58c16c2fUL},
+  {0xcd2c6c35c7b638e4UL, 0x141b8ebe2ef1c73aUL},
+  {0x8077874339a3c71dUL, 0x1922726dbaae3909UL},
+  {0xe0956914080cb8e4UL, 0x1f6b0f092959c74bUL},
+  {0x6c5d61ac8507f38eUL, 0x13a2e965b9d81c8fUL},
+  {0x4774ba17a649f072UL, 0x188ba3bf284e23b3UL},
+  {0x1951e89d8fdc6c8fUL, 0x1eae8caef261aca0UL},
+  {0x0fd3316279e9c3d9UL, 0x132d17ed577d0be4UL},
+  {0x13c7fdbb186434cfUL, 0x17f85de8ad5c4eddUL},
+  {0x58b9fd29de7d4203UL, 0x1df67562d8b36294UL},
+  {0xb7743e3a2b0e4942UL, 0x12ba095dc7701d9cUL},
+  {0xe5514dc8b5d1db92UL, 0x17688bb5394c2503UL},
+  {0xdea5a13ae3465277UL, 0x1d42aea2879f2e44UL},
+  {0x0b2784c4ce0bf38aUL, 0x1249ad2594c37cebUL},
+  {0xcdf165f6018ef06dUL, 0x16dc186ef9f45c25UL},
+  {0x416dbf7381f2ac88UL, 0x1c931e8ab871732fUL},
+  {0x88e497a83137abd5UL, 0x11dbf316b346e7fdUL},
+  {0xeb1dbd923d8596caUL, 0x1652efdc6018a1fcUL},
+  {0x25e52cf6cce6fc7dUL, 0x1be7abd3781eca7cUL},
+  {0x97af3c1a40105dceUL, 0x1170cb642b133e8dUL},
+  {0xfd9b0b20d0147542UL, 0x15ccfe3d35d80e30UL},
+  {0x3d01cde904199292UL, 0x1b403dcc834e11bdUL},
+  {0x462120b1a28ffb9bUL, 0x1108269fd210cb16UL},
+  {0xd7a968de0b33fa82UL, 0x154a3047c694fddbUL},
+  {0xcd93c3158e00f923UL, 0x1a9cbc59b83a3d52UL},
+  {0xc07c59ed78c09bb6UL, 0x10a1f5b813246653UL},
+  {0xb09b7068d6f0c2a3UL, 0x14ca732617ed7fe8UL},
+  {0xdcc24c830cacf34cUL, 0x19fd0fef9de8dfe2UL},
+  {0xc9f96fd1e7ec180fUL, 0x103e29f5c2b18bedUL},
+  {0x3c77cbc661e71e13UL, 0x144db473335deee9UL},
+  {0x8b95beb7fa60e598UL, 0x1961219000356aa3UL},
+  {0x6e7b2e65f8f91efeUL, 0x1fb969f40042c54cUL},
+  {0xc50cfcffbb9bb35fUL, 0x13d3e2388029bb4fUL},
+  {0xb6503c3faa82a037UL, 0x18c8dac6a0342a23UL},
+  {0xa3e44b4f95234844UL, 0x1efb1178484134acUL},
+  {0xe66eaf11bd360d2bUL, 0x135ceaeb2d28c0ebUL},
+  {0xe00a5ad62c839075UL, 0x183425a5f872f126UL},
+  {0x980cf18bb7a47493UL, 0x1e412f0f768fad70UL},
+  {0x5f0816f752c6c8dcUL, 0x12e8bd69aa19cc66UL},
+  {0xf6ca1cb527787b13UL, 0x17a2ecc414a03f7fUL},
+  {0xf47ca3e2715699d7UL, 0x1d8ba7f519c84f5fUL},
+  {0xf8cde66d86d62026UL, 0x127748f9301d319bUL},
+  {0xf7016008e88ba830UL, 0x17151b377c247e02UL},
+  {0xb4c1b80b22ae923cUL, 0x1cda62055b2d9d83UL},
+  {0x50f91306f5ad1b65UL, 0x12087d4358fc8272UL},
+  {0xe53757c8b318623fUL, 0x168a9c942f3ba30eUL},
+  {0x9e852dbadfde7acfUL, 0x1c2d43b93b0a8bd2UL},
+  {0xa3133c94cbeb0cc1UL, 0x119c4a53c4e69763UL},
+  {0x8bd80bb9fee5cff1UL, 0x16035ce8b6203d3cUL},
+  {0xaece0ea87e9f43eeUL, 0x1b843422e3a84c8bUL},
+  {0x4d40c9294f238a75UL, 0x1132a095ce492fd7UL},
+  {0x2090fb73a2ec6d12UL, 0x157f48bb41db7bcdUL},
+  {0x68b53a508ba78856UL, 0x1adf1aea12525ac0UL},
+  {0x417144725748b536UL, 0x10cb70d24b7378b8UL},
+  {0x51cd958eed1ae283UL, 0x14fe4d06de5056e6UL},
+  {0xe640faf2a8619b24UL, 0x1a3de04895e46c9fUL},
+  {0xefe89cd7a93d00f7UL, 0x1066ac2d5daec3e3UL},
+  {0xebe2c40d938c4134UL, 0x14805738b51a74dcUL},
+  {0x26db7510f86f5181UL, 0x19a06d06e2611214UL},
+  {0x9849292a9b4592f1UL, 0x100444244d7cab4cUL},
+  {0xbe5b73754216f7adUL, 0x1405552d60dbd61fUL},
+  {0xadf25052929cb598UL, 0x1906aa78b912cba7UL},
+  {0x996ee4673743e2ffUL, 0x1f485516e7577e91UL},
+  {0xffe54ec0828a6ddfUL, 0x138d352e5096af1aUL},
+  {0xbfdea270a32d0957UL, 0x18708279e4bc5ae1UL},
+  {0x2fd64b0ccbf84badUL, 0x1e8ca3185deb719aUL},
+  {0x5de5eee7ff7b2f4cUL, 0x1317e5ef3ab32700UL},
+  {0x755f6aa1ff59fb1fUL, 0x17dddf6b095ff0c0UL},
+  {0x92b7454a7f3079e7UL, 0x1dd55745cbb7ecf0UL},
+  {0x5bb28b4e8f7e4c30UL, 0x12a5568b9f52f416UL},
+  {0xf29f2e22335ddf3cUL, 0x174eac2e8727b11bUL},
+  {0xef46f9aac035570bUL, 0x1d22573a28f19d62UL},
+  {0xd58c5c0ab8215667UL, 0x123576845997025dUL},
+  {0x4aef730d6629ac01UL, 0x16c2d4256ffcc2f5UL},
+  {0x9dab4fd0bfb41701UL, 0x1c73892ecbfbf3b2UL},
+  {0xa28b11e277d08e60UL, 0x11c835bd3f7d784fUL},
+  {0x8b2dd65b15c4b1f9UL, 0x163a432c8f5cd663UL},
+  {0x6df94bf1db35de77UL, 0x1bc8d3f7b3340bfcUL},
+  {0xc4bbcf772901ab0aUL, 0x115d847ad000877dUL},
+  {0x35eac354f34215cdUL, 0x15b4e5998400a95dUL},
+  {0x8365742a30129b40UL, 0x1b221effe500d3b4UL},
+  {0xd21f689a5e0ba108UL, 0x10f5535fef208450UL},
+  {0x06a742c0f58e894aUL, 0x1532a837eae8a565UL},
+  {0x4851137132f22b9dUL, 0x1a7f5245e5a2cebeUL},
+  {0xed32ac26bfd75b42UL, 0x108f936baf85c136UL},
+  {0xa87f57306fcd3212UL, 0x14b378469b673184UL},
+  {0xd29f2cfc8bc07e97UL, 0x19e056584240fde5UL},
+  {0xa3a37c1dd7584f1eUL, 0x102c35f729689eafUL},
+  {0x8c8c5b254d2e62e6UL, 0x14374374f3c2c65bUL},
+  {0x6faf71eea079fb9fUL, 0x1945145230b377f2UL},
+  {0x0b9b4e6a48987a87UL, 0x1f965966bce055efUL},
+  {0x674111026d5f4c94UL, 0x13bdf7e0360c35b5UL},
+  {0xc111554308b71fbaUL, 0x18ad75d8438f4322UL},
+  {0x7155aa93cae4e7a8UL, 0x1ed8d34e547313ebUL},
+  {0x26d58a9c5ecf10c9UL, 0x13478410f4c7ec73UL},
+  {0xf08aed437682d4fbUL, 0x1819651531f9e78fUL},
+  {0xecada89454238a3aUL, 0x1e1fbe5a7e786173UL},
+  {0x73ec895cb4963664UL, 0x12d3d6f88f0b3ce8UL},
+  {0x90e7abb3e1bbc3fdUL, 0x1788ccb6b2ce0c22UL},
+  {0x352196a0da2ab4fdUL, 0x1d6affe45f818f2bUL},
+  {0x0134fe24885ab11eUL, 0x1262dfeebbb0f97bUL},
+  {0xc1823dadaa715d65UL, 0x16fb97ea6a9d37d9UL},
+  {0x31e2cd19150db4bfUL, 0x1cba7de5054485d0UL},
+  {0x1f2dc02fad2890f7UL, 0x11f48eaf234ad3a2UL},
+  {0xa6f9303b9872b535UL, 0x1671b25aec1d888aUL},
+  {0x50b77c4a7e8f6282UL, 0x1c0e1ef1a724eaadUL},
+  {0x5272adae8f199d91UL, 0x1188d357087712acUL},
+  {0x670f591a32e004f6UL, 0x15eb082cca94d757UL},
+  {0x40d32f60bf980633UL, 0x1b65ca37fd3a0d2dUL},
+  {0x4883fd9c77bf03e0UL, 0x111f9e62fe44483cUL},
+  {0x5aa4fd0395aec4d8UL, 0x156785fbbdd55a4bUL},
+  {0x314e3c447b1a760eUL, 0x1ac1677aad4ab0deUL},
+  {0xded0e5aaccf089c9UL, 0x10b8e0acac4eae8aUL},
+  {0x96851f15802cac3bUL, 0x14e718d7d7625a2dUL},
+  {0xfc2666dae037d74aUL, 0x1a20df0dcd3af0b8UL},
+  {0x9d980048cc22e68eUL, 0x10548b68a044d673UL},
+  {0x84fe005aff2ba032UL, 0x1469ae42c8560c10UL},
+  {0xa63d8071bef6883eUL, 0x198419d37a6b8f14UL},
+  {0xcfcce08e2eb42a4eUL, 0x1fe52048590672d9UL},
+  {0x21e00c58dd309a70UL, 0x13ef342d37a407c8UL},
+  {0x2a580f6f147cc10dUL, 0x18eb0138858d09baUL},
+  {0xb4ee134ad99bf150UL, 0x1f25c186a6f04c28UL},
+  {0x7114cc0ec80176d2UL, 0x137798f428562f99UL},
+  {0xcd59ff127a01d486UL, 0x18557f31326bbb7fUL},
+  {0xc0b07ed7188249a8UL, 0x1e6adefd7f06aa5fUL},
+  {0xd86e4f466f516e09UL, 0x1302cb5e6f642a7bUL},
+  {0xce89e3180b25c98bUL, 0x17c37e360b3d351aUL},
+  {0x822c5bde0def3beeUL, 0x1db45dc38e0c8261UL},
+  {0xf15bb96ac8b58575UL, 0x1290ba9a38c7d17cUL},
+  {0x2db2a7c57ae2e6d2UL, 0x1734e940c6f9c5dcUL},
+  {0x391f51b6d99ba086UL, 0x1d022390f8b83753UL},
+  {0x03b3931248014454UL, 0x1221563a9b732294UL},
+  {0x04a077d6da019569UL, 0x16a9abc9424feb39UL},
+  {0x45c895cc9081fac3UL, 0x1c5416bb92e3e607UL},
+  {0x8b9d5d9fda513cbaUL, 0x11b48e353bce6fc4UL},
+  {0xae84b507d0e58be8UL, 0x1621b1c28ac20bb5UL},
+  {0x1a25e249c51eeee3UL, 0x1baa1e332d728ea3UL},
+  {0xf057ad6e1b33554dUL, 0x114a52dffc679925UL},
+  {0x6c6d98c9a2002aa1UL, 0x159ce797fb817f6fUL},
+  {0x4788fefc0a803549UL, 0x1b04217dfa61df4bUL},
+  {0x0cb59f5d8690214eUL, 0x10e294eebc7d2b8fUL},
+  {0xcfe30734e83429a1UL, 0x151b3a2a6b9c7672UL},
+  {0x83dbc9022241340aUL, 0x1a6208b50683940fUL},
+  {0xb2695da15568c086UL, 0x107d457124123c89UL},
+  {0x1f03b509aac2f0a7UL, 0x149c96cd6d16cbacUL},
+  {0x26c4a24c1573acd1UL, 0x19c3bc80c85c7e97UL},
+  {0x783ae56f8d684c03UL, 0x101a55d07d39cf1eUL},
+  {0x16499ecb70c25f03UL, 0x1420eb449c8842e6UL},
+  {0x9bdc067e4cf2f6c4UL, 0x19292615c3aa539fUL},
+  {0x82d3081de02fb476UL, 0x1f736f9b3494e887UL},
+  {0xb1c3e512ac1dd0c9UL, 0x13a825c100dd1154UL},
+  {0xde34de57572544fcUL, 0x18922f31411455a9UL},
+  {0x55c215ed2cee963bUL, 0x1eb6bafd91596b14UL},
+  {0xb5994db43c151de5UL, 0x133234de7ad7e2ecUL},
+  {0xe2ffa1214b1a655eUL, 0x17fec216198ddba7UL},
+  {0xdbbf89699de0feb6UL, 0x1dfe729b9ff15291UL},
+  {0x2957b5e202ac9f31UL, 0x12bf07a143f6d39bUL},
+  {0xf3ada35a8357c6feUL, 0x176ec98994f48881UL},
+  {0x70990c31242db8bdUL, 0x1d4a7bebfa31aaa2UL},
+  {0x865fa79eb69c9376UL, 0x124e8d737c5f0aa5UL},
+  {0xe7f791866443b854UL, 0x16e230d05b76cd4eUL},
+  {0xa1f575e7fd54a669UL, 0x1c9abd04725480a2UL},
+  {0xa53969b0fe54e801UL, 0x11e0b622c774d065UL},
+  {0x0e87c41d3dea2202UL, 0x1658e3ab7952047fUL},
+  {0xd229b5248d64aa82UL, 0x1bef1c9657a6859eUL},
+  {0x435a1136d85eea91UL, 0x117571ddf6c81383UL},
+  {0x143095848e76a536UL, 0x15d2ce55747a1864UL},
+  {0x193cbae5b2144e83UL, 0x1b4781ead1989e7dUL},
+  {0x2fc5f4cf8f4cb112UL, 0x110cb132c2ff630eUL},
+  {0xbbb77203731fdd56UL, 0x154fdd7f73bf3bd1UL},
+  {0x2aa54e844fe7d4acUL, 0x1aa3d4df50af0ac6UL},
+  {0xdaa75112b1f0e4ebUL, 0x10a6650b926d66bbUL},
+  {0xd15125575e6d1e26UL, 0x14cffe4e7708c06aUL},
+  {0x85a56ead360865b0UL, 0x1a03fde214caf085UL},
+  {0x7387652c41c53f8eUL, 0x10427ead4cfed653UL},
+  {0x50693e7752368f71UL, 0x14531e58a03e8be8UL},
+  {0x64838e1526c4334eUL, 0x1967e5eec84e2ee2UL},
+  {0xfda4719a70754022UL, 0x1fc1df6a7a61ba9aUL},
+  {0xde86c70086494815UL, 0x13d92ba28c7d14a0UL},
+  {0x162878c0a7db9a1aUL, 0x18cf768b2f9c59c9UL},
+  {0x5bb296f0d1d280a1UL, 0x1f03542dfb83703bUL},
+  {0x194f9e5683239064UL, 0x1362149cbd322625UL},
+  {0x5fa385ec23ec747eUL, 0x183a99c3ec7eafaeUL},
+  {0xf78c67672ce7919dUL, 0x1e494034e79e5b99UL},
+  {0x3ab7c0a07c10bb02UL, 0x12edc82110c2f940UL},
+  {0x4965b0c89b14e9c3UL, 0x17a93a2954f3b790UL},
+  {0x5bbf1cfac1da2433UL, 0x1d9388b3aa30a574UL},
+  {0xb957721cb92856a0UL, 0x127c35704a5e6768UL},
+  {0xe7ad4ea3e7726c48UL, 0x171b42cc5cf60142UL},
+  {0xa198a24ce14f075aUL, 0x1ce2137f74338193UL},
+  {0x44ff65700cd16498UL, 0x120d4c2fa8a030fcUL},
+  {0x563f3ecc1005bdbeUL, 0x16909f3b92c83d3bUL},
+  {0x2bcf0e7f14072d2eUL, 0x1c34c70a777a4c8aUL},
+  {0x5b61690f6c847c3dUL, 0x11a0fc668aac6fd6UL},
+  {0xf239c35347a59b4cUL, 0x16093b802d578bcbUL},
+  {0xeec83428198f021fUL, 0x1b8b8a6038ad6ebeUL},
+  {0x553d20990ff96153UL, 0x1137367c236c6537UL},
+  {0x2a8c68bf53f7b9a8UL, 0x1585041b2c477e85UL},
+  {0x752f82ef28f5a812UL, 0x1ae64521f7595e26UL},
+  {0x093db1d57999890bUL, 0x10cfeb353a97dad8UL},
+  {0x0b8d1e4ad7ffeb4eUL, 0x1503e602893dd18eUL},
+  {0x8e7065dd8dffe622UL, 0x1a44df832b8d45f1UL},
+  {0xf9063faa78bfefd5UL, 0x106b0bb1fb384bb6UL},
+  {0xb747cf9516efebcaUL, 0x1485ce9e7a065ea4UL},
+  {0xe519c37a5cabe6bdUL, 0x19a742461887f64dUL},
+  {0xaf301a2c79eb7036UL, 0x1008896bcf54f9f0UL},
+  {0xdafc20b798664c43UL, 0x140aabc6c32a386cUL},
+  {0x11bb28e57e7fdf54UL, 0x190d56b873f4c688UL},
+  {0x1629f31ede1fd72aUL, 0x1f50ac6690f1f82aUL},
+  {0x4dda37f34ad3e67aUL, 0x13926bc01a973b1aUL},
+  {0xe150c5f01d88e019UL, 0x187706b0213d09e0UL},
+  {0x19a4f76c24eb181fUL, 0x1e94c85c298c4c59UL},
+  {0xb0071aa39712ef13UL, 0x131cfd3999f7afb7UL},
+  {0x9c08e14c7cd7aad8UL, 0x17e43c8800759ba5UL},
+  {0x030b199f9c0d958eUL, 0x1ddd4baa0093028fUL},
+  {0x61e6f003c1887d79UL, 0x12aa4f4a405be199UL},
+  {0xba60ac04b1ea9cd7UL, 0x1754e31cd072d9ffUL},
+  {0xa8f8d705de65440dUL, 0x1d2a1be4048f907fUL},
+  {0xc99b8663aaff4a88UL, 0x123a516e82d9ba4fUL},
+  {0xbc0267fc95bf1d2aUL, 0x16c8e5ca239028e3UL},
+  {0xab0301fbbb2ee474UL, 0x1c7b1f3cac74331cUL},
+  {0xeae1e13d54fd4ec9UL, 0x11ccf385ebc89ff1UL},
+  {0x659a598caa3ca27bUL, 0x1640306766bac7eeUL},
+  {0xff00efefd4cbcb1aUL, 0x1bd03c81406979e9UL},
+  {0x3f6095f5e4ff5ef0UL, 0x116225d0c841ec32UL},
+  {0xcf38bb735e3f36acUL, 0x15baaf44fa52673eUL},
+  {0x8306ea5035cf0457UL, 0x1b295b1638e7010eUL},
+  {0x11e4527221a162b6UL, 0x10f9d8ede39060a9UL},
+  {0x565d670eaa09bb64UL, 0x15384f295c7478d3UL},
+  {0x2bf4c0d2548c2a3dUL, 0x1a8662f3b3919708UL},
+  {0x1b78f88374d79a66UL, 0x1093fdd8503afe65UL},
+  {0x625736a4520d8100UL, 0x14b8fd4e6449bdfeUL},
+  {0xfaed044d6690e140UL, 0x19e73ca1fd5c2d7dUL},
+  {0xbcd422b0601a8cc8UL, 0x103085e53e599c6eUL},
+  {0x6c092b5c78212ffaUL, 0x143ca75e8df0038aUL},
+  {0x070b763396297bf8UL, 0x194bd136316c046dUL},
+  {0x48ce53c07bb3daf6UL, 0x1f9ec583bdc70588UL},
+  {0x2d80f4584d5068daUL, 0x13c33b72569c6375UL},
+  {0x78e1316e60a48310UL, 0x18b40a4eec437c52UL}};
+
+/**
+ * @brief Returns ceil(log2(5^e)) for e in [0, 3528], or 1 for e = 0
+ */
+__device__ inline int32_t pow5bits(int32_t e)
+{
+  return static_cast<int32_t>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+/**
+ * @brief Returns floor(log10(2^e)) for e in [0, 1650]
+ */
+__device__ inline uint32_t log10_pow2(int32_t e)
+{
+  return (static_cast<uint32_t>(e) * 78913) >> 18;
+}
+
+/**
+ * @brief Returns floor(log10(5^e)) for e in [0, 2620]
+ */
+__device__ inline uint32_t log10_pow5(int32_t e)
+{
+  return (static_cast<uint32_t>(e) * 732923) >> 20;
+}
+
+__device__ inline uint32_t pow5_factor(uint64_t value)
+{
+  uint32_t count = 0;
+  while (value % 5 == 0) {
+    value /= 5;
+    ++count;
+  }
+  return count;
+}
+
+__device__ inline bool is_multiple_of_pow5(uint64_t value, uint32_t p)
+{
+  return pow5_factor(value) >= p;
+}
+
+__device__ inline bool is_multiple_of_pow2(uint64_t value, uint32_t p)
+{
+  return (value & ((uint64_t{1} << p) - 1)) == 0;
+}
+
+/**
+ * @brief Returns (m * mul) >> j where `mul` is a 128-bit {low, high} value and j >= 64
+ */
+__device__ inline uint64_t mul_shift(uint64_t m, uint64_t const* mul, int32_t j)
+{
+  using uint128 = unsigned __int128;
+  auto const low  = static_cast<uint128>(m) * mul[0];
+  auto const high = static_cast<uint128>(m) * mul[1];
+  return static_cast<uint64_t>(((low >> 64) + high) >> (j - 64));
+}
+
+/**
+ * @brief Decimal value `digits * 10^exponent`
+ */
+struct decimal_value {
+  uint64_t digits;   ///< significant digits without trailing zeros
+  int32_t exponent;  ///< power of 10 of the last digit
+};
+
+/**
+ * @brief Computes the shortest decimal inside the rounding interval of `m2 * 2^e2`
+ *
+ * @param m2 Binary mantissa including the implicit bit
+ * @param e2 Binary exponent reduced by 2 so the interval bounds are integers
+ * @param mm_shift True if the lower bound is half as far as the upper bound
+ * @return The shortest decimal, closest to the value when several have the same length
+ */
+__device__ inline decimal_value shortest_decimal(uint64_t m2, int32_t e2, bool mm_shift)
+{
+  bool const accept_bounds = (m2 % 2) == 0;
+
+  // the value and the bounds of its rounding interval times 4
+  uint64_t const mv  = 4 * m2;
+  uint64_t const mp  = mv + 2;
+  uint64_t const mm  = mv - 1 - static_cast<uint64_t>(mm_shift);
+  uint64_t vr        = 0;
+  uint64_t vp        = 0;
+  uint64_t vm        = 0;
+  int32_t e10        = 0;
+  bool vm_is_zeros   = false;  // true if the removed digits of vm are all zeros
+  bool vr_is_zeros   = false;  // true if the removed digits of vr are all zeros
+
+  if (e2 >= 0) {
+    auto const q = static_cast<int32_t>(log10_pow2(e2)) - static_cast<int32_t>(e2 > 3);
+    e10          = q;
+    auto const k = pow5_inv_bitcount + pow5bits(q) - 1;
+    auto const i = -e2 + q + k;
+    vr           = mul_shift(mv, pow5_inv_split[q], i);
+    vp           = mul_shift(mp, pow5_inv_split[q], i);
+    vm           = mul_shift(mm, pow5_inv_split[q], i);
+    if (q <= 21) {
+      // only one of mp, mv, and mm can be a multiple of 5
+      if (mv % 5 == 0) {
+        vr_is_zeros = is_multiple_of_pow5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_zeros = is_multiple_of_pow5(mm, q);
+      } else {
+        vp -= static_cast<uint64_t>(is_multiple_of_pow5(mp, q));
+      }
+    }
+  } else {
+    auto const q = static_cast<int32_t>(log10_pow5(-e2)) - static_cast<int32_t>(-e2 > 1);
+    e10          = q + e2;
+    auto const i = -e2 - q;
+    auto const k = pow5bits(i) - pow5_bitcount;
+    auto const j = q - k;
+    vr           = mul_shift(mv, pow5_split[i], j);
+    vp           = mul_shift(mp, pow5_split[i], j);
+    vm           = mul_shift(mm, pow5_split[i], j);
+    if (q <= 1) {
+      // mv has at least q trailing 0 bits and vr = mv * 5^i / 2^q
+      vr_is_zeros = true;
+      if (accept_bounds) {
+        vm_is_zeros = mm_shift;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_zeros = is_multiple_of_pow2(mv, q);
+    }
+  }
+
+  // remove digits while the interval still holds more than one decimal
+  int32_t removed       = 0;
+  uint64_t last_removed = 0;
+  if (vm_is_zeros || vr_is_zeros) {
+    while (vp / 10 > vm / 10) {
+      vm_is_zeros &= (vm % 10) == 0;
+      vr_is_zeros &= last_removed == 0;
+      last_removed = vr % 10;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_is_zeros) {
+      while (vm % 10 == 0) {
+        vr_is_zeros &= last_removed == 0;
+        last_removed = vr % 10;
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    // round half to even
+    if (vr_is_zeros && last_removed == 5 && vr % 2 == 0) { last_removed = 4; }
+    auto const round_up =
+      (vr == vm && (!accept_bounds || !vm_is_zeros)) || last_removed >= 5;
+    return decimal_value{vr + static_cast<uint64_t>(round_up), e10 + removed};
+  }
+
+  bool round_up = false;
+  while (vp / 10 > vm / 10) {
+    round_up = (vr % 10) >= 5;
+    vr /= 10;
+    vp /= 10;
+    vm /= 10;
+    ++removed;
+  }
+  return decimal_value{vr + static_cast<uint64_t>(vr == vm || round_up), e10 + removed};
+}
+
+/**
+ * @brief Computes the shortest decimal that converts back to `value`
+ *
+ * Precondition: `value` is finite and greater than zero.
+ *
+ * @tparam FloatType float or double
+ * @param value Value to convert
+ * @return The shortest decimal
+ */
+template <typename FloatType>
+__device__ inline decimal_value shortest_decimal(FloatType value)
+{
+  static_assert(std::is_floating_point_v<FloatType>);
+  using bits_type = std::conditional_t<sizeof(FloatType) == 8, uint64_t, uint32_t>;
+  constexpr int32_t mantissa_bits = std::is_same_v<FloatType, double> ? 52 : 23;
+  constexpr int32_t exponent_bias = std::is_same_v<FloatType, double> ? 1023 : 127;
+
+  bits_type bits;
+  memcpy(&bits, &value, sizeof(bits));
+  auto const mantissa = static_cast<uint64_t>(bits & ((bits_type{1} << mantissa_bits) - 1));
+  auto const exponent = static_cast<int32_t>(bits >> mantissa_bits);
+
+  // subnormal values have no implicit bit and the exponent of the smallest normal value
+  auto const m2 = exponent == 0 ? mantissa : (mantissa | (uint64_t{1} << mantissa_bits));
+  auto const e2 = (exponent == 0 ? 1 : exponent) - exponent_bias - mantissa_bits - 2;
+  return shortest_decimal(m2, e2, mantissa != 0 || exponent <= 1);
+}
+
+}  // namespace ryu
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -26,14 +26,18 @@
 #include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/device/device_memcpy.cuh>
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
@@ -70,6 +74,44 @@ struct chars_size_transform {
   }
 };
 
+/**
+ * @brief Returns the address of the first char of each input column
+ */
+struct chars_source_fn {
+  column_device_view const* input_views;
+  __device__ char const* operator()(size_type idx) const
+  {
+    auto const& col = input_views[idx];
+    if (col.size() == 0) { return nullptr; }  // empty column may not have children
+    auto const offsets   = col.child(strings_column_view::offsets_column_index);
+    auto const d_offsets = cudf::detail::input_offsetalator(offsets.head(), offsets.type());
+    return col.head<char>() + d_offsets[col.offset()];
+  }
+};
+
+/**
+ * @brief Returns the output address of the chars of each input column
+ */
+struct chars_destination_fn {
+  char* output_chars;
+  size_t const* partition_offsets;
+  __device__ char* operator()(size_type idx) const
+  {
+    return output_chars + partition_offsets[idx];
+  }
+};
+
+/**
+ * @brief Returns the number of chars of each input column
+ */
+struct chars_size_fn {
+  size_t const* partition_offsets;
+  __device__ size_t operator()(size_type idx) const
+  {
+    return partition_offsets[idx + 1] - partition_offsets[idx];
+  }
+};
+
 auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
@@ -275,26 +317,28 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
                                                             total_bytes,
                                                             d_new_chars);
     } else {
-      // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-
-        auto const bytes_offset = get_offset_value(offsets_child, column_offset, stream);
-        auto const bytes_end = get_offset_value(offsets_child, column_size + column_offset, stream);
-        // copy the chars column data
-        auto d_chars     = column->head<char>() + bytes_offset;
-        auto const bytes = bytes_end - bytes_offset;
-
-        CUDF_CUDA_TRY(
-          cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDefault, stream.value()));
-
-        // get ready for the next column
-        d_new_chars += bytes;
-      }
+      // Memcpy each input chars column (more efficient for very large strings).
+      // The copies are issued as one batch so that the cost does not grow with the number of
+      // inputs: the source addresses and sizes are read from the device views directly.
+      auto const num_columns = static_cast<size_type>(columns.size());
+      auto const index_it    = thrust::make_counting_iterator<size_type>(0);
+      auto const src_it      = thrust::make_transform_iterator(index_it, chars_source_fn{d_views});
+      auto const dst_it      = thrust::make_transform_iterator(
+        index_it, chars_destination_fn{d_new_chars, d_partition_offsets.data()});
+      auto const size_it =
+        thrust::make_transform_iterator(index_it, chars_size_fn{d_partition_offsets.data()});
+
+      std::size_t temp_storage_bytes = 0;
+      CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(
+        nullptr, temp_storage_bytes, src_it, dst_it, size_it, num_columns, stream.value()));
+      rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+      CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp_storage.data(),
+                                               temp_storage_bytes,
+                                               src_it,
+                                               dst_it,
+                                               size_it,
+                                               num_columns,
+                                               stream.value()));
     }
   }
 
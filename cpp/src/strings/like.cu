@@ -18,18 +18,26 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -119,10 +127,115 @@ struct like_fn {
   }
 };
 
-template <typename PatternIterator>
+/**
+ * @brief Literal segments of a LIKE pattern that contains no single-character wildcards
+ *
+ * The pattern `prefix%middle_1%...%middle_n%suffix` matches strings that start with
+ * `prefix`, end with `suffix`, and contain each middle segment in order between them.
+ * Any of the segments may be empty. A pattern without `%` has only one segment which
+ * must match the entire string.
+ */
+struct like_segments {
+  std::vector<char> chars;         ///< bytes of all the segments with escapes resolved
+  std::vector<size_type> offsets;  ///< offsets of each segment into chars
+  bool has_multi_wildcard{};       ///< true if the pattern contains `%`
+};
+
+/**
+ * @brief Splits a LIKE pattern into its literal segments
+ *
+ * @param pattern Host copy of the LIKE pattern
+ * @param escape Host copy of the escape character
+ * @return The pattern's segments or nothing if the pattern contains `_` wildcards
+ */
+std::optional<like_segments> parse_like_segments(std::string const& pattern,
+                                                 std::string const& escape)
+{
+  auto const char_size = [](std::string const& str, std::size_t pos) {
+    return std::min(static_cast<std::size_t>(bytes_in_utf8_byte(static_cast<uint8_t>(str[pos]))),
+                    str.size() - pos);
+  };
+  auto const esc_char = escape.empty() ? std::string{} : escape.substr(0, char_size(escape, 0));
+
+  like_segments result;
+  result.offsets.push_back(0);
+  std::size_t pos = 0;
+  while (pos < pattern.size()) {
+    auto chr_size = char_size(pattern, pos);
+    auto chr      = pattern.substr(pos, chr_size);
+    // an escape at the end of the pattern matches itself
+    auto const escaped = !esc_char.empty() && (chr == esc_char);
+    if (escaped && (pos + chr_size < pattern.size())) {
+      pos += chr_size;
+      chr_size = char_size(pattern, pos);
+      chr      = pattern.substr(pos, chr_size);
+    }
+    if (!escaped && chr.front() == multi_wildcard) {
+      result.offsets.push_back(static_cast<size_type>(result.chars.size()));
+      result.has_multi_wildcard = true;
+    } else if (!escaped && chr.front() == single_wildcard) {
+      return std::nullopt;
+    } else {
+      result.chars.insert(result.chars.end(), chr.begin(), chr.end());
+    }
+    pos += chr_size;
+  }
+  result.offsets.push_back(static_cast<size_type>(result.chars.size()));
+  return result;
+}
+
+/**
+ * @brief Matches strings against a pattern of literal segments
+ *
+ * The prefix and suffix are compared at the ends of each string and the
+ * middle segments are searched for left to right. Finding the leftmost
+ * occurrence of each middle segment is sufficient since the segments have
+ * no single-character wildcards. No backtracking is required.
+ */
+struct like_segments_fn {
+  column_device_view const d_strings;
+  char const* d_chars;
+  size_type const* d_offsets;
+  size_type segments_count;
+  bool has_multi_wildcard;
+
+  __device__ string_view segment(size_type idx) const
+  {
+    return string_view(d_chars + d_offsets[idx], d_offsets[idx + 1] - d_offsets[idx]);
+  }
+
+  __device__ bool operator()(size_type const idx) const
+  {
+    if (d_strings.is_null(idx)) { return false; }
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const prefix = segment(0);
+    if (!has_multi_wildcard) { return d_str == prefix; }
+
+    auto const suffix = segment(segments_count - 1);
+    auto const data   = d_str.data();
+    auto const end    = d_str.size_bytes() - suffix.size_bytes();
+    if ((end < prefix.size_bytes()) || (prefix.compare(data, prefix.size_bytes()) != 0) ||
+        (suffix.compare(data + end, suffix.size_bytes()) != 0)) {
+      return false;
+    }
+
+    auto pos = prefix.size_bytes();
+    for (size_type seg = 1; seg < segments_count - 1; ++seg) {
+      auto const d_segment = segment(seg);
+      auto const seg_size  = d_segment.size_bytes();
+      while ((pos + seg_size <= end) && (d_segment.compare(data + pos, seg_size) != 0)) {
+        ++pos;
+      }
+      if (pos + seg_size > end) { return false; }
+      pos += seg_size;
+    }
+    return true;
+  }
+};
+
+template <typename MatchFn>
 std::unique_ptr<column> like(strings_column_view const& input,
-                             PatternIterator const patterns_itr,
-                             string_view const& d_escape,
+                             MatchFn match_fn,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr)
 {
@@ -134,18 +247,43 @@ std::unique_ptr<column> like(strings_column_view const& input,
                                      mr);
   if (input.is_empty()) { return results; }
 
-  auto const d_strings = column_device_view::create(input.parent(), stream);
-
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(input.size()),
                     results->mutable_view().data<bool>(),
-                    like_fn{*d_strings, patterns_itr, d_escape});
+                    match_fn);
 
   results->set_null_count(input.null_count());
   return results;
 }
 
+template <typename PatternIterator>
+std::unique_ptr<column> like(strings_column_view const& input,
+                             PatternIterator const patterns_itr,
+                             string_view const& d_escape,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  return like(input, like_fn{*d_strings, patterns_itr, d_escape}, stream, mr);
+}
+
+std::unique_ptr<column> like(strings_column_view const& input,
+                             like_segments const& segments,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const d_chars   = cudf::detail::make_device_uvector_async(
+    segments.chars, stream, rmm::mr::get_current_device_resource());
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    segments.offsets, stream, rmm::mr::get_current_device_resource());
+  auto const segments_count = static_cast<size_type>(segments.offsets.size() - 1);
+  auto const match_fn = like_segments_fn{
+    *d_strings, d_chars.data(), d_offsets.data(), segments_count, segments.has_multi_wildcard};
+  return like(input, match_fn, stream, mr);
+}
+
 }  // namespace
 
 std::unique_ptr<column> like(strings_column_view const& input,
@@ -157,6 +295,11 @@ std::unique_ptr<column> like(strings_column_view const& input,
   CUDF_EXPECTS(pattern.is_valid(stream), "Parameter pattern must be valid");
   CUDF_EXPECTS(escape_character.is_valid(stream), "Parameter escape_character must be valid");
 
+  // patterns without `_` are matched by searching for their literal segments
+  auto const segments =
+    parse_like_segments(pattern.to_string(stream), escape_character.to_string(stream));
+  if (segments.has_value()) { return like(input, segments.value(), stream, mr); }
+
   auto const d_pattern    = pattern.value(stream);
   auto const patterns_itr = thrust::make_constant_iterator(d_pattern);
 
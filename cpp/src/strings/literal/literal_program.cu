@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings/literal/literal_program_impl.cuh"
+
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/literal_program.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace {
+
+/**
+ * @brief Host representation of the Aho-Corasick automaton
+ */
+struct host_automaton {
+  std::vector<uint16_t> byte_classes;
+  std::vector<size_type> transitions;
+  std::vector<size_type> output_offsets;
+  std::vector<size_type> output_ids;
+  std::vector<size_type> target_sizes;
+  size_type classes_count{};
+  size_type max_target_size{};
+};
+
+/**
+ * @brief Builds the automaton from the target strings
+ *
+ * @param chars Bytes of all the targets
+ * @param offsets Offsets of each target within `chars`
+ */
+host_automaton build_automaton(std::vector<char> const& chars, std::vector<int64_t> const& offsets)
+{
+  host_automaton result;
+  auto const targets_count = static_cast<size_type>(offsets.size() - 1);
+
+  // bytes not found in any target share class 0
+  result.byte_classes.assign(256, 0);
+  for (auto const chr : chars) {
+    auto& cls = result.byte_classes[static_cast<uint8_t>(chr)];
+    if (cls == 0) { cls = static_cast<uint16_t>(++result.classes_count); }
+  }
+  auto const classes_count = ++result.classes_count;
+
+  // build the trie; -1 marks a missing edge
+  std::vector<size_type> trie(classes_count, -1);
+  std::vector<std::vector<size_type>> outputs(1);
+  for (size_type tgt = 0; tgt < targets_count; ++tgt) {
+    auto const size = static_cast<size_type>(offsets[tgt + 1] - offsets[tgt]);
+    result.target_sizes.push_back(size);
+    result.max_target_size = std::max(result.max_target_size, size);
+
+    size_type state = 0;
+    for (auto idx = offsets[tgt]; idx < offsets[tgt + 1]; ++idx) {
+      auto const cls  = result.byte_classes[static_cast<uint8_t>(chars[idx])];
+      auto const edge = static_cast<std::size_t>(state) * classes_count + cls;
+      if (trie[edge] < 0) {
+        trie[edge] = static_cast<size_type>(outputs.size());
+        outputs.emplace_back();
+        trie.resize(trie.size() + classes_count, -1);
+      }
+      state = trie[edge];
+    }
+    outputs[state].push_back(tgt);
+  }
+
+  // convert the trie into a full transition table by following the failure links breadth-first
+  auto const states_count = static_cast<size_type>(outputs.size());
+  std::vector<size_type> fail(states_count, 0);
+  std::queue<size_type> states;
+  result.transitions = std::move(trie);
+  auto& delta        = result.transitions;
+  for (size_type cls = 0; cls < classes_count; ++cls) {
+    auto& next = delta[cls];
+    if (next < 0) {
+      next = 0;
+    } else {
+      states.push(next);
+    }
+  }
+  while (!states.empty()) {
+    auto const state = states.front();
+    states.pop();
+    auto const row = static_cast<std::size_t>(state) * classes_count;
+    // targets ending at the failure state also end here
+    auto const& fail_outputs = outputs[fail[state]];
+    outputs[state].insert(outputs[state].end(), fail_outputs.begin(), fail_outputs.end());
+    std::sort(outputs[state].begin(), outputs[state].end());
+    for (size_type cls = 0; cls < classes_count; ++cls) {
+      auto const fail_next = delta[static_cast<std::size_t>(fail[state]) * classes_count + cls];
+      auto& next           = delta[row + cls];
+      if (next < 0) {
+        next = fail_next;
+      } else {
+        fail[next] = fail_next;
+        states.push(next);
+      }
+    }
+  }
+
+  result.output_offsets.push_back(0);
+  for (auto const& ids : outputs) {
+    result.output_ids.insert(result.output_ids.end(), ids.begin(), ids.end());
+    result.output_offsets.push_back(static_cast<size_type>(result.output_ids.size()));
+  }
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<literal_program> literal_program::create(strings_column_view const& targets,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(targets.size() > 0, "Must include at least one target", std::invalid_argument);
+  CUDF_EXPECTS(!targets.has_nulls(), "Targets cannot contain null strings", std::invalid_argument);
+
+  // copy the targets to the host
+  auto const offsets_itr =
+    cudf::detail::offsetalator_factory::make_input_iterator(targets.offsets(), targets.offset());
+  auto d_offsets = rmm::device_uvector<int64_t>(targets.size() + 1, stream);
+  thrust::copy(
+    rmm::exec_policy(stream), offsets_itr, offsets_itr + targets.size() + 1, d_offsets.begin());
+  auto h_offsets   = cudf::detail::make_std_vector_sync(d_offsets, stream);
+  auto const first = h_offsets.front();
+  std::transform(h_offsets.begin(), h_offsets.end(), h_offsets.begin(), [first](auto offset) {
+    return offset - first;
+  });
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(targets.chars_begin(stream) + first, h_offsets.back()), stream);
+
+  auto const has_empty = std::adjacent_find(h_offsets.begin(), h_offsets.end()) != h_offsets.end();
+  CUDF_EXPECTS(!has_empty, "Targets cannot contain empty strings", std::invalid_argument);
+
+  auto const automaton = build_automaton(h_chars, h_offsets);
+
+  auto impl = std::make_unique<literal_program_impl>(literal_program_impl{
+    cudf::detail::make_device_uvector_async(automaton.byte_classes, stream, mr),
+    cudf::detail::make_device_uvector_async(automaton.transitions, stream, mr),
+    cudf::detail::make_device_uvector_async(automaton.output_offsets, stream, mr),
+    cudf::detail::make_device_uvector_async(automaton.output_ids, stream, mr),
+    cudf::detail::make_device_uvector_async(automaton.target_sizes, stream, mr),
+    automaton.classes_count,
+    automaton.max_target_size});
+  // the host vectors must outlive the copies
+  stream.synchronize();
+
+  return std::unique_ptr<literal_program>(new literal_program(std::move(impl)));
+}
+
+literal_program::literal_program(std::unique_ptr<literal_program_impl>&& impl)
+  : _impl(std::move(impl))
+{
+}
+
+literal_program::~literal_program()                                  = default;
+literal_program::literal_program(literal_program&& other)            = default;
+literal_program& literal_program::operator=(literal_program&& other) = default;
+
+size_type literal_program::targets_count() const
+{
+  return static_cast<size_type>(_impl->target_sizes.size());
+}
+
+size_type literal_program::states_count() const
+{
+  return static_cast<size_type>(_impl->output_offsets.size() - 1);
+}
+
+}  // namespace strings
+}  // namespace cudf
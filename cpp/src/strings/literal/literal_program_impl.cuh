@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/literal_program.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Device view of the Aho-Corasick automaton in a literal_program
+ *
+ * The transition table is dense over byte classes: every byte found in any target has
+ * its own class and all other bytes share class 0. State 0 is the root.
+ */
+struct literal_program_device {
+  uint16_t const* byte_classes{};     ///< class of each byte value (256 entries)
+  size_type const* transitions{};     ///< next state for each state and class
+  size_type const* output_offsets{};  ///< offsets into output_ids for each state
+  size_type const* output_ids{};      ///< ids of targets ending at each state
+  size_type const* target_sizes{};    ///< size in bytes of each target
+  size_type classes_count{};          ///< number of byte classes
+  size_type max_target_size{};        ///< size in bytes of the longest target
+
+  /**
+   * @brief Returns the state reached from `state` by consuming `chr`
+   */
+  __device__ inline size_type next_state(size_type const state, char const chr) const
+  {
+    auto const cls = byte_classes[static_cast<uint8_t>(chr)];
+    return transitions[static_cast<int64_t>(state) * classes_count + cls];
+  }
+
+  /**
+   * @brief Returns true if any target ends at the given state
+   */
+  __device__ inline bool has_outputs(size_type const state) const
+  {
+    return output_offsets[state + 1] > output_offsets[state];
+  }
+
+  /**
+   * @brief Returns the ids of the targets ending at the given state in ascending order
+   */
+  __device__ inline device_span<size_type const> outputs(size_type const state) const
+  {
+    auto const begin = output_offsets[state];
+    return {output_ids + begin, static_cast<std::size_t>(output_offsets[state + 1] - begin)};
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Implementation object for literal_program
+ *
+ * It owns the device memory for the automaton built by literal_program::create()
+ */
+struct literal_program::literal_program_impl {
+  rmm::device_uvector<uint16_t> byte_classes;
+  rmm::device_uvector<size_type> transitions;
+  rmm::device_uvector<size_type> output_offsets;
+  rmm::device_uvector<size_type> output_ids;
+  rmm::device_uvector<size_type> target_sizes;
+  size_type classes_count;
+  size_type max_target_size;
+
+  [[nodiscard]] detail::literal_program_device view() const
+  {
+    return detail::literal_program_device{byte_classes.data(),
+                                          transitions.data(),
+                                          output_offsets.data(),
+                                          output_ids.data(),
+                                          target_sizes.data(),
+                                          classes_count,
+                                          max_target_size};
+  }
+};
+
+struct literal_device_builder {
+  static detail::literal_program_device create_prog_device(literal_program const& p)
+  {
+    return p._impl->view();
+  }
+};
+
+}  // namespace strings
+}  // namespace cudf
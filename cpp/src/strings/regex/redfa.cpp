@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings/regex/redfa.cuh"
+#include "strings/regex/redfa.h"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stack>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Evaluates a class against an ASCII character
+ *
+ * This mirrors `reclass_device::is_match` for the ASCII range of the character flags table.
+ */
+bool is_ascii_class_match(reclass const& cls, char32_t const ch)
+{
+  auto const in_literals = std::any_of(cls.literals.begin(), cls.literals.end(), [ch](auto r) {
+    return (ch >= r.first) && (ch <= r.last);
+  });
+  if (in_literals) { return true; }
+
+  auto const builtins = cls.builtins;
+  bool const is_digit = (ch >= '0') && (ch <= '9');
+  bool const is_alnum = is_digit || ((ch >= 'A') && (ch <= 'Z')) || ((ch >= 'a') && (ch <= 'z'));
+  bool const is_space = ((ch >= 9) && (ch <= 13)) || ((ch >= 28) && (ch <= 32));
+  return ((builtins & CCLASS_W) && ((ch == '_') || is_alnum)) ||
+         ((builtins & CCLASS_S) && is_space) || ((builtins & CCLASS_D) && is_digit) ||
+         ((builtins & NCCLASS_W) && (ch != '\n') && (ch != '_') && !is_alnum) ||
+         ((builtins & NCCLASS_S) && !is_space) ||
+         ((builtins & NCCLASS_D) && (ch != '\n') && !is_digit);
+}
+
+/**
+ * @brief Returns true if END is reached from `id` without consuming a character
+ */
+bool is_terminal(reprog const& prog, int32_t id)
+{
+  auto const insts = prog.insts_data();
+  std::vector<bool> visited(prog.insts_count(), false);
+  std::stack<int32_t> ids;
+  ids.push(id);
+  while (!ids.empty()) {
+    id = ids.top();
+    ids.pop();
+    if (visited[id]) { continue; }
+    visited[id]      = true;
+    auto const& inst = insts[id];
+    switch (inst.type) {
+      case OR:
+        ids.push(inst.u1.right_id);
+        ids.push(inst.u2.left_id);
+        break;
+      case LBRA:
+      case RBRA: ids.push(inst.u2.next_id); break;
+      case END: break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns true if every instruction in `prog` can be evaluated by the DFA
+ *
+ * Word boundaries and MULTILINE `^` depend on the previous character and an `$` followed by
+ * more instructions depends on the next one so these are left to the NFA.
+ */
+bool is_supported(reprog const& prog)
+{
+  auto const insts = prog.insts_data();
+  for (int32_t id = 0; id < prog.insts_count(); ++id) {
+    auto const& inst = insts[id];
+    switch (inst.type) {
+      case CHAR:
+        if ((inst.u1.c == 0) || (inst.u1.c >= redfa::alphabet_size)) { return false; }
+        break;
+      case BOL:
+        if (inst.u1.c == '^') { return false; }
+        break;
+      case EOL:
+        if (!is_terminal(prog, inst.u2.next_id)) { return false; }
+        break;
+      case RBRA:
+      case LBRA:
+      case OR:
+      case ANY:
+      case ANYNL:
+      case CCLASS:
+      case NCCLASS:
+      case END: break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Expands the non-consuming instructions reachable from `kernel`
+ *
+ * @param prog Compiled regex instructions
+ * @param kernel Instruction ids to expand
+ * @param at_start True if evaluating the first character position of the string
+ * @return Sorted instruction ids of the resulting DFA state
+ */
+std::vector<int32_t> closure(reprog const& prog, std::vector<int32_t> const& kernel, bool at_start)
+{
+  auto const insts = prog.insts_data();
+  std::vector<bool> visited(prog.insts_count(), false);
+  std::vector<int32_t> result;
+  std::stack<int32_t> ids;
+  for (auto id : kernel) {
+    ids.push(id);
+  }
+  while (!ids.empty()) {
+    auto const id = ids.top();
+    ids.pop();
+    if (visited[id]) { continue; }
+    visited[id]      = true;
+    auto const& inst = insts[id];
+    switch (inst.type) {
+      case OR:
+        ids.push(inst.u1.right_id);
+        ids.push(inst.u2.left_id);
+        break;
+      case LBRA:
+      case RBRA: ids.push(inst.u2.next_id); break;
+      case BOL:
+        if (at_start) { ids.push(inst.u2.next_id); }
+        break;
+      default: result.push_back(id);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/**
+ * @brief Returns the accept flags for the given DFA state
+ */
+uint8_t accept_flags(reprog const& prog, std::vector<int32_t> const& state)
+{
+  if (state.empty()) { return DFA_DEAD; }
+  uint8_t flags = 0;
+  for (auto id : state) {
+    auto const& inst = prog.insts_data()[id];
+    if (inst.type == END) { flags |= DFA_ACCEPT; }
+    if (inst.type == EOL) {
+      flags |= DFA_ACCEPT_AT_END;
+      if (inst.u1.c != 'Z') { flags |= DFA_ACCEPT_AT_FINAL_NEWLINE; }
+      if (inst.u1.c == '$') { flags |= DFA_ACCEPT_AT_NEWLINE; }
+    }
+  }
+  return flags;
+}
+
+/**
+ * @brief Returns true if the instruction consumes the given ASCII character
+ */
+bool is_consumed(reprog const& prog, reinst const& inst, char32_t const ch)
+{
+  switch (inst.type) {
+    case CHAR: return inst.u1.c == ch;
+    case ANY: return ch != '\n';
+    case ANYNL: return true;
+    case CCLASS:
+    case NCCLASS:
+      return is_ascii_class_match(prog.class_at(inst.u1.cls_id), ch) == (inst.type == CCLASS);
+    default: return false;
+  }
+}
+
+}  // namespace
+
+std::optional<redfa> redfa::create_from(reprog const& prog, bool anchored)
+{
+  if (prog.insts_count() == 0 || !is_supported(prog)) { return std::nullopt; }
+
+  std::vector<int32_t> const starts(prog.starts_data(),
+                                    std::find(prog.starts_data(),
+                                              prog.starts_data() + prog.starts_count(),
+                                              -1));
+
+  redfa dfa;
+  std::vector<std::vector<int32_t>> states;
+  std::map<std::vector<int32_t>, int32_t> state_ids;
+
+  // returns the id of the given state adding it if it is new
+  auto add_state = [&](std::vector<int32_t>&& state) -> std::optional<int32_t> {
+    auto const itr = state_ids.find(state);
+    if (itr != state_ids.end()) { return itr->second; }
+    auto const id = static_cast<int32_t>(states.size());
+    if (id >= max_states) { return std::nullopt; }
+    dfa._accepts.push_back(accept_flags(prog, state));
+    state_ids.emplace(state, id);
+    states.emplace_back(std::move(state));
+    return id;
+  };
+
+  // state 0 is the start state
+  add_state(closure(prog, starts, true));
+
+  // states are appended while they are processed
+  for (std::size_t sid = 0; sid < states.size(); ++sid) {
+    dfa._transitions.resize((sid + 1) * alphabet_size, 0);
+    for (int32_t ch = 0; ch < alphabet_size; ++ch) {
+      std::vector<int32_t> kernel;
+      for (auto id : states[sid]) {
+        auto const& inst = prog.insts_data()[id];
+        if (is_consumed(prog, inst, static_cast<char32_t>(ch))) {
+          kernel.push_back(inst.u2.next_id);
+        }
+      }
+      // matching may begin at any position unless anchored
+      if (!anchored) { kernel.insert(kernel.end(), starts.begin(), starts.end()); }
+      auto const next_id = add_state(closure(prog, kernel, false));
+      if (!next_id.has_value()) { return std::nullopt; }
+      dfa._transitions[sid * alphabet_size + ch] = static_cast<uint8_t>(next_id.value());
+    }
+  }
+
+  return dfa;
+}
+
+int32_t redfa::states_count() const { return static_cast<int32_t>(_accepts.size()); }
+
+uint8_t const* redfa::transitions_data() const { return _transitions.data(); }
+
+uint8_t const* redfa::accepts_data() const { return _accepts.data(); }
+
+std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> redfa_device::create(
+  redfa const& dfa, rmm::cuda_stream_view stream)
+{
+  auto const transitions_size = dfa.states_count() * redfa::alphabet_size;
+  auto const memsize          = transitions_size + dfa.states_count();
+
+  // copy both tables into a flat contiguous buffer
+  std::vector<uint8_t> h_buffer(memsize);
+  memcpy(h_buffer.data(), dfa.transitions_data(), transitions_size);
+  memcpy(h_buffer.data() + transitions_size, dfa.accepts_data(), dfa.states_count());
+  auto d_buffer = new rmm::device_buffer(memsize, stream);
+  CUDF_CUDA_TRY(
+    cudaMemcpyAsync(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyDefault, stream.value()));
+
+  auto d_dfa          = new redfa_device();
+  d_dfa->_transitions = reinterpret_cast<uint8_t const*>(d_buffer->data());
+  d_dfa->_accepts     = d_dfa->_transitions + transitions_size;
+
+  // build deleter to cleanup device memory
+  auto deleter = [d_buffer](redfa_device* t) {
+    delete t;
+    delete d_buffer;
+  };
+
+  return std::unique_ptr<redfa_device, std::function<void(redfa_device*)>>(d_dfa, deleter);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "strings/regex/redfa.h"
+
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/optional.h>
+
+#include <functional>
+#include <memory>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Regex DFA device object
+ *
+ * Scans each byte of a string exactly once using the transition table built
+ * by `redfa`. The scan returns an empty value when the string contains
+ * a non-ASCII byte so the caller can fall back to the NFA.
+ *
+ * A default constructed object holds no automaton and `is_valid()` returns false.
+ */
+class redfa_device {
+ public:
+  redfa_device() = default;
+
+  /**
+   * @brief Create device DFA instance from a host DFA
+   *
+   * @param dfa The DFA to copy to device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The DFA device object
+   */
+  static std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> create(
+    redfa const& dfa, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if this object holds an automaton
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE bool is_valid() const { return _transitions != nullptr; }
+
+  /**
+   * @brief Returns true if the pattern matches the given string
+   *
+   * @param d_str String to scan
+   * @return Match result or empty if `d_str` contains non-ASCII characters
+   */
+  __device__ inline thrust::optional<bool> is_match(string_view const d_str) const
+  {
+    auto const d_bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+    auto const size    = d_str.size_bytes();
+
+    int32_t state = 0;
+    for (size_type idx = 0; idx < size; ++idx) {
+      auto const accept = _accepts[state];
+      if (accept & DFA_ACCEPT) { return true; }
+      if (accept & DFA_DEAD) { return false; }
+      auto const chr = d_bytes[idx];
+      if (chr >= redfa::alphabet_size) { return thrust::nullopt; }
+      if ((chr == '\n') && ((accept & DFA_ACCEPT_AT_NEWLINE) ||
+                            ((accept & DFA_ACCEPT_AT_FINAL_NEWLINE) && (idx + 1 == size)))) {
+        return true;
+      }
+      state = _transitions[state * redfa::alphabet_size + chr];
+    }
+    return (_accepts[state] & (DFA_ACCEPT | DFA_ACCEPT_AT_END)) != 0;
+  }
+
+ private:
+  uint8_t const* _transitions{};
+  uint8_t const* _accepts{};
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "strings/regex/regcomp.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Accept flags recorded for each DFA state
+ *
+ * A state accepts unconditionally when its closure contains END.
+ * The remaining flags record EOL instructions whose continuation reaches END
+ * so the scanner can resolve them against the current byte.
+ */
+enum redfa_accept : uint8_t {
+  DFA_ACCEPT                  = 1 << 0,  // END is reachable without consuming input
+  DFA_ACCEPT_AT_END           = 1 << 1,  // accept if no more input remains
+  DFA_ACCEPT_AT_NEWLINE       = 1 << 2,  // accept before any new-line (MULTILINE '$')
+  DFA_ACCEPT_AT_FINAL_NEWLINE = 1 << 3,  // accept before a new-line ending the string
+  DFA_DEAD                    = 1 << 4   // no match is possible from this state
+};
+
+/**
+ * @brief Deterministic automaton built from a regex program
+ *
+ * The automaton is built by subset construction over the ASCII alphabet only.
+ * It is created for patterns without word boundaries, MULTILINE `^`, or `$` in the
+ * middle of the expression and only when the number of states stays within `max_states`.
+ * Strings with non-ASCII bytes must still be evaluated by the NFA in `reprog_device`.
+ */
+class redfa {
+ public:
+  static constexpr int32_t alphabet_size = 128;  ///< ASCII characters only
+  static constexpr int32_t max_states    = 256;  ///< state ids must fit in a uint8_t
+
+  /**
+   * @brief Builds a DFA from the given regex program
+   *
+   * @param prog Compiled regex instructions
+   * @param anchored True if the match must begin at the first character of the string
+   * @return The DFA or an empty value if `prog` is not supported
+   */
+  static std::optional<redfa> create_from(reprog const& prog, bool anchored);
+
+  [[nodiscard]] int32_t states_count() const;
+  [[nodiscard]] uint8_t const* transitions_data() const;
+  [[nodiscard]] uint8_t const* accepts_data() const;
+
+ private:
+  std::vector<uint8_t> _transitions;  // states_count x alphabet_size next state ids
+  std::vector<uint8_t> _accepts;      // redfa_accept flags per state
+
+  redfa() = default;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -145,6 +145,8 @@ int32_t const* reprog::starts_data() const { return _startinst_ids.data(); }
 
 int32_t reprog::starts_count() const { return static_cast<int>(_startinst_ids.size()); }
 
+std::string const& reprog::required_literal() const { return _required_literal; }
+
 static constexpr auto MAX_REGEX_CHAR = std::numeric_limits<char32_t>::max();
 
 /**
@@ -1031,7 +1033,11 @@ reprog reprog::create_from(std::string_view pattern,
 
 void reprog::optimize() { collapse_nops(); }
 
-void reprog::finalize() { build_start_ids(); }
+void reprog::finalize()
+{
+  build_start_ids();
+  build_required_literal();
+}
 
 void reprog::collapse_nops()
 {
@@ -1106,6 +1112,56 @@ void reprog::build_start_ids()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+// find the longest chain of CHAR instructions found on every path to END
+void reprog::build_required_literal()
+{
+  _required_literal.clear();
+  // the search below is quadratic in the number of instructions
+  constexpr int32_t max_insts = 1024;
+  auto const count            = insts_count();
+  if (count == 0 || count > max_insts) { return; }
+
+  // returns true if END can be reached without executing the `skip_id` instruction
+  auto reaches_end = [&](int32_t skip_id) {
+    std::vector<bool> visited(count, false);
+    std::stack<int32_t> ids;
+    ids.push(_startinst_id);
+    while (!ids.empty()) {
+      auto const id = ids.top();
+      ids.pop();
+      if (id == skip_id || visited[id]) { continue; }
+      visited[id]        = true;
+      reinst const& inst = _insts[id];
+      if (inst.type == END) { return true; }
+      ids.push(inst.u2.next_id);
+      if (inst.type == OR) { ids.push(inst.u1.right_id); }
+    }
+    return false;
+  };
+
+  // capture groups do not consume characters
+  auto skip_brackets = [&](int32_t id) {
+    while (_insts[id].type == LBRA || _insts[id].type == RBRA) {
+      id = _insts[id].u2.next_id;
+    }
+    return id;
+  };
+
+  for (auto id = 0; id < count; ++id) {
+    if (_insts[id].type != CHAR || reaches_end(id)) { continue; }
+    // every CHAR that directly follows a required CHAR is also required
+    std::string literal;
+    auto next_id = id;
+    for (auto length = 0; length < count && _insts[next_id].type == CHAR; ++length) {
+      char buffer[4];
+      auto const bytes = from_char_utf8(_insts[next_id].u1.c, buffer);
+      literal.append(buffer, bytes);
+      next_id = skip_brackets(_insts[next_id].u2.next_id);
+    }
+    if (literal.size() > _required_literal.size()) { _required_literal = std::move(literal); }
+  }
+}
+
 /**
  * @brief Check a specific instruction for errors.
  *
@@ -137,6 +137,13 @@ class reprog {
   void set_start_inst(int32_t id);
   [[nodiscard]] int32_t get_start_inst() const;
 
+  /**
+   * @brief Returns a UTF-8 substring that every match must contain
+   *
+   * This is empty if no such substring was found.
+   */
+  [[nodiscard]] std::string const& required_literal() const;
+
   void optimize();
   void finalize();
   void check_for_errors();
@@ -150,10 +157,12 @@ class reprog {
   int32_t _startinst_id{};              // id of first instruction
   std::vector<int32_t> _startinst_ids;  // short-cut to speed-up ORs
   int32_t _num_capturing_groups{};
+  std::string _required_literal;        // substring found in every match
 
   reprog() = default;
   void collapse_nops();
   void build_start_ids();
+  void build_required_literal();
   void check_for_errors(int32_t id, int32_t next_id);
 };
 
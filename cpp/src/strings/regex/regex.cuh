@@ -41,6 +41,7 @@ using match_result = thrust::optional<match_pair>;
 constexpr int32_t MAX_SHARED_MEM      = 2048;  ///< Memory size for storing prog instruction data
 constexpr std::size_t MAX_WORKING_MEM = 0x01'FFFF'FFFF;  ///< Memory size for state data
 constexpr int32_t MINIMUM_THREADS     = 256;  // Minimum threads for computing working memory
+constexpr int32_t MAX_LITERAL_BYTES   = 16;   // Maximum bytes kept for the required literal
 
 /**
  * @brief Regex class stored on the device and executed by reprog_device.
@@ -159,7 +160,37 @@ class reprog_device {
   /**
    * @brief Returns the thread count passed on `set_working_memory`.
    */
-  [[nodiscard]] __device__ inline int32_t thread_count() const { return _thread_count; }
+  [[nodiscard]] CUDF_HOST_DEVICE inline int32_t thread_count() const { return _thread_count; }
+
+  /**
+   * @brief Returns the buffer passed on `set_working_memory`.
+   */
+  [[nodiscard]] void* working_memory() const { return _buffer; }
+
+  /**
+   * @brief Set a device working memory buffer owned by a program cache.
+   *
+   * The buffer outlives any single kernel launch and is reused by each launch
+   * that needs no more than `thread_count` threads.
+   *
+   * @param buffer Device memory pointer.
+   * @param thread_count Number of threads the memory buffer will support.
+   */
+  void set_cached_working_memory(void* buffer, int32_t thread_count)
+  {
+    _cached_buffer       = buffer;
+    _cached_thread_count = thread_count;
+  }
+
+  /**
+   * @brief Returns the buffer passed on `set_cached_working_memory`.
+   */
+  [[nodiscard]] void* cached_working_memory() const { return _cached_buffer; }
+
+  /**
+   * @brief Returns the thread count passed on `set_cached_working_memory`.
+   */
+  [[nodiscard]] int32_t cached_thread_count() const { return _cached_thread_count; }
 
   /**
    * @brief Store this object into the given device pointer (e.g. shared memory).
@@ -222,6 +253,14 @@ class reprog_device {
     __device__ inline void swaplist();
   };
 
+  /**
+   * @brief Returns false if the required literal is not found at or after `begin`.
+   *
+   * Strings that fail this check cannot match so the NFA evaluation is skipped.
+   */
+  __device__ inline bool has_literal(string_view const d_str,
+                                     string_view::const_iterator begin) const;
+
   /**
    * @brief Returns the regex instruction object for a given id.
    */
@@ -264,9 +303,15 @@ class reprog_device {
   int32_t const* _startinst_ids{};    // array of start instruction ids
   reclass_device const* _classes{};   // array of regex classes
 
+  char _literal[MAX_LITERAL_BYTES]{};  // prefix of substring required in every match
+  int32_t _literal_size{};             // number of bytes in _literal
+
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
   int32_t _thread_count{};   // threads available in working memory
+
+  void* _cached_buffer{};          // working memory owned by a program cache
+  int32_t _cached_thread_count{};  // threads available in the cached working memory
 };
 
 /**
@@ -395,16 +395,34 @@ __device__ __forceinline__ match_result reprog_device::regexec(string_view const
     ++itr;
     jnk.swaplist();
     checkstart = jnk.list1->get_size() == 0;
-  } while (!last_character && (!checkstart || !match));
+    // no active states and no more start positions means no match is possible
+  } while (!last_character && (!checkstart || (!match && ((eos < 0) || (pos < eos)))));
 
   return match ? match_result({begin, end}) : thrust::nullopt;
 }
 
+__device__ __forceinline__ bool reprog_device::has_literal(string_view const dstr,
+                                                           string_view::const_iterator begin) const
+{
+  if (_literal_size == 0) { return true; }
+  auto const d_bytes = dstr.data();
+  auto const last    = dstr.size_bytes() - _literal_size;
+  for (auto pos = begin.byte_offset(); pos <= last; ++pos) {
+    auto idx = 0;
+    while ((idx < _literal_size) && (d_bytes[pos + idx] == _literal[idx])) {
+      ++idx;
+    }
+    if (idx == _literal_size) { return true; }
+  }
+  return false;
+}
+
 __device__ __forceinline__ match_result reprog_device::find(int32_t const thread_idx,
                                                             string_view const dstr,
                                                             string_view::const_iterator begin,
                                                             cudf::size_type end) const
 {
+  if (!has_literal(dstr, begin)) { return thrust::nullopt; }
   return call_regexec(thread_idx, dstr, begin, end);
 }
 
@@ -18,7 +18,12 @@
 
 #include <cudf/strings/regex/regex_program.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace cudf {
@@ -59,5 +64,35 @@ std::size_t regex_program::compute_working_memory_size(int32_t num_strings) cons
   return detail::compute_working_memory_size(num_strings, instructions_count());
 }
 
+void regex_program::cache_device_program(size_type num_strings, rmm::cuda_stream_view stream)
+{
+  auto& impl = *_impl;
+  std::lock_guard<std::mutex> guard(impl.cache_mutex);
+  if (!impl.d_prog_cache) {
+    impl.d_prog_cache = detail::reprog_device::create(impl.prog, stream);
+    // the device copy may be used on other streams
+    stream.synchronize();
+  }
+  auto const [buffer_size, thread_count] =
+    impl.d_prog_cache->compute_strided_working_memory(std::max(num_strings, 1));
+  impl.working_memories.insert_or_assign(
+    stream.value(),
+    regex_program_impl::working_memory{rmm::device_buffer(buffer_size, stream), thread_count});
+}
+
+void regex_program::release_device_program()
+{
+  auto& impl = *_impl;
+  std::lock_guard<std::mutex> guard(impl.cache_mutex);
+  impl.working_memories.clear();
+  impl.d_prog_cache.reset();
+}
+
+bool regex_program::is_device_program_cached() const
+{
+  std::lock_guard<std::mutex> guard(_impl->cache_mutex);
+  return _impl->d_prog_cache != nullptr;
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -15,12 +15,22 @@
  */
 #pragma once
 
+#include "redfa.cuh"
+#include "redfa.h"
 #include "regcomp.h"
 #include "regex.cuh"
 
 #include <cudf/strings/regex/regex_program.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 
 namespace cudf {
 namespace strings {
@@ -36,14 +46,68 @@ struct regex_program::regex_program_impl {
   regex_program_impl(detail::reprog const& p) : prog(p) {}
   regex_program_impl(detail::reprog&& p) : prog(p) {}
 
+  /**
+   * @brief Returns the DFA for this program or nullptr if the pattern is not supported
+   *
+   * The DFA is built on first use and kept for subsequent calls.
+   *
+   * @param anchored True if the match must begin at the first character of the string
+   */
+  detail::redfa const* get_dfa(bool anchored)
+  {
+    auto const idx = static_cast<std::size_t>(anchored);
+    std::call_once(dfa_flags[idx], [&] { dfas[idx] = detail::redfa::create_from(prog, anchored); });
+    return dfas[idx].has_value() ? &dfas[idx].value() : nullptr;
+  }
+
   // TODO: There will be other options added here in the future to handle issues
   // 10852 and possibly others like 11979
+
+  using device_prog_ptr =
+    std::unique_ptr<detail::reprog_device, std::function<void(detail::reprog_device*)>>;
+
+  /**
+   * @brief Cached working memory for a stream
+   */
+  struct working_memory {
+    rmm::device_buffer buffer;
+    int32_t thread_count;
+  };
+
+  std::mutex cache_mutex;
+  device_prog_ptr d_prog_cache;                             // set by cache_device_program()
+  std::map<cudaStream_t, working_memory> working_memories;  // keyed by stream
+
+ private:
+  std::array<std::once_flag, 2> dfa_flags;
+  std::array<std::optional<detail::redfa>, 2> dfas;  // unanchored and anchored
 };
 
 struct regex_device_builder {
   static auto create_prog_device(regex_program const& p, rmm::cuda_stream_view stream)
   {
-    return detail::reprog_device::create(p._impl->prog, stream);
+    auto& impl = *p._impl;
+    std::lock_guard<std::mutex> guard(impl.cache_mutex);
+    if (!impl.d_prog_cache) { return detail::reprog_device::create(impl.prog, stream); }
+
+    // the copy does not own any of the cached device memory
+    auto d_prog        = new detail::reprog_device(*impl.d_prog_cache);
+    auto const scratch = impl.working_memories.find(stream.value());
+    if (scratch != impl.working_memories.end()) {
+      d_prog->set_cached_working_memory(scratch->second.buffer.data(),
+                                        scratch->second.thread_count);
+    }
+    return regex_program_impl::device_prog_ptr(d_prog, [](auto t) { delete t; });
+  }
+
+  static auto create_dfa_device(regex_program const& p,
+                                bool anchored,
+                                rmm::cuda_stream_view stream)
+  {
+    using dfa_device_ptr =
+      std::unique_ptr<detail::redfa_device, std::function<void(detail::redfa_device*)>>;
+    auto const dfa = p._impl->get_dfa(anchored);
+    return dfa ? detail::redfa_device::create(*dfa, stream) : dfa_device_ptr{};
   }
 };
 
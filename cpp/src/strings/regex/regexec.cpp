@@ -42,6 +42,9 @@ reprog_device::reprog_device(reprog const& prog)
     _max_insts{prog.insts_count()},
     _codepoint_flags{get_character_flags_table()}
 {
+  auto const& literal = prog.required_literal();
+  _literal_size       = std::min(static_cast<int32_t>(literal.size()), MAX_LITERAL_BYTES);
+  std::copy_n(literal.data(), _literal_size, _literal);
 }
 
 std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
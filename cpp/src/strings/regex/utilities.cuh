@@ -26,11 +26,14 @@
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/scan.h>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 namespace cudf {
@@ -39,6 +42,32 @@ namespace detail {
 
 constexpr auto regex_launch_kernel_block_size = 256;
 
+/**
+ * @brief Sets the working memory on `d_prog` for processing `rows` strings
+ *
+ * The cached working memory of `d_prog` is reused if it supports at least as many
+ * parallel strings as would be allocated here. Only programs copied from a cache
+ * created with `regex_program::cache_device_program()` have cached working memory.
+ *
+ * @param d_prog Device program to set the working memory for
+ * @param rows Number of strings to be processed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Buffer owning any newly allocated working memory
+ */
+inline rmm::device_buffer prepare_working_memory(reprog_device& d_prog,
+                                                 int32_t rows,
+                                                 rmm::cuda_stream_view stream)
+{
+  auto const [buffer_size, thread_count] = d_prog.compute_strided_working_memory(rows);
+  if (d_prog.cached_working_memory() != nullptr && d_prog.cached_thread_count() >= thread_count) {
+    d_prog.set_working_memory(d_prog.cached_working_memory(), thread_count);
+    return rmm::device_buffer{0, stream};
+  }
+  auto d_buffer = rmm::device_buffer(buffer_size, stream);
+  d_prog.set_working_memory(d_buffer.data(), thread_count);
+  return d_buffer;
+}
+
 template <typename ForEachFunction>
 CUDF_KERNEL void for_each_kernel(ForEachFunction fn, reprog_device const d_prog, size_type size)
 {
@@ -62,10 +91,8 @@ void launch_for_each_kernel(ForEachFunction fn,
                             size_type size,
                             rmm::cuda_stream_view stream)
 {
-  auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(size);
-
-  auto d_buffer = rmm::device_buffer(buffer_size, stream);
-  d_prog.set_working_memory(d_buffer.data(), thread_count);
+  auto const d_buffer     = prepare_working_memory(d_prog, size, stream);
+  auto const thread_count = d_prog.thread_count();
 
   auto const shmem_size = d_prog.compute_shared_memory_size();
   cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
@@ -100,10 +127,8 @@ void launch_transform_kernel(TransformFunction fn,
                              size_type size,
                              rmm::cuda_stream_view stream)
 {
-  auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(size);
-
-  auto d_buffer = rmm::device_buffer(buffer_size, stream);
-  d_prog.set_working_memory(d_buffer.data(), thread_count);
+  auto const d_buffer     = prepare_working_memory(d_prog, size, stream);
+  auto const thread_count = d_prog.thread_count();
 
   auto const shmem_size = d_prog.compute_shared_memory_size();
   cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
@@ -111,6 +136,58 @@ void launch_transform_kernel(TransformFunction fn,
     fn, d_prog, d_output, size);
 }
 
+/**
+ * @brief Evaluates each row with a full warp and stores whether any lane returned true
+ *
+ * The function is called as `fn(row_idx, prog, thread_idx, lane_idx)` by every lane of the warp
+ * and each `thread_idx` has its own working memory for the regex state.
+ */
+template <typename WarpFunction>
+CUDF_KERNEL void warp_any_kernel(WarpFunction fn,
+                                 reprog_device const d_prog,
+                                 bool* d_output,
+                                 size_type size)
+{
+  extern __shared__ u_char shmem[];
+  if (threadIdx.x == 0) { d_prog.store(shmem); }
+  __syncthreads();
+  auto const s_prog = reprog_device::load(d_prog, shmem);
+
+  auto const thread_idx = static_cast<int32_t>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const lane_idx   = thread_idx % cudf::detail::warp_size;
+  auto const stride     = s_prog.thread_count() / cudf::detail::warp_size;
+  if (thread_idx < s_prog.thread_count()) {
+    for (auto idx = thread_idx / cudf::detail::warp_size; idx < size; idx += stride) {
+      auto const result = __any_sync(0xffff'ffff, fn(idx, s_prog, thread_idx, lane_idx));
+      if (lane_idx == 0) { d_output[idx] = result; }
+    }
+  }
+}
+
+template <typename WarpFunction>
+void launch_warp_any_kernel(WarpFunction fn,
+                            reprog_device& d_prog,
+                            bool* d_output,
+                            size_type size,
+                            rmm::cuda_stream_view stream)
+{
+  auto const rows = static_cast<int32_t>(
+    std::min(static_cast<int64_t>(size) * cudf::detail::warp_size,
+             static_cast<int64_t>(std::numeric_limits<int32_t>::max() / cudf::detail::warp_size) *
+               cudf::detail::warp_size));
+  auto const d_buffer = prepare_working_memory(d_prog, rows, stream);
+  // every warp must be entirely inside the working memory;
+  // rows is a multiple of the warp size so at least one warp remains
+  auto const thread_count =
+    (d_prog.thread_count() / cudf::detail::warp_size) * cudf::detail::warp_size;
+  d_prog.set_working_memory(d_prog.working_memory(), thread_count);
+
+  auto const shmem_size = d_prog.compute_shared_memory_size();
+  cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
+  warp_any_kernel<<<grid.num_blocks, grid.num_threads_per_block, shmem_size, stream.value()>>>(
+    fn, d_prog, d_output, size);
+}
+
 template <typename SizeAndExecuteFunction>
 auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
                            reprog_device& d_prog,
@@ -121,10 +198,8 @@ auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
   auto output_sizes        = rmm::device_uvector<size_type>(strings_count, stream);
   size_and_exec_fn.d_sizes = output_sizes.data();
 
-  auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(strings_count);
-
-  auto d_buffer = rmm::device_buffer(buffer_size, stream);
-  d_prog.set_working_memory(d_buffer.data(), thread_count);
+  auto const d_buffer     = prepare_working_memory(d_prog, strings_count, stream);
+  auto const thread_count = d_prog.thread_count();
   auto const shmem_size = d_prog.compute_shared_memory_size();
   cudf::detail::grid_1d grid{thread_count, 256};
 
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "strings/literal/literal_program_impl.cuh"
 #include "strings/split/split.cuh"
 
 #include <cudf/column/column_device_view.cuh>
@@ -472,8 +473,109 @@ std::unique_ptr<column> replace_string_parallel(strings_column_view const& input
                              cudf::detail::copy_bitmask(input.parent(), stream, mr));
 }
 
+/**
+ * @brief Function logic for replace using a literal_program
+ *
+ * Each string is scanned once with the automaton. Among the targets found, the one starting
+ * at the lowest position is replaced first and ties go to the lowest target index.
+ * This matches the results of replace_multi_fn.
+ */
+struct replace_literal_program_fn {
+  column_device_view const d_strings;
+  literal_program_device const d_prog;
+  column_device_view const d_repls;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+    auto const d_str   = d_strings.element<string_view>(idx);
+    char const* in_ptr = d_str.data();
+    auto const size    = d_str.size_bytes();
+
+    size_type bytes    = size;
+    size_type pos      = 0;   // next byte to scan
+    size_type lpos     = 0;   // end of the last replaced target
+    size_type state    = 0;   // automaton state after scanning pos bytes
+    size_type best_pos = -1;  // start of the candidate target
+    size_type best_tgt = -1;  // index of the candidate target
+    char* out_ptr      = d_chars ? d_chars + d_offsets[idx] : nullptr;
+
+    while (true) {
+      // every target starting at best_pos has been found once this many bytes are scanned
+      if ((best_pos >= 0) && ((pos == size) || (pos - best_pos >= d_prog.max_target_size))) {
+        auto const tgt_size = d_prog.target_sizes[best_tgt];
+        auto const d_repl   = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
+                                                    : d_repls.element<string_view>(best_tgt);
+        bytes += d_repl.size_bytes() - tgt_size;
+        if (out_ptr) {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, best_pos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+        }
+        // restart the scan after the replaced target
+        lpos     = best_pos + tgt_size;
+        pos      = lpos;
+        state    = 0;
+        best_pos = -1;
+        continue;
+      }
+      if (pos >= size) { break; }
+      state = d_prog.next_state(state, in_ptr[pos++]);
+      for (auto const tgt : d_prog.outputs(state)) {
+        auto const tgt_pos = pos - d_prog.target_sizes[tgt];
+        if ((best_pos < 0) || (tgt_pos < best_pos) || ((tgt_pos == best_pos) && (tgt < best_tgt))) {
+          best_pos = tgt_pos;
+          best_tgt = tgt;
+        }
+      }
+    }
+    if (out_ptr)  // copy remainder
+    {
+      memcpy(out_ptr, in_ptr + lpos, size - lpos);
+    } else {
+      d_sizes[idx] = bytes;
+    }
+  }
+};
+
 }  // namespace
 
+std::unique_ptr<column> replace(strings_column_view const& input,
+                                literal_program const& prog,
+                                strings_column_view const& repls,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  if (input.is_empty()) { return make_empty_column(type_id::STRING); }
+  CUDF_EXPECTS(((repls.size() > 0) && (repls.null_count() == 0)),
+               "Parameters repls must not be empty and must not have nulls",
+               std::invalid_argument);
+  CUDF_EXPECTS((repls.size() == 1) || (repls.size() == prog.targets_count()),
+               "Sizes for targets and repls must match",
+               std::invalid_argument);
+
+  auto d_strings      = column_device_view::create(input.parent(), stream);
+  auto d_replacements = column_device_view::create(repls.parent(), stream);
+  auto const d_prog   = literal_device_builder::create_prog_device(prog);
+
+  auto [offsets_column, chars] =
+    make_strings_children(replace_literal_program_fn{*d_strings, d_prog, *d_replacements},
+                          input.size(),
+                          stream,
+                          mr);
+
+  return make_strings_column(input.size(),
+                             std::move(offsets_column),
+                             chars.release(),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr));
+}
+
 std::unique_ptr<column> replace(strings_column_view const& input,
                                 strings_column_view const& targets,
                                 strings_column_view const& repls,
@@ -509,5 +611,15 @@ std::unique_ptr<column> replace(strings_column_view const& strings,
   return detail::replace(strings, targets, repls, stream, mr);
 }
 
+std::unique_ptr<column> replace(strings_column_view const& input,
+                                literal_program const& prog,
+                                strings_column_view const& repls,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace(input, prog, repls, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -14,8 +14,11 @@
  * limitations under the License.
  */
 
+#include "strings/literal/literal_program_impl.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -84,6 +87,42 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
                            mr);
 }
 
+
+std::unique_ptr<column> contains_any(strings_column_view const& input,
+                                     literal_program const& prog,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  auto results = make_numeric_column(data_type{type_id::BOOL8},
+                                     input.size(),
+                                     cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                     input.null_count(),
+                                     stream,
+                                     mr);
+  if (input.is_empty()) { return results; }
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const d_prog    = literal_device_builder::create_prog_device(prog);
+
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    results->mutable_view().data<bool>(),
+                    [d_strings = *d_strings, d_prog] __device__(size_type idx) {
+                      if (d_strings.is_null(idx)) { return false; }
+                      auto const d_str = d_strings.element<string_view>(idx);
+                      size_type state  = 0;
+                      for (auto itr = d_str.data(); itr < d_str.data() + d_str.size_bytes();
+                           ++itr) {
+                        state = d_prog.next_state(state, *itr);
+                        if (d_prog.has_outputs(state)) { return true; }
+                      }
+                      return false;
+                    });
+  results->set_null_count(input.null_count());
+  return results;
+}
+
 }  // namespace detail
 
 // external API
@@ -96,5 +135,14 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
   return detail::find_multiple(input, targets, stream, mr);
 }
 
+std::unique_ptr<column> contains_any(strings_column_view const& input,
+                                     literal_program const& prog,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_any(input, prog, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
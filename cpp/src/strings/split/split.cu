@@ -152,6 +152,74 @@ std::unique_ptr<table> split_fn(strings_column_view const& input,
   return std::make_unique<table>(std::move(results));
 }
 
+/**
+ * @brief Split function called by split() and rsplit() when `maxsplit > 0`
+ *
+ * Each string has at most `maxsplit + 1` tokens so each string is scanned
+ * for its own delimiters instead of recording the position of every delimiter
+ * in the column as split_fn() does. The delimiters beyond `maxsplit` in each
+ * string are never visited.
+ *
+ * The tokens are written directly into a column-major vector sized by the
+ * maximum number of tokens so no token offsets are needed. Each output column
+ * is then built from its slice of this vector.
+ *
+ * @tparam Tokenizer provides unique functions for split/rsplit.
+ * @param input The strings to split
+ * @param tokenizer Tokenizer for counting and producing tokens
+ * @return table of columns for the output of the split
+ */
+template <typename Tokenizer>
+std::unique_ptr<table> split_with_max_fn(strings_column_view const& input,
+                                         Tokenizer tokenizer,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  std::vector<std::unique_ptr<column>> results;
+  if (input.size() == input.null_count()) {
+    results.push_back(std::make_unique<column>(input.parent(), stream, mr));
+    return std::make_unique<table>(std::move(results));
+  }
+
+  auto const strings_count = input.size();
+
+  // compute the number of tokens per string
+  auto token_counts   = rmm::device_uvector<size_type>(strings_count, stream);
+  auto d_token_counts = token_counts.data();
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_token_counts,
+                    cuda::proclaim_return_type<size_type>([tokenizer] __device__(size_type idx) {
+                      return tokenizer.count_tokens(idx);
+                    }));
+
+  // column count is the maximum number of tokens for any string
+  auto const columns_count = thrust::reduce(
+    rmm::exec_policy(stream), token_counts.begin(), token_counts.end(), 0, thrust::maximum{});
+
+  // tokens for column `col` start at `d_tokens + col * strings_count`
+  auto tokens = rmm::device_uvector<string_index_pair>(
+    static_cast<int64_t>(columns_count) * static_cast<int64_t>(strings_count), stream);
+  auto d_tokens = tokens.data();
+  thrust::fill(
+    rmm::exec_policy_nosync(stream), tokens.begin(), tokens.end(), string_index_pair{nullptr, 0});
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [tokenizer, d_token_counts, d_tokens, strings_count] __device__(size_type idx) {
+      tokenizer.scan_tokens(idx, d_token_counts[idx], d_tokens + idx, strings_count);
+    });
+
+  for (size_type col = 0; col < columns_count; ++col) {
+    auto column_tokens = d_tokens + (static_cast<int64_t>(col) * strings_count);
+    results.emplace_back(
+      make_strings_column(column_tokens, column_tokens + strings_count, stream, mr));
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 /**
  * @brief Base class for whitespace tokenizers.
  *
@@ -443,8 +511,9 @@ std::unique_ptr<table> split(strings_column_view const& strings_column,
   }
 
   string_view d_delimiter(delimiter.data(), delimiter.size());
-  return split_fn(
-    strings_column, split_tokenizer_fn{*strings_device_view, d_delimiter, max_tokens}, stream, mr);
+  auto tokenizer = split_tokenizer_fn{*strings_device_view, d_delimiter, max_tokens};
+  return maxsplit > 0 ? split_with_max_fn(strings_column, tokenizer, stream, mr)
+                      : split_fn(strings_column, tokenizer, stream, mr);
 }
 
 std::unique_ptr<table> rsplit(strings_column_view const& strings_column,
@@ -466,8 +535,9 @@ std::unique_ptr<table> rsplit(strings_column_view const& strings_column,
   }
 
   string_view d_delimiter(delimiter.data(), delimiter.size());
-  return split_fn(
-    strings_column, rsplit_tokenizer_fn{*strings_device_view, d_delimiter, max_tokens}, stream, mr);
+  auto tokenizer = rsplit_tokenizer_fn{*strings_device_view, d_delimiter, max_tokens};
+  return maxsplit > 0 ? split_with_max_fn(strings_column, tokenizer, stream, mr)
+                      : split_fn(strings_column, tokenizer, stream, mr);
 }
 
 }  // namespace detail
@@ -114,6 +114,37 @@ struct base_split_tokenizer {
     return ((max_tokens > 0) && (token_count > max_tokens)) ? max_tokens : token_count;
   }
 
+  /**
+   * @brief This counts the tokens of a string by scanning it for delimiters
+   *
+   * Scanning stops once `max_tokens` is reached so this is only efficient
+   * when `max_tokens` is small relative to the number of delimiters.
+   * Overlapping delimiters are ignored the same as in the function above.
+   *
+   * @param idx Index of input string
+   * @return Number of tokens in the string or 0 if it is null
+   */
+  __device__ size_type count_tokens(size_type idx) const
+  {
+    if (!is_valid(idx)) { return 0; }
+
+    auto const delim_size = d_delimiter.size_bytes();
+    auto const d_str      = get_string(idx);
+    auto ptr              = d_str.data();
+    auto const last_ptr   = ptr + d_str.size_bytes() - delim_size;  // last delimiter position
+
+    size_type token_count = 1;
+    while ((token_count < max_tokens) && (ptr <= last_ptr)) {
+      if (d_delimiter.compare(ptr, delim_size) == 0) {
+        ++token_count;
+        ptr += delim_size;
+      } else {
+        ++ptr;
+      }
+    }
+    return token_count;
+  }
+
   /**
    * @brief This will create tokens around each delimiter honoring the string boundaries
    * in which the delimiter resides
@@ -215,6 +246,46 @@ struct split_tokenizer_fn : base_split_tokenizer<split_tokenizer_fn> {
     }
   }
 
+  /**
+   * @brief This will create the tokens of a string by scanning it for delimiters
+   *
+   * This is the counterpart of `count_tokens(idx)` and does not require the
+   * delimiter positions of the entire column.
+   *
+   * @param idx Index of the string to tokenize
+   * @param token_count Number of tokens returned by `count_tokens(idx)`
+   * @param d_tokens Output for this string's tokens where token `t` is stored
+   *        at `d_tokens[t * stride]`
+   * @param stride Distance between consecutive tokens in `d_tokens`
+   */
+  __device__ void scan_tokens(size_type idx,
+                              size_type token_count,
+                              string_index_pair* d_tokens,
+                              int64_t stride) const
+  {
+    if (token_count == 0) { return; }
+
+    auto const delim_size = d_delimiter.size_bytes();
+    auto const d_str      = get_string(idx);
+    auto str_ptr          = d_str.data();
+    auto const str_end    = str_ptr + d_str.size_bytes();
+
+    size_type token_idx = 0;
+    for (auto ptr = str_ptr; token_idx + 1 < token_count;) {
+      if (d_delimiter.compare(ptr, delim_size) != 0) {
+        ++ptr;
+        continue;
+      }
+      d_tokens[token_idx++ * stride] =
+        string_index_pair{str_ptr, static_cast<size_type>(thrust::distance(str_ptr, ptr))};
+      ptr += delim_size;
+      str_ptr = ptr;
+    }
+    // the last token is the remainder of the string
+    d_tokens[token_idx * stride] =
+      string_index_pair{str_ptr, static_cast<size_type>(thrust::distance(str_ptr, str_end))};
+  }
+
   split_tokenizer_fn(column_device_view const& d_strings,
                      string_view const& d_delimiter,
                      size_type max_tokens)
@@ -272,6 +343,48 @@ struct rsplit_tokenizer_fn : base_split_tokenizer<rsplit_tokenizer_fn> {
     }
   }
 
+  /**
+   * @brief This will create the tokens of a string by scanning it for delimiters
+   * from the end of the string
+   *
+   * The number of tokens found from either end of a string is the same
+   * so `token_count` is the value returned by `count_tokens(idx)`.
+   *
+   * @param idx Index of the string to tokenize
+   * @param token_count Number of tokens returned by `count_tokens(idx)`
+   * @param d_tokens Output for this string's tokens where token `t` is stored
+   *        at `d_tokens[t * stride]`
+   * @param stride Distance between consecutive tokens in `d_tokens`
+   */
+  __device__ void scan_tokens(size_type idx,
+                              size_type token_count,
+                              string_index_pair* d_tokens,
+                              int64_t stride) const
+  {
+    if (token_count == 0) { return; }
+
+    auto const delim_size = d_delimiter.size_bytes();
+    auto const d_str      = get_string(idx);
+    auto const str_begin  = d_str.data();
+    auto str_end          = str_begin + d_str.size_bytes();
+
+    auto token_idx = token_count - 1;
+    for (auto ptr = str_end - delim_size; token_idx > 0;) {  // read right-to-left
+      if (d_delimiter.compare(ptr, delim_size) != 0) {
+        --ptr;
+        continue;
+      }
+      auto const start_ptr = ptr + delim_size;
+      d_tokens[token_idx-- * stride] =
+        string_index_pair{start_ptr, static_cast<size_type>(thrust::distance(start_ptr, str_end))};
+      str_end = ptr;
+      ptr -= delim_size;
+    }
+    // the first token is the remainder of the string
+    d_tokens[0] =
+      string_index_pair{str_begin, static_cast<size_type>(thrust::distance(str_begin, str_end))};
+  }
+
   rsplit_tokenizer_fn(column_device_view const& d_strings,
                       string_view const& d_delimiter,
                       size_type max_tokens)
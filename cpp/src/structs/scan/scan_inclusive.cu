@@ -20,6 +20,7 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -28,18 +29,17 @@
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 
 #include <vector>
 
 namespace cudf {
 namespace structs {
 namespace detail {
-namespace {
-
-}  // namespace
 
 template <typename Op>
 std::unique_ptr<column> scan_inclusive(column_view const& input,
+                                       bitmask_type const* mask,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
 {
@@ -53,6 +53,19 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
                          gather_map.begin(),
                          binop_generator.binop());
 
+  // Null rows of the output gather an out-of-bounds index so the gather nullifies the
+  // children there and the parent nulls need not be pushed down into them afterwards.
+  if (mask != nullptr) {
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(input.size()),
+                      gather_map.begin(),
+                      gather_map.begin(),
+                      [mask, oob_index = input.size()] __device__(size_type idx, size_type map) {
+                        return bit_is_set(mask, idx) ? map : oob_index;
+                      });
+  }
+
   // Gather the children columns of the input column. Must use `get_sliced_child` to properly
   // handle input in case it is a sliced view.
   auto const input_children = [&] {
@@ -66,7 +79,9 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
   // Gather the children elements of the prefix min/max struct elements for the output.
   auto scanned_children = cudf::detail::gather(table_view{input_children},
                                                gather_map,
-                                               cudf::out_of_bounds_policy::DONT_CHECK,
+                                               mask != nullptr
+                                                 ? cudf::out_of_bounds_policy::NULLIFY
+                                                 : cudf::out_of_bounds_policy::DONT_CHECK,
                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
                                                stream,
                                                mr)
@@ -78,10 +93,12 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
 }
 
 template std::unique_ptr<column> scan_inclusive<DeviceMin>(column_view const& input_view,
+                                                           bitmask_type const* mask,
                                                            rmm::cuda_stream_view stream,
                                                            rmm::device_async_resource_ref mr);
 
 template std::unique_ptr<column> scan_inclusive<DeviceMax>(column_view const& input_view,
+                                                           bitmask_type const* mask,
                                                            rmm::cuda_stream_view stream,
                                                            rmm::device_async_resource_ref mr);
 
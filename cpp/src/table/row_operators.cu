@@ -631,6 +631,38 @@ transform_lists_of_structs(column_view const& lhs,
   return {lhs, rhs, std::move(out_cols_lhs), std::move(out_cols_rhs)};
 }
 
+/**
+ * @brief Flattens the struct columns of a table for lexicographic comparison
+ *
+ * Comparing a struct column walks down its levels for every pair of compared elements. Each
+ * flattened struct column is replaced by its validity, as a `BOOL8` column, followed by its
+ * children with the nulls of the struct pushed down to them. These columns compare like the
+ * struct column, one after the other, with its order and null precedence.
+ *
+ * A validity column is generated for every struct level, even without nulls, so that tables of
+ * the same schema preprocessed separately have the same columns.
+ *
+ * @param input The table whose struct columns to flatten
+ * @param column_order The order of each column of `input`
+ * @param null_precedence The null precedence of each column of `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The flattened table with the order and null precedence of its columns
+ */
+std::unique_ptr<structs::detail::flattened_table> flatten_struct_columns(
+  table_view const& input,
+  host_span<order const> column_order,
+  host_span<null_order const> null_precedence,
+  rmm::cuda_stream_view stream)
+{
+  return structs::detail::flatten_nested_columns(
+    input,
+    std::vector<order>(column_order.begin(), column_order.end()),
+    std::vector<null_order>(null_precedence.begin(), null_precedence.end()),
+    structs::detail::column_nullability::FORCE,
+    stream,
+    rmm::mr::get_current_device_resource());
+}
+
 }  // namespace
 
 std::shared_ptr<preprocessed_table> preprocessed_table::create(
@@ -680,8 +712,15 @@ std::shared_ptr<preprocessed_table> preprocessed_table::create(
   host_span<null_order const> null_precedence,
   rmm::cuda_stream_view stream)
 {
+  auto flattened_input = flatten_struct_columns(input, column_order, null_precedence, stream);
+
+  auto const flattened_order = flattened_input->orders();
+  auto const flattened_nulls = flattened_input->null_orders();
   auto [decomposed_input, new_column_order, new_null_precedence, verticalized_col_depths] =
-    decompose_structs(input, decompose_lists_column::NO, column_order, null_precedence);
+    decompose_structs(flattened_input->flattened_columns(),
+                      decompose_lists_column::NO,
+                      flattened_order,
+                      flattened_nulls);
 
   // Transform any (nested) lists-of-structs column into lists-of-integers column.
   std::vector<std::unique_ptr<column>> transformed_columns;
@@ -708,13 +747,16 @@ std::shared_ptr<preprocessed_table> preprocessed_table::create(
     }();
 
   auto const has_ranked_children = !transformed_columns.empty();
-  return create(transformed_input,
-                std::move(verticalized_col_depths),
-                std::move(transformed_columns),
-                new_column_order,
-                new_null_precedence,
-                has_ranked_children,
-                stream);
+
+  auto preprocessed = create(transformed_input,
+                             std::move(verticalized_col_depths),
+                             std::move(transformed_columns),
+                             new_column_order,
+                             new_null_precedence,
+                             has_ranked_children,
+                             stream);
+  preprocessed->_flattened_input = std::move(flattened_input);
+  return preprocessed;
 }
 
 std::pair<std::shared_ptr<preprocessed_table>, std::shared_ptr<preprocessed_table>>
@@ -726,16 +768,26 @@ preprocessed_table::create(table_view const& lhs,
 {
   check_shape_compatibility(lhs, rhs);
 
+  auto flattened_lhs         = flatten_struct_columns(lhs, column_order, null_precedence, stream);
+  auto flattened_rhs         = flatten_struct_columns(rhs, column_order, null_precedence, stream);
+  auto const flattened_order = flattened_lhs->orders();
+  auto const flattened_nulls = flattened_lhs->null_orders();
+
   auto [decomposed_lhs,
         new_column_order_lhs,
         new_null_precedence_lhs,
-        verticalized_col_depths_lhs] =
-    decompose_structs(lhs, decompose_lists_column::NO, column_order, null_precedence);
+        verticalized_col_depths_lhs] = decompose_structs(flattened_lhs->flattened_columns(),
+                                                         decompose_lists_column::NO,
+                                                         flattened_order,
+                                                         flattened_nulls);
 
   // Unused variables are new column order and null order for rhs, which are the same as for lhs
   // so we don't need them.
   [[maybe_unused]] auto [decomposed_rhs, unused0, unused1, verticalized_col_depths_rhs] =
-    decompose_structs(rhs, decompose_lists_column::NO, column_order, null_precedence);
+    decompose_structs(flattened_rhs->flattened_columns(),
+                      decompose_lists_column::NO,
+                      flattened_order,
+                      flattened_nulls);
 
   // Transform any (nested) lists-of-structs column into lists-of-integers column.
   std::vector<std::unique_ptr<column>> transformed_columns_lhs;
@@ -756,7 +808,7 @@ preprocessed_table::create(table_view const& lhs,
         transform_lists_of_structs(
           lhs_col,
           rhs_col,
-          null_precedence.empty() ? null_order::BEFORE : null_precedence[col_idx],
+          null_precedence.empty() ? null_order::BEFORE : new_null_precedence_lhs[col_idx],
           stream,
           rmm::mr::get_current_device_resource());
 
@@ -778,20 +830,23 @@ preprocessed_table::create(table_view const& lhs,
   auto const has_ranked_children_lhs = !transformed_columns_lhs.empty();
   auto const has_ranked_children_rhs = !transformed_columns_rhs.empty();
 
-  return {create(transformed_lhs,
-                 std::move(verticalized_col_depths_lhs),
-                 std::move(transformed_columns_lhs),
-                 new_column_order_lhs,
-                 new_null_precedence_lhs,
-                 has_ranked_children_lhs,
-                 stream),
-          create(transformed_rhs,
-                 std::move(verticalized_col_depths_rhs),
-                 std::move(transformed_columns_rhs),
-                 new_column_order_lhs,
-                 new_null_precedence_lhs,
-                 has_ranked_children_rhs,
-                 stream)};
+  auto preprocessed_lhs = create(transformed_lhs,
+                                 std::move(verticalized_col_depths_lhs),
+                                 std::move(transformed_columns_lhs),
+                                 new_column_order_lhs,
+                                 new_null_precedence_lhs,
+                                 has_ranked_children_lhs,
+                                 stream);
+  auto preprocessed_rhs = create(transformed_rhs,
+                                 std::move(verticalized_col_depths_rhs),
+                                 std::move(transformed_columns_rhs),
+                                 new_column_order_lhs,
+                                 new_null_precedence_lhs,
+                                 has_ranked_children_rhs,
+                                 stream);
+  preprocessed_lhs->_flattened_input = std::move(flattened_lhs);
+  preprocessed_rhs->_flattened_input = std::move(flattened_rhs);
+  return {std::move(preprocessed_lhs), std::move(preprocessed_rhs)};
 }
 
 preprocessed_table::preprocessed_table(
@@ -36,9 +36,12 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuco/static_set.cuh>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
@@ -75,6 +78,10 @@ constexpr int block_size = 512;
  * never be paired. Fortunately, this can be used as an artificial
  * boundary providing increased parallelism in the BPE kernel.
  *
+ * When no merge pair contains a space, a space can never be merged with its
+ * neighbors so the input is also split before and after every space.
+ * This encodes each word independently.
+ *
  * @tparam MapRefType The type of the map finder object
  */
 template <typename MapRefType>
@@ -82,6 +89,7 @@ struct bpe_unpairable_offsets_fn {
   cudf::device_span<char const> d_chars;
   int64_t offset;
   MapRefType const d_map;
+  bool split_on_spaces;
   __device__ int64_t operator()(int64_t idx)
   {
     if (!cudf::strings::detail::is_begin_utf8_char(d_chars[idx])) { return 0; }
@@ -93,8 +101,11 @@ struct bpe_unpairable_offsets_fn {
     auto output     = 0L;
     if (next < end) {
       auto const rhs = cudf::string_view(next, cudf::strings::detail::bytes_in_utf8_byte(*next));
+      // a space on either side is a word boundary
+      auto const is_word_boundary = split_on_spaces && (*itr == ' ' || *next == ' ');
       // see if both halves exist anywhere in the table, if not these are unpairable
-      if (d_map.find(lhs) == d_map.end() && d_map.find(rhs) == d_map.end()) {
+      if (is_word_boundary ||
+          (d_map.find(lhs) == d_map.end() && d_map.find(rhs) == d_map.end())) {
         output = idx + lhs.size_bytes() + offset;  // offset for artificial boundary
       }
     }
@@ -102,6 +113,72 @@ struct bpe_unpairable_offsets_fn {
   }
 };
 
+/**
+ * @brief Hasher function used for finding identical words
+ *
+ * Each key is a row index of the temporary strings column of words.
+ */
+struct word_hasher {
+  cudf::column_device_view const d_strings;
+  string_hasher_type hasher{};
+  __device__ hash_value_type operator()(cudf::size_type index) const
+  {
+    return hasher(d_strings.element<cudf::string_view>(index));
+  }
+};
+
+/**
+ * @brief Equal function used for finding identical words
+ */
+struct word_equal {
+  cudf::column_device_view const d_strings;
+  __device__ bool operator()(cudf::size_type lhs, cudf::size_type rhs) const noexcept
+  {
+    return d_strings.element<cudf::string_view>(lhs) == d_strings.element<cudf::string_view>(rhs);
+  }
+};
+
+using word_probe_scheme = cuco::linear_probing<1, word_hasher>;
+
+/**
+ * @brief Returns the first row inserted into the set with the same word as each row
+ *
+ * @tparam SetRefType The type of the set insert-and-find object
+ */
+template <typename SetRefType>
+struct find_first_word_fn {
+  SetRefType set;
+  __device__ cudf::size_type operator()(cudf::size_type idx)
+  {
+    return *set.insert_and_find(idx).first;
+  }
+};
+
+/**
+ * @brief Copies the encoding of each repeated word from the first copy of that word
+ *
+ * Launched as a thread per byte of the chars array.
+ * Only the first copy of each word is encoded by the BPE kernel.
+ */
+struct copy_word_encoding_fn {
+  int64_t const* d_offsets;              // offsets of the words in the input chars
+  cudf::size_type num_words;             //
+  cudf::size_type const* d_first_words;  // first copy of each word
+  int64_t first_offset;                  // offset of d_spaces in the input chars
+  int8_t* d_spaces;                      // encoding to copy
+  __device__ void operator()(int64_t idx) const
+  {
+    auto const position = idx + first_offset;
+    auto const itr =
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_words + 1, position);
+    auto const word  = static_cast<cudf::size_type>(thrust::distance(d_offsets, itr) - 1);
+    auto const first = d_first_words[word];
+    if (first == word) { return; }
+    auto const source = d_offsets[first] - first_offset + (position - d_offsets[word]);
+    d_spaces[idx]     = d_spaces[source];
+  }
+};
+
 /**
  * @brief Performs byte-pair-encoding
  *
@@ -120,6 +197,7 @@ struct bpe_unpairable_offsets_fn {
  *
  * @tparam MapRefType The type of the map finder object
  * @param d_strings Input data
+ * @param d_rows Rows of `d_strings` to encode, one per block
  * @param d_map For looking up individual string candidates
  * @param d_spaces_data Output the location where separator will be inserted
  * @param d_ranks_data Working memory to hold pair ranks
@@ -127,6 +205,7 @@ struct bpe_unpairable_offsets_fn {
  */
 template <typename MapRefType>
 CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
+                                 cudf::size_type const* d_rows,
                                  char const* d_input_chars,
                                  MapRefType const d_map,
                                  int8_t* d_spaces_data,          // working memory
@@ -135,8 +214,7 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
 )
 {
   // string per block
-  auto const str_idx =
-    static_cast<cudf::size_type>(cudf::detail::grid_1d::global_thread_id() / block_size);
+  auto const str_idx  = d_rows[blockIdx.x];
   auto const lane_idx = static_cast<cudf::size_type>(threadIdx.x);
 
   auto const d_str  = d_strings.element<cudf::string_view>(str_idx);
@@ -376,8 +454,10 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
     // boundaries; the boundary values are recorded as offsets in d_up_offsets
     auto const d_up_offsets = d_working.data();  // store unpairable offsets here
     auto const mp_map = get_bpe_merge_pairs_impl(merge_pairs)->get_mp_table_ref();  // lookup table
-    auto const d_chars_span = cudf::device_span<char const>(d_input_chars, chars_size);
-    auto up_fn = bpe_unpairable_offsets_fn<decltype(mp_map)>{d_chars_span, first_offset, mp_map};
+    auto const split_on_spaces = !get_bpe_merge_pairs_impl(merge_pairs)->has_space;
+    auto const d_chars_span    = cudf::device_span<char const>(d_input_chars, chars_size);
+    auto up_fn                 = bpe_unpairable_offsets_fn<decltype(mp_map)>{
+      d_chars_span, first_offset, mp_map, split_on_spaces};
     thrust::transform(rmm::exec_policy_nosync(stream), chars_begin, chars_end, d_up_offsets, up_fn);
     auto const up_end =  // remove all but the unpairable offsets
       thrust::remove(rmm::exec_policy_nosync(stream), d_up_offsets, d_up_offsets + chars_size, 0L);
@@ -407,12 +487,61 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
       input.parent().type(), tmp_size, input.chars_begin(stream), nullptr, 0, 0, {col_offsets});
     auto const d_tmp_strings = cudf::column_device_view::create(tmp_input, stream);
 
-    // launch the byte-pair-encoding kernel on the temp column
+    // identical words encode identically so only the first copy of each word is encoded
+    auto d_first_words = rmm::device_uvector<cudf::size_type>(tmp_size, stream);
+    auto words_set     = cuco::static_set{tmp_size,
+                                      0.5,  // desired load factor
+                                      cuco::empty_key{cudf::detail::CUDF_SIZE_TYPE_SENTINEL},
+                                      word_equal{*d_tmp_strings},
+                                      word_probe_scheme{word_hasher{*d_tmp_strings}},
+                                      cuco::thread_scope_device,
+                                      cuco_storage{},
+                                      cudf::detail::cuco_allocator{stream},
+                                      stream.value()};
+    auto const words_begin = thrust::counting_iterator<cudf::size_type>(0);
+    auto const words_end   = thrust::counting_iterator<cudf::size_type>(tmp_size);
+    auto const set_ref     = words_set.ref(cuco::insert_and_find);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      words_begin,
+                      words_end,
+                      d_first_words.begin(),
+                      find_first_word_fn<decltype(set_ref)>{set_ref});
+    auto d_unique_words   = rmm::device_uvector<cudf::size_type>(tmp_size, stream);
+    auto const unique_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      words_begin,
+      words_end,
+      d_unique_words.begin(),
+      [d_first_words = d_first_words.data()] __device__(cudf::size_type idx) {
+        return d_first_words[idx] == idx;
+      });
+    auto const num_unique =
+      static_cast<cudf::size_type>(thrust::distance(d_unique_words.begin(), unique_end));
+
+    // launch the byte-pair-encoding kernel on the unique words of the temp column
     rmm::device_uvector<int8_t> d_rerank(chars_size, stream);  // more working memory;
     rmm::device_uvector<cudf::size_type> d_ranks(chars_size, stream);
     auto const pair_map = get_bpe_merge_pairs_impl(merge_pairs)->get_merge_pairs_ref();
-    bpe_parallel_fn<decltype(pair_map)><<<tmp_size, block_size, 0, stream.value()>>>(
-      *d_tmp_strings, d_input_chars, pair_map, d_spaces.data(), d_ranks.data(), d_rerank.data());
+    bpe_parallel_fn<decltype(pair_map)>
+      <<<num_unique, block_size, 0, stream.value()>>>(*d_tmp_strings,
+                                                      d_unique_words.data(),
+                                                      d_input_chars,
+                                                      pair_map,
+                                                      d_spaces.data(),
+                                                      d_ranks.data(),
+                                                      d_rerank.data());
+
+    // the repeated words copy the encoding of their first copy
+    if (num_unique < tmp_size) {
+      thrust::for_each(rmm::exec_policy_nosync(stream),
+                       chars_begin,
+                       chars_end,
+                       copy_word_encoding_fn{tmp_offsets.data(),
+                                             tmp_size,
+                                             d_first_words.data(),
+                                             first_offset,
+                                             d_spaces.data()});
+    }
   }
 
   // compute the output sizes
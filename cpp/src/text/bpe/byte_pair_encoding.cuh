@@ -180,11 +180,13 @@ struct bpe_merge_pairs::bpe_merge_pairs_impl {
   col_device_view const d_merge_pairs;
   std::unique_ptr<detail::merge_pairs_map_type> merge_pairs_map;  // for BPE
   std::unique_ptr<detail::mp_table_map_type> mp_table_map;        // for locating unpairables
+  bool const has_space;  // true if any merge pair component contains a space character
 
   bpe_merge_pairs_impl(std::unique_ptr<cudf::column>&& merge_pairs,
                        col_device_view&& d_merge_pairs,
                        std::unique_ptr<detail::merge_pairs_map_type>&& merge_pairs_map,
-                       std::unique_ptr<detail::mp_table_map_type>&& mp_table_map);
+                       std::unique_ptr<detail::mp_table_map_type>&& mp_table_map,
+                       bool has_space);
 
   auto const get_merge_pairs() const { return *d_merge_pairs; }
   auto get_merge_pairs_ref() const { return merge_pairs_map->ref(cuco::op::find); }
@@ -28,9 +28,11 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/find.h>
 
 #include <fstream>
 #include <iostream>
@@ -93,8 +95,18 @@ std::unique_ptr<bpe_merge_pairs::bpe_merge_pairs_impl> create_bpe_merge_pairs_im
   auto d_input      = cudf::column_device_view::create(input->view(), stream);
   auto merge_pairs  = initialize_merge_pairs_map(*d_input, stream);
   auto mp_table_map = initialize_mp_table_map(*d_input, stream);
-  return std::make_unique<nvtext::bpe_merge_pairs::bpe_merge_pairs_impl>(
-    std::move(input), std::move(d_input), std::move(merge_pairs), std::move(mp_table_map));
+
+  // without a space in any pair, spaces in the input can never be merged
+  auto const sv        = cudf::strings_column_view(input->view());
+  auto const chars     = sv.chars_begin(stream);
+  auto const chars_end = chars + sv.chars_size(stream);
+  auto const has_space = thrust::find(rmm::exec_policy(stream), chars, chars_end, ' ') != chars_end;
+
+  return std::make_unique<nvtext::bpe_merge_pairs::bpe_merge_pairs_impl>(std::move(input),
+                                                                         std::move(d_input),
+                                                                         std::move(merge_pairs),
+                                                                         std::move(mp_table_map),
+                                                                         has_space);
 }
 
 std::unique_ptr<bpe_merge_pairs::bpe_merge_pairs_impl> create_bpe_merge_pairs_impl(
@@ -133,11 +145,13 @@ bpe_merge_pairs::bpe_merge_pairs_impl::bpe_merge_pairs_impl(
   std::unique_ptr<cudf::column_device_view, std::function<void(cudf::column_device_view*)>>&&
     d_merge_pairs,
   std::unique_ptr<detail::merge_pairs_map_type>&& merge_pairs_map,
-  std::unique_ptr<detail::mp_table_map_type>&& mp_table_map)
+  std::unique_ptr<detail::mp_table_map_type>&& mp_table_map,
+  bool has_space)
   : merge_pairs(std::move(merge_pairs)),
     d_merge_pairs(std::move(d_merge_pairs)),
     merge_pairs_map(std::move(merge_pairs_map)),
-    mp_table_map(std::move(mp_table_map))
+    mp_table_map(std::move(mp_table_map)),
+    has_space(has_space)
 {
 }
 
@@ -30,6 +30,7 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
@@ -44,12 +45,80 @@ namespace nvtext {
 namespace detail {
 namespace {
 
+/// Longest shorter string (in characters) whose distance is computed with `bit_parallel_distance`
+constexpr cudf::size_type bit_parallel_max_length = 64;
+
+/**
+ * @brief Compute the Levenshtein distance with Myers' bit-parallel algorithm
+ *
+ * Each bit of the 64-bit vectors holds the vertical delta of one character of `d_pattern`
+ * in the current column of the distance matrix, so a column is computed with a few bitwise
+ * operations and no working memory.
+ *
+ * Documentation here: https://doi.org/10.1145/316542.316550
+ * And here (edit distance variant): https://doi.org/10.1007/3-540-45452-7_6
+ *
+ * @param d_pattern The shorter string, with 1 to `bit_parallel_max_length` characters
+ * @param pattern_length Number of characters in `d_pattern`
+ * @param d_text The longer string
+ * @return The edit distance value
+ */
+__device__ cudf::size_type bit_parallel_distance(cudf::string_view const& d_pattern,
+                                                 cudf::size_type pattern_length,
+                                                 cudf::string_view const& d_text)
+{
+  cudf::char_utf8 pattern[bit_parallel_max_length];
+  thrust::copy(thrust::seq, d_pattern.begin(), d_pattern.end(), pattern);
+
+  auto const last = uint64_t{1} << (pattern_length - 1);
+  uint64_t pv     = ~uint64_t{0};  // positive vertical deltas
+  uint64_t mv     = 0;             // negative vertical deltas
+  auto distance   = pattern_length;
+  for (auto const chr : d_text) {
+    uint64_t eq = 0;  // bits of the pattern characters matching chr
+    for (cudf::size_type j = 0; j < pattern_length; ++j) {
+      eq |= static_cast<uint64_t>(pattern[j] == chr) << j;
+    }
+    auto const xv = eq | mv;
+    auto const xh = (((eq & pv) + pv) ^ pv) | eq;
+    auto ph       = mv | ~(xh | pv);  // positive horizontal deltas
+    auto mh       = pv & xh;          // negative horizontal deltas
+    if (ph & last) {
+      ++distance;
+    } else if (mh & last) {
+      --distance;
+    }
+    ph = (ph << 1) | 1;  // the first row of the matrix increases by 1 in each column
+    mh <<= 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+  }
+  return distance;
+}
+
+/**
+ * @brief Returns the number of working buffer integers needed to compute the distance
+ * between two strings
+ *
+ * None are needed when the shorter string is computed with `bit_parallel_distance`.
+ */
+__device__ cudf::size_type compute_buffer_size(cudf::string_view const& d_str,
+                                               cudf::string_view const& d_tgt)
+{
+  auto const length = std::min(d_str.length(), d_tgt.length());
+  // just need 2 integers for each character of the shorter string
+  return length <= bit_parallel_max_length ? 0 : (length + 1) * 2;
+}
+
 /**
  * @brief Compute the Levenshtein distance for each string pair
  *
  * Documentation here: https://www.cuelogic.com/blog/the-levenshtein-algorithm
  * And here: https://en.wikipedia.org/wiki/Levenshtein_distance
  *
+ * Pairs where the shorter string has at most `bit_parallel_max_length` characters are
+ * computed by `bit_parallel_distance` instead, without using `buffer`.
+ *
  * @param d_str First string
  * @param d_tgt Second string
  * @param buffer Working buffer for intermediate calculations
@@ -68,6 +137,10 @@ __device__ cudf::size_type compute_distance(cudf::string_view const& d_str,
   auto itr   = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
   // .first is min and .second is max
   auto const [n, m] = std::minmax(str_length, tgt_length);
+  if (n <= bit_parallel_max_length) {
+    return str_length < tgt_length ? bit_parallel_distance(d_str, n, d_tgt)
+                                   : bit_parallel_distance(d_tgt, n, d_str);
+  }
   // setup compute buffer pointers
   auto v0 = buffer;
   auto v1 = v0 + n + 1;
@@ -169,8 +242,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                       auto d_tgt = d_targets.size() == 1
                                      ? d_targets.element<cudf::string_view>(0)
                                      : d_targets.element<cudf::string_view>(idx);
-                      // just need 2 integers for each character of the shorter string
-                      return (std::min(d_str.length(), d_tgt.length()) + 1) * 2;
+                      return compute_buffer_size(d_str, d_tgt);
                     });
 
   // get the total size of the temporary compute buffer
@@ -239,9 +311,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
       cudf::string_view const d_str2 =
         d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
       if (d_str1.empty() || d_str2.empty()) { return; }
-      // the temp size needed is 2 integers per character of the shorter string
-      d_offsets[idx - ((row + 1) * (row + 2)) / 2] =
-        (std::min(d_str1.length(), d_str2.length()) + 1) * 2;
+      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = compute_buffer_size(d_str1, d_str2);
     });
 
   // get the total size for the compute buffer
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -52,7 +53,8 @@ namespace {
 __device__ auto get_row(cudf::column_device_view const& d_input, cudf::size_type idx)
 {
   auto const offsets =
-    d_input.child(cudf::lists_column_view::offsets_column_index).data<cudf::size_type>();
+    d_input.child(cudf::lists_column_view::offsets_column_index).data<cudf::size_type>() +
+    d_input.offset();
   auto const offset = offsets[idx];
   auto const size   = offsets[idx + 1] - offset;
   auto const begin =
@@ -121,8 +123,9 @@ struct sorted_intersect_fn {
     auto const row_idx  = idx / cudf::detail::warp_size;
     auto const lane_idx = idx % cudf::detail::warp_size;
 
-    auto const needles  = get_row(d_input1, row_idx);
-    auto const haystack = get_row(d_input2, row_idx);
+    auto const needles = get_row(d_input1, row_idx);
+    // d_input2 is also allowed to have only one row
+    auto const haystack = get_row(d_input2, d_input2.size() == 1 ? 0 : row_idx);
 
     auto begin     = haystack.begin();
     auto const end = haystack.end();
@@ -172,11 +175,12 @@ struct jaccard_fn {
   cudf::size_type const* d_uniques1;
   cudf::size_type const* d_uniques2;
   cudf::size_type const* d_intersects;
+  bool single_uniques2;  // d_uniques2 has one value for all rows
 
   __device__ float operator()(cudf::size_type idx) const
   {
     auto const count1     = d_uniques1[idx];
-    auto const count2     = d_uniques2[idx];
+    auto const count2     = d_uniques2[single_uniques2 ? 0 : idx];
     auto const intersects = d_intersects[idx];
     // the intersect values are in both sets so a union count
     // would need to subtract the intersect count from one set
@@ -198,14 +202,15 @@ struct jaccard_fn {
  */
 std::unique_ptr<cudf::column> hash_substrings(cudf::strings_column_view const& col,
                                               cudf::size_type width,
-                                              rmm::cuda_stream_view stream)
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
 {
-  auto hashes = hash_character_ngrams(col, width, stream, rmm::mr::get_current_device_resource());
+  auto hashes        = hash_character_ngrams(col, width, stream, mr);
   auto const input   = cudf::lists_column_view(hashes->view());
   auto const offsets = input.offsets_begin();
   auto const data    = input.child().data<uint32_t>();
 
-  rmm::device_uvector<uint32_t> sorted(input.child().size(), stream);
+  rmm::device_uvector<uint32_t> sorted(input.child().size(), stream, mr);
 
   // this is wicked fast and much faster than using cudf::lists::detail::sort_list
   rmm::device_buffer d_temp_storage;
@@ -240,10 +245,98 @@ std::unique_ptr<cudf::column> hash_substrings(cudf::strings_column_view const& c
     0,
     rmm::device_buffer{},
     stream,
-    rmm::mr::get_current_device_resource());
+    mr);
+}
+
+/**
+ * @brief Computes the Jaccard index of each row from its sorted hashes
+ *
+ * The output has no nulls.
+ *
+ * @param hash1 Sorted hashes of each row of the first input
+ * @param hash2 Sorted hashes of each row of the second input, or of a single row
+ *              compared with every row of `hash1`
+ */
+std::unique_ptr<cudf::column> jaccard_from_hashes(cudf::column_view const& hash1,
+                                                  cudf::column_view const& hash2,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  // compute the unique counts in each set and the intersection counts
+  auto const d_uniques1   = compute_unique_counts(hash1, stream);
+  auto const d_uniques2   = compute_unique_counts(hash2, stream);
+  auto const d_intersects = compute_intersect_counts(hash1, hash2, stream);
+
+  auto results = cudf::make_numeric_column(cudf::data_type{cudf::type_id::FLOAT32},
+                                           hash1.size(),
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_results = results->mutable_view().data<float>();
+
+  // compute the jaccard using the unique counts and the intersect counts
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<cudf::size_type>(0),
+    thrust::counting_iterator<cudf::size_type>(results->size()),
+    d_results,
+    jaccard_fn{d_uniques1.data(), d_uniques2.data(), d_intersects.data(), hash2.size() == 1});
+  return results;
 }
 }  // namespace
 
+std::unique_ptr<cudf::column> hash_shingles(cudf::strings_column_view const& input,
+                                            cudf::size_type width,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(width >= 2,
+               "Parameter width should be an integer value of 2 or greater",
+               std::invalid_argument);
+  if (input.is_empty()) {
+    return cudf::lists::detail::make_empty_lists_column(
+      cudf::data_type{cudf::type_id::UINT32}, stream, mr);
+  }
+  auto hashes = hash_substrings(input, width, stream, mr);
+  if (input.has_nulls()) {
+    hashes->set_null_mask(cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                          input.null_count());
+  }
+  return hashes;
+}
+
+std::unique_ptr<cudf::column> jaccard_index(cudf::lists_column_view const& input1,
+                                            cudf::lists_column_view const& input2,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(input1.size() == input2.size() || input2.size() == 1,
+               "input2 must be the same size as input1 or have a single row",
+               std::invalid_argument);
+  CUDF_EXPECTS(input1.child().type().id() == cudf::type_id::UINT32 &&
+                 input2.child().type().id() == cudf::type_id::UINT32,
+               "inputs must be lists of UINT32 hashes",
+               std::invalid_argument);
+
+  if (input1.is_empty()) { return cudf::make_empty_column(cudf::type_id::FLOAT32); }
+
+  auto results = jaccard_from_hashes(input1.parent(), input2.parent(), stream, mr);
+
+  if (input2.size() == 1 && input2.null_count()) {
+    results->set_null_mask(
+      cudf::detail::create_null_mask(input1.size(), cudf::mask_state::ALL_NULL, stream, mr),
+      input1.size());
+  } else if (input2.size() == 1 && input1.null_count()) {
+    results->set_null_mask(cudf::detail::copy_bitmask(input1.parent(), stream, mr),
+                           input1.null_count());
+  } else if (input1.null_count() || input2.null_count()) {
+    auto [null_mask, null_count] =
+      cudf::detail::bitmask_and(cudf::table_view({input1.parent(), input2.parent()}), stream, mr);
+    results->set_null_mask(std::move(null_mask), null_count);
+  }
+  return results;
+}
+
 std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& input1,
                                             cudf::strings_column_view const& input2,
                                             cudf::size_type width,
@@ -259,30 +352,14 @@ std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& inp
   constexpr auto output_type = cudf::data_type{cudf::type_id::FLOAT32};
   if (input1.is_empty()) { return cudf::make_empty_column(output_type); }
 
-  auto const [d_uniques1, d_uniques2, d_intersects] = [&] {
+  auto results = [&] {
     // build hashes of the substrings
-    auto const hash1 = hash_substrings(input1, width, stream);
-    auto const hash2 = hash_substrings(input2, width, stream);
-
-    // compute the unique counts in each set and the intersection counts
-    auto d_uniques1   = compute_unique_counts(hash1->view(), stream);
-    auto d_uniques2   = compute_unique_counts(hash2->view(), stream);
-    auto d_intersects = compute_intersect_counts(hash1->view(), hash2->view(), stream);
-
-    return std::tuple{std::move(d_uniques1), std::move(d_uniques2), std::move(d_intersects)};
+    auto const temp_mr = rmm::mr::get_current_device_resource();
+    auto const hash1   = hash_substrings(input1, width, stream, temp_mr);
+    auto const hash2   = hash_substrings(input2, width, stream, temp_mr);
+    return jaccard_from_hashes(hash1->view(), hash2->view(), stream, mr);
   }();
 
-  auto results = cudf::make_numeric_column(
-    output_type, input1.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-  auto d_results = results->mutable_view().data<float>();
-
-  // compute the jaccard using the unique counts and the intersect counts
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(results->size()),
-                    d_results,
-                    jaccard_fn{d_uniques1.data(), d_uniques2.data(), d_intersects.data()});
-
   if (input1.null_count() || input2.null_count()) {
     auto [null_mask, null_count] =
       cudf::detail::bitmask_and(cudf::table_view({input1.parent(), input2.parent()}), stream, mr);
@@ -304,4 +381,22 @@ std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& inp
   return detail::jaccard_index(input1, input2, width, stream, mr);
 }
 
+std::unique_ptr<cudf::column> hash_shingles(cudf::strings_column_view const& input,
+                                            cudf::size_type width,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_shingles(input, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> jaccard_index(cudf::lists_column_view const& input1,
+                                            cudf::lists_column_view const& input2,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jaccard_index(input1, input2, stream, mr);
+}
+
 }  // namespace nvtext
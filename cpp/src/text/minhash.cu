@@ -39,6 +39,7 @@
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
 
+#include <algorithm>
 #include <limits>
 
 namespace nvtext {
@@ -120,6 +121,107 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
   }
 }
 
+/// Number of seeds whose minima each warp keeps in shared memory at a time
+constexpr cudf::size_type lsh_seeds_per_tile = 128;
+/// Number of threads in each block of the LSH kernel
+constexpr cudf::size_type lsh_block_size = 256;
+/// Number of strings processed by each block of the LSH kernel
+constexpr cudf::size_type lsh_warps_per_block = lsh_block_size / cudf::detail::warp_size;
+
+/**
+ * @brief Compute the LSH bucket of each band of the minhash values of each string
+ *
+ * This is a warp-per-string algorithm like `minhash_kernel`. The seeds are processed in
+ * tiles: the block loads a tile of seeds into shared memory and each warp keeps the minima of
+ * its string for those seeds in shared memory. Once the minima of a tile are complete, the
+ * first lane folds them into the buckets of their bands, so the minhash values are never
+ * written to global memory.
+ *
+ * The bucket of band `b` is `b` combined with the minhash values of the band in order using
+ * `hash_combine`.
+ *
+ * @param d_strings Strings column to process
+ * @param seeds Seeds for hashing each string; `rows_per_band` consecutive seeds form a band
+ * @param width Substring window size in characters
+ * @param rows_per_band Number of minhash values in each band
+ * @param d_buckets Bucket of each band for each string
+ */
+CUDF_KERNEL void minhash_lsh_kernel(cudf::column_device_view const d_strings,
+                                    cudf::device_span<uint64_t const> seeds,
+                                    cudf::size_type width,
+                                    cudf::size_type rows_per_band,
+                                    uint64_t* d_buckets)
+{
+  __shared__ uint64_t block_seeds[lsh_seeds_per_tile];
+  __shared__ uint64_t block_minima[lsh_warps_per_block][lsh_seeds_per_tile];
+
+  auto const warp_idx = static_cast<cudf::size_type>(threadIdx.x / cudf::detail::warp_size);
+  auto const lane_idx = static_cast<cudf::size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const str_idx  = static_cast<cudf::size_type>(blockIdx.x) * lsh_warps_per_block + warp_idx;
+
+  // warps without a string still help loading the seeds of each tile
+  auto const is_active = str_idx < d_strings.size() && d_strings.is_valid(str_idx);
+  auto const d_str =
+    is_active ? d_strings.element<cudf::string_view>(str_idx) : cudf::string_view{};
+  auto const num_bands = static_cast<std::size_t>(seeds.size() / rows_per_band);
+  auto minima          = block_minima[warp_idx];
+
+  auto const begin = d_str.data() + lane_idx;
+  auto const end   = d_str.data() + d_str.size_bytes();
+
+  uint64_t bucket = 0;  // running bucket of the current band, only used by the first lane
+  for (std::size_t tile_begin = 0; tile_begin < seeds.size(); tile_begin += lsh_seeds_per_tile) {
+    auto const tile_size =
+      std::min(static_cast<std::size_t>(lsh_seeds_per_tile), seeds.size() - tile_begin);
+    __syncthreads();  // the previous tile is done with the shared seeds
+    for (auto i = static_cast<std::size_t>(threadIdx.x); i < tile_size; i += blockDim.x) {
+      block_seeds[i] = seeds[tile_begin + i];
+    }
+    __syncthreads();
+    if (!is_active) { continue; }
+
+    auto const init = d_str.empty() ? 0 : std::numeric_limits<uint64_t>::max();
+    for (auto i = static_cast<std::size_t>(lane_idx); i < tile_size; i += cudf::detail::warp_size) {
+      minima[i] = init;
+    }
+    __syncwarp();
+
+    // each lane hashes 'width' substrings of d_str with every seed of the tile
+    for (auto itr = begin; itr < end; itr += cudf::detail::warp_size) {
+      if (cudf::strings::detail::is_utf8_continuation_char(*itr)) { continue; }
+      auto const check_str =  // used for counting 'width' characters
+        cudf::string_view(itr, static_cast<cudf::size_type>(thrust::distance(itr, end)));
+      auto const [bytes, left] =
+        cudf::strings::detail::bytes_to_character_position(check_str, width);
+      if ((itr != d_str.data()) && (left > 0)) { continue; }  // true if past the end of the string
+
+      auto const hash_str = cudf::string_view(itr, bytes);
+      for (std::size_t seed_idx = 0; seed_idx < tile_size; ++seed_idx) {
+        auto const hasher =
+          cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>(block_seeds[seed_idx]);
+        auto const hvalue = thrust::get<0>(hasher(hash_str));
+        cuda::atomic_ref<uint64_t, cuda::thread_scope_block> ref{minima[seed_idx]};
+        ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
+      }
+    }
+    __syncwarp();
+
+    if (lane_idx == 0) {
+      for (std::size_t idx = 0; idx < tile_size; ++idx) {
+        auto const seed_idx = tile_begin + idx;
+        auto const band     = seed_idx / rows_per_band;
+        auto const row      = seed_idx % rows_per_band;
+        if (row == 0) { bucket = band; }
+        bucket = cudf::hashing::detail::hash_combine(bucket, minima[idx]);
+        if (row + 1 == static_cast<std::size_t>(rows_per_band)) {
+          d_buckets[static_cast<std::size_t>(str_idx) * num_bands + band] = bucket;
+        }
+      }
+    }
+    __syncwarp();
+  }
+}
+
 template <
   typename HashFunction,
   typename hash_value_type = std::
@@ -234,6 +336,42 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   auto hashes        = detail::minhash_fn<HashFunction>(input, seeds, width, stream, mr);
   return build_list_result(input, std::move(hashes), seeds.size(), stream, mr);
 }
+
+std::unique_ptr<cudf::column> minhash_lsh_buckets(cudf::strings_column_view const& input,
+                                                  cudf::device_span<uint64_t const> seeds,
+                                                  cudf::size_type bands,
+                                                  cudf::size_type rows_per_band,
+                                                  cudf::size_type width,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(bands > 0 && rows_per_band > 0,
+               "Parameters bands and rows_per_band must be positive",
+               std::invalid_argument);
+  CUDF_EXPECTS(seeds.size() == static_cast<std::size_t>(bands) * rows_per_band,
+               "The number of seeds must be bands times rows_per_band",
+               std::invalid_argument);
+  CUDF_EXPECTS(width >= 2,
+               "Parameter width should be an integer value of 2 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS((static_cast<std::size_t>(input.size()) * bands) <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "The number of bands times the number of input rows exceeds the column size limit",
+               std::overflow_error);
+
+  auto const output_type = cudf::data_type{cudf::type_to_id<uint64_t>()};
+  auto buckets           = cudf::make_numeric_column(
+    output_type, input.size() * bands, cudf::mask_state::UNALLOCATED, stream, mr);
+
+  if (!input.is_empty()) {
+    auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+    cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, lsh_block_size};
+    minhash_lsh_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_strings, seeds, width, rows_per_band, buckets->mutable_view().data<uint64_t>());
+  }
+
+  return build_list_result(input, std::move(buckets), bands, stream, mr);
+}
 }  // namespace detail
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -276,4 +414,16 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   return detail::minhash64(input, seeds, width, stream, mr);
 }
 
+std::unique_ptr<cudf::column> minhash_lsh_buckets(cudf::strings_column_view const& input,
+                                                  cudf::device_span<uint64_t const> seeds,
+                                                  cudf::size_type bands,
+                                                  cudf::size_type rows_per_band,
+                                                  cudf::size_type width,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_lsh_buckets(input, seeds, bands, rows_per_band, width, stream, mr);
+}
+
 }  // namespace nvtext
@@ -289,7 +289,7 @@ uvector_pair data_normalizer::normalize(cudf::strings_column_view const& input,
   auto d_strings_offsets = std::make_unique<rmm::device_uvector<int64_t>>(num_offsets, stream);
   auto const d_offsets =
     cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
-  thrust::transform(rmm::exec_policy(stream),
+  thrust::transform(rmm::exec_policy_nosync(stream),
                     thrust::counting_iterator<cudf::size_type>(0),
                     thrust::counting_iterator<cudf::size_type>(num_offsets),
                     d_strings_offsets->begin(),
@@ -322,21 +322,21 @@ uvector_pair data_normalizer::normalize(cudf::strings_column_view const& input,
     d_chars_per_thread.data());
 
   // Remove the 'empty' code points from the vector
-  thrust::remove(rmm::exec_policy(stream),
+  thrust::remove(rmm::exec_policy_nosync(stream),
                  d_code_points->begin(),
                  d_code_points->end(),
                  uint32_t{1 << FILTER_BIT});
 
   // We also need to prefix sum the number of characters up to an including
   // the current character in order to get the new strings lengths.
-  thrust::inclusive_scan(rmm::exec_policy(stream),
+  thrust::inclusive_scan(rmm::exec_policy_nosync(stream),
                          d_chars_per_thread.begin(),
                          d_chars_per_thread.end(),
                          d_chars_per_thread.begin());
 
   // This will reset the offsets to the new generated code point values
   thrust::for_each_n(
-    rmm::exec_policy(stream),
+    rmm::exec_policy_nosync(stream),
     thrust::make_counting_iterator<uint32_t>(1),
     input.size(),
     update_strings_lengths_fn{d_chars_per_thread.data(), d_strings_offsets->data()});
@@ -44,6 +44,7 @@
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/logical.h>
 #include <thrust/transform.h>
 
@@ -352,6 +353,46 @@ struct transform_tokenizer_fn {
   }
 };
 
+/**
+ * @brief Returns true if a token boundary starts at the given character position
+ *
+ * Boundaries are the first character and each delimiter directly following a
+ * non-delimiter in the marks set by `mark_delimiters_fn` and `token_counts_fn`.
+ */
+struct token_boundary_fn {
+  int8_t const* d_marks;
+
+  __device__ bool operator()(int64_t idx) const
+  {
+    return (idx == 0) || (d_marks[idx] && !d_marks[idx - 1]);
+  }
+};
+
+/**
+ * @brief Looks up the token starting at a token boundary
+ *
+ * The token ends at the next boundary so the ids can be written directly while
+ * the boundaries are found without first building a column of the tokens.
+ *
+ * @tparam MapRefType Type of the static_map reference for calling find()
+ */
+template <typename MapRefType>
+struct boundary_tokenizer_fn {
+  char const* d_chars;
+  int64_t chars_size;
+  token_boundary_fn is_boundary;
+  transform_tokenizer_fn<MapRefType> tokenizer;
+
+  __device__ cudf::size_type operator()(int64_t idx) const
+  {
+    auto end = idx + 1;
+    while (end < chars_size && !is_boundary(end)) {
+      ++end;
+    }
+    return tokenizer(cudf::string_view{d_chars + idx, static_cast<cudf::size_type>(end - idx)});
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
@@ -423,34 +464,20 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
   auto [token_offsets, total_count] = cudf::detail::make_offsets_child_column(
     d_token_counts.begin(), d_token_counts.end(), stream, mr);
 
-  rmm::device_uvector<cudf::size_type> d_tmp_offsets(total_count + 1, stream);
-  d_tmp_offsets.set_element(total_count, chars_size, stream);
-  thrust::copy_if(rmm::exec_policy(stream),
-                  zero_itr,
-                  thrust::counting_iterator<cudf::size_type>(chars_size),
-                  d_tmp_offsets.begin(),
-                  [d_marks = d_marks.data()] __device__(auto idx) {
-                    if (idx == 0) return true;
-                    return d_marks[idx] && !d_marks[idx - 1];
-                  });
-
-  auto tmp_offsets =
-    std::make_unique<cudf::column>(std::move(d_tmp_offsets), rmm::device_buffer{}, 0);
-  auto const tmp_input = cudf::column_view(
-    input.parent().type(), total_count, d_input_chars, nullptr, 0, 0, {tmp_offsets->view()});
-
-  auto const d_tmp_strings = cudf::column_device_view::create(tmp_input, stream);
-
-  auto tokens =
-    cudf::make_numeric_column(output_type, total_count, cudf::mask_state::UNALLOCATED, stream, mr);
-  auto d_tokens = tokens->mutable_view().data<cudf::size_type>();
-
-  transform_tokenizer_fn<decltype(map_ref)> tokenizer{d_delimiter, map_ref, default_id};
-  thrust::transform(rmm::exec_policy(stream),
-                    d_tmp_strings->begin<cudf::string_view>(),
-                    d_tmp_strings->end<cudf::string_view>(),
-                    d_tokens,
-                    tokenizer);
+  // the last boundary may start a trailing run of delimiters which has no token
+  rmm::device_uvector<cudf::size_type> d_tokens(total_count + 1, stream, mr);
+
+  // find the token boundaries and look up each token in the same pass
+  auto const is_boundary = token_boundary_fn{d_marks.data()};
+  auto const tokenizer   = boundary_tokenizer_fn<decltype(map_ref)>{
+    d_input_chars, chars_size, is_boundary, {d_delimiter, map_ref, default_id}};
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  thrust::counting_iterator<int64_t>(0),
+                  thrust::counting_iterator<int64_t>(chars_size),
+                  thrust::make_transform_output_iterator(d_tokens.begin(), tokenizer),
+                  is_boundary);
+  d_tokens.resize(total_count, stream);
+  auto tokens = std::make_unique<cudf::column>(std::move(d_tokens), rmm::device_buffer{}, 0);
 
   return cudf::make_lists_column(input.size(),
                                  std::move(token_offsets),
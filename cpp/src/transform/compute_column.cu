@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "transform/compute_column_jit.hpp"
+
 #include <cudf/ast/detail/expression_evaluator.cuh>
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
@@ -23,6 +25,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -47,6 +50,7 @@ namespace detail {
  *
  * @tparam max_block_size The size of the thread block, used to set launch
  * bounds and minimize register usage.
+ * @tparam rows_per_thread The number of rows each thread evaluates per operator step.
  * @tparam has_nulls whether or not the output column may contain nulls.
  *
  * @param table The table device view used for evaluation.
@@ -54,7 +58,7 @@ namespace detail {
  * expression.
  * @param output_column The destination for the results of evaluating the expression.
  */
-template <cudf::size_type max_block_size, bool has_nulls>
+template <cudf::size_type max_block_size, cudf::size_type rows_per_thread, bool has_nulls>
 __launch_bounds__(max_block_size) CUDF_KERNEL
   void compute_column_kernel(table_device_view const table,
                              ast::detail::expression_device_view device_expression_data,
@@ -69,22 +73,45 @@ __launch_bounds__(max_block_size) CUDF_KERNEL
     reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
 
   auto thread_intermediate_storage =
-    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates *
+                          rows_per_thread];
   auto start_idx    = cudf::detail::grid_1d::global_thread_id();
   auto const stride = cudf::detail::grid_1d::grid_stride();
   auto evaluator =
     cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
 
-  for (thread_index_type row_index = start_idx; row_index < table.num_rows(); row_index += stride) {
-    auto output_dest = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
-    evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
+  if constexpr (rows_per_thread == 1) {
+    for (thread_index_type row_index = start_idx; row_index < table.num_rows();
+         row_index += stride) {
+      auto output_dest = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
+      evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
+    }
+  } else {
+    using row_batch = typename ast::detail::expression_evaluator<has_nulls>::row_batch;
+    for (thread_index_type first_row = start_idx; first_row < table.num_rows();
+         first_row += stride * rows_per_thread) {
+      auto const remaining = (table.num_rows() - first_row + stride - 1) / stride;
+      auto const batch_size =
+        remaining < rows_per_thread ? static_cast<cudf::size_type>(remaining) : rows_per_thread;
+      auto const batch = row_batch{static_cast<cudf::size_type>(first_row),
+                                   static_cast<cudf::size_type>(stride),
+                                   batch_size};
+      auto output_dest = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
+      evaluator.evaluate_rows(output_dest, batch, thread_intermediate_storage);
+    }
   }
 }
 
-std::unique_ptr<column> compute_column(table_view const& table,
-                                       ast::expression const& expr,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::device_async_resource_ref mr)
+namespace {
+
+/**
+ * @brief Evaluate an expression with the interpreter, `rows_per_thread` rows per operator step
+ */
+template <cudf::size_type rows_per_thread>
+std::unique_ptr<column> compute_column_interpreted(table_view const& table,
+                                                   ast::expression const& expr,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
 {
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
@@ -110,21 +137,22 @@ std::unique_ptr<column> compute_column(table_view const& table,
   CUDF_CUDA_TRY(
     cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
   auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const shmem_per_thread   = parser.shmem_per_thread * rows_per_thread;
   auto const block_size =
-    parser.shmem_per_thread != 0
-      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread)
-      : MAX_BLOCK_SIZE;
-  auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
-  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+    shmem_per_thread != 0 ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / shmem_per_thread)
+                          : MAX_BLOCK_SIZE;
+  auto const num_threads = util::div_rounding_up_safe(table.num_rows(), rows_per_thread);
+  auto const config      = cudf::detail::grid_1d{num_threads, block_size};
+  auto const shmem_per_block = shmem_per_thread * config.num_threads_per_block;
 
   // Execute the kernel
   auto table_device = table_device_view::create(table, stream);
   if (has_nulls) {
-    cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, true>
+    cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, rows_per_thread, true>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
         *table_device, device_expression_data, *mutable_output_device);
   } else {
-    cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, false>
+    cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, rows_per_thread, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
         *table_device, device_expression_data, *mutable_output_device);
   }
@@ -134,6 +162,40 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return output_column;
 }
 
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  return compute_column_interpreted<1>(table, expr, stream, mr);
+}
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       ast_evaluation evaluation,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  if (evaluation == ast_evaluation::INTERPRETED_MULTI_ROW) {
+    // Four rows keep enough independent loads in flight without multiplying shared memory much
+    return compute_column_interpreted<4>(table, expr, stream, mr);
+  }
+  if (evaluation == ast_evaluation::JIT) {
+    auto const has_nulls = expr.may_evaluate_null(table, stream);
+    auto const parser    = ast::detail::expression_parser{expr, table, has_nulls, stream, mr};
+    if (transformation::jit::is_jit_compilable(parser, has_nulls)) {
+      auto output_column = cudf::make_fixed_width_column(
+        parser.output_type(), table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+      if (table.num_rows() == 0) { return output_column; }
+      transformation::jit::compute_column(parser, table, output_column->mutable_view(), stream);
+      return output_column;
+    }
+  }
+  return compute_column(table, expr, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const& table,
@@ -144,4 +206,13 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return detail::compute_column(table, expr, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       ast_evaluation evaluation,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, evaluation, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "transform/compute_column_jit.hpp"
+
+#include "jit/cache.hpp"
+#include "jit/util.hpp"
+
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <jit_preprocessed_files/transform/jit/compute_column_kernel.cu.jit.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+namespace {
+
+using ast::ast_operator;
+using ast::detail::device_data_reference_type;
+
+bool is_supported_operator(ast_operator op)
+{
+  switch (op) {
+    case ast_operator::ADD:
+    case ast_operator::SUB:
+    case ast_operator::MUL:
+    case ast_operator::DIV:
+    case ast_operator::TRUE_DIV:
+    case ast_operator::EQUAL:
+    case ast_operator::NULL_EQUAL:
+    case ast_operator::NOT_EQUAL:
+    case ast_operator::LESS:
+    case ast_operator::GREATER:
+    case ast_operator::LESS_EQUAL:
+    case ast_operator::GREATER_EQUAL:
+    case ast_operator::BITWISE_AND:
+    case ast_operator::BITWISE_OR:
+    case ast_operator::BITWISE_XOR:
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR:
+    case ast_operator::IDENTITY:
+    case ast_operator::NOT:
+    case ast_operator::BIT_INVERT:
+    case ast_operator::CAST_TO_INT64:
+    case ast_operator::CAST_TO_UINT64:
+    case ast_operator::CAST_TO_FLOAT64: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the CUDA expression applying `op` to the `operands` expressions
+ *
+ * These mirror the `operator_functor` specializations in `ast/detail/operators.hpp`. The
+ * null-aware operators match their plain counterparts since only expressions without nulls are
+ * compiled.
+ */
+std::string operator_expression(ast_operator op, std::vector<std::string> const& operands)
+{
+  auto const& lhs   = operands.front();
+  auto const binary = [&](char const* symbol) {
+    return "(" + lhs + " " + symbol + " " + operands.back() + ")";
+  };
+  switch (op) {
+    case ast_operator::ADD: return binary("+");
+    case ast_operator::SUB: return binary("-");
+    case ast_operator::MUL: return binary("*");
+    case ast_operator::DIV: return binary("/");
+    case ast_operator::TRUE_DIV:
+      return "(static_cast<double>(" + lhs + ") / static_cast<double>(" + operands.back() + "))";
+    case ast_operator::EQUAL:
+    case ast_operator::NULL_EQUAL: return binary("==");
+    case ast_operator::NOT_EQUAL: return binary("!=");
+    case ast_operator::LESS: return binary("<");
+    case ast_operator::GREATER: return binary(">");
+    case ast_operator::LESS_EQUAL: return binary("<=");
+    case ast_operator::GREATER_EQUAL: return binary(">=");
+    case ast_operator::BITWISE_AND: return binary("&");
+    case ast_operator::BITWISE_OR: return binary("|");
+    case ast_operator::BITWISE_XOR: return binary("^");
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND: return binary("&&");
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return binary("||");
+    case ast_operator::IDENTITY: return lhs;
+    case ast_operator::NOT: return "(!" + lhs + ")";
+    case ast_operator::BIT_INVERT: return "(~" + lhs + ")";
+    case ast_operator::CAST_TO_INT64: return "static_cast<int64_t>(" + lhs + ")";
+    case ast_operator::CAST_TO_UINT64: return "static_cast<uint64_t>(" + lhs + ")";
+    case ast_operator::CAST_TO_FLOAT64: return "static_cast<double>(" + lhs + ")";
+    default: CUDF_FAIL("Unsupported operator for JIT compiled expressions");
+  }
+}
+
+}  // namespace
+
+bool is_jit_compilable(ast::detail::expression_parser const& plan, bool has_nulls)
+{
+  if (has_nulls) { return false; }
+  auto const& references = plan.data_references();
+  auto const& operators  = plan.operators();
+  return std::all_of(references.begin(),
+                     references.end(),
+                     [](auto const& ref) {
+                       return is_numeric(ref.data_type) &&
+                              ref.table_source != ast::table_reference::RIGHT;
+                     }) &&
+         std::all_of(operators.begin(), operators.end(), is_supported_operator);
+}
+
+std::string generate_ast_source(ast::detail::expression_parser const& plan)
+{
+  auto const& references = plan.data_references();
+  auto const& indices    = plan.operator_source_indices();
+
+  std::ostringstream source;
+  source << "#pragma once\n\n"
+         << "__device__ inline void GENERIC_AST_OP(void* out, cudf::size_type row, "
+         << "void const* const* columns, void const* const* literals)\n{\n";
+
+  // intermediate slots are reused by the plan, so each one is a variable assigned in plan order
+  for (std::size_t i = 0; i < references.size(); ++i) {
+    if (references[i].reference_type == device_data_reference_type::INTERMEDIATE) {
+      source << "  " << type_to_name(references[i].data_type) << " v" << i << ";\n";
+    }
+  }
+
+  auto const operand = [&](size_type index) -> std::string {
+    auto const& ref       = references[index];
+    auto const type_name  = type_to_name(ref.data_type);
+    auto const data_index = std::to_string(ref.data_index);
+    switch (ref.reference_type) {
+      case device_data_reference_type::COLUMN:
+        return "static_cast<" + type_name + " const*>(columns[" + data_index + "])[row]";
+      case device_data_reference_type::LITERAL:
+        return "(*static_cast<" + type_name + " const*>(literals[" + data_index + "]))";
+      default: return "v" + std::to_string(index);
+    }
+  };
+
+  std::size_t position = 0;
+  for (auto const op : plan.operators()) {
+    std::vector<std::string> operands;
+    for (size_type i = 0; i < ast::detail::ast_operator_arity(op); ++i) {
+      operands.push_back(operand(indices[position++]));
+    }
+    auto const destination = indices[position++];
+    auto const& ref        = references[destination];
+    auto const type_name   = type_to_name(ref.data_type);
+    auto const value = "static_cast<" + type_name + ">(" + operator_expression(op, operands) + ")";
+    if (ref.table_source == ast::table_reference::OUTPUT) {
+      source << "  static_cast<" << type_name << "*>(out)[row] = " << value << ";\n";
+    } else {
+      source << "  v" << destination << " = " << value << ";\n";
+    }
+  }
+  source << "}\n";
+  return source.str();
+}
+
+void compute_column(ast::detail::expression_parser const& plan,
+                    table_view const& table,
+                    mutable_column_view output,
+                    rmm::cuda_stream_view stream)
+{
+  std::vector<void const*> columns;
+  std::transform(table.begin(), table.end(), std::back_inserter(columns), [](auto const& col) {
+    return is_numeric(col.type()) ? cudf::jit::get_data_ptr(col) : nullptr;
+  });
+  std::vector<void const*> literals;
+  std::transform(plan.literals().begin(),
+                 plan.literals().end(),
+                 std::back_inserter(literals),
+                 [](auto const& literal) { return literal.data(); });
+  auto const d_columns = cudf::detail::make_device_uvector_async(
+    columns, stream, rmm::mr::get_current_device_resource());
+  auto const d_literals = cudf::detail::make_device_uvector_async(
+    literals, stream, rmm::mr::get_current_device_resource());
+
+  // jitify keys its cache on the kernel name and the overriding header, i.e. the expression shape
+  cudf::jit::get_kernel(*transform_jit_compute_column_kernel_cu_jit,
+                        "cudf::transformation::jit::compute_column_kernel",
+                        "transform/jit/ast-operation.hpp",
+                        generate_ast_source(plan))
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(output.size(),                                //
+             cudf::jit::get_data_ptr(output),
+             d_columns.data(),
+             d_literals.data());
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
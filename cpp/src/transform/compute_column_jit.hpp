@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <string>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Returns whether the parsed expression can be evaluated by a JIT-compiled kernel
+ *
+ * @param plan The parsed expression
+ * @param has_nulls Whether the expression may evaluate to null
+ * @return true if `generate_ast_source` supports the plan
+ */
+bool is_jit_compilable(ast::detail::expression_parser const& plan, bool has_nulls);
+
+/**
+ * @brief Generates the CUDA source of `GENERIC_AST_OP` for the parsed expression
+ *
+ * The source depends only on the operators, the data reference layout and the data types of the
+ * plan, so expressions of the same shape produce identical source and share a compiled kernel.
+ *
+ * @param plan The parsed expression
+ * @return The source of the `transform/jit/ast-operation.hpp` header
+ */
+std::string generate_ast_source(ast::detail::expression_parser const& plan);
+
+/**
+ * @brief Evaluates the parsed expression on `table` into `output` with a JIT-compiled kernel
+ *
+ * @param plan The parsed expression, for which `is_jit_compilable` is true
+ * @param table The table the expression is evaluated on
+ * @param output The column receiving the result, of the plan's output type
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compute_column(ast::detail::expression_parser const& plan,
+                    table_view const& table,
+                    mutable_column_view output,
+                    rmm::cuda_stream_view stream);
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
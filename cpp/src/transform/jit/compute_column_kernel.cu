@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/types.hpp>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+// clang-format off
+#include "transform/jit/ast-operation.hpp"
+// clang-format on
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Evaluates a generated AST expression on every row
+ *
+ * `GENERIC_AST_OP` is defined by the source generated from the expression plan. It reads its
+ * operands from `columns` and `literals` and writes the result for `row` to `out_data`.
+ */
+CUDF_KERNEL void compute_column_kernel(cudf::size_type size,
+                                       void* out_data,
+                                       void const* const* columns,
+                                       void const* const* literals)
+{
+  // cannot use global_thread_id utility due to a JIT build issue by including
+  // the `cudf/detail/utilities/cuda.cuh` header
+  thread_index_type const start  = threadIdx.x + blockIdx.x * blockDim.x;
+  thread_index_type const stride = blockDim.x * gridDim.x;
+
+  for (auto i = start; i < static_cast<thread_index_type>(size); i += stride) {
+    GENERIC_AST_OP(out_data, static_cast<cudf::size_type>(i), columns, literals);
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
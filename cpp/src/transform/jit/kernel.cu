@@ -22,6 +22,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/limits>
 #include <cuda/std/type_traits>
+#include <cuda/std/utility>
 
 #include <cstddef>
 
@@ -46,6 +47,57 @@ CUDF_KERNEL void kernel(cudf::size_type size, TypeOut* out_data, TypeIn* in_data
   }
 }
 
+template <typename... TypeOut, typename TypeIn, cuda::std::size_t... Indices>
+__device__ void null_aware_operation(cudf::size_type i,
+                                     void* const* out_data,
+                                     bool* out_valid,
+                                     TypeIn in,
+                                     bool in_valid,
+                                     cuda::std::index_sequence<Indices...>)
+{
+  GENERIC_NULL_AWARE_OP(&static_cast<TypeOut*>(out_data[Indices])[i]..., out_valid, in, in_valid);
+}
+
+template <typename TypeIn, typename... TypeOut>
+CUDF_KERNEL void null_aware_kernel(cudf::size_type size,
+                                   TypeIn const* in_data,
+                                   cudf::bitmask_type const* in_mask,
+                                   cudf::size_type in_offset,
+                                   void* const* out_data,
+                                   cudf::bitmask_type* const* out_masks)
+{
+  constexpr int num_outputs = sizeof...(TypeOut);
+  constexpr int word_bits   = cuda::std::numeric_limits<cudf::bitmask_type>::digits;
+
+  thread_index_type const start  = threadIdx.x + blockIdx.x * blockDim.x;
+  thread_index_type const stride = blockDim.x * gridDim.x;
+
+  for (auto i = start; i < static_cast<thread_index_type>(size); i += stride) {
+    auto const in_bit   = i + in_offset;
+    bool const in_valid =
+      in_mask == nullptr or ((in_mask[in_bit / word_bits] >> (in_bit % word_bits)) & 1);
+
+    // outputs default to the validity of the input row, the UDF may change each of them
+    bool out_valid[num_outputs];
+    for (int k = 0; k < num_outputs; ++k) {
+      out_valid[k] = in_valid;
+    }
+    null_aware_operation<TypeOut...>(static_cast<cudf::size_type>(i),
+                                     out_data,
+                                     out_valid,
+                                     in_data[i],
+                                     in_valid,
+                                     cuda::std::index_sequence_for<TypeOut...>{});
+
+    // the output masks start all valid and rows of a word may be cleared by different threads
+    for (int k = 0; k < num_outputs; ++k) {
+      if (not out_valid[k]) {
+        atomicAnd(&out_masks[k][i / word_bits], ~(cudf::bitmask_type{1} << (i % word_bits)));
+      }
+    }
+  }
+}
+
 }  // namespace jit
 }  // namespace transformation
 }  // namespace cudf
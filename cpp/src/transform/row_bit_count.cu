@@ -34,9 +34,16 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/binary_search.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
 #include <thrust/tabulate.h>
+#include <thrust/unique.h>
+
+#include <climits>
 
 namespace cudf {
 namespace detail {
@@ -563,6 +570,72 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   return segmented_row_bit_count(t, 1, stream, mr);
 }
 
+std::vector<size_type> split_by_size(table_view const& t,
+                                     std::size_t target_bytes,
+                                     rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(target_bytes > 0, "Invalid target size.", std::invalid_argument);
+  if (t.num_rows() <= 1) { return {}; }
+  auto const num_rows    = t.num_rows();
+  auto const target_bits = static_cast<int64_t>(target_bytes) * CHAR_BIT;
+
+  std::vector<cudf::column_view> cols;
+  std::vector<column_info> info;
+  hierarchy_info h_info;
+  flatten_hierarchy(t.begin(), t.end(), cols, info, h_info, stream);
+
+  // every row has the same size when there are no complex types, so the splits are regular
+  if (h_info.complex_type_count <= 0) {
+    auto const rows_per_split =
+      std::max<int64_t>(1, target_bits / std::max(size_type{1}, h_info.simple_per_row_size));
+    std::vector<size_type> splits;
+    for (int64_t row = rows_per_split; row < num_rows; row += rows_per_split) {
+      splits.push_back(static_cast<size_type>(row));
+    }
+    return splits;
+  }
+
+  // cumulative size of the rows up to and including each row
+  rmm::device_uvector<int64_t> cumulative_bits(num_rows, stream);
+  {
+    auto const row_bits =
+      segmented_row_bit_count(t, 1, stream, rmm::mr::get_current_device_resource());
+    auto const bits_begin = thrust::make_transform_iterator(
+      row_bits->view().begin<size_type>(),
+      cuda::proclaim_return_type<int64_t>(
+        [] __device__(size_type bits) { return static_cast<int64_t>(bits); }));
+    thrust::inclusive_scan(
+      rmm::exec_policy_nosync(stream), bits_begin, bits_begin + num_rows, cumulative_bits.begin());
+  }
+  auto const total_bits = cumulative_bits.back_element(stream);
+  auto const num_splits = static_cast<size_type>(
+    std::min<int64_t>(num_rows, util::div_rounding_up_safe(total_bits, target_bits) - 1));
+  if (num_splits <= 0) { return {}; }
+
+  // split k starts at the first row whose cumulative size exceeds k target sizes, so a split
+  // exceeds the target by less than the size of its first row
+  rmm::device_uvector<size_type> splits(num_splits, stream);
+  auto const boundaries = thrust::make_transform_iterator(
+    thrust::counting_iterator<int64_t>(1),
+    cuda::proclaim_return_type<int64_t>(
+      [target_bits] __device__(int64_t k) { return k * target_bits; }));
+  thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                      cumulative_bits.begin(),
+                      cumulative_bits.end(),
+                      boundaries,
+                      boundaries + num_splits,
+                      splits.begin());
+
+  // rows larger than the target produce repeated or out of range boundaries
+  auto const is_out_of_range = cuda::proclaim_return_type<bool>(
+    [num_rows] __device__(size_type row) { return row <= 0 or row >= num_rows; });
+  auto end = thrust::unique(rmm::exec_policy_nosync(stream), splits.begin(), splits.end());
+  end = thrust::remove_if(rmm::exec_policy_nosync(stream), splits.begin(), end, is_out_of_range);
+  return cudf::detail::make_std_vector_sync(
+    device_span<size_type const>{splits.data(), static_cast<std::size_t>(end - splits.begin())},
+    stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
@@ -573,6 +646,12 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
   return detail::segmented_row_bit_count(t, segment_length, cudf::get_default_stream(), mr);
 }
 
+std::vector<size_type> split_by_size(table_view const& t, std::size_t target_bytes)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_by_size(t, target_bytes, cudf::get_default_stream());
+}
+
 std::unique_ptr<column> row_bit_count(table_view const& t, rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
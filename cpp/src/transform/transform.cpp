@@ -20,9 +20,12 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -32,21 +35,24 @@
 
 #include <jit_preprocessed_files/transform/jit/kernel.cu.jit.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace transformation {
 namespace jit {
 
-void unary_operation(mutable_column_view output,
-                     column_view input,
-                     std::string const& udf,
-                     data_type output_type,
-                     bool is_ptx,
-                     rmm::cuda_stream_view stream)
+jitify2::Kernel get_unary_kernel(data_type input_type,
+                                 std::string const& udf,
+                                 data_type output_type,
+                                 bool is_ptx)
 {
   std::string kernel_name =
     jitify2::reflection::Template("cudf::transformation::jit::kernel")  //
-      .instantiate(cudf::type_to_name(output.type()),  // list of template arguments
-                   cudf::type_to_name(input.type()));
+      .instantiate(cudf::type_to_name(output_type),  // list of template arguments
+                   cudf::type_to_name(input_type));
 
   std::string cuda_source =
     is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
@@ -56,15 +62,71 @@ void unary_operation(mutable_column_view output,
            : cudf::jit::parse_single_function_cuda(udf,  //
                                                    "GENERIC_UNARY_OP");
 
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+  return cudf::jit::get_kernel(
+    *transform_jit_kernel_cu_jit, kernel_name, "transform/jit/operation-udf.hpp", cuda_source);
+}
+
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     std::string const& udf,
+                     data_type output_type,
+                     bool is_ptx,
+                     rmm::cuda_stream_view stream)
+{
+  get_unary_kernel(input.type(), udf, output_type, is_ptx)
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(output.size(),                                //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
 
+jitify2::Kernel get_null_aware_kernel(data_type input_type,
+                                      std::string const& udf,
+                                      std::vector<data_type> const& output_types)
+{
+  std::vector<std::string> template_args{cudf::type_to_name(input_type)};
+  std::transform(output_types.begin(),
+                 output_types.end(),
+                 std::back_inserter(template_args),
+                 [](auto type) { return cudf::type_to_name(type); });
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::null_aware_kernel")
+      .instantiate(template_args);
+
+  std::string cuda_source = cudf::jit::parse_single_function_cuda(udf, "GENERIC_NULL_AWARE_OP");
+
+  return cudf::jit::get_kernel(
+    *transform_jit_kernel_cu_jit, kernel_name, "transform/jit/operation-udf.hpp", cuda_source);
+}
+
+void null_aware_operation(std::vector<mutable_column_view> const& outputs,
+                          column_view input,
+                          std::string const& udf,
+                          rmm::cuda_stream_view stream)
+{
+  std::vector<data_type> output_types;
+  std::vector<void*> out_data;
+  std::vector<bitmask_type*> out_masks;
+  for (auto const& output : outputs) {
+    output_types.push_back(output.type());
+    out_data.push_back(output.head<void>());
+    out_masks.push_back(output.null_mask());
+  }
+  auto const d_out_data = cudf::detail::make_device_uvector_async(
+    out_data, stream, rmm::mr::get_current_device_resource());
+  auto const d_out_masks = cudf::detail::make_device_uvector_async(
+    out_masks, stream, rmm::mr::get_current_device_resource());
+
+  get_null_aware_kernel(input.type(), udf, output_types)
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(input.size(),                                 //
+             cudf::jit::get_data_ptr(input),
+             input.null_mask(),
+             input.offset(),
+             d_out_data.data(),
+             d_out_masks.data());
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -91,6 +153,40 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::vector<std::unique_ptr<column>> null_aware_transform(
+  column_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()), "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(
+    not output_types.empty(), "At least one output type is required.", std::invalid_argument);
+  CUDF_EXPECTS(std::all_of(output_types.begin(),
+                           output_types.end(),
+                           [](auto type) { return is_fixed_width(type); }),
+               "Unexpected non-fixed-width output type.");
+
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<mutable_column_view> output_views;
+  for (auto const type : output_types) {
+    outputs.push_back(
+      make_fixed_width_column(type, input.size(), mask_state::ALL_VALID, stream, mr));
+    output_views.push_back(*outputs.back());
+  }
+
+  if (input.is_empty()) { return outputs; }
+
+  transformation::jit::null_aware_operation(output_views, input, udf, stream);
+
+  for (auto& output : outputs) {
+    output->set_null_count(
+      cudf::detail::null_count(output->view().null_mask(), 0, output->size(), stream));
+  }
+  return outputs;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -103,4 +199,24 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, cudf::get_default_stream(), mr);
 }
 
+std::vector<std::unique_ptr<column>> null_aware_transform(
+  column_view const& input,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::null_aware_transform(input, udf, output_types, cudf::get_default_stream(), mr);
+}
+
+void warm_transform(data_type input_type,
+                    std::string const& unary_udf,
+                    data_type output_type,
+                    bool is_ptx)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_fixed_width(input_type), "Unexpected non-fixed-width type.");
+  transformation::jit::get_unary_kernel(input_type, unary_udf, output_type, is_ptx);
+}
+
 }  // namespace cudf
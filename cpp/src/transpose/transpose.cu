@@ -13,26 +13,173 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+/// Number of rows and of columns of the tiles transposed through shared memory
+constexpr int transpose_tile_dim = 32;
+
+/// Number of thread rows of a block; each thread copies `transpose_tile_dim / this` elements
+constexpr int transpose_block_rows = 8;
+
+/// Largest number of tiles along the columns of a single kernel launch
+constexpr size_type max_column_tiles_per_launch = 65535;
+
+/**
+ * @brief Transposes the tiles of `transpose_tile_dim` rows and columns of a row-major output
+ *
+ * Each warp reads consecutive rows of one input column into shared memory and then writes
+ * consecutive columns of one output row from it, so both the reads and the writes are
+ * coalesced. The tile is padded by one element to avoid shared memory bank conflicts.
+ *
+ * @param columns Data of the input columns, with their offsets applied
+ * @param num_columns Number of input columns
+ * @param num_rows Number of input rows
+ * @param first_column First column of the tiles transposed by this launch
+ * @param output The `num_rows` x `num_columns` row-major output
+ */
+template <typename T>
+CUDF_KERNEL void transpose_tiles_kernel(T const* const* columns,
+                                        size_type num_columns,
+                                        size_type num_rows,
+                                        size_type first_column,
+                                        T* output)
+{
+  __shared__ T tile[transpose_tile_dim][transpose_tile_dim + 1];
+
+  auto const row_begin = static_cast<size_type>(blockIdx.x) * transpose_tile_dim;
+  auto const col_begin = first_column + static_cast<size_type>(blockIdx.y) * transpose_tile_dim;
+  auto const lane      = static_cast<int>(threadIdx.x);
+
+  auto const row = row_begin + lane;
+  for (auto i = static_cast<int>(threadIdx.y); i < transpose_tile_dim; i += transpose_block_rows) {
+    auto const col = col_begin + i;
+    if (col < num_columns and row < num_rows) { tile[i][lane] = columns[col][row]; }
+  }
+  __syncthreads();
+
+  auto const col = col_begin + lane;
+  for (auto i = static_cast<int>(threadIdx.y); i < transpose_tile_dim; i += transpose_block_rows) {
+    auto const out_row = row_begin + i;
+    if (col < num_columns and out_row < num_rows) {
+      output[static_cast<std::size_t>(out_row) * num_columns + col] = tile[lane][i];
+    }
+  }
+}
+
+/**
+ * @brief Returns the validity of an element of the row-major transposed table
+ */
+struct transposed_validity_fn {
+  table_device_view input;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    auto const num_columns = input.num_columns();
+    return input.column(idx % num_columns).is_valid(idx / num_columns);
+  }
+};
+
+/**
+ * @brief Writes the elements of the fixed-width columns of `input` to the row-major `output`
+ *
+ * @tparam T Unsigned type of the size of the elements, which are copied as raw bits
+ */
+template <typename T>
+void transpose_fixed_width(table_view const& input, T* output, rmm::cuda_stream_view stream)
+{
+  std::vector<T const*> h_columns(input.num_columns());
+  std::transform(input.begin(), input.end(), h_columns.begin(), [](column_view const& col) {
+    return col.data<T>();
+  });
+  auto const d_columns =
+    make_device_uvector_async(h_columns, stream, rmm::mr::get_current_device_resource());
+
+  auto const row_tiles    = util::div_rounding_up_safe(input.num_rows(), transpose_tile_dim);
+  auto const column_tiles = util::div_rounding_up_safe(input.num_columns(), transpose_tile_dim);
+  dim3 const block(transpose_tile_dim, transpose_block_rows);
+  // very wide tables are transposed over several launches of at most the maximum grid height
+  for (size_type first_tile = 0; first_tile < column_tiles;
+       first_tile += max_column_tiles_per_launch) {
+    auto const launch_tiles = std::min(column_tiles - first_tile, max_column_tiles_per_launch);
+    dim3 const grid(row_tiles, launch_tiles);
+    transpose_tiles_kernel<T><<<grid, block, 0, stream.value()>>>(d_columns.data(),
+                                                                  input.num_columns(),
+                                                                  input.num_rows(),
+                                                                  first_tile * transpose_tile_dim,
+                                                                  output);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+}
+
+/**
+ * @brief Transposes a table of fixed-width columns of the same type into a row-major column
+ */
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  auto const dtype       = input.column(0).type();
+  auto const output_size = input.num_columns() * input.num_rows();
+  auto output = make_fixed_width_column(dtype, output_size, mask_state::UNALLOCATED, stream, mr);
+
+  auto const d_output = output->mutable_view().head();
+  switch (size_of(dtype)) {
+    case 1: transpose_fixed_width(input, static_cast<uint8_t*>(d_output), stream); break;
+    case 2: transpose_fixed_width(input, static_cast<uint16_t*>(d_output), stream); break;
+    case 4: transpose_fixed_width(input, static_cast<uint32_t*>(d_output), stream); break;
+    case 8: transpose_fixed_width(input, static_cast<uint64_t*>(d_output), stream); break;
+    case 16: transpose_fixed_width(input, static_cast<__int128_t*>(d_output), stream); break;
+    default: CUDF_FAIL("Unsupported fixed-width type size", cudf::data_type_error);
+  }
+
+  auto const nullable = std::any_of(
+    input.begin(), input.end(), [](column_view const& col) { return col.nullable(); });
+  if (nullable) {
+    auto const d_input      = table_device_view::create(input, stream);
+    auto [mask, null_count] = valid_if(thrust::make_counting_iterator<size_type>(0),
+                                       thrust::make_counting_iterator<size_type>(output_size),
+                                       transposed_validity_fn{*d_input},
+                                       stream,
+                                       mr);
+    output->set_null_mask(std::move(mask), null_count);
+  }
+  return output;
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::device_async_resource_ref mr)
@@ -49,7 +196,15 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::detail::interleave_columns(input, stream, mr);
+  CUDF_EXPECTS(static_cast<int64_t>(input.num_columns()) * input.num_rows() <=
+                 static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Transposed table size exceeds the column size limit",
+               std::overflow_error);
+
+  // Fixed-width tables are transposed in tiles which coalesce both the reads and the writes
+  auto output_column = is_fixed_width(dtype)
+                         ? transpose_fixed_width(input, stream, mr)
+                         : cudf::detail::interleave_columns(input, stream, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
@@ -242,7 +242,7 @@ struct dispatch_unary_cast_to {
 
     mutable_column_view output_mutable = *output;
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<SourceT>(),
                       input.end<SourceT>(),
                       output_mutable.begin<TargetT>(),
@@ -272,7 +272,7 @@ struct dispatch_unary_cast_to {
     using DeviceT    = device_storage_type_t<SourceT>;
     auto const scale = numeric::scale_type{input.type().scale()};
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<DeviceT>(),
                       input.end<DeviceT>(),
                       output_mutable.begin<TargetT>(),
@@ -302,7 +302,7 @@ struct dispatch_unary_cast_to {
     using DeviceT    = device_storage_type_t<TargetT>;
     auto const scale = numeric::scale_type{type.scale()};
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<SourceT>(),
                       input.end<SourceT>(),
                       output_mutable.begin<DeviceT>(),
@@ -348,7 +348,7 @@ struct dispatch_unary_cast_to {
 
       mutable_column_view output_mutable = *output;
 
-      thrust::transform(rmm::exec_policy(stream),
+      thrust::transform(rmm::exec_policy_nosync(stream),
                         input.begin<SourceDeviceT>(),
                         input.end<SourceDeviceT>(),
                         output_mutable.begin<TargetDeviceT>(),
@@ -408,6 +408,59 @@ struct dispatch_unary_cast_from {
     CUDF_FAIL("Column type must be numeric or chrono or decimal32/64/128");
   }
 };
+/**
+ * @brief Casts the elements of a column in place to a type of the same size
+ */
+template <typename SourceT>
+struct dispatch_cast_in_place_to {
+  template <typename TargetT,
+            std::enable_if_t<is_supported_non_fixed_point_cast<SourceT, TargetT>() &&
+                             sizeof(SourceT) == sizeof(TargetT)>* = nullptr>
+  void operator()(mutable_column_view& input, rmm::cuda_stream_view stream)
+  {
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      input.begin<SourceT>(),
+                      input.end<SourceT>(),
+                      reinterpret_cast<TargetT*>(input.begin<SourceT>()),
+                      unary_cast<TargetT>{});
+  }
+
+  template <typename TargetT,
+            typename... Args,
+            std::enable_if_t<!(is_supported_non_fixed_point_cast<SourceT, TargetT>() &&
+                               sizeof(SourceT) == sizeof(TargetT))>* = nullptr>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported in-place cast");
+  }
+};
+
+struct dispatch_cast_in_place_from {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(mutable_column_view& input, data_type type, rmm::cuda_stream_view stream)
+  {
+    type_dispatcher(type, dispatch_cast_in_place_to<T>{}, input, stream);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_fixed_width<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported in-place cast");
+  }
+};
+
+/**
+ * @brief Returns true if a column of `from` can be cast to `to` in its own memory
+ *
+ * This mirrors `is_supported_non_fixed_point_cast` for types of the same size.
+ */
+bool is_in_place_cast(data_type from, data_type to)
+{
+  return is_fixed_width(from) && is_fixed_width(to) && size_of(from) == size_of(to) &&
+         !(is_fixed_point(from) || is_fixed_point(to)) &&
+         !(is_timestamp(from) && is_numeric(to)) && !(is_timestamp(to) && is_numeric(from));
+}
+
 }  // anonymous namespace
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -420,6 +473,25 @@ std::unique_ptr<column> cast(column_view const& input,
   return type_dispatcher(input.type(), detail::dispatch_unary_cast_from{input}, type, stream, mr);
 }
 
+std::unique_ptr<column> cast(std::unique_ptr<column>&& input,
+                             data_type type,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_fixed_width(type), "Unary cast type must be fixed-width.");
+  if (!is_in_place_cast(input->type(), type)) { return cast(input->view(), type, stream, mr); }
+  if (input->type() == type) { return std::move(input); }
+
+  auto view = input->mutable_view();
+  type_dispatcher(input->type(), dispatch_cast_in_place_from{}, view, type, stream);
+
+  auto const size       = input->size();
+  auto const null_count = input->null_count();
+  auto contents         = input->release();
+  return std::make_unique<column>(
+    type, size, std::move(*contents.data), std::move(*contents.null_mask), null_count);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -431,4 +503,13 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, stream, mr);
 }
 
+std::unique_ptr<column> cast(std::unique_ptr<column>&& input,
+                             data_type type,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::cast(std::move(input), type, stream, mr);
+}
+
 }  // namespace cudf
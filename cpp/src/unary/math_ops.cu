@@ -22,14 +22,18 @@
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/iterator.cuh>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/transform.h>
 
 #include <cmath>
+#include <memory>
 #include <type_traits>
 
 namespace cudf {
@@ -306,7 +310,7 @@ std::unique_ptr<column> unary_op_with(column_view const& input,
     n *= 10;
   }
 
-  thrust::transform(rmm::exec_policy(stream),
+  thrust::transform(rmm::exec_policy_nosync(stream),
                     input.begin<Type>(),
                     input.end<Type>(),
                     out_view.begin<Type>(),
@@ -337,7 +341,8 @@ std::unique_ptr<cudf::column> transform_fn(InputIterator begin,
   if (size == 0) return output;
 
   auto output_view = output->mutable_view();
-  thrust::transform(rmm::exec_policy(stream), begin, end, output_view.begin<OutputType>(), UFN{});
+  thrust::transform(
+    rmm::exec_policy_nosync(stream), begin, end, output_view.begin<OutputType>(), UFN{});
   output->set_null_count(null_count);
   return output;
 }
@@ -559,6 +564,51 @@ struct FixedPointOpDispatcher {
   }
 };
 
+template <typename T>
+using is_boolean = std::is_same<T, bool>;
+
+/**
+ * @brief Applies a unary operation to the elements of a column in place
+ *
+ * @tparam UFN Device functor of the operation
+ * @tparam IsSupported Trait of the element types for which the operation returns the same type
+ */
+template <typename UFN, template <typename> typename IsSupported>
+struct transform_in_place_fn {
+  template <typename T, std::enable_if_t<IsSupported<T>::value>* = nullptr>
+  void operator()(mutable_column_view& input, rmm::cuda_stream_view stream)
+  {
+    thrust::transform(
+      rmm::exec_policy_nosync(stream), input.begin<T>(), input.end<T>(), input.begin<T>(), UFN{});
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<!IsSupported<T>::value>* = nullptr>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported data type for in-place operation");
+  }
+};
+
+template <typename UFN, template <typename> typename IsSupported = std::is_arithmetic>
+void transform_in_place(mutable_column_view& input, rmm::cuda_stream_view stream)
+{
+  cudf::type_dispatcher(input.type(), transform_in_place_fn<UFN, IsSupported>{}, input, stream);
+}
+
+/**
+ * @brief Returns true if the result of `op` on a column of `type` has the same type
+ */
+bool is_in_place_supported(data_type type, cudf::unary_operator op)
+{
+  switch (op) {
+    case cudf::unary_operator::RINT:
+      return type.id() == type_id::FLOAT32 || type.id() == type_id::FLOAT64;
+    case cudf::unary_operator::BIT_INVERT: return cudf::is_integral(type);
+    case cudf::unary_operator::NOT: return type.id() == type_id::BOOL8;
+    default: return cudf::is_numeric(type);
+  }
+}
+
 }  // namespace
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -643,6 +693,48 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   }
 }
 
+std::unique_ptr<cudf::column> unary_operation(std::unique_ptr<cudf::column>&& input,
+                                              cudf::unary_operator op,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  if (!is_in_place_supported(input->type(), op)) {
+    return unary_operation(input->view(), op, stream, mr);
+  }
+
+  auto view = input->mutable_view();
+  // clang-format off
+  switch (op) {
+    case cudf::unary_operator::SIN:     transform_in_place<DeviceSin>(view, stream); break;
+    case cudf::unary_operator::COS:     transform_in_place<DeviceCos>(view, stream); break;
+    case cudf::unary_operator::TAN:     transform_in_place<DeviceTan>(view, stream); break;
+    case cudf::unary_operator::ARCSIN:  transform_in_place<DeviceArcSin>(view, stream); break;
+    case cudf::unary_operator::ARCCOS:  transform_in_place<DeviceArcCos>(view, stream); break;
+    case cudf::unary_operator::ARCTAN:  transform_in_place<DeviceArcTan>(view, stream); break;
+    case cudf::unary_operator::SINH:    transform_in_place<DeviceSinH>(view, stream); break;
+    case cudf::unary_operator::COSH:    transform_in_place<DeviceCosH>(view, stream); break;
+    case cudf::unary_operator::TANH:    transform_in_place<DeviceTanH>(view, stream); break;
+    case cudf::unary_operator::ARCSINH: transform_in_place<DeviceArcSinH>(view, stream); break;
+    case cudf::unary_operator::ARCCOSH: transform_in_place<DeviceArcCosH>(view, stream); break;
+    case cudf::unary_operator::ARCTANH: transform_in_place<DeviceArcTanH>(view, stream); break;
+    case cudf::unary_operator::EXP:     transform_in_place<DeviceExp>(view, stream); break;
+    case cudf::unary_operator::LOG:     transform_in_place<DeviceLog>(view, stream); break;
+    case cudf::unary_operator::SQRT:    transform_in_place<DeviceSqrt>(view, stream); break;
+    case cudf::unary_operator::CBRT:    transform_in_place<DeviceCbrt>(view, stream); break;
+    case cudf::unary_operator::CEIL:    transform_in_place<DeviceCeil>(view, stream); break;
+    case cudf::unary_operator::FLOOR:   transform_in_place<DeviceFloor>(view, stream); break;
+    case cudf::unary_operator::ABS:     transform_in_place<DeviceAbs>(view, stream); break;
+    case cudf::unary_operator::RINT:    transform_in_place<DeviceRInt>(view, stream); break;
+    case cudf::unary_operator::BIT_INVERT:
+      transform_in_place<DeviceInvert, std::is_integral>(view, stream); break;
+    case cudf::unary_operator::NOT:
+      transform_in_place<DeviceNot, is_boolean>(view, stream); break;
+    default: CUDF_FAIL("Undefined unary operation");
+  }
+  // clang-format on
+  return std::move(input);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -654,4 +746,13 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, stream, mr);
 }
 
+std::unique_ptr<cudf::column> unary_operation(std::unique_ptr<cudf::column>&& input,
+                                              cudf::unary_operator op,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unary_operation(std::move(input), op, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/host_spill.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+std::size_t table_size_bytes(table_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.num_rows() == 0) { return 0; }
+  auto const mr         = rmm::mr::get_current_device_resource();
+  auto const row_bits   = cudf::detail::row_bit_count(input, stream, mr);
+  auto const total_bits = cudf::reduction::detail::reduce(
+    row_bits->view(),
+    *make_sum_aggregation<reduce_aggregation>(),
+    data_type{type_id::INT64},
+    std::nullopt,
+    stream,
+    mr);
+  return static_cast<std::size_t>(
+           static_cast<numeric_scalar<int64_t> const*>(total_bits.get())->value(stream)) /
+         8;
+}
+
+host_spilled_table spill_to_host(table_view const& input, rmm::cuda_stream_view stream)
+{
+  auto packed = cudf::detail::pack(input, stream, rmm::mr::get_current_device_resource());
+  host_spilled_table spilled{std::move(packed.metadata),
+                             cudf::detail::pinned_host_vector<uint8_t>(packed.gpu_data->size()),
+                             input.num_rows()};
+  CUDF_CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                                packed.gpu_data->data(),
+                                packed.gpu_data->size(),
+                                cudaMemcpyDefault,
+                                stream.value()));
+  return spilled;
+}
+
+std::unique_ptr<table> unspill_from_host(host_span<host_spilled_table const> pieces,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  std::vector<rmm::device_buffer> buffers;
+  std::vector<table_view> views;
+  buffers.reserve(pieces.size());
+  for (auto const& piece : pieces) {
+    buffers.emplace_back(piece.data.size(), stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(buffers.back().data(),
+                                  piece.data.data(),
+                                  piece.data.size(),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    views.push_back(
+      unpack(piece.metadata->data(), static_cast<uint8_t const*>(buffers.back().data())));
+  }
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
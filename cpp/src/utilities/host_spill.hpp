@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief The packed rows of a table, spilled to pinned host memory
+ */
+struct host_spilled_table {
+  std::unique_ptr<std::vector<uint8_t>> metadata;  ///< Metadata of the packed columns
+  cudf::detail::pinned_host_vector<uint8_t> data;  ///< Data of the packed columns
+  size_type num_rows;                              ///< Number of rows of the table
+};
+
+/**
+ * @brief Returns the total size in bytes of the rows of `input`
+ *
+ * @param input Table of the rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The size of the rows in bytes
+ */
+std::size_t table_size_bytes(table_view const& input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Packs the rows of `input` and copies them to pinned host memory
+ *
+ * @param input Table to spill
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The spilled rows
+ */
+host_spilled_table spill_to_host(table_view const& input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Copies spilled tables back to device memory and concatenates their rows
+ *
+ * @param pieces Spilled tables of the same columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows of all the pieces
+ */
+std::unique_ptr<table> unspill_from_host(host_span<host_spilled_table const> pieces,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
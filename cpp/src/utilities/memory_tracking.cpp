@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_tracking.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Memory used so far by the outermost tracked API call of a thread
+ */
+struct thread_memory_usage {
+  int depth{};              ///< Number of nested tracking scopes
+  char const* name{};       ///< Name of the outermost API function
+  int64_t current{};        ///< Bytes allocated minus bytes freed since the call started
+  int64_t peak{};           ///< Largest value of `current`
+  std::size_t allocated{};  ///< Total bytes allocated since the call started
+  std::size_t count{};      ///< Number of allocations since the call started
+  std::size_t syncs{};      ///< Number of host synchronizations since the call started
+};
+
+thread_local thread_memory_usage thread_usage;
+
+/**
+ * @brief Resource adaptor attributing allocations to the tracked API call of the allocating thread
+ */
+class memory_tracking_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit memory_tracking_resource(rmm::mr::device_memory_resource* upstream)
+    : upstream_{upstream}
+  {
+  }
+
+  [[nodiscard]] rmm::mr::device_memory_resource* get_upstream() const noexcept
+  {
+    return upstream_;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto ptr = upstream_->allocate(bytes, stream);
+    if (thread_usage.depth > 0) {
+      thread_usage.current += static_cast<int64_t>(bytes);
+      thread_usage.peak = std::max(thread_usage.peak, thread_usage.current);
+      thread_usage.allocated += bytes;
+      ++thread_usage.count;
+    }
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    upstream_->deallocate(ptr, bytes, stream);
+    if (thread_usage.depth > 0) { thread_usage.current -= static_cast<int64_t>(bytes); }
+  }
+
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+};
+
+/**
+ * @brief Tracking resources and collected records shared by all threads
+ */
+struct memory_tracking_state {
+  std::mutex mutex;
+  std::unique_ptr<memory_tracking_resource> resource;  ///< resource in use while enabled
+  // resources of earlier enable calls which may still own allocations
+  std::vector<std::unique_ptr<memory_tracking_resource>> retired;
+  std::vector<memory_usage_record> records;
+};
+
+memory_tracking_state& get_tracking_state()
+{
+  static memory_tracking_state state;
+  return state;
+}
+
+std::atomic<bool> tracking_enabled{false};
+
+}  // namespace
+
+void push_memory_tracking_scope(char const* name)
+{
+  if (thread_usage.depth++ > 0) { return; }
+  thread_usage.name      = name;
+  thread_usage.current   = 0;
+  thread_usage.peak      = 0;
+  thread_usage.allocated = 0;
+  thread_usage.count     = 0;
+  thread_usage.syncs     = 0;
+}
+
+void record_synchronization()
+{
+  if (thread_usage.depth > 0) { ++thread_usage.syncs; }
+}
+
+void pop_memory_tracking_scope()
+{
+  if (--thread_usage.depth > 0) { return; }
+  auto const retained = std::max(thread_usage.current, int64_t{0});
+  memory_usage_record record{thread_usage.name,
+                             static_cast<std::size_t>(thread_usage.peak),
+                             thread_usage.allocated,
+                             thread_usage.count,
+                             static_cast<std::size_t>(retained),
+                             thread_usage.syncs};
+
+  auto const payload = static_cast<uint64_t>(record.peak_bytes);
+  ::nvtx3::mark_in<libcudf_domain>(
+    ::nvtx3::event_attributes{::nvtx3::message{thread_usage.name}, ::nvtx3::payload{payload}});
+
+  auto& state = get_tracking_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.records.push_back(std::move(record));
+}
+
+}  // namespace detail
+
+void enable_memory_tracking()
+{
+  auto& state = detail::get_tracking_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  CUDF_EXPECTS(state.resource == nullptr, "Memory tracking is already enabled");
+  state.resource =
+    std::make_unique<detail::memory_tracking_resource>(rmm::mr::get_current_device_resource());
+  rmm::mr::set_current_device_resource(state.resource.get());
+  detail::tracking_enabled = true;
+}
+
+void disable_memory_tracking()
+{
+  auto& state = detail::get_tracking_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.resource == nullptr) { return; }
+  CUDF_EXPECTS(rmm::mr::get_current_device_resource() == state.resource.get(),
+               "The current device resource was changed while memory tracking was enabled");
+  detail::tracking_enabled = false;
+  rmm::mr::set_current_device_resource(state.resource->get_upstream());
+  state.retired.push_back(std::move(state.resource));
+}
+
+bool is_memory_tracking_enabled()
+{
+  return detail::tracking_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<memory_usage_record> get_memory_usage_records()
+{
+  auto& state = detail::get_tracking_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.records;
+}
+
+void clear_memory_usage_records()
+{
+  auto& state = detail::get_tracking_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.records.clear();
+}
+
+}  // namespace cudf
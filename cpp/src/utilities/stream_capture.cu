@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf::detail {
+namespace {
+
+/// Number of bytes copied by each launch of `copy_by_value_kernel`
+constexpr std::size_t by_value_chunk_bytes = 2048;
+
+/// Largest staging buffer copied by `copy_by_value_kernel` launches outside of a stream capture
+constexpr std::size_t max_by_value_copy_bytes = 8 * by_value_chunk_bytes;
+
+/// Bytes passed by value to `copy_by_value_kernel`
+struct by_value_chunk {
+  char bytes[by_value_chunk_bytes];
+};
+
+CUDF_KERNEL void copy_by_value_kernel(by_value_chunk const chunk, std::size_t size, char* dst)
+{
+  for (auto idx = static_cast<std::size_t>(threadIdx.x); idx < size; idx += blockDim.x) {
+    dst[idx] = chunk.bytes[idx];
+  }
+}
+
+}  // namespace
+
+bool is_stream_capturing(rmm::cuda_stream_view stream)
+{
+  cudaStreamCaptureStatus status;
+  CUDF_CUDA_TRY(cudaStreamIsCapturing(stream.value(), &status));
+  return status == cudaStreamCaptureStatusActive;
+}
+
+void copy_staging_buffer_to_device(void* dst,
+                                   void const* src,
+                                   std::size_t size,
+                                   rmm::cuda_stream_view stream)
+{
+  if (size == 0) { return; }
+  // Small buffers, such as the device views of the columns of most tables, are cheaper to pass
+  // to a few kernels than to copy to the device and then wait for all the work on the stream
+  if (size > max_by_value_copy_bytes and not is_stream_capturing(stream)) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDefault, stream.value()));
+    stream.synchronize();
+    record_synchronization();
+    return;
+  }
+
+  // kernel parameters are copied when the kernel is launched, or into the graph when the launch
+  // is captured, so `src` is not read afterwards
+  auto const d_dst = static_cast<char*>(dst);
+  auto const h_src = static_cast<char const*>(src);
+  for (std::size_t offset = 0; offset < size; offset += by_value_chunk_bytes) {
+    auto const bytes = std::min(by_value_chunk_bytes, size - offset);
+    by_value_chunk chunk;
+    std::memcpy(chunk.bytes, h_src + offset, bytes);
+    copy_by_value_kernel<<<1, 256, 0, stream.value()>>>(chunk, bytes, d_dst + offset);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+}
+
+}  // namespace cudf::detail
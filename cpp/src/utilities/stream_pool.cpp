@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -194,4 +195,14 @@ void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stre
   });
 }
 
+std::size_t operator_stream_count()
+{
+  static std::size_t const count = [] {
+    auto const env = getenv("LIBCUDF_OPERATOR_STREAMS");
+    if (env == nullptr) { return std::size_t{1}; }
+    return std::clamp<std::size_t>(std::strtoul(env, nullptr, 10), 1, STREAM_POOL_SIZE);
+  }();
+  return count;
+}
+
 }  // namespace cudf::detail
@@ -21,9 +21,11 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
@@ -32,8 +34,10 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
@@ -584,6 +588,149 @@ TEST_F(TransformTest, StringScalarComparison)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringPredicates)
+{
+  auto validity = std::vector<bool>{true, true, true, true, false, true};
+  auto c_0      = cudf::test::strings_column_wrapper(
+    {"apple", "application", "", "snapple", "app", "ap"}, validity.begin());
+  auto table = cudf::table_view{{c_0}};
+
+  auto literal_value = cudf::string_scalar("app");
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref_0     = cudf::ast::column_reference(0);
+
+  auto starts_with =
+    cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, literal);
+  auto expected_starts =
+    column_wrapper<bool>({true, true, false, false, false, false}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_starts, cudf::compute_column(table, starts_with)->view(), verbosity);
+
+  auto ends_with = cudf::ast::operation(cudf::ast::ast_operator::ENDS_WITH, col_ref_0, literal);
+  auto expected_ends =
+    column_wrapper<bool>({false, false, false, false, false, false}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_ends, cudf::compute_column(table, ends_with)->view(), verbosity);
+
+  auto contains = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, literal);
+  auto expected_contains =
+    column_wrapper<bool>({true, true, false, true, false, false}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_contains, cudf::compute_column(table, contains)->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLengthInPredicate)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "été", "abcd", "", "xyz"});
+  auto c_1   = column_wrapper<int32_t>{1, 2, 3, 4, 5};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  // lengths count characters rather than bytes
+  auto length   = cudf::ast::operation(cudf::ast::ast_operator::CHAR_LENGTH, col_ref_0);
+  auto expected = column_wrapper<int32_t>{1, 3, 4, 0, 3};
+  auto result   = cudf::compute_column(table, length);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  // string and numeric conditions evaluate together in one expression
+  auto literal_value = cudf::string_scalar("a");
+  auto literal       = cudf::ast::literal(literal_value);
+  auto not_a         = cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, col_ref_0, literal);
+  auto longer        = cudf::ast::operation(cudf::ast::ast_operator::GREATER, length, col_ref_1);
+  auto expression    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, not_a, longer);
+  auto expected_pred = column_wrapper<bool>{false, true, true, false, false};
+  auto result_pred   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_pred, result_pred->view(), verbosity);
+
+  auto invalid = cudf::ast::operation(cudf::ast::ast_operator::CHAR_LENGTH, col_ref_1);
+  EXPECT_THROW(cudf::compute_column(table, invalid), cudf::logic_error);
+}
+
+TEST_F(TransformTest, IfElse)
+{
+  auto c_0   = column_wrapper<bool>{true, false, true, false};
+  auto c_1   = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto c_2   = column_wrapper<int32_t>{10, 20, 30, 40};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::IF_ELSE, col_ref_0, col_ref_1, col_ref_2);
+  auto expected = column_wrapper<int32_t>{1, 20, 3, 40};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected, cudf::compute_column(table, expression)->view(), verbosity);
+
+  // The selected value can feed further operations as an intermediate
+  auto nested          = cudf::ast::operation(cudf::ast::ast_operator::ADD, expression, col_ref_1);
+  auto expected_nested = column_wrapper<int32_t>{2, 22, 6, 44};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_nested, cudf::compute_column(table, nested)->view(), verbosity);
+
+  auto not_boolean =
+    cudf::ast::operation(cudf::ast::ast_operator::IF_ELSE, col_ref_1, col_ref_1, col_ref_2);
+  EXPECT_THROW(cudf::compute_column(table, not_boolean), cudf::logic_error);
+}
+
+TEST_F(TransformTest, IfElseNulls)
+{
+  auto c_0   = column_wrapper<bool>({true, false, true, false}, {true, true, false, true});
+  auto c_1   = column_wrapper<int32_t>({1, 2, 3, 4}, {false, true, true, true});
+  auto c_2   = column_wrapper<int32_t>{10, 20, 30, 40};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+
+  // A null condition selects the third operand, and a selected null stays null
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::IF_ELSE, col_ref_0, col_ref_1, col_ref_2);
+  auto expected = column_wrapper<int32_t>({0, 20, 30, 40}, {false, true, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected, cudf::compute_column(table, expression)->view(), verbosity);
+}
+
+TEST_F(TransformTest, IsIn)
+{
+  auto validity  = std::vector<bool>{true, true, true, true, false};
+  auto c_0       = column_wrapper<int32_t>({3, 8, 15, 42, 7}, validity.begin());
+  auto table     = cudf::table_view{{c_0}};
+  auto col_ref_0 = cudf::ast::column_reference(0);
+
+  auto small_values = cudf::list_scalar(column_wrapper<int32_t>{42, 3, 9});
+  auto small_set    = cudf::ast::literal(small_values);
+  auto small_is_in  = cudf::ast::operation(cudf::ast::ast_operator::IS_IN, col_ref_0, small_set);
+  auto expected_small = column_wrapper<bool>({true, false, false, true, false}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_small, cudf::compute_column(table, small_is_in)->view(), verbosity);
+
+  // Large sets are sorted by the parser and searched with a binary search
+  auto evens = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 58 - 2 * i; });
+  auto large_values = cudf::list_scalar(column_wrapper<int32_t>(evens, evens + 30));
+  auto large_set    = cudf::ast::literal(large_values);
+  auto large_is_in  = cudf::ast::operation(cudf::ast::ast_operator::IS_IN, col_ref_0, large_set);
+  auto expected_large = column_wrapper<bool>({false, true, false, true, false}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_large, cudf::compute_column(table, large_is_in)->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_large,
+    cudf::compute_column(table, large_is_in, cudf::ast_evaluation::INTERPRETED_MULTI_ROW)->view(),
+    verbosity);
+
+  // A set literal is only valid as the right operand of IS_IN
+  auto misplaced = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, small_set);
+  EXPECT_THROW(cudf::compute_column(table, misplaced), cudf::logic_error);
+  auto literal_value = cudf::numeric_scalar<int32_t>(42);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto not_a_set     = cudf::ast::operation(cudf::ast::ast_operator::IS_IN, col_ref_0, literal);
+  EXPECT_THROW(cudf::compute_column(table, not_a_set), cudf::logic_error);
+}
+
 TEST_F(TransformTest, NumericScalarComparison)
 {
   auto c_0   = column_wrapper<int32_t>{1, 12, 123, 23};
@@ -844,4 +991,156 @@ TEST_F(TransformTest, NullLogicalOr)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, JitMatchesInterpreter)
+{
+  auto a     = thrust::make_counting_iterator(0);
+  auto b     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto c_0   = column_wrapper<int32_t>(a, a + 2000);
+  auto c_1   = column_wrapper<int32_t>(b, b + 2000);
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto lower     = cudf::numeric_scalar<int32_t>(100);
+  auto upper     = cudf::numeric_scalar<int32_t>(1500);
+  auto lit_lower = cudf::ast::literal(lower);
+  auto lit_upper = cudf::ast::literal(upper);
+
+  // (c_0 > 100 AND c_0 * c_1 < 1500) OR c_1 == c_1
+  auto above    = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, lit_lower);
+  auto product  = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto below    = cudf::ast::operation(cudf::ast::ast_operator::LESS, product, lit_upper);
+  auto in_range = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above, below);
+  auto same     = cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, col_ref_1, col_ref_1);
+  auto expression_tree = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, in_range, same);
+
+  auto expected = cudf::compute_column(table, expression_tree);
+  auto result   = cudf::compute_column(table, expression_tree, cudf::ast_evaluation::JIT);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view(), verbosity);
+
+  // a different literal value reuses the same compiled kernel
+  lower.set_value(1000);
+  expected = cudf::compute_column(table, expression_tree);
+  result   = cudf::compute_column(table, expression_tree, cudf::ast_evaluation::JIT);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitFallsBackForNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {0, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {0, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto result   = cudf::compute_column(table, expression, cudf::ast_evaluation::JIT);
+  auto expected = column_wrapper<int32_t>{{0, 0, 0, 50}, {0, 0, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, CommonSubexpressions)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto lower_value = cudf::numeric_scalar<int64_t>(5);
+  auto upper_value = cudf::numeric_scalar<int64_t>(30);
+  auto lower       = cudf::ast::literal(lower_value);
+  auto upper       = cudf::ast::literal(upper_value);
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto col_ref_1   = cudf::ast::column_reference(1);
+
+  // CAST(c0 + c1) > 5 AND CAST(c0 + c1) < 30, with each repeated subtree built separately
+  auto sum_0      = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto sum_1      = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto cast_0     = cudf::ast::operation(cudf::ast::ast_operator::CAST_TO_INT64, sum_0);
+  auto cast_1     = cudf::ast::operation(cudf::ast::ast_operator::CAST_TO_INT64, sum_1);
+  auto above      = cudf::ast::operation(cudf::ast::ast_operator::GREATER, cast_0, lower);
+  auto below      = cudf::ast::operation(cudf::ast::ast_operator::LESS, cast_1, upper);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above, below);
+
+  auto const parser = cudf::ast::detail::expression_parser{
+    expression, table, false, cudf::get_default_stream(), rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.operators().size(), 5);
+  EXPECT_EQ(parser.device_expression_data.num_intermediates, 2);
+
+  auto expected = column_wrapper<bool>{true, true, true, false};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ConstantFolding)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0}};
+
+  auto two_value   = cudf::numeric_scalar<int32_t>(2);
+  auto three_value = cudf::numeric_scalar<int32_t>(3);
+  auto two         = cudf::ast::literal(two_value);
+  auto three       = cudf::ast::literal(three_value);
+  auto col_ref_0   = cudf::ast::column_reference(0);
+
+  // c0 + (2 * 3 - 2) only evaluates the addition per row
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, two, three);
+  auto difference = cudf::ast::operation(cudf::ast::ast_operator::SUB, product, two);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, difference);
+
+  auto const parser = cudf::ast::detail::expression_parser{
+    expression, table, true, cudf::get_default_stream(), rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.operators().size(), 1);
+  EXPECT_EQ(parser.device_expression_data.num_intermediates, 0);
+
+  auto expected = column_wrapper<int32_t>{{7, 24, 0, 54}, {1, 1, 0, 1}};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  // a folded null stays null
+  three_value.set_valid_async(false);
+  auto expected_nulls = column_wrapper<int32_t>{{0, 0, 0, 0}, {0, 0, 0, 0}};
+  auto result_nulls   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_nulls, result_nulls->view(), verbosity);
+
+  // an expression made only of literals is still evaluated per row
+  auto constant = cudf::ast::operation(cudf::ast::ast_operator::MUL, two, two);
+  auto expected_constant = column_wrapper<int32_t>{4, 4, 4, 4};
+  auto result_constant   = cudf::compute_column(table, constant);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_constant, result_constant->view(), verbosity);
+}
+
+TEST_F(TransformTest, MultiRowMatchesInterpreter)
+{
+  auto constexpr num_rows = 100'003;
+  auto values   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 997; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto c_0      = column_wrapper<int32_t>(values, values + num_rows, validity);
+  auto c_1      = column_wrapper<int32_t>(values, values + num_rows);
+  auto table    = cudf::table_view{{c_0, c_1}};
+
+  auto literal_value = cudf::numeric_scalar<int32_t>(42);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+
+  // (c0 + c1) * (c1 - 42) > c0 uses several intermediates per row
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto difference = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref_1, literal);
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, difference);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, product, col_ref_0);
+
+  auto expected = cudf::compute_column(table, expression);
+  auto result =
+    cudf::compute_column(table, expression, cudf::ast_evaluation::INTERPRETED_MULTI_ROW);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view(), verbosity);
+
+  auto sliced          = cudf::table_view{{cudf::slice(c_1, {0, 3}).front()}};
+  auto identity        = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, col_ref_0);
+  auto expected_sliced = column_wrapper<int32_t>{0, 1, 2};
+  auto result_sliced =
+    cudf::compute_column(sliced, identity, cudf::ast_evaluation::INTERPRETED_MULTI_ROW);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sliced, result_sliced->view(), verbosity);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -33,7 +33,9 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <limits>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 template <typename T>
 auto lhs_random_column(cudf::size_type size)
@@ -818,4 +820,77 @@ TEST_F(BinaryOperationCompiledTest_NullOpsString, NullMin_Vector_Vector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
 }
 
+struct BinaryOperationCompiledTest_Dictionary : public cudf::test::BaseFixture {};
+
+TEST_F(BinaryOperationCompiledTest_Dictionary, ScalarOperand)
+{
+  std::vector<int32_t> h_values{5, 1, 5, 3, 1, 9};
+  std::vector<bool> validity{1, 1, 0, 1, 1, 1};
+  cudf::test::dictionary_column_wrapper<int32_t> lhs(
+    h_values.begin(), h_values.end(), validity.begin());
+  cudf::test::fixed_width_column_wrapper<int32_t> decoded(
+    h_values.begin(), h_values.end(), validity.begin());
+  auto const rhs = cudf::numeric_scalar<int32_t>(3);
+
+  auto const bool8 = cudf::data_type{cudf::type_id::BOOL8};
+  auto const int32 = cudf::data_type{cudf::type_id::INT32};
+  for (auto const op : {cudf::binary_operator::EQUAL, cudf::binary_operator::LESS}) {
+    auto const expected = cudf::binary_operation(decoded, rhs, op, bool8);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *cudf::binary_operation(lhs, rhs, op, bool8));
+    auto const reversed = cudf::binary_operation(rhs, decoded, op, bool8);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*reversed, *cudf::binary_operation(rhs, lhs, op, bool8));
+  }
+  auto const expected = cudf::binary_operation(decoded, rhs, cudf::binary_operator::ADD, int32);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *expected, *cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, int32));
+
+  auto const null_rhs = cudf::numeric_scalar<int32_t>(3, false);
+  auto const result   = cudf::binary_operation(lhs, null_rhs, cudf::binary_operator::EQUAL, bool8);
+  EXPECT_EQ(result->null_count(), result->size());
+
+  auto const empty = cudf::test::dictionary_column_wrapper<int32_t>{};
+  EXPECT_EQ(cudf::binary_operation(empty, rhs, cudf::binary_operator::EQUAL, bool8)->size(), 0);
+}
+
+struct BinaryOperationCompiledTest_Batched : public cudf::test::BaseFixture {};
+
+TEST_F(BinaryOperationCompiledTest_Batched, MatchesIndividualOperations)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, -2, 3, 4, 50, 6}, {1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> b({7, 8, 9, -10, 11, 12});
+  cudf::test::fixed_width_column_wrapper<double> c({0.5, -2.0, 3.5, 4.0, 5.5, 6.0});
+
+  auto const int32   = cudf::data_type{cudf::type_id::INT32};
+  auto const int64   = cudf::data_type{cudf::type_id::INT64};
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const bool8   = cudf::data_type{cudf::type_id::BOOL8};
+  std::vector<cudf::binary_operation_spec> const operations{
+    {a, b, cudf::binary_operator::ADD, int32},
+    {a, b, cudf::binary_operator::MUL, int64},
+    {b, c, cudf::binary_operator::ADD, float64},
+    {a, c, cudf::binary_operator::LESS, bool8},
+    {a, b, cudf::binary_operator::EQUAL, bool8},
+    {a, b, cudf::binary_operator::NULL_MAX, int32}};
+
+  auto const results = cudf::batched_binary_operation(operations);
+  ASSERT_EQ(results.size(), operations.size());
+  for (std::size_t i = 0; i < operations.size(); ++i) {
+    auto const& [lhs, rhs, op, output_type] = operations[i];
+    auto const expected = cudf::binary_operation(lhs, rhs, op, output_type);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *results[i]);
+  }
+}
+
+TEST_F(BinaryOperationCompiledTest_Batched, MismatchedSizes)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> b({4, 5});
+  auto const int32 = cudf::data_type{cudf::type_id::INT32};
+  std::vector<cudf::binary_operation_spec> const operations{
+    {a, a, cudf::binary_operator::ADD, int32}, {b, b, cudf::binary_operator::ADD, int32}};
+
+  EXPECT_THROW(cudf::batched_binary_operation(operations), std::invalid_argument);
+  EXPECT_TRUE(cudf::batched_binary_operation({}).empty());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
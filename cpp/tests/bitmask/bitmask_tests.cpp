@@ -754,4 +754,56 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+TEST_F(MergeBitmaskTest, TestBitmaskAndRepeatedAndAllValidMasks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const col({0, 1, 2, 3, 4}, {0, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> const valid_col({0, 1, 2, 3, 4},
+                                                                  {1, 1, 1, 1, 1});
+  ASSERT_TRUE(static_cast<cudf::column_view>(valid_col).nullable());
+
+  auto const input = cudf::table_view({col, valid_col, col});
+  auto [result_mask, result_null_count] = cudf::bitmask_and(input);
+  EXPECT_EQ(result_null_count, 2);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(result_mask.data(),
+                                 static_cast<cudf::column_view>(col).null_mask(),
+                                 cudf::num_bitmask_words(input.num_rows()));
+
+  auto const sliced       = cudf::slice(col, {1, 5}).front();
+  auto const sliced_input = cudf::table_view({sliced, sliced});
+  auto [sliced_mask, sliced_null_count] = cudf::bitmask_and(sliced_input);
+  EXPECT_EQ(sliced_null_count, 1);
+  auto const expected_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+  auto const expected = std::get<0>(
+    cudf::test::detail::make_null_mask(expected_valid, expected_valid + sliced.size()));
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    sliced_mask.data(), expected.data(), cudf::num_bitmask_words(sliced.size()));
+
+  auto const valid_input = cudf::table_view({valid_col, valid_col});
+  auto [valid_mask, valid_null_count] = cudf::bitmask_and(valid_input);
+  EXPECT_EQ(valid_null_count, 0);
+  EXPECT_NE(nullptr, valid_mask.data());
+  EXPECT_EQ(0, cudf::null_count(static_cast<cudf::bitmask_type const*>(valid_mask.data()), 0, 5));
+}
+
+TEST_F(MergeBitmaskTest, TestBitmaskOrWithAllValidMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const col({0, 1, 2, 3, 4}, {0, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> const valid_col({0, 1, 2, 3, 4},
+                                                                  {1, 1, 1, 1, 1});
+
+  auto const input = cudf::table_view({col, valid_col});
+  auto [result_mask, result_null_count] = cudf::bitmask_or(input);
+  EXPECT_EQ(result_null_count, 0);
+  EXPECT_NE(nullptr, result_mask.data());
+  EXPECT_EQ(0, cudf::null_count(static_cast<cudf::bitmask_type const*>(result_mask.data()), 0, 5));
+
+  auto const repeated_input = cudf::table_view({col, col});
+  auto [repeated_mask, repeated_null_count] = cudf::bitmask_or(repeated_input);
+  EXPECT_EQ(repeated_null_count, 2);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(repeated_mask.data(),
+                                 static_cast<cudf::column_view>(col).null_mask(),
+                                 cudf::num_bitmask_words(repeated_input.num_rows()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -187,6 +187,28 @@ TEST_F(StringColumnTest, ConcatenateManyColumns)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateManyLargeSlices)
+{
+  // strings long enough that the chars are copied with memcpy rather than the fused kernel
+  std::string const big_str(500000, 'a');
+  std::string const other_str(300000, 'b');
+  std::vector<std::string> const h_strings{big_str, other_str, "", big_str, other_str};
+  cudf::test::strings_column_wrapper input(h_strings.begin(), h_strings.end());
+
+  std::vector<cudf::column_view> input_cols;
+  std::vector<std::string> expected_strings;
+  for (int i = 0; i < 50; ++i) {
+    auto const begin = i % 3;
+    input_cols.push_back(cudf::slice(input, {begin, begin + 2}).front());
+    expected_strings.insert(
+      expected_strings.end(), h_strings.begin() + begin, h_strings.begin() + begin + 2);
+  }
+  cudf::test::strings_column_wrapper expected(expected_strings.begin(), expected_strings.end());
+
+  auto results = cudf::concatenate(input_cols);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringColumnTest, ConcatenateTooLarge)
 {
   if (cudf::strings::detail::is_large_strings_enabled()) { return; }
@@ -28,6 +28,9 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <stdexcept>
+#include <vector>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {};
 
@@ -243,3 +246,65 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, InBoundsMapPolicy)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto reversed = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return source_size - 1 - i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(
+    data, data + source_size, validity);
+  cudf::test::strings_column_wrapper strings_column({"a", "bb", "", "dddd"}, {1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed, reversed + source_size);
+  cudf::test::fixed_width_column_wrapper<int32_t> strings_map{3, 0, 1, 1, 2};
+
+  auto const expected = cudf::gather(cudf::table_view{{source_column}}, gather_map);
+  auto const result   = cudf::gather(
+    cudf::table_view{{source_column}}, gather_map, cudf::gather_map_policy::IN_BOUNDS);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+
+  auto const expected_strings = cudf::gather(cudf::table_view{{strings_column}}, strings_map);
+  auto const result_strings   = cudf::gather(
+    cudf::table_view{{strings_column}}, strings_map, cudf::gather_map_policy::IN_BOUNDS);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_strings->view(), result_strings->view());
+}
+
+struct BatchedGatherTest : public cudf::test::BaseFixture {};
+
+TEST_F(BatchedGatherTest, MatchesPerTableGather)
+{
+  using strings = cudf::test::strings_column_wrapper;
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, 3.5, 4.5, 5.5});
+  strings names({"a", "", "ccc", "dddd", "e"}, {1, 1, 0, 1, 1});
+  cudf::test::lists_column_wrapper<int32_t> lists{{1}, {2, 3}, {}, {4}, {5, 6}};
+  strings tags({"x", "yy", "zzz", "w", "vv"});
+
+  auto const left  = cudf::table_view{{ints, names, lists}};
+  auto const right = cudf::table_view{{doubles, tags}};
+  std::vector<cudf::table_view> const sources{left, right};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{4, -1, 0, 2, 2, 7};
+  auto const results =
+    cudf::batched_gather(sources, gather_map, cudf::out_of_bounds_policy::NULLIFY);
+
+  ASSERT_EQ(results.size(), sources.size());
+  for (std::size_t i = 0; i < sources.size(); ++i) {
+    auto const expected =
+      cudf::gather(sources[i], gather_map, cudf::out_of_bounds_policy::NULLIFY);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), results[i]->view());
+  }
+}
+
+TEST_F(BatchedGatherTest, MismatchedRows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> b{1, 2};
+  std::vector<cudf::table_view> const sources{cudf::table_view{{a}}, cudf::table_view{{b}}};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{0, 1};
+  EXPECT_THROW(cudf::batched_gather(sources, gather_map), std::invalid_argument);
+}
@@ -19,6 +19,13 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/contiguous_split.hpp>
+#include <cudf/io/types.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <stdexcept>
+#include <string>
 
 struct PackUnpackTest : public cudf::test::BaseFixture {
   void run_test(cudf::table_view const& t)
@@ -540,3 +547,33 @@ TEST_F(PackUnpackTest, SlicedEmpty)
   auto sliced = cudf::split(t, {0});
   this->run_test(sliced[0]);
 }
+
+TEST_F(PackUnpackTest, CompressedRoundTrip)
+{
+  auto constexpr num_rows = 100000;
+  auto const iter         = thrust::make_counting_iterator(0);
+  auto const mod          = thrust::make_transform_iterator(iter, [](auto i) { return i % 10; });
+  auto const to_string    = [](auto i) { return std::to_string(i % 100); };
+  auto const strings      = thrust::make_transform_iterator(iter, to_string);
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(mod, mod + num_rows, mod);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows);
+  cudf::table_view t({col1, col2});
+
+  auto const packed = cudf::pack(t);
+  for (auto const compression : {cudf::io::compression_type::LZ4,
+                                 cudf::io::compression_type::SNAPPY,
+                                 cudf::io::compression_type::ZSTD}) {
+    auto const compressed = cudf::compress_packed(packed, compression);
+    EXPECT_LT(compressed.gpu_data->size(), packed.gpu_data->size());
+    EXPECT_THROW(cudf::unpack(compressed), std::invalid_argument);
+    EXPECT_THROW(cudf::compress_packed(compressed, compression), std::invalid_argument);
+
+    auto const decompressed = cudf::decompress_packed(compressed);
+    EXPECT_EQ(*packed.metadata, *decompressed.metadata);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(t, cudf::unpack(decompressed));
+  }
+
+  EXPECT_THROW(cudf::decompress_packed(packed), std::invalid_argument);
+  EXPECT_THROW(cudf::compress_packed(packed, cudf::io::compression_type::GZIP),
+               std::invalid_argument);
+}
@@ -24,9 +24,12 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <tuple>
+
 struct SampleTest : public cudf::test::BaseFixture {};
 
 TEST_F(SampleTest, FailCaseRowMultipleSampling)
@@ -110,3 +113,43 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, SparseSampleIsDistinct)
+{
+  cudf::size_type const num_rows  = 100'000;
+  cudf::size_type const n_samples = 500;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + num_rows);
+  cudf::table_view input({col1});
+
+  auto out_table = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  EXPECT_EQ(out_table->num_rows(), n_samples);
+  auto distinct = cudf::distinct_count(
+    out_table->view().column(0), cudf::null_policy::INCLUDE, cudf::nan_policy::NAN_IS_VALID);
+  EXPECT_EQ(distinct, n_samples);
+}
+
+TEST_F(SampleTest, SegmentedSample)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 4, 4, 5, 9};
+  cudf::table_view input({col1});
+
+  auto [result, result_offsets] =
+    cudf::segmented_sample(input, offsets, 2, cudf::sample_with_replacement::FALSE, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<int32_t>{0, 2, 2, 3, 5},
+                                 result_offsets->view());
+  // one row from each half of the first and last segments, and all of the single-row segment
+  auto const host = cudf::test::to_host<int32_t>(result->view().column(0)).first;
+  ASSERT_EQ(host.size(), 5u);
+  EXPECT_TRUE(host[0] == 1 || host[0] == 2);
+  EXPECT_TRUE(host[1] == 3 || host[1] == 4);
+  EXPECT_EQ(host[2], 5);
+  EXPECT_TRUE(host[3] == 6 || host[3] == 7);
+  EXPECT_TRUE(host[4] == 8 || host[4] == 9);
+
+  std::tie(result, result_offsets) =
+    cudf::segmented_sample(input, offsets, 3, cudf::sample_with_replacement::TRUE, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<int32_t>{0, 3, 3, 6, 9},
+                                 result_offsets->view());
+}
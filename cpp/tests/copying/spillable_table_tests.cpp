@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/spillable_table.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+struct SpillableTableTest : public cudf::test::BaseFixture {
+  std::unique_ptr<cudf::table> make_table(int32_t first)
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> ints{{first, first + 1, first + 2, first + 3},
+                                                         {1, 0, 1, 1}};
+    cudf::test::strings_column_wrapper strings{{"a", "", "bcd", "efgh"}, {1, 1, 0, 1}};
+    return std::make_unique<cudf::table>(cudf::table_view{{ints, strings}});
+  }
+};
+
+TEST_F(SpillableTableTest, SpillAndPin)
+{
+  auto const expected = make_table(0);
+  cudf::spillable_table table(expected->view());
+  EXPECT_FALSE(table.is_spilled());
+  EXPECT_GT(table.size_bytes(), std::size_t{0});
+
+  EXPECT_EQ(table.spill(), table.size_bytes());
+  EXPECT_TRUE(table.is_spilled());
+  EXPECT_EQ(table.spill(), std::size_t{0});
+
+  {
+    auto const pinned = table.pin();
+    EXPECT_FALSE(table.is_spilled());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), pinned.view());
+
+    // the viewed device memory is kept while the table is pinned
+    EXPECT_EQ(table.spill(), std::size_t{0});
+    EXPECT_FALSE(table.is_spilled());
+  }
+
+  EXPECT_EQ(table.spill(), table.size_bytes());
+  auto const packed = table.release();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), cudf::unpack(packed));
+  EXPECT_EQ(table.size_bytes(), std::size_t{0});
+}
+
+TEST_F(SpillableTableTest, ReleasePinnedTable)
+{
+  auto const expected = make_table(0);
+  cudf::spillable_table table(cudf::pack(expected->view()));
+
+  auto const pinned = table.pin();
+  EXPECT_THROW(std::ignore = table.release(), cudf::logic_error);
+}
+
+TEST_F(SpillableTableTest, CompressedInput)
+{
+  auto const expected = make_table(0);
+  auto compressed =
+    cudf::compress_packed(cudf::pack(expected->view()), cudf::io::compression_type::SNAPPY);
+  EXPECT_THROW(cudf::spillable_table(std::move(compressed)), std::invalid_argument);
+}
+
+TEST_F(SpillableTableTest, ManagerSpillsLeastRecentlyUsed)
+{
+  cudf::spill_manager manager;
+  std::vector<std::unique_ptr<cudf::table>> expected;
+  std::vector<std::unique_ptr<cudf::spillable_table>> tables;
+  for (int32_t i = 0; i < 3; ++i) {
+    expected.push_back(make_table(i * 10));
+    tables.push_back(std::make_unique<cudf::spillable_table>(expected.back()->view(), &manager));
+  }
+
+  // pinning the first table makes the second the least recently used
+  std::ignore = tables[0]->pin();
+
+  EXPECT_EQ(manager.spill(1), tables[1]->size_bytes());
+  EXPECT_FALSE(tables[0]->is_spilled());
+  EXPECT_TRUE(tables[1]->is_spilled());
+  EXPECT_FALSE(tables[2]->is_spilled());
+
+  {
+    // pinned tables are not spilled
+    auto const pinned = tables[2]->pin();
+    EXPECT_TRUE(cudf::spill_manager::on_allocation_failure(1, &manager));
+    EXPECT_TRUE(tables[0]->is_spilled());
+    EXPECT_FALSE(tables[2]->is_spilled());
+    EXPECT_FALSE(cudf::spill_manager::on_allocation_failure(1, &manager));
+  }
+
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected[i]->view(), tables[i]->pin().view());
+  }
+
+  // a destroyed table is no longer spilled by the manager
+  tables.clear();
+  EXPECT_EQ(manager.spill(1), std::size_t{0});
+}
@@ -27,6 +27,7 @@
 #include <cudf/contiguous_split.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/filling.hpp>
 
 #include <rmm/device_buffer.hpp>
@@ -1618,6 +1619,33 @@ TEST_F(ContiguousSplitUntypedTest, ValidityRepartitionChunked)
   CUDF_TEST_EXPECT_TABLES_EQUAL(result[0].table, expected);
 }
 
+TEST_F(ContiguousSplitUntypedTest, ChunkedPackToHost)
+{
+  srand(0);
+  auto rvalids                   = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<float>(rand()) / static_cast<float>(RAND_MAX) < 0.5f ? 0 : 1;
+  });
+  cudf::size_type const num_rows = 2000000;
+  auto col                       = cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>{0});
+  auto [null_mask, null_count]   = cudf::test::detail::make_null_mask(rvalids, rvalids + num_rows);
+  col->set_null_mask(std::move(null_mask), null_count);
+  cudf::table_view t({*col});
+
+  // several 1MB chunks, so both bounce buffers are cycled
+  auto chunked_pack = cudf::chunked_pack::create(t, 1 * 1024 * 1024);
+  cudf::detail::pinned_host_vector<uint8_t> host_buff(chunked_pack->get_total_contiguous_size());
+  auto const bytes_copied =
+    chunked_pack->pack_to_host(cudf::host_span<uint8_t>(host_buff.data(), host_buff.size()));
+  EXPECT_EQ(host_buff.size(), bytes_copied);
+  EXPECT_FALSE(chunked_pack->has_next());
+
+  auto device_buff = std::make_unique<rmm::device_buffer>(
+    host_buff.data(), host_buff.size(), cudf::get_default_stream());
+  auto const from_host =
+    cudf::packed_columns(chunked_pack->build_metadata(), std::move(device_buff));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, cudf::unpack(from_host));
+}
+
 TEST_F(ContiguousSplitUntypedTest, ValidityEdgeCase)
 {
   // tests an edge case where the splits cause the final validity data to be copied
@@ -24,13 +24,19 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/detail/timezone.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/timezone.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #include <thrust/transform.h>
 
+#include <filesystem>
+
 #define XXX false  // stub for null values
 
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
@@ -323,6 +329,55 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), expected_seconds);
 }
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingMultipleDatetimeComponents)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop  = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop));
+
+  std::vector<datetime_component> const components{datetime_component::NANOSECOND,
+                                                   datetime_component::YEAR,
+                                                   datetime_component::WEEKDAY,
+                                                   datetime_component::HOUR,
+                                                   datetime_component::DAY,
+                                                   datetime_component::MILLISECOND,
+                                                   datetime_component::MONTH,
+                                                   datetime_component::SECOND,
+                                                   datetime_component::MINUTE,
+                                                   datetime_component::MICROSECOND,
+                                                   datetime_component::YEAR};
+  auto const result = extract_datetime_components(timestamps, components);
+  ASSERT_EQ(result->num_columns(), static_cast<cudf::size_type>(components.size()));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0), *extract_nanosecond_fraction(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(1), *extract_year(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(2), *extract_weekday(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(3), *extract_hour(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(4), *extract_day(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(5), *extract_millisecond_fraction(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(6), *extract_month(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(7), *extract_second(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(8), *extract_minute(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(9), *extract_microsecond_fraction(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(10), *extract_year(timestamps));
+
+  // Time-only components skip the calendar date
+  auto const times =
+    extract_datetime_components(timestamps, {datetime_component::HOUR, datetime_component::MINUTE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(times->get_column(0), *extract_hour(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(times->get_column(1), *extract_minute(timestamps));
+
+  EXPECT_EQ(extract_datetime_components(timestamps, {})->num_columns(), 0);
+  auto const ints = fixed_width_column_wrapper<int16_t>{1, 2};
+  EXPECT_THROW(extract_datetime_components(ints, components), cudf::logic_error);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
 {
   using namespace cudf::test;
@@ -1052,4 +1107,46 @@ TYPED_TEST(TypedDatetimeOpsTest, TestRoundDatetime)
                                  expected_nanosecond);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezoneUTC)
+{
+  using namespace cudf::test;
+  auto const timestamps =
+    fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{{1705320000123L, 0L},
+                                                                           {true, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::convert_timezone(timestamps, "UTC", ""), timestamps);
+
+  auto const days = fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{1, 2};
+  EXPECT_THROW(cudf::convert_timezone(days, "UTC", "UTC"), cudf::data_type_error);
+  auto const ints = fixed_width_column_wrapper<int64_t>{1, 2};
+  EXPECT_THROW(cudf::convert_timezone(ints, "UTC", "UTC"), cudf::data_type_error);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  if (not std::filesystem::exists("/usr/share/zoneinfo/America/New_York")) {
+    GTEST_SKIP() << "The system has no TZif file for America/New_York";
+  }
+
+  // Winter and summer times, an ambiguous time when clocks go back and a skipped time when
+  // clocks go forward
+  auto const local = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {1705320000L, 1721044800L, 1730597400L, 1710037800L, 0L}, {true, true, true, true, false}};
+  auto const utc = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {1705338000L, 1721059200L, 1730611800L, 1710055800L, 0L}, {true, true, true, true, false}};
+
+  auto const result = cudf::convert_timezone(local, "America/New_York", "UTC");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, utc);
+  auto const back = cudf::convert_timezone(utc, "UTC", "America/New_York");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(*back, {0, 3}).front(),
+                                 cudf::slice(local, {0, 3}).front());
+
+  // The transition table is read once and shared until the cache is cleared
+  auto const stream = cudf::get_default_stream();
+  auto const cached = cudf::detail::get_timezone_transition_table({}, "America/New_York", stream);
+  EXPECT_EQ(cached, cudf::detail::get_timezone_transition_table({}, "America/New_York", stream));
+  cudf::clear_timezone_transition_table_cache();
+  EXPECT_NE(cached, cudf::detail::get_timezone_transition_table({}, "America/New_York", stream));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -20,7 +20,10 @@
 
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 
+#include <stdexcept>
 #include <vector>
 
 struct DictionaryDecodeTest : public cudf::test::BaseFixture {};
@@ -67,3 +70,57 @@ TEST_F(DictionaryDecodeTest, EmptyColumn)
   EXPECT_EQ(output->size(), 0);
   EXPECT_EQ(output->type().id(), cudf::type_id::EMPTY);
 }
+
+TEST_F(DictionaryDecodeTest, TransformDistinct)
+{
+  cudf::test::strings_column_wrapper input({"AA", "bb", "Aa", "", "bb", "AA", "aa"},
+                                           {1, 1, 1, 0, 1, 1, 1});
+
+  auto calls    = 0;
+  auto to_lower = [&calls](cudf::column_view const& keys) {
+    ++calls;
+    EXPECT_EQ(keys.size(), 4);
+    return cudf::strings::to_lower(cudf::strings_column_view(keys));
+  };
+
+  cudf::test::strings_column_wrapper expected({"aa", "bb", "aa", "", "bb", "aa", "aa"},
+                                              {1, 1, 1, 0, 1, 1, 1});
+  auto results = cudf::dictionary::transform_distinct(input, to_lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  EXPECT_EQ(calls, 1);
+
+  results = cudf::dictionary::transform_distinct(input, to_lower, true);
+
+  auto const dictionary = cudf::dictionary_column_view(results->view());
+  EXPECT_EQ(dictionary.keys_size(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(dictionary), expected);
+
+  // a dictionary input is not encoded again
+  auto const encoded = cudf::dictionary::encode(input);
+  results            = cudf::dictionary::transform_distinct(encoded->view(), to_lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(DictionaryDecodeTest, TransformDistinctNullResults)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({3, 1, 2, 0, 3, 1}, {1, 1, 1, 0, 1, 1});
+
+  // keys are [1, 2, 3]
+  auto op = [](cudf::column_view const&) {
+    return cudf::test::fixed_width_column_wrapper<int32_t>({10, 0, 30}, {1, 0, 1}).release();
+  };
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({30, 10, 0, 0, 30, 10},
+                                                           {1, 1, 0, 0, 1, 1});
+  auto results = cudf::dictionary::transform_distinct(input, op);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::dictionary::transform_distinct(input, op, true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::dictionary::decode(cudf::dictionary_column_view(results->view())), expected);
+
+  auto bad_op = [](cudf::column_view const&) {
+    return cudf::test::fixed_width_column_wrapper<int32_t>({1}).release();
+  };
+  EXPECT_THROW(cudf::dictionary::transform_distinct(input, bad_op), std::invalid_argument);
+}
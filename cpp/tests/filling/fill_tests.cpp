@@ -21,6 +21,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -31,6 +32,8 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+
 auto all_valid   = [](cudf::size_type row) { return true; };
 auto odd_valid   = [](cudf::size_type row) { return row % 2 != 0; };
 auto all_invalid = [](cudf::size_type row) { return false; };
@@ -277,6 +280,56 @@ TEST_F(FillStringTestFixture, SetRangeNullCount)
   this->test(0, size, value, true, odd_valid);
 }
 
+class FillOffsetTestFixture : public cudf::test::BaseFixture {};
+
+TEST_F(FillOffsetTestFixture, InPlaceUnalignedRange)
+{
+  constexpr cudf::size_type size{200};
+  constexpr cudf::size_type offset{7};
+  constexpr cudf::size_type view_size{183};
+  constexpr cudf::size_type begin{20};
+  constexpr cudf::size_type end{150};
+
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i); });
+
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto column =
+    cudf::test::fixed_width_column_wrapper<int32_t>(values, values + size, validity).release();
+
+  // neither the view nor the filled range starts at a bitmask word boundary
+  auto const view_nulls = static_cast<cudf::size_type>(std::count_if(
+    validity + offset, validity + offset + view_size, [](bool valid) { return !valid; }));
+  auto target = cudf::mutable_column_view(column->type(),
+                                          view_size,
+                                          column->mutable_view().head(),
+                                          column->mutable_view().null_mask(),
+                                          view_nulls,
+                                          offset);
+
+  auto null_value = cudf::numeric_scalar<int32_t>(-1, false);
+  cudf::fill_in_place(target, begin, end, null_value);
+
+  auto const filled_validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return (i >= offset + begin && i < offset + end) ? false : i % 3 != 0;
+  });
+  auto const expected_nulls =
+    cudf::test::fixed_width_column_wrapper<int32_t>(values, values + size, filled_validity);
+  auto const expected_view = cudf::slice(expected_nulls, {offset, offset + view_size}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(target, expected_view);
+  EXPECT_EQ(target.null_count(), expected_view.null_count());
+
+  auto valid_value = cudf::numeric_scalar<int32_t>(5, true);
+  cudf::fill_in_place(target, 0, view_size, valid_value);
+
+  auto const fives = thrust::make_constant_iterator<int32_t>(5);
+  auto const expected_valid =
+    cudf::test::fixed_width_column_wrapper<int32_t>(fives, fives + view_size);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(target, expected_valid);
+  EXPECT_EQ(target.null_count(), 0);
+}
+
 class FillErrorTestFixture : public cudf::test::BaseFixture {};
 
 TEST_F(FillErrorTestFixture, InvalidInplaceCall)
@@ -21,6 +21,7 @@
 #include <cudf_test/random.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -256,6 +257,29 @@ TEST_F(RepeatStringTestFixture, ZeroSizeInput)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(p_ret->view().column(0), expected);
 }
 
+class RepeatNestedTestFixture : public cudf::test::BaseFixture {};
+
+TEST_F(RepeatNestedTestFixture, SlicedListsColumnCount)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+
+  auto const lists  = lcw{{1, 2}, {3}, {}, {4, 5, 6}, {7}};
+  auto const strs   = cudf::test::strings_column_wrapper{"a", "bb", "ccc", "dddd", "eeeee"};
+  auto const sliced = cudf::slice(cudf::table_view{{lists, strs}}, {1, 5}).front();
+
+  auto count = cudf::test::fixed_width_column_wrapper<cudf::size_type>{2, 0, 3, 1};
+
+  auto const expected_lists = lcw{{3}, {3}, {4, 5, 6}, {4, 5, 6}, {4, 5, 6}, {7}};
+  auto const expected_strs =
+    cudf::test::strings_column_wrapper{"bb", "bb", "dddd", "dddd", "dddd", "eeeee"};
+
+  auto p_ret = cudf::repeat(sliced, count);
+
+  EXPECT_EQ(p_ret->num_columns(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(p_ret->view().column(0), expected_lists);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(p_ret->view().column(1), expected_strs);
+}
+
 class RepeatErrorTestFixture : public cudf::test::BaseFixture {};
 
 TEST_F(RepeatErrorTestFixture, LengthMismatch)
@@ -29,6 +29,7 @@
 #include <limits>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 using namespace numeric;
@@ -582,4 +583,36 @@ TYPED_TEST(FixedPointTestAllReps, ExtremelyLargeNegativeScale)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected2, result2->view());
 }
 
+TEST_F(FixedPointTest, Decimal128DivisionAcross64BitRange)
+{
+  // Values fitting in 64 bits are divided with 64-bit arithmetic, the others with 128 bits
+  auto constexpr int64_min = std::numeric_limits<int64_t>::min();
+  auto constexpr int64_max = std::numeric_limits<int64_t>::max();
+  auto const wide          = static_cast<__int128_t>(int64_max) * 1000 + 7;
+
+  std::vector<std::pair<__int128_t, __int128_t>> const operands{{int64_max, 7},
+                                                                {-int64_max, 7},
+                                                                {int64_min, -1},
+                                                                {int64_min, 3},
+                                                                {wide, 1000},
+                                                                {wide, -wide},
+                                                                {-wide, int64_max},
+                                                                {-17, 5}};
+  for (auto const& [lhs, rhs] : operands) {
+    EXPECT_TRUE(numeric::detail::divide(lhs, rhs) == lhs / rhs);
+    EXPECT_TRUE(numeric::detail::remainder(lhs, rhs) == lhs % rhs);
+
+    decimal128 const a{scaled_integer<__int128_t>{lhs, scale_type{-2}}};
+    decimal128 const b{scaled_integer<__int128_t>{rhs, scale_type{-1}}};
+    EXPECT_TRUE((a / b).value() == lhs / rhs);
+    EXPECT_TRUE((a % b).value() == lhs % (rhs * 10));
+  }
+
+  // rescaling divides by a power of ten
+  decimal128 const c{scaled_integer<__int128_t>{wide, scale_type{-3}}};
+  EXPECT_TRUE(c.rescaled(scale_type{0}).value() == wide / 1000);
+  decimal128 const d{scaled_integer<__int128_t>{-int64_max, scale_type{-3}}};
+  EXPECT_TRUE(d.rescaled(scale_type{0}).value() == -int64_max / 1000);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
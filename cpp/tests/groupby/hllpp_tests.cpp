@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <stdexcept>
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64s_col = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+struct HllppTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+auto groupby_sketches(cudf::column_view const& keys,
+                      cudf::column_view const& values,
+                      std::unique_ptr<cudf::groupby_aggregation>&& agg)
+{
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+  auto gb_obj = cudf::groupby::groupby(cudf::table_view({keys}));
+  return std::move(gb_obj.aggregate(requests).second[0].results[0]);
+}
+
+int64_t estimate_of(cudf::list_scalar const& sketch)
+{
+  auto const sketches = cudf::make_lists_column(
+    1,
+    int32s_col{0, sketch.view().size()}.release(),
+    std::make_unique<cudf::column>(sketch.view()),
+    0,
+    {});
+  auto const estimate = cudf::estimate_distinct_count(cudf::lists_column_view{*sketches});
+  auto const host     = cudf::test::to_host<int64_t>(*estimate);
+  return host.first.front();
+}
+
+}  // namespace
+
+TEST_F(HllppTest, SmallCardinalityIsExact)
+{
+  // Linear counting regime: a handful of distinct values is counted exactly
+  auto const values = int32s_col{{5, 1, 5, 2, 3, 3, 0, 4}, {1, 1, 1, 1, 1, 1, 0, 1}};
+  auto const sketch = cudf::reduce(values,
+                                   *cudf::make_hllpp_aggregation<cudf::reduce_aggregation>(),
+                                   cudf::data_type{cudf::type_id::LIST});
+  EXPECT_EQ(estimate_of(static_cast<cudf::list_scalar const&>(*sketch)), 5);
+}
+
+TEST_F(HllppTest, LargeCardinalityWithinError)
+{
+  auto constexpr num_rows = 1'000'000;
+  // Every value appears twice
+  auto const iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 2; });
+  auto const values   = int32s_col(iter, iter + num_rows);
+  auto const sketch   = cudf::reduce(values,
+                                     *cudf::make_hllpp_aggregation<cudf::reduce_aggregation>(12),
+                                     cudf::data_type{cudf::type_id::LIST});
+  auto const estimate = estimate_of(static_cast<cudf::list_scalar const&>(*sketch));
+  // 4 standard errors of precision 12
+  EXPECT_NEAR(static_cast<double>(estimate), num_rows / 2, num_rows / 2 * 0.065);
+}
+
+TEST_F(HllppTest, GroupbyAndMerge)
+{
+  auto const keys   = int32s_col{0, 0, 0, 0, 1, 1, 1, 2};
+  auto const values = int32s_col{{7, 8, 7, 9, 1, 1, 1, 3}, {1, 1, 1, 1, 1, 1, 1, 0}};
+
+  auto const sketches =
+    groupby_sketches(keys, values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(10));
+  EXPECT_EQ(sketches->size(), 3);
+  EXPECT_EQ(cudf::lists_column_view{*sketches}.child().size(), 3 * 1024);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::estimate_distinct_count(cudf::lists_column_view{*sketches}), int64s_col{3, 1, 0});
+
+  // Merging the sketches of two partitions gives the sketch of the whole
+  auto const more_values   = int32s_col{10, 7, 2, 3};
+  auto const more_keys     = int32s_col{0, 0, 1, 2};
+  auto const more_sketches = groupby_sketches(
+    more_keys, more_values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(10));
+  auto const all_sketches =
+    cudf::concatenate(std::vector<cudf::column_view>{*sketches, *more_sketches});
+  auto const all_keys = int32s_col{0, 1, 2, 0, 1, 2};
+  auto const merged   = groupby_sketches(
+    all_keys, *all_sketches, cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>(10));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::estimate_distinct_count(cudf::lists_column_view{*merged}), int64s_col{4, 2, 1});
+
+  EXPECT_THROW(
+    groupby_sketches(
+      all_keys, *all_sketches, cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>(12)),
+    std::invalid_argument);
+}
+
+TEST_F(HllppTest, InvalidPrecision)
+{
+  EXPECT_THROW(cudf::make_hllpp_aggregation<cudf::reduce_aggregation>(3), std::invalid_argument);
+  EXPECT_THROW(cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>(19),
+               std::invalid_argument);
+}
@@ -17,12 +17,21 @@
 #include <tests/groupby/groupby_test_util.hpp>
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -358,6 +367,62 @@ TEST_F(groupby_dictionary_keys_test, basic)
                   force_use_sort_impl::YES);
 }
 
+TEST_F(groupby_dictionary_keys_test, null_keys_and_unused_keys)
+{
+  using K = std::string;
+  using V = int32_t;
+
+  // clang-format off
+  cudf::test::dictionary_column_wrapper<K> keys({ "c", "a", "b", "", "d", "a", "", "b"},
+                                                {  1,   1,   1,  0,   1,   1,  0,   1});
+  cudf::test::fixed_width_column_wrapper<V> vals{  0,   1,   2,  3,   4,   5,  6,   7};
+  // clang-format on
+  // The key "c" of the dictionary has no rows after slicing
+  auto const sliced_keys = cudf::slice(keys, {1, 8}).front();
+  auto const sliced_vals = cudf::slice(vals, {1, 8}).front();
+
+  auto const aggregate = [&](cudf::null_policy include_null_keys) {
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = sliced_vals;
+    requests[0].aggregations.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+    requests[0].aggregations.push_back(cudf::make_argmax_aggregation<cudf::groupby_aggregation>());
+    requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>(
+      cudf::null_policy::INCLUDE));
+    auto [result_keys, results] =
+      cudf::groupby::groupby(cudf::table_view{{sliced_keys}}, include_null_keys)
+        .aggregate(requests);
+    auto const decoded_keys = cudf::dictionary::decode(result_keys->get_column(0).view());
+    std::vector<cudf::column_view> columns{decoded_keys->view()};
+    for (auto const& result : results[0].results) {
+      columns.push_back(result->view());
+    }
+    return cudf::sort_by_key(cudf::table_view{columns}, cudf::table_view{{decoded_keys->view()}});
+  };
+
+  {
+    auto const results = aggregate(cudf::null_policy::EXCLUDE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                   cudf::test::strings_column_wrapper{"a", "b", "d"});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(1),
+                                        cudf::test::fixed_width_column_wrapper<V>{1, 2, 4});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      results->get_column(2), cudf::test::fixed_width_column_wrapper<cudf::size_type>{4, 6, 3});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      results->get_column(3), cudf::test::fixed_width_column_wrapper<cudf::size_type>{2, 2, 1});
+  }
+  {
+    // Nulls are sorted before the keys
+    auto const results = aggregate(cudf::null_policy::INCLUDE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                   cudf::test::strings_column_wrapper({"", "a", "b", "d"},
+                                                                      {0, 1, 1, 1}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(1),
+                                        cudf::test::fixed_width_column_wrapper<V>{3, 1, 2, 4});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      results->get_column(3), cudf::test::fixed_width_column_wrapper<cudf::size_type>{2, 2, 2, 1});
+  }
+}
+
 struct groupby_cache_test : public cudf::test::BaseFixture {};
 
 // To check if the cache doesn't insert multiple times to cache for the same aggregation on a
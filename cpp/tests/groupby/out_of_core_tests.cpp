@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct OutOfCoreGroupbyTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+std::vector<cudf::groupby::aggregation_request> make_requests(cudf::column_view const& values)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(2);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[1].values = values;
+  requests[1].aggregations.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+
+// Returns the keys and results of a groupby sorted by the keys
+std::unique_ptr<cudf::table> sorted_results(
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>> const&
+    results)
+{
+  auto const& [keys, aggregations] = results;
+  std::vector<cudf::column_view> columns(keys->view().begin(), keys->view().end());
+  for (auto const& aggregation : aggregations) {
+    for (auto const& result : aggregation.results) {
+      columns.push_back(result->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, keys->view());
+}
+
+}  // namespace
+
+TEST_F(OutOfCoreGroupbyTest, ManyBuckets)
+{
+  auto constexpr num_rows = 10'000;
+  auto const key_iter     = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 17) % 1'000); });
+  auto const name_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i % 3); });
+  auto const val_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const val_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> ids(key_iter, key_iter + num_rows);
+  cudf::test::strings_column_wrapper names(name_iter, name_iter + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> vals(val_iter, val_iter + num_rows, val_valid);
+  auto const keys = cudf::table_view{{ids, names}};
+
+  auto const requests = make_requests(vals);
+  cudf::groupby::groupby gb(keys);
+  auto const expected = sorted_results(gb.aggregate(requests));
+
+  // A budget of a small part of the rows aggregates them in many buckets
+  for (std::size_t const budget : {10'000UL, 100'000UL, 1UL << 30}) {
+    auto const results = sorted_results(gb.aggregate_out_of_core(requests, budget));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *results);
+  }
+}
+
+TEST_F(OutOfCoreGroupbyTest, NullKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ids({1, 2, 3, 1, 2, 0, 3, 0},
+                                                      {1, 1, 1, 1, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{1, 2, 3, 4, 5, 6, 7, 8};
+  auto const keys     = cudf::table_view{{ids}};
+  auto const requests = make_requests(vals);
+
+  for (auto const include_null_keys : {cudf::null_policy::EXCLUDE, cudf::null_policy::INCLUDE}) {
+    cudf::groupby::groupby gb(keys, include_null_keys);
+    auto const expected = sorted_results(gb.aggregate(requests));
+    auto const results  = sorted_results(gb.aggregate_out_of_core(requests, 8));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *results);
+  }
+
+  cudf::groupby::groupby gb(keys);
+  EXPECT_THROW(gb.aggregate_out_of_core(requests, 0), std::invalid_argument);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,11 +17,16 @@
 #include <tests/groupby/groupby_test_util.hpp>
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -151,6 +156,28 @@ TYPED_TEST(groupby_quantile_test, multiple_quantile)
                   cudf::sorted::YES);
 }
 
+TYPED_TEST(groupby_quantile_test, unsorted_values_with_nulls)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::QUANTILE>;
+
+  cudf::test::fixed_width_column_wrapper<K> keys{1, 2, 1, 2, 1, 2, 1, 2, 1, 3};
+  cudf::test::fixed_width_column_wrapper<V> vals({9, -4, 3, 8, -1, 0, 7, 5, 2, 6},
+                                                 {1, 1, 1, 1, 0, 1, 1, 0, 1, 0});
+
+  // clang-format off
+  //                                       {1, 1, 1, 1, 1,   2, 2, 2, 2,   3}
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  //                                       {2, 3, 7, 9,      -4, 0, 8,     -}
+  cudf::test::fixed_width_column_wrapper<R> expect_vals({2.75, 7.5, -2., 4., 0., 0.},
+                                                        {1,    1,   1,   1,  0,  0});
+  // clang-format on
+
+  auto agg = cudf::make_quantile_aggregation<cudf::groupby_aggregation>(
+    {0.25, 0.75}, cudf::interpolation::LINEAR);
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
 TYPED_TEST(groupby_quantile_test, interpolation_types)
 {
   using V = TypeParam;
@@ -212,3 +239,36 @@ TYPED_TEST(groupby_quantile_test, dictionary)
     expect_vals,
     cudf::make_quantile_aggregation<cudf::groupby_aggregation>({0.5}, cudf::interpolation::LINEAR));
 }
+
+TYPED_TEST(groupby_quantile_test, with_hash_aggregations)
+{
+  using V  = TypeParam;
+  using R  = cudf::detail::target_type_t<V, cudf::aggregation::QUANTILE>;
+  using RS = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  cudf::test::fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  cudf::test::fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // The SUM and MAX are computed by hash and the QUANTILE by sort
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(
+    cudf::make_quantile_aggregation<cudf::groupby_aggregation>({0.5}, cudf::interpolation::LINEAR));
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  auto const [out_keys, results] = gb_obj.aggregate(requests);
+
+  //                                       {1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  //                                       {0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+  cudf::test::fixed_width_column_wrapper<RS> expect_sums{9, 19, 17};
+  cudf::test::fixed_width_column_wrapper<R> expect_quantiles({3., 4.5, 7.}, no_nulls());
+  cudf::test::fixed_width_column_wrapper<V> expect_maxes{6, 9, 8};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_keys->get_column(0), expect_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0].results[0], expect_sums);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0].results[1], expect_quantiles);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0].results[2], expect_maxes);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using keys_col   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using vals_col   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using counts_col = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+using sums_col   = cudf::test::fixed_width_column_wrapper<int64_t>;
+using floats_col = cudf::test::fixed_width_column_wrapper<double>;
+
+struct StreamingGroupbyTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// Returns the results of `sgb` sorted by their keys
+std::unique_ptr<cudf::table> sorted_results(cudf::groupby::streaming_groupby const& sgb)
+{
+  auto const [keys, results] = sgb.results();
+  std::vector<cudf::column_view> columns{keys->get_column(0).view()};
+  for (auto const& result : results) {
+    columns.push_back(result->view());
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, keys->view());
+}
+
+}  // namespace
+
+TEST_F(StreamingGroupbyTest, SumCountMaxMean)
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_groupby sgb(std::move(aggs));
+
+  {
+    keys_col keys{1, 2, 1};
+    vals_col vals{1, 2, 3};
+    sgb.update(cudf::table_view{{keys}}, cudf::table_view{{vals, vals, vals, vals}});
+  }
+  EXPECT_EQ(sgb.num_groups(), 2);
+  {
+    keys_col keys{2, 3, 1, 3};
+    vals_col vals({4, 5, 6, 0}, {1, 1, 1, 0});
+    sgb.update(cudf::table_view{{keys}}, cudf::table_view{{vals, vals, vals, vals}});
+  }
+  EXPECT_EQ(sgb.num_groups(), 3);
+
+  auto const results = sorted_results(sgb);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), keys_col{1, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(1), sums_col{10, 6, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(2), counts_col{3, 2, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(3), vals_col{6, 4, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(4), floats_col{10. / 3, 3., 5.});
+}
+
+TEST_F(StreamingGroupbyTest, M2)
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_m2_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_groupby sgb(std::move(aggs));
+
+  {
+    keys_col keys{1, 2, 1};
+    vals_col vals{1, 2, 3};
+    sgb.update(cudf::table_view{{keys}}, cudf::table_view{{vals}});
+  }
+  {
+    keys_col keys{2, 3, 1};
+    vals_col vals{4, 5, 5};
+    sgb.update(cudf::table_view{{keys}}, cudf::table_view{{vals}});
+  }
+
+  // {1, 3, 5}, {2, 4}, {5}
+  auto const results = sorted_results(sgb);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), keys_col{1, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(1), floats_col{8., 2., 0.});
+}
+
+TEST_F(StreamingGroupbyTest, InvalidUse)
+{
+  {
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+    aggs.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+    EXPECT_THROW(cudf::groupby::streaming_groupby{std::move(aggs)}, std::invalid_argument);
+  }
+
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_groupby sgb(std::move(aggs));
+  EXPECT_THROW(sgb.results(), cudf::logic_error);
+
+  keys_col keys{1, 2};
+  vals_col vals{1, 2, 3};
+  EXPECT_THROW(sgb.update(cudf::table_view{{keys}}, cudf::table_view{{vals}}), cudf::logic_error);
+  EXPECT_THROW(sgb.update(cudf::table_view{{keys}}, cudf::table_view{}), cudf::logic_error);
+}
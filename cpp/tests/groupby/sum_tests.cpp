@@ -22,6 +22,9 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -130,6 +133,102 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, many_rows_few_keys)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  auto constexpr num_rows = 20'000;
+  auto constexpr num_keys = 5;
+  auto const key_iter     = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<K>(i % num_keys); });
+  auto const val_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto const val_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+
+  std::vector<int64_t> sums(num_keys, 0);
+  for (auto i = 0; i < num_rows; ++i) {
+    if (i % 7 != 0) { sums[i % num_keys] += i % 10; }
+  }
+
+  cudf::test::fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  cudf::test::fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows, val_valid);
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{0, 1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<R> expect_vals(sums.begin(), sums.end());
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_sum_test, clustered_keys)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // Runs of 10 equal keys, with several runs of each key
+  auto constexpr num_rows = 1'000;
+  auto constexpr num_keys = 7;
+  auto const key_iter     = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<K>((i / 10) % num_keys); });
+  auto const val_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto const val_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  std::vector<int64_t> sums(num_keys, 0);
+  for (auto i = 0; i < num_rows; ++i) {
+    if (i % 3 != 0) { sums[(i / 10) % num_keys] += i % 10; }
+  }
+
+  cudf::test::fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  cudf::test::fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows, val_valid);
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{0, 1, 2, 3, 4, 5, 6};
+  cudf::test::fixed_width_column_wrapper<R> expect_vals(sums.begin(), sums.end());
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_sum_test, small_range_keys)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // Keys of a range of 8 values, aggregated in shared memory, and of 3000 values
+  for (auto const num_keys : {8, 3'000}) {
+    auto const num_rows = 4 * num_keys;
+    auto const key_iter = cudf::detail::make_counting_transform_iterator(
+      0, [num_keys](auto i) { return static_cast<K>((i * 7) % num_keys - 3); });
+    auto const val_iter =
+      cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+
+    std::vector<int64_t> sums(num_keys, 0);
+    for (auto i = 0; i < num_rows; ++i) {
+      sums[(i * 7) % num_keys] += i % 10;
+    }
+    auto const expect_key_iter = cudf::detail::make_counting_transform_iterator(
+      0, [](auto i) { return static_cast<K>(i - 3); });
+
+    cudf::test::fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+    cudf::test::fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+    cudf::test::fixed_width_column_wrapper<K> expect_keys(expect_key_iter,
+                                                          expect_key_iter + num_keys);
+    cudf::test::fixed_width_column_wrapper<R> expect_vals(sums.begin(), sums.end());
+
+    auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+  }
+}
+
 TYPED_TEST(groupby_sum_test, dictionary)
 {
   using V = TypeParam;
@@ -105,6 +105,28 @@ TEST_F(MD5HashTest, EmptyNullEquivalence)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(MD5HashTest, LongStrings)
+{
+  // Rows holding long strings are hashed before the other rows
+  cudf::test::strings_column_wrapper const strings_col({"short",
+                                                        std::string(2000, 'a'),
+                                                        "",
+                                                        std::string(1024, 'b'),
+                                                        std::string(1023, 'c'),
+                                                        "tail"},
+                                                       {1, 1, 0, 1, 1, 1});
+
+  cudf::test::strings_column_wrapper const md5_results({"4f09daa9d95bcb166a302407a0e0babe",
+                                                        "7c1c566ab4cdb11ac8971191694e8bec",
+                                                        "d41d8cd98f00b204e9800998ecf8427e",
+                                                        "bbe6402cdc9b7e2036fc97e9a91726cd",
+                                                        "d6eca8b94b322f50668394796df992c5",
+                                                        "7aea2552dfe7eb84b9443b6fc9ba6e01"});
+
+  auto const output = cudf::hashing::md5(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), md5_results);
+}
+
 TEST_F(MD5HashTest, StringLists)
 {
   auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 0; });
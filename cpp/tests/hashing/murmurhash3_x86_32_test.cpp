@@ -120,6 +120,38 @@ TEST_F(MurmurHashTest, MultiValueNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(MurmurHashTest, MultiValueNullsFixedWidth)
+{
+  // Nulls with different values should be equal
+  using limits = std::numeric_limits<int32_t>;
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints_col1(
+    {0, 100, -100, limits::min(), limits::max()}, {1, 0, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints_col2(
+    {0, -200, 200, limits::min(), limits::max()}, {1, 0, 0, 1, 1});
+
+  cudf::test::fixed_width_column_wrapper<double> const doubles_col1({0., 1.5, -2., 3., 4.},
+                                                                    {0, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> const doubles_col2({7., 1.5, -2., -8., 4.},
+                                                                    {0, 1, 1, 0, 1});
+
+  cudf::test::fixed_width_column_wrapper<int8_t> const bytes_col({1, 2, 3, 4, 5});
+
+  auto const input1 = cudf::table_view({ints_col1, doubles_col1, bytes_col});
+  auto const input2 = cudf::table_view({ints_col2, doubles_col2, bytes_col});
+
+  auto const output1 = cudf::hashing::murmurhash3_x86_32(input1);
+  auto const output2 = cudf::hashing::murmurhash3_x86_32(input2);
+
+  EXPECT_EQ(input1.num_rows(), output1->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+
+  // The order of the columns is part of the row hash
+  auto const swapped = cudf::hashing::murmurhash3_x86_32(
+    cudf::table_view({bytes_col, ints_col1, doubles_col1}));
+  EXPECT_FALSE(cudf::test::detail::expect_columns_equal(
+    output1->view(), swapped->view(), cudf::test::debug_output_level::QUIET));
+}
+
 TEST_F(MurmurHashTest, BasicList)
 {
   using LCW = cudf::test::lists_column_wrapper<uint64_t>;
@@ -112,6 +112,30 @@ TEST_F(SHA256HashTest, MultiValue)
   EXPECT_EQ(input1.num_rows(), sha256_output1->size());
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output1->view(), sha256_output2->view());
 }
+
+TEST_F(SHA256HashTest, LongStrings)
+{
+  // Rows holding long strings are hashed before the other rows
+  cudf::test::strings_column_wrapper const strings_col({"short",
+                                                        std::string(2000, 'a'),
+                                                        "",
+                                                        std::string(1024, 'b'),
+                                                        std::string(1023, 'c'),
+                                                        "tail"},
+                                                       {1, 1, 0, 1, 1, 1});
+
+  cudf::test::strings_column_wrapper const sha256_results(
+    {"f9b0078b5df596d2ea19010c001bbd009e651de2c57e8fb7e355f31eb9d3f739",
+     "c4a700f85b7e9e5cdbdc51170409ee2ad48bebe2f2f0957a067937531a0a3c42",
+     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+     "0c66f2c45405de575189209a768399bcaf88ccc51002407e395c0136aad2844d",
+     "965971bdcfe53246fd8ba4224d6457e1146c1ea098e9b8f6bb89392cd7453391",
+     "0c62f876ef1dea830de9f32c2f4b46dd6d74d50d15896e09ef5a2fcd4ac7e1d7"});
+
+  auto const output = cudf::hashing::sha256(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), sha256_results, verbosity);
+}
+
 TEST_F(SHA256HashTest, EmptyNullEquivalence)
 {
   // Test that empty strings hash the same as nulls
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/hashing.hpp>
+
+#include <limits>
+
+using NumericTypesNoBools =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+
+template <typename T>
+class XXHash3_TestTyped : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(XXHash3_TestTyped, NumericTypesNoBools);
+
+TYPED_TEST(XXHash3_TestTyped, TestAllNumeric)
+{
+  using T   = TypeParam;
+  auto col1 = cudf::test::fixed_width_column_wrapper<T, int32_t>{
+    {-1, -1, 0, 2, 22, 0, 11, 12, 116, 32, 0, 42, 7, 62, 1, -22, 0, 0},
+    {1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0}};
+  auto col2 = cudf::test::fixed_width_column_wrapper<T, int32_t>{
+    {-1, -1, 0, 2, 22, 1, 11, 12, 116, 32, 0, 42, 7, 62, 1, -22, 1, -22},
+    {1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0}};
+
+  constexpr uint64_t seed = 7;
+
+  auto output1 = cudf::hashing::xxhash3_64(cudf::table_view({col1}), seed);
+  auto output2 = cudf::hashing::xxhash3_64(cudf::table_view({col2}), seed);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+
+  auto output3 = cudf::hashing::xxhash3_128(cudf::table_view({col1}), seed);
+  auto output4 = cudf::hashing::xxhash3_128(cudf::table_view({col2}), seed);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(output3->view(), output4->view());
+}
+
+class XXHash3_Test : public cudf::test::BaseFixture {};
+
+TEST_F(XXHash3_Test, TestInteger)
+{
+  auto col1 =
+    cudf::test::fixed_width_column_wrapper<int32_t>{{-127,
+                                                     -70000,
+                                                     0,
+                                                     200000,
+                                                     128,
+                                                     std::numeric_limits<int32_t>::max(),
+                                                     std::numeric_limits<int32_t>::min()}};
+
+  // these were generated using XXH3_64bits_withSeed from https://github.com/Cyan4973/xxHash
+  auto output   = cudf::hashing::xxhash3_64(cudf::table_view({col1}));
+  auto expected = cudf::test::fixed_width_column_wrapper<uint64_t>({16671895592018338178ul,
+                                                                    2570991671462723502ul,
+                                                                    5238470482016868669ul,
+                                                                    14864565189613285027ul,
+                                                                    6242762474616170201ul,
+                                                                    6147526096378114303ul,
+                                                                    7513848233174832419ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+
+  output   = cudf::hashing::xxhash3_64(cudf::table_view({col1}), 42);
+  expected = cudf::test::fixed_width_column_wrapper<uint64_t>({12672525902164051464ul,
+                                                               1132501717436232704ul,
+                                                               14325386350854113765ul,
+                                                               16679893547744084336ul,
+                                                               11948358192700665633ul,
+                                                               5612246636689830604ul,
+                                                               6528077086368801999ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+}
+
+TEST_F(XXHash3_Test, TestDouble)
+{
+  auto col1 =
+    cudf::test::fixed_width_column_wrapper<double>{{-127.,
+                                                    -70000.125,
+                                                    0.0,
+                                                    200000.5,
+                                                    128.5,
+                                                    -0.0,
+                                                    std::numeric_limits<double>::infinity(),
+                                                    std::numeric_limits<double>::quiet_NaN()}};
+
+  auto const output = cudf::hashing::xxhash3_64(cudf::table_view({col1}));
+
+  // these were generated using XXH3_64bits_withSeed from https://github.com/Cyan4973/xxHash
+  auto expected = cudf::test::fixed_width_column_wrapper<uint64_t>({5425546265877880610ul,
+                                                                    6551054859043774895ul,
+                                                                    14374147212387527897ul,
+                                                                    11167889948852008809ul,
+                                                                    7024763577278308018ul,
+                                                                    9407778237848358495ul,
+                                                                    3862676201523092338ul,
+                                                                    767333564151873895ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+}
+
+TEST_F(XXHash3_Test, StringType)
+{
+  // clang-format off
+  auto col1 = cudf::test::strings_column_wrapper(
+    {"The",
+     "quick",
+     "brown fox",
+     "jumps over the lazy dog.",
+     "I am Jack's complete lack of null value",
+     "A very long (greater than 240 bytes/characters) string to test the long input path of XXH3. "
+     "A very long (greater than 240 bytes/characters) string to test the long input path of XXH3. "
+     "A very long (greater than 240 bytes/characters) string to test the long input path of XXH3. "
+     "A very long (greater than 240 bytes/characters) string to test the long input path of XXH3. ",
+     "Some multi-byte characters here: ééé",
+     "ééé",
+     "",
+     "0123456789"});
+  // clang-format on
+
+  // these were generated using XXH3_64bits_withSeed and XXH3_128bits_withSeed from
+  // https://github.com/Cyan4973/xxHash
+  auto const output = cudf::hashing::xxhash3_64(cudf::table_view({col1}));
+  auto expected     = cudf::test::fixed_width_column_wrapper<uint64_t>({1697460846037315663ul,
+                                                                    11854836010350326562ul,
+                                                                    7854267933804621254ul,
+                                                                    4246674186399648749ul,
+                                                                    8614968941113017407ul,
+                                                                    12052899534094296621ul,
+                                                                    17917250354469613945ul,
+                                                                    76209267286171903ul,
+                                                                    3244421341483603138ul,
+                                                                    7918246353190764831ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+
+  auto const output128 = cudf::hashing::xxhash3_128(cudf::table_view({col1}));
+  auto expected_low    = cudf::test::fixed_width_column_wrapper<uint64_t>({1697460846037315663ul,
+                                                                        16758153605037981772ul,
+                                                                        15032251031998237183ul,
+                                                                        10279772449208806171ul,
+                                                                        18179722664574495548ul,
+                                                                        12052899534094296621ul,
+                                                                        15255340396581185085ul,
+                                                                        437125594183747059ul,
+                                                                        6918025063187695999ul,
+                                                                        5288738656073377275ul});
+  auto expected_high = cudf::test::fixed_width_column_wrapper<uint64_t>({505670241228254330ul,
+                                                                         12133022171128885860ul,
+                                                                         12687683679785550870ul,
+                                                                         15713271831996049284ul,
+                                                                         1713434350284489288ul,
+                                                                         17544592883801224411ul,
+                                                                         12373450040929179568ul,
+                                                                         8097664335195033261ul,
+                                                                         11072670137173121240ul,
+                                                                         16380548927103723083ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output128->get_column(0).view(), expected_low);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output128->get_column(1).view(), expected_high);
+}
+
+TEST_F(XXHash3_Test, MultipleColumns)
+{
+  auto const ints    = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2});
+  auto const strings = cudf::test::strings_column_wrapper({"a", "bc", "def"});
+  auto const input   = cudf::table_view({ints, strings});
+
+  // each column is hashed with the (low 64 bits of the) hash of the previous columns as seed
+  auto const output = cudf::hashing::xxhash3_64(input);
+  auto const expected =
+    cudf::test::fixed_width_column_wrapper<uint64_t>({6151981412646577983ul,
+                                                      1354520250348493106ul,
+                                                      15499257360561973435ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+
+  auto const output128 = cudf::hashing::xxhash3_128(input);
+  auto const expected_low =
+    cudf::test::fixed_width_column_wrapper<uint64_t>({7467173821523722189ul,
+                                                      727200633155191338ul,
+                                                      13121139445170944788ul});
+  auto const expected_high =
+    cudf::test::fixed_width_column_wrapper<uint64_t>({8127107021518780535ul,
+                                                      12416729530886152495ul,
+                                                      3140539181520995855ul});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output128->get_column(0).view(), expected_low);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output128->get_column(1).view(), expected_high);
+}
+
+TEST_F(XXHash3_Test, Empty)
+{
+  auto const ints   = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  auto const input  = cudf::table_view({ints});
+  auto const output = cudf::hashing::xxhash3_128(input);
+  EXPECT_EQ(output->num_columns(), 2);
+  EXPECT_EQ(output->num_rows(), 0);
+  EXPECT_EQ(cudf::hashing::xxhash3_64(input)->size(), 0);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/interop/arrow_device_stream.hpp>
+#include <cudf/interop/detail/arrow.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/table/table.hpp>
+
+#include <nanoarrow/nanoarrow.hpp>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+struct ArrowDeviceStreamTest : public cudf::test::BaseFixture {};
+
+TEST_F(ArrowDeviceStreamTest, ParquetRoundTrip)
+{
+  auto const num_rows = 10'000;
+  auto sequence       = thrust::make_counting_iterator(0);
+  auto validity       = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(sequence, sequence + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<double> doubles(sequence, sequence + num_rows);
+  auto const expected = cudf::table_view{{ints, doubles}};
+
+  std::vector<char> source_buffer;
+  cudf::io::parquet_writer_options write_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&source_buffer}, expected)
+      .row_group_size_rows(1'000);
+  cudf::io::write_parquet(write_opts);
+
+  // a small output limit forces the reader to produce several batches
+  auto read_opts = cudf::io::parquet_reader_options::builder(
+                     cudf::io::source_info{source_buffer.data(), source_buffer.size()})
+                     .build();
+  auto reader = std::make_unique<cudf::io::chunked_parquet_reader>(16'000, read_opts);
+
+  ArrowDeviceArrayStream stream;
+  cudf::to_arrow_device_stream(std::move(reader), &stream);
+  EXPECT_EQ(stream.device_type, ARROW_DEVICE_CUDA);
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(stream.get_schema(&stream, schema.get()), 0);
+  ASSERT_EQ(schema->n_children, 2);
+
+  std::vector<char> sink_buffer;
+  auto writer_opts =
+    cudf::io::chunked_parquet_writer_options::builder(cudf::io::sink_info{&sink_buffer}).build();
+  cudf::io::parquet_chunked_writer writer(writer_opts);
+  auto const rows_written = cudf::write_arrow_device_stream(&stream, writer);
+  writer.close();
+
+  EXPECT_EQ(rows_written, static_cast<std::size_t>(num_rows));
+  EXPECT_EQ(stream.release, nullptr);
+
+  auto result = cudf::io::read_parquet(cudf::io::parquet_reader_options::builder(
+                                         cudf::io::source_info{sink_buffer.data(),
+                                                               sink_buffer.size()})
+                                         .build());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result.tbl->view());
+}
+
+TEST_F(ArrowDeviceStreamTest, InvalidInput)
+{
+  std::vector<char> sink_buffer;
+  auto writer_opts =
+    cudf::io::chunked_parquet_writer_options::builder(cudf::io::sink_info{&sink_buffer}).build();
+  cudf::io::parquet_chunked_writer writer(writer_opts);
+
+  EXPECT_THROW(cudf::write_arrow_device_stream(nullptr, writer), std::invalid_argument);
+
+  ArrowDeviceArrayStream stream;
+  EXPECT_THROW(cudf::to_arrow_device_stream(nullptr, &stream), std::invalid_argument);
+}
@@ -333,6 +333,37 @@ TEST_F(DLPackUntypedTests, UnsupportedStridedColMajor2DTensorFromDlpack)
   EXPECT_THROW(cudf::from_dlpack(&tensor), cudf::logic_error);
 }
 
+TEST_F(DLPackUntypedTests, NullColumnToDlpack)
+{
+  EXPECT_THROW(cudf::to_dlpack(std::unique_ptr<cudf::column>{}), std::invalid_argument);
+}
+
+TEST_F(DLPackUntypedTests, InvalidNullsColumnToDlpack)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4}, {1, 0, 1, 1});
+  EXPECT_THROW(cudf::to_dlpack(col.release()), cudf::logic_error);
+}
+
+TEST_F(DLPackUntypedTests, NullTensorFromDlpackView)
+{
+  EXPECT_THROW(cudf::from_dlpack_view(nullptr), cudf::logic_error);
+}
+
+TEST_F(DLPackUntypedTests, HostTensorFromDlpackView)
+{
+  int64_t shape[1] = {4};
+  std::vector<int32_t> data{1, 2, 3, 4};
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.device.device_type = kDLCPU;
+  tensor.dl_tensor.dtype              = get_dtype<int32_t>();
+  tensor.dl_tensor.ndim               = 1;
+  tensor.dl_tensor.shape              = shape;
+  tensor.dl_tensor.data               = data.data();
+
+  EXPECT_THROW(cudf::from_dlpack_view(&tensor), cudf::logic_error);
+}
+
 template <typename T>
 class DLPackTimestampTests : public cudf::test::BaseFixture {};
 
@@ -496,3 +527,40 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   EXPECT_EQ(nullptr, tensor.get());
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TYPED_TEST(DLPackNumericTests, ColumnToDlpackZeroCopy)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  auto input          = col.release();
+  auto const expected = cudf::column(input->view());
+  auto const data     = input->view().head();
+
+  unique_managed_tensor result(cudf::to_dlpack(std::move(input)));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLCUDA, tensor.device.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(data, tensor.data);
+
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(type, tensor.shape[0], tensor.data, nullptr, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.view(), result_view);
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackView2D)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  cudf::test::fixed_width_column_wrapper<T> wrapper1(col1.cbegin(), col1.cend());
+  cudf::test::fixed_width_column_wrapper<T> wrapper2(col2.cbegin(), col2.cend());
+  cudf::table_view input({wrapper1, wrapper2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  // The view reads the tensor memory in place
+  auto const result = cudf::from_dlpack_view(tensor.get());
+  EXPECT_EQ(tensor->dl_tensor.data, result.column(0).head());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result);
+}
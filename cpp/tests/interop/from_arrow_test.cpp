@@ -324,6 +324,19 @@ TEST_F(FromArrowTest, ChunkedArray)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table->view(), got_cudf_table->view());
 }
 
+TEST_F(FromArrowTest, HostBufferPolicies)
+{
+  auto tables              = get_tables(10000);
+  auto expected_cudf_table = tables.first->view();
+  auto arrow_table         = tables.second;
+
+  auto staged = cudf::from_arrow(*arrow_table, cudf::arrow_host_buffer_policy::STAGE_PINNED);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table, staged->view());
+
+  auto registered = cudf::from_arrow(*arrow_table, cudf::arrow_host_buffer_policy::REGISTER);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table, registered->view());
+}
+
 struct FromArrowTestSlice
   : public FromArrowTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {};
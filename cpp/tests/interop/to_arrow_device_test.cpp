@@ -24,6 +24,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/interop.hpp>
@@ -33,11 +34,14 @@
 #include <cudf/interop.hpp>
 #include <cudf/interop/detail/arrow.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <string>
+
 using vector_of_columns = std::vector<std::unique_ptr<cudf::column>>;
 
 std::tuple<std::unique_ptr<cudf::table>, nanoarrow::UniqueSchema, nanoarrow::UniqueArray>
@@ -827,3 +831,45 @@ TEST_F(ToArrowDeviceTest, FixedPoint128Table)
     compare_arrays(expected_schema.get(), expected_array.get(), &got_arrow_array->array);
   }
 }
+
+TEST_F(ToArrowDeviceTest, ZeroCopyRoundTrip)
+{
+  // a strings column with 64-bit offsets maps onto an Arrow large strings array
+  auto offsets     = cudf::test::fixed_width_column_wrapper<int64_t>{0, 3, 3, 7, 12}.release();
+  auto const chars = std::string{"abcdefghijkl"};
+  auto strings     = cudf::make_strings_column(
+    4,
+    std::move(offsets),
+    rmm::device_buffer{chars.data(), chars.size(), cudf::get_default_stream()},
+    0,
+    {});
+  auto ints        = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto const input = cudf::table_view({ints, *strings});
+
+  auto const schema =
+    cudf::to_arrow_schema(input, std::vector<cudf::column_metadata>{{"a"}, {"b"}});
+  EXPECT_STREQ("U", schema->children[1]->format);
+
+  auto const arrow = cudf::to_arrow_device(input, cudf::arrow_copy_policy::ZERO_COPY_ONLY);
+  EXPECT_EQ(cudf::strings_column_view(*strings).offsets().head(),
+            arrow->array.children[1]->buffers[1]);
+
+  auto const got = cudf::from_arrow_device(
+    schema.get(), arrow.get(), cudf::arrow_copy_policy::ZERO_COPY_ONLY);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, *got);
+  EXPECT_EQ(input.column(0).head(), got->column(0).head());
+  EXPECT_EQ(input.column(0).null_mask(), got->column(0).null_mask());
+
+  // bools are stored as bytes in cudf and as bits in Arrow
+  auto bools           = cudf::test::fixed_width_column_wrapper<bool>({true, false, true});
+  auto const bool_view = cudf::table_view({bools});
+  EXPECT_THROW(cudf::to_arrow_device(bool_view, cudf::arrow_copy_policy::ZERO_COPY_ONLY),
+               cudf::data_type_error);
+
+  auto const bool_schema =
+    cudf::to_arrow_schema(bool_view, std::vector<cudf::column_metadata>{{"a"}});
+  auto const bool_arrow = cudf::to_arrow_device(bool_view);
+  EXPECT_THROW(cudf::from_arrow_device(
+                 bool_schema.get(), bool_arrow.get(), cudf::arrow_copy_policy::ZERO_COPY_ONLY),
+               cudf::data_type_error);
+}
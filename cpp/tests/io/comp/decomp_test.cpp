@@ -15,6 +15,8 @@
  */
 
 #include "io/comp/gpuinflate.hpp"
+#include "io/comp/io_uncomp.hpp"
+#include "io/comp/size_buckets.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <cudf_test/base_fixture.hpp>
@@ -27,6 +29,7 @@
 
 #include <src/io/comp/nvcomp_adapter.hpp>
 
+#include <string>
 #include <vector>
 
 using cudf::device_span;
@@ -121,6 +124,30 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for Zstandard decompression
+ */
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  void dispatch(device_span<device_span<uint8_t const>> d_inf_in,
+                device_span<device_span<uint8_t>> d_inf_out,
+                device_span<cudf::io::compression_result> d_inf_stat)
+  {
+    cudf::io::gpu_unzstd(d_inf_in, d_inf_out, d_inf_stat, cudf::get_default_stream());
+  }
+};
+
+/**
+ * @brief Derived fixture for LZ4 decompression
+ */
+struct Lz4DecompressTest : public DecompressTest<Lz4DecompressTest> {
+  void dispatch(device_span<device_span<uint8_t const>> d_inf_in,
+                device_span<device_span<uint8_t>> d_inf_out,
+                device_span<cudf::io::compression_result> d_inf_stat)
+  {
+    cudf::io::gpu_unlz4(d_inf_in, d_inf_out, d_inf_stat, cudf::get_default_stream());
+  }
+};
+
 struct NvcompConfigTest : public cudf::test::BaseFixture {};
 
 TEST_F(GzipDecompressTest, HelloWorld)
@@ -171,6 +198,43 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x0b, 0x59, 0x00, 0x00, 0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedWord)
+{
+  constexpr char uncompressed[]  = "hello hello hello hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x1d, 0x8d, 0x00, 0x00,
+                                    0x58, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f,
+                                    0x72, 0x6c, 0x64, 0x01, 0x00, 0xf1, 0x4a, 0x11};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, RepeatedWord)
+{
+  constexpr char uncompressed[]  = "hello hello hello hello world";
+  constexpr uint8_t compressed[] = {
+    0x6e, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x06, 0x00, 0x50, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
 TEST_F(NvcompConfigTest, Compression)
 {
   using cudf::io::nvcomp::compression_type;
@@ -223,4 +287,66 @@ TEST_F(NvcompConfigTest, Decompression)
   EXPECT_TRUE(decomp_disabled(compression_type::SNAPPY, {2, 2, 0, false, false, 7}));
 }
 
+TEST(DecompressBatchingTest, SizeBuckets)
+{
+  using cudf::io::chunk_size_bucket;
+  auto constexpr small  = cudf::io::small_chunk_max_size;
+  auto constexpr medium = cudf::io::medium_chunk_max_size;
+
+  std::vector<size_t> const sizes{medium + 1, 10, medium, small + 1, small, 0, 2 * medium};
+  auto const buckets = cudf::io::bucket_chunks_by_size(sizes);
+
+  EXPECT_EQ(buckets.size(chunk_size_bucket::SMALL), 3);
+  EXPECT_EQ(buckets.size(chunk_size_bucket::MEDIUM), 2);
+  EXPECT_EQ(buckets.size(chunk_size_bucket::LARGE), 2);
+  // Chunks keep their relative order within a bucket
+  EXPECT_EQ(buckets.chunks, (std::vector<size_t>{1, 4, 5, 2, 3, 0, 6}));
+  EXPECT_EQ(buckets.max_uncomp_size[0], small);
+  EXPECT_EQ(buckets.max_uncomp_size[1], medium);
+  EXPECT_EQ(buckets.max_uncomp_size[2], 2 * medium);
+  EXPECT_EQ(buckets.total_uncomp_size[0], small + 10);
+  EXPECT_EQ(buckets.total_uncomp_size[1], medium + small + 1);
+  EXPECT_EQ(buckets.total_uncomp_size[2], 3 * medium + 1);
+}
+
+TEST(HostDecompressTest, Bzip2MultipleBlocks)
+{
+  // 240000 bytes of "<i % 5>,<i % 3>" rows, compressed with a 100k block size into three blocks
+  constexpr uint8_t compressed[] = {
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x82, 0xed, 0x3b, 0xc7, 0x00,
+    0x71, 0xe9, 0x58, 0x00, 0x00, 0x10, 0x00, 0x04, 0x7c, 0x00, 0x30, 0x01, 0x38, 0x00, 0x86,
+    0x00, 0x86, 0x00, 0x29, 0x54, 0xfd, 0x53, 0xd5, 0x34, 0xe4, 0x09, 0x7a, 0x81, 0x2e, 0xa0,
+    0x4b, 0x20, 0x4b, 0x50, 0x25, 0x90, 0x25, 0x90, 0x25, 0x90, 0x25, 0xa8, 0x12, 0xd4, 0x09,
+    0x64, 0x09, 0x64, 0x09, 0x64, 0x09, 0x6a, 0x04, 0xb2, 0x04, 0xbe, 0x40, 0x96, 0xa0, 0x4b,
+    0x20, 0x4b, 0xd4, 0x09, 0x7d, 0x40, 0x97, 0x50, 0x25, 0xc8, 0x12, 0xea, 0x04, 0xb9, 0x02,
+    0x5c, 0x81, 0x2e, 0x40, 0x97, 0x20, 0x4b, 0x90, 0x25, 0xd4, 0x09, 0x72, 0x04, 0xbe, 0x28,
+    0x40, 0xef, 0xaa, 0x0a, 0x8c, 0x50, 0x81, 0xe5, 0x41, 0x51, 0xe5, 0x21, 0x03, 0xc9, 0x22,
+    0x4a, 0xfe, 0x62, 0x82, 0xb2, 0x4c, 0xa6, 0xb3, 0x68, 0xc1, 0x13, 0x3e, 0x00, 0xaf, 0xbf,
+    0xb0, 0x00, 0x00, 0x20, 0x00, 0x08, 0xf8, 0x00, 0x60, 0x02, 0x70, 0x01, 0x0c, 0x01, 0x0c,
+    0x00, 0x52, 0x8a, 0x9f, 0xa9, 0xa9, 0xbc, 0x81, 0x2c, 0x40, 0x97, 0x20, 0x4b, 0x68, 0x12,
+    0xd4, 0x09, 0x6a, 0x04, 0xb5, 0x02, 0x5b, 0x40, 0x96, 0xa0, 0x4b, 0x50, 0x25, 0xa8, 0x12,
+    0xda, 0x04, 0xb6, 0x81, 0x2d, 0x40, 0x96, 0xa0, 0x4b, 0x3d, 0x40, 0x96, 0x20, 0x4b, 0x68,
+    0x12, 0xfc, 0x81, 0x2f, 0x20, 0x4b, 0x90, 0x25, 0xc8, 0x12, 0xe4, 0x09, 0x75, 0x02, 0x5c,
+    0x81, 0x2e, 0x40, 0x97, 0x20, 0x4b, 0xdf, 0x20, 0x4b, 0xe4, 0x09, 0x7d, 0x40, 0x97, 0xe2,
+    0x84, 0x0f, 0x54, 0x15, 0x19, 0x48, 0x40, 0xca, 0x82, 0xa3, 0x0a, 0x10, 0x32, 0x48, 0x92,
+    0xbf, 0x98, 0xa0, 0xac, 0x93, 0x29, 0xac, 0xd7, 0xe2, 0x8b, 0x53, 0x80, 0x19, 0x69, 0xec,
+    0x00, 0x00, 0x08, 0x00, 0x02, 0x3e, 0x00, 0x18, 0x00, 0x88, 0x18, 0x43, 0x00, 0x26, 0xaa,
+    0xa7, 0xfa, 0xa7, 0xa8, 0x82, 0x6a, 0x54, 0x32, 0x71, 0x14, 0xbc, 0x22, 0x97, 0x11, 0x4b,
+    0x50, 0xa5, 0x88, 0xa5, 0xa8, 0x52, 0xd4, 0x29, 0x62, 0x29, 0x62, 0x29, 0x62, 0x29, 0x6a,
+    0x14, 0xb1, 0x14, 0xb1, 0x14, 0xb1, 0x14, 0xb5, 0x0a, 0x5f, 0x11, 0x4b, 0x11, 0x4b, 0x11,
+    0x4b, 0xca, 0x14, 0xbe, 0x22, 0x97, 0x11, 0x4b, 0x88, 0xa5, 0xc4, 0x52, 0xe2, 0x29, 0x75,
+    0x0a, 0x5d, 0x42, 0x97, 0x11, 0x4b, 0xa8, 0x52, 0xe2, 0x29, 0x71, 0x14, 0xbb, 0x52, 0xa9,
+    0x3a, 0xa9, 0x06, 0x22, 0x96, 0xc8, 0x8a, 0x5a, 0x52, 0x0c, 0xa5, 0x52, 0x68, 0x84, 0x2f,
+    0xc5, 0xdc, 0x91, 0x4e, 0x14, 0x24, 0x33, 0x2c, 0x3a, 0xa1, 0x80};
+
+  std::string expected;
+  for (int i = 0; i < 60000; ++i) {
+    expected += std::to_string(i % 5) + "," + std::to_string(i % 3) + "\n";
+  }
+
+  auto const output = cudf::io::decompress(cudf::io::compression_type::BZIP2,
+                                           cudf::host_span<uint8_t const>{compressed});
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
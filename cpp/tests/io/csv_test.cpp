@@ -23,6 +23,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/arrow_io_source.hpp>
@@ -39,6 +40,8 @@
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <src/io/comp/nvcomp_adapter.hpp>
+
 #include <arrow/io/api.h>
 
 #include <algorithm>
@@ -484,6 +487,113 @@ TEST_F(CsvWriterTest, QuotingDisabled)
   test_quoting_disabled_with_delimiter('\u0001');
 }
 
+TEST_F(CsvWriterTest, FusedRowsMultipleChunks)
+{
+  auto constexpr num_rows = 20;
+  auto const ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i - 5; });
+  auto const bools =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 == 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i % 4 == 0 ? std::string{"a,b"} : i % 4 == 1 ? std::string{"say \"hi\""} : "c";
+  });
+  cudf::test::fixed_width_column_wrapper<int64_t> col0(
+    ints, ints + num_rows, cudf::test::iterators::null_at(3));
+  cudf::test::fixed_width_column_wrapper<bool> col1(bools, bools + num_rows);
+  cudf::test::strings_column_wrapper col2(
+    strings, strings + num_rows, cudf::test::iterators::null_at(7));
+  cudf::test::fixed_point_column_wrapper<int32_t> col3(
+    ints, ints + num_rows, numeric::scale_type{-1});
+  cudf::table_view const input{{col0, col1, col2, col3}};
+
+  std::vector<char> out_buffer;
+  auto const out_opts =
+    cudf::io::csv_writer_options::builder(cudf::io::sink_info{&out_buffer}, input)
+      .include_header(false)
+      .rows_per_chunk(8)
+      .na_rep("NA")
+      .build();
+  cudf::io::write_csv(out_opts);
+
+  std::string expected;
+  for (int i = 0; i < num_rows; ++i) {
+    auto const value   = i - 5;
+    auto const decimal = (value < 0 ? "-" : "") + std::to_string(std::abs(value) / 10) + "." +
+                         std::to_string(std::abs(value) % 10);
+    auto const str = i % 4 == 0 ? "\"a,b\"" : i % 4 == 1 ? "\"say \"\"hi\"\"\"" : "c";
+    expected += (i == 3 ? "NA" : std::to_string(value)) + "," + (i % 3 == 0 ? "true" : "false") +
+                "," + (i == 7 ? "NA" : str) + "," + decimal + "\n";
+  }
+  EXPECT_EQ(expected, std::string(out_buffer.data(), out_buffer.size()));
+}
+
+TEST_F(CsvWriterTest, CompressedGzip)
+{
+  if (cudf::io::nvcomp::is_compression_disabled(cudf::io::nvcomp::compression_type::DEFLATE)) {
+    GTEST_SKIP() << "nvCOMP DEFLATE compression is disabled";
+  }
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col0(sequence, sequence + 100000);
+  cudf::test::strings_column_wrapper col1({"first", "second", "third", "fourth"});
+  auto const col1_big = cudf::concatenate(std::vector<cudf::column_view>(25000, col1));
+  cudf::table_view const input{{col0, col1_big->view()}};
+
+  std::vector<char> out_buffer;
+  auto const out_opts =
+    cudf::io::csv_writer_options::builder(cudf::io::sink_info{&out_buffer}, input)
+      .include_header(false)
+      .rows_per_chunk(30000)
+      .compression(cudf::io::compression_type::GZIP)
+      .build();
+  cudf::io::write_csv(out_opts);
+
+  auto const in_opts =
+    cudf::io::csv_reader_options::builder(
+      cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+      .header(-1)
+      .dtypes({dtype<int32_t>(), dtype<cudf::string_view>()})
+      .compression(cudf::io::compression_type::GZIP)
+      .build();
+  auto const result = cudf::io::read_csv(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result.tbl->view());
+}
+
+TEST_F(CsvWriterTest, CompressedSnappyFraming)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0{1, 2, 3};
+  cudf::table_view const input{{col0}};
+
+  std::vector<char> out_buffer;
+  auto const out_opts =
+    cudf::io::csv_writer_options::builder(cudf::io::sink_info{&out_buffer}, input)
+      .include_header(false)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .build();
+  cudf::io::write_csv(out_opts);
+
+  // Framed Snappy stream identifier, followed by a single compressed data chunk
+  std::string const stream_identifier{"\xff\x06\x00\x00sNaPpY", 10};
+  ASSERT_GT(out_buffer.size(), stream_identifier.size() + 4);
+  EXPECT_EQ(stream_identifier, std::string(out_buffer.data(), stream_identifier.size()));
+  EXPECT_EQ(out_buffer[stream_identifier.size()], '\x00');
+  auto const chunk_length = static_cast<uint8_t>(out_buffer[11]) |
+                            (static_cast<uint8_t>(out_buffer[12]) << 8) |
+                            (static_cast<uint8_t>(out_buffer[13]) << 16);
+  EXPECT_EQ(out_buffer.size(), stream_identifier.size() + 4 + chunk_length);
+}
+
+TEST_F(CsvWriterTest, UnsupportedCompression)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0{1, 2, 3};
+  cudf::table_view const input{{col0}};
+
+  std::vector<char> out_buffer;
+  EXPECT_THROW(cudf::io::csv_writer_options::builder(cudf::io::sink_info{&out_buffer}, input)
+                 .compression(cudf::io::compression_type::BZIP2),
+               cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
@@ -1279,6 +1389,44 @@ TEST_F(CsvReaderTest, TypeInferenceThousands)
   expect_column_data_equal(dbl_col, result_view.column(2));
 }
 
+TEST_F(CsvReaderTest, TypeInferenceSampling)
+{
+  constexpr int num_rows = 100;
+  std::string buffer;
+  for (int i = 0; i < num_rows; ++i) {
+    buffer += std::to_string(i) + "," + std::to_string(i * 2);
+    // A value that is not an integer, outside of the sampled rows
+    buffer += (i == num_rows - 2) ? ",abc\n" : "," + std::to_string(i) + "\n";
+  }
+
+  for (auto const sampling : {cudf::io::csv_type_inference_sampling_t::HEAD,
+                              cudf::io::csv_type_inference_sampling_t::UNIFORM}) {
+    cudf::io::csv_reader_options in_opts =
+      cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+        .header(-1)
+        .type_inference_rows(10)
+        .type_inference_sampling(sampling);
+    auto const result      = cudf::io::read_csv(in_opts);
+    auto const result_view = result.tbl->view();
+
+    ASSERT_EQ(result_view.num_columns(), 3);
+    EXPECT_EQ(result_view.column(0).type().id(), type_id::INT64);
+    EXPECT_EQ(result_view.column(1).type().id(), type_id::INT64);
+    // Falls back to inferring from all rows
+    EXPECT_EQ(result_view.column(2).type().id(), type_id::STRING);
+    EXPECT_EQ(result_view.column(2).null_count(), 0);
+
+    std::vector<int64_t> first_col(num_rows);
+    std::iota(first_col.begin(), first_col.end(), 0);
+    expect_column_data_equal(first_col, result_view.column(0));
+  }
+
+  EXPECT_THROW(cudf::io::csv_reader_options::builder(
+                 cudf::io::source_info{buffer.c_str(), buffer.size()})
+                 .type_inference_rows(0),
+               cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, TypeInferenceWithDecimal)
 {
   // Given that thousands:'`' and decimal(';'), we expect:
@@ -2540,4 +2688,63 @@ TEST_F(CsvReaderTest, UTF8BOM)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result_view, expected);
 }
 
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  auto filepath = temp_env->get_temp_dir() + "ChunkedReader.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,name,score,flag\n";
+    for (int i = 0; i < 500; ++i) {
+      outfile << i << ",name" << i << "," << i * 0.5 << "," << (i % 3 == 0 ? "True" : "False")
+              << "\n";
+    }
+  }
+
+  auto const all_columns      = std::vector<std::string>{};
+  auto const selected_columns = std::vector<std::string>{"score", "id"};
+  for (auto const& use_cols : {all_columns, selected_columns}) {
+    cudf::io::csv_reader_options in_opts =
+      cudf::io::csv_reader_options::builder(cudf::io::source_info{filepath})
+        .use_cols_names(use_cols);
+    auto const expected = cudf::io::read_csv(in_opts);
+
+    // Chunks smaller than the header and its first row extend the first chunk
+    for (std::size_t chunk_size : {0, 13, 100, 1024, 1 << 20}) {
+      auto const reader = cudf::io::chunked_csv_reader(chunk_size, in_opts);
+
+      std::vector<cudf::io::table_with_metadata> tables;
+      while (reader.has_next()) {
+        tables.push_back(reader.read_chunk());
+      }
+      ASSERT_FALSE(tables.empty());
+
+      std::vector<cudf::table_view> table_views;
+      for (auto const& table : tables) {
+        // All chunks have the names and types of the first chunk
+        ASSERT_EQ(table.metadata.schema_info.size(), expected.metadata.schema_info.size());
+        for (std::size_t i = 0; i < table.metadata.schema_info.size(); ++i) {
+          EXPECT_EQ(table.metadata.schema_info[i].name, expected.metadata.schema_info[i].name);
+        }
+        table_views.push_back(table.tbl->view());
+      }
+      auto const result = cudf::concatenate(table_views);
+
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.tbl->view(), result->view());
+    }
+  }
+}
+
+TEST_F(CsvReaderTest, ChunkedReaderUnsupportedOptions)
+{
+  std::string buffer = "a,b\n1,2\n3,4\n";
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .nrows(1);
+  EXPECT_THROW(cudf::io::chunked_csv_reader(4, in_opts), cudf::logic_error);
+
+  in_opts.set_nrows(-1);
+  in_opts.set_byte_range_size(4);
+  EXPECT_THROW(cudf::io::chunked_csv_reader(4, in_opts), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
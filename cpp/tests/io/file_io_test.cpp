@@ -18,9 +18,14 @@
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <cudf/io/datasource.hpp>
+
 #include <src/io/utilities/file_io_utilities.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 // Base test fixture for tests
 struct CuFileIOTest : public cudf::test::BaseFixture {};
@@ -43,4 +48,72 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+// Host memory source that counts the read requests it receives
+class counting_source : public cudf::io::datasource {
+ public:
+  explicit counting_source(std::vector<uint8_t> data) : _data(std::move(data)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    size = std::min(size, _data.size() - offset);
+    return std::make_unique<non_owning_buffer>(_data.data() + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    size = std::min(size, _data.size() - offset);
+    std::copy_n(_data.data() + offset, size, dst);
+    return size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+  int num_reads = 0;
+
+ private:
+  std::vector<uint8_t> _data;
+};
+
+TEST_F(CuFileIOTest, HostReadRangesCoalescing)
+{
+  std::vector<uint8_t> data(1 << 20);
+  std::iota(data.begin(), data.end(), 0);
+
+  // unordered ranges; the last one is truncated by the end of the source
+  std::vector<cudf::io::datasource::read_range> const ranges{
+    {200'000, 16}, {0, 10}, {20, 10}, {(1 << 20) - 4, 8}};
+
+  auto const test_cases = {std::pair{size_t{0}, 4}, std::pair{size_t{100}, 3}};
+  for (auto const [max_gap, expected_reads] : test_cases) {
+    counting_source source(data);
+    std::vector<std::vector<uint8_t>> outputs;
+    std::vector<uint8_t*> dsts;
+    for (auto const& range : ranges) {
+      dsts.push_back(outputs.emplace_back(range.size, 0).data());
+    }
+
+    auto const bytes_read = source.host_read_ranges(ranges, dsts, max_gap);
+    EXPECT_EQ(source.num_reads, expected_reads);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      auto const expected_size = std::min(ranges[i].size, data.size() - ranges[i].offset);
+      ASSERT_EQ(bytes_read[i], expected_size);
+      EXPECT_TRUE(std::equal(outputs[i].begin(),
+                             outputs[i].begin() + expected_size,
+                             data.begin() + ranges[i].offset));
+    }
+  }
+
+  // everything is read at once with a large enough gap
+  counting_source source(data);
+  std::vector<std::vector<uint8_t>> outputs;
+  std::vector<uint8_t*> dsts;
+  for (auto const& range : ranges) {
+    dsts.push_back(outputs.emplace_back(range.size, 0).data());
+  }
+  source.host_read_ranges(ranges, dsts, 1 << 20);
+  EXPECT_EQ(source.num_reads, 1);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
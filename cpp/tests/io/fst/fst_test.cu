@@ -211,4 +211,71 @@ TEST_F(FstTest, GroundTruth)
   CUDF_TEST_EXPECT_VECTOR_EQUAL(out_indexes_gpu, out_index_cpu, output_cpu.size());
 }
 
+TEST_F(FstTest, GroundTruthPartialBlocks)
+{
+  // Type used to represent the atomic symbol type used within the finite-state machine
+  using SymbolT = char;
+
+  // Type sufficiently large to index symbols within the input and output (may be unsigned)
+  using SymbolOffsetT = uint32_t;
+
+  // Prepare cuda stream for data transfers & kernels
+  rmm::cuda_stream stream{};
+  rmm::cuda_stream_view stream_view(stream);
+
+  // Test input
+  std::string input = R"({"a": "x\"y", "b": [1, {"c": "}"}], "d": null} )"
+                      R"([{"e": "\\"}, "[", 3.5] )";
+
+  auto d_input_scalar                = cudf::make_string_scalar(input);
+  auto& d_string_scalar              = static_cast<cudf::string_scalar&>(*d_input_scalar);
+  cudf::size_type const repeat_times = 211;
+  auto d_input_string                = cudf::strings::repeat_string(d_string_scalar, repeat_times);
+  auto& d_input = static_cast<cudf::scalar_type_t<std::string>&>(*d_input_string);
+  input         = d_input.to_string(stream);
+
+  auto parser = cudf::io::fst::detail::make_fst(
+    cudf::io::fst::detail::make_symbol_group_lut(pda_sgs),
+    cudf::io::fst::detail::make_transition_table(pda_state_tt),
+    cudf::io::fst::detail::make_translation_table<TT_NUM_STATES * NUM_SYMBOL_GROUPS>(pda_out_tt),
+    stream);
+
+  // Odd numbers of symbols and partial blocks end in a single symbol that is not read in a pair
+  for (std::size_t num_symbols : {1ul, 2ul, 31ul, 33ul, 4097ul, 8191ul, input.size()}) {
+    constexpr std::size_t single_item = 1;
+    cudf::detail::hostdevice_vector<SymbolT> output_gpu(num_symbols, stream_view);
+    cudf::detail::hostdevice_vector<SymbolOffsetT> output_gpu_size(single_item, stream_view);
+    cudf::detail::hostdevice_vector<SymbolOffsetT> out_indexes_gpu(num_symbols, stream_view);
+
+    parser.Transduce(d_input.data(),
+                     static_cast<SymbolOffsetT>(num_symbols),
+                     output_gpu.device_ptr(),
+                     out_indexes_gpu.device_ptr(),
+                     output_gpu_size.device_ptr(),
+                     start_state,
+                     stream.value());
+
+    output_gpu.device_to_host_async(stream.view());
+    out_indexes_gpu.device_to_host_async(stream.view());
+    output_gpu_size.device_to_host_async(stream.view());
+
+    std::string output_cpu{};
+    std::vector<SymbolOffsetT> out_index_cpu{};
+    fst_baseline(input.cbegin(),
+                 input.cbegin() + num_symbols,
+                 start_state,
+                 pda_sgs,
+                 pda_state_tt,
+                 pda_out_tt,
+                 std::back_inserter(output_cpu),
+                 std::back_inserter(out_index_cpu));
+
+    stream.synchronize();
+
+    ASSERT_EQ(output_gpu_size[0], output_cpu.size());
+    CUDF_TEST_EXPECT_VECTOR_EQUAL(output_gpu, output_cpu, output_cpu.size());
+    CUDF_TEST_EXPECT_VECTOR_EQUAL(out_indexes_gpu, out_index_cpu, output_cpu.size());
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -230,3 +230,54 @@ TEST_F(JsonReaderTest, ByteRange_MultiSource)
     CUDF_TEST_EXPECT_TABLES_EQUIVALENT(current_reader_table.tbl->view(), result->view());
   }
 }
+
+TEST_F(JsonReaderTest, ChunkedReader)
+{
+  std::string const json_string = R"(
+    { "a": { "y" : 6}, "b" : [1, 2, 3], "c": 11 }
+    { "a": { "y" : 7}, "b" : [4, 5   ]          }
+    { "a": { "y" : 8}, "b" : [6      ], "c": 13 }
+    {                  "b" : [7      ], "c": 14 })";
+
+  cudf::io::json_reader_options json_lines_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.c_str(), json_string.size()})
+      .lines(true);
+
+  auto const expected = cudf::io::read_json(json_lines_options);
+
+  // Test for different chunk sizes, including one that reads the whole input at once
+  for (std::size_t chunk_size : {0, 7, 10, 15, 20, 40, 50, 100, 200, 500}) {
+    auto const reader = cudf::io::chunked_json_reader(chunk_size, json_lines_options);
+
+    std::vector<cudf::io::table_with_metadata> tables;
+    while (reader.has_next()) {
+      tables.push_back(reader.read_chunk());
+    }
+    ASSERT_FALSE(tables.empty());
+
+    auto table_views = std::vector<cudf::table_view>(tables.size());
+    std::transform(tables.begin(), tables.end(), table_views.begin(), [](auto& table) {
+      return table.tbl->view();
+    });
+    auto result = cudf::concatenate(table_views);
+
+    // All chunks follow the schema of the first chunk, including the column missing from some
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.tbl->view(), result->view());
+    EXPECT_EQ(tables.back().metadata.schema_info.size(), expected.metadata.schema_info.size());
+  }
+}
+
+TEST_F(JsonReaderTest, ChunkedReaderUnsupportedOptions)
+{
+  std::string const json_string = R"([{"a": 1}, {"a": 2}])";
+
+  cudf::io::json_reader_options json_options = cudf::io::json_reader_options::builder(
+    cudf::io::source_info{json_string.c_str(), json_string.size()});
+
+  EXPECT_THROW(cudf::io::chunked_json_reader(10, json_options), cudf::logic_error);
+
+  json_options.enable_lines(true);
+  json_options.set_byte_range_size(5);
+  EXPECT_THROW(cudf::io::chunked_json_reader(10, json_options), cudf::logic_error);
+}
@@ -2714,4 +2714,81 @@ TEST_F(JsonReaderTest, JsonNestedDtypeFilter)
   }
 }
 
+TEST_F(JsonReaderTest, JsonSelectColumns)
+{
+  std::string json_stringl = R"(
+    {"a": 1, "b": {"0": "abc", "1": [-1.]}, "c": true, "d": [{"x": 1, "y": "u"}]}
+    {"a": 2, "b": {"0": "def"          }, "c": false}
+    {"a": 3, "b": {}, "d": [{"x": 3}, {"y": "v"}]}
+    {"a": 4,                              "c": null}
+    )";
+  std::string json_string  = R"([
+    {"a": 1, "b": {"0": "abc", "1": [-1.]}, "c": true, "d": [{"x": 1, "y": "u"}]},
+    {"a": 2, "b": {"0": "def"          }, "c": false},
+    {"a": 3, "b": {}, "d": [{"x": 3}, {"y": "v"}]},
+    {"a": 4,                              "c": null}
+    ])";
+  for (auto& [json_string, lines] : {std::pair{json_stringl, true}, {json_string, false}}) {
+    cudf::io::json_reader_options in_options =
+      cudf::io::json_reader_options::builder(
+        cudf::io::source_info{json_string.data(), json_string.size()})
+        .lines(lines);
+
+    // top level columns
+    {
+      in_options.set_columns({"c", "a"});
+      cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+      // Columns are returned in the order of the input
+      ASSERT_EQ(result.tbl->num_columns(), 2);
+      ASSERT_EQ(result.metadata.schema_info.size(), 2);
+      EXPECT_EQ(result.metadata.schema_info[0].name, "a");
+      EXPECT_EQ(result.metadata.schema_info[1].name, "c");
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{1, 2, 3, 4});
+    }
+    // a child of a struct, and a selected struct with all of its children
+    {
+      in_options.set_columns({"b.0", "d"});
+      cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+      ASSERT_EQ(result.tbl->num_columns(), 2);
+      ASSERT_EQ(result.metadata.schema_info.size(), 2);
+      EXPECT_EQ(result.metadata.schema_info[0].name, "b");
+      EXPECT_EQ(result.metadata.schema_info[1].name, "d");
+      ASSERT_EQ(result.metadata.schema_info[0].children.size(), 1);
+      EXPECT_EQ(result.metadata.schema_info[0].children[0].name, "0");
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+        result.tbl->get_column(0).child(0),
+        cudf::test::strings_column_wrapper{{"abc", "def", "", ""}, {1, 1, 0, 0}});
+      ASSERT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::LIST);
+      EXPECT_EQ(result.tbl->get_column(1).child(1).num_children(), 2);
+    }
+    // a child of the structs in a list column
+    {
+      in_options.set_columns({"d.y"});
+      cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+      ASSERT_EQ(result.tbl->num_columns(), 1);
+      ASSERT_EQ(result.metadata.schema_info.size(), 1);
+      EXPECT_EQ(result.metadata.schema_info[0].name, "d");
+      auto const& element_info = result.metadata.schema_info[0].children[1];
+      ASSERT_EQ(element_info.children.size(), 1);
+      EXPECT_EQ(element_info.children[0].name, "y");
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+        result.tbl->get_column(0).child(1).child(0),
+        cudf::test::strings_column_wrapper{{"u", "", "v"}, {1, 0, 1}});
+    }
+    // selection combined with pruning by data types
+    {
+      in_options.set_columns({"a", "c"});
+      in_options.set_dtypes(std::map<std::string, data_type>{{"a", dtype<int32_t>()},
+                                                             {"b", data_type{type_id::STRUCT}}});
+      in_options.enable_prune_columns(true);
+      cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+      ASSERT_EQ(result.tbl->num_columns(), 1);
+      EXPECT_EQ(result.metadata.schema_info[0].name, "a");
+      EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT32);
+      in_options.enable_prune_columns(false);
+      in_options.set_dtypes(std::map<std::string, data_type>{});
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -18,8 +18,11 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/default_stream.hpp>
 #include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <src/io/comp/nvcomp_adapter.hpp>
+
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/json.hpp>
 #include <cudf/io/types.hpp>
@@ -140,6 +143,83 @@ TEST_F(JsonWriterTest, PlainTable)
   EXPECT_EQ(expected, std::string(out_buffer.data(), out_buffer.size()));
 }
 
+TEST_F(JsonWriterTest, FlatTypes)
+{
+  cudf::test::strings_column_wrapper col1{{"a\"b", "", "tab\t"},
+                                          cudf::test::iterators::null_at(1)};
+  cudf::test::fixed_width_column_wrapper<bool> col2{{true, false, true},
+                                                    cudf::test::iterators::null_at(2)};
+  cudf::test::fixed_width_column_wrapper<int64_t> col3{-9223372036854775807L - 1, 0, 42};
+  cudf::test::fixed_width_column_wrapper<uint8_t> col4{{255, 0, 7},
+                                                       cudf::test::iterators::null_at(0)};
+  cudf::test::fixed_point_column_wrapper<int32_t> col5{{12345, -5, 0}, numeric::scale_type{-2}};
+  cudf::table_view tbl_view{{col1, col2, col3, col4, col5}};
+  cudf::io::table_metadata mt{{{"str"}, {"bool"}, {"int64"}, {"uint8"}, {"decimal"}}};
+
+  std::vector<char> out_buffer;
+  auto destination     = cudf::io::sink_info(&out_buffer);
+  auto options_builder = cudf::io::json_writer_options_builder(destination, tbl_view)
+                           .include_nulls(false)
+                           .metadata(mt)
+                           .lines(true)
+                           .na_rep("null");
+
+  cudf::io::write_json(options_builder.build(),
+                       cudf::test::get_default_stream(),
+                       rmm::mr::get_current_device_resource());
+  std::string const expected = R"({"str":"a\"b","bool":true,"int64":-9223372036854775808,"decimal":123.45}
+{"bool":false,"int64":0,"uint8":0,"decimal":-0.05}
+{"str":"tab\t","int64":42,"uint8":7,"decimal":0.00}
+)";
+  EXPECT_EQ(expected, std::string(out_buffer.data(), out_buffer.size()));
+
+  out_buffer.clear();
+  cudf::io::write_json(options_builder.include_nulls(true).lines(false).build(),
+                       cudf::test::get_default_stream(),
+                       rmm::mr::get_current_device_resource());
+  std::string const expected_with_nulls =
+    R"([{"str":"a\"b","bool":true,"int64":-9223372036854775808,"uint8":null,"decimal":123.45},)"
+    R"({"str":null,"bool":false,"int64":0,"uint8":0,"decimal":-0.05},)"
+    R"({"str":"tab\t","bool":null,"int64":42,"uint8":7,"decimal":0.00}])";
+  EXPECT_EQ(expected_with_nulls, std::string(out_buffer.data(), out_buffer.size()));
+}
+
+TEST_F(JsonWriterTest, CompressedGzip)
+{
+  if (cudf::io::nvcomp::is_compression_disabled(cudf::io::nvcomp::compression_type::DEFLATE)) {
+    GTEST_SKIP() << "nvCOMP DEFLATE compression is disabled";
+  }
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col1(sequence, sequence + 50000);
+  cudf::test::fixed_width_column_wrapper<double> col2(sequence, sequence + 50000);
+  cudf::table_view tbl_view{{col1, col2}};
+  cudf::io::table_metadata mt{{{"a"}, {"b"}}};
+
+  std::vector<char> out_buffer;
+  auto destination     = cudf::io::sink_info(&out_buffer);
+  auto options_builder = cudf::io::json_writer_options_builder(destination, tbl_view)
+                           .metadata(mt)
+                           .lines(true)
+                           .rows_per_chunk(20000)
+                           .compression(cudf::io::compression_type::GZIP);
+
+  cudf::io::write_json(options_builder.build(),
+                       cudf::test::get_default_stream(),
+                       rmm::mr::get_current_device_resource());
+
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+      .lines(true)
+      .dtypes(std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT64},
+                                           cudf::data_type{cudf::type_id::FLOAT64}})
+      .compression(cudf::io::compression_type::GZIP);
+  auto const result = cudf::io::read_json(in_options);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(tbl_view, result.tbl->view());
+}
+
 TEST_F(JsonWriterTest, SimpleNested)
 {
   std::string const data = R"(
@@ -44,6 +44,10 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+
 namespace {
 enum class output_limit : std::size_t {};
 enum class input_limit : std::size_t {};
@@ -1081,6 +1085,54 @@ TEST_F(OrcChunkedReaderInputLimitTest, SingleFixedWidthColumn)
   }
 }
 
+TEST_F(OrcChunkedReaderInputLimitTest, ChunkStatistics)
+{
+  auto constexpr num_rows = 1'000'000;
+  auto const iter1        = thrust::make_counting_iterator(0);
+  auto const col1         = int32s_col(iter1, iter1 + num_rows);
+
+  auto const filepath = temp_env->get_temp_filepath("chunk_statistics.orc");
+  auto const input    = cudf::table_view{{col1}};
+  input_limit_test_write_one(filepath, input, 20'000, cudf::io::compression_type::SNAPPY);
+
+  auto const stats = std::make_shared<cudf::io::reader_chunk_statistics>();
+  auto const read_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .chunk_statistics(stats)
+      .build();
+  auto reader = cudf::io::chunked_orc_reader(0UL, 2 * 1024 * 1024UL, read_opts);
+
+  // chunks split from a decoded table may not read nor decode anything, so check the totals
+  cudf::io::reader_chunk_statistics total;
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  do {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    total.num_bytes_read += stats->num_bytes_read;
+    total.num_compressed_bytes += stats->num_compressed_bytes;
+    total.num_decompressed_bytes += stats->num_decompressed_bytes;
+    total.num_pages_decoded += stats->num_pages_decoded;
+    total.peak_temp_memory_bytes =
+      std::max(total.peak_temp_memory_bytes, stats->peak_temp_memory_bytes);
+    total.decode_time += stats->decode_time;
+  } while (reader.has_next());
+
+  EXPECT_GT(chunks.size(), 1);
+  EXPECT_GT(total.num_bytes_read, 0);
+  EXPECT_LE(total.num_bytes_read, std::filesystem::file_size(filepath));
+  EXPECT_GT(total.num_compressed_bytes, 0);
+  EXPECT_GT(total.num_decompressed_bytes, 0);
+  // every stripe is decoded once
+  EXPECT_EQ(total.num_pages_decoded, num_rows / 20'000);
+  EXPECT_GT(total.peak_temp_memory_bytes, 0);
+  EXPECT_GT(total.decode_time.count(), 0);
+
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& t) {
+    return t->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), input);
+}
+
 TEST_F(OrcChunkedReaderInputLimitTest, MixedColumns)
 {
   auto constexpr num_rows = 1'000'000;
@@ -25,12 +25,14 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -1145,6 +1147,140 @@ TEST_F(OrcReaderTest, SingleInputs)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *table1);
 }
 
+TEST_F(OrcReaderTest, FilterStripes)
+{
+  constexpr auto num_rows = 30'000;
+  auto sequence           = thrust::make_counting_iterator(0);
+  auto strings            = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 100); });
+  int32_col col0(sequence, sequence + num_rows);
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .stripe_size_rows(10'000)
+      .row_index_stride(1'000);
+  cudf::io::write_orc(out_opts);
+  auto const source = cudf::io::source_info{out_buffer.data(), out_buffer.size()};
+  ASSERT_EQ(cudf::io::read_orc_metadata(source).num_stripes(), 3);
+
+  // Only rows of the first stripe pass the filter
+  auto value   = cudf::numeric_scalar<int32_t>{2'500};
+  auto literal = cudf::ast::literal{value};
+  auto col_ref = cudf::ast::column_reference(0);
+  auto filter  = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, literal);
+
+  for (bool use_index : {true, false}) {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(filter).use_index(use_index);
+    auto const result = cudf::io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {0, 2'500})[0], result.tbl->view());
+  }
+
+  // Rows of the middle stripe, bounded on both sides
+  auto low_value    = cudf::numeric_scalar<int32_t>{12'000};
+  auto high_value   = cudf::numeric_scalar<int32_t>{15'000};
+  auto low_literal  = cudf::ast::literal{low_value};
+  auto high_literal = cudf::ast::literal{high_value};
+  auto low_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, low_literal);
+  auto high_filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, high_literal);
+  auto range_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, low_filter, high_filter);
+  {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(range_filter);
+    auto const result = cudf::io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12'000, 15'000})[0],
+                                  result.tbl->view());
+  }
+
+  // No rows pass the filter
+  auto none_value   = cudf::numeric_scalar<int32_t>{-1};
+  auto none_literal = cudf::ast::literal{none_value};
+  auto none_filter  = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, none_literal);
+  {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(none_filter);
+    auto const result = cudf::io::read_orc(in_opts);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(OrcReaderTest, FilterStripesBloomFilter)
+{
+  constexpr auto num_rows = 30'000;
+  auto evens   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "str" + std::to_string(i * 2); });
+  int32_col col0(evens, evens + num_rows);
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_bloom_filter_fpp(0.01);
+  expected_metadata.column_metadata[1].set_bloom_filter_fpp(0.01);
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .metadata(expected_metadata)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .stripe_size_rows(10'000)
+      .row_index_stride(1'000);
+  cudf::io::write_orc(out_opts);
+  auto const source = cudf::io::source_info{out_buffer.data(), out_buffer.size()};
+  ASSERT_EQ(cudf::io::read_orc_metadata(source).num_stripes(), 3);
+
+  // The bloom filter streams do not affect reading the data
+  {
+    auto const result = cudf::io::read_orc(cudf::io::orc_reader_options::builder(source));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  auto col_ref = cudf::ast::column_reference(0);
+  auto str_ref = cudf::ast::column_reference(1);
+
+  // A value within the statistics range of the middle stripe
+  auto value   = cudf::numeric_scalar<int32_t>{24'002};
+  auto literal = cudf::ast::literal{value};
+  auto filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, literal);
+  {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(filter);
+    auto const result = cudf::io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12'001, 12'002})[0], result.tbl->view());
+  }
+
+  // Values within the statistics ranges that are not in the column
+  auto odd_value   = cudf::numeric_scalar<int32_t>{24'001};
+  auto odd_literal = cudf::ast::literal{odd_value};
+  auto odd_filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, odd_literal);
+  auto str_value   = cudf::string_scalar{"str24001"};
+  auto str_literal = cudf::ast::literal{str_value};
+  auto str_filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, str_ref, str_literal);
+  for (auto const* none_filter : {&odd_filter, &str_filter}) {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(*none_filter);
+    auto const result = cudf::io::read_orc(in_opts);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+
+  // Either of the values; the bloom filters do not prune the stripe of the present value
+  auto either_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, filter, str_filter);
+  {
+    cudf::io::orc_reader_options in_opts =
+      cudf::io::orc_reader_options::builder(source).filter(either_filter);
+    auto const result = cudf::io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12'001, 12'002})[0], result.tbl->view());
+  }
+}
+
 TEST_F(OrcReaderTest, zstdCompressionRegression)
 {
   if (cudf::io::nvcomp::is_decompression_disabled(cudf::io::nvcomp::compression_type::ZSTD)) {
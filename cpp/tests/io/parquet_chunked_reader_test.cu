@@ -48,7 +48,10 @@
 #include <src/io/parquet/compact_protocol_reader.hpp>
 #include <src/io/parquet/parquet.hpp>
 
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <memory>
 #include <type_traits>
 
 namespace {
@@ -113,10 +116,13 @@ auto write_file(std::vector<std::unique_ptr<cudf::column>>& input_columns,
 
 auto chunked_read(std::vector<std::string> const& filepaths,
                   std::size_t output_limit,
-                  std::size_t input_limit = 0)
+                  std::size_t input_limit = 0,
+                  bool prefetch_next_pass = false)
 {
-  auto const read_opts =
-    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepaths}).build();
+  auto const read_opts = cudf::io::parquet_reader_options::builder(
+                           cudf::io::source_info{filepaths})
+                           .prefetch_next_pass(prefetch_next_pass)
+                           .build();
   auto reader = cudf::io::chunked_parquet_reader(output_limit, input_limit, read_opts);
 
   auto num_chunks = 0;
@@ -143,10 +149,11 @@ auto chunked_read(std::vector<std::string> const& filepaths,
 
 auto chunked_read(std::string const& filepath,
                   std::size_t output_limit,
-                  std::size_t input_limit = 0)
+                  std::size_t input_limit = 0,
+                  bool prefetch_next_pass = false)
 {
   std::vector<std::string> vpath{filepath};
-  return chunked_read(vpath, output_limit, input_limit);
+  return chunked_read(vpath, output_limit, input_limit, prefetch_next_pass);
 }
 
 }  // namespace
@@ -1159,6 +1166,88 @@ TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, MixedColumns)
   input_limit_test_read(test_filenames, tbl, 0, 1, expected_b);
 }
 
+TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, PrefetchNextPass)
+{
+  auto const filepath = temp_env->get_temp_filepath("prefetch_next_pass.parquet");
+
+  constexpr auto num_rows = 1'000'000;
+
+  auto iter1 = thrust::make_counting_iterator<int>(0);
+  cudf::test::fixed_width_column_wrapper<int> col1(iter1, iter1 + num_rows);
+
+  auto const strings  = std::vector<std::string>{"abc", "de", "fghi"};
+  auto const str_iter = cudf::detail::make_counting_transform_iterator(
+    0, [&](int32_t i) { return strings[i % strings.size()]; });
+  auto col2 = strings_col(str_iter, str_iter + num_rows);
+
+  auto tbl = cudf::table_view{{col1, col2}};
+
+  // several row groups so that the input is read in several passes
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .row_group_size_rows(100'000);
+  cudf::io::write_parquet(out_opts);
+
+  for (auto const input_limit : {std::size_t{1}, std::size_t{2 * 1024 * 1024}}) {
+    auto const [expected, expected_num_chunks] = chunked_read(filepath, 0, input_limit, false);
+    auto const [result, num_chunks]            = chunked_read(filepath, 0, input_limit, true);
+    EXPECT_EQ(num_chunks, expected_num_chunks);
+    EXPECT_GT(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, *expected);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*result, tbl);
+  }
+}
+
+TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, ChunkStatistics)
+{
+  auto const filepath = temp_env->get_temp_filepath("chunk_statistics.parquet");
+
+  constexpr auto num_rows = 1'000'000;
+
+  auto iter1 = thrust::make_counting_iterator<int>(0);
+  cudf::test::fixed_width_column_wrapper<int> col1(iter1, iter1 + num_rows);
+  auto tbl = cudf::table_view{{col1}};
+
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .row_group_size_rows(100'000);
+  cudf::io::write_parquet(out_opts);
+
+  auto const stats = std::make_shared<cudf::io::reader_chunk_statistics>();
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .chunk_statistics(stats)
+      .build();
+  auto reader = cudf::io::chunked_parquet_reader(0, 1024 * 1024, read_opts);
+
+  std::size_t total_bytes_read = 0;
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  do {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    // every chunk decodes pages, and there are no empty chunks here
+    EXPECT_GT(stats->num_pages_decoded, 0);
+    EXPECT_GT(stats->decode_time.count(), 0);
+    total_bytes_read += stats->num_bytes_read;
+    if (stats->num_bytes_read > 0) {
+      EXPECT_GT(stats->num_compressed_bytes, 0);
+      EXPECT_GT(stats->num_decompressed_bytes, 0);
+      EXPECT_GT(stats->peak_temp_memory_bytes, 0);
+    }
+  } while (reader.has_next());
+
+  EXPECT_GT(chunks.size(), 1);
+  EXPECT_GT(total_bytes_read, 0);
+  EXPECT_LE(total_bytes_read, std::filesystem::file_size(filepath));
+
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& t) {
+    return t->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::concatenate(views), tbl);
+}
+
 struct ParquetChunkedReaderInputLimitTest : public cudf::test::BaseFixture {};
 
 struct offset_gen {
@@ -23,12 +23,20 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+
 TEST_F(ParquetReaderTest, UserBounds)
 {
   // trying to read more rows than there are should result in
@@ -1171,6 +1179,99 @@ TEST_F(ParquetReaderTest, StructByteArray)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, StructFixedWidth)
+{
+  // fixed width columns nested in structs without lists are decoded by the fixed width kernels
+  constexpr auto num_rows = 20000;
+
+  auto const values       = thrust::make_counting_iterator(0);
+  auto const small_values = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return (i * 7) % 50; });
+  auto const every_third = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 3 != 0; });
+  auto const every_fifth = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 5 != 0; });
+
+  column_wrapper<int32_t> ints(small_values, small_values + num_rows, every_third);
+  column_wrapper<int64_t> longs(values, values + num_rows);
+  column_wrapper<double> doubles(values, values + num_rows, every_third);
+  auto inner = cudf::test::structs_column_wrapper{{doubles}, every_fifth};
+  auto outer = cudf::test::structs_column_wrapper{{ints, longs, inner}, every_fifth};
+
+  auto const expected = table_view{{outer}};
+
+  auto const policies = {cudf::io::dictionary_policy::ALWAYS, cudf::io::dictionary_policy::NEVER};
+  for (auto const policy : policies) {
+    auto filepath = temp_env->get_temp_filepath("StructFixedWidth.parquet");
+    cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+        .dictionary_policy(policy)
+        .max_page_size_rows(5000);
+    cudf::io::write_parquet(out_opts);
+
+    cudf::io::parquet_reader_options in_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+    auto result = cudf::io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    // skip_rows / num_rows within and across pages
+    for (auto const [skip_rows, read_rows] : {std::pair{1, 100}, std::pair{4999, 5002}}) {
+      in_opts.set_skip_rows(skip_rows);
+      in_opts.set_num_rows(read_rows);
+      auto sliced_result = cudf::io::read_parquet(in_opts);
+      auto const expected_slice =
+        cudf::slice(expected, {skip_rows, skip_rows + read_rows}).front();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_slice, sliced_result.tbl->view());
+    }
+  }
+}
+
+TEST_F(ParquetReaderTest, OutputMemoryResources)
+{
+  constexpr auto num_rows = 1000;
+  auto const values       = thrust::make_counting_iterator(0);
+  auto const validity     = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 3 != 0; });
+
+  auto const words = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return std::string(i % 5, 'a'); });
+
+  column_wrapper<int32_t> ints(values, values + num_rows, validity);
+  cudf::test::strings_column_wrapper strings(words, words + num_rows);
+  auto const expected = table_view{{ints, strings}};
+
+  auto filepath = temp_env->get_temp_filepath("OutputMemoryResources.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected);
+  cudf::io::write_parquet(out_opts);
+
+  using stats_mr = rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>;
+  stats_mr ints_mr(rmm::mr::get_current_device_resource());
+  stats_mr strings_mr(rmm::mr::get_current_device_resource());
+
+  {
+    cudf::io::parquet_reader_options in_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .output_memory_resources({ints_mr, strings_mr});
+    auto result = cudf::io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    // the output columns are the only live allocations from their resources
+    auto const ints_bytes =
+      num_rows * sizeof(int32_t) + cudf::bitmask_allocation_size_bytes(num_rows);
+    EXPECT_GE(ints_mr.get_bytes_counter().value, static_cast<int64_t>(ints_bytes));
+    EXPECT_GT(strings_mr.get_bytes_counter().value, 0);
+  }
+  EXPECT_EQ(ints_mr.get_bytes_counter().value, 0);
+  EXPECT_EQ(strings_mr.get_bytes_counter().value, 0);
+
+  // one resource is required per output column
+  cudf::io::parquet_reader_options bad_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .output_memory_resources({ints_mr});
+  EXPECT_THROW(cudf::io::read_parquet(bad_opts), std::invalid_argument);
+}
+
 TEST_F(ParquetReaderTest, NestingOptimizationTest)
 {
   // test nesting levels > cudf::io::parquet::detail::max_cacheable_nesting_decode_info deep.
@@ -1325,6 +1426,104 @@ TEST_F(ParquetReaderTest, ReorderedReadMultipleFiles)
   CUDF_TEST_EXPECT_TABLES_EQUAL(sliced[1], swapped2);
 }
 
+TEST_F(ParquetReaderTest, ReadManySmallFiles)
+{
+  constexpr auto num_files     = 64;
+  constexpr auto rows_per_file = 100;
+
+  std::vector<std::string> filepaths;
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  for (int f = 0; f < num_files; ++f) {
+    auto ints = cudf::detail::make_counting_transform_iterator(
+      0, [f](auto i) { return f * rows_per_file + i; });
+    auto col0 = cudf::test::fixed_width_column_wrapper<int>(ints, ints + rows_per_file);
+    auto strs = cudf::detail::make_counting_transform_iterator(
+      0, [f](auto i) { return "file " + std::to_string(f) + " row " + std::to_string(i); });
+    auto col1 = cudf::test::strings_column_wrapper(strs, strs + rows_per_file);
+    tables.push_back(std::make_unique<cudf::table>(table_view{{col0, col1}}));
+
+    filepaths.push_back(
+      temp_env->get_temp_filepath("ReadManySmallFiles" + std::to_string(f) + ".parquet"));
+    auto out_opts = cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepaths.back()},
+                                                              tables.back()->view());
+    cudf::io::write_parquet(out_opts);
+  }
+
+  std::vector<table_view> views;
+  std::transform(
+    tables.begin(), tables.end(), std::back_inserter(views), [](auto& t) { return t->view(); });
+  auto const expected = cudf::concatenate(views);
+
+  // footers and column chunks of all files are read concurrently; the output keeps file order
+  auto read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepaths}).build();
+  auto const result = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  auto const filepath   = temp_env->get_temp_filepath("MetadataCache.parquet");
+  auto const write_file = [&](int num_rows) {
+    auto values = thrust::make_counting_iterator(0);
+    auto col    = cudf::test::fixed_width_column_wrapper<int>(values, values + num_rows);
+    auto tbl    = std::make_unique<cudf::table>(table_view{{col}});
+    auto out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl->view());
+    cudf::io::write_parquet(out_opts);
+    return tbl;
+  };
+
+  auto cache = std::make_shared<cudf::io::parquet_metadata_cache>(1024 * 1024);
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .metadata_cache(cache)
+      .build();
+
+  auto const expected = write_file(1000);
+  for (int i = 0; i < 2; ++i) {
+    auto const result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+    EXPECT_EQ(cache->num_entries(), 1);
+    EXPECT_GT(cache->size_bytes(), 0);
+  }
+
+  // a modified file is looked up under a new key
+  auto const expected_modified = write_file(2000);
+  auto const result            = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected_modified->view());
+  EXPECT_EQ(cache->num_entries(), 2);
+
+  // buffer sources are only cached with user keys
+  std::vector<char> buffer;
+  auto values = thrust::make_counting_iterator(0);
+  auto col    = cudf::test::fixed_width_column_wrapper<int>(values, values + 100);
+  auto tbl    = table_view{{col}};
+  auto out_opts = cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, tbl);
+  cudf::io::write_parquet(out_opts);
+
+  cache->clear();
+  auto const buffer_source = cudf::io::source_info{buffer.data(), buffer.size()};
+  auto buffer_opts =
+    cudf::io::parquet_reader_options::builder(buffer_source).metadata_cache(cache).build();
+  cudf::io::read_parquet(buffer_opts);
+  EXPECT_EQ(cache->num_entries(), 0);
+
+  buffer_opts.set_metadata_cache_keys({"buffer"});
+  for (int i = 0; i < 2; ++i) {
+    auto const result = cudf::io::read_parquet(buffer_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl);
+    EXPECT_EQ(cache->num_entries(), 1);
+  }
+
+  // footers larger than the cache bound are not cached
+  auto tiny_cache = std::make_shared<cudf::io::parquet_metadata_cache>(1);
+  buffer_opts.set_metadata_cache(tiny_cache);
+  cudf::io::read_parquet(buffer_opts);
+  EXPECT_EQ(tiny_cache->num_entries(), 0);
+  EXPECT_EQ(tiny_cache->size_bytes(), 0);
+}
+
 TEST_F(ParquetReaderTest, FilterSimple)
 {
   srand(31337);
@@ -1925,6 +2124,116 @@ TEST_F(ParquetReaderTest, FilterFloatNAN)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected1->view(), result1);
 }
 
+// Filter a single row group using the page-level statistics in the column index
+TEST_F(ParquetReaderTest, FilterPageIndex)
+{
+  using T                 = int32_t;
+  constexpr auto num_rows = 40000;
+  auto elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto col0     = cudf::test::fixed_width_column_wrapper<T>(elements, elements + num_rows);
+  auto col1     = cudf::test::fixed_width_column_wrapper<T>(elements, elements + num_rows);
+
+  auto const written_table = table_view{{col0, col1}};
+  auto const filepath      = temp_env->get_temp_filepath("FilterPageIndex.parquet");
+  {
+    const cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+        .max_page_size_rows(1000)
+        .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+    cudf::io::write_parquet(out_opts);
+  }
+  auto si          = cudf::io::source_info(filepath);
+  auto filter_col0 = cudf::ast::column_reference(0);
+  auto filter_col1 = cudf::ast::column_reference(1);
+  auto lower_value = cudf::numeric_scalar<T>(12345, true);
+  auto lower       = cudf::ast::literal(lower_value);
+  auto upper_value = cudf::numeric_scalar<T>(15678, true);
+  auto upper       = cudf::ast::literal(upper_value);
+
+  // Page min, max: table[0] 0-999, 1000-1999, ...
+  // Filtering AST - table[0] >= 12345 && table[1] < 15678
+  auto expr_lower = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, filter_col0, lower);
+  auto expr_upper = cudf::ast::operation(cudf::ast::ast_operator::LESS, filter_col1, upper);
+  auto expr = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr_lower, expr_upper);
+
+  // Expected result
+  auto predicate = cudf::compute_column(written_table, expr);
+  auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+  // tests
+  auto builder             = cudf::io::parquet_reader_options::builder(si).filter(expr);
+  auto table_with_metadata = cudf::io::read_parquet(builder);
+  auto result              = table_with_metadata.tbl->view();
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+}
+
+TEST_F(ParquetReaderTest, FilterLateMaterialization)
+{
+  constexpr auto num_rows       = 40000;
+  constexpr auto row_group_rows = 5000;
+
+  // col0 is sorted so that row group statistics prune some row groups. Odd row groups of col1
+  // only hold even values, so statistics cannot prune them for `col1 == 7` but no row passes.
+  auto col0_elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto col1_elements = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i / row_group_rows) % 2 == 0 ? i % 1000 : 2 * (i % 1000); });
+  auto str_elements = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "payload_" + std::to_string(i); });
+  auto col0 = cudf::test::fixed_width_column_wrapper<int32_t>(col0_elements,
+                                                              col0_elements + num_rows);
+  auto col1 = cudf::test::fixed_width_column_wrapper<int32_t>(col1_elements,
+                                                              col1_elements + num_rows);
+  auto col2 = cudf::test::strings_column_wrapper(str_elements, str_elements + num_rows);
+
+  auto const written_table = table_view{{col0, col1, col2}};
+  cudf::io::table_input_metadata expected_metadata(written_table);
+  expected_metadata.column_metadata[0].set_name("col0");
+  expected_metadata.column_metadata[1].set_name("col1");
+  expected_metadata.column_metadata[2].set_name("col2");
+
+  auto const filepath = temp_env->get_temp_filepath("FilterLateMaterialization.parquet");
+  {
+    cudf::io::parquet_writer_options const out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+        .metadata(std::move(expected_metadata))
+        .row_group_size_rows(row_group_rows);
+    cudf::io::write_parquet(out_opts);
+  }
+
+  // Filtering AST - col0 < 32000 && col1 == 7
+  auto const col0_ref    = cudf::ast::column_name_reference("col0");
+  auto const col1_ref    = cudf::ast::column_name_reference("col1");
+  auto const col0_value  = cudf::numeric_scalar<int32_t>(32000);
+  auto const col1_value  = cudf::numeric_scalar<int32_t>(7);
+  auto const col0_lit    = cudf::ast::literal(col0_value);
+  auto const col1_lit    = cudf::ast::literal(col1_value);
+  auto const col0_filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col0_ref, col0_lit);
+  auto const col1_filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col1_ref, col1_lit);
+  auto const filter =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, col0_filter, col1_filter);
+
+  // the payload column col2 with and without one of the filter columns
+  for (auto const& columns : std::vector<std::vector<std::string>>{{"col2"}, {"col2", "col1"}}) {
+    auto const read_with = [&](bool late_materialization) {
+      auto const read_opts =
+        cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+          .columns(columns)
+          .filter(filter)
+          .late_materialization(late_materialization)
+          .build();
+      return cudf::io::read_parquet(read_opts);
+    };
+    auto const expected = read_with(false);
+    auto const result   = read_with(true);
+
+    // 5 rows from each of the row groups 0, 2 and 4, and 2 rows from row group 6
+    EXPECT_EQ(result.tbl->num_rows(), 17);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+    cudf::test::expect_metadata_equal(expected.metadata, result.metadata);
+  }
+}
+
 TEST_F(ParquetReaderTest, RepeatedNoAnnotations)
 {
   constexpr unsigned char repeated_bytes[] = {
@@ -2237,6 +2546,63 @@ TEST_F(ParquetReaderTest, StringsWithPageStats)
   }
 }
 
+TEST_F(ParquetReaderTest, DictionaryStringColumns)
+{
+  constexpr int num_rows = 1'000;
+
+  auto const keys = std::vector<std::string>{"apple", "banana", "cherry", "date"};
+  auto str_data   = std::vector<std::string>(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    str_data[i] = keys[i % keys.size()];
+  }
+  auto const validity = cudf::test::iterators::nulls_at({3, 500, 997});
+  auto str_col = cudf::test::strings_column_wrapper(str_data.begin(), str_data.end(), validity);
+  auto int_col = cudf::test::fixed_width_column_wrapper<int32_t>(
+    thrust::make_counting_iterator(0), thrust::make_counting_iterator(num_rows));
+  auto expected = cudf::table_view{{str_col, int_col}};
+
+  auto const write = [&](std::string const& name, cudf::io::dictionary_policy policy) {
+    auto const filepath = temp_env->get_temp_filepath(name);
+    cudf::io::write_parquet(
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+        .dictionary_policy(policy)
+        .row_group_size_rows(300)
+        .build());
+    return filepath;
+  };
+
+  // the dictionary-encoded string column is returned as a dictionary of its strings
+  {
+    auto const filepath =
+      write("DictionaryStringColumns.parquet", cudf::io::dictionary_policy::ALWAYS);
+    auto const read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .dictionary_string_columns(true)
+        .build();
+    auto const result = cudf::io::read_parquet(read_opts);
+    ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+    auto const dictionary = cudf::dictionary_column_view(result.tbl->get_column(0).view());
+    EXPECT_EQ(dictionary.keys_size(), static_cast<cudf::size_type>(keys.size()));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(dictionary), str_col);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), int_col);
+
+    // the default is still to return strings
+    auto const strings = cudf::io::read_parquet(
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}).build());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(strings.tbl->view(), expected);
+  }
+
+  // plain-encoded string columns are returned as strings
+  {
+    auto const filepath = write("PlainStringColumns.parquet", cudf::io::dictionary_policy::NEVER);
+    auto const read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .dictionary_string_columns(true)
+        .build();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::io::read_parquet(read_opts).tbl->view(), expected);
+  }
+}
+
 ///////////////////
 // metadata tests
 
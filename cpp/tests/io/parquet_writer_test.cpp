@@ -25,6 +25,8 @@
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/io/types.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/unary.hpp>
 
 #include <src/io/parquet/parquet.hpp>
@@ -398,6 +400,35 @@ TEST_F(ParquetWriterTest, PartitionedWrite)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected2, result2.tbl->view());
 }
 
+TEST_F(ParquetWriterTest, ManyPartitionsWrite)
+{
+  constexpr int num_partitions = 100;
+  constexpr int rows_per_part  = 1000;
+  auto source = create_random_fixed_table<int>(4, num_partitions * rows_per_part, true);
+
+  std::vector<cudf::io::partition_info> partitions;
+  std::vector<std::vector<char>> buffers(num_partitions);
+  std::vector<std::vector<char>*> buffer_ptrs;
+  for (int p = 0; p < num_partitions; ++p) {
+    partitions.emplace_back(p * rows_per_part, rows_per_part);
+    buffer_ptrs.push_back(&buffers[p]);
+  }
+
+  cudf::io::parquet_writer_options args =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info(buffer_ptrs), *source)
+      .partitions(partitions)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf::io::write_parquet(args);
+
+  for (int p = 0; p < num_partitions; ++p) {
+    auto const expected =
+      cudf::slice(*source, {partitions[p].start_row, partitions[p].start_row + rows_per_part});
+    auto const result = cudf::io::read_parquet(cudf::io::parquet_reader_options::builder(
+      cudf::io::source_info{buffers[p].data(), buffers[p].size()}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 template <typename T>
 std::string create_parquet_file(int num_cols)
 {
@@ -1218,6 +1249,80 @@ TEST_F(ParquetWriterTest, DictionaryAlwaysTest)
   EXPECT_TRUE(used_dict(1));
 }
 
+TEST_F(ParquetWriterTest, DictionaryCardinalityEstimate)
+{
+  constexpr unsigned int nrows = 100'000U;
+
+  // unique values would not benefit from a dictionary, repeated values would
+  auto unique_elements = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "a unique string value suffixed with " + std::to_string(i); });
+  auto repeated_elements = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "a repeated string value suffixed with " + std::to_string(i % 100); });
+  auto const col0 = cudf::test::strings_column_wrapper(unique_elements, unique_elements + nrows);
+  auto const col1 =
+    cudf::test::strings_column_wrapper(repeated_elements, repeated_elements + nrows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto const filepath = temp_env->get_temp_filepath("DictionaryCardinalityEstimate.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .compression(cudf::io::compression_type::NONE)
+      .dictionary_cardinality_estimate(true);
+  cudf::io::write_parquet(out_opts);
+
+  cudf::io::parquet_reader_options default_in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(default_in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+
+  read_footer(source, &fmd);
+  auto used_dict = [&fmd](int col) {
+    for (auto enc : fmd.row_groups[0].columns[col].meta_data.encodings) {
+      if (enc == cudf::io::parquet::detail::Encoding::PLAIN_DICTIONARY or
+          enc == cudf::io::parquet::detail::Encoding::RLE_DICTIONARY) {
+        return true;
+      }
+    }
+    return false;
+  };
+  EXPECT_FALSE(used_dict(0));
+  EXPECT_TRUE(used_dict(1));
+}
+
+TEST_F(ParquetWriterTest, EncodedRowGroupSize)
+{
+  constexpr cudf::size_type nrows = 800'000;
+  // plain encoded size is 3.2MB, dictionary encoded size is about 400KB
+  auto elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 16; });
+  auto const col0     = cudf::test::fixed_width_column_wrapper<int32_t>(elements, elements + nrows);
+  auto const expected = table_view{{col0}};
+
+  auto const count_row_groups = [&](bool encoded_row_group_size) {
+    auto const filepath = temp_env->get_temp_filepath("EncodedRowGroupSize.parquet");
+    cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+        .row_group_size_bytes(1024 * 1024)
+        .encoded_row_group_size(encoded_row_group_size);
+    cudf::io::write_parquet(out_opts);
+
+    auto const result = cudf::io::read_parquet(
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+    auto const source = cudf::io::datasource::create(filepath);
+    cudf::io::parquet::detail::FileMetaData fmd;
+    read_footer(source, &fmd);
+    return fmd.row_groups.size();
+  };
+
+  EXPECT_GT(count_row_groups(false), 1);
+  EXPECT_EQ(count_row_groups(true), 1);
+}
+
 TEST_F(ParquetWriterTest, DictionaryPageSizeEst)
 {
   // one page
@@ -1375,6 +1480,76 @@ TEST_F(ParquetWriterTest, SkipCompression)
   EXPECT_EQ(fmd.row_groups[0].columns[1].meta_data.codec, cudf::io::parquet::detail::ZSTD);
 }
 
+TEST_F(ParquetWriterTest, BloomFilter)
+{
+  constexpr auto row_group_rows = 5000;
+  constexpr auto num_rows       = 4 * row_group_rows;
+
+  // a permutation of [0, num_rows) so that row group statistics cannot prune equality predicates
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int>((i * 7919L) % num_rows); });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string((i * 7919L) % num_rows); });
+  column_wrapper<int> col0(values, values + num_rows, no_nulls());
+  column_wrapper<int> col1(values, values + num_rows, no_nulls());
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows);
+
+  auto expected          = table_view{{col0, col1, col2}};
+  auto expected_metadata = cudf::io::table_input_metadata{expected};
+  expected_metadata.column_metadata[0].set_bloom_filter_fpp(0.01);
+  expected_metadata.column_metadata[2].set_bloom_filter_fpp(0.05);
+
+  auto const filepath = temp_env->get_temp_filepath("BloomFilter.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .row_group_size_rows(row_group_rows)
+      .metadata(std::move(expected_metadata));
+  cudf::io::write_parquet(out_opts);
+
+  // check metadata to make sure only columns 0 and 2 have bloom filters
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  ASSERT_EQ(fmd.row_groups.size(), num_rows / row_group_rows);
+  for (auto const& rg : fmd.row_groups) {
+    for (auto const col : {0, 2}) {
+      auto const& chunk_meta = rg.columns[col].meta_data;
+      ASSERT_TRUE(chunk_meta.bloom_filter_offset.has_value());
+      ASSERT_TRUE(chunk_meta.bloom_filter_length.has_value());
+      // at least one 32 byte block follows the header
+      EXPECT_GT(chunk_meta.bloom_filter_length.value(), 32);
+    }
+    EXPECT_FALSE(rg.columns[1].meta_data.bloom_filter_offset.has_value());
+  }
+
+  // an equality filter on each bloom filtered column must still return the matching rows
+  auto const filter_col0  = cudf::ast::column_reference(0);
+  auto const filter_col2  = cudf::ast::column_reference(2);
+  auto const int_value    = cudf::numeric_scalar<int>(1234);
+  auto const int_literal  = cudf::ast::literal(int_value);
+  auto const str_value    = cudf::string_scalar("value4321");
+  auto const str_literal  = cudf::ast::literal(str_value);
+  auto const missing      = cudf::numeric_scalar<int>(num_rows + 1);
+  auto const miss_literal = cudf::ast::literal(missing);
+  auto const int_expr =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, int_literal);
+  auto const str_expr =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col2, str_literal);
+  auto const miss_expr =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, miss_literal);
+
+  for (auto const* expr : {&int_expr, &str_expr, &miss_expr}) {
+    auto const predicate = cudf::compute_column(expected, *expr);
+    auto const filtered  = cudf::apply_boolean_mask(expected, *predicate);
+
+    cudf::io::parquet_reader_options read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}).filter(*expr);
+    auto const result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), filtered->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, NoNullsAsNonNullable)
 {
   column_wrapper<int32_t> col{{1, 2, 3}, no_nulls()};
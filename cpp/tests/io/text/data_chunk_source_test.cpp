@@ -240,6 +240,36 @@ TEST_F(DataChunkSourceTest, BgzipSource)
   test_source(input, *source);
 }
 
+TEST_F(DataChunkSourceTest, BgzipSourceSkipBlocks)
+{
+  auto const filename = temp_env->get_temp_filepath("bgzip_source_skip_blocks");
+  std::string input{"bananarama"};
+  input.reserve(input.size() << 23);
+  for (int i = 0; i < 22; i++) {
+    input = input + input;
+  }
+  // make the content position-dependent, so a wrong skip distance is detected
+  for (std::size_t i = 0; i < input.size(); i += 4099) {
+    input[i] = static_cast<char>('A' + (i / 4099) % 26);
+  }
+  {
+    std::ofstream output_stream{filename};
+    std::default_random_engine rng{};
+    write_bgzip(output_stream, input, rng, compression::DISABLED, eof::ADD_EOF_BLOCK);
+  }
+
+  auto const source = cudf::io::text::make_source_from_bgzip_file(filename);
+  // skip past the initially loaded blocks, so that whole blocks are skipped
+  for (std::size_t const skip_size : {input.size() / 2 + 7, input.size() - 100}) {
+    auto reader = source->create_reader();
+    reader->skip_bytes(skip_size);
+    auto const chunk         = reader->get_next_chunk(1000, cudf::get_default_stream());
+    auto const expected_size = std::min<std::size_t>(1000, input.size() - skip_size);
+    ASSERT_EQ(chunk->size(), expected_size);
+    ASSERT_EQ(chunk_to_host(*chunk), input.substr(skip_size, expected_size));
+  }
+}
+
 TEST_F(DataChunkSourceTest, BgzipSourceVirtualOffsets)
 {
   auto const filename = temp_env->get_temp_filepath("bgzip_source_offsets");
@@ -220,6 +220,85 @@ TEST_F(MultibyteSplitTest, DelimiterErasureOverlap)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
 }
 
+TEST_F(MultibyteSplitTest, MultipleDelimiters)
+{
+  auto const delimiters = std::vector<std::string>{"\r\n", "\n", "\x1e"};
+  auto host_input       = std::string("abc\r\ndef\nghi\x1ejkl\n\nmno\r");
+
+  auto expected = strings_column_wrapper{"abc\r\n", "def\n", "ghi\x1e", "jkl\n", "\n", "mno\r"};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersErasure)
+{
+  auto const delimiters = std::vector<std::string>{"\r\n", "\n", "\x1e"};
+  auto host_input       = std::string("abc\r\ndef\nghi\x1ejkl\n\nmno\r");
+
+  auto expected = strings_column_wrapper{"abc", "def", "ghi", "jkl", "", "mno\r"};
+
+  cudf::io::text::parse_options options;
+  options.strip_delimiters = true;
+  auto source              = cudf::io::text::make_source(host_input);
+  auto out                 = cudf::io::text::multibyte_split(*source, delimiters, options);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleByteDelimiters)
+{
+  auto const delimiters = std::vector<std::string>{"\n", "\x1e", ";"};
+  auto host_input       = std::string("abc\ndef;ghi\x1e;jkl");
+
+  auto expected = strings_column_wrapper{"abc", "def", "ghi", "", "jkl"};
+
+  cudf::io::text::parse_options options;
+  options.strip_delimiters = true;
+  auto source              = cudf::io::text::make_source(host_input);
+  auto out                 = cudf::io::text::multibyte_split(*source, delimiters, options);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersLargeInputMultipleRange)
+{
+  auto host_input = std::string();
+  for (auto i = 0; i < (32 * 128 * 1024); i++) {
+    host_input += i % 3 == 0 ? "ab\r\n" : (i % 3 == 1 ? "cd\n" : "ef\x1e");
+  }
+
+  auto const delimiters = std::vector<std::string>{"\r\n", "\n", "\x1e"};
+  auto source           = cudf::io::text::make_source(host_input);
+
+  auto byte_ranges = cudf::io::text::create_byte_range_infos_consecutive(host_input.size(), 3);
+  auto out0 = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[0]});
+  auto out1 = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[1]});
+  auto out2 = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[2]});
+
+  auto out_views = std::vector<cudf::column_view>({out0->view(), out1->view(), out2->view()});
+  auto out       = cudf::concatenate(out_views);
+
+  auto expected = cudf::io::text::multibyte_split(*source, delimiters);
+
+  EXPECT_EQ(expected->size(), 32 * 128 * 1024);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected->view(), *out, cudf::test::debug_output_level::ALL_ERRORS);
+}
+
+TEST_F(MultibyteSplitTest, EmptyDelimiters)
+{
+  auto host_input = std::string("abc");
+  auto source     = cudf::io::text::make_source(host_input);
+
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{"a", ""}),
+               cudf::logic_error);
+}
+
 TEST_F(MultibyteSplitTest, HandpickedInput)
 {
   auto delimiters = "::|";
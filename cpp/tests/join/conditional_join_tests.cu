@@ -532,6 +532,34 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestRangeCondition)
+{
+  // left.0 >= right.0 AND left.0 <= right.1 AND left.1 != right.2
+  auto col_ref_left_0  = cudf::ast::column_reference(0);
+  auto col_ref_left_1  = cudf::ast::column_reference(1);
+  auto col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto col_ref_right_2 = cudf::ast::column_reference(2, cudf::ast::table_reference::RIGHT);
+  auto lower_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left_0, col_ref_right_0);
+  auto upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_right_1, col_ref_left_0);
+  auto residual =
+    cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, col_ref_left_1, col_ref_right_2);
+  auto bounds =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, bounds, residual);
+
+  this->test({{5, 1, 3, 9, 3}, {0, 0, 1, 0, 0}},
+             {{2, 0, 4}, {4, 1, 8}, {1, 1, 1}},
+             expression,
+             {{0, 2}, {1, 1}, {4, 0}});
+  this->test_nulls({{{5, 1, 3, 9, 3}, {1, 1, 1, 1, 0}}, {{0, 0, 1, 0, 0}, {1, 1, 1, 1, 1}}},
+                   {{{2, 0, 4}, {1, 1, 0}}, {{4, 1, 8}, {1, 1, 1}}, {{1, 1, 1}, {1, 1, 1}}},
+                   expression,
+                   {{1, 1}});
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -618,6 +646,25 @@ TYPED_TEST(ConditionalLeftJoinTest, TestOneColumnRightEmpty)
              {{0, JoinNoneValue}, {1, JoinNoneValue}, {2, JoinNoneValue}});
 };
 
+TYPED_TEST(ConditionalLeftJoinTest, TestRangeCondition)
+{
+  // left.0 > right.0 AND left.0 < right.1
+  auto col_ref_left_0  = cudf::ast::column_reference(0);
+  auto col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+  auto upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_1);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+
+  this->test({{4, 0, 2, 6}},
+             {{1, 3, 0}, {3, 7, 5}},
+             expression,
+             {{0, 1}, {0, 2}, {1, JoinNoneValue}, {2, 0}, {2, 2}, {3, 1}});
+};
+
 TYPED_TEST(ConditionalLeftJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
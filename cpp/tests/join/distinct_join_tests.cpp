@@ -48,6 +48,11 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> get_left_indices(cudf::siz
   return std::make_unique<rmm::device_uvector<cudf::size_type>>(std::move(indices));
 }
 
+cudf::column_view indices_view(rmm::device_uvector<cudf::size_type> const& indices)
+{
+  return cudf::column_view{cudf::device_span<cudf::size_type const>{indices}};
+}
+
 struct DistinctJoinTest : public cudf::test::BaseFixture {
   void compare_to_reference(
     cudf::table_view const& build_table,
@@ -495,3 +500,69 @@ TEST_F(DistinctJoinTest, LeftJoinWithStructsAndNulls)
   this->compare_to_reference(
     build.view(), probe.view(), gather_map, gold.view(), cudf::out_of_bounds_policy::NULLIFY);
 }
+
+TEST_F(DistinctJoinTest, LeftSemiAntiJoinNoNulls)
+{
+  column_wrapper<int32_t> col0_0({3, 1, 2, 0, 3});
+  strcol_wrapper col0_1({"s0", "s1", "s2", "s4", "s1"});
+
+  column_wrapper<int32_t> col1_0({2, 2, 0, 4, 3});
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1"});
+
+  auto const probe = cudf::table_view{{col0_0, col0_1}};
+  auto const build = cudf::table_view{{col1_0, col1_1}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{build, probe};
+
+  auto const semi = distinct_join.left_semi_join();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({4}), indices_view(*semi));
+
+  auto const anti = distinct_join.left_anti_join();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({0, 1, 2, 3}),
+                                 indices_view(*anti));
+}
+
+TEST_F(DistinctJoinTest, LeftSemiAntiJoinWithNulls)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper col0_1({"s1", "s1", "", "s4", "s0"}, {1, 1, 0, 1, 1});
+
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s1", "", "s1", "s2", "s1"}, {1, 0, 1, 1, 1});
+
+  auto const probe = cudf::table_view{{col0_0, col0_1}};
+  auto const build = cudf::table_view{{col1_0, col1_1}};
+
+  {
+    auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{
+      build, probe, cudf::nullable_join::YES, cudf::null_equality::EQUAL};
+    auto const semi = distinct_join.left_semi_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({0, 2}), indices_view(*semi));
+    auto const anti = distinct_join.left_anti_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({1, 3, 4}), indices_view(*anti));
+  }
+  {
+    auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{
+      build, probe, cudf::nullable_join::YES, cudf::null_equality::UNEQUAL};
+    auto const semi = distinct_join.left_semi_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({0}), indices_view(*semi));
+    auto const anti = distinct_join.left_anti_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({1, 2, 3, 4}),
+                                   indices_view(*anti));
+  }
+}
+
+TEST_F(DistinctJoinTest, EmptyBuildTableLeftSemiAntiJoin)
+{
+  column_wrapper<int32_t> col0_0{{2, 2, 0, 4, 3}};
+  column_wrapper<int32_t> col1_0{};
+
+  auto const probe = cudf::table_view{{col0_0}};
+  auto const build = cudf::table_view{{col1_0}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{build, probe};
+  EXPECT_EQ(distinct_join.left_semi_join()->size(), 0);
+  auto const anti = distinct_join.left_anti_join();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<cudf::size_type>({0, 1, 2, 3, 4}),
+                                 indices_view(*anti));
+}
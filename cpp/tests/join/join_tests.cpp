@@ -28,7 +28,9 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/filling.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/sorting.hpp>
@@ -40,6 +42,8 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 
 template <typename T>
@@ -1581,6 +1585,233 @@ TEST_F(JoinTest, HashJoinWithNullsOneSide)
   }
 }
 
+TEST_F(JoinTest, HashJoinInnerJoinChunks)
+{
+  // Skewed build keys, so that the probe rows have different numbers of matches
+  column_wrapper<int32_t> build_col{{0, 0, 0, 1, 2, 2}};
+  column_wrapper<int32_t> probe_col{{0, 1, 2, 3, 0, 2, 0, 4, 1}};
+  auto const build = cudf::table_view{{build_col}};
+  auto const probe = cudf::table_view{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+  auto const expected = hash_join.inner_join(probe);
+
+  for (std::size_t const max_output_size : {1, 2, 4, 100}) {
+    std::vector<cudf::size_type> left_indices;
+    std::vector<cudf::size_type> right_indices;
+    cudf::size_type cursor = 0;
+    while (cursor < probe.num_rows()) {
+      auto const [left, right, next] = hash_join.inner_join_chunk(probe, cursor, max_output_size);
+      EXPECT_GT(next, cursor);
+      // A chunk exceeds the maximum size only if it is the output of a single probe row
+      EXPECT_TRUE(left->size() <= max_output_size or next == cursor + 1);
+
+      auto const h_left  = cudf::detail::make_std_vector_sync(*left, cudf::get_default_stream());
+      auto const h_right = cudf::detail::make_std_vector_sync(*right, cudf::get_default_stream());
+      EXPECT_TRUE(std::all_of(h_left.begin(), h_left.end(), [cursor, end = next](auto idx) {
+        return idx >= cursor and idx < end;
+      }));
+      left_indices.insert(left_indices.end(), h_left.begin(), h_left.end());
+      right_indices.insert(right_indices.end(), h_right.begin(), h_right.end());
+      cursor = next;
+    }
+    EXPECT_EQ(cursor, probe.num_rows());
+
+    column_wrapper<int32_t> col_gold_0(left_indices.begin(), left_indices.end());
+    column_wrapper<int32_t> col_gold_1(right_indices.begin(), right_indices.end());
+    auto const [sorted_gold, sorted_result] =
+      gather_maps_as_tables(col_gold_0, col_gold_1, expected);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  EXPECT_THROW(hash_join.inner_join_chunk(probe, probe.num_rows() + 1, 4), std::out_of_range);
+  EXPECT_THROW(hash_join.inner_join_chunk(probe, 0, 0), std::invalid_argument);
+}
+
+TEST_F(JoinTest, HashJoinSkewedBuildKeys)
+{
+  // Half of the build rows have the key 0, which is a heavy hitter of the build table
+  cudf::size_type constexpr num_build_rows = 6000;
+  std::vector<int32_t> build_keys(num_build_rows);
+  for (cudf::size_type i = 0; i < num_build_rows; ++i) {
+    build_keys[i] = i % 2 == 0 ? 0 : i;
+  }
+  std::vector<int32_t> const probe_keys{0, 1, 2, 3, 0, 7, 4};
+  column_wrapper<int32_t> build_col(build_keys.begin(), build_keys.end());
+  column_wrapper<int32_t> probe_col(probe_keys.begin(), probe_keys.end());
+  auto const build = cudf::table_view{{build_col}};
+  auto const probe = cudf::table_view{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+
+  // Each output row is a pair of equal keys, or a row without a match
+  auto const check_join = [&](auto const& join_indices, std::size_t expected_matches) {
+    auto const h_left =
+      cudf::detail::make_std_vector_sync(*join_indices.first, cudf::get_default_stream());
+    auto const h_right =
+      cudf::detail::make_std_vector_sync(*join_indices.second, cudf::get_default_stream());
+    std::size_t num_matches = 0;
+    for (std::size_t i = 0; i < h_left.size(); ++i) {
+      if (h_left[i] == NoneValue or h_right[i] == NoneValue) { continue; }
+      EXPECT_EQ(probe_keys[h_left[i]], build_keys[h_right[i]]);
+      ++num_matches;
+    }
+    EXPECT_EQ(num_matches, expected_matches);
+  };
+
+  // The two probe rows of the key 0 match all of its build rows, the keys 1, 3, 7 match one row
+  auto const num_matches = std::size_t{2 * num_build_rows / 2 + 3};
+  EXPECT_EQ(hash_join.inner_join_size(probe), num_matches);
+  EXPECT_EQ(hash_join.left_join_size(probe), num_matches + 2);
+  EXPECT_EQ(hash_join.full_join_size(probe), num_matches + 2 + (num_build_rows / 2 - 3));
+
+  auto const inner = hash_join.inner_join(probe);
+  EXPECT_EQ(inner.first->size(), num_matches);
+  check_join(inner, num_matches);
+  auto const left = hash_join.left_join(probe);
+  EXPECT_EQ(left.first->size(), num_matches + 2);
+  check_join(left, num_matches);
+  auto const full = hash_join.full_join(probe);
+  EXPECT_EQ(full.first->size(), num_matches + 2 + (num_build_rows / 2 - 3));
+  check_join(full, num_matches);
+}
+
+TEST_F(JoinTest, HashJoinJoinAndGather)
+{
+  column_wrapper<int32_t> build_keys{{0, 1, 2, 2, 4}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_keys{{2, 3, 1, 2, 4}, {1, 1, 1, 1, 0}};
+  column_wrapper<int64_t> build_payload{{10, 11, 12, 13, 14}, {1, 0, 1, 1, 1}};
+  strcol_wrapper build_names({"a", "b", "c", "d", "e"});
+  column_wrapper<double> probe_payload{{0.5, 1.5, 2.5, 3.5, 4.5}};
+  auto const build         = cudf::table_view{{build_keys}};
+  auto const probe         = cudf::table_view{{probe_keys}};
+  auto const probe_columns = cudf::table_view{{probe_payload, probe_keys}};
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::YES, cudf::null_equality::UNEQUAL);
+
+  // The gather of the join indices, sorted as the output order of a join is unspecified
+  auto const gather_indices = [&](auto const& join_indices, cudf::table_view build_columns) {
+    auto const as_column = [](auto const& indices) {
+      return cudf::column_view{cudf::device_span<cudf::size_type const>{*indices}};
+    };
+    auto columns = cudf::gather(probe_columns, as_column(join_indices.first))->release();
+    auto build_gathered = cudf::gather(build_columns,
+                                       as_column(join_indices.second),
+                                       cudf::out_of_bounds_policy::NULLIFY)
+                            ->release();
+    std::move(build_gathered.begin(), build_gathered.end(), std::back_inserter(columns));
+    return cudf::sort(cudf::table{std::move(columns)});
+  };
+
+  // Fixed-width columns are gathered by the probe, the others from the join indices
+  for (auto const build_columns : {cudf::table_view{{build_payload}},
+                                   cudf::table_view{{build_payload, build_names}}}) {
+    auto const inner = hash_join.inner_join_and_gather(probe, probe_columns, build_columns);
+    EXPECT_EQ(inner->num_rows(), 5);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(*inner),
+                                       *gather_indices(hash_join.inner_join(probe), build_columns));
+
+    auto const left = hash_join.left_join_and_gather(probe, probe_columns, build_columns);
+    EXPECT_EQ(left->num_rows(), 7);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(*left),
+                                       *gather_indices(hash_join.left_join(probe), build_columns));
+  }
+
+  column_wrapper<int32_t> short_col{{1, 2}};
+  EXPECT_THROW(hash_join.inner_join_and_gather(probe, cudf::table_view{{short_col}}, build),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, PartitionedInnerJoin)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2, 5, 3}, {1, 1, 1, 1, 1, 1, 0}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0", "s5", "s1"});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3, 5, 3}, {1, 1, 1, 1, 1, 1, 0}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1", "s5", "s1"});
+  auto const t0 = cudf::table_view{{col0_0, col0_1}};
+  auto const t1 = cudf::table_view{{col1_0, col1_1}};
+
+  auto const as_column = [](rmm::device_uvector<cudf::size_type> const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices.size()),
+                             indices.data(),
+                             nullptr,
+                             0};
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = cudf::inner_join(t0, t1, compare_nulls);
+    for (cudf::size_type const num_partitions : {1, 2, 5, 16}) {
+      auto const result = cudf::partitioned_inner_join(t0, t1, num_partitions, compare_nulls);
+      auto const [sorted_gold, sorted_result] =
+        gather_maps_as_tables(as_column(*expected.first), as_column(*expected.second), result);
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+    }
+  }
+
+  EXPECT_THROW(cudf::partitioned_inner_join(t0, t1, 0), std::invalid_argument);
+}
+
+TEST_F(JoinTest, HashJoinBloomFilter)
+{
+  cudf::size_type constexpr num_build_rows = 10000;
+  auto const build_keys = cudf::sequence(num_build_rows, cudf::numeric_scalar<int32_t>(0));
+  auto const probe_keys = cudf::sequence(2 * num_build_rows, cudf::numeric_scalar<int32_t>(0));
+  auto const build      = cudf::table_view{{build_keys->view()}};
+  auto const probe      = cudf::table_view{{probe_keys->view()}};
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+  auto const filter = hash_join.bloom_filter(0.01);
+  EXPECT_GT(filter->size_bytes(), 0);
+
+  auto const result    = filter->contains(probe);
+  auto const may_match = cudf::test::to_host<bool>(result->view()).first;
+  EXPECT_EQ(result->null_count(), 0);
+
+  // Every probe row with a match is reported, and few of the others are
+  EXPECT_TRUE(std::all_of(may_match.begin(), may_match.begin() + num_build_rows, [](auto v) {
+    return v;
+  }));
+  auto const false_positives =
+    std::count(may_match.begin() + num_build_rows, may_match.end(), true);
+  EXPECT_LT(false_positives, num_build_rows / 20);
+
+  column_wrapper<int32_t> other_col{{1, 2}};
+  EXPECT_THROW(filter->contains(cudf::table_view{{other_col, other_col}}), cudf::logic_error);
+  EXPECT_THROW(cudf::join_bloom_filter(build, 1.0), std::invalid_argument);
+}
+
+TEST_F(JoinTest, HashJoinLeftSemiAntiJoin)
+{
+  // The build table is reused by several probe tables, as for micro-batches of a stream
+  column_wrapper<int32_t> build_col{{0, 1, 2, 2, 5, 7}, {1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_col0{{0, 3, 2, 7, 4, 5}, {1, 1, 1, 0, 1, 1}};
+  column_wrapper<int32_t> probe_col1{{9, 1, 2, 8}};
+  auto const build = cudf::table_view{{build_col}};
+
+  auto const to_host = [](auto const& indices) {
+    return cudf::detail::make_std_vector_sync(*indices, cudf::get_default_stream());
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::hash_join hash_join(build, cudf::nullable_join::YES, compare_nulls);
+    for (auto const probe : {cudf::table_view{{probe_col0}}, cudf::table_view{{probe_col1}}}) {
+      EXPECT_EQ(to_host(hash_join.left_semi_join(probe)),
+                to_host(cudf::left_semi_join(probe, build, compare_nulls)));
+      EXPECT_EQ(to_host(hash_join.left_anti_join(probe)),
+                to_host(cudf::left_anti_join(probe, build, compare_nulls)));
+    }
+  }
+
+  // The output of an empty build table is known
+  column_wrapper<int32_t> empty_col{};
+  cudf::hash_join empty_join(
+    cudf::table_view{{empty_col}}, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+  auto const probe = cudf::table_view{{probe_col1}};
+  EXPECT_TRUE(to_host(empty_join.left_semi_join(probe)).empty());
+  EXPECT_EQ(to_host(empty_join.left_anti_join(probe)), (std::vector<cudf::size_type>{0, 1, 2, 3}));
+}
+
 TEST_F(JoinTest, HashJoinLargeOutputSize)
 {
   // self-join a table of zeroes to generate an output row count that would overflow int32_t
@@ -643,6 +643,176 @@ TYPED_TEST(MixedFullJoinTest, Basic2)
               {JoinNoneValue, 2}});
 }
 
+/**
+ * Tests of mixed inner joins probing a reusable mixed_join object.
+ */
+template <typename T>
+struct MixedJoinObjectInnerJoinTest : public MixedJoinPairReturnTest<T> {
+  PairJoinReturn join(cudf::table_view left_equality,
+                      cudf::table_view right_equality,
+                      cudf::table_view left_conditional,
+                      cudf::table_view right_conditional,
+                      cudf::ast::operation predicate,
+                      cudf::null_equality compare_nulls = cudf::null_equality::EQUAL) override
+  {
+    cudf::mixed_join const joiner(
+      right_equality, right_conditional, left_conditional, predicate, compare_nulls);
+    return joiner.inner_join(left_equality, left_conditional);
+  }
+
+  std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<cudf::size_type>>> join_size(
+    cudf::table_view left_equality,
+    cudf::table_view right_equality,
+    cudf::table_view left_conditional,
+    cudf::table_view right_conditional,
+    cudf::ast::operation predicate,
+    cudf::null_equality compare_nulls = cudf::null_equality::EQUAL) override
+  {
+    cudf::mixed_join const joiner(
+      right_equality, right_conditional, left_conditional, predicate, compare_nulls);
+    return joiner.inner_join_size(left_equality, left_conditional);
+  }
+};
+
+TYPED_TEST_SUITE(MixedJoinObjectInnerJoinTest, cudf::test::IntegralTypesNotBool);
+
+TYPED_TEST(MixedJoinObjectInnerJoinTest, Empty)
+{
+  this->test({}, {}, {}, {}, left_zero_eq_right_zero, {}, {});
+}
+
+TYPED_TEST(MixedJoinObjectInnerJoinTest, BasicEquality)
+{
+  this->test({{0, 1, 2}, {3, 4, 5}, {10, 20, 30}},
+             {{0, 1, 3}, {5, 4, 5}, {30, 40, 50}},
+             {0},
+             {1, 2},
+             left_zero_eq_right_zero,
+             {1, 0, 0},
+             {{0, 0}});
+}
+
+TYPED_TEST(MixedJoinObjectInnerJoinTest, BasicNullEqualityUnequal)
+{
+  this->test_nulls({{{0, 1, 2}, {1, 1, 0}}, {{3, 4, 5}, {1, 1, 1}}, {{10, 20, 30}, {1, 1, 1}}},
+                   {{{0, 1, 3}, {1, 1, 0}}, {{5, 4, 5}, {1, 1, 1}}, {{30, 40, 30}, {1, 1, 1}}},
+                   {0},
+                   {1, 2},
+                   left_zero_eq_right_zero,
+                   {1, 0, 0},
+                   {{0, 0}},
+                   cudf::null_equality::UNEQUAL);
+}
+
+/**
+ * Tests of mixed left joins probing a reusable mixed_join object.
+ */
+template <typename T>
+struct MixedJoinObjectLeftJoinTest : public MixedJoinPairReturnTest<T> {
+  PairJoinReturn join(cudf::table_view left_equality,
+                      cudf::table_view right_equality,
+                      cudf::table_view left_conditional,
+                      cudf::table_view right_conditional,
+                      cudf::ast::operation predicate,
+                      cudf::null_equality compare_nulls = cudf::null_equality::EQUAL) override
+  {
+    cudf::mixed_join const joiner(
+      right_equality, right_conditional, left_conditional, predicate, compare_nulls);
+    return joiner.left_join(left_equality, left_conditional);
+  }
+
+  std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<cudf::size_type>>> join_size(
+    cudf::table_view left_equality,
+    cudf::table_view right_equality,
+    cudf::table_view left_conditional,
+    cudf::table_view right_conditional,
+    cudf::ast::operation predicate,
+    cudf::null_equality compare_nulls = cudf::null_equality::EQUAL) override
+  {
+    cudf::mixed_join const joiner(
+      right_equality, right_conditional, left_conditional, predicate, compare_nulls);
+    return joiner.left_join_size(left_equality, left_conditional);
+  }
+};
+
+TYPED_TEST_SUITE(MixedJoinObjectLeftJoinTest, cudf::test::IntegralTypesNotBool);
+
+TYPED_TEST(MixedJoinObjectLeftJoinTest, Basic)
+{
+  this->test({{0, 1, 2}, {3, 4, 5}, {10, 20, 30}},
+             {{0, 1, 3}, {5, 4, 5}, {30, 40, 50}},
+             {0},
+             {1, 2},
+             left_zero_eq_right_zero,
+             {1, 1, 1},
+             {{0, JoinNoneValue}, {1, 1}, {2, JoinNoneValue}});
+}
+
+TYPED_TEST(MixedJoinObjectLeftJoinTest, EmptyRight)
+{
+  this->test({{0, 1, 2}, {3, 4, 5}, {10, 20, 30}},
+             {{}, {}, {}},
+             {0},
+             {1, 2},
+             left_zero_eq_right_zero,
+             {1, 1, 1},
+             {{0, JoinNoneValue}, {1, JoinNoneValue}, {2, JoinNoneValue}});
+}
+
+TYPED_TEST(MixedJoinObjectLeftJoinTest, ProbeManyTimes)
+{
+  using column_wrapper = cudf::test::fixed_width_column_wrapper<TypeParam>;
+
+  column_wrapper right_eq{0, 1, 3, 1};
+  column_wrapper right_cond{5, 4, 5, 2};
+  auto const right_equality    = cudf::table_view{{right_eq}};
+  auto const right_conditional = cudf::table_view{{right_cond}};
+
+  column_wrapper left_eq_0{0, 1, 2};
+  column_wrapper left_cond_0{3, 4, 5};
+  column_wrapper left_eq_1{1, 3, 3, 1};
+  column_wrapper left_cond_1{1, 7, 2, 9};
+  auto const left_equality_0    = cudf::table_view{{left_eq_0}};
+  auto const left_conditional_0 = cudf::table_view{{left_cond_0}};
+  auto const left_equality_1    = cudf::table_view{{left_eq_1}};
+  auto const left_conditional_1 = cudf::table_view{{left_cond_1}};
+
+  auto const predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_0);
+  cudf::mixed_join const joiner(right_equality, right_conditional, left_conditional_0, predicate);
+
+  auto const to_pairs = [](PairJoinReturn const& result) {
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (size_t i = 0; i < result.first->size(); ++i) {
+      pairs.push_back({result.first->element(i, cudf::get_default_stream()),
+                       result.second->element(i, cudf::get_default_stream())});
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  for (auto const& [left_equality, left_conditional] :
+       {std::pair{left_equality_0, left_conditional_0},
+        std::pair{left_equality_1, left_conditional_1}}) {
+    auto const expected = cudf::mixed_left_join(
+      left_equality, right_equality, left_conditional, right_conditional, predicate);
+    auto const [size, counts] = joiner.left_join_size(left_equality, left_conditional);
+    auto const result         = joiner.left_join(
+      left_equality,
+      left_conditional,
+      std::pair{size, cudf::device_span<cudf::size_type const>{*counts}});
+    EXPECT_EQ(size, expected.first->size());
+    EXPECT_EQ(to_pairs(result), to_pairs(expected));
+    EXPECT_EQ(to_pairs(joiner.full_join(left_equality, left_conditional)),
+              to_pairs(cudf::mixed_full_join(
+                left_equality, right_equality, left_conditional, right_conditional, predicate)));
+  }
+
+  cudf::test::fixed_width_column_wrapper<double> wrong_type_cond{1.0, 2.0, 3.0};
+  EXPECT_THROW(joiner.left_join(left_equality_0, cudf::table_view{{wrong_type_cond}}),
+               cudf::data_type_error);
+}
+
 template <typename T>
 struct MixedJoinSingleReturnTest : public MixedJoinTest<T> {
   /*
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using indices_column = column_wrapper<cudf::size_type>;
+
+struct SortMergeJoinTest : public cudf::test::BaseFixture {};
+
+namespace {
+constexpr auto no_match = std::numeric_limits<cudf::size_type>::min();
+
+cudf::column_view indices_view(rmm::device_uvector<cudf::size_type> const& indices)
+{
+  return cudf::column_view{cudf::device_span<cudf::size_type const>{indices}};
+}
+}  // namespace
+
+TEST_F(SortMergeJoinTest, InnerJoinWithDuplicates)
+{
+  column_wrapper<int32_t> left_col{{0, 1, 1, 2, 4}};
+  column_wrapper<int32_t> right_col{{1, 1, 2, 3, 4, 4}};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  auto const [left_indices, right_indices] = cudf::sort_merge_inner_join(left, right);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices),
+                                 indices_column{1, 1, 2, 2, 3, 4, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices),
+                                 indices_column{0, 1, 0, 1, 2, 4, 5});
+}
+
+TEST_F(SortMergeJoinTest, LeftJoin)
+{
+  column_wrapper<int32_t> left_col{{0, 1, 2, 2, 5}};
+  column_wrapper<int32_t> right_col{{1, 2, 3, 3}};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  auto const [left_indices, right_indices] = cudf::sort_merge_left_join(left, right);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices), indices_column{0, 1, 2, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices),
+                                 indices_column{no_match, 0, 1, 1, no_match});
+}
+
+TEST_F(SortMergeJoinTest, LeftSemiJoin)
+{
+  column_wrapper<int32_t> left_col{{0, 1, 1, 3, 4}};
+  column_wrapper<int32_t> right_col{{1, 2, 4}};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  auto const indices = cudf::sort_merge_left_semi_join(left, right);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*indices), indices_column{1, 2, 4});
+}
+
+TEST_F(SortMergeJoinTest, MultipleColumnsDescending)
+{
+  column_wrapper<int32_t> left_col0{{3, 3, 1, 1}};
+  column_wrapper<int32_t> left_col1{{20, 10, 20, 10}};
+  column_wrapper<int32_t> right_col0{{3, 2, 1}};
+  column_wrapper<int32_t> right_col1{{10, 10, 20}};
+  auto const left  = cudf::table_view{{left_col0, left_col1}};
+  auto const right = cudf::table_view{{right_col0, right_col1}};
+  auto const order = std::vector<cudf::order>{cudf::order::DESCENDING, cudf::order::DESCENDING};
+
+  auto const [left_indices, right_indices] =
+    cudf::sort_merge_inner_join(left, right, order, {}, cudf::null_equality::EQUAL, true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices), indices_column{1, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices), indices_column{0, 2});
+}
+
+TEST_F(SortMergeJoinTest, Nulls)
+{
+  column_wrapper<int32_t> left_col{{0, 0, 1, 2}, {0, 0, 1, 1}};
+  column_wrapper<int32_t> right_col{{0, 2}, {0, 1}};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const right = cudf::table_view{{right_col}};
+
+  {
+    auto const [left_indices, right_indices] =
+      cudf::sort_merge_inner_join(left, right, {}, {}, cudf::null_equality::EQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices), indices_column{0, 1, 3});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices), indices_column{0, 0, 1});
+  }
+  {
+    auto const [left_indices, right_indices] =
+      cudf::sort_merge_left_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices), indices_column{0, 1, 2, 3});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices),
+                                   indices_column{no_match, no_match, no_match, 1});
+  }
+}
+
+TEST_F(SortMergeJoinTest, EmptyTables)
+{
+  column_wrapper<int32_t> left_col{{0, 1}};
+  column_wrapper<int32_t> empty_col{};
+  auto const left  = cudf::table_view{{left_col}};
+  auto const empty = cudf::table_view{{empty_col}};
+
+  EXPECT_EQ(cudf::sort_merge_inner_join(left, empty).first->size(), 0);
+  EXPECT_EQ(cudf::sort_merge_inner_join(empty, left).first->size(), 0);
+  EXPECT_EQ(cudf::sort_merge_left_semi_join(left, empty)->size(), 0);
+
+  auto const [left_indices, right_indices] = cudf::sort_merge_left_join(left, empty);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*left_indices), indices_column{0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_view(*right_indices), indices_column{no_match, no_match});
+}
+
+TEST_F(SortMergeJoinTest, CheckSorted)
+{
+  column_wrapper<int32_t> sorted_col{{0, 1, 2}};
+  column_wrapper<int32_t> unsorted_col{{2, 0, 1}};
+  column_wrapper<float> float_col{{0, 1, 2}};
+  auto const sorted   = cudf::table_view{{sorted_col}};
+  auto const unsorted = cudf::table_view{{unsorted_col}};
+
+  EXPECT_THROW(
+    cudf::sort_merge_inner_join(sorted, unsorted, {}, {}, cudf::null_equality::EQUAL, true),
+    std::invalid_argument);
+  EXPECT_THROW(
+    cudf::sort_merge_left_semi_join(unsorted, sorted, {}, {}, cudf::null_equality::EQUAL, true),
+    std::invalid_argument);
+  EXPECT_THROW(cudf::sort_merge_inner_join(sorted, cudf::table_view{{sorted_col, sorted_col}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::sort_merge_inner_join(sorted, cudf::table_view{{float_col}}),
+               cudf::data_type_error);
+}
@@ -1056,4 +1056,29 @@ TEST_F(JsonPathTests, QueriesContainingQuotes)
   do_test(R"($.'A)", R"({"B'": 3})");
 }
 
+TEST_F(JsonPathTests, MultiplePaths)
+{
+  auto const input = cudf::test::strings_column_wrapper(
+    {json_string, R"({"a": 1, "b": [2, 3]})", "", R"({"a": "x"})", R"({"c": {"d": 4}})"},
+    {1, 1, 0, 1, 1});
+  auto const sv = cudf::strings_column_view(input);
+
+  std::vector<std::string> const json_paths{"$.store.bicycle.color",
+                                            "$.store.book[*].author",
+                                            "$.a",
+                                            "",
+                                            "$.b[1]",
+                                            "$.c.*",
+                                            "$.store.book[1].price"};
+  auto const results = cudf::get_json_objects(sv, json_paths);
+  ASSERT_EQ(results.size(), json_paths.size());
+  for (std::size_t idx = 0; idx < json_paths.size(); ++idx) {
+    auto const expected = cudf::get_json_object(sv, json_paths[idx]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *results[idx]);
+  }
+
+  EXPECT_TRUE(cudf::get_json_objects(sv, {}).empty());
+  EXPECT_THROW(cudf::get_json_objects(sv, {"$.a", "$$"}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -23,10 +23,13 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/iterator/constant_iterator.h>
+
 #include <algorithm>
 #include <limits>
 #include <numeric>
@@ -434,6 +437,104 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+/*
+ * Test bin counts.
+ */
+
+template <typename T>
+struct BinCountsTestFixture : public BinTestFixture {};
+
+TYPED_TEST_SUITE(BinCountsTestFixture, NumericTypesNotBool);
+
+// Counts must match the labels of label_bins, skipping nulls and out of bounds values.
+TYPED_TEST(BinCountsTestFixture, TestEdges)
+{
+  fwc_wrapper<TypeParam> left_edges{0, 2, 4, 6, 8};
+  fwc_wrapper<TypeParam> right_edges{2, 4, 6, 8, 10};
+  fwc_wrapper<TypeParam> input{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                               {1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}};
+
+  auto result =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  fwc_wrapper<int64_t> expected{2, 1, 2, 2, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+// The last uniform bin includes the upper bound.
+TYPED_TEST(BinCountsTestFixture, TestUniform)
+{
+  fwc_wrapper<TypeParam> input{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                               {1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}};
+
+  auto result = cudf::bin_counts(input, 0.0, 8.0, 2);
+
+  fwc_wrapper<int64_t> expected{3, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+TYPED_TEST(BinCountsTestFixture, TestEmptyInput)
+{
+  fwc_wrapper<TypeParam> input{};
+
+  auto result = cudf::bin_counts(input, 0.0, 10.0, 4);
+
+  fwc_wrapper<int64_t> expected{0, 0, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+// More bins than fit in shared memory are counted in global memory.
+TEST(BinCountsTest, TestManyBins)
+{
+  auto constexpr num_bins = cudf::size_type{10000};
+  auto const values       = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % num_bins); });
+  fwc_wrapper<int32_t> input(values, values + 3 * num_bins);
+
+  auto result = cudf::bin_counts(input, 0.0, static_cast<double>(num_bins), num_bins);
+
+  auto const threes = thrust::make_constant_iterator<int64_t>(3);
+  fwc_wrapper<int64_t> expected(threes, threes + num_bins);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+TEST(BinCountsTest, TestNaN)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fwc_wrapper<double> input{nan, 1.0, nan, 2.5};
+
+  auto result = cudf::bin_counts(input, 0.0, 4.0, 2);
+
+  fwc_wrapper<int64_t> expected{1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+TEST(BinCountsTest, TestStrings)
+{
+  cudf::test::strings_column_wrapper left_edges{"a", "b", "c"};
+  cudf::test::strings_column_wrapper right_edges{"b", "c", "d"};
+  cudf::test::strings_column_wrapper input{{"abc", "bcd", "cde", "bb", "def", "b"},
+                                           {1, 1, 1, 0, 1, 1}};
+
+  auto result =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  fwc_wrapper<int64_t> expected{1, 2, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+};
+
+TEST(BinCountsTest, TestInvalidUniformBins)
+{
+  fwc_wrapper<float> input{0, 1};
+  fpc_wrapper<int32_t> decimals{{0, 1}, numeric::scale_type{0}};
+
+  EXPECT_THROW(cudf::bin_counts(input, 0.0, 1.0, 0), std::invalid_argument);
+  EXPECT_THROW(cudf::bin_counts(input, 1.0, 1.0, 2), std::invalid_argument);
+  EXPECT_THROW(cudf::bin_counts(input, 0.0, std::numeric_limits<double>::infinity(), 2),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::bin_counts(decimals, 0.0, 1.0, 2), cudf::data_type_error);
+};
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
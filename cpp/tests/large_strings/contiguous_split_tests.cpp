@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "large_strings_fixture.hpp"
+
+#include <cudf_test/column_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+struct ContiguousSplitTest : public cudf::test::StringsLargeTest {};
+
+TEST_F(ContiguousSplitTest, LargeStrings)
+{
+  auto input = this->long_column();
+  auto view  = cudf::column_view(input);
+  std::vector<cudf::column_view> input_cols;
+  std::vector<cudf::size_type> splits;
+  int const multiplier = 10;
+  for (int i = 0; i < multiplier; ++i) {  // 2500MB > 2GB
+    input_cols.push_back(view);
+    splits.push_back(view.size() * (i + 1));
+  }
+  splits.pop_back();  // remove last entry
+  auto large = cudf::concatenate(input_cols);
+  EXPECT_EQ(cudf::strings_column_view(large->view()).offsets().type(),
+            cudf::data_type{cudf::type_id::INT64});
+
+  // the later partitions start beyond the 2GB mark of the source chars
+  auto result = cudf::contiguous_split(cudf::table_view{{large->view()}}, splits);
+  EXPECT_EQ(result.size(), static_cast<std::size_t>(multiplier));
+  for (auto const& p : result) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(p.table.column(0), input);
+  }
+
+  // the packed form of the whole column round-trips as well
+  auto packed   = cudf::pack(cudf::table_view{{large->view()}});
+  auto unpacked = cudf::unpack(packed);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(unpacked.column(0), large->view());
+}
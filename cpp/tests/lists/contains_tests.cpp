@@ -729,6 +729,67 @@ TYPED_TEST(TypedVectorContainsTest, ListContainsVectorWithNullsInListsAndInSearc
   }
 }
 
+TYPED_TEST(TypedVectorContainsTest, HashedListsWithNullsInListsAndInSearchKeys)
+{
+  using T = TypeParam;
+
+  auto numerals = cudf::test::fixed_width_column_wrapper<T>{
+    {X, 1, 2, X, 4, 5, X, 7, 8, X, X, 1, 2, X, 1}, nulls_at({0, 3, 6, 9, 10, 13})};
+
+  auto input_null_mask_iter = null_at(4);
+  auto [null_mask, null_count] =
+    cudf::test::detail::make_null_mask(input_null_mask_iter, input_null_mask_iter + 8);
+  auto search_space = cudf::make_lists_column(8,
+                                              indices_col{0, 1, 3, 7, 7, 7, 10, 11, 15}.release(),
+                                              numerals.release(),
+                                              null_count,
+                                              std::move(null_mask));
+
+  // Search space: [ [x], [1,2], [x,4,5,x], [], x, [7,8,x], [x], [1,2,x,1] ]
+  auto const hashed = cudf::lists::hashed_lists(search_space->view());
+
+  // The same hash table answers lookups of several columns of search keys.
+  {
+    auto search_keys =
+      cudf::test::fixed_width_column_wrapper<T, int32_t>{{1, 2, 3, X, 2, 3, 1, 1}, null_at(3)};
+    {
+      // CONTAINS
+      auto result   = hashed.contains(search_keys);
+      auto expected = bools_col{{0, 1, 0, X, X, 0, 0, 1}, nulls_at({3, 4})};
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+    }
+    {
+      // FIND_FIRST
+      auto result = hashed.index_of(search_keys, FIND_FIRST);
+      auto expected =
+        indices_col{{ABSENT, 1, ABSENT, X, X, ABSENT, ABSENT, 0}, nulls_at({3, 4})};
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+    }
+    {
+      // FIND_LAST
+      auto result = hashed.index_of(search_keys, FIND_LAST);
+      auto expected =
+        indices_col{{ABSENT, 1, ABSENT, X, X, ABSENT, ABSENT, 3}, nulls_at({3, 4})};
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+    }
+  }
+  {
+    auto search_keys = cudf::test::fixed_width_column_wrapper<T, int32_t>{7, 2, 5, 1, 4, 8, 7, 2};
+    {
+      // CONTAINS
+      auto result   = hashed.contains(search_keys);
+      auto expected = bools_col{{0, 1, 1, 0, X, 1, 0, 1}, null_at(4)};
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+    }
+    {
+      // FIND_LAST
+      auto result   = hashed.index_of(search_keys, FIND_LAST);
+      auto expected = indices_col{{ABSENT, 1, 2, ABSENT, X, 1, ABSENT, 1}, null_at(4)};
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+    }
+  }
+}
+
 TEST_F(ContainsTest, BoolKeyVectorWithNullsInListsAndInSearchKeys)
 {
   using T = bool;
@@ -852,6 +913,56 @@ TEST_F(ContainsTest, VectorTypeRelatedExceptions)
   }
 }
 
+TEST_F(ContainsTest, HashedListsStrings)
+{
+  auto strings = cudf::test::strings_column_wrapper{
+    {"X", "1", "2", "X", "4", "5", "X", "7", "8", "X", "X", "1", "2", "X", "1"},
+    nulls_at({0, 3, 6, 9, 10, 13})};
+  auto search_space = cudf::make_lists_column(
+    8,
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 1, 3, 7, 7, 7, 10, 11, 15}.release(),
+    strings.release(),
+    0,
+    {});
+  // Search space: [ [x], [1,2], [x,4,5,x], [], [], [7,8,x], [x], [1,2,x,1] ]
+
+  // The hash table of a sliced lists column only holds the elements of the slice.
+  auto const sliced = cudf::slice(search_space->view(), {1, 8})[0];
+  auto const hashed = cudf::lists::hashed_lists(sliced);
+
+  auto search_keys =
+    cudf::test::strings_column_wrapper{{"2", "5", "X", "1", "8", "X", "1"}, null_at(2)};
+  {
+    // FIND_FIRST
+    auto result   = hashed.index_of(search_keys, FIND_FIRST);
+    auto expected = indices_col{{1, 2, X, ABSENT, 1, ABSENT, 0}, null_at(2)};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_LAST
+    auto result   = hashed.index_of(search_keys, FIND_LAST);
+    auto expected = indices_col{{1, 2, X, ABSENT, 1, ABSENT, 3}, null_at(2)};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
+TEST_F(ContainsTest, HashedListsTypeRelatedExceptions)
+{
+  {
+    // Nested elements are not supported.
+    auto list_of_lists = cudf::test::lists_column_wrapper<int32_t>{{{1, 2}, {3}}, {{4}}};
+    EXPECT_THROW(cudf::lists::hashed_lists{cudf::lists_column_view{list_of_lists}},
+                 cudf::data_type_error);
+  }
+  {
+    // Search keys must match the element type.
+    auto search_space = cudf::test::lists_column_wrapper<int32_t>{{1, 2}, {3}};
+    auto const hashed = cudf::lists::hashed_lists(search_space);
+    auto search_keys  = cudf::test::fixed_width_column_wrapper<int64_t>{1, 3};
+    EXPECT_THROW(hashed.contains(search_keys), cudf::data_type_error);
+  }
+}
+
 template <typename T>
 struct TypedContainsNaNsTest : public ContainsTest {};
 
@@ -999,6 +1110,35 @@ TYPED_TEST(TypedContainsNaNsTest, ListWithNaNsContainsVector)
   }
 }
 
+TYPED_TEST(TypedContainsNaNsTest, HashedListsWithNaNs)
+{
+  using T = TypeParam;
+
+  auto nan_1 = get_nan<T>("1");
+  auto nan_2 = get_nan<T>("2");
+  auto nan_3 = get_nan<T>("3");
+
+  auto search_space = cudf::test::lists_column_wrapper<T>{
+    {0.0, 1.0, 2.0}, {{3, 4, 5}, null_at(2)}, {nan_1, 3.0, nan_2}, {-0.0, 1.0}, {}}.release();
+  auto const hashed = cudf::lists::hashed_lists(search_space->view());
+
+  auto search_key_values = std::vector<T>{nan_3, 5.0, nan_3, 0.0, nan_3};
+  auto search_keys       = cudf::test::fixed_width_column_wrapper<T>(search_key_values.begin(),
+                                                               search_key_values.end());
+  {
+    // FIND_FIRST
+    auto result   = hashed.index_of(search_keys, FIND_FIRST);
+    auto expected = indices_col{ABSENT, ABSENT, 0, 0, ABSENT};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    // FIND_LAST
+    auto result   = hashed.index_of(search_keys, FIND_LAST);
+    auto expected = indices_col{ABSENT, ABSENT, 2, 0, ABSENT};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
 template <typename T>
 struct TypedContainsDecimalsTest : public ContainsTest {};
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,7 +27,9 @@
 #include <cudf/null_mask.hpp>
 
 #include <limits>
+#include <numeric>
 #include <string>
+#include <vector>
 
 using float_type = double;
 using namespace cudf::test::iterators;
@@ -421,6 +423,42 @@ TYPED_TEST(SetIntersectTypedTest, InputHaveNullsTests)
   }
 }
 
+TEST_F(SetIntersectTest, ShortAndLongLists)
+{
+  using lists_col = cudf::test::lists_column_wrapper<int32_t>;
+
+  // Lists are compared directly when no list has more than 32 elements, and by hashing otherwise.
+  auto const short_lhs = lists_col{lists_col{{1, 2, 2, null, 3, null}, nulls_at({3, 5})}, {4, 5}};
+  auto const short_rhs = lists_col{lists_col{{2, 2, null, 1}, null_at(2)}, {6}};
+
+  std::vector<int32_t> long_values(40);
+  std::iota(long_values.begin(), long_values.end(), 0);
+  auto const long_lhs = lists_col{lists_col{{1, 2, 2, null, 3, null}, nulls_at({3, 5})},
+                                  {4, 5},
+                                  lists_col(long_values.begin(), long_values.end())};
+  auto const long_rhs = lists_col{lists_col{{2, 2, null, 1}, null_at(2)},
+                                  {6},
+                                  lists_col(long_values.begin() + 20, long_values.end())};
+
+  {
+    auto const expected       = lists_col{lists_col{{null, 1, 2}, null_at(0)}, lists_col{}};
+    auto const results_sorted = set_intersect_sorted(short_lhs, short_rhs, NULL_EQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *results_sorted);
+  }
+  {
+    auto const expected       = lists_col{{1, 2}, lists_col{}};
+    auto const results_sorted = set_intersect_sorted(short_lhs, short_rhs, NULL_UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *results_sorted);
+  }
+  {
+    auto const expected = lists_col{lists_col{{null, 1, 2}, null_at(0)},
+                                    lists_col{},
+                                    lists_col(long_values.begin() + 20, long_values.end())};
+    auto const results_sorted = set_intersect_sorted(long_lhs, long_rhs, NULL_EQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *results_sorted);
+  }
+}
+
 TEST_F(SetIntersectTest, InputListsOfNestedStructsHaveNull)
 {
   auto const get_structs_lhs = [] {
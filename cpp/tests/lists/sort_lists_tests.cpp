@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,10 +17,14 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/lists/sorting.hpp>
 
+#include <algorithm>
+#include <vector>
+
 template <typename T>
 using LCW = cudf::test::lists_column_wrapper<T, int32_t>;
 
@@ -238,6 +242,43 @@ TEST_F(SortListsInt, Sliced)
   }
 }
 
+TEST_F(SortListsInt, ShortAndLongLists)
+{
+  using T = int;
+  using cudf::test::iterators::null_at;
+
+  // Lists of up to 32 elements are sorted in registers, and longer lists by the segmented sort.
+  for (auto const size : {31, 32, 33}) {
+    std::vector<T> values(size);
+    for (int i = 0; i < size; ++i) {
+      values[i] = (i * 7) % 10;
+    }
+    // The first element is null, which sorts first in ascending order.
+    std::vector<T> expected_values(values);
+    std::sort(expected_values.begin() + 1, expected_values.end());
+    LCW<T> list{LCW<T>(values.begin(), values.end(), null_at(0)), {3, 1, 2}};
+
+    {
+      LCW<T> expected{LCW<T>(expected_values.begin(), expected_values.end(), null_at(0)),
+                      {1, 2, 3}};
+      auto const [sorted_lists, stable_sorted_lists] = generate_sorted_lists(
+        cudf::lists_column_view{list}, cudf::order::ASCENDING, cudf::null_order::BEFORE);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_lists->view(), expected);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(stable_sorted_lists->view(), expected);
+    }
+
+    std::reverse(expected_values.begin(), expected_values.end());
+    {
+      LCW<T> expected{LCW<T>(expected_values.begin(), expected_values.end(), null_at(size - 1)),
+                      {3, 2, 1}};
+      auto const [sorted_lists, stable_sorted_lists] = generate_sorted_lists(
+        cudf::lists_column_view{list}, cudf::order::DESCENDING, cudf::null_order::BEFORE);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_lists->view(), expected);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(stable_sorted_lists->view(), expected);
+    }
+  }
+}
+
 using SortListsDouble = SortLists<double>;
 TEST_F(SortListsDouble, InfinityAndNaN)
 {
@@ -25,6 +25,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -988,6 +989,40 @@ TEST_F(MergeTest, NestedListsofStructs)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected_tbl, *result);
 }
 
+TEST_F(MergeTest, ManyTables)
+{
+  cudf::size_type const num_tables = 7;
+  cudf::size_type const nrows      = 3000;
+  std::vector<std::unique_ptr<cudf::table>> sorted_tables;
+  for (cudf::size_type i = 0; i < num_tables; ++i) {
+    auto key_iter = cudf::detail::make_counting_transform_iterator(
+      0, [i](auto row) { return (row * (i + 3)) % 101; });
+    auto valids = cudf::detail::make_counting_transform_iterator(
+      0, [i](auto row) { return (row + i) % 11 != 0; });
+    auto payload_iter = thrust::make_counting_iterator<int32_t>(i * nrows);
+    cudf::test::fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + nrows, valids);
+    cudf::test::fixed_width_column_wrapper<int32_t> payload(payload_iter, payload_iter + nrows);
+    sorted_tables.push_back(cudf::stable_sort_by_key(cudf::table_view({keys, payload}),
+                                                     cudf::table_view({keys}),
+                                                     {cudf::order::DESCENDING},
+                                                     {cudf::null_order::AFTER}));
+  }
+  std::vector<cudf::table_view> views;
+  for (auto const& table : sorted_tables) {
+    views.push_back(table->view());
+  }
+
+  auto result = cudf::merge(views, {0}, {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+
+  // equal keys keep the order of their tables
+  auto all_rows = cudf::concatenate(views);
+  auto expected = cudf::stable_sort_by_key(all_rows->view(),
+                                           all_rows->view().select({0}),
+                                           {cudf::order::DESCENDING},
+                                           {cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {};
 
@@ -21,6 +21,8 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
@@ -30,6 +32,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
+
 using cudf::test::fixed_width_column_wrapper;
 using cudf::test::strings_column_wrapper;
 using structs_col = cudf::test::structs_column_wrapper;
@@ -326,6 +330,55 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY, true);
 }
 
+TEST_F(HashPartition, ManyPartitionsWithStrings)
+{
+  auto constexpr num_rows = 10000;
+  auto const iter         = thrust::make_counting_iterator(0);
+  auto const to_string    = [](auto i) { return std::to_string(i); };
+  auto const valids       = thrust::make_transform_iterator(iter, [](auto i) { return i % 5; });
+  fixed_width_column_wrapper<int32_t> keys(iter, iter + num_rows);
+  strings_column_wrapper strings(thrust::make_transform_iterator(iter, to_string),
+                                 thrust::make_transform_iterator(iter + num_rows, to_string),
+                                 valids);
+  auto const input = cudf::table_view({keys, strings});
+
+  // The shared-memory copy path and the large partition count path
+  for (cudf::size_type const num_partitions : {1000, 2000}) {
+    auto [output, offsets] = cudf::hash_partition(input, {0}, num_partitions);
+    EXPECT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+    EXPECT_TRUE(std::is_sorted(offsets.begin(), offsets.end()));
+
+    // Rows are only reordered: the strings stay with their keys
+    auto const sorted = cudf::sort_by_key(output->view(), output->view().select({0}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(input, sorted->view());
+  }
+}
+
+TEST_F(HashPartition, PartitionAndPack)
+{
+  auto constexpr num_rows = 1000;
+  auto const iter         = thrust::make_counting_iterator(0);
+  auto const to_string    = [](auto i) { return std::to_string(i); };
+  auto const valids       = thrust::make_transform_iterator(iter, [](auto i) { return i % 3; });
+  fixed_width_column_wrapper<int32_t> keys(iter, iter + num_rows);
+  strings_column_wrapper strings(thrust::make_transform_iterator(iter, to_string),
+                                 thrust::make_transform_iterator(iter + num_rows, to_string),
+                                 valids);
+  auto const input = cudf::table_view({keys, strings});
+
+  cudf::size_type const num_partitions = 7;
+  auto const [expected, offsets] = cudf::hash_partition(input, {0}, num_partitions);
+  auto const packed              = cudf::hash_partition_and_pack(input, {0}, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), packed.size());
+
+  auto const splits         = std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end());
+  auto const expected_parts = cudf::split(expected->view(), splits);
+  for (cudf::size_type i = 0; i < num_partitions; ++i) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_parts[i], packed[i].table);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_parts[i], cudf::unpack(packed[i].data));
+  }
+}
+
 TEST_F(HashPartition, FixedPointColumnsToHash)
 {
   fixed_width_column_wrapper<int32_t> to_hash({1});
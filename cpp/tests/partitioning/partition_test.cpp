@@ -345,3 +345,34 @@ TEST_F(PartitionTestNotTyped, NoIntegerOverflow)
 
   run_partition_test(table_to_partition, map, 2, expected_table, expected_offsets);
 }
+
+TEST_F(PartitionTestNotTyped, RangePartition)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9, 3, 7, 3};
+  cudf::test::strings_column_wrapper payload{"e", "a", "i", "c", "g", "cc"};
+  auto table_to_partition = cudf::table_view{{keys, payload}};
+  fixed_width_column_wrapper<int32_t> splits{3, 7};
+
+  auto result = cudf::range_partition(
+    table_to_partition, {0}, cudf::table_view{{splits}}, {cudf::order::ASCENDING}, {});
+
+  std::vector<cudf::size_type> expected_offsets{0, 3, 5, 6};
+  EXPECT_EQ(result.second, expected_offsets);
+
+  fixed_width_column_wrapper<int32_t> expected_keys{1, 3, 3, 5, 7, 9};
+  cudf::test::strings_column_wrapper expected_payload{"a", "c", "cc", "e", "g", "i"};
+  expect_equal_partitions(
+    cudf::table_view{{expected_keys, expected_payload}}, *result.first, expected_offsets);
+}
+
+TEST_F(PartitionTestNotTyped, RangePartitionMismatchedKeys)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9};
+  fixed_width_column_wrapper<int32_t> splits{3};
+  EXPECT_THROW(cudf::range_partition(cudf::table_view{{keys}},
+                                     {0, 0},
+                                     cudf::table_view{{splits}},
+                                     {},
+                                     {}),
+               std::invalid_argument);
+}
@@ -21,7 +21,10 @@
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/quantiles.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -471,6 +474,85 @@ TEST_F(QuantileDictionaryTest, TestValid)
     result->view(), cudf::test::fixed_width_column_wrapper<double>{3.5, 5.5, 7.5});
 };
 
+template <typename T>
+struct QuantileBySelectionTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(QuantileBySelectionTest, TestTypes);
+
+TYPED_TEST(QuantileBySelectionTest, MatchesSortedQuantile)
+{
+  using T = TypeParam;
+
+  auto const data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 101 - 50; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 9 != 0; });
+  cudf::test::fixed_width_column_wrapper<T, int32_t> nullable_input(data, data + 1000, validity);
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input(data, data + 1000);
+
+  std::vector<double> const q{0.0, 0.01, 0.25, 0.5, 0.95, 0.99, 1.0};
+  for (cudf::column_view const col :
+       {cudf::column_view{input}, cudf::column_view{nullable_input}}) {
+    // the quantiles of the sorted valid values
+    auto const sorted  = cudf::sorted_order(cudf::table_view{{col}}, {}, {cudf::null_order::AFTER});
+    auto const indices = cudf::slice(*sorted, {0, col.size() - col.null_count()}).front();
+    for (auto interp : {cudf::interpolation::LINEAR,
+                        cudf::interpolation::LOWER,
+                        cudf::interpolation::HIGHER,
+                        cudf::interpolation::MIDPOINT,
+                        cudf::interpolation::NEAREST}) {
+      for (bool exact : {true, false}) {
+        auto const expected = cudf::quantile(col, q, interp, indices, exact);
+        auto const result   = cudf::quantile_by_selection(col, q, interp, exact);
+        CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *result);
+      }
+    }
+  }
+}
+
+TYPED_TEST(QuantileBySelectionTest, AllNulls)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> input({1, 2, 3}, {0, 0, 0});
+
+  auto const result = cudf::quantile_by_selection(input, {0.0, 0.5});
+
+  cudf::test::fixed_width_column_wrapper<double> expected({0.0, 0.0}, {0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TYPED_TEST(QuantileBySelectionTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{};
+
+  auto const result = cudf::quantile_by_selection(input, {});
+
+  EXPECT_EQ(result->size(), 0);
+}
+
+TEST_F(QuantileDictionaryTest, BySelectionUnsupported)
+{
+  cudf::test::dictionary_column_wrapper<int32_t> col{1, 2, 3};
+
+  EXPECT_THROW(cudf::quantile_by_selection(col, {0.5}), cudf::data_type_error);
+}
+
+struct QuantileBySelectionFloatTest : public cudf::test::BaseFixture {};
+
+TEST_F(QuantileBySelectionFloatTest, NegativeValuesAndNaN)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  auto const inf = std::numeric_limits<double>::infinity();
+  cudf::test::fixed_width_column_wrapper<double> input{
+    3.5, -nan, -inf, -0.25, nan, -7.0, inf, 1.0, 2.0};
+
+  // the sorted values are -inf, -7.0, -0.25, 1.0, 2.0, 3.5, inf, nan, nan
+  auto const result = cudf::quantile_by_selection(
+    input, {0.0, 0.125, 0.5, 0.75, 1.0}, cudf::interpolation::LOWER);
+
+  cudf::test::fixed_width_column_wrapper<double> expected{-inf, -7.0, 2.0, inf, nan};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -15,12 +15,14 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -3149,4 +3151,123 @@ TEST_F(StructReductionTest, StructReductionMinMaxWithNulls)
   }
 }
 
+struct ReduceManyTest : public cudf::test::BaseFixture {
+  void expect_same_as_reduce(cudf::column_view const& col,
+                             std::vector<std::unique_ptr<reduce_aggregation>> const& aggs,
+                             std::vector<cudf::data_type> const& output_dtypes,
+                             std::vector<std::unique_ptr<cudf::scalar>> const& results)
+  {
+    ASSERT_EQ(results.size(), aggs.size());
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      auto const expected = cudf::reduce(col, *aggs[idx], output_dtypes[idx]);
+      EXPECT_EQ(results[idx]->type(), expected->type());
+      EXPECT_EQ(results[idx]->is_valid(), expected->is_valid());
+      if (expected->is_valid()) {
+        CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*cudf::make_column_from_scalar(*expected, 1),
+                                            *cudf::make_column_from_scalar(*results[idx], 1));
+      }
+    }
+  }
+};
+
+TEST_F(ReduceManyTest, Integers)
+{
+  auto const col = cudf::test::fixed_width_column_wrapper<int32_t>{
+    {6, -14, 13, 109, -13, -20, 0, 98, 122, 123, 2147483647, 5},
+    {1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1}};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>(0));
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_nunique_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_median_aggregation<reduce_aggregation>());
+  auto const int32   = cudf::data_type{cudf::type_id::INT32};
+  auto const int64   = cudf::data_type{cudf::type_id::INT64};
+  auto const float32 = cudf::data_type{cudf::type_id::FLOAT32};
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  std::vector<cudf::data_type> const output_dtypes{
+    int64, int32, int64, int32, int32, float64, float64, float64, float32, int32, float64};
+
+  auto const results = cudf::reduce_many(col, aggs, output_dtypes);
+  expect_same_as_reduce(col, aggs, output_dtypes, results);
+
+  auto const sliced = cudf::slice(col, {3, 9}).front();
+  expect_same_as_reduce(
+    sliced, aggs, output_dtypes, cudf::reduce_many(sliced, aggs, output_dtypes));
+
+  auto const empty = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  expect_same_as_reduce(empty, aggs, output_dtypes, cudf::reduce_many(empty, aggs, output_dtypes));
+
+  auto const all_nulls = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2}, {0, 0}};
+  expect_same_as_reduce(
+    all_nulls, aggs, output_dtypes, cudf::reduce_many(all_nulls, aggs, output_dtypes));
+}
+
+TEST_F(ReduceManyTest, FloatingPoint)
+{
+  auto const col = cudf::test::fixed_width_column_wrapper<float>{
+    {6.5f, -1.25f, 13.f, 10.75f, -3.f, 2.5f, 0.f, 9.25f}, {1, 1, 1, 0, 1, 1, 1, 1}};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>());
+  auto const float32 = cudf::data_type{cudf::type_id::FLOAT32};
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  std::vector<cudf::data_type> const output_dtypes{float32, float64, float32, float32, float64};
+
+  expect_same_as_reduce(col, aggs, output_dtypes, cudf::reduce_many(col, aggs, output_dtypes));
+}
+
+TEST_F(ReduceManyTest, Table)
+{
+  auto const ints    = cudf::test::fixed_width_column_wrapper<int16_t>{{4, 8, -2, 7}, {1, 0, 1, 1}};
+  auto const doubles = cudf::test::fixed_width_column_wrapper<double>{1.5, -2.5, 8.0, 0.25};
+  auto const input   = cudf::table_view{{ints, doubles}};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<reduce_aggregation>());
+
+  auto const results = cudf::reduce_many(input, aggs);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0][0]->type(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(results[0][1]->type(), cudf::data_type{cudf::type_id::INT16});
+  EXPECT_EQ(results[0][3]->type(), cudf::data_type{cudf::type_id::FLOAT64});
+  for (cudf::size_type col_idx = 0; col_idx < input.num_columns(); ++col_idx) {
+    std::vector<cudf::data_type> output_dtypes;
+    for (auto const& result : results[col_idx]) {
+      output_dtypes.push_back(result->type());
+    }
+    expect_same_as_reduce(input.column(col_idx), aggs, output_dtypes, results[col_idx]);
+  }
+}
+
+TEST_F(ReduceManyTest, Errors)
+{
+  auto const col = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(nullptr);
+  auto const int64 = cudf::data_type{cudf::type_id::INT64};
+
+  EXPECT_THROW(cudf::reduce_many(col, aggs, std::vector<cudf::data_type>{int64}),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::reduce_many(col, aggs, std::vector<cudf::data_type>{int64, int64}),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::reduce_many(cudf::table_view{{col}}, aggs), std::invalid_argument);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
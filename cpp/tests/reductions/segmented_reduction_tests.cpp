@@ -24,6 +24,7 @@
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -1141,6 +1142,80 @@ TEST_F(SegmentedReductionTestUntyped, EmptyInputWithOffsets)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect_bool);
 }
 
+TEST_F(SegmentedReductionTestUntyped, MixedSegmentLengths)
+{
+  // segments of all lengths from empty to longer than a single block reduces
+  auto const sizes = std::vector<cudf::size_type>{
+    0, 1, 3, 8, 9, 20, 512, 513, 3000, 65536, 65537, 200000, 2, 0, 70000, 4};
+  auto offsets = std::vector<cudf::size_type>{0};
+  for (auto size : sizes) {
+    offsets.push_back(offsets.back() + size);
+  }
+  auto const num_rows = offsets.back();
+
+  auto values   = std::vector<int32_t>(num_rows);
+  auto validity = std::vector<bool>(num_rows);
+  for (cudf::size_type idx = 0; idx < num_rows; ++idx) {
+    values[idx]   = (idx % 17) - 8;
+    validity[idx] = idx % 5 != 4;
+  }
+  auto const input =
+    cudf::test::fixed_width_column_wrapper<int32_t>(values.begin(), values.end(), validity.begin());
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    offsets, cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+
+  auto sums       = std::vector<int64_t>();
+  auto init_sums  = std::vector<int64_t>();
+  auto maxes      = std::vector<int32_t>();
+  auto sums_valid = std::vector<bool>();
+  for (std::size_t segment = 0; segment < sizes.size(); ++segment) {
+    int64_t sum    = 0;
+    int32_t max    = std::numeric_limits<int32_t>::lowest();
+    bool any_valid = false;
+    for (auto idx = offsets[segment]; idx < offsets[segment + 1]; ++idx) {
+      if (!validity[idx]) { continue; }
+      max       = std::max(max, values[idx]);
+      any_valid = true;
+      sum += values[idx];
+    }
+    sums.push_back(sum);
+    init_sums.push_back(sum + 10);
+    maxes.push_back(max);
+    sums_valid.push_back(any_valid);
+  }
+
+  auto const int64_type = cudf::data_type{cudf::type_id::INT64};
+  auto result =
+    cudf::segmented_reduce(input,
+                           d_offsets,
+                           *cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>(),
+                           int64_type,
+                           cudf::null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result,
+    cudf::test::fixed_width_column_wrapper<int64_t>(sums.begin(), sums.end(), sums_valid.begin()));
+
+  auto const init_scalar = cudf::make_fixed_width_scalar<int32_t>(10);
+  result =
+    cudf::segmented_reduce(input,
+                           d_offsets,
+                           *cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>(),
+                           int64_type,
+                           cudf::null_policy::EXCLUDE,
+                           *init_scalar);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result, cudf::test::fixed_width_column_wrapper<int64_t>(init_sums.begin(), init_sums.end()));
+
+  result = cudf::segmented_reduce(input,
+                                  d_offsets,
+                                  *cudf::make_max_aggregation<cudf::segmented_reduce_aggregation>(),
+                                  cudf::data_type{cudf::type_id::INT32},
+                                  cudf::null_policy::EXCLUDE);
+  auto const expected_maxes =
+    cudf::test::fixed_width_column_wrapper<int32_t>(maxes.begin(), maxes.end(), sums_valid.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_maxes);
+}
+
 template <typename T>
 struct SegmentedReductionFixedPointTest : public cudf::test::BaseFixture {};
 
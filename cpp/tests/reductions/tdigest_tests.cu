@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,11 +15,19 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/tdigest_utilities.cuh>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/tdigest/tdigest.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/quantiles.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
 template <typename T>
 struct ReductionTDigestAllTypes : public cudf::test::BaseFixture {};
@@ -160,3 +168,90 @@ TEST_F(ReductionTDigestMerge, FewHeavyCentroids)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
 }
+
+struct reduce_buffered_op {
+  cudf::size_type buffer_size;
+
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& values, int delta) const
+  {
+    // result is a scalar, but we want to extract out the underlying column
+    auto scalar_result =
+      cudf::tdigest::detail::reduce_tdigest_buffered(values,
+                                                     delta,
+                                                     buffer_size,
+                                                     cudf::get_default_stream(),
+                                                     rmm::mr::get_current_device_resource());
+    auto tbl = static_cast<cudf::struct_scalar const*>(scalar_result.get())->view();
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    std::transform(
+      tbl.begin(), tbl.end(), std::back_inserter(cols), [](cudf::column_view const& col) {
+        return std::make_unique<cudf::column>(col);
+      });
+    return cudf::make_structs_column(tbl.num_rows(), std::move(cols), 0, rmm::device_buffer());
+  }
+};
+
+struct ReductionTDigestBuffered : public cudf::test::BaseFixture {};
+
+// the percentiles of a digest built from sorted buffers are compared against the ones of the
+// digest built from a full sort of the same values
+void tdigest_buffered_compare(cudf::column_view const& values, cudf::size_type buffer_size)
+{
+  int const delta = 1000;
+  auto expected   = reduce_op{}(values, delta);
+  auto result     = reduce_buffered_op{buffer_size}(values, delta);
+  cudf::tdigest::tdigest_column_view expected_tdv(*expected);
+  cudf::tdigest::tdigest_column_view result_tdv(*result);
+
+  cudf::test::fixed_width_column_wrapper<double> percentiles{
+    0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+  auto const expected_percentiles = cudf::percentile_approx(expected_tdv, percentiles);
+  auto const result_percentiles   = cudf::percentile_approx(result_tdv, percentiles);
+  auto const h_expected =
+    cudf::test::to_host<double>(cudf::lists_column_view(*expected_percentiles).child()).first;
+  auto const h_result =
+    cudf::test::to_host<double>(cudf::lists_column_view(*result_percentiles).child()).first;
+  ASSERT_EQ(h_result.size(), h_expected.size());
+  for (std::size_t idx = 0; idx < h_expected.size(); ++idx) {
+    // the values span [0, 100)
+    EXPECT_NEAR(h_result[idx], h_expected[idx], 0.25);
+  }
+
+  // the min and max are exact
+  auto const minmax = [](cudf::tdigest::tdigest_column_view const& tdv) {
+    auto const type = cudf::data_type{cudf::type_id::FLOAT64};
+    return std::pair{cudf::column_view(type, tdv.size(), tdv.min_begin(), nullptr, 0),
+                     cudf::column_view(type, tdv.size(), tdv.max_begin(), nullptr, 0)};
+  };
+  auto const [expected_min, expected_max] = minmax(expected_tdv);
+  auto const [result_min, result_max]     = minmax(result_tdv);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_min, expected_min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_max, expected_max);
+}
+
+TEST_F(ReductionTDigestBuffered, MatchesSortedDigest)
+{
+  auto values = cudf::test::generate_standardized_percentile_distribution();
+  tdigest_buffered_compare(*values, 1 << 14);
+  tdigest_buffered_compare(*values, 1 << 16);
+}
+
+TEST_F(ReductionTDigestBuffered, MatchesSortedDigestWithNulls)
+{
+  auto values   = cudf::test::generate_standardized_percentile_distribution();
+  auto validity = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 7 != 0; });
+  auto [null_mask, null_count] =
+    cudf::test::detail::make_null_mask(validity, validity + values->size());
+  values->set_null_mask(std::move(null_mask), null_count);
+  tdigest_buffered_compare(*values, 1 << 14);
+}
+
+TEST_F(ReductionTDigestBuffered, SingleBuffer)
+{
+  // an input that fits in one buffer produces exactly the digest of the full sort
+  auto values   = cudf::test::generate_standardized_percentile_distribution();
+  auto expected = reduce_op{}(*values, 1000);
+  auto result   = reduce_buffered_op{values->size()}(*values, 1000);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
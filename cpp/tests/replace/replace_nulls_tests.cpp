@@ -304,6 +304,27 @@ TYPED_TEST(ReplaceNullsTest, ReplaceScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, ReplaceScalarInPlace)
+{
+  auto const inputColumn = cudf::test::make_type_param_vector<TypeParam>({0, 1, 2, 3, 4, 5});
+  auto const inputValid =
+    cudf::test::make_type_param_vector<cudf::valid_type>({0, 1, 0, 1, 1, 0});
+  auto const expectedColumn = cudf::test::make_type_param_vector<TypeParam>({7, 1, 7, 3, 4, 7});
+  cudf::numeric_scalar<TypeParam> replacement(7);
+
+  auto input = cudf::test::fixed_width_column_wrapper<TypeParam>(
+                 inputColumn.begin(), inputColumn.end(), inputValid.begin())
+                 .release();
+  auto const data = input->view().head();
+  auto result     = cudf::replace_nulls(std::move(input), replacement);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result,
+    cudf::test::fixed_width_column_wrapper<TypeParam>(expectedColumn.begin(),
+                                                      expectedColumn.end()));
+  EXPECT_EQ(result->view().head(), data);
+  EXPECT_FALSE(result->nullable());
+}
+
 TYPED_TEST(ReplaceNullsTest, ReplacementHasNulls)
 {
   using T = TypeParam;
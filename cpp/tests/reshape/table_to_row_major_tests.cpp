@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/reshape.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <typename T>
+cudf::device_span<std::byte> as_bytes(rmm::device_uvector<T>& buffer)
+{
+  return {reinterpret_cast<std::byte*>(buffer.data()), buffer.size() * sizeof(T)};
+}
+
+template <typename T>
+cudf::column_view as_column(rmm::device_uvector<T> const& buffer)
+{
+  return {cudf::data_type{cudf::type_to_id<T>()},
+          static_cast<cudf::size_type>(buffer.size()),
+          buffer.data(),
+          nullptr,
+          0};
+}
+
+}  // namespace
+
+struct TableToRowMajorTest : public cudf::test::BaseFixture {};
+
+TEST_F(TableToRowMajorTest, MixedTypesWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3}, {1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<float> col2({0.5f, 1.5f, 2.5f});
+  cudf::test::fixed_width_column_wrapper<uint8_t> col3({7, 8, 9}, {0, 1, 1});
+  cudf::table_view input({col1, col2, col3});
+
+  auto output = rmm::device_uvector<double>(9, cudf::get_default_stream());
+  cudf::table_to_row_major(input,
+                           cudf::data_type{cudf::type_id::FLOAT64},
+                           cudf::numeric_scalar<double>(-1.0),
+                           as_bytes(output));
+
+  cudf::test::fixed_width_column_wrapper<double> expected(
+    {1.0, 0.5, -1.0, 2.0, 1.5, 8.0, -1.0, 2.5, 9.0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(output));
+}
+
+TEST_F(TableToRowMajorTest, MultipleTiles)
+{
+  // spans several tiles of rows and of columns with partial tiles on both edges
+  cudf::size_type const num_rows    = 70;
+  cudf::size_type const num_columns = 45;
+  std::vector<cudf::test::fixed_width_column_wrapper<int64_t>> columns;
+  for (cudf::size_type c = 0; c < num_columns; ++c) {
+    auto const values = cudf::detail::make_counting_transform_iterator(
+      0, [c](auto row) { return static_cast<int64_t>(row) * 1000 + c; });
+    columns.emplace_back(values, values + num_rows, cudf::test::iterators::null_at(c));
+  }
+  std::vector<cudf::column_view> views(columns.begin(), columns.end());
+  auto const input = cudf::table_view(views);
+
+  auto output = rmm::device_uvector<int32_t>(num_rows * num_columns, cudf::get_default_stream());
+  cudf::table_to_row_major(input,
+                           cudf::data_type{cudf::type_id::INT32},
+                           cudf::numeric_scalar<int32_t>(-1),
+                           as_bytes(output));
+
+  auto const expected_values = cudf::detail::make_counting_transform_iterator(0, [=](auto idx) {
+    auto const row = idx / num_columns;
+    auto const col = idx % num_columns;
+    return row == col ? -1 : row * 1000 + col;
+  });
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(
+    expected_values, expected_values + num_rows * num_columns);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(output));
+}
+
+TEST_F(TableToRowMajorTest, EmptyTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({});
+  cudf::table_view input({col});
+  auto output = rmm::device_uvector<int32_t>(0, cudf::get_default_stream());
+  EXPECT_NO_THROW(cudf::table_to_row_major(input,
+                                           cudf::data_type{cudf::type_id::INT32},
+                                           cudf::numeric_scalar<int32_t>(0),
+                                           as_bytes(output)));
+}
+
+TEST_F(TableToRowMajorTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3}, {1, 0, 1});
+  cudf::test::strings_column_wrapper strings({"a", "b", "c"});
+  cudf::table_view input({col});
+  auto const int32_type = cudf::data_type{cudf::type_id::INT32};
+  auto output           = rmm::device_uvector<int32_t>(3, cudf::get_default_stream());
+
+  EXPECT_THROW(cudf::table_to_row_major(input,
+                                        cudf::data_type{cudf::type_id::STRING},
+                                        cudf::numeric_scalar<int32_t>(0),
+                                        as_bytes(output)),
+               cudf::data_type_error);
+  EXPECT_THROW(cudf::table_to_row_major(
+                 input, int32_type, cudf::numeric_scalar<int64_t>(0), as_bytes(output)),
+               cudf::data_type_error);
+  EXPECT_THROW(cudf::table_to_row_major(cudf::table_view({strings}),
+                                        int32_type,
+                                        cudf::numeric_scalar<int32_t>(0),
+                                        as_bytes(output)),
+               cudf::data_type_error);
+  EXPECT_THROW(cudf::table_to_row_major(
+                 input, int32_type, cudf::numeric_scalar<int32_t>(0, false), as_bytes(output)),
+               std::invalid_argument);
+
+  auto small_output = rmm::device_uvector<int32_t>(2, cudf::get_default_stream());
+  EXPECT_THROW(cudf::table_to_row_major(
+                 input, int32_type, cudf::numeric_scalar<int32_t>(0), as_bytes(small_output)),
+               std::invalid_argument);
+}
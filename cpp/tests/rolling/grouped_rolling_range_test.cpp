@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include <cudf/null_mask.hpp>
 #include <cudf/rolling.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 
@@ -939,3 +940,85 @@ TEST_F(GroupedRollingRangeOrderByStringTest, Descending_NoParts_WithNulls)
                                    *orderby, cudf::order::DESCENDING, current_row, current_row),
                                  nullable_ints_column({3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 2, 2, 2, 2}));
 }
+
+TEST_F(GroupedRollingRangeOrderByStringTest, MultipleAggregations)
+{
+  // clang-format off
+  auto const orderby =
+      strings_column{
+          "A", "A", "A", "B", "B", "B", // Group 0.
+          "C", "C", "C", "C",           // Group 1.
+          "D", "D", "E", "E"            // Group 2.
+      }.release();
+  // clang-format on
+
+  auto const keys = cudf::table_view{{*grouping_keys}};
+  auto const expect_same_as_single = [&](cudf::range_window_bounds const& preceding,
+                                         cudf::range_window_bounds const& following) {
+    std::vector<cudf::rolling_request> requests;
+    requests.push_back(
+      {*agg_values, min_periods, cudf::make_count_aggregation<cudf::rolling_aggregation>()});
+    requests.push_back(
+      {*agg_values, min_periods, cudf::make_sum_aggregation<cudf::rolling_aggregation>()});
+    requests.push_back(
+      {*orderby, min_periods, cudf::make_max_aggregation<cudf::rolling_aggregation>()});
+    requests.push_back({*agg_values, 4, cudf::make_mean_aggregation<cudf::rolling_aggregation>()});
+
+    auto const results = cudf::grouped_range_rolling_window(
+      keys, *orderby, cudf::order::ASCENDING, preceding, following, requests);
+    ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(requests.size()));
+
+    for (cudf::size_type i = 0; i < results->num_columns(); ++i) {
+      auto const expected = cudf::grouped_range_rolling_window(keys,
+                                                               *orderby,
+                                                               cudf::order::ASCENDING,
+                                                               requests[i].values,
+                                                               preceding,
+                                                               following,
+                                                               requests[i].min_periods,
+                                                               *requests[i].aggregation);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(i).view(), *expected);
+    }
+  };
+
+  expect_same_as_single(unbounded_preceding, current_row);
+  expect_same_as_single(current_row, current_row);
+  expect_same_as_single(unbounded_preceding, unbounded_following);
+
+  auto const empty_results = cudf::grouped_range_rolling_window(
+    keys, *orderby, cudf::order::ASCENDING, unbounded_preceding, current_row, {});
+  EXPECT_EQ(empty_results->num_columns(), 0);
+}
+
+TEST_F(GroupedRollingRangeOrderByStringTest, ReusableWindows)
+{
+  // clang-format off
+  auto const orderby =
+      strings_column{
+          "A", "A", "A", "B", "B", "B", // Group 0.
+          "C", "C", "C", "C",           // Group 1.
+          "D", "D", "E", "E"            // Group 2.
+      }.release();
+  // clang-format on
+
+  auto const keys = cudf::table_view{{*grouping_keys}};
+  auto const [preceding, following] = cudf::make_range_windows(
+    keys, *orderby, cudf::order::ASCENDING, unbounded_preceding, current_row);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*preceding,
+                                 ints_column{1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 1, 2, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*following,
+                                 ints_column{2, 1, 0, 2, 1, 0, 3, 2, 1, 0, 1, 0, 1, 0});
+
+  auto const sum_agg = cudf::make_sum_aggregation<cudf::rolling_aggregation>();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::rolling_window(*agg_values, *preceding, *following, min_periods, *sum_agg),
+    *cudf::grouped_range_rolling_window(keys,
+                                        *orderby,
+                                        cudf::order::ASCENDING,
+                                        *agg_values,
+                                        unbounded_preceding,
+                                        current_row,
+                                        min_periods,
+                                        *sum_agg));
+}
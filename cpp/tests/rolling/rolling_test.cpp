@@ -1170,6 +1170,37 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data, windows large enough to use the prefix sum and sparse table operators
+TYPED_TEST(RollingTest, RandomLargeWindowWithInvalid)
+{
+  cudf::size_type num_rows        = 20000;
+  cudf::size_type max_window_size = 1000;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  cudf::test::fixed_width_column_wrapper<TypeParam> input(
+    col_data.begin(), col_data.end(), col_valid.begin());
+
+  this->run_test_col_agg(input, {max_window_size}, {3}, 1);
+
+  // random parameters
+  cudf::test::UniformRandomGenerator<cudf::size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<cudf::size_type> preceding_window(num_rows);
+  std::vector<cudf::size_type> following_window(num_rows);
+
+  std::generate(preceding_window.begin(), preceding_window.end(), generator);
+  std::generate(following_window.begin(), following_window.end(), generator);
+
+  this->run_test_col_agg(input, preceding_window, following_window, 1);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/rolling.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using ints_column    = cudf::test::fixed_width_column_wrapper<int32_t>;
+using bigints_column = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+struct StreamingRollingWindowTest : public cudf::test::BaseFixture {};
+
+TEST_F(StreamingRollingWindowTest, Sum)
+{
+  auto srw = cudf::streaming_rolling_window(
+    2, 1, 1, cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*srw.update(ints_column{1, 2, 3}), bigints_column{3, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*srw.update(ints_column{4, 5}), bigints_column{9, 12});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*srw.finish(), bigints_column{9});
+}
+
+TEST_F(StreamingRollingWindowTest, MatchesWholeColumn)
+{
+  auto const input = ints_column{{5, 1, 8, 2, 7, 3, 6, 4, 9, 0, 11, 10, 13, 12},
+                                 cudf::test::iterators::nulls_at({2, 7, 8})};
+  auto const batches = cudf::slice(input, {0, 1, 1, 2, 2, 6, 6, 7, 7, 12, 12, 14});
+
+  auto const check = [&](cudf::size_type preceding,
+                         cudf::size_type following,
+                         cudf::size_type min_periods,
+                         auto make_agg) {
+    auto const expected =
+      cudf::rolling_window(input, preceding, following, min_periods, *make_agg());
+
+    auto srw = cudf::streaming_rolling_window(preceding, following, min_periods, make_agg());
+    std::vector<std::unique_ptr<cudf::column>> results;
+    for (auto const& batch : batches) {
+      results.push_back(srw.update(batch));
+    }
+    results.push_back(srw.finish());
+
+    std::vector<cudf::column_view> views;
+    for (auto const& result : results) {
+      views.push_back(result->view());
+    }
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::concatenate(views), *expected);
+  };
+
+  auto const min   = [] { return cudf::make_min_aggregation<cudf::rolling_aggregation>(); };
+  auto const count = [] { return cudf::make_count_aggregation<cudf::rolling_aggregation>(); };
+  auto const mean  = [] { return cudf::make_mean_aggregation<cudf::rolling_aggregation>(); };
+  auto const collect = [] {
+    return cudf::make_collect_list_aggregation<cudf::rolling_aggregation>();
+  };
+
+  check(3, 0, 1, min);
+  check(1, 4, 1, min);
+  check(4, 2, 2, count);
+  check(20, 3, 1, mean);
+  check(2, 2, 1, collect);
+}
+
+TEST_F(StreamingRollingWindowTest, Errors)
+{
+  auto const sum = [] { return cudf::make_sum_aggregation<cudf::rolling_aggregation>(); };
+  EXPECT_THROW(cudf::streaming_rolling_window(0, 1, 1, sum()), std::invalid_argument);
+  EXPECT_THROW(cudf::streaming_rolling_window(1, -1, 1, sum()), std::invalid_argument);
+  EXPECT_THROW(cudf::streaming_rolling_window(
+                 1, 1, 1, cudf::make_lead_aggregation<cudf::rolling_aggregation>(1)),
+               std::invalid_argument);
+
+  auto srw = cudf::streaming_rolling_window(2, 0, 1, sum());
+  EXPECT_THROW(srw.finish(), cudf::logic_error);
+  srw.update(ints_column{1, 2});
+  EXPECT_THROW(srw.update(bigints_column{3}), cudf::data_type_error);
+  srw.finish();
+  EXPECT_THROW(srw.update(ints_column{3}), cudf::logic_error);
+}
@@ -25,6 +25,9 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
+#include <vector>
+
 struct SearchTest : public cudf::test::BaseFixture {};
 
 using cudf::numeric_scalar;
@@ -1871,4 +1874,132 @@ TYPED_TEST(FixedPointTestAllReps, FixedPointUpperBound)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, batched_search)
+{
+  using int_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using size_col = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+
+  int_col haystack0{{10, 20, 20, 30, 50}};
+  int_col haystack1{};
+  int_col haystack2{{-1, 0, 5, 5, 5, 9}, {0, 1, 1, 1, 1, 1}};
+  int_col needles0{{20, 0, 60}};
+  int_col needles1{{4}};
+  int_col needles2{{5, -1, 9}, {1, 0, 1}};
+  int_col needles3{};
+
+  std::vector<cudf::table_view> const haystacks{cudf::table_view{{haystack0}},
+                                                cudf::table_view{{haystack1}},
+                                                cudf::table_view{{haystack2}},
+                                                cudf::table_view{{haystack0}}};
+  std::vector<cudf::table_view> const needles{cudf::table_view{{needles0}},
+                                              cudf::table_view{{needles1}},
+                                              cudf::table_view{{needles2}},
+                                              cudf::table_view{{needles3}}};
+
+  auto const lower = cudf::batched_lower_bound(
+    haystacks, needles, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  auto const upper = cudf::batched_upper_bound(
+    haystacks, needles, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  ASSERT_EQ(lower.size(), haystacks.size());
+  ASSERT_EQ(upper.size(), haystacks.size());
+
+  for (std::size_t idx = 0; idx < haystacks.size(); ++idx) {
+    auto const expect_lower = cudf::lower_bound(
+      haystacks[idx], needles[idx], {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+    auto const expect_upper = cudf::upper_bound(
+      haystacks[idx], needles[idx], {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower[idx], *expect_lower);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper[idx], *expect_upper);
+  }
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower[0], size_col{1, 0, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper[2], size_col{5, 1, 6});
+
+  EXPECT_THROW(cudf::batched_lower_bound(haystacks,
+                                         cudf::host_span<cudf::table_view const>(needles.data(), 1),
+                                         {cudf::order::ASCENDING},
+                                         {cudf::null_order::BEFORE}),
+               std::invalid_argument);
+}
+
+TEST_F(SearchTest, sorted_index)
+{
+  using int_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using size_col = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+  using bool_col = cudf::test::fixed_width_column_wrapper<bool>;
+
+  int_col keys_ints{{0, 10, 20, 20, 30, 50}, {0, 1, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper keys_strs{"", "a", "a", "b", "c", "c"};
+  int_col needles_ints{{20, 0, 20, 60, 30, 30}, {1, 0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper needles_strs{"b", "", "a", "a", "c", "d"};
+  auto const keys    = cudf::table_view{{keys_ints, keys_strs}};
+  auto const needles = cudf::table_view{{needles_ints, needles_strs}};
+
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::BEFORE,
+                                                      cudf::null_order::BEFORE};
+  auto const index = cudf::sorted_index(keys, column_order, null_precedence);
+
+  // searching twice reuses the preprocessed keys
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    auto const lower = index.lower_bound(needles);
+    auto const upper = index.upper_bound(needles);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      *lower, *cudf::lower_bound(keys, needles, column_order, null_precedence));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      *upper, *cudf::upper_bound(keys, needles, column_order, null_precedence));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower, size_col{3, 0, 2, 6, 4, 5});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles), bool_col{1, 1, 1, 0, 1, 0});
+  }
+
+  auto const empty = cudf::table_view{{int_col{}, cudf::test::strings_column_wrapper{}}};
+  EXPECT_EQ(index.contains(empty)->size(), 0);
+
+  auto const wrong_type = cudf::table_view{{needles_strs, needles_ints}};
+  EXPECT_THROW(index.lower_bound(wrong_type), cudf::data_type_error);
+  EXPECT_THROW(index.upper_bound(cudf::table_view{{needles_ints}}), std::invalid_argument);
+  EXPECT_THROW(cudf::sorted_index(keys, {cudf::order::ASCENDING}, {}), std::invalid_argument);
+}
+
+TEST_F(SearchTest, haystack_set)
+{
+  using int_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using bool_col = cudf::test::fixed_width_column_wrapper<bool>;
+  auto constexpr nan = std::numeric_limits<double>::quiet_NaN();
+
+  int_col haystack_ints{{5, 4, 1, 2, 3, 0}, {1, 1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<double> haystack_doubles{0.5, 4., nan, 2., 3., 0.};
+  auto const haystack = cudf::table_view{{haystack_ints, haystack_doubles}};
+
+  int_col needles_ints{{0, 1, 2, 4, 0, 5}, {1, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<double> needles_doubles{0., nan, 2., 4., 0., 0.};
+  auto const needles = cudf::table_view{{needles_ints, needles_doubles}};
+
+  {
+    auto const set = cudf::haystack_set(haystack);
+    // probing twice reuses the same set
+    for (int repeat = 0; repeat < 2; ++repeat) {
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*set.contains(needles), bool_col{0, 1, 1, 1, 1, 0});
+    }
+    auto const empty =
+      cudf::table_view{{int_col{}, cudf::test::fixed_width_column_wrapper<double>{}}};
+    EXPECT_EQ(set.contains(empty)->size(), 0);
+  }
+  {
+    auto const set =
+      cudf::haystack_set(haystack, cudf::null_equality::UNEQUAL, cudf::nan_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*set.contains(needles), bool_col{0, 0, 1, 1, 0, 0});
+  }
+  {
+    auto const empty_haystack =
+      cudf::table_view{{int_col{}, cudf::test::fixed_width_column_wrapper<double>{}}};
+    auto const set = cudf::haystack_set(empty_haystack);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*set.contains(needles), bool_col{0, 0, 0, 0, 0, 0});
+  }
+
+  auto const set = cudf::haystack_set(haystack);
+  EXPECT_THROW(set.contains(cudf::table_view{{needles_ints}}), std::invalid_argument);
+  EXPECT_THROW(set.contains(cudf::table_view{{needles_doubles, needles_ints}}),
+               cudf::data_type_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+struct ExternalSortTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// Returns all the chunks of the sorted rows of `sorter`
+std::unique_ptr<cudf::table> sorted_rows(cudf::external_sorter& sorter)
+{
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (auto chunk = sorter.next()) {
+    chunks.push_back(std::move(chunk));
+  }
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  return cudf::concatenate(views);
+}
+
+}  // namespace
+
+TEST_F(ExternalSortTest, ManyRuns)
+{
+  // Unique keys, so that the sorted rows are unique
+  auto constexpr num_tables     = 40;
+  auto constexpr rows_per_table = 25;
+  auto constexpr num_rows       = num_tables * rows_per_table;
+  auto const keys_iter          = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 601) % num_rows); });
+  auto const keys_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 7; });
+  auto const vals_iter = thrust::make_counting_iterator<int64_t>(0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows, keys_valid);
+  cudf::test::fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+  cudf::table_view const input{{vals, keys}};
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::BEFORE};
+  auto const expected = cudf::sort_by_key(input, input.select({1}), column_order, null_precedence);
+
+  // A tiny budget spills pieces of single rows and merges the runs in several passes
+  for (std::size_t const budget : {std::size_t{1}, std::size_t{1} << 12, std::size_t{1} << 30}) {
+    cudf::external_sorter sorter({1}, column_order, null_precedence, budget);
+    for (auto begin = 0; begin < num_rows; begin += rows_per_table) {
+      sorter.add(cudf::slice(input, {begin, begin + rows_per_table}).front());
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), sorted_rows(sorter)->view());
+    EXPECT_EQ(sorter.next(), nullptr);
+    EXPECT_THROW(sorter.add(input), cudf::logic_error);
+  }
+}
+
+TEST_F(ExternalSortTest, Empty)
+{
+  cudf::external_sorter sorter({0}, {}, {}, 1 << 20);
+  EXPECT_EQ(sorter.next(), nullptr);
+
+  EXPECT_THROW(cudf::external_sorter({0}, {}, {}, 0), std::invalid_argument);
+}
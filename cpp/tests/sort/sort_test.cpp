@@ -1099,6 +1099,108 @@ TEST_F(SortCornerTest, WithEmptyStructColumn)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected3, got3->view());
 };
 
+TEST_F(SortCornerTest, StructKeysWithNullsAtEachLevel)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+  // struct{int, int} with a null struct and a null child
+  int_col child1{{1, 1, 0, 2, 1, 0}, {1, 1, 0, 1, 1, 1}};
+  int_col child2{{5, 3, 2, 1, 4, 9}};
+  auto const struct_col =
+    cudf::test::structs_column_wrapper{{child1, child2}, {1, 1, 1, 1, 0, 1}}.release();
+  int_col col{{0, 1, 2, 3, 4, 5}};
+  cudf::table_view input{{struct_col->view(), col}};
+
+  int_col expected{{4, 2, 5, 1, 0, 3}};
+  auto got = cudf::sorted_order(input, {cudf::order::ASCENDING, cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  int_col expected_desc{{4, 2, 3, 0, 1, 5}};
+  got = cudf::sorted_order(input,
+                           {cudf::order::DESCENDING, cudf::order::ASCENDING},
+                           {cudf::null_order::AFTER, cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+
+  // a sliced struct column orders the rows of the slice
+  auto const sliced = cudf::slice(struct_col->view(), {1, 5}).front();
+  int_col expected_sliced{{3, 1, 0, 2}};
+  got = cudf::sorted_order(cudf::table_view{{sliced}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sliced, got->view());
+}
+
+struct SortNormalizedKeys : public cudf::test::BaseFixture {};
+
+TEST_F(SortNormalizedKeys, FixedWidthMixedOrdersAndNulls)
+{
+  auto constexpr NaN = std::numeric_limits<double>::quiet_NaN();
+
+  cudf::test::fixed_width_column_wrapper<int64_t> col1{{3, 1, 3, 0, 1, 3, 0, 1},
+                                                       {1, 1, 1, 0, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> col2{
+    {10, 20, 10, 5, 20, 30, 5, 0}, {1, 1, 1, 1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<double> col3{-0.0, NaN, 0.0, 1.0, -1.0, 2.0, 0.5, 4.0};
+  cudf::table_view input{{col1, col2, col3}};
+
+  std::vector<cudf::order> column_order{
+    cudf::order::ASCENDING, cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{
+    cudf::null_order::AFTER, cudf::null_order::BEFORE, cudf::null_order::AFTER};
+
+  // The nulls of the descending column are last, -0.0 equals 0.0 and NaN is the greatest value
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{{4, 1, 7, 5, 0, 2, 6, 3}};
+  auto got = cudf::stable_sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  auto const sliced = cudf::slice(input, {2, 8}).front();
+  got               = cudf::stable_sorted_order(sliced, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{{2, 5, 3, 0, 4, 1}}, got->view());
+}
+
+TEST_F(SortNormalizedKeys, StringsWithCommonPrefixes)
+{
+  cudf::test::strings_column_wrapper input({"https://b.com/2",
+                                            "https://a.com/10",
+                                            "",
+                                            "id",
+                                            "https://a.com/1",
+                                            "",
+                                            "https://a.com/10",
+                                            "id0"},
+                                           {1, 1, 0, 1, 1, 1, 1, 1});
+
+  auto got = cudf::stable_sorted_order(cudf::table_view{{input}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{{2, 5, 4, 1, 6, 0, 3, 7}}, got->view());
+
+  got = cudf::stable_sorted_order(
+    cudf::table_view{{input}}, {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{{2, 7, 3, 0, 1, 6, 4, 5}}, got->view());
+}
+
+TEST_F(SortNormalizedKeys, Dictionary)
+{
+  std::vector<char const*> h_input{"c", "a", "", "b", "c", "", "a", "bb"};
+  std::vector<bool> validity{1, 1, 0, 1, 1, 1, 1, 1};
+  cudf::test::dictionary_column_wrapper<std::string> input(
+    h_input.begin(), h_input.end(), validity.begin());
+  cudf::test::strings_column_wrapper decoded(h_input.begin(), h_input.end(), validity.begin());
+
+  std::vector<cudf::order> const orders{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> const null_orders{cudf::null_order::BEFORE,
+                                                  cudf::null_order::AFTER};
+  for (auto const column_order : orders) {
+    for (auto const null_precedence : null_orders) {
+      auto const expected = cudf::stable_sorted_order(
+        cudf::table_view{{decoded}}, {column_order}, {null_precedence});
+      auto const got = cudf::stable_sorted_order(
+        cudf::table_view{{input}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *got);
+    }
+  }
+}
+
 using SortDouble = Sort<double>;
 TEST_F(SortDouble, InfinityAndNan)
 {
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+template <typename T>
+struct TopK : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(TopK, cudf::test::NumericTypes);
+
+TYPED_TEST(TopK, MatchesSortedOrder)
+{
+  using T = TypeParam;
+
+  // Many equal keys, so that the selected ties must be in the order of the stable sort
+  auto constexpr num_rows = 10'000;
+  auto const elements     = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<T>((i * 37) % 100); });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 9 != 0; });
+  cudf::test::fixed_width_column_wrapper<T> col(elements, elements + num_rows, validity);
+  cudf::table_view const input{{col}};
+
+  for (auto const column_order : {cudf::order::ASCENDING, cudf::order::DESCENDING}) {
+    for (auto const null_precedence : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+      auto const sorted = cudf::stable_sorted_order(input, {column_order}, {null_precedence});
+      for (auto const k : {1, 100, 1'200, 5'000, num_rows}) {
+        auto const got = cudf::top_k(input, k, {column_order}, {null_precedence});
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(sorted->view(), {0, k}).front(), got->view());
+      }
+    }
+  }
+}
+
+struct TopKTest : public cudf::test::BaseFixture {};
+
+TEST_F(TopKTest, MultipleColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{5, 8, 1, 9, 1, 3};
+  cudf::test::strings_column_wrapper col2{"a", "b", "c", "d", "a", "f"};
+  cudf::table_view const input{{col1, col2}};
+
+  auto const got = cudf::top_k(input, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<cudf::size_type>{4, 2, 5},
+                                 got->view());
+
+  auto const all = cudf::top_k(input, 10, {cudf::order::DESCENDING, cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{3, 1, 0, 5, 4, 2}, all->view());
+
+  EXPECT_THROW(cudf::top_k(input, -1), std::invalid_argument);
+}
+
+TEST_F(TopKTest, Segmented)
+{
+  using LCW = cudf::test::lists_column_wrapper<cudf::size_type>;
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 3, 7, 7, 10};
+  cudf::table_view const input{{col}};
+
+  auto const got = cudf::segmented_top_k(input, offsets, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(LCW({LCW{2, 1}, LCW{6, 5}, LCW{}, LCW{9, 8}}), got->view());
+
+  auto const descending = cudf::segmented_top_k(input, offsets, 5, {cudf::order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(LCW({LCW{0, 1, 2}, LCW{3, 4, 5, 6}, LCW{}, LCW{7, 8, 9}}),
+                                 descending->view());
+
+  EXPECT_THROW(cudf::segmented_top_k(input, offsets, -1), std::invalid_argument);
+}
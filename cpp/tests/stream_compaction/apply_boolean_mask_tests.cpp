@@ -22,18 +22,24 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
 
 struct ApplyBooleanMask : public cudf::test::BaseFixture {};
 
@@ -375,4 +381,74 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, FilterByExpression)
+{
+  using namespace cudf::test;
+
+  auto const num_rows = 1000;
+  auto const iter     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto col1 = fixed_width_column_wrapper<int32_t>(iter, iter + num_rows, valids);
+  auto col2 = strings_column_wrapper(
+    thrust::make_transform_iterator(iter, [](auto i) { return std::to_string(i); }),
+    thrust::make_transform_iterator(iter + num_rows, [](auto i) { return std::to_string(i); }));
+  auto const input = cudf::table_view{{col1, col2}};
+
+  // col1 % 3 == 1, which is null for the null elements of col1
+  auto const col_ref       = cudf::ast::column_reference(0);
+  auto three               = cudf::numeric_scalar<int32_t>(3);
+  auto one                 = cudf::numeric_scalar<int32_t>(1);
+  auto const three_literal = cudf::ast::literal(three);
+  auto const one_literal   = cudf::ast::literal(one);
+  auto const mod = cudf::ast::operation(cudf::ast::ast_operator::MOD, col_ref, three_literal);
+  auto const predicate = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, mod, one_literal);
+
+  auto const got      = cudf::filter(input, predicate);
+  auto const expected = cudf::apply_boolean_mask(input, *cudf::compute_column(input, predicate));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+
+  auto const empty = cudf::filter(cudf::empty_like(input)->view(), predicate);
+  EXPECT_EQ(empty->num_rows(), 0);
+
+  auto const not_boolean = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref, col_ref);
+  EXPECT_THROW(cudf::filter(input, not_boolean), cudf::logic_error);
+}
+
+TEST_F(ApplyBooleanMask, ChainedSelection)
+{
+  using namespace cudf::test;
+
+  auto col1 = fixed_width_column_wrapper<int32_t>{{5, 1, 8, 3, 9, 2, 7}, {1, 1, 1, 0, 1, 1, 1}};
+  auto col2 = strings_column_wrapper{"a", "bb", "ccc", "dd", "e", "ff", "ggg"};
+  auto const input = cudf::table_view{{col1, col2}};
+
+  auto const first_mask =
+    fixed_width_column_wrapper<bool>{{1, 0, 1, 1, 1, 1, 1}, {1, 1, 1, 1, 1, 1, 0}};
+  auto const first = cudf::make_selection(first_mask);
+  EXPECT_EQ(first.size, 7);
+  EXPECT_EQ(first.num_selected, 5);
+
+  // col1 > 4, only evaluated on the selected rows
+  auto const col_ref   = cudf::ast::column_reference(0);
+  auto four            = cudf::numeric_scalar<int32_t>(4);
+  auto const literal   = cudf::ast::literal(four);
+  auto const predicate = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, literal);
+  auto const second    = cudf::refine_selection(first, input, predicate);
+  EXPECT_EQ(second.num_selected, 3);
+
+  auto const expected1 = fixed_width_column_wrapper<int32_t>{5, 8, 9};
+  auto const expected2 = strings_column_wrapper{"a", "ccc", "e"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected1, expected2}),
+                                cudf::apply_selection(input, second)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int32_t>{0, 2, 4},
+                                 *cudf::selection_to_indices(second));
+
+  auto const last_mask = fixed_width_column_wrapper<bool>{0, 0, 0, 0, 1, 0, 0};
+  auto const last      = cudf::refine_selection(second, last_mask);
+  EXPECT_EQ(last.num_selected, 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int32_t>{4},
+                                 *cudf::selection_to_indices(last));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -22,6 +22,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
@@ -30,6 +31,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <string>
 
 using lists_col   = cudf::test::lists_column_wrapper<int32_t>;
 using structs_col = cudf::test::structs_column_wrapper;
@@ -365,3 +368,35 @@ TEST_F(DistinctCount, NullableStructOfStructs)
   EXPECT_EQ(6, cudf::distinct_count(input, null_equality::EQUAL));
   EXPECT_EQ(8, cudf::distinct_count(input, null_equality::UNEQUAL));
 }
+
+TEST_F(DistinctCount, ApproxManyRows)
+{
+  auto constexpr num_rows     = 100'000;
+  auto constexpr num_distinct = 5'000;
+  auto const key_iter         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 7919) % num_distinct); });
+  auto const str_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 2); });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(key_iter, key_iter + num_rows);
+  cudf::test::strings_column_wrapper strings(str_iter, str_iter + num_rows);
+
+  // Within 5%, three times the standard error of the default precision
+  EXPECT_NEAR(num_distinct, cudf::approx_distinct_count(cudf::table_view{{ints}}), 250);
+  EXPECT_NEAR(num_distinct, cudf::approx_distinct_count(cudf::table_view{{ints, strings}}), 250);
+  EXPECT_NEAR(num_distinct, cudf::approx_distinct_count(cudf::table_view{{ints}}, 16), 100);
+}
+
+TEST_F(DistinctCount, ApproxWithNull)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{5, 4, 3, 5, 8, 1, 4, 5, 0, 9},
+                                                       {1, 1, 1, 1, 1, 1, 1, 1, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+                                                       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+  auto const input = cudf::table_view{{col1, col2}};
+
+  EXPECT_EQ(6, cudf::approx_distinct_count(input));
+  EXPECT_EQ(5, cudf::approx_distinct_count(input, 12, null_policy::EXCLUDE));
+  EXPECT_EQ(0, cudf::approx_distinct_count(cudf::table_view{}));
+  EXPECT_THROW(cudf::approx_distinct_count(input, 3), std::invalid_argument);
+  EXPECT_THROW(cudf::approx_distinct_count(input, 19), std::invalid_argument);
+}
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
@@ -77,6 +78,40 @@ TEST_F(DistinctKeepAny, StringKeyColumn)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_sort, *result_sort);
 }
 
+TEST_F(DistinctKeepAny, LongStringKeyColumn)
+{
+  // strings sharing their first 12 bytes are decided by comparing the full strings
+  auto const keys = strings_col{{"abcdefghijklm",
+                                 "abcdefghijkl",
+                                 "abcdefghijklm",
+                                 "abcdefghijkln",
+                                 "" /*NULL*/,
+                                 "abcdefghijkl",
+                                 "" /*NULL*/},
+                                nulls_at({4, 6})};
+  auto const input   = cudf::table_view{{keys}};
+  auto const key_idx = std::vector<cudf::size_type>{0};
+
+  {
+    auto const exp_sort = strings_col{
+      {"" /*NULL*/, "abcdefghijkl", "abcdefghijklm", "abcdefghijkln"}, null_at(0)};
+    auto const result      = cudf::distinct(input, key_idx, KEEP_ANY);
+    auto const result_sort = cudf::sort_by_key(*result, result->select(key_idx));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_sort}}, *result_sort);
+    EXPECT_EQ(cudf::distinct_count(input, NULL_EQUAL), 4);
+  }
+
+  {
+    auto const exp_sort = strings_col{
+      {"" /*NULL*/, "" /*NULL*/, "abcdefghijkl", "abcdefghijklm", "abcdefghijkln"},
+      nulls_at({0, 1})};
+    auto const result      = cudf::distinct(input, key_idx, KEEP_ANY, NULL_UNEQUAL);
+    auto const result_sort = cudf::sort_by_key(*result, result->select(key_idx));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_sort}}, *result_sort);
+    EXPECT_EQ(cudf::distinct_count(input, NULL_UNEQUAL), 5);
+  }
+}
+
 TEST_F(DistinctKeepFirstLastNone, StringKeyColumn)
 {
   // Column(s) used to test needs to have different rows for the same keys.
@@ -122,6 +157,37 @@ TEST_F(DistinctKeepFirstLastNone, StringKeyColumn)
   }
 }
 
+TEST_F(DistinctKeepFirstLastNone, PrecomputedKeyHashes)
+{
+  auto const col = int32s_col{{0, null, 2, 3, 4, 5, 6}, null_at(1)};
+  auto const keys =
+    strings_col{{"all", "new", "new", "all", "" /*NULL*/, "the", "strings"}, null_at(4)};
+  auto const input   = cudf::table_view{{col, keys}};
+  auto const key_idx = std::vector<cudf::size_type>{1};
+  auto const hashes  = cudf::hashing::murmurhash3_x86_32(input.select(key_idx));
+
+  for (auto const keep : {KEEP_ANY, KEEP_FIRST, KEEP_LAST, KEEP_NONE}) {
+    auto const expected      = cudf::distinct(input, key_idx, keep);
+    auto const expected_sort = cudf::sort_by_key(*expected, expected->select(key_idx));
+    auto const result        = cudf::distinct(input, key_idx, hashes->view(), keep);
+    auto const result_sort   = cudf::sort_by_key(*result, result->select(key_idx));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected_sort, *result_sort);
+  }
+
+  auto const indices =
+    cudf::distinct_indices(input.select(key_idx), hashes->view(), KEEP_FIRST, NULL_UNEQUAL);
+
+  auto const exp_indices  = int32s_col{0, 1, 4, 5, 6};
+  auto const indices_sort = cudf::sort(cudf::table_view{{indices->view()}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exp_indices, indices_sort->get_column(0));
+
+  auto const wrong_type = int32s_col{1, 2, 3, 4, 5, 6, 7};
+  EXPECT_THROW(cudf::distinct(input, key_idx, wrong_type), std::invalid_argument);
+  auto const wrong_size = cudf::hashing::murmurhash3_x86_32(cudf::table_view{{col}});
+  EXPECT_THROW(cudf::distinct(input, key_idx, cudf::slice(wrong_size->view(), {0, 3})[0]),
+               std::invalid_argument);
+}
+
 TEST_F(DistinctKeepAny, EmptyInputTable)
 {
   int32s_col col(std::initializer_list<int32_t>{});
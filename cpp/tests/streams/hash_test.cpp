@@ -52,3 +52,13 @@ TEST_F(HashTest, MultiValue)
   auto const output1 = cudf::hashing::murmurhash3_x86_32(
     input1, cudf::DEFAULT_HASH_SEED, cudf::test::get_default_stream());
 }
+
+TEST_F(HashTest, XXHash3)
+{
+  cudf::test::strings_column_wrapper const strings_col({"", "The quick brown fox", "jumps"});
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100});
+  auto const input = cudf::table_view({strings_col, ints_col});
+
+  cudf::hashing::xxhash3_64(input, cudf::DEFAULT_HASH_SEED, cudf::test::get_default_stream());
+  cudf::hashing::xxhash3_128(input, cudf::DEFAULT_HASH_SEED, cudf::test::get_default_stream());
+}
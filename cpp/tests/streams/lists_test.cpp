@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -87,6 +87,17 @@ TEST_F(ListTest, IndexOfSearchKeys)
                         cudf::test::get_default_stream());
 }
 
+TEST_F(ListTest, HashedListsSearchKeys)
+{
+  cudf::test::lists_column_wrapper<int> list_col{{0, 1}, {2, 3}, {4, 5}};
+  cudf::test::fixed_width_column_wrapper<int> search_keys({1, 2, 3});
+  auto const hashed = cudf::lists::hashed_lists(list_col, cudf::test::get_default_stream());
+  hashed.contains(search_keys, cudf::test::get_default_stream());
+  hashed.index_of(search_keys,
+                  cudf::lists::duplicate_find_option::FIND_FIRST,
+                  cudf::test::get_default_stream());
+}
+
 TEST_F(ListTest, CountElements)
 {
   cudf::test::lists_column_wrapper<int> list_col{{0, 1}, {2, 3, 7}, {4, 5}};
@@ -22,6 +22,8 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/search.hpp>
 
+#include <vector>
+
 class SearchTest : public cudf::test::BaseFixture {};
 
 TEST_F(SearchTest, LowerBound)
@@ -50,6 +52,54 @@ TEST_F(SearchTest, UpperBound)
                     cudf::test::get_default_stream());
 }
 
+TEST_F(SearchTest, BatchedBounds)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> column{10, 20, 30, 40, 50};
+  cudf::test::fixed_width_column_wrapper<int32_t> values{0, 7, 10, 11, 30, 32, 40, 47, 50, 90};
+  std::vector<cudf::table_view> const haystacks{cudf::table_view{{column}},
+                                                cudf::table_view{{values}}};
+  std::vector<cudf::table_view> const needles{cudf::table_view{{values}},
+                                              cudf::table_view{{column}}};
+
+  cudf::batched_lower_bound(haystacks,
+                            needles,
+                            {cudf::order::ASCENDING},
+                            {cudf::null_order::BEFORE},
+                            cudf::test::get_default_stream());
+  cudf::batched_upper_bound(haystacks,
+                            needles,
+                            {cudf::order::ASCENDING},
+                            {cudf::null_order::BEFORE},
+                            cudf::test::get_default_stream());
+}
+
+TEST_F(SearchTest, SortedIndex)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> column{10, 20, 30, 40, 50};
+  cudf::test::fixed_width_column_wrapper<int32_t> values{0, 7, 10, 11, 30, 32, 40, 47, 50, 90};
+
+  auto const index = cudf::sorted_index(cudf::table_view{{column}},
+                                        {cudf::order::ASCENDING},
+                                        {cudf::null_order::BEFORE},
+                                        cudf::test::get_default_stream());
+  auto const needles = cudf::table_view{{values}};
+  index.lower_bound(needles, cudf::test::get_default_stream());
+  index.upper_bound(needles, cudf::test::get_default_stream());
+  index.contains(needles, cudf::test::get_default_stream());
+}
+
+TEST_F(SearchTest, HaystackSet)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> column{10, 20, 30, 40, 50};
+  cudf::test::fixed_width_column_wrapper<int32_t> values{0, 7, 10, 11, 30, 32, 40, 47, 50, 90};
+
+  auto const set = cudf::haystack_set(cudf::table_view{{column}},
+                                      cudf::null_equality::EQUAL,
+                                      cudf::nan_equality::ALL_EQUAL,
+                                      cudf::test::get_default_stream());
+  set.contains(cudf::table_view{{values}}, cudf::test::get_default_stream());
+}
+
 TEST_F(SearchTest, ContainsScalar)
 {
   cudf::test::fixed_width_column_wrapper<int32_t> column{0, 1, 17, 19, 23, 29, 71};
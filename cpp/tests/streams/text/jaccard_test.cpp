@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <nvtext/jaccard.hpp>
+
+class TextJaccardTest : public cudf::test::BaseFixture {};
+
+TEST_F(TextJaccardTest, Jaccard)
+{
+  auto const input1    = cudf::test::strings_column_wrapper({"the fuzzy dog", "little piggy"});
+  auto const input2    = cudf::test::strings_column_wrapper({"the fuzzy cat", "bitty piggy"});
+  auto const view1     = cudf::strings_column_view(input1);
+  auto const view2     = cudf::strings_column_view(input2);
+  auto const stream    = cudf::test::get_default_stream();
+  auto const shingles1 = nvtext::hash_shingles(view1, 5, stream);
+  auto const shingles2 = nvtext::hash_shingles(view2, 5, stream);
+  nvtext::jaccard_index(view1, view2, 5, stream);
+  nvtext::jaccard_index(cudf::lists_column_view(shingles1->view()),
+                        cudf::lists_column_view(shingles2->view()),
+                        stream);
+}
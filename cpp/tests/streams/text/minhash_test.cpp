@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <nvtext/minhash.hpp>
+
+class TextMinHashTest : public cudf::test::BaseFixture {};
+
+TEST_F(TextMinHashTest, LSHBuckets)
+{
+  auto const input =
+    cudf::test::strings_column_wrapper({"the", "fox", "jumped", "over", "thé", "dog"});
+  auto const seeds = cudf::test::fixed_width_column_wrapper<uint64_t>({1, 2, 3, 4, 5, 6});
+  nvtext::minhash_lsh_buckets(cudf::strings_column_view(input),
+                              cudf::column_view(seeds),
+                              3,
+                              2,
+                              4,
+                              cudf::test::get_default_stream());
+}
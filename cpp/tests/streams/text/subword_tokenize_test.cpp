@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <nvtext/subword_tokenize.hpp>
+
+#include <fstream>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+class TextSubwordTest : public cudf::test::BaseFixture {};
+
+namespace {
+// Create a fake hashed vocab text file with the words 'this', 'is', 'a', 'test'
+void create_hashed_vocab(std::string const& hash_file)
+{
+  std::vector<std::pair<int, int>> coefficients(23, {65559, 0});
+  std::ofstream outfile(hash_file, std::ofstream::out);
+  outfile << "1\n0\n" << coefficients.size() << "\n";
+  for (auto c : coefficients)
+    outfile << c.first << " " << c.second << "\n";
+  std::vector<uint64_t> hash_table(23, 0);
+  outfile << hash_table.size() << "\n";
+  hash_table[0]  = 3015668L;
+  hash_table[1]  = 6205475701751155871L;
+  hash_table[5]  = 6358029;
+  hash_table[16] = 451412625363L;
+  hash_table[20] = 6206321707968235495L;
+  for (auto h : hash_table)
+    outfile << h << "\n";
+  outfile << "100\n101\n102\n\n";
+}
+}  // namespace
+
+TEST_F(TextSubwordTest, Tokenize)
+{
+  auto const hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto const vocab = nvtext::load_vocabulary_file(hash_file, cudf::test::get_default_stream());
+
+  auto const input = cudf::test::strings_column_wrapper({"This is a test.", "A test this is."});
+  nvtext::subword_tokenize(cudf::strings_column_view(input),
+                           *vocab,
+                           16,
+                           16,
+                           true,
+                           false,
+                           cudf::test::get_default_stream());
+}
@@ -29,6 +29,7 @@
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 struct StringsContainsTests : public cudf::test::BaseFixture {};
@@ -641,6 +642,105 @@ TEST_F(StringsContainsTests, EndOfString)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
 }
 
+TEST_F(StringsContainsTests, AsciiAutomaton)
+{
+  auto input = cudf::test::strings_column_wrapper(
+    {"hello world", "say hello\n", "HELLO", "", "héllo hello", "xhello", "hello\nworld"});
+  auto view = cudf::strings_column_view(input);
+
+  auto prog     = cudf::strings::regex_program::create("[a-z]+o$");
+  auto results  = cudf::strings::contains_re(view, *prog);
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({0, 1, 0, 0, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  results  = cudf::strings::matches_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  input = cudf::test::strings_column_wrapper(
+    {"555-1234", "call 555-1234 now", "55-1234", "é 555-1234", "5551234"});
+  view     = cudf::strings_column_view(input);
+  prog     = cudf::strings::regex_program::create("\\d{3}-\\d{4}");
+  results  = cudf::strings::contains_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  results  = cudf::strings::matches_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsContainsTests, RequiredLiteral)
+{
+  auto input = cudf::test::strings_column_wrapper({"ERROR: read timeout",
+                                                   "error: timeout",
+                                                   "ERROR only",
+                                                   "timeout ERROR",
+                                                   "",
+                                                   "xxababcx",
+                                                   "abac"});
+  auto view = cudf::strings_column_view(input);
+
+  auto prog     = cudf::strings::regex_program::create("ERROR.*timeout");
+  auto results  = cudf::strings::contains_re(view, *prog);
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  results             = cudf::strings::count_re(view, *prog);
+  auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 0, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+
+  prog     = cudf::strings::regex_program::create("(ab)+c");
+  results  = cudf::strings::contains_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsContainsTests, LongStrings)
+{
+  // long enough to search each string with a warp
+  auto const filler = std::string(300, 'a');
+  std::vector<std::string> h_strings{
+    filler + " xyz", filler + "xyz", "xyz " + filler, filler, filler + "é xyz" + filler};
+  auto input = cudf::test::strings_column_wrapper(h_strings.begin(), h_strings.end());
+  auto view  = cudf::strings_column_view(input);
+
+  // word boundaries are evaluated by the NFA only
+  auto prog     = cudf::strings::regex_program::create("\\bxyz\\b");
+  auto results  = cudf::strings::contains_re(view, *prog);
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  prog     = cudf::strings::regex_program::create("\\b$");
+  results  = cudf::strings::contains_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsContainsTests, CachedDeviceProgram)
+{
+  auto input = cudf::test::strings_column_wrapper({"abc", "123", "def456", "", "7"});
+  auto view  = cudf::strings_column_view(input);
+
+  auto prog = cudf::strings::regex_program::create("\\d+");
+  EXPECT_FALSE(prog->is_device_program_cached());
+  // working memory sized for fewer strings than the input is not reused
+  prog->cache_device_program(2);
+  EXPECT_TRUE(prog->is_device_program_cached());
+
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({0, 1, 1, 0, 1});
+  for (int i = 0; i < 2; ++i) {
+    auto results = cudf::strings::contains_re(view, *prog);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+  prog->cache_device_program(view.size());
+  auto results        = cudf::strings::count_re(view, *prog);
+  auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+
+  prog->release_device_program();
+  EXPECT_FALSE(prog->is_device_program_cached());
+  results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(StringsContainsTests, DotAll)
 {
   auto input = cudf::test::strings_column_wrapper({"abc\nfa\nef", "fff\nabbc\nfff", "abcdef", ""});
@@ -303,6 +303,31 @@ TEST_F(StringsDatetimeTest, ToTimestampSingleDigits)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, is_expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampIsoFixedWidth)
+{
+  // fixed-width strings are parsed by position and the others by walking the format
+  cudf::test::strings_column_wrapper strings{"2018-07-04T12:00:00.123Z",
+                                             "2019-7-17T2:34:56.001Z",
+                                             "1969-12-31T00:00:00.000Z",
+                                             "2020-04-06T13:09:0x.555Z",
+                                             "1956-01-23T17:18:19.999Z"};
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS}, "%Y-%m-%dT%H:%M:%S.%3fZ");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> expected_ms{
+    1530705600123, 1563330896001, -86400000, 1586178540000, -439886500001};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_ms);
+
+  cudf::test::strings_column_wrapper dates{"2018-07-04", "2019-7-17", "1969-12-31"};
+  results = cudf::strings::to_timestamps(cudf::strings_column_view(dates),
+                                         cudf::data_type{cudf::type_id::TIMESTAMP_DAYS},
+                                         "%Y-%m-%d");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> expected_days{
+    17716, 18094, -1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_days);
+}
+
 TEST_F(StringsDatetimeTest, IsTimestamp)
 {
   cudf::test::strings_column_wrapper strings{"2020-10-07 13:02:03 1PM +0130",
@@ -21,6 +21,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/strings/find_multiple.hpp>
+#include <cudf/strings/literal_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
@@ -55,6 +56,24 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, ContainsAny)
+{
+  std::vector<char const*> h_strings{"Héllo", "thesé", nullptr, "lease", "test strings", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::test::strings_column_wrapper targets({"é", "ring", "eas", "hes"});
+  auto prog = cudf::strings::literal_program::create(cudf::strings_column_view(targets));
+
+  auto results = cudf::strings::contains_any(strings_view, *prog);
+  auto expected =
+    cudf::test::fixed_width_column_wrapper<bool>({1, 1, 0, 1, 1, 0}, {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -154,6 +154,29 @@ TEST_F(StringsConvertTest, ToFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, is_expected);
 }
 
+TEST_F(StringsConvertTest, ToFloats64LongDigits)
+{
+  std::vector<char const*> h_strings{"1234567890.125",
+                                     "0.000000012345678",
+                                     "12345678901234567890123",
+                                     "-98765432.12345678",
+                                     "3.14159265358979323846",
+                                     "0.1",
+                                     "123456789e-5",
+                                     "9007199254740993"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  std::vector<double> h_expected;
+  std::for_each(h_strings.begin(), h_strings.end(), [&](char const* str) {
+    h_expected.push_back(std::atof(str));
+  });
+
+  auto results = cudf::strings::to_floats(cudf::strings_column_view(strings),
+                                          cudf::data_type{cudf::type_id::FLOAT64});
+  cudf::test::fixed_width_column_wrapper<double> expected(h_expected.begin(), h_expected.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromFloats64)
 {
   std::vector<double> h_floats{100,
@@ -183,6 +206,39 @@ TEST_F(StringsConvertTest, FromFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(StringsConvertTest, FromFloatsShortest)
+{
+  cudf::test::fixed_width_column_wrapper<double> doubles(
+    {100.0, 0.1, -12761.125, 0.0, -0.0, 1.0 / 3.0, 839542223232.794248339, 1e22, 1.5e-7, 0.0},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto results = cudf::strings::from_floats_shortest(doubles);
+  cudf::test::strings_column_wrapper expected_doubles({"100.0",
+                                                       "0.1",
+                                                       "-12761.125",
+                                                       "0.0",
+                                                       "-0.0",
+                                                       "0.3333333333333333",
+                                                       "8.395422232327942e+11",
+                                                       "1.0e+22",
+                                                       "1.5e-07",
+                                                       ""},
+                                                      {1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_doubles);
+
+  // the output converts back to the same values
+  auto round_trip = cudf::strings::to_floats(cudf::strings_column_view(*results),
+                                             cudf::data_type{cudf::type_id::FLOAT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*round_trip, doubles);
+
+  cudf::test::fixed_width_column_wrapper<float> floats({1.1f,
+                                                        839542223232.79f,
+                                                        std::numeric_limits<float>::quiet_NaN(),
+                                                        -std::numeric_limits<float>::infinity()});
+  results = cudf::strings::from_floats_shortest(floats);
+  cudf::test::strings_column_wrapper expected_floats({"1.1", "8.3954224e+11", "NaN", "-Inf"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_floats);
+}
+
 TEST_F(StringsConvertTest, ZeroSizeStringsColumnFloat)
 {
   cudf::column_view zero_size_column(
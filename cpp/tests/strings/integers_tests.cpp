@@ -236,6 +236,29 @@ TEST_F(StringsConvertTest, ToInteger)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_u32);
 }
 
+TEST_F(StringsConvertTest, ToIntegerLongDigits)
+{
+  // runs of 8 digits are converted together
+  cudf::test::strings_column_wrapper strings({"123456789012345678",
+                                              "-9223372036854775807",
+                                              "00000000000000000042",
+                                              "12345678x9",
+                                              "1234567",
+                                              "+87654321",
+                                              "1234567890123456789"});
+
+  auto results = cudf::strings::to_integers(cudf::strings_column_view(strings),
+                                            cudf::data_type{cudf::type_id::INT64});
+  auto const expected = cudf::test::fixed_width_column_wrapper<int64_t>({123456789012345678L,
+                                                                         -9223372036854775807L,
+                                                                         42L,
+                                                                         12345678L,
+                                                                         1234567L,
+                                                                         87654321L,
+                                                                         1234567890123456789L});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
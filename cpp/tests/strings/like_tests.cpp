@@ -115,6 +115,39 @@ TEST_F(StringsLikeTests, Place)
   }
 }
 
+TEST_F(StringsLikeTests, MultipleWildcards)
+{
+  auto const long_str = std::string(1000, 'a') + "xbyz" + std::string(1000, 'b') + "c";
+  cudf::test::strings_column_wrapper input(
+    {"abc", "a1b2c", "cba", "abcabc", "ac", long_str.c_str(), "", "áxéyú", "a%b%c"},
+    {1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto const sv = cudf::strings_column_view(input);
+  {
+    auto const results = cudf::strings::like(sv, std::string("%a%b%c%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, false, true, false, true, false, false, false}, {1, 1, 1, 1, 1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("a%bc%c"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, true, false, false, false, false, false}, {1, 1, 1, 1, 1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("á%é%ú"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, false, false, true, false}, {1, 1, 1, 1, 1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%x%%y%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, true, false, true, false}, {1, 1, 1, 1, 1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+}
+
 TEST_F(StringsLikeTests, Escape)
 {
   cudf::test::strings_column_wrapper input(
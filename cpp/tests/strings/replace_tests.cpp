@@ -21,6 +21,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/combine.hpp>
+#include <cudf/strings/literal_program.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -378,6 +379,34 @@ TEST_F(StringsReplaceTest, ReplaceMulti)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceLiteralProgram)
+{
+  auto input        = build_corpus();
+  auto strings_view = cudf::strings_column_view(input);
+
+  // overlapping targets must resolve the same as the targets-column API
+  cudf::test::strings_column_wrapper targets({"the ", "he", "a ", "to ", "é", "at"});
+  auto targets_view = cudf::strings_column_view(targets);
+  auto prog         = cudf::strings::literal_program::create(targets_view);
+  EXPECT_EQ(prog->targets_count(), 6);
+
+  cudf::test::strings_column_wrapper repls({"_ ", "HE", "A ", "2 ", "e", ""});
+  auto repls_view = cudf::strings_column_view(repls);
+  auto results    = cudf::strings::replace(strings_view, *prog, repls_view);
+  auto expected   = cudf::strings::replace(strings_view, targets_view, repls_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+
+  cudf::test::strings_column_wrapper repl({"* "});
+  results  = cudf::strings::replace(strings_view, *prog, cudf::strings_column_view(repl));
+  expected = cudf::strings::replace(strings_view, targets_view, cudf::strings_column_view(repl));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+
+  cudf::test::strings_column_wrapper invalid({"a", ""});
+  auto invalid_view = cudf::strings_column_view(invalid);
+  EXPECT_THROW(cudf::strings::replace(strings_view, *prog, invalid_view), std::invalid_argument);
+  EXPECT_THROW(cudf::strings::literal_program::create(invalid_view), std::invalid_argument);
+}
+
 TEST_F(StringsReplaceTest, ReplaceMultiLong)
 {
   // The length of the strings are to trigger the code path governed by the
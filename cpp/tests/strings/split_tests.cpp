@@ -84,6 +84,31 @@ TEST_F(StringsSplitTest, SplitWithMax)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, *expected);
 }
 
+TEST_F(StringsSplitTest, SplitRSplitWithMaxNulls)
+{
+  auto const strings = cudf::test::strings_column_wrapper(
+    {"a_b_c_d_e", "", "a__b", "xyz", "_a_", "ab_cd"}, {1, 1, 1, 0, 1, 1});
+  auto const sv = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::split(sv, cudf::string_scalar("_"), 2);
+  cudf::test::strings_column_wrapper col0({"a", "", "a", "", "", "ab"}, {1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper col1({"b", "", "", "", "a", "cd"}, {1, 0, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper col2({"c_d_e", "", "b", "", "", ""}, {1, 0, 1, 0, 1, 0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, cudf::table_view({col0, col1, col2}));
+
+  results = cudf::strings::rsplit(sv, cudf::string_scalar("_"), 2);
+  col0 = cudf::test::strings_column_wrapper({"a_b_c", "", "a", "", "", "ab"}, {1, 1, 1, 0, 1, 1});
+  col1 = cudf::test::strings_column_wrapper({"d", "", "", "", "a", "cd"}, {1, 0, 1, 0, 1, 1});
+  col2 = cudf::test::strings_column_wrapper({"e", "", "b", "", "", ""}, {1, 0, 1, 0, 1, 0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, cudf::table_view({col0, col1, col2}));
+
+  // more splits than any string has tokens
+  results = cudf::strings::split(sv, cudf::string_scalar("_"), 10);
+  EXPECT_EQ(results->num_columns(), 5);
+  results = cudf::strings::rsplit(sv, cudf::string_scalar("_"), 10);
+  EXPECT_EQ(results->num_columns(), 5);
+}
+
 TEST_F(StringsSplitTest, SplitWhitespace)
 {
   std::vector<char const*> h_strings{
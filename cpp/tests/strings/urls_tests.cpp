@@ -65,6 +65,42 @@ TEST_F(StringsConvertTest, UrlEncode)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsConvertTest, UrlEncodeSliced)
+{
+  std::vector<char const*> h_strings{
+    "a b", "é/", nullptr, "", "xyz", "  ", "~.-_", "ü?=&", nullptr, "0123456789"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.cbegin(),
+    h_strings.cend(),
+    thrust::make_transform_iterator(h_strings.cbegin(),
+                                    [](auto const str) { return str != nullptr; }));
+
+  std::vector<char const*> h_expected{"a%20b",
+                                      "%C3%A9%2F",
+                                      nullptr,
+                                      "",
+                                      "xyz",
+                                      "%20%20",
+                                      "~.-_",
+                                      "%C3%BC%3F%3D%26",
+                                      nullptr,
+                                      "0123456789"};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.cbegin(),
+    h_expected.cend(),
+    thrust::make_transform_iterator(h_expected.cbegin(),
+                                    [](auto const str) { return str != nullptr; }));
+
+  std::vector<cudf::size_type> slice_indices{0, 4, 4, 8, 7, 10};
+  auto sliced_strings  = cudf::slice(strings, slice_indices);
+  auto sliced_expected = cudf::slice(expected, slice_indices);
+  for (size_t i = 0; i < sliced_strings.size(); ++i) {
+    auto strings_view = cudf::strings_column_view(sliced_strings[i]);
+    auto results      = cudf::strings::url_encode(strings_view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, sliced_expected[i]);
+  }
+}
+
 TEST_F(StringsConvertTest, UrlDecode)
 {
   std::vector<char const*> h_strings{"www.nvidia.com/rapids/%3Fp%3D%C3%A9",
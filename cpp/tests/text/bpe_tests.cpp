@@ -116,6 +116,36 @@ TEST_F(TextBytePairEncoding, BPEAdjacentPairs)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(TextBytePairEncoding, BPERepeatedWords)
+{
+  auto mpt = cudf::test::strings_column_wrapper(
+    {"e n", "i t", "i s", "e s", "en t", "c e", "es t", "en ce", "t h", "h i", "th is", "s ent"});
+  auto merge_pairs = nvtext::load_merge_pairs(cudf::strings_column_view(mpt));
+
+  cudf::test::strings_column_wrapper input({"thisisit sentence thisisit",
+                                            "sentence sentence",
+                                            "thisisit",
+                                            "thisisitsentence thisisit"});
+  auto results  = nvtext::byte_pair_encoding(cudf::strings_column_view(input), *merge_pairs);
+  auto expected = cudf::test::strings_column_wrapper({"this is it   sent ence   this is it",
+                                                      "sent ence   sent ence",
+                                                      "this is it",
+                                                      "this is it sent ence   this is it"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
+TEST_F(TextBytePairEncoding, BPEPairsWithSpace)
+{
+  // the space can be merged so the input is not split into words on spaces
+  auto mpt         = cudf::test::strings_column_wrapper({"e  ", "h i"});
+  auto merge_pairs = nvtext::load_merge_pairs(cudf::strings_column_view(mpt));
+
+  cudf::test::strings_column_wrapper input({"xe y", "hi xe y"});
+  auto results  = nvtext::byte_pair_encoding(cudf::strings_column_view(input), *merge_pairs);
+  auto expected = cudf::test::strings_column_wrapper({"x e  y", "hi   x e  y"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
 TEST_F(TextBytePairEncoding, BPE_Empty)
 {
   auto mpt         = cudf::test::strings_column_wrapper({"i s", "i t"});
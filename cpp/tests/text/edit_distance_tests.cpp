@@ -25,6 +25,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct TextEditDistanceTest : public cudf::test::BaseFixture {};
@@ -57,6 +58,30 @@ TEST_F(TextEditDistanceTest, EditDistance)
   }
 }
 
+TEST_F(TextEditDistanceTest, EditDistanceLongStrings)
+{
+  // shorter strings of up to 64 characters and longer ones are computed differently
+  auto const fox = std::string("the quick brown fox jumps over the lazy dog");
+  cudf::test::strings_column_wrapper strings(
+    {fox,
+     "the quick brown fox jumped over the lazy dogs and then ran away from the farmer's house",
+     std::string(64, 'a'),
+     std::string(63, 'a') + "é",
+     fox + " " + fox + " ",
+     "thé quick brown fox"});
+  cudf::test::strings_column_wrapper targets(
+    {"the quack brown fix jumps over a lazy dog",
+     "the quick brown fox jumps over the lazy dog and then ran away from the farmer's home",
+     std::string(65, 'a'),
+     "é" + std::string(64, 'a'),
+     fox,
+     "the quick brown fox the quick brown fox the quick brown fox the quick brown fox "});
+  auto results =
+    nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({5, 5, 1, 2, 45, 62});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(TextEditDistanceTest, EditDistanceMatrix)
 {
   std::vector<char const*> h_strings{"dog", nullptr, "hog", "frog", "cat", "", "hat", "clog"};
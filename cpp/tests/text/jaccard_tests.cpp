@@ -18,6 +18,8 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <nvtext/jaccard.hpp>
@@ -67,6 +69,72 @@ TEST_F(JaccardTest, WithNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(JaccardTest, Shingles)
+{
+  auto input1 =
+    cudf::test::strings_column_wrapper({"the quick brown fox", "jumped over the lazy dog."});
+  auto input2 =
+    cudf::test::strings_column_wrapper({"the slowest brown cat", "crawled under the jumping fox"});
+
+  auto shingles1 = nvtext::hash_shingles(cudf::strings_column_view(input1), 5);
+  auto shingles2 = nvtext::hash_shingles(cudf::strings_column_view(input2), 5);
+  auto view1     = cudf::lists_column_view(shingles1->view());
+  auto view2     = cudf::lists_column_view(shingles2->view());
+
+  auto results  = nvtext::jaccard_index(view1, view2);
+  auto expected = cudf::test::fixed_width_column_wrapper<float>({0.103448279f, 0.0697674453f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // each row compared with the single row of the second input
+  auto query =
+    nvtext::hash_shingles(cudf::strings_column_view(cudf::slice(input2, {1, 2}).front()), 5);
+  results  = nvtext::jaccard_index(view1, cudf::lists_column_view(query->view()));
+  expected = cudf::test::fixed_width_column_wrapper<float>({0.f, 0.0697674453f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(JaccardTest, ShinglesBroadcast)
+{
+  auto input = cudf::test::strings_column_wrapper(
+    {"the quick brown fox", "jumped over the lazy dog.", "the lazy brown fox", ""},
+    {1, 1, 1, 0});
+  auto query = cudf::test::strings_column_wrapper({"the lazy brown fox"});
+
+  auto shingles = nvtext::hash_shingles(cudf::strings_column_view(input), 5);
+  auto queries  = nvtext::hash_shingles(cudf::strings_column_view(query), 5);
+  auto view     = cudf::lists_column_view(shingles->view());
+
+  auto results  = nvtext::jaccard_index(view, cudf::lists_column_view(queries->view()));
+  auto expected = cudf::test::fixed_width_column_wrapper<float>(
+    {0.260869562f, 0.166666672f, 1.0f, 0.f}, {1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // sliced rows compared with the same rows
+  auto sliced = cudf::slice(shingles->view(), {1, 3}).front();
+  results =
+    nvtext::jaccard_index(cudf::lists_column_view(sliced), cudf::lists_column_view(sliced));
+  expected = cudf::test::fixed_width_column_wrapper<float>({1.0f, 1.0f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // a null single row nulls every output row
+  auto null_query = cudf::test::strings_column_wrapper({""}, {0});
+  queries         = nvtext::hash_shingles(cudf::strings_column_view(null_query), 5);
+  results         = nvtext::jaccard_index(view, cudf::lists_column_view(queries->view()));
+  EXPECT_EQ(results->null_count(), results->size());
+}
+
+TEST_F(JaccardTest, HashLists)
+{
+  using LCW   = cudf::test::lists_column_wrapper<uint32_t>;
+  auto input1 = LCW({LCW{1, 2, 2, 3}, LCW{5}, LCW{}});
+  auto input2 = LCW({LCW{2, 3, 4}, LCW{}, LCW{}});
+
+  auto results =
+    nvtext::jaccard_index(cudf::lists_column_view(input1), cudf::lists_column_view(input2));
+  auto expected = cudf::test::fixed_width_column_wrapper<float>({0.5f, 0.f, 0.f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(JaccardTest, Errors)
 {
   auto input = cudf::test::strings_column_wrapper({"1", "2", "3"});
@@ -77,4 +145,27 @@ TEST_F(JaccardTest, Errors)
   auto input2 = cudf::test::strings_column_wrapper({"1", "2"});
   auto view2  = cudf::strings_column_view(input2);
   EXPECT_THROW(nvtext::jaccard_index(view, view2, 5), std::invalid_argument);
+
+  EXPECT_THROW(nvtext::hash_shingles(view, 1), std::invalid_argument);
+
+  using LCW   = cudf::test::lists_column_wrapper<uint32_t>;
+  auto lists1 = LCW({LCW{1, 2}, LCW{3}, LCW{4}});
+  auto lists2 = LCW({LCW{1, 2}, LCW{3}});
+  auto lview1 = cudf::lists_column_view(lists1);
+  auto lview2 = cudf::lists_column_view(lists2);
+  EXPECT_THROW(nvtext::jaccard_index(lview1, lview2), std::invalid_argument);
+  auto signed_lists = cudf::test::lists_column_wrapper<int32_t>({{1, 2}, {3}, {4}});
+  EXPECT_THROW(nvtext::jaccard_index(lview1, cudf::lists_column_view(signed_lists)),
+               std::invalid_argument);
+}
+
+TEST_F(JaccardTest, EmptyShingles)
+{
+  auto input   = cudf::test::strings_column_wrapper();
+  auto results = nvtext::hash_shingles(cudf::strings_column_view(input), 5);
+  EXPECT_EQ(results->size(), 0);
+  auto view = cudf::lists_column_view(results->view());
+  results   = nvtext::jaccard_index(view, view);
+  EXPECT_EQ(results->size(), 0);
+  EXPECT_EQ(results->type(), cudf::data_type{cudf::type_id::FLOAT32});
 }
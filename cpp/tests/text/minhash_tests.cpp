@@ -20,6 +20,8 @@
 #include <cudf_test/iterator_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -28,8 +30,27 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <vector>
 
+namespace {
+/**
+ * @brief Computes the expected LSH buckets from the minhash64 values of a single row
+ */
+std::vector<uint64_t> lsh_buckets(std::vector<uint64_t> const& minima,
+                                  cudf::size_type rows_per_band)
+{
+  std::vector<uint64_t> buckets;
+  for (std::size_t i = 0; i < minima.size(); ++i) {
+    auto const band = i / rows_per_band;
+    if (i % rows_per_band == 0) { buckets.push_back(band); }
+    buckets.back() = cudf::hashing::detail::hash_combine(buckets.back(), minima[i]);
+  }
+  return buckets;
+}
+}  // namespace
+
 struct MinHashTest : public cudf::test::BaseFixture {};
 
 TEST_F(MinHashTest, Basic)
@@ -139,6 +160,69 @@ TEST_F(MinHashTest, MultiSeedWithNullInputRow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results64, expected64);
 }
 
+TEST_F(MinHashTest, LSHBuckets)
+{
+  auto validity = cudf::test::iterators::null_at(1);
+  auto input    = cudf::test::strings_column_wrapper(
+    {"doc 1", "", "", "d", "The quick brown fox jumpéd over the lazy brown dog."}, validity);
+  auto view = cudf::strings_column_view(input);
+
+  auto seeds   = cudf::test::fixed_width_column_wrapper<uint64_t>({0, 1, 2, 0, 1, 2});
+  auto results = nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds), 2, 3);
+
+  using LCW64 = cudf::test::lists_column_wrapper<uint64_t>;
+  std::vector<uint64_t> const doc1{
+    774489391575805754ul, 10435654231793485448ul, 1188598072697676120ul};
+  std::vector<uint64_t> const d{
+    14660046701545912182ul, 17106501326045553694ul, 17713478494106035784ul};
+  std::vector<uint64_t> const fox{
+    398062025280761388ul, 377720198157450084ul, 984941365662009329ul};
+  auto const two_bands = [](std::vector<uint64_t> const& minima) {
+    auto all = minima;
+    all.insert(all.end(), minima.begin(), minima.end());
+    auto const buckets = lsh_buckets(all, 3);
+    return LCW64(buckets.begin(), buckets.end());
+  };
+  LCW64 expected(
+    {two_bands(doc1), LCW64{}, two_bands({0ul, 0ul, 0ul}), two_bands(d), two_bands(fox)},
+    validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(MinHashTest, LSHBucketsManySeeds)
+{
+  // more seeds than are kept in shared memory at once with bands spanning the tiles
+  std::vector<std::string> h_input;
+  for (int i = 0; i < 100; ++i) {
+    h_input.push_back("document number " + std::to_string(i) + " of many documents");
+  }
+  auto input = cudf::test::strings_column_wrapper(h_input.begin(), h_input.end());
+  auto view  = cudf::strings_column_view(input);
+
+  cudf::size_type const bands         = 100;
+  cudf::size_type const rows_per_band = 3;
+  auto const seed_values              = thrust::make_counting_iterator<uint64_t>(1);
+  auto seeds                          = cudf::test::fixed_width_column_wrapper<uint64_t>(
+    seed_values, seed_values + bands * rows_per_band);
+
+  auto results = nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds), bands, rows_per_band);
+  auto minima  = nvtext::minhash64(view, cudf::column_view(seeds));
+
+  auto const h_minima =
+    cudf::test::to_host<uint64_t>(cudf::lists_column_view(minima->view()).child()).first;
+  std::vector<uint64_t> expected;
+  for (std::size_t row = 0; row < h_input.size(); ++row) {
+    auto const begin   = h_minima.begin() + row * bands * rows_per_band;
+    auto const buckets = lsh_buckets(std::vector<uint64_t>(begin, begin + bands * rows_per_band),
+                                     rows_per_band);
+    expected.insert(expected.end(), buckets.begin(), buckets.end());
+  }
+  EXPECT_EQ(results->size(), static_cast<cudf::size_type>(h_input.size()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::lists_column_view(results->view()).child(),
+    cudf::test::fixed_width_column_wrapper<uint64_t>(expected.begin(), expected.end()));
+}
+
 TEST_F(MinHashTest, EmptyTest)
 {
   auto input   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -147,6 +231,9 @@ TEST_F(MinHashTest, EmptyTest)
   EXPECT_EQ(results->size(), 0);
   results = nvtext::minhash64(view);
   EXPECT_EQ(results->size(), 0);
+  auto seeds = cudf::test::fixed_width_column_wrapper<uint64_t>({1, 2});
+  results    = nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds), 1, 2);
+  EXPECT_EQ(results->size(), 0);
 }
 
 TEST_F(MinHashTest, ErrorsTest)
@@ -159,6 +246,13 @@ TEST_F(MinHashTest, ErrorsTest)
   EXPECT_THROW(nvtext::minhash(view, cudf::column_view(seeds)), std::invalid_argument);
   auto seeds64 = cudf::test::fixed_width_column_wrapper<uint64_t>();
   EXPECT_THROW(nvtext::minhash64(view, cudf::column_view(seeds64)), std::invalid_argument);
+  seeds64 = cudf::test::fixed_width_column_wrapper<uint64_t>({1, 2, 3});
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds64), 2, 2),
+               std::invalid_argument);
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds64), 0, 3),
+               std::invalid_argument);
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds64), 3, 1, 1),
+               std::invalid_argument);
 
   std::vector<std::string> h_input(50000, "");
   input = cudf::test::strings_column_wrapper(h_input.begin(), h_input.end());
@@ -169,4 +263,6 @@ TEST_F(MinHashTest, ErrorsTest)
   EXPECT_THROW(nvtext::minhash(view, cudf::column_view(seeds)), std::overflow_error);
   seeds64 = cudf::test::fixed_width_column_wrapper<uint64_t>(zeroes, zeroes + 50000);
   EXPECT_THROW(nvtext::minhash64(view, cudf::column_view(seeds64)), std::overflow_error);
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(view, cudf::column_view(seeds64), 50000, 1),
+               std::overflow_error);
 }
@@ -25,6 +25,9 @@
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/transform.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
+
+#include <stdexcept>
 
 namespace transformation {
 struct UnaryOperationIntegrationTest : public cudf::test::BaseFixture {};
@@ -220,4 +223,56 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, WarmTransformKernel)
+{
+  // c = a + 7, a function no other test uses so that its first request is a miss
+  char const cuda[] = "__device__ inline void f(int* output,int input){*output = input + 7;}";
+
+  auto const type = cudf::data_type(cudf::type_id::INT32);
+  cudf::reset_kernel_cache_statistics();
+  cudf::warm_transform(type, cuda, type, false);
+  auto const warmed = cudf::get_kernel_cache_statistics();
+  EXPECT_EQ(warmed.misses, 1u);
+  EXPECT_EQ(warmed.hits, 0u);
+
+  // The transform reuses the warmed kernel
+  using dtype    = int;
+  auto op        = [](dtype a) { return a + 7; };
+  auto data_init = [](cudf::size_type row) { return row; };
+  test_udf<dtype>(cuda, op, data_init, 500, false);
+  auto const used = cudf::get_kernel_cache_statistics();
+  EXPECT_EQ(used.misses, 1u);
+  EXPECT_EQ(used.hits, 1u);
+
+  EXPECT_THROW(cudf::warm_transform(cudf::data_type(cudf::type_id::STRING), cuda, type, false),
+               cudf::logic_error);
+}
+
+TEST_F(UnaryOperationIntegrationTest, NullAwareMultipleOutputs)
+{
+  // doubled is valid for every row with -1 for nulls, halved keeps the input nulls
+  char const cuda[] =
+    R"***(
+__device__ inline void f(int* doubled, float* halved, bool* out_valid, int input, bool input_valid)
+{
+  *doubled     = input_valid ? input * 2 : -1;
+  *halved      = input / 2.0f;
+  out_valid[0] = true;
+}
+)***";
+
+  cudf::test::fixed_width_column_wrapper<int32_t> in({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  auto const outputs = cudf::null_aware_transform(
+    in, cuda, {cudf::data_type(cudf::type_id::INT32), cudf::data_type(cudf::type_id::FLOAT32)});
+  ASSERT_EQ(outputs.size(), 2u);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_doubled({2, -1, 6, 8, -1});
+  cudf::test::fixed_width_column_wrapper<float> expected_halved({0.5f, 0.0f, 1.5f, 2.0f, 0.0f},
+                                                                {1, 0, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_doubled, outputs[0]->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_halved, outputs[1]->view());
+
+  EXPECT_THROW(cudf::null_aware_transform(in, cuda, {}), std::invalid_argument);
+}
+
 }  // namespace transformation
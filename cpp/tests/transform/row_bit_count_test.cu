@@ -34,6 +34,8 @@
 #include <thrust/transform.h>
 
 #include <numeric>
+#include <stdexcept>
+#include <vector>
 
 namespace row_bit_count_test {
 
@@ -766,3 +768,25 @@ TEST_F(RowBitCount, EmptyTable)
     EXPECT_TRUE(result != nullptr && result->size() == 0);
   }
 }
+
+TEST_F(RowBitCount, SplitBySize)
+{
+  {
+    // 4 bytes per row
+    auto const iter = thrust::make_counting_iterator(0);
+    cudf::test::fixed_width_column_wrapper<int32_t> ints(iter, iter + 10);
+    auto const splits = cudf::split_by_size(cudf::table_view({ints}), 12);
+    EXPECT_EQ(splits, (std::vector<cudf::size_type>{3, 6, 9}));
+  }
+
+  {
+    // 5, 24, 6 and 5 bytes per row, the second row is larger than the target
+    cudf::test::strings_column_wrapper strings({"a", "bbbbbbbbbbbbbbbbbbbb", "cc", "d"});
+    auto const splits = cudf::split_by_size(cudf::table_view({strings}), 10);
+    EXPECT_EQ(splits, (std::vector<cudf::size_type>{1, 2}));
+    EXPECT_TRUE(cudf::split_by_size(cudf::table_view({strings}), 100).empty());
+    EXPECT_THROW(cudf::split_by_size(cudf::table_view({strings}), 0), std::invalid_argument);
+  }
+
+  EXPECT_TRUE(cudf::split_by_size(cudf::table_view{}, 10).empty());
+}
@@ -19,6 +19,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 
 #include <algorithm>
@@ -190,6 +191,25 @@ TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
 
+class TransposeTestSliced : public cudf::test::BaseFixture {};
+
+TEST_F(TransposeTestSliced, FixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1({1, 2, 3, 4, 5}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int16_t> col2{{6, 7, 8, 9, 10}};
+  auto const sliced = cudf::slice(cudf::table_view{{col1, col2}}, {1, 4}).front();
+
+  auto const result = cudf::transpose(sliced);
+  auto const& view  = result.second;
+  ASSERT_EQ(view.num_columns(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(view.column(0),
+                                      cudf::test::fixed_width_column_wrapper<int16_t>{{2, 7}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(1),
+                                 cudf::test::fixed_width_column_wrapper<int16_t>({3, 8}, {0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(view.column(2),
+                                      cudf::test::fixed_width_column_wrapper<int16_t>{{4, 9}});
+}
+
 class TransposeTestError : public cudf::test::BaseFixture {};
 
 TEST_F(TransposeTestError, MismatchedColumns)
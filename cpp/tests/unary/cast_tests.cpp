@@ -1085,3 +1085,26 @@ TEST_F(FixedPointTestSingleType, Int32ToInt64Convert)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
 }
+
+struct CastInPlaceTest : public cudf::test::BaseFixture {};
+
+TEST_F(CastInPlaceTest, SameSize)
+{
+  auto input =
+    cudf::test::fixed_width_column_wrapper<int32_t>({1, -2, 3, 4}, {1, 1, 0, 1}).release();
+  auto const data = input->view().head();
+
+  auto result = cudf::cast(std::move(input), cudf::data_type{cudf::type_id::FLOAT32});
+  auto expected =
+    cudf::test::fixed_width_column_wrapper<float>({1.f, -2.f, 3.f, 4.f}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+  EXPECT_EQ(result->view().head(), data);
+
+  // a cast to a wider type allocates a new column
+  result          = cudf::cast(std::move(result), cudf::data_type{cudf::type_id::INT64});
+  auto expected64 = cudf::test::fixed_width_column_wrapper<int64_t>({1, -2, 3, 4}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected64);
+
+  EXPECT_THROW(cudf::cast(std::move(result), cudf::data_type{cudf::type_id::STRING}),
+               cudf::logic_error);
+}
@@ -175,6 +175,23 @@ TYPED_TEST(UnaryMathOpsTest, SimpleSQRTWithNullMask)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
 }
 
+TYPED_TEST(UnaryMathOpsTest, SimpleSQRTInPlace)
+{
+  auto input =
+    cudf::test::fixed_width_column_wrapper<TypeParam>{{1, 4, 9, 16}, {1, 1, 0, 1}}.release();
+  auto const data = input->view().head();
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected{{1, 2, 9, 4}, {1, 1, 0, 1}};
+  auto output = cudf::unary_operation(std::move(input), cudf::unary_operator::SQRT);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
+  EXPECT_EQ(output->view().head(), data);
+
+  // the result of NOT is a new BOOL8 column unless the input is BOOL8
+  input  = cudf::test::fixed_width_column_wrapper<TypeParam>{{1, 0, 1}}.release();
+  output = cudf::unary_operation(std::move(input), cudf::unary_operator::NOT);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<bool>{{0, 1, 0}},
+                                 output->view());
+}
+
 TYPED_TEST(UnaryMathOpsTest, SimpleCBRTWithNullMask)
 {
   cudf::test::fixed_width_column_wrapper<TypeParam> input{{1, 27, 125}, {1, 1, 0}};
@@ -26,6 +26,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <src/io/utilities/base64_utilities.hpp>
+#include <src/io/utilities/config_utils.hpp>
 
 using cudf::io::detail::base64_decode;
 using cudf::io::detail::base64_encode;
@@ -69,6 +70,36 @@ TEST(IoUtilitiesTest, HostMemoryGetAndSet)
   cudf::io::set_host_memory_resource(last_mr);
 }
 
+TEST(IoUtilitiesTest, PinnedThresholdGetAndSet)
+{
+  auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+    ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+  auto const last_threshold = cudf::io::get_allocate_host_as_pinned_threshold();
+  cudf::io::set_allocate_host_as_pinned_threshold(1024);
+  EXPECT_EQ(cudf::io::get_allocate_host_as_pinned_threshold(), 1024);
+  EXPECT_TRUE(cudf::io::detail::host_memory_resource_for(1024) ==
+              cudf::io::get_host_memory_resource());
+  EXPECT_FALSE(cudf::io::detail::host_memory_resource_for(1025) ==
+               cudf::io::get_host_memory_resource());
+
+  // Readers work with host buffers on both sides of the threshold
+  constexpr int num_rows = 32 * 1024;
+  auto values            = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int> col(values, values + num_rows);
+
+  cudf::table_view expected({col});
+  auto filepath = temp_env->get_temp_filepath("IoUtilsPinnedThreshold.parquet");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected));
+
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, expected);
+
+  cudf::io::set_allocate_host_as_pinned_threshold(last_threshold);
+}
+
 TEST(IoUtilitiesTest, Base64EncodeAndDecode)
 {
   // a vector of lorem ipsum strings
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/memory_tracking.hpp>
+
+struct MemoryTrackingTest : public cudf::test::BaseFixture {};
+
+TEST_F(MemoryTrackingTest, RecordsApiCalls)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>({5, 3, 1, 4, 2});
+
+  cudf::clear_memory_usage_records();
+  cudf::enable_memory_tracking();
+  EXPECT_TRUE(cudf::is_memory_tracking_enabled());
+  EXPECT_THROW(cudf::enable_memory_tracking(), cudf::logic_error);
+  auto const result = cudf::sorted_order(cudf::table_view({input}));
+  cudf::disable_memory_tracking();
+  EXPECT_FALSE(cudf::is_memory_tracking_enabled());
+
+  auto const records = cudf::get_memory_usage_records();
+  ASSERT_EQ(records.size(), std::size_t{1});
+  auto const& record = records.front();
+  EXPECT_EQ(record.name, "sorted_order");
+  EXPECT_GT(record.allocation_count, std::size_t{0});
+  EXPECT_GE(record.allocated_bytes, record.peak_bytes);
+  EXPECT_GE(record.peak_bytes, record.retained_bytes);
+  EXPECT_GE(record.retained_bytes, result->size() * sizeof(cudf::size_type));
+
+  // nothing is recorded once tracking is disabled
+  cudf::sorted_order(cudf::table_view({input}));
+  EXPECT_EQ(cudf::get_memory_usage_records().size(), std::size_t{1});
+
+  cudf::clear_memory_usage_records();
+  EXPECT_TRUE(cudf::get_memory_usage_records().empty());
+}
+
+TEST_F(MemoryTrackingTest, CountsSynchronizations)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>({5, 3, 1, 4, 2});
+  auto const mask  = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 1, 0, 1});
+
+  cudf::clear_memory_usage_records();
+  cudf::enable_memory_tracking();
+  cudf::apply_boolean_mask(cudf::table_view({input}), mask);
+  cudf::disable_memory_tracking();
+
+  // the size of the output is copied to the host before it is allocated
+  auto const records = cudf::get_memory_usage_records();
+  ASSERT_EQ(records.size(), std::size_t{1});
+  EXPECT_EQ(records.front().name, "apply_boolean_mask");
+  EXPECT_GE(records.front().synchronization_count, std::size_t{1});
+  cudf::clear_memory_usage_records();
+}
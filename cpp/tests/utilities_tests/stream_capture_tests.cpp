@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/stream_capture.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/cuda_async_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Captures the operators on a stream into CUDA graphs
+ *
+ * Allocations are stream ordered for the duration of each test since other allocations
+ * cannot be captured.
+ */
+struct StreamCaptureTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    previous_mr = rmm::mr::set_current_device_resource(&async_mr);
+    cudf::get_default_stream().synchronize();
+  }
+
+  void TearDown() override { rmm::mr::set_current_device_resource(previous_mr); }
+
+  /**
+   * @brief Captures `op` on `stream` then launches the graph and waits for it
+   *
+   * @return The result of `op`, which holds valid data once this returns
+   */
+  template <typename Op>
+  auto capture_and_launch(Op op)
+  {
+    CUDF_CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeThreadLocal));
+    EXPECT_TRUE(cudf::detail::is_stream_capturing(stream));
+    auto result = op(stream.view());
+    cudaGraph_t graph;
+    CUDF_CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph));
+    EXPECT_FALSE(cudf::detail::is_stream_capturing(stream));
+
+    cudaGraphExec_t graph_exec;
+    CUDF_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+    CUDF_CUDA_TRY(cudaGraphLaunch(graph_exec, stream.value()));
+    stream.synchronize();
+    CUDF_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUDF_CUDA_TRY(cudaGraphDestroy(graph));
+    return result;
+  }
+
+  rmm::cuda_stream stream;
+  rmm::mr::cuda_async_memory_resource async_mr;
+  rmm::mr::device_memory_resource* previous_mr{};
+};
+
+TEST_F(StreamCaptureTest, BinaryOperation)
+{
+  auto const lhs = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5});
+  auto const rhs = cudf::test::fixed_width_column_wrapper<int32_t>({10, 20, 30, 40, 50});
+
+  auto const result = capture_and_launch([&](rmm::cuda_stream_view stream) {
+    return cudf::binary_operation(lhs,
+                                  rhs,
+                                  cudf::binary_operator::ADD,
+                                  cudf::data_type{cudf::type_id::INT32},
+                                  stream,
+                                  rmm::mr::get_current_device_resource());
+  });
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>({11, 22, 33, 44, 55});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(StreamCaptureTest, UnaryOperationAndCast)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<double>({1.0, 4.0, 9.0, 16.0});
+
+  auto const result = capture_and_launch([&](rmm::cuda_stream_view stream) {
+    auto const mr    = rmm::mr::get_current_device_resource();
+    auto const roots = cudf::unary_operation(input, cudf::unary_operator::SQRT, stream, mr);
+    return cudf::cast(*roots, cudf::data_type{cudf::type_id::INT32}, stream, mr);
+  });
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(StreamCaptureTest, GatherAndScatter)
+{
+  auto const values      = cudf::test::fixed_width_column_wrapper<int64_t>({10, 20, 30, 40});
+  auto const weights     = cudf::test::fixed_width_column_wrapper<float>({0.5f, 1.5f, 2.5f, 3.5f});
+  auto const input       = cudf::table_view({values, weights});
+  auto const gather_map  = cudf::test::fixed_width_column_wrapper<int32_t>({3, 1, 0});
+  auto const scatter_map = cudf::test::fixed_width_column_wrapper<int32_t>({0, 2});
+
+  auto const result = capture_and_launch([&](rmm::cuda_stream_view stream) {
+    auto const mr       = rmm::mr::get_current_device_resource();
+    auto const gathered =
+      cudf::gather(input, gather_map, cudf::out_of_bounds_policy::DONT_CHECK, stream, mr);
+    return cudf::scatter(gathered->view(), scatter_map, input, stream, mr);
+  });
+
+  auto const expected_values = cudf::test::fixed_width_column_wrapper<int64_t>({40, 20, 20, 40});
+  auto const expected_weights =
+    cudf::test::fixed_width_column_wrapper<float>({3.5f, 1.5f, 1.5f, 3.5f});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({expected_values, expected_weights}));
+}
+
+TEST_F(StreamCaptureTest, ComputeColumn)
+{
+  auto const a     = cudf::test::fixed_width_column_wrapper<int32_t>({3, 20, 1, 50});
+  auto const b     = cudf::test::fixed_width_column_wrapper<int32_t>({10, 7, 10, 7});
+  auto const table = cudf::table_view({a, b});
+
+  auto const col_ref_0  = cudf::ast::column_reference(0);
+  auto const col_ref_1  = cudf::ast::column_reference(1);
+  auto const expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto const result = capture_and_launch([&](rmm::cuda_stream_view stream) {
+    return cudf::detail::compute_column(
+      table, expression, stream, rmm::mr::get_current_device_resource());
+  });
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>({13, 27, 11, 57});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(StreamCaptureTest, StagingBufferCopy)
+{
+  // larger than the bytes copied by one kernel launch when capturing
+  std::vector<int32_t> const h_values(1500, 7);
+  auto const size = h_values.size() * sizeof(int32_t);
+  rmm::device_buffer d_values(size, cudf::get_default_stream());
+  cudf::get_default_stream().synchronize();
+
+  capture_and_launch([&](rmm::cuda_stream_view stream) {
+    auto staging = h_values;
+    cudf::detail::copy_staging_buffer_to_device(d_values.data(), staging.data(), size, stream);
+    return 0;
+  });
+
+  auto const copied = cudf::column_view(cudf::data_type{cudf::type_id::INT32},
+                                        static_cast<cudf::size_type>(h_values.size()),
+                                        d_values.data(),
+                                        nullptr,
+                                        0);
+  auto const expected =
+    cudf::test::fixed_width_column_wrapper<int32_t>(h_values.begin(), h_values.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(copied, expected);
+}
+
+TEST_F(StreamCaptureTest, SmallStagingBufferCopyWithoutCapture)
+{
+  std::vector<int32_t> const h_values(100, 7);
+  auto const size   = h_values.size() * sizeof(int32_t);
+  auto const stream = cudf::get_default_stream();
+  rmm::device_buffer d_values(size, stream);
+
+  {
+    auto staging = h_values;
+    cudf::detail::copy_staging_buffer_to_device(d_values.data(), staging.data(), size, stream);
+    // the staging buffer may be reused as soon as the copy returns
+    std::fill(staging.begin(), staging.end(), 0);
+  }
+
+  auto const copied = cudf::column_view(cudf::data_type{cudf::type_id::INT32},
+                                        static_cast<cudf::size_type>(h_values.size()),
+                                        d_values.data(),
+                                        nullptr,
+                                        0);
+  auto const expected =
+    cudf::test::fixed_width_column_wrapper<int32_t>(h_values.begin(), h_values.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(copied, expected);
+}